@@ -21,9 +21,12 @@ extensions: make map! [
     ; Clipboard is only implemented in Windows at the moment.
 
     BMP +
+    Cache +
     Clipboard -
+    Compressors -  ; needs libzstd and liblz4
     Console +
     Crypt + 
+    CSV +
     Debugger +
     DNS +
     Event +
@@ -33,15 +36,21 @@ extensions: make map! [
     Gob +
     JavaScript -
     JPG +
+    JSON +
     Library +
     Locale +
     Network +
     ODBC -
+    Pgzip +
+    Persistent +
     PNG +
     Process +
+    Rebin +
     Secure +
     Serial +
     Signal -
+    Table +
+    Task -  ; needs definitions: ["REB_THREAD_INSTANCES"]
     TCC -
     Time +
     UUID +
@@ -41,6 +41,15 @@ if javascript-environment = #node [
     use-asyncify: default [false]
 ]
 
+; If the JavaScript extension is only used for JS-NATIVEs that answer right
+; away (and not JS-AWAITERs), neither Asyncify nor threads are needed.  The
+; USE-NO-YIELD build is plain WASM with no instrumentation or worker, which
+; makes for the smallest build products and fastest startup.  See the README
+; in %extensions/javascript/ for what is given up.
+;
+use-no-yield: default [false]
+if use-no-yield [use-asyncify: false]
+
 ; Making an actual debug build of the interpreter core is prohibitive for
 ; emscripten in general usage--even on a developer machine.  This enables a
 ; smaller set of options for getting better feedback about errors in an
@@ -74,8 +83,11 @@ optimize: "s"
 
 extensions: make map! [
     BMP -
+    Cache -
     Clipboard -
     Crypt -
+    Compressors -
+    CSV -
     Console +
     Debugger +
     DNS -
@@ -87,16 +99,21 @@ extensions: make map! [
     Image -
     JavaScript +
     JPG -
+    JSON -
     Library -
     Locale -
     Network -
     ODBC -
+    Persistent -
+    Pgzip -
     PNG -
     Process -
+    Rebin -
     Secure -
     Serial -
     Signal -
     Stdio -
+    Table -
     TCC -
     Time -
     UUID -
@@ -123,9 +140,11 @@ cflags: compose [
         {-DDEBUG_PRINTF_FAIL_LOCATIONS}
     ]]))
 
-    ((if use-asyncify [[
+    ((case [use-no-yield [[
+        {-DUSE_NO_YIELD}  ; JS-AWAITER unavailable, no thread, no Asyncify
+    ]] use-asyncify [[
         {-DUSE_ASYNCIFY}  ; affects rebPromise() methodology
-    ]] else [[
+    ]] true [[
         ; Instruction to emcc (via -s) to include pthread functionalitys
         {-s USE_PTHREADS=1}  ; must be in both cflags and ldflags if used
 
@@ -149,7 +168,7 @@ ldflags: compose [
             {-s ENVIRONMENT='web,worker'}
         ]
         #node [
-            if not use-asyncify [
+            if not any [use-asyncify use-no-yield] [
                 fail [
                     "Emscripten in Node.js does not (yet) support PTHREAD" LF
                     "USE-EMTERPRETER must be set to true in %emscripten.r" LF
@@ -270,7 +289,10 @@ ldflags: compose [
     ;
     ;{-s ALLOW_MEMORY_GROWTH=0}
 
-    ((if use-asyncify [[
+    ((case [use-no-yield [[
+        ; Nothing to add: no -s ASYNCIFY (so no instrumentation and no
+        ; blacklist), and no -s USE_PTHREADS (so no worker .js file).
+    ]] use-asyncify [[
         {-s ASYNCIFY=1}
 
         ; Memory initialization file,
@@ -304,8 +326,7 @@ ldflags: compose [
     ; whitelist needs true function names
 
     {--profiling-funcs}
-    ]]
-    else [[
+    ]] true [[
         {-s USE_PTHREADS=1}  ; must be in both cflags and ldflags if used
 
         ; If you don't specify a thread pool size as a linker flag, the first
@@ -0,0 +1,17 @@
+REBOL [
+    File: %generic-c++-exceptions.r
+
+    Description: {
+        C++ build where fail() is a C++ `throw` and rebRescue() is a
+        try/catch, instead of longjmp() and setjmp().  Code that doesn't
+        fail doesn't pay for setting up traps, but a fail costs more, as
+        the C++ runtime unwinds the stack.  See REBOL_FAIL_USES_EXCEPTIONS
+        in %reb-config.h for the requirements this puts on extensions.
+
+        Compare against %generic-c++.r with `r3 tests/bench.r3 --only trap/`.
+    }
+]
+
+config: %generic-c++.r  ; Inherit most settings from this config
+
+definitions: ["REBOL_FAIL_USES_EXCEPTIONS"]
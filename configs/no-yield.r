@@ -0,0 +1,29 @@
+REBOL [
+    File: %no-yield.r
+
+    Description: {
+        Both the Asyncify and pthread builds exist so that Rebol code deep in
+        a C stack can wait on the browser's MAIN thread (e.g. for a fetch() or
+        for user input).  Asyncify pays for that by instrumenting the whole
+        WebAssembly binary, and pthreads pay for it with SharedArrayBuffer and
+        a worker.
+
+        This config builds with neither.  rebPromise() and JS-NATIVE still
+        work, so long as each JS-NATIVE resolves or rejects during its body.
+        JS-AWAITER raises an error.  That covers hosts that call Rebol from
+        JavaScript for computation, and it gives the smallest .wasm and the
+        fastest startup.
+    }
+]
+
+config: %emscripten.r  ; Inherit most settings from this config
+
+os-id: 0.16.1  ; JS, web, no threads
+
+; Right now, either #web or #node
+;
+javascript-environment: #web
+
+use-no-yield: true
+
+use-wasm: true
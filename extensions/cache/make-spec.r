@@ -0,0 +1,16 @@
+REBOL []
+
+name: 'Cache
+source: %cache/mod-cache.c
+depends: [
+    %cache/t-cache.c
+]
+includes: [
+    %prep/extensions/cache
+]
+definitions: []
+cflags: []
+searches: []
+ldflags: []
+libraries: []
+options: []
@@ -0,0 +1,110 @@
+//
+//  File: %mod-cache.c
+//  Summary: "CACHE! extension main C file"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See notes in %extensions/cache/README.md
+
+#include "sys-core.h"
+
+#include "tmp-mod-cache.h"
+
+#include "sys-cache.h"
+
+
+REBTYP *EG_Cache_Type;  // (E)xtension (G)lobal
+
+//
+//  register-cache-hooks: native [
+//
+//  {Make the CACHE! datatype work with GENERIC actions, comparison ops, etc}
+//
+//      return: [void!]
+//  ]
+//
+REBNATIVE(register_cache_hooks)
+{
+    CACHE_INCLUDE_PARAMS_OF_REGISTER_CACHE_HOOKS;
+
+    // !!! See notes on Hook_Datatype for this poor-man's substitute for a
+    // coherent design of an extensible object system (as per Lisp's CLOS)
+    //
+    EG_Cache_Type = Hook_Datatype(
+        "http://datatypes.rebol.info/cache",
+        "map which drops its least recently used entries",
+        &T_Cache,
+        &PD_Cache,
+        &CT_Cache,
+        &MAKE_Cache,
+        &TO_Cache,
+        &MF_Cache
+    );
+
+    return Init_Void(D_OUT);
+}
+
+
+//
+//  unregister-cache-hooks: native [
+//
+//  {Remove behaviors for CACHE! added by REGISTER-CACHE-HOOKS}
+//
+//      return: [void!]
+//  ]
+//
+REBNATIVE(unregister_cache_hooks)
+{
+    CACHE_INCLUDE_PARAMS_OF_UNREGISTER_CACHE_HOOKS;
+
+    Unhook_Datatype(EG_Cache_Type);
+
+    return Init_Void(D_OUT);
+}
+
+
+//
+//  export cache-stats: native [
+//
+//  {Counts of a CACHE!'s lookups and dropped entries, and its size}
+//
+//      return: [object!]
+//      cache [any-value!]
+//  ]
+//
+REBNATIVE(cache_stats)
+{
+    CACHE_INCLUDE_PARAMS_OF_CACHE_STATS;
+
+    if (not IS_CACHE(ARG(cache)))
+        fail (PAR(cache));
+
+    struct Reb_Cache *cache = VAL_CACHE(ARG(cache));
+
+    return rebValue(
+        "make object! [",
+            "hits:", rebI(cache->hits),
+            "misses:", rebI(cache->misses),
+            "evictions:", rebI(cache->evictions),
+            "expirations:", rebI(cache->expirations),
+            "length:", rebI(cache->count),
+            "bytes:", rebI(cache->bytes),
+        "]",
+    rebEND);
+}
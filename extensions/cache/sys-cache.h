@@ -0,0 +1,128 @@
+//
+//  File: %sys-cache.h
+//  Summary: "Cache datatype header file"
+//  Section: datatypes
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A CACHE! is a map with a limit on how many entries (or roughly how many
+// bytes) it holds.  When adding an entry goes over the limit, the entry that
+// was least recently read or written is dropped.  Entries may also have a
+// "time to live", after which they are dropped when next looked up.
+//
+// The keys and values are kept in the pairlist of a MAP! and found with its
+// hashlist (see %t-map.c), so lookups are the same as for MAP!.  Alongside
+// is a binary series holding a `struct Reb_Cache`, and then one
+// `struct Reb_Cache_Entry` for each pair in the pairlist.  The entries form a
+// doubly linked list from the most recently used to the least, which is
+// updated on each access.
+//
+// A pair that is dropped is taken out of the hashlist and goes on a free
+// list, to be reused by the next key added.  So the pairlist doesn't grow
+// past the most entries the cache has held at once.
+//
+//=//// NOTES /////////////////////////////////////////////////////////////=//
+//
+// * Other extensions can use a cache from C with Init_Cache(), Cache_Get()
+//   and Cache_Put() by adding %../extensions/cache to their includes (as the
+//   TABLE! extension does for VECTOR!).  The CACHE! extension must then be
+//   built into the executable.
+//
+// * See %extensions/cache/README.md
+//
+
+extern REBTYP *EG_Cache_Type;
+
+
+struct Reb_Cache {
+    REBLEN max_entries;  // 0 if no limit on the number of entries
+    REBLEN max_bytes;  // 0 if no limit on the estimated size
+    int64_t ttl_ms;  // 0 if entries don't expire
+
+    REBLEN count;
+    REBLEN bytes;  // estimate, see Cache_Entry_Bytes()
+
+    REBLEN newest;  // pair numbers are 1-based, 0 means none
+    REBLEN oldest;
+    REBLEN free;  // first of the pairs not in use (linked through `older`)
+
+    REBU64 hits;
+    REBU64 misses;
+    REBU64 evictions;
+    REBU64 expirations;
+};
+
+struct Reb_Cache_Entry {
+    REBLEN newer;
+    REBLEN older;  // also links the free list
+    REBLEN bytes;
+    int64_t expires_ms;
+};
+
+
+#define VAL_CACHE_MAP(v) \
+    MAP(PAYLOAD(Any, (v)).first.node)
+
+#define VAL_CACHE_BINARY(v) \
+    SER(PAYLOAD(Any, (v)).second.node)
+
+inline static struct Reb_Cache *VAL_CACHE(const REBCEL *v)
+  { return cast(struct Reb_Cache*, BIN_HEAD(VAL_CACHE_BINARY(v))); }
+
+// Entry N (1-based) for pair N of the pairlist, found after the header.
+//
+inline static struct Reb_Cache_Entry *VAL_CACHE_ENTRY(
+    const REBCEL *v,
+    REBLEN n
+){
+    assert(n != 0);
+    REBYTE *head = BIN_HEAD(VAL_CACHE_BINARY(v));
+    struct Reb_Cache_Entry *entries = cast(
+        struct Reb_Cache_Entry*, head + sizeof(struct Reb_Cache)
+    );
+    return entries + (n - 1);
+}
+
+inline static bool IS_CACHE(const RELVAL *v) {  // QUOTED! doesn't count
+    return IS_CUSTOM(v) and CELL_CUSTOM_TYPE(v) == EG_Cache_Type;
+}
+
+extern REBVAL *Init_Cache(
+    RELVAL *out,
+    REBLEN max_entries,
+    REBLEN max_bytes,
+    int64_t ttl_ms
+);
+extern REBVAL *Cache_Get(const REBCEL *cache, const REBVAL *key);
+extern void Cache_Put(
+    const REBCEL *cache,
+    const REBVAL *key,
+    const REBVAL *opt_value
+);
+extern void Push_Cache_Entries(const REBCEL *cache, bool keys, bool values);
+
+
+// !!! These hooks allow the CACHE! cell type to dispatch to code in the
+// CACHE! extension if it is loaded.
+//
+extern REBINT CT_Cache(const REBCEL *a, const REBCEL *b, REBINT mode);
+extern REB_R MAKE_Cache(REBVAL *out, enum Reb_Kind kind, const REBVAL *opt_parent, const REBVAL *arg);
+extern REB_R TO_Cache(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg);
+extern void MF_Cache(REB_MOLD *mo, const REBCEL *v, bool form);
+extern REBTYPE(Cache);
+extern REB_R PD_Cache(REBPVS *pvs, const REBVAL *picker, const REBVAL *opt_setval);
@@ -0,0 +1,534 @@
+//
+//  File: %t-cache.c
+//  Summary: "cache datatype"
+//  Section: datatypes
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+
+#ifdef TO_WINDOWS
+    #define WIN32_LEAN_AND_MEAN  // trim down the Win32 headers
+    #include <windows.h>
+    #undef IS_ERROR  // winerror.h defines, Rebol has a different meaning
+#else
+    #include <time.h>  // for clock_gettime()
+#endif
+
+#include "sys-core.h"
+
+#include "sys-cache.h"
+
+
+// Milliseconds from some fixed point, for expiring entries.  This is not
+// the time of day, so changing the clock doesn't expire (or revive) them.
+//
+static int64_t Cache_Now_Ms(void)
+{
+  #ifdef TO_WINDOWS
+    return GetTickCount64();
+  #else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return cast(int64_t, ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+  #endif
+}
+
+
+// !!! A rough measure of the memory an entry keeps alive: its two cells and
+// the content of any series they refer to at the top level (the cells of a
+// BLOCK! are counted, but not what they point to).  Series shared with other
+// values are counted in full, so this errs toward dropping entries sooner.
+//
+static REBLEN Cache_Entry_Bytes(const REBVAL *key, const REBVAL *value)
+{
+    REBLEN bytes = 2 * sizeof(REBVAL);
+    if (ANY_SERIES(key))
+        bytes += SER_USED(VAL_SERIES(key)) * SER_WIDE(VAL_SERIES(key));
+    if (ANY_SERIES(value))
+        bytes += SER_USED(VAL_SERIES(value)) * SER_WIDE(VAL_SERIES(value));
+    return bytes;
+}
+
+
+//
+//  Init_Cache: C
+//
+// Make an empty cache.  Limits of 0 mean there's no limit of that kind, but
+// at least one of `max_entries` and `max_bytes` must be given.
+//
+REBVAL *Init_Cache(
+    RELVAL *out,
+    REBLEN max_entries,
+    REBLEN max_bytes,
+    int64_t ttl_ms
+){
+    assert(max_entries != 0 or max_bytes != 0);
+
+    REBLEN capacity = 16;  // grows as needed, up to the most entries held
+    if (max_entries != 0 and max_entries < capacity)
+        capacity = max_entries;
+    REBMAP *map = Make_Map(capacity);
+    Manage_Series(MAP_HASHLIST(map));
+    Manage_Series(MAP_PAIRLIST(map));
+
+    REBBIN *bin = Make_Binary(
+        sizeof(struct Reb_Cache) + capacity * sizeof(struct Reb_Cache_Entry)
+    );
+    struct Reb_Cache *cache = cast(struct Reb_Cache*, BIN_HEAD(bin));
+    memset(cache, 0, sizeof(struct Reb_Cache));
+    cache->max_entries = max_entries;
+    cache->max_bytes = max_bytes;
+    cache->ttl_ms = ttl_ms;
+    TERM_BIN_LEN(bin, sizeof(struct Reb_Cache));
+    Manage_Series(bin);
+
+    RESET_CUSTOM_CELL(
+        out,
+        EG_Cache_Type,
+        CELL_FLAG_FIRST_IS_NODE | CELL_FLAG_SECOND_IS_NODE
+    );
+    INIT_VAL_NODE(out, MAP_PAIRLIST(map));
+    PAYLOAD(Any, out).second.node = NOD(bin);
+    return KNOWN(out);
+}
+
+
+static void Unlink_Cache_Entry(const REBCEL *v, REBLEN n)
+{
+    struct Reb_Cache *cache = VAL_CACHE(v);
+    struct Reb_Cache_Entry *e = VAL_CACHE_ENTRY(v, n);
+
+    if (e->newer)
+        VAL_CACHE_ENTRY(v, e->newer)->older = e->older;
+    else
+        cache->newest = e->older;
+
+    if (e->older)
+        VAL_CACHE_ENTRY(v, e->older)->newer = e->newer;
+    else
+        cache->oldest = e->newer;
+}
+
+
+static void Link_Newest_Cache_Entry(const REBCEL *v, REBLEN n)
+{
+    struct Reb_Cache *cache = VAL_CACHE(v);
+    struct Reb_Cache_Entry *e = VAL_CACHE_ENTRY(v, n);
+
+    e->newer = 0;
+    e->older = cache->newest;
+    if (cache->newest)
+        VAL_CACHE_ENTRY(v, cache->newest)->newer = n;
+    else
+        cache->oldest = n;
+    cache->newest = n;
+}
+
+
+// Hash slot of the key, or -1.  Keys are always looked for caselessly (as
+// with path access to a MAP!), so no two keys in a cache can be synonyms.
+//
+static REBINT Find_Cache_Slot(const REBCEL *v, const RELVAL *key)
+{
+    REBMAP *map = VAL_CACHE_MAP(v);
+    return Find_Key_Hashed(
+        MAP_PAIRLIST(map), MAP_HASHLIST(map), key, SPECIFIED, 2, false, 1
+    );
+}
+
+
+// Take pair N out of the cache, putting it on the free list.
+//
+static void Drop_Cache_Entry(const REBCEL *v, REBLEN n, REBINT slot)
+{
+    REBMAP *map = VAL_CACHE_MAP(v);
+    REBARR *pairlist = MAP_PAIRLIST(map);
+    REBSER *hashlist = MAP_HASHLIST(map);
+
+    RELVAL *key = ARR_AT(pairlist, (n - 1) * 2);
+    if (slot == -1)
+        slot = Find_Cache_Slot(v, key);
+    assert(SER_HEAD(struct Reb_Hash_Slot, hashlist)[slot].index == n);
+    Remove_Hash_Slot(hashlist, slot);
+
+    Note_Series_Mutation(SER(pairlist));
+    Init_Blank(key);  // let go of the key and value for the GC
+    Init_Blank(key + 1);
+
+    Unlink_Cache_Entry(v, n);
+
+    struct Reb_Cache *cache = VAL_CACHE(v);
+    struct Reb_Cache_Entry *e = VAL_CACHE_ENTRY(v, n);
+    cache->count -= 1;
+    cache->bytes -= e->bytes;
+    e->older = cache->free;
+    cache->free = n;
+}
+
+
+// Drop the least recently used entries until the cache is in its limits.
+// The newest entry is always kept, even if it alone is over `max_bytes`.
+//
+static void Evict_Cache_Entries(const REBCEL *v)
+{
+    struct Reb_Cache *cache = VAL_CACHE(v);
+    while (
+        cache->count > 1 and (
+            (cache->max_entries and cache->count > cache->max_entries)
+            or (cache->max_bytes and cache->bytes > cache->max_bytes)
+        )
+    ){
+        Drop_Cache_Entry(v, cache->oldest, -1);
+        cache->evictions += 1;
+    }
+}
+
+
+// Number of a pair for a new key: a free one if there is, else one added to
+// the end of the pairlist (with an entry for it).
+//
+static REBLEN Take_Cache_Pair(const REBCEL *v)
+{
+    struct Reb_Cache *cache = VAL_CACHE(v);
+    if (cache->free) {
+        REBLEN n = cache->free;
+        cache->free = VAL_CACHE_ENTRY(v, n)->older;
+        return n;
+    }
+
+    REBARR *pairlist = MAP_PAIRLIST(VAL_CACHE_MAP(v));
+    REBSER *hashlist = MAP_HASHLIST(VAL_CACHE_MAP(v));
+
+    // The pairs are all in use, so the hashlist has every one of them.  As
+    // in Find_Map_Entry(), it's kept at most half full.  (Growing it means
+    // putting every key back in, see Rehash_Map().)
+    //
+    REBLEN n = ARR_LEN(pairlist) / 2 + 1;
+    if (n > SER_LEN(hashlist) / 2) {
+        Expand_Hash(hashlist);
+
+        REBLEN i = cache->newest;
+        for (; i != 0; i = VAL_CACHE_ENTRY(v, i)->older) {
+            RELVAL *key = ARR_AT(pairlist, (i - 1) * 2);
+            Insert_Hash_Slot(hashlist, Hash_Value(key), i);
+        }
+    }
+
+    Note_Series_Mutation(SER(pairlist));
+    Init_Blank(Alloc_Tail_Array(pairlist));
+    Init_Blank(Alloc_Tail_Array(pairlist));
+
+    REBBIN *bin = VAL_CACHE_BINARY(v);
+    EXPAND_SERIES_TAIL(bin, sizeof(struct Reb_Cache_Entry));  // may move
+    TERM_BIN(bin);
+
+    return n;
+}
+
+
+//
+//  Cache_Get: C
+//
+// The value for `key`, or nullptr if the cache doesn't have it (or has it,
+// but it's expired).  Finding it makes it the most recently used entry.
+//
+REBVAL *Cache_Get(const REBCEL *v, const REBVAL *key)
+{
+    struct Reb_Cache *cache = VAL_CACHE(v);
+
+    REBINT slot = Find_Cache_Slot(v, key);
+    if (slot == -1) {
+        cache->misses += 1;
+        return nullptr;
+    }
+
+    REBSER *hashlist = MAP_HASHLIST(VAL_CACHE_MAP(v));
+    REBLEN n = SER_HEAD(struct Reb_Hash_Slot, hashlist)[slot].index;
+
+    if (
+        cache->ttl_ms != 0
+        and Cache_Now_Ms() >= VAL_CACHE_ENTRY(v, n)->expires_ms
+    ){
+        Drop_Cache_Entry(v, n, slot);
+        cache->expirations += 1;
+        cache->misses += 1;
+        return nullptr;
+    }
+
+    if (cache->newest != n) {
+        Unlink_Cache_Entry(v, n);
+        Link_Newest_Cache_Entry(v, n);
+    }
+    cache->hits += 1;
+
+    return KNOWN(ARR_AT(MAP_PAIRLIST(VAL_CACHE_MAP(v)), (n - 1) * 2 + 1));
+}
+
+
+//
+//  Cache_Put: C
+//
+// Set `key` to `opt_value`, or remove it if that's nullptr or NULL.  Adding
+// a key may drop the least recently used entries to stay in the limits.
+//
+// As with MAP!, the key is not copied, so it is made immutable.
+//
+void Cache_Put(
+    const REBCEL *v,
+    const REBVAL *key,
+    const REBVAL *opt_value
+){
+    assert(not IS_NULLED(key));
+
+    REBARR *pairlist = MAP_PAIRLIST(VAL_CACHE_MAP(v));
+    REBINT slot = Find_Cache_Slot(v, key);
+
+    if (not opt_value or IS_NULLED(opt_value)) {
+        if (slot != -1) {
+            REBSER *hashlist = MAP_HASHLIST(VAL_CACHE_MAP(v));
+            REBLEN n = SER_HEAD(struct Reb_Hash_Slot, hashlist)[slot].index;
+            Drop_Cache_Entry(v, n, slot);
+        }
+        return;
+    }
+
+    REBLEN n;
+    if (slot != -1) {
+        REBSER *hashlist = MAP_HASHLIST(VAL_CACHE_MAP(v));
+        n = SER_HEAD(struct Reb_Hash_Slot, hashlist)[slot].index;
+        Unlink_Cache_Entry(v, n);
+        VAL_CACHE(v)->bytes -= VAL_CACHE_ENTRY(v, n)->bytes;
+        VAL_CACHE(v)->count -= 1;
+    }
+    else {
+        Ensure_Value_Frozen(key, SER(pairlist));
+
+        n = Take_Cache_Pair(v);
+        Note_Series_Mutation(SER(pairlist));
+        Move_Value(ARR_AT(pairlist, (n - 1) * 2), key);
+        Insert_Hash_Slot(
+            MAP_HASHLIST(VAL_CACHE_MAP(v)), Hash_Value(key), n
+        );
+    }
+
+    Note_Series_Mutation(SER(pairlist));
+    Move_Value(ARR_AT(pairlist, (n - 1) * 2 + 1), opt_value);
+
+    struct Reb_Cache *cache = VAL_CACHE(v);
+    struct Reb_Cache_Entry *e = VAL_CACHE_ENTRY(v, n);
+    e->bytes = Cache_Entry_Bytes(key, opt_value);
+    e->expires_ms = cache->ttl_ms == 0 ? 0 : Cache_Now_Ms() + cache->ttl_ms;
+    cache->bytes += e->bytes;
+    cache->count += 1;
+    Link_Newest_Cache_Entry(v, n);
+
+    Evict_Cache_Entries(v);
+}
+
+
+//
+//  Push_Cache_Entries: C
+//
+// Push the keys and/or values, from the most recently used to the least.
+// (Expired entries which haven't been looked up since are included.)
+//
+void Push_Cache_Entries(const REBCEL *v, bool keys, bool values)
+{
+    REBARR *pairlist = MAP_PAIRLIST(VAL_CACHE_MAP(v));
+
+    REBLEN n = VAL_CACHE(v)->newest;
+    for (; n != 0; n = VAL_CACHE_ENTRY(v, n)->older) {
+        RELVAL *key = ARR_AT(pairlist, (n - 1) * 2);
+        if (keys)
+            Move_Value(DS_PUSH(), KNOWN(key));
+        if (values)
+            Move_Value(DS_PUSH(), KNOWN(key + 1));
+    }
+}
+
+
+//
+//  TO_Cache: C
+//
+// The spec is how many entries the cache may hold, or a BLOCK! with any of:
+//
+//     INTEGER! - most entries
+//     BYTES INTEGER! - most bytes (an estimate, see Cache_Entry_Bytes())
+//     TIME! - how long an entry lasts after it was last set
+//
+// e.g. `make cache! [1000 0:01:00]` or `make cache! [bytes 1'000'000]`.
+//
+REB_R TO_Cache(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg)
+{
+    REBI64 max_entries = 0;
+    REBI64 max_bytes = 0;
+    REBI64 ttl_ms = 0;
+
+    if (IS_INTEGER(arg))
+        max_entries = VAL_INT64(arg);
+    else if (IS_BLOCK(arg)) {
+        const RELVAL *item = VAL_ARRAY_AT(arg);
+        for (; NOT_END(item); ++item) {
+            if (IS_INTEGER(item))
+                max_entries = VAL_INT64(item);
+            else if (IS_TIME(item))
+                ttl_ms = VAL_NANO(item) / (SEC_SEC / 1000);
+            else if (
+                IS_WORD(item) and VAL_WORD_SYM(item) == SYM_BYTES
+                and NOT_END(item + 1) and IS_INTEGER(item + 1)
+            ){
+                ++item;
+                max_bytes = VAL_INT64(item);
+            }
+            else
+                fail (Error_Bad_Value_Core(item, VAL_SPECIFIER(arg)));
+        }
+    }
+    else
+        fail (Error_Bad_Make(kind, arg));
+
+    if (
+        max_entries < 0 or max_bytes < 0 or ttl_ms < 0
+        or (max_entries == 0 and max_bytes == 0)
+    ){
+        fail (Error_Bad_Make(kind, arg));
+    }
+    if (max_entries > UINT32_MAX or max_bytes > UINT32_MAX)
+        fail (Error_Overflow_Raw());
+
+    return Init_Cache(out, max_entries, max_bytes, ttl_ms);
+}
+
+
+//
+//  MAKE_Cache: C
+//
+REB_R MAKE_Cache(
+    REBVAL *out,
+    enum Reb_Kind kind,
+    const REBVAL *opt_parent,
+    const REBVAL *arg
+){
+    if (opt_parent)
+        fail (Error_Bad_Make_Parent(kind, opt_parent));
+
+    return TO_Cache(out, kind, arg);
+}
+
+
+//
+//  CT_Cache: C
+//
+REBINT CT_Cache(const REBCEL *a, const REBCEL *b, REBINT mode)
+{
+    if (mode < 0)
+        return -1;  // caches have no order
+
+    // What's in a cache depends on how it was used, so only the same cache
+    // is equal to it.
+    //
+    return VAL_CACHE_MAP(a) == VAL_CACHE_MAP(b) ? 1 : 0;
+}
+
+
+//
+//  PD_Cache: C
+//
+// `cache/key` (or PICK) is the value, or NULL if it's not cached.  Setting
+// it (or POKE) adds it, and setting it to NULL removes it.
+//
+REB_R PD_Cache(
+    REBPVS *pvs,
+    const REBVAL *picker,
+    const REBVAL *opt_setval
+){
+    if (opt_setval) {
+        Cache_Put(pvs->out, picker, opt_setval);
+        return R_INVISIBLE;
+    }
+
+    REBVAL *value = Cache_Get(pvs->out, picker);
+    if (not value)
+        return nullptr;
+
+    return Move_Value(pvs->out, value);
+}
+
+
+//
+//  REBTYPE: C
+//
+REBTYPE(Cache)
+{
+    REBVAL *v = D_ARG(1);
+
+    switch (VAL_WORD_SYM(verb)) {
+      case SYM_REFLECT: {
+        INCLUDE_PARAMS_OF_REFLECT;
+        UNUSED(ARG(value));  // same as `v`
+
+        REBDSP dsp_orig = DSP;
+
+        REBSYM property = VAL_WORD_SYM(ARG(property));
+        switch (property) {
+          case SYM_LENGTH:
+            return Init_Integer(D_OUT, VAL_CACHE(v)->count);
+
+          case SYM_WORDS:
+            Push_Cache_Entries(v, true, false);
+            return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+
+          case SYM_VALUES:
+            Push_Cache_Entries(v, false, true);
+            return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+
+          case SYM_BODY:
+            Push_Cache_Entries(v, true, true);
+            return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+
+          default:
+            break;
+        }
+
+        break; }
+
+      default:
+        break;
+    }
+
+    return R_UNHANDLED;
+}
+
+
+//
+//  MF_Cache: C
+//
+void MF_Cache(REB_MOLD *mo, const REBCEL *v, bool form)
+{
+    UNUSED(form);
+
+    Pre_Mold(mo, v);
+
+    REBDSP dsp_orig = DSP;
+    Push_Cache_Entries(v, true, true);
+    REBARR *array = Pop_Stack_Values(dsp_orig);
+    Mold_Array_At(mo, array, 0, "[]");
+    Free_Unmanaged_Array(array);
+
+    End_Mold(mo);
+}
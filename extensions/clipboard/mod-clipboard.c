@@ -74,6 +74,7 @@ static REB_R Clipboard_Actor(
 
         UNUSED(REF(string));  // handled in dispatcher
         UNUSED(REF(lines));  // handled in dispatcher
+        UNUSED(REF(into));  // handled in dispatcher
 
         SetLastError(NO_ERROR);
         if (not IsClipboardFormatAvailable(CF_UNICODETEXT)) {
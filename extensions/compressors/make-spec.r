@@ -0,0 +1,13 @@
+REBOL []
+
+name: 'Compressors
+source: %compressors/mod-compressors.c
+includes: [
+    %prep/extensions/compressors
+]
+
+; Links to the system's Zstandard and LZ4 libraries (e.g. the libzstd-dev and
+; liblz4-dev packages on Debian).  The LZ4 *frame* API is needed, which has
+; been in liblz4 since 1.7.
+;
+libraries: [%zstd %lz4]
@@ -0,0 +1,522 @@
+//
+//  File: %mod-compressors.c
+//  Summary: "Zstandard and LZ4 compression, whole-buffer and streaming"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// zlib is built into the core, but it's neither the fastest codec nor the
+// one with the best ratio.  This links to the system's libzstd and liblz4
+// to offer those as well:
+//
+// * Zstandard (https://facebook.github.io/zstd/) compresses about as well as
+//   zlib at its fastest levels while running several times faster, and can
+//   use a trained dictionary for small records with a shared structure.
+//
+// * LZ4 (https://lz4.github.io/lz4/) gives up ratio for speed, and is mostly
+//   limited by memory bandwidth when decompressing.  The LZ4 *frame* format
+//   is used (what the `lz4` tool reads and writes), not raw blocks, since
+//   frames record enough information to be decompressed on their own.
+//
+// The streaming interface mirrors MAKE-COMPRESSOR and COMPRESS-STEP in the
+// core: a HANDLE! holds the library's context, and CODEC-STEP pushes chunks
+// through it.  The whole-buffer ZSTD-COMPRESS etc. in %ext-compressors-init.reb
+// are written on top of that, with the same shape as DEFLATE and INFLATE.
+//
+// Library contexts come from the libraries' own allocators, so they are
+// owned by the HANDLE! and freed by its cleaner when it is GC'd.  That way a
+// fail() during a step (including out of memory when growing the output)
+// never leaks them.
+//
+
+#include <zstd.h>
+#include <lz4frame.h>
+
+#include "sys-core.h"
+
+#include "tmp-mod-compressors.h"
+
+
+#define CODEC_CHUNK_SIZE (64 * 1024)  // output is grown by this much at a time
+
+enum Reb_Codec_Kind {
+    CODEC_ZSTD_COMPRESS,
+    CODEC_ZSTD_DECOMPRESS,
+    CODEC_LZ4_COMPRESS,
+    CODEC_LZ4_DECOMPRESS
+};
+
+struct Reb_Codec_Stream {
+    enum Reb_Codec_Kind kind;
+    union {
+        ZSTD_CCtx *zstd_c;
+        ZSTD_DCtx *zstd_d;
+        LZ4F_cctx *lz4_c;
+        LZ4F_dctx *lz4_d;
+    } ctx;
+    LZ4F_preferences_t lz4_prefs;
+    bool begun;  // LZ4 frame header has been written
+    bool finished;  // end of frame was written (or read)
+};
+
+
+static void cleanup_codec_stream(const REBVAL *v)
+{
+    struct Reb_Codec_Stream *s = VAL_HANDLE_POINTER(
+        struct Reb_Codec_Stream, v
+    );
+    switch (s->kind) {
+      case CODEC_ZSTD_COMPRESS:
+        ZSTD_freeCCtx(s->ctx.zstd_c);
+        break;
+
+      case CODEC_ZSTD_DECOMPRESS:
+        ZSTD_freeDCtx(s->ctx.zstd_d);
+        break;
+
+      case CODEC_LZ4_COMPRESS:
+        LZ4F_freeCompressionContext(s->ctx.lz4_c);
+        break;
+
+      case CODEC_LZ4_DECOMPRESS:
+        LZ4F_freeDecompressionContext(s->ctx.lz4_d);
+        break;
+    }
+    free(s);
+}
+
+
+static REBCTX *Error_Codec(const char *msg)
+{
+    DECLARE_LOCAL (arg);
+    Init_Text(arg, Make_String_UTF8(msg));
+    return Error_Bad_Compression_Raw(arg);
+}
+
+
+// The stream struct is made first (and owned by a HANDLE!), so that if
+// making the library context fails the cleaner can run with a null context.
+// All the libraries' free functions accept null.
+//
+static struct Reb_Codec_Stream *Make_Codec_Stream(
+    REBVAL *out,
+    enum Reb_Codec_Kind kind
+){
+    struct Reb_Codec_Stream *s = cast(struct Reb_Codec_Stream*,
+        calloc(1, sizeof(struct Reb_Codec_Stream))
+    );
+    if (not s)
+        fail (Error_No_Memory(sizeof(struct Reb_Codec_Stream)));
+    s->kind = kind;
+
+    Init_Handle_Cdata_Managed(
+        out,
+        s,
+        sizeof(struct Reb_Codec_Stream),
+        &cleanup_codec_stream
+    );
+    return s;
+}
+
+
+//
+//  export make-zstd-stream: native [
+//
+//  {Create a Zstandard compression (or decompression) stream for CODEC-STEP}
+//
+//      return: "Freed when no longer referenced"
+//          [handle!]
+//      /decompress "Make a decompression stream instead"
+//      /level "1 (fast) to 19 (ratio), default 3, negative is faster still"
+//          [integer!]
+//      /dictionary "Dictionary (e.g. from `zstd --train`), same for both ends"
+//          [binary!]
+//  ]
+//
+REBNATIVE(make_zstd_stream)
+{
+    COMPRESSORS_INCLUDE_PARAMS_OF_MAKE_ZSTD_STREAM;
+
+    const REBYTE *dict = nullptr;
+    REBSIZ dict_size = 0;
+    if (REF(dictionary))
+        dict = VAL_BYTES_AT(&dict_size, ARG(dictionary));
+
+    size_t ret;
+    if (REF(decompress)) {
+        if (REF(level))
+            fail (Error_Bad_Refines_Raw());
+
+        struct Reb_Codec_Stream *s = Make_Codec_Stream(
+            D_OUT, CODEC_ZSTD_DECOMPRESS
+        );
+        s->ctx.zstd_d = ZSTD_createDCtx();
+        if (not s->ctx.zstd_d)
+            fail (Error_No_Memory(ZSTD_DStreamInSize()));
+
+        ret = dict ? ZSTD_DCtx_loadDictionary(s->ctx.zstd_d, dict, dict_size) : 0;
+    }
+    else {
+        struct Reb_Codec_Stream *s = Make_Codec_Stream(
+            D_OUT, CODEC_ZSTD_COMPRESS
+        );
+        s->ctx.zstd_c = ZSTD_createCCtx();
+        if (not s->ctx.zstd_c)
+            fail (Error_No_Memory(ZSTD_CStreamInSize()));
+
+        ret = ZSTD_CCtx_setParameter(
+            s->ctx.zstd_c,
+            ZSTD_c_compressionLevel,
+            REF(level) ? VAL_INT32(ARG(level)) : ZSTD_CLEVEL_DEFAULT
+        );
+        if (not ZSTD_isError(ret) and dict)
+            ret = ZSTD_CCtx_loadDictionary(s->ctx.zstd_c, dict, dict_size);
+    }
+
+    if (ZSTD_isError(ret))  // (the handle's cleaner will free the context)
+        fail (Error_Codec(ZSTD_getErrorName(ret)));
+
+    return D_OUT;
+}
+
+
+//
+//  export make-lz4-stream: native [
+//
+//  {Create an LZ4 frame compression (or decompression) stream for CODEC-STEP}
+//
+//      return: "Freed when no longer referenced"
+//          [handle!]
+//      /decompress "Make a decompression stream instead"
+//      /level "0 (default) is fastest, 3 to 12 use the slower LZ4_HC"
+//          [integer!]
+//  ]
+//
+REBNATIVE(make_lz4_stream)
+{
+    COMPRESSORS_INCLUDE_PARAMS_OF_MAKE_LZ4_STREAM;
+
+    LZ4F_errorCode_t ret;
+    if (REF(decompress)) {
+        if (REF(level))
+            fail (Error_Bad_Refines_Raw());
+
+        struct Reb_Codec_Stream *s = Make_Codec_Stream(
+            D_OUT, CODEC_LZ4_DECOMPRESS
+        );
+        ret = LZ4F_createDecompressionContext(&s->ctx.lz4_d, LZ4F_VERSION);
+    }
+    else {
+        struct Reb_Codec_Stream *s = Make_Codec_Stream(
+            D_OUT, CODEC_LZ4_COMPRESS
+        );
+        if (REF(level))
+            s->lz4_prefs.compressionLevel = VAL_INT32(ARG(level));
+        ret = LZ4F_createCompressionContext(&s->ctx.lz4_c, LZ4F_VERSION);
+    }
+
+    if (LZ4F_isError(ret))
+        fail (Error_Codec(LZ4F_getErrorName(ret)));
+
+    return D_OUT;
+}
+
+
+// Make room for `amount` more bytes at the tail of the binary, returning a
+// pointer to write them.  Call TERM_BIN_LEN() with what was actually used.
+//
+static REBYTE *Expand_Output(REBBIN *bin, REBLEN tail, size_t amount)
+{
+    EXPAND_SERIES_TAIL(bin, amount);  // may move the data
+    return BIN_AT(bin, tail);
+}
+
+
+static void Zstd_Compress_Step(
+    REBBIN *bin,
+    struct Reb_Codec_Stream *s,
+    const REBYTE *bp,
+    REBSIZ size,
+    ZSTD_EndDirective mode
+){
+    ZSTD_inBuffer in = {bp, size, 0};
+    while (true) {
+        REBLEN tail = BIN_LEN(bin);
+        ZSTD_outBuffer out;
+        out.dst = Expand_Output(bin, tail, CODEC_CHUNK_SIZE);
+        out.size = CODEC_CHUNK_SIZE;
+        out.pos = 0;
+
+        size_t remaining = ZSTD_compressStream2(s->ctx.zstd_c, &out, &in, mode);
+        TERM_BIN_LEN(bin, tail + out.pos);
+
+        if (ZSTD_isError(remaining))
+            fail (Error_Codec(ZSTD_getErrorName(remaining)));
+
+        if (mode == ZSTD_e_continue) {
+            if (in.pos == in.size)
+                break;
+        }
+        else if (remaining == 0) {  // flush or end completed
+            if (mode == ZSTD_e_end)
+                s->finished = true;
+            break;
+        }
+    }
+}
+
+
+static void Zstd_Decompress_Step(
+    REBBIN *bin,
+    struct Reb_Codec_Stream *s,
+    const REBYTE *bp,
+    REBSIZ size,
+    REBI64 max
+){
+    REBLEN start = BIN_LEN(bin);
+    ZSTD_inBuffer in = {bp, size, 0};
+    while (true) {
+        REBLEN tail = BIN_LEN(bin);
+        ZSTD_outBuffer out;
+        out.dst = Expand_Output(bin, tail, CODEC_CHUNK_SIZE);
+        out.size = CODEC_CHUNK_SIZE;
+        out.pos = 0;
+
+        size_t ret = ZSTD_decompressStream(s->ctx.zstd_d, &out, &in);
+        TERM_BIN_LEN(bin, tail + out.pos);
+
+        if (ZSTD_isError(ret))
+            fail (Error_Codec(ZSTD_getErrorName(ret)));
+
+        if (out.pos != 0 or in.pos != 0)
+            s->finished = (ret == 0);  // 0 means a frame was just completed
+
+        if (max >= 0 and cast(REBI64, BIN_LEN(bin) - start) > max) {
+            DECLARE_LOCAL (temp);
+            Init_Integer(temp, max);
+            fail (Error_Size_Limit_Raw(temp));
+        }
+
+        if (in.pos == in.size and out.pos < out.size)
+            break;  // all input used, and nothing more is pending
+    }
+}
+
+
+static void Lz4_Compress_Step(
+    REBBIN *bin,
+    struct Reb_Codec_Stream *s,
+    const REBYTE *bp,
+    REBSIZ size,
+    bool flush,
+    bool finish
+){
+    size_t ret;
+
+    if (not s->begun) {
+        REBLEN tail = BIN_LEN(bin);
+        REBYTE *dst = Expand_Output(bin, tail, LZ4F_HEADER_SIZE_MAX);
+        ret = LZ4F_compressBegin(
+            s->ctx.lz4_c, dst, LZ4F_HEADER_SIZE_MAX, &s->lz4_prefs
+        );
+        if (LZ4F_isError(ret))
+            fail (Error_Codec(LZ4F_getErrorName(ret)));
+        TERM_BIN_LEN(bin, tail + ret);
+        s->begun = true;
+    }
+
+    // LZ4F_compressUpdate() needs the output to have room for the worst case
+    // of the input it's given, so the input is fed in chunks.
+    //
+    while (size != 0) {
+        size_t piece = size < CODEC_CHUNK_SIZE ? size : CODEC_CHUNK_SIZE;
+        size_t bound = LZ4F_compressBound(piece, &s->lz4_prefs);
+
+        REBLEN tail = BIN_LEN(bin);
+        REBYTE *dst = Expand_Output(bin, tail, bound);
+        ret = LZ4F_compressUpdate(
+            s->ctx.lz4_c, dst, bound, bp, piece, nullptr
+        );
+        if (LZ4F_isError(ret))
+            fail (Error_Codec(LZ4F_getErrorName(ret)));
+        TERM_BIN_LEN(bin, tail + ret);
+
+        bp += piece;
+        size -= piece;
+    }
+
+    if (flush or finish) {
+        size_t bound = LZ4F_compressBound(0, &s->lz4_prefs);
+
+        REBLEN tail = BIN_LEN(bin);
+        REBYTE *dst = Expand_Output(bin, tail, bound);
+        if (finish)
+            ret = LZ4F_compressEnd(s->ctx.lz4_c, dst, bound, nullptr);
+        else
+            ret = LZ4F_flush(s->ctx.lz4_c, dst, bound, nullptr);
+        if (LZ4F_isError(ret))
+            fail (Error_Codec(LZ4F_getErrorName(ret)));
+        TERM_BIN_LEN(bin, tail + ret);
+
+        if (finish)
+            s->finished = true;
+    }
+}
+
+
+static void Lz4_Decompress_Step(
+    REBBIN *bin,
+    struct Reb_Codec_Stream *s,
+    const REBYTE *bp,
+    REBSIZ size,
+    REBI64 max
+){
+    REBLEN start = BIN_LEN(bin);
+    while (true) {
+        REBLEN tail = BIN_LEN(bin);
+        REBYTE *dst = Expand_Output(bin, tail, CODEC_CHUNK_SIZE);
+
+        size_t dst_size = CODEC_CHUNK_SIZE;
+        size_t src_size = size;  // in: available, out: consumed
+        size_t ret = LZ4F_decompress(
+            s->ctx.lz4_d, dst, &dst_size, bp, &src_size, nullptr
+        );
+        TERM_BIN_LEN(bin, tail + dst_size);
+
+        if (LZ4F_isError(ret))
+            fail (Error_Codec(LZ4F_getErrorName(ret)));
+
+        bp += src_size;
+        size -= src_size;
+
+        if (dst_size != 0 or src_size != 0)
+            s->finished = (ret == 0);  // 0 means a frame was just completed
+
+        if (max >= 0 and cast(REBI64, BIN_LEN(bin) - start) > max) {
+            DECLARE_LOCAL (temp);
+            Init_Integer(temp, max);
+            fail (Error_Size_Limit_Raw(temp));
+        }
+
+        if (size == 0 and dst_size < CODEC_CHUNK_SIZE)
+            break;  // all input used, and nothing more is pending
+    }
+}
+
+
+//
+//  export codec-step: native [
+//
+//  {Push data through a Zstandard or LZ4 stream, return any output produced}
+//
+//      return: "Output so far (may be empty if the codec is still buffering)"
+//          [binary!]
+//      stream "From MAKE-ZSTD-STREAM or MAKE-LZ4-STREAM"
+//          [handle!]
+//      data "Next chunk of input, if text it will be UTF-8 encoded"
+//          [<opt> binary! text!]
+//      /flush "Make all output for input so far available (costs ratio)"
+//      /finish "Signal end of input, output the remainder and any trailer"
+//      /into "Append output to this binary instead of making a new one"
+//          [binary!]
+//      /max "Error if decompressing makes more output than this in one step"
+//          [integer!]
+//  ]
+//
+REBNATIVE(codec_step)
+//
+// A decompression stream can read several frames one after another (as the
+// command line tools do), so /FINISH there only checks that the input did
+// not stop in the middle of a frame.
+{
+    COMPRESSORS_INCLUDE_PARAMS_OF_CODEC_STEP;
+
+    if (VAL_HANDLE_CLEANER(ARG(stream)) != &cleanup_codec_stream)
+        fail (PAR(stream));
+
+    struct Reb_Codec_Stream *s = VAL_HANDLE_POINTER(
+        struct Reb_Codec_Stream, ARG(stream)
+    );
+
+    const REBYTE *bp;
+    REBSIZ size;
+    if (IS_NULLED(ARG(data))) {
+        bp = nullptr;
+        size = 0;
+    }
+    else
+        bp = VAL_BYTES_AT(&size, ARG(data));
+
+    REBI64 max = -1;
+    if (REF(max)) {
+        max = VAL_INT64(ARG(max));
+        if (max < 0)
+            fail (PAR(max));
+    }
+
+    bool compressing = (
+        s->kind == CODEC_ZSTD_COMPRESS or s->kind == CODEC_LZ4_COMPRESS
+    );
+    if (compressing and s->finished) {
+        if (size != 0)
+            fail ("CODEC-STEP given data after end of compressed stream");
+        return Init_Binary(D_OUT, Make_Binary(0));
+    }
+
+    REBBIN *bin;
+    if (REF(into)) {
+        FAIL_IF_READ_ONLY(ARG(into));
+        bin = VAL_BINARY(ARG(into));
+    }
+    else
+        bin = Make_Binary(CODEC_CHUNK_SIZE);
+
+    // Nothing is evaluated during a step, so `bp` can point into the data
+    // series without the series moving.
+    //
+    switch (s->kind) {
+      case CODEC_ZSTD_COMPRESS:
+        Zstd_Compress_Step(
+            bin, s, bp, size,
+            REF(finish) ? ZSTD_e_end
+                : REF(flush) ? ZSTD_e_flush
+                : ZSTD_e_continue
+        );
+        break;
+
+      case CODEC_ZSTD_DECOMPRESS:
+        Zstd_Decompress_Step(bin, s, bp, size, max);
+        break;
+
+      case CODEC_LZ4_COMPRESS:
+        Lz4_Compress_Step(bin, s, bp, size, REF(flush), REF(finish));
+        break;
+
+      case CODEC_LZ4_DECOMPRESS:
+        Lz4_Decompress_Step(bin, s, bp, size, max);
+        break;
+    }
+
+    if (REF(finish) and not s->finished)  // decompress hit end of input early
+        fail ("CODEC-STEP /FINISH reached before end of compressed data");
+
+    if (REF(into))
+        RETURN (ARG(into));
+
+    return Init_Binary(D_OUT, bin);
+}
@@ -166,6 +166,246 @@ static const unsigned char Rcon[30]=
 static void AES_encrypt(const AES_CTX *ctx, uint32_t *data);
 static void AES_decrypt(const AES_CTX *ctx, uint32_t *data);
 
+/*
+ * REBOL: Hardware paths.  The table-free code above is small but slow, and
+ * TLS pushes every record through it.  On x86 CPUs with AES-NI the whole
+ * round is a single instruction, so when CPUID reports it (checked once at
+ * runtime) CBC and CTR are done with intrinsics instead.  CBC decryption and
+ * CTR have no dependency between blocks, so four blocks are kept in flight
+ * at once to hide the latency of AESENC/AESDEC.
+ *
+ * The round keys are the same ones AES_set_key() computes, just converted
+ * from big-endian words to byte order.  AES_convert_key()'s "equivalent
+ * inverse cipher" keys are exactly what AESDEC expects, so a decryption
+ * context works unchanged (the rounds are simply taken in reverse).
+ *
+ * Build with REBOL_NO_AES_NI defined to leave out the intrinsics.
+ */
+#if !defined(REBOL_NO_AES_NI) && ( \
+    defined(__x86_64__) || defined(__i386__) \
+    || defined(_M_X64) || defined(_M_IX86) \
+) && ( \
+    defined(_MSC_VER) || defined(__clang__) \
+    || (defined(__GNUC__) && (__GNUC__ > 4 \
+        || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))) \
+)
+    #define AES_HAVE_NI_CODE
+    #include <wmmintrin.h>
+    #include <emmintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define AES_NI_TARGET
+    #else
+        #include <cpuid.h>
+        #define AES_NI_TARGET __attribute__((target("aes,sse2")))
+    #endif
+#endif
+
+/* CTR mode treats the whole 16-byte IV as one big-endian counter */
+static void AES_ctr_increment(uint8_t *counter)
+{
+    int i;
+    for (i = AES_BLOCKSIZE - 1; i >= 0; i--)
+        if (++counter[i] != 0)
+            break;
+}
+
+#ifdef AES_HAVE_NI_CODE
+
+static int aes_ni_checked = 0;
+static int aes_ni_ok = 0;
+
+static int AES_has_ni(void)
+{
+    if (!aes_ni_checked) {
+        unsigned int ecx;
+      #if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 1);
+        ecx = (unsigned int)info[2];
+      #else
+        unsigned int eax, ebx, edx;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+            ecx = 0;
+      #endif
+        aes_ni_ok = (ecx & (1u << 25)) != 0;  /* AESNI */
+        aes_ni_checked = 1;
+    }
+    return aes_ni_ok;
+}
+
+/* Round keys in the order the instructions consume them: as scheduled for
+   encryption, reversed for a context that went through AES_convert_key() */
+AES_NI_TARGET
+static void AES_ni_load_keys(const AES_CTX *ctx, __m128i *rk, int reverse)
+{
+    int r, j;
+    uint8_t b[AES_BLOCKSIZE];
+
+    for (r = 0; r <= ctx->rounds; r++)
+    {
+        const uint32_t *w = ctx->ks + 4 * (reverse ? ctx->rounds - r : r);
+        for (j = 0; j < 4; j++)
+        {
+            b[4*j+0] = (uint8_t)(w[j] >> 24);
+            b[4*j+1] = (uint8_t)(w[j] >> 16);
+            b[4*j+2] = (uint8_t)(w[j] >> 8);
+            b[4*j+3] = (uint8_t)(w[j]);
+        }
+        rk[r] = _mm_loadu_si128((const __m128i*)b);
+    }
+}
+
+AES_NI_TARGET
+static void AES_ni_cbc_encrypt(
+    AES_CTX *ctx, const uint8_t *msg, uint8_t *out, int length
+){
+    __m128i rk[AES_MAXROUNDS + 1];
+    __m128i v;
+    int r, rounds = ctx->rounds;
+
+    AES_ni_load_keys(ctx, rk, 0);
+    v = _mm_loadu_si128((const __m128i*)ctx->iv);
+
+    for (; length >= AES_BLOCKSIZE; length -= AES_BLOCKSIZE)
+    {
+        v = _mm_xor_si128(v, _mm_loadu_si128((const __m128i*)msg));
+        v = _mm_xor_si128(v, rk[0]);
+        for (r = 1; r < rounds; r++)
+            v = _mm_aesenc_si128(v, rk[r]);
+        v = _mm_aesenclast_si128(v, rk[rounds]);
+        _mm_storeu_si128((__m128i*)out, v);
+        msg += AES_BLOCKSIZE;
+        out += AES_BLOCKSIZE;
+    }
+
+    _mm_storeu_si128((__m128i*)ctx->iv, v);
+}
+
+AES_NI_TARGET
+static void AES_ni_cbc_decrypt(
+    AES_CTX *ctx, const uint8_t *msg, uint8_t *out, int length
+){
+    __m128i rk[AES_MAXROUNDS + 1];
+    __m128i prev, c0, c1, c2, c3, b0, b1, b2, b3;
+    int r, rounds = ctx->rounds;
+
+    AES_ni_load_keys(ctx, rk, 1);
+    prev = _mm_loadu_si128((const __m128i*)ctx->iv);
+
+    /* All four ciphertext blocks are loaded before anything is stored, so
+       decrypting in place (msg == out) is fine */
+    for (; length >= 4 * AES_BLOCKSIZE; length -= 4 * AES_BLOCKSIZE)
+    {
+        c0 = _mm_loadu_si128((const __m128i*)msg + 0);
+        c1 = _mm_loadu_si128((const __m128i*)msg + 1);
+        c2 = _mm_loadu_si128((const __m128i*)msg + 2);
+        c3 = _mm_loadu_si128((const __m128i*)msg + 3);
+        b0 = _mm_xor_si128(c0, rk[0]);
+        b1 = _mm_xor_si128(c1, rk[0]);
+        b2 = _mm_xor_si128(c2, rk[0]);
+        b3 = _mm_xor_si128(c3, rk[0]);
+        for (r = 1; r < rounds; r++)
+        {
+            b0 = _mm_aesdec_si128(b0, rk[r]);
+            b1 = _mm_aesdec_si128(b1, rk[r]);
+            b2 = _mm_aesdec_si128(b2, rk[r]);
+            b3 = _mm_aesdec_si128(b3, rk[r]);
+        }
+        b0 = _mm_aesdeclast_si128(b0, rk[rounds]);
+        b1 = _mm_aesdeclast_si128(b1, rk[rounds]);
+        b2 = _mm_aesdeclast_si128(b2, rk[rounds]);
+        b3 = _mm_aesdeclast_si128(b3, rk[rounds]);
+        _mm_storeu_si128((__m128i*)out + 0, _mm_xor_si128(b0, prev));
+        _mm_storeu_si128((__m128i*)out + 1, _mm_xor_si128(b1, c0));
+        _mm_storeu_si128((__m128i*)out + 2, _mm_xor_si128(b2, c1));
+        _mm_storeu_si128((__m128i*)out + 3, _mm_xor_si128(b3, c2));
+        prev = c3;
+        msg += 4 * AES_BLOCKSIZE;
+        out += 4 * AES_BLOCKSIZE;
+    }
+
+    for (; length >= AES_BLOCKSIZE; length -= AES_BLOCKSIZE)
+    {
+        c0 = _mm_loadu_si128((const __m128i*)msg);
+        b0 = _mm_xor_si128(c0, rk[0]);
+        for (r = 1; r < rounds; r++)
+            b0 = _mm_aesdec_si128(b0, rk[r]);
+        b0 = _mm_aesdeclast_si128(b0, rk[rounds]);
+        _mm_storeu_si128((__m128i*)out, _mm_xor_si128(b0, prev));
+        prev = c0;
+        msg += AES_BLOCKSIZE;
+        out += AES_BLOCKSIZE;
+    }
+
+    _mm_storeu_si128((__m128i*)ctx->iv, prev);
+}
+
+/* Whole blocks only; AES_ctr_crypt() deals with any partial tail */
+AES_NI_TARGET
+static void AES_ni_ctr_blocks(
+    AES_CTX *ctx, const uint8_t *msg, uint8_t *out, int length
+){
+    __m128i rk[AES_MAXROUNDS + 1];
+    __m128i b0, b1, b2, b3;
+    int r, rounds = ctx->rounds;
+
+    AES_ni_load_keys(ctx, rk, 0);
+
+    for (; length >= 4 * AES_BLOCKSIZE; length -= 4 * AES_BLOCKSIZE)
+    {
+        b0 = _mm_loadu_si128((const __m128i*)ctx->iv);
+        AES_ctr_increment(ctx->iv);
+        b1 = _mm_loadu_si128((const __m128i*)ctx->iv);
+        AES_ctr_increment(ctx->iv);
+        b2 = _mm_loadu_si128((const __m128i*)ctx->iv);
+        AES_ctr_increment(ctx->iv);
+        b3 = _mm_loadu_si128((const __m128i*)ctx->iv);
+        AES_ctr_increment(ctx->iv);
+        b0 = _mm_xor_si128(b0, rk[0]);
+        b1 = _mm_xor_si128(b1, rk[0]);
+        b2 = _mm_xor_si128(b2, rk[0]);
+        b3 = _mm_xor_si128(b3, rk[0]);
+        for (r = 1; r < rounds; r++)
+        {
+            b0 = _mm_aesenc_si128(b0, rk[r]);
+            b1 = _mm_aesenc_si128(b1, rk[r]);
+            b2 = _mm_aesenc_si128(b2, rk[r]);
+            b3 = _mm_aesenc_si128(b3, rk[r]);
+        }
+        b0 = _mm_aesenclast_si128(b0, rk[rounds]);
+        b1 = _mm_aesenclast_si128(b1, rk[rounds]);
+        b2 = _mm_aesenclast_si128(b2, rk[rounds]);
+        b3 = _mm_aesenclast_si128(b3, rk[rounds]);
+        b0 = _mm_xor_si128(b0, _mm_loadu_si128((const __m128i*)msg + 0));
+        b1 = _mm_xor_si128(b1, _mm_loadu_si128((const __m128i*)msg + 1));
+        b2 = _mm_xor_si128(b2, _mm_loadu_si128((const __m128i*)msg + 2));
+        b3 = _mm_xor_si128(b3, _mm_loadu_si128((const __m128i*)msg + 3));
+        _mm_storeu_si128((__m128i*)out + 0, b0);
+        _mm_storeu_si128((__m128i*)out + 1, b1);
+        _mm_storeu_si128((__m128i*)out + 2, b2);
+        _mm_storeu_si128((__m128i*)out + 3, b3);
+        msg += 4 * AES_BLOCKSIZE;
+        out += 4 * AES_BLOCKSIZE;
+    }
+
+    for (; length >= AES_BLOCKSIZE; length -= AES_BLOCKSIZE)
+    {
+        b0 = _mm_loadu_si128((const __m128i*)ctx->iv);
+        AES_ctr_increment(ctx->iv);
+        b0 = _mm_xor_si128(b0, rk[0]);
+        for (r = 1; r < rounds; r++)
+            b0 = _mm_aesenc_si128(b0, rk[r]);
+        b0 = _mm_aesenclast_si128(b0, rk[rounds]);
+        b0 = _mm_xor_si128(b0, _mm_loadu_si128((const __m128i*)msg));
+        _mm_storeu_si128((__m128i*)out, b0);
+        msg += AES_BLOCKSIZE;
+        out += AES_BLOCKSIZE;
+    }
+}
+
+#endif /* AES_HAVE_NI_CODE */
+
 /* Perform doubling in Galois Field GF(2^8) using the irreducible polynomial
    x^8+x^4+x^3+x+1 */
 static unsigned char AES_xtime(uint32_t x)
@@ -247,6 +487,7 @@ void AES_set_key(AES_CTX *ctx, const uint8_t *key,
 
     /* copy the iv across */
     memcpy(ctx->iv, iv, 16);
+    ctx->ctr_left = 0;
 }
 
 /**
@@ -278,6 +519,14 @@ void AES_cbc_encrypt(AES_CTX *ctx, const uint8_t *msg, uint8_t *out, int length)
     int i;
     uint32_t tin[4], tout[4], iv[4];
 
+#ifdef AES_HAVE_NI_CODE
+    if (AES_has_ni())
+    {
+        AES_ni_cbc_encrypt(ctx, msg, out, length);
+        return;
+    }
+#endif
+
     memcpy(iv, ctx->iv, AES_IV_SIZE);
     for (i = 0; i < 4; i++)
         tout[i] = ntohl(iv[i]);
@@ -318,6 +567,14 @@ void AES_cbc_decrypt(AES_CTX *ctx, const uint8_t *msg, uint8_t *out, int length)
     // !!! was xor[4] but xor is a C++ keyword and C99 extension ISO 646
     uint32_t tin[4], xxor[4], tout[4], data[4], iv[4];
 
+#ifdef AES_HAVE_NI_CODE
+    if (AES_has_ni())
+    {
+        AES_ni_cbc_decrypt(ctx, msg, out, length);
+        return;
+    }
+#endif
+
     memcpy(iv, ctx->iv, AES_IV_SIZE);
     for (i = 0; i < 4; i++)
         xxor[i] = ntohl(iv[i]);
@@ -353,6 +610,78 @@ void AES_cbc_decrypt(AES_CTX *ctx, const uint8_t *msg, uint8_t *out, int length)
     memcpy(ctx->iv, iv, AES_IV_SIZE);
 }
 
+/**
+ * Fill the context's keystream buffer from the counter, then bump it.
+ */
+static void AES_ctr_next_keystream(AES_CTX *ctx)
+{
+    int i;
+    uint32_t data[4];
+
+    for (i = 0; i < 4; i++)
+        data[i] = ((uint32_t)ctx->iv[4*i+0] << 24)
+            | ((uint32_t)ctx->iv[4*i+1] << 16)
+            | ((uint32_t)ctx->iv[4*i+2] << 8)
+            | ((uint32_t)ctx->iv[4*i+3]);
+
+    AES_encrypt(ctx, data);
+
+    for (i = 0; i < 4; i++)
+    {
+        ctx->ctr_stream[4*i+0] = (uint8_t)(data[i] >> 24);
+        ctx->ctr_stream[4*i+1] = (uint8_t)(data[i] >> 16);
+        ctx->ctr_stream[4*i+2] = (uint8_t)(data[i] >> 8);
+        ctx->ctr_stream[4*i+3] = (uint8_t)(data[i]);
+    }
+
+    AES_ctr_increment(ctx->iv);
+    ctx->ctr_left = AES_BLOCKSIZE;
+}
+
+/**
+ * Encrypt or decrypt (the same operation) a byte sequence of any length in
+ * counter mode.  The context must use the encryption key schedule, i.e. it
+ * must not have been through AES_convert_key().  Keystream left over from
+ * a partial block is kept in the context, so a message may be fed through
+ * in pieces of arbitrary size.  msg and out may be the same buffer.
+ */
+void AES_ctr_crypt(AES_CTX *ctx, const uint8_t *msg, uint8_t *out, int length)
+{
+    int whole;
+
+    while (length > 0 && ctx->ctr_left > 0)
+    {
+        *out++ = *msg++ ^ ctx->ctr_stream[AES_BLOCKSIZE - ctx->ctr_left--];
+        length--;
+    }
+
+    whole = length & ~(AES_BLOCKSIZE - 1);
+
+#ifdef AES_HAVE_NI_CODE
+    if (whole > 0 && AES_has_ni())
+    {
+        AES_ni_ctr_blocks(ctx, msg, out, whole);
+        msg += whole;
+        out += whole;
+        length -= whole;
+    }
+#endif
+
+    while (length > 0)
+    {
+        int i, n = length < AES_BLOCKSIZE ? length : AES_BLOCKSIZE;
+
+        AES_ctr_next_keystream(ctx);
+        for (i = 0; i < n; i++)
+            out[i] = msg[i] ^ ctx->ctr_stream[i];
+        ctx->ctr_left -= n;
+
+        msg += n;
+        out += n;
+        length -= n;
+    }
+}
+
 /**
  * Encrypt a single block (16 bytes) of data
  */
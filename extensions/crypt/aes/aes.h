@@ -43,7 +43,8 @@ typedef enum
     AES_MODE_128,
     AES_MODE_256,
     AES_MODE_ENCRYPT,
-    AES_MODE_DECRYPT
+    AES_MODE_DECRYPT,
+    AES_MODE_CTR
 } AES_MODE;
 
 typedef struct aes_key_st
@@ -53,6 +54,8 @@ typedef struct aes_key_st
     uint32_t ks[(AES_MAXROUNDS+1)*8];
     uint8_t iv[AES_IV_SIZE];
     AES_MODE key_mode;
+    uint8_t ctr_stream[AES_BLOCKSIZE]; /* CTR keystream not yet used... */
+    int ctr_left; /* ...and how many bytes of it remain */
 } AES_CTX;
 
 void AES_set_key(AES_CTX *ctx, const uint8_t *key,
@@ -61,3 +64,4 @@ void AES_cbc_encrypt(AES_CTX *ctx, const uint8_t *msg,
         uint8_t *out, int length);
 void AES_cbc_decrypt(AES_CTX *ks, const uint8_t *in, uint8_t *out, int length);
 void AES_convert_key(AES_CTX *ctx);
+void AES_ctr_crypt(AES_CTX *ctx, const uint8_t *msg, uint8_t *out, int length);
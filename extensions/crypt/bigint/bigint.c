@@ -78,6 +78,8 @@
 static bigint *bi_int_multiply(BI_CTX *ctx, bigint *bi, comp i);
 static bigint *bi_int_divide(BI_CTX *ctx, bigint *biR, comp denom);
 static bigint *alloc(BI_CTX *ctx, int size);
+static comp mont_inverse(comp m0);
+static bigint *mont_mod_power(BI_CTX *ctx, bigint *bi, bigint *biexp);
 static bigint *trim(bigint *bi);
 static void more_comps(bigint *bi, int n);
 #if defined(CONFIG_BIGINT_KARATSUBA) || defined(CONFIG_BIGINT_BARRETT) || \
@@ -762,6 +764,22 @@ void bi_set_mod(BI_CTX *ctx, bigint *bim, int mod_offset)
     ctx->bi_normalised_mod[mod_offset] = bi_int_multiply(ctx, bim, d);
     bi_permanent(ctx->bi_normalised_mod[mod_offset]);
 
+    /* REBOL: constants for mont_mod_power(), which needs an odd modulus */
+    if (bim->comps[0] & 1)
+    {
+        uint8_t saved_offset = ctx->mod_offset;
+        bigint *R2 = alloc(ctx, k*2+1);                         /* R^2 */
+        memset(R2->comps, 0, k*2*COMP_BYTE_SIZE);
+        R2->comps[k*2] = 1;
+        ctx->mod_offset = mod_offset;
+        ctx->bi_mont_rr[mod_offset] = bi_mod(ctx, R2);
+        ctx->mod_offset = saved_offset;
+        bi_permanent(ctx->bi_mont_rr[mod_offset]);
+        ctx->mont_n0[mod_offset] = mont_inverse(bim->comps[0]);
+    }
+    else
+        ctx->bi_mont_rr[mod_offset] = NULL;
+
 #if defined(CONFIG_BIGINT_MONTGOMERY)
     /* set montgomery variables */
     R = comp_left_shift(bi_clone(ctx, ctx->bi_radix), k-1);     /* R */
@@ -792,6 +810,12 @@ void bi_free_mod(BI_CTX *ctx, int mod_offset)
 {
     bi_depermanent(ctx->bi_mod[mod_offset]);
     bi_free(ctx, ctx->bi_mod[mod_offset]);
+    if (ctx->bi_mont_rr[mod_offset])
+    {
+        bi_depermanent(ctx->bi_mont_rr[mod_offset]);
+        bi_free(ctx, ctx->bi_mont_rr[mod_offset]);
+        ctx->bi_mont_rr[mod_offset] = NULL;
+    }
 #if defined (CONFIG_BIGINT_MONTGOMERY)
     bi_depermanent(ctx->bi_RR_mod_m[mod_offset]);
     bi_depermanent(ctx->bi_R_mod_m[mod_offset]);
@@ -1335,6 +1359,344 @@ static void precompute_slide_window(BI_CTX *ctx, int window, bigint *g1)
 }
 #endif
 
+/*
+ * REBOL: Montgomery exponentiation on plain component arrays.
+ *
+ * The generic bi_mod_power() below allocates a bigint for every square and
+ * multiply and reduces each product separately, which made 4096-bit RSA and
+ * DH painfully slow.  For the usual case of an odd modulus, this does the
+ * whole exponentiation in Montgomery form, in a few buffers allocated once:
+ *
+ * - Below MONT_KARATSUBA_THRESH components, multiplication and reduction are
+ *   interleaved word by word (CIOS), which never needs a double-size product.
+ *
+ * - At or above it, the product is formed with Karatsuba and then reduced
+ *   (SOS), as the saved multiplies outweigh the extra passes.
+ *
+ * - The exponent is consumed in fixed windows of MONT_WINDOW bits from a
+ *   table of precomputed powers.  Every window costs the same squarings and
+ *   one multiply (even when its bits are zero), so the time taken doesn't
+ *   depend on the bit pattern of the private exponent.  Short exponents (the
+ *   public ones, like 65537) use plain square-and-multiply instead.
+ */
+
+#define MONT_KARATSUBA_THRESH   96      /**< components, found by timing */
+#define KARATSUBA_BASE          32      /**< recursion stops below this */
+
+/*
+ * -1/m0 mod the radix, by Newton iteration (each step doubles the number of
+ * correct low bits, and m0 itself is correct to three of them).
+ */
+static comp mont_inverse(comp m0)
+{
+    comp x = m0;
+    int i;
+
+    for (i = 0; i < 5; i++)
+        x = (comp)((long_comp)x * (comp)(2 - (long_comp)m0 * x));
+
+    return (comp)(0 - x);
+}
+
+/* r = r - m over n components, returning the borrow */
+static comp comps_sub(comp *r, const comp *m, int n)
+{
+    comp borrow = 0;
+    int i;
+
+    for (i = 0; i < n; i++)
+    {
+        long_comp d = (long_comp)r[i] - m[i] - borrow;
+        r[i] = (comp)d;
+        borrow = (comp)((d >> COMP_BIT_SIZE) & 1);
+    }
+
+    return borrow;
+}
+
+/* Is the n component number a >= m? */
+static int comps_ge(const comp *a, const comp *m, int n)
+{
+    while (--n >= 0)
+    {
+        if (a[n] != m[n])
+            return a[n] > m[n];
+    }
+
+    return 1;
+}
+
+/* r[0..2n) = a[0..n) * b[0..n), r not overlapping a or b */
+static void comps_mul_school(comp *r, const comp *a, const comp *b, int n)
+{
+    int i, j;
+
+    memset(r, 0, 2*n*COMP_BYTE_SIZE);
+
+    for (i = 0; i < n; i++)
+    {
+        long_comp carry = 0;
+        comp ai = a[i];
+
+        for (j = 0; j < n; j++)
+        {
+            long_comp t = (long_comp)ai*b[j] + r[i+j] + carry;
+            r[i+j] = (comp)t;
+            carry = t >> COMP_BIT_SIZE;
+        }
+
+        r[i+n] = (comp)carry;
+    }
+}
+
+/* |x - y| over n components into r, returning 1 if x < y */
+static int comps_abs_diff(comp *r, const comp *x, const comp *y, int n)
+{
+    if (comps_ge(x, y, n))
+    {
+        memcpy(r, x, n*COMP_BYTE_SIZE);
+        comps_sub(r, y, n);
+        return 0;
+    }
+
+    memcpy(r, y, n*COMP_BYTE_SIZE);
+    comps_sub(r, x, n);
+    return 1;
+}
+
+/*
+ * r[0..2n) = a * b by (subtractive) Karatsuba.  scratch must have 6n
+ * components.  Uses a0*b1 + a1*b0 = a0*b0 + a1*b1 + (a0-a1)*(b1-b0), which
+ * keeps the half-size multiplies at exactly n/2 components.
+ */
+static void comps_mul_karatsuba(comp *r, const comp *a, const comp *b, int n,
+        comp *scratch)
+{
+    int h = n/2, i, neg;
+    comp *da = scratch, *db = scratch + h;
+    comp *mid = scratch + n, *sum = scratch + 2*n, *more = scratch + 3*n;
+    long_comp c, top;
+
+    if (n < KARATSUBA_BASE || (n & 1))
+    {
+        comps_mul_school(r, a, b, n);
+        return;
+    }
+
+    comps_mul_karatsuba(r, a, b, h, more);                  /* a0*b0 */
+    comps_mul_karatsuba(r + n, a + h, b + h, h, more);      /* a1*b1 */
+
+    neg = comps_abs_diff(da, a, a + h, h);
+    neg ^= comps_abs_diff(db, b + h, b, h);
+    comps_mul_karatsuba(mid, da, db, h, more);
+
+    /* sum = a0*b0 + a1*b1 +/- mid, as n components plus top */
+    c = 0;
+    for (i = 0; i < n; i++)
+    {
+        c += (long_comp)r[i] + r[n+i];
+        sum[i] = (comp)c;
+        c >>= COMP_BIT_SIZE;
+    }
+    top = c;
+
+    if (neg)
+        top -= comps_sub(sum, mid, n);  /* can't go negative overall */
+    else
+    {
+        c = 0;
+        for (i = 0; i < n; i++)
+        {
+            c += (long_comp)sum[i] + mid[i];
+            sum[i] = (comp)c;
+            c >>= COMP_BIT_SIZE;
+        }
+        top += c;
+    }
+
+    /* add the middle term in, h components up */
+    c = 0;
+    for (i = 0; i < n; i++)
+    {
+        c += (long_comp)r[h+i] + sum[i];
+        r[h+i] = (comp)c;
+        c >>= COMP_BIT_SIZE;
+    }
+    c += top;
+    for (i = n + h; c != 0 && i < 2*n; i++)
+    {
+        c += r[i];
+        r[i] = (comp)c;
+        c >>= COMP_BIT_SIZE;
+    }
+}
+
+/*
+ * r = a * b / R mod m, for a, b < m (r may be a or b).  t is scratch space
+ * of at least 8n+2 components.
+ */
+static void mont_mul(comp *r, const comp *a, const comp *b,
+        const comp *m, int n, comp n0, comp *t)
+{
+    int i, j;
+    comp *res;
+
+    if (n >= MONT_KARATSUBA_THRESH && !(n & 1))
+    {
+        /* SOS: full product by Karatsuba, then n reduction passes */
+        comps_mul_karatsuba(t, a, b, n, t + 2*n + 1);
+        t[2*n] = 0;
+
+        for (i = 0; i < n; i++)
+        {
+            comp u = (comp)(t[i] * n0);
+            long_comp carry = 0;
+
+            for (j = 0; j < n; j++)
+            {
+                long_comp s = (long_comp)u*m[j] + t[i+j] + carry;
+                t[i+j] = (comp)s;
+                carry = s >> COMP_BIT_SIZE;
+            }
+
+            for (j = i + n; carry != 0 && j <= 2*n; j++)
+            {
+                carry += t[j];
+                t[j] = (comp)carry;
+                carry >>= COMP_BIT_SIZE;
+            }
+        }
+
+        res = t + n;    /* n components plus a possible carry in t[2n] */
+    }
+    else
+    {
+        /* CIOS: multiply one word of a, then reduce one word, repeat */
+        memset(t, 0, (n+2)*COMP_BYTE_SIZE);
+
+        for (i = 0; i < n; i++)
+        {
+            long_comp s, carry = 0;
+            comp u, ai = a[i];
+
+            for (j = 0; j < n; j++)
+            {
+                s = (long_comp)ai*b[j] + t[j] + carry;
+                t[j] = (comp)s;
+                carry = s >> COMP_BIT_SIZE;
+            }
+            s = (long_comp)t[n] + carry;
+            t[n] = (comp)s;
+            t[n+1] = (comp)(s >> COMP_BIT_SIZE);
+
+            u = (comp)(t[0] * n0);
+            s = (long_comp)u*m[0] + t[0];
+            carry = s >> COMP_BIT_SIZE;
+            for (j = 1; j < n; j++)
+            {
+                s = (long_comp)u*m[j] + t[j] + carry;
+                t[j-1] = (comp)s;
+                carry = s >> COMP_BIT_SIZE;
+            }
+            s = (long_comp)t[n] + carry;
+            t[n-1] = (comp)s;
+            t[n] = t[n+1] + (comp)(s >> COMP_BIT_SIZE);
+        }
+
+        res = t;        /* n components plus a possible carry in t[n] */
+    }
+
+    /* the result is < 2m, so at most one subtraction brings it below m */
+    if (res[n] != 0 || comps_ge(res, m, n))
+        comps_sub(res, m, n);
+
+    memcpy(r, res, n*COMP_BYTE_SIZE);
+}
+
+/* Value of the w exponent bits starting at bit lo (bits past top are 0) */
+static int exp_window(bigint *biexp, int lo, int w, int top)
+{
+    int v = 0, j;
+
+    for (j = lo + w - 1; j >= lo; j--)
+    {
+        v <<= 1;
+        if (j <= top && exp_bit_is_one(biexp, j))
+            v |= 1;
+    }
+
+    return v;
+}
+
+#define MONT_WINDOW     5       /**< bits per window for long exponents */
+
+static bigint *mont_mod_power(BI_CTX *ctx, bigint *bi, bigint *biexp)
+{
+    uint8_t mod_offset = ctx->mod_offset;
+    bigint *bim = ctx->bi_mod[mod_offset];
+    bigint *birr = ctx->bi_mont_rr[mod_offset];
+    comp n0 = ctx->mont_n0[mod_offset];
+    int n = bim->size;
+    int top = find_max_exp_index(biexp);
+    int w = (top < 32) ? 1 : (top < 256) ? 4 : MONT_WINDOW;
+    int entries = 1 << w;
+    comp *mem, *table, *acc, *x, *one, *t;
+    bigint *biR;
+    int i, lo;
+
+    if (bi_compare(bi, bim) >= 0)   /* Montgomery form needs base < m */
+    {
+        bigint *tmp = bi_clone(ctx, bi);    /* bi_divide() may work in place */
+        bi_free(ctx, bi);
+        bi = bi_mod(ctx, tmp);
+    }
+
+    mem = (comp *)calloc((entries + 3)*n + 8*n + 2, COMP_BYTE_SIZE);
+    table = mem;
+    acc = table + entries*n;
+    x = acc + n;
+    one = x + n;
+    t = one + n;
+
+    memcpy(x, bi->comps, bi->size*COMP_BYTE_SIZE);      /* zero padded */
+    one[0] = 1;
+
+    memcpy(acc, birr->comps, birr->size*COMP_BYTE_SIZE);
+    mont_mul(&table[0], acc, one, bim->comps, n, n0, t);        /* R mod m */
+    mont_mul(&table[n], x, acc, bim->comps, n, n0, t);          /* x*R */
+    for (i = 2; i < entries; i++)
+        mont_mul(&table[i*n], &table[(i-1)*n], &table[n],
+                bim->comps, n, n0, t);
+
+    memcpy(acc, &table[0], n*COMP_BYTE_SIZE);   /* 1, in Montgomery form */
+
+    if (top >= 0)
+    {
+        for (lo = (top / w) * w; lo >= 0; lo -= w)
+        {
+            int v = exp_window(biexp, lo, w, top);
+
+            for (i = 0; i < w; i++)
+                mont_mul(acc, acc, acc, bim->comps, n, n0, t);
+
+            if (v != 0 || w != 1)   /* public exponents may skip zeros */
+                mont_mul(acc, acc, &table[v*n], bim->comps, n, n0, t);
+        }
+    }
+
+    mont_mul(acc, acc, one, bim->comps, n, n0, t);  /* out of Montgomery */
+
+    biR = alloc(ctx, n);
+    memcpy(biR->comps, acc, n*COMP_BYTE_SIZE);
+    trim(biR);
+
+    memset(mem, 0, ((entries + 3)*n + 8*n + 2)*COMP_BYTE_SIZE);
+    free(mem);
+    bi_free(ctx, bi);
+    bi_free(ctx, biexp);
+    return biR;
+}
+
 /**
  * @brief Perform a modular exponentiation.
  *
@@ -1348,8 +1710,14 @@ static void precompute_slide_window(BI_CTX *ctx, int window, bigint *g1)
  */
 bigint *bi_mod_power(BI_CTX *ctx, bigint *bi, bigint *biexp)
 {
-    int i = find_max_exp_index(biexp), j, window_size = 1;
-    bigint *biR = int_to_bi(ctx, 1);
+    int i, j, window_size = 1;
+    bigint *biR;
+
+    if (ctx->bi_mont_rr[ctx->mod_offset] != NULL)   /* odd modulus */
+        return mont_mod_power(ctx, bi, biexp);
+
+    i = find_max_exp_index(biexp);
+    biR = int_to_bi(ctx, 1);
 
 #if defined(CONFIG_BIGINT_MONTGOMERY)
     uint8_t mod_offset = ctx->mod_offset;
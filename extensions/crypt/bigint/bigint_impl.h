@@ -123,6 +123,8 @@ typedef struct /**< A big integer "session" context. */
     bigint *bi_mu[BIGINT_NUM_MODS];         /**< Storage for mu */
 #endif
     bigint *bi_normalised_mod[BIGINT_NUM_MODS]; /**< Normalised mod storage. */
+    bigint *bi_mont_rr[BIGINT_NUM_MODS];    /**< R^2 mod m (odd m only). */
+    comp mont_n0[BIGINT_NUM_MODS];          /**< -1/m mod the radix. */
     bigint **g;                 /**< Used by sliding-window. */
     int window;                 /**< The size of the sliding window */
     int active_count;           /**< Number of active bigints. */
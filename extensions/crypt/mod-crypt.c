@@ -73,6 +73,31 @@
 #include "sha1/u-sha1.h"  // exposed via CHECKSUM
 
 
+// Adapters so the SHA256 code (also used by the SHA256 native) fits the
+// signatures of the digest table below.
+
+static REBYTE *SHA256_Digest(const REBYTE *data, REBLEN len, REBYTE *md)
+{
+    SHA256_CTX ctx;
+    sha256_init(&ctx);
+    sha256_update(&ctx, data, len);
+    sha256_final(&ctx, md);
+    return md;
+}
+
+static void SHA256_Init(void *ctx)
+  { sha256_init(cast(SHA256_CTX*, ctx)); }
+
+static void SHA256_Update(void *ctx, const REBYTE *data, REBLEN len)
+  { sha256_update(cast(SHA256_CTX*, ctx), data, len); }
+
+static void SHA256_Final(REBYTE *md, void *ctx)
+  { sha256_final(cast(SHA256_CTX*, ctx), md); }
+
+static int SHA256_CtxSize(void)
+  { return sizeof(SHA256_CTX); }
+
+
 // Table of has functions and parameters:
 static struct {
     REBYTE *(*digest)(const REBYTE *, REBLEN, REBYTE *);
@@ -87,36 +112,144 @@ static struct {
 
     {SHA1, SHA1_Init, SHA1_Update, SHA1_Final, SHA1_CtxSize, SYM_SHA1, 20, 64},
     {MD5, MD5_Init, MD5_Update, MD5_Final, MD5_CtxSize, SYM_MD5, 16, 64},
+    {
+        SHA256_Digest, SHA256_Init, SHA256_Update, SHA256_Final,
+        SHA256_CtxSize, SYM_SHA256, 32, 64
+    },
 
     {NULL, NULL, NULL, NULL, NULL, SYM_0, 0, 0}
 
 };
 
+//
+//  Checksum_Batch: C
+//
+// Digest each BINARY! in a block, giving a block of the results.  For the
+// many-small-messages case this saves the per-call overhead of CHECKSUM,
+// and SHA256 gets to hash several messages at once in SIMD lanes.
+//
+static REBVAL *Checksum_Batch(REBVAL *out, const REBVAL *block, REBLEN i)
+{
+    REBLEN count = VAL_LEN_AT(block);
+    const RELVAL *head = VAL_ARRAY_AT(block);
+    REBLEN len = digests[i].len;
+
+    REBLEN n;
+    for (n = 0; n < count; ++n) {
+        if (not IS_BINARY(head + n))
+            fail (Error_Bad_Value_Core(head + n, VAL_SPECIFIER(block)));
+    }
+
+    REBYTE *hashes = rebAllocN(REBYTE, count * len + 1);  // +1 if count = 0
+
+    if (digests[i].sym == SYM_SHA256) {
+        const uint8_t **ptrs = rebAllocN(const uint8_t*, count + 1);
+        size_t *sizes = rebAllocN(size_t, count + 1);
+        for (n = 0; n < count; ++n) {
+            ptrs[n] = VAL_BIN_AT(head + n);
+            sizes[n] = VAL_LEN_AT(head + n);
+        }
+        sha256_batch(ptrs, sizes, count, hashes);
+        rebFree(sizes);
+        rebFree(m_cast(uint8_t**, ptrs));
+    }
+    else {
+        for (n = 0; n < count; ++n)
+            digests[i].digest(
+                VAL_BIN_AT(head + n), VAL_LEN_AT(head + n), hashes + n * len
+            );
+    }
+
+    REBDSP dsp_orig = DSP;
+    for (n = 0; n < count; ++n)
+        Init_Binary(DS_PUSH(), Copy_Bytes(hashes + n * len, len));
+
+    rebFree(hashes);
+    return Init_Block(out, Pop_Stack_Values(dsp_orig));
+}
+
+
+//
+//  Hmac_Digest: C
+//
+// HMAC of two pieces of data as if they were one, so that a TLS record MAC
+// (a header followed by the content) needs no joined copy of the two.  OUT
+// must have room for digests[i].len bytes, and may be the same as DATA1.
+//
+static void Hmac_Digest(
+    REBYTE *out,
+    REBLEN i,
+    const REBYTE *key_bytes,
+    REBSIZ key_size,
+    const REBYTE *data1,
+    REBLEN len1,
+    const REBYTE *data2,
+    REBLEN len2
+){
+    REBLEN blocklen = digests[i].hmacblock;
+
+    REBYTE tmpdigest[32]; // size must be max of all digest[].len
+
+    if (key_size > blocklen) {
+        digests[i].digest(key_bytes, key_size, tmpdigest);
+        key_bytes = tmpdigest;
+        key_size = digests[i].len;
+    }
+
+    REBYTE ipad[64]; // size must be max of all digest[].hmacblock
+    memset(ipad, 0, blocklen);
+    memcpy(ipad, key_bytes, key_size);
+
+    REBYTE opad[64]; // size must be max of all digest[].hmacblock
+    memset(opad, 0, blocklen);
+    memcpy(opad, key_bytes, key_size);
+
+    REBLEN j;
+    for (j = 0; j < blocklen; j++) {
+        ipad[j] ^= 0x36; // !!! why do people write this kind of
+        opad[j] ^= 0x5c; // thing without a comment? !!! :-(
+    }
+
+    char *ctx = ALLOC_N(char, digests[i].ctxsize());
+    digests[i].init(ctx);
+    digests[i].update(ctx, ipad, blocklen);
+    digests[i].update(ctx, data1, len1);
+    if (len2 != 0)
+        digests[i].update(ctx, data2, len2);
+    digests[i].final(tmpdigest, ctx);
+    digests[i].init(ctx);
+    digests[i].update(ctx, opad, blocklen);
+    digests[i].update(ctx, tmpdigest, digests[i].len);
+    digests[i].final(out, ctx);
+
+    FREE_N(char, digests[i].ctxsize(), ctx);
+}
+
+
 //
 //  export checksum: native [
 //
 //  "Computes a checksum, CRC, or hash."
 //
-//      data [binary!]
+//      data "BINARY! to checksum, or BLOCK! of BINARY! with /BATCH"
+//          [binary! block!]
 //      /part "Length of data"
 //          [any-value!]
 //      /tcp "Returns an Internet TCP 16-bit checksum"
 //      /secure "Returns a cryptographically secure checksum"
 //      /hash "Returns a hash value with given size"
 //          [integer!]
-//      /method "Method to use (SHA1, MD5, CRC32)"
+//      /method "Method to use (SHA1, SHA256, MD5, CRC32)"
 //          [word!]
 //      /key "Returns keyed HMAC value"
 //          [binary! text!]
+//      /batch "Digest each BINARY! in a BLOCK!, returning a BLOCK! of them"
 //  ]
 //
 REBNATIVE(checksum)
 {
     CRYPT_INCLUDE_PARAMS_OF_CHECKSUM;
 
-    REBLEN len = Part_Len_May_Modify_Index(ARG(data), ARG(part));
-    REBYTE *data = VAL_RAW_DATA_AT(ARG(data));  // after Part_Len, may change
-
     REBSYM sym;
     if (REF(method)) {
         sym = VAL_WORD_SYM(ARG(method));
@@ -126,6 +259,26 @@ REBNATIVE(checksum)
     else
         sym = SYM_SHA1;
 
+    if (REF(batch)) {
+        if (not IS_BLOCK(ARG(data)))
+            fail (PAR(data));
+        if (REF(part) or REF(tcp) or REF(hash) or REF(key))
+            fail (Error_Bad_Refines_Raw());
+
+        REBLEN i;
+        for (i = 0; digests[i].sym != SYM_0; i++) {
+            if (SAME_SYM_NONZERO(digests[i].sym, sym))
+                return Checksum_Batch(D_OUT, ARG(data), i);
+        }
+        fail (PAR(method));  // CRC32 and ADLER32 aren't digests
+    }
+
+    if (not IS_BINARY(ARG(data)))
+        fail (PAR(data));  // BLOCK! is only for /BATCH
+
+    REBLEN len = Part_Len_May_Modify_Index(ARG(data), ARG(part));
+    REBYTE *data = VAL_RAW_DATA_AT(ARG(data));  // after Part_Len, may change
+
     // If method, secure, or key... find matching digest:
     if (REF(method) || REF(secure) || REF(key)) {
         if (sym == SYM_CRC32) {
@@ -163,44 +316,13 @@ REBNATIVE(checksum)
             if (not REF(key))
                 digests[i].digest(data, len, BIN_HEAD(digest));
             else {
-                REBLEN blocklen = digests[i].hmacblock;
-
-                REBYTE tmpdigest[20]; // size must be max of all digest[].len
-
                 REBSIZ key_size;
                 const REBYTE *key_bytes = VAL_BYTES_AT(&key_size, ARG(key));
 
-                if (key_size > blocklen) {
-                    digests[i].digest(key_bytes, key_size, tmpdigest);
-                    key_bytes = tmpdigest;
-                    key_size = digests[i].len;
-                }
-
-                REBYTE ipad[64]; // size must be max of all digest[].hmacblock
-                memset(ipad, 0, blocklen);
-                memcpy(ipad, key_bytes, key_size);
-
-                REBYTE opad[64]; // size must be max of all digest[].hmacblock
-                memset(opad, 0, blocklen);
-                memcpy(opad, key_bytes, key_size);
-
-                REBLEN j;
-                for (j = 0; j < blocklen; j++) {
-                    ipad[j] ^= 0x36; // !!! why do people write this kind of
-                    opad[j] ^= 0x5c; // thing without a comment? !!! :-(
-                }
-
-                char *ctx = ALLOC_N(char, digests[i].ctxsize());
-                digests[i].init(ctx);
-                digests[i].update(ctx,ipad,blocklen);
-                digests[i].update(ctx, data, len);
-                digests[i].final(tmpdigest,ctx);
-                digests[i].init(ctx);
-                digests[i].update(ctx,opad,blocklen);
-                digests[i].update(ctx,tmpdigest,digests[i].len);
-                digests[i].final(BIN_HEAD(digest),ctx);
-
-                FREE_N(char, digests[i].ctxsize(), ctx);
+                Hmac_Digest(
+                    BIN_HEAD(digest), i, key_bytes, key_size,
+                    data, len, nullptr, 0
+                );
             }
 
             TERM_BIN_LEN(digest, digests[i].len);
@@ -343,11 +465,24 @@ REBNATIVE(rsa)
         if (not d)
             fail ("No d returned BLANK, can we assume error for cleanup?");
 
-        REBVAL *p = rebValue("ensure binary! pick", obj, "'p", rebEND);
-        REBVAL *q = rebValue("ensure binary! pick", obj, "'q", rebEND);
-        REBVAL *dp = rebValue("ensure binary! pick", obj, "'dp", rebEND);
-        REBVAL *dq = rebValue("ensure binary! pick", obj, "'dq", rebEND);
-        REBVAL *qinv = rebValue("ensure binary! pick", obj, "'qinv", rebEND);
+        // The CRT values are optional; without them the private exponent is
+        // used directly, which is slower (see RSA_private())
+        //
+        REBVAL *p = rebValue(
+            "opt ensure [blank! binary!] pick", obj, "'p", rebEND
+        );
+        REBVAL *q = rebValue(
+            "opt ensure [blank! binary!] pick", obj, "'q", rebEND
+        );
+        REBVAL *dp = rebValue(
+            "opt ensure [blank! binary!] pick", obj, "'dp", rebEND
+        );
+        REBVAL *dq = rebValue(
+            "opt ensure [blank! binary!] pick", obj, "'dq", rebEND
+        );
+        REBVAL *qinv = rebValue(
+            "opt ensure [blank! binary!] pick", obj, "'qinv", rebEND
+        );
 
         // !!! Because BINARY! is not locked in memory or safe from GC, the
         // libRebol API doesn't allow direct pointer access.  Use the
@@ -377,7 +512,7 @@ REBNATIVE(rsa)
             , dp ? rebUnbox("length of", dp, rebEND) : 0
             ,
             dq ? VAL_BIN_AT(dq) : NULL
-            , dp ? rebUnbox("length of", dq, rebEND) : 0
+            , dq ? rebUnbox("length of", dq, rebEND) : 0
             ,
             qinv ? VAL_BIN_AT(qinv) : NULL
             , qinv ? rebUnbox("length of", qinv, rebEND) : 0
@@ -546,7 +681,9 @@ REBNATIVE(dh_compute_key)
     // !!! used to ensure object only had other fields SELF, PUB-KEY, G
     // otherwise gave Error(RE_EXT_CRYPT_INVALID_KEY_FIELD)
 
-    REBVAL *p = rebValue("ensure binary! pick", obj, "'p", rebEND);
+    REBVAL *p = rebValue(
+            "opt ensure [blank! binary!] pick", obj, "'p", rebEND
+        );
     REBVAL *priv_key = rebValue("ensure binary! pick", obj, "'private", rebEND);
 
     dh_ctx.p = VAL_BIN_AT(p);
@@ -588,12 +725,16 @@ static void cleanup_aes_ctx(const REBVAL *v)
 //      iv "Optional initialization vector"
 //          [binary! blank!]
 //      /decrypt "Make cipher context for decryption (default is to encrypt)"
+//      /ctr "Counter mode: IV is the initial counter, no padding is added"
 //  ]
 //
 REBNATIVE(aes_key)
 {
     CRYPT_INCLUDE_PARAMS_OF_AES_KEY;
 
+    if (REF(decrypt) and REF(ctr))  // CTR decryption is the same operation
+        fail (Error_Bad_Refines_Raw());
+
     uint8_t iv[AES_IV_SIZE];
 
     if (IS_BINARY(ARG(iv))) {
@@ -627,6 +768,8 @@ REBNATIVE(aes_key)
 
     if (REF(decrypt))
         AES_convert_key(aes_ctx);
+    else if (REF(ctr))
+        aes_ctx->key_mode = AES_MODE_CTR;
 
     return Init_Handle_Cdata_Managed(
         D_OUT,
@@ -647,9 +790,15 @@ REBNATIVE(aes_key)
 //      ctx "Stream cipher context"
 //          [handle!]
 //      data [binary!]
+//      /in-place "Overwrite DATA with the result instead of making a copy"
 //  ]
 //
 REBNATIVE(aes_stream)
+//
+// CBC mode zero-pads the data out to a multiple of the block size.  With
+// /IN-PLACE that padding is appended to DATA itself, so its series grows.
+// CTR mode output is always the same length as the input, and the context
+// carries leftover keystream so the data can come in pieces of any size.
 {
     CRYPT_INCLUDE_PARAMS_OF_AES_STREAM;
 
@@ -660,49 +809,476 @@ REBNATIVE(aes_stream)
 
     AES_CTX *aes_ctx = VAL_HANDLE_POINTER(AES_CTX, ARG(ctx));
 
-    REBYTE *dataBuffer = VAL_BIN_AT(ARG(data));
     REBINT len = VAL_LEN_AT(ARG(data));
 
     if (len == 0)
         return nullptr; // !!! Is NULL a good result for 0 data?
 
-    REBINT pad_len = (((len - 1) >> 4) << 4) + AES_BLOCKSIZE;
+    REBINT pad_len;
+    if (aes_ctx->key_mode == AES_MODE_CTR)
+        pad_len = len;
+    else
+        pad_len = (((len - 1) >> 4) << 4) + AES_BLOCKSIZE;
+
+    REBYTE *buffer;
+    if (REF(in_place)) {
+        FAIL_IF_READ_ONLY(ARG(data));
+
+        if (len < pad_len) {  // DATA always runs to the tail, so pad there
+            REBSER *bin = VAL_SERIES(ARG(data));
+            REBLEN tail = BIN_LEN(bin);
+            EXPAND_SERIES_TAIL(bin, pad_len - len);  // may move the data
+            memset(BIN_AT(bin, tail), 0, pad_len - len);
+            TERM_BIN_LEN(bin, tail + pad_len - len);
+        }
+        buffer = VAL_BIN_AT(ARG(data));
+    }
+    else {
+        buffer = rebAllocN(REBYTE, pad_len);
+        memcpy(buffer, VAL_BIN_AT(ARG(data)), len);
+        memset(buffer + len, 0, pad_len - len);
+    }
+
+    // All the modes can work with the input and output buffer the same
+    //
+    if (aes_ctx->key_mode == AES_MODE_CTR)
+        AES_ctr_crypt(aes_ctx, buffer, buffer, pad_len);
+    else if (aes_ctx->key_mode == AES_MODE_DECRYPT)
+        AES_cbc_decrypt(aes_ctx, buffer, buffer, pad_len);
+    else
+        AES_cbc_encrypt(aes_ctx, buffer, buffer, pad_len);
 
-    REBYTE *pad_data;
-    if (len < pad_len) {
-        //
-        //  make new data input with zero-padding
-        //
-        pad_data = rebAllocN(REBYTE, pad_len);
-        memset(pad_data, 0, pad_len);
-        memcpy(pad_data, dataBuffer, len);
-        dataBuffer = pad_data;
+    if (REF(in_place))
+        RETURN (ARG(data));
+
+    return rebRepossess(buffer, pad_len);
+}
+
+
+//
+//  Tls_P_Hash: C
+//
+// P_hash from RFC 5246 section 5, XOR'd into OUT so the PRF of TLS 1.0 and
+// 1.1 can combine P_MD5 and P_SHA1 in the same buffer:
+//
+//     P_hash(secret, seed) = HMAC(secret, A(1) + seed)
+//                            + HMAC(secret, A(2) + seed) + ...
+//
+//     A(0) = seed, A(n) = HMAC(secret, A(n-1))
+//
+static void Tls_P_Hash(
+    REBYTE *out,
+    REBLEN out_len,
+    REBLEN i,
+    const REBYTE *secret,
+    REBSIZ secret_len,
+    const REBYTE *seed,
+    REBLEN seed_len
+){
+    REBLEN hash_len = digests[i].len;
+
+    REBYTE a[32]; // size must be max of all digest[].len
+    REBYTE chunk[32];
+
+    Hmac_Digest(a, i, secret, secret_len, seed, seed_len, nullptr, 0);
+
+    REBLEN n = 0;
+    while (n < out_len) {
+        Hmac_Digest(chunk, i, secret, secret_len, a, hash_len, seed, seed_len);
+
+        REBLEN j;
+        for (j = 0; j < hash_len and n < out_len; ++j, ++n)
+            out[n] ^= chunk[j];
+
+        Hmac_Digest(a, i, secret, secret_len, a, hash_len, nullptr, 0);
+    }
+}
+
+
+static REBLEN Find_Digest(REBSYM sym)
+{
+    REBLEN i;
+    for (i = 0; digests[i].sym != SYM_0; i++) {
+        if (SAME_SYM_NONZERO(digests[i].sym, sym))
+            return i;
+    }
+    return i;  // the terminator, check digests[i].sym for SYM_0
+}
+
+
+//
+//  export tls-prf: native [
+//
+//  {TLS pseudorandom function, expanding a secret into key material}
+//
+//      return: [binary!]
+//      secret [binary!]
+//      label [text! binary!]
+//      seed [binary!]
+//      length "Number of bytes to produce"
+//          [integer!]
+//      /legacy "TLS 1.0 and 1.1 PRF (MD5 and SHA1 halves), else P_SHA256"
+//  ]
+//
+REBNATIVE(tls_prf)
+//
+// PRF(secret, label, seed) = P_<hash>(secret, label + seed), where TLS 1.2's
+// cipher suites all use SHA256.  Before 1.2 it was P_MD5 over the first half
+// of the secret XOR'd with P_SHA1 over the second half (the halves share the
+// middle byte if the length is odd): https://tools.ietf.org/html/rfc4346#section-5
+{
+    CRYPT_INCLUDE_PARAMS_OF_TLS_PRF;
+
+    REBI64 out_len = VAL_INT64(ARG(length));
+    if (out_len < 0)
+        fail (PAR(length));
+
+    REBSIZ secret_len;
+    const REBYTE *secret = VAL_BYTES_AT(&secret_len, ARG(secret));
+
+    REBSIZ label_len;
+    const REBYTE *label = VAL_BYTES_AT(&label_len, ARG(label));
+
+    REBLEN seed_len = VAL_LEN_AT(ARG(seed));
+
+    REBYTE *label_seed = rebAllocN(REBYTE, label_len + seed_len + 1);
+    memcpy(label_seed, label, label_len);
+    memcpy(label_seed + label_len, VAL_BIN_AT(ARG(seed)), seed_len);
+
+    REBYTE *out = rebAllocN(REBYTE, out_len + 1);  // +1 if length is 0
+    memset(out, 0, out_len);
+
+    if (REF(legacy)) {
+        REBLEN half = (secret_len + 1) / 2;
+        Tls_P_Hash(
+            out, out_len, Find_Digest(SYM_MD5),
+            secret, half,
+            label_seed, label_len + seed_len
+        );
+        Tls_P_Hash(
+            out, out_len, Find_Digest(SYM_SHA1),
+            secret + secret_len - half, half,
+            label_seed, label_len + seed_len
+        );
     }
     else
-        pad_data = nullptr;
+        Tls_P_Hash(
+            out, out_len, Find_Digest(SYM_SHA256),
+            secret, secret_len,
+            label_seed, label_len + seed_len
+        );
+
+    rebFree(label_seed);
+    return rebRepossess(out, out_len);
+}
+
+
+// One direction of a TLS connection's record protection: the bulk cipher,
+// the MAC key and hash, and the sequence number each record's MAC covers.
+// TLS 1.0 chains CBC from one record into the next (the last ciphertext
+// block is the next record's IV), while 1.1 and later put a fresh IV in
+// front of every record.
+//
+typedef struct {
+    AES_CTX aes;
+    REBLEN digest;  // index into digests[]
+    REBYTE mac_key[32];  // size must be max of all digest[].len
+    uint64_t seq;
+    bool explicit_iv;
+    bool decrypt;
+} TLS_CIPHER;
+
+#define TLS_MAX_FRAGMENT 16384  // 2^14, the most plaintext in one record
+
+
+static void cleanup_tls_cipher(const REBVAL *v)
+{
+    TLS_CIPHER *c = VAL_HANDLE_POINTER(TLS_CIPHER, v);
+    memset(c, 0, sizeof(TLS_CIPHER));  // don't leave keys in freed memory
+    FREE(TLS_CIPHER, c);
+}
 
-    REBYTE *data_out = rebAllocN(REBYTE, pad_len);
-    memset(data_out, 0, pad_len);
 
-    if (aes_ctx->key_mode == AES_MODE_DECRYPT)
-        AES_cbc_decrypt(
-            aes_ctx,
-            cast(const uint8_t*, dataBuffer),
-            data_out,
-            pad_len
+static TLS_CIPHER *Tls_Cipher_Of(const REBVAL *v, bool decrypt)
+{
+    if (VAL_HANDLE_CLEANER(v) != cleanup_tls_cipher)
+        fail ("Not a TLS cipher state, see TLS-CIPHER");
+
+    TLS_CIPHER *c = VAL_HANDLE_POINTER(TLS_CIPHER, v);
+    if (c->decrypt != decrypt)
+        fail (decrypt
+            ? "TLS cipher state is for writing records, not reading them"
+            : "TLS cipher state is for reading records, not writing them"
         );
+    return c;
+}
+
+
+// The data a record's MAC covers ahead of its content:
+//
+//     seq_num + type + version + length
+//
+// https://tools.ietf.org/html/rfc5246#section-6.2.3.1
+//
+static void Tls_Mac_Header(
+    REBYTE *out,
+    uint64_t seq,
+    const REBYTE *type_and_version,
+    REBLEN len
+){
+    int k;
+    for (k = 7; k >= 0; --k) {
+        out[k] = cast(REBYTE, seq & 0xFF);
+        seq >>= 8;
+    }
+    memcpy(out + 8, type_and_version, 3);
+    out[11] = cast(REBYTE, len >> 8);
+    out[12] = cast(REBYTE, len & 0xFF);
+}
+
+
+//
+//  export tls-cipher: native [
+//
+//  {Make the record protection state for one direction of a TLS connection}
+//
+//      return: "State handle for TLS-SEAL, or TLS-OPEN if /DECRYPT"
+//          [handle!]
+//      crypt-key "AES key, 16 or 32 bytes"
+//          [binary!]
+//      mac-key [binary!]
+//      method "Hash for the record MAC (SHA1, SHA256, MD5)"
+//          [word!]
+//      iv "IV for TLS 1.0, or BLANK! for an IV sent with each record"
+//          [binary! blank!]
+//      /decrypt "Make state for reading records (default is for writing)"
+//  ]
+//
+REBNATIVE(tls_cipher)
+{
+    CRYPT_INCLUDE_PARAMS_OF_TLS_CIPHER;
+
+    REBLEN i = Find_Digest(VAL_WORD_SYM(ARG(method)));
+    if (digests[i].sym == SYM_0)
+        fail (PAR(method));
+
+    if (VAL_LEN_AT(ARG(mac_key)) != digests[i].len)
+        fail ("TLS MAC key must be the size of the MAC hash");
+
+    REBINT key_bits = VAL_LEN_AT(ARG(crypt_key)) << 3;
+    if (key_bits != 128 and key_bits != 256)
+        fail ("TLS AES key length has to be 16 or 32");
+
+    uint8_t iv[AES_IV_SIZE];
+    if (IS_BINARY(ARG(iv))) {
+        if (VAL_LEN_AT(ARG(iv)) < AES_IV_SIZE)
+            fail ("Length of initialization vector less than AES size");
+        memcpy(iv, VAL_BIN_AT(ARG(iv)), AES_IV_SIZE);
+    }
     else
-        AES_cbc_encrypt(
-            aes_ctx,
-            cast(const uint8_t*, dataBuffer),
-            data_out,
-            pad_len
+        memset(iv, 0, AES_IV_SIZE);  // replaced by each record's own IV
+
+    TLS_CIPHER *c = ALLOC_ZEROFILL(TLS_CIPHER);
+    AES_set_key(
+        &c->aes,
+        cast(const uint8_t*, VAL_BIN_AT(ARG(crypt_key))),
+        iv,
+        (key_bits == 128) ? AES_MODE_128 : AES_MODE_256
+    );
+    if (REF(decrypt))
+        AES_convert_key(&c->aes);
+
+    c->digest = i;
+    memcpy(c->mac_key, VAL_BIN_AT(ARG(mac_key)), digests[i].len);
+    c->seq = 0;
+    c->explicit_iv = not IS_BINARY(ARG(iv));
+    c->decrypt = REF(decrypt);
+
+    return Init_Handle_Cdata_Managed(
+        D_OUT,
+        c,
+        sizeof(TLS_CIPHER),
+        &cleanup_tls_cipher
+    );
+}
+
+
+//
+//  export tls-seal: native [
+//
+//  {Append content to a buffer as MAC'd, padded and encrypted TLS records}
+//
+//      return: [binary!]
+//      buffer "Output buffer the records are appended to (modified)"
+//          [binary!]
+//      cipher "State from TLS-CIPHER"
+//          [handle!]
+//      type "Record content type, e.g. 22 for handshake, 23 for data"
+//          [integer!]
+//      version "Protocol version bytes for the record headers"
+//          [binary!]
+//      content [binary!]
+//  ]
+//
+REBNATIVE(tls_seal)
+//
+// Content longer than the 2^14 bytes a record may carry is split across as
+// many records as it takes.  Each record is built where it will be sent
+// from: the content is copied into BUFFER once, and the MAC, padding and
+// encryption are done there.
+{
+    CRYPT_INCLUDE_PARAMS_OF_TLS_SEAL;
+
+    TLS_CIPHER *c = Tls_Cipher_Of(ARG(cipher), false);
+
+    if (VAL_LEN_AT(ARG(version)) != 2)
+        fail (PAR(version));
+    REBINT type = VAL_INT32(ARG(type));
+    if (type < 0 or type > 255)
+        fail (PAR(type));
+
+    REBSER *bin = VAL_SERIES(ARG(buffer));
+    if (bin == VAL_SERIES(ARG(content)))
+        fail ("TLS-SEAL content can't be in the output buffer");
+    FAIL_IF_READ_ONLY(ARG(buffer));
+
+    REBYTE type_and_version[3];
+    type_and_version[0] = cast(REBYTE, type);
+    memcpy(type_and_version + 1, VAL_BIN_AT(ARG(version)), 2);
+
+    REBLEN iv_len = c->explicit_iv ? AES_BLOCKSIZE : 0;
+    REBLEN mac_len = digests[c->digest].len;
+
+    const REBYTE *content = VAL_BIN_AT(ARG(content));
+    REBLEN left = VAL_LEN_AT(ARG(content));
+
+    do {  // zero length content still gets a record
+        REBLEN n = MIN(left, TLS_MAX_FRAGMENT);
+        REBLEN pad = (AES_BLOCKSIZE - (n + mac_len + 1) % AES_BLOCKSIZE)
+            % AES_BLOCKSIZE;
+        REBLEN body_len = n + mac_len + pad + 1;
+        REBLEN frag_len = iv_len + body_len;
+
+        REBLEN tail = BIN_LEN(bin);
+        EXPAND_SERIES_TAIL(bin, 5 + frag_len);
+        TERM_BIN_LEN(bin, tail + 5 + frag_len);
+
+        REBYTE *rec = BIN_AT(bin, tail);
+        memcpy(rec, type_and_version, 3);
+        rec[3] = cast(REBYTE, frag_len >> 8);
+        rec[4] = cast(REBYTE, frag_len & 0xFF);
+
+        REBYTE *body = rec + 5 + iv_len;
+        memcpy(body, content, n);
+
+        REBYTE header[13];
+        Tls_Mac_Header(header, c->seq, type_and_version, n);
+        Hmac_Digest(
+            body + n, c->digest, c->mac_key, mac_len, header, 13, body, n
         );
+        memset(body + n + mac_len, cast(int, pad), pad + 1);
+
+        if (c->explicit_iv) {  // "SHOULD be chosen at random" (RFC 5246)
+            get_random(AES_BLOCKSIZE, rec + 5);
+            memcpy(c->aes.iv, rec + 5, AES_BLOCKSIZE);
+        }
+        AES_cbc_encrypt(&c->aes, body, body, body_len);
+
+        ++c->seq;
+        content += n;
+        left -= n;
+    } while (left != 0);
+
+    RETURN (ARG(buffer));
+}
+
+
+//
+//  export tls-open: native [
+//
+//  {Decrypt a TLS record in place, checking and removing its padding and MAC}
+//
+//      return: "The record, now plaintext with its header length updated"
+//          [binary!]
+//      cipher "State from TLS-CIPHER/DECRYPT"
+//          [handle!]
+//      record "A whole record, from its 5-byte header to the tail (modified)"
+//          [binary!]
+//  ]
+//
+REBNATIVE(tls_open)
+//
+// Bad padding and a bad MAC give the same error, and a record with bad
+// padding still has a MAC computed and compared (as if it had no padding)
+// before failing.  Answering faster or differently for bad padding is what
+// padding oracle attacks on CBC measure:
+//
+// https://tools.ietf.org/html/rfc5246#section-6.2.3.2
+{
+    CRYPT_INCLUDE_PARAMS_OF_TLS_OPEN;
+
+    TLS_CIPHER *c = Tls_Cipher_Of(ARG(cipher), true);
+
+    FAIL_IF_READ_ONLY(ARG(record));
+
+    REBLEN len = VAL_LEN_AT(ARG(record));
+    REBYTE *rec = VAL_BIN_AT(ARG(record));
+    if (len < 5 or len - 5 != (cast(REBLEN, rec[3]) << 8) + rec[4])
+        fail ("TLS record length doesn't match its header");
+
+    REBLEN iv_len = c->explicit_iv ? AES_BLOCKSIZE : 0;
+    REBLEN mac_len = digests[c->digest].len;
+
+    REBLEN frag_len = len - 5;
+    if (
+        frag_len < iv_len + mac_len + 1
+        or (frag_len - iv_len) % AES_BLOCKSIZE != 0
+    ){
+        fail ("Bad TLS record length for its cipher");
+    }
+
+    if (c->explicit_iv)
+        memcpy(c->aes.iv, rec + 5, AES_BLOCKSIZE);
+
+    REBYTE *body = rec + 5 + iv_len;
+    REBLEN body_len = frag_len - iv_len;
+    AES_cbc_decrypt(&c->aes, body, body, body_len);
+
+    REBLEN pad = body[body_len - 1];
+    REBYTE bad = 0;
+    if (pad + 1 + mac_len > body_len)
+        bad = 1;
+    else {
+        REBLEN j;
+        for (j = 0; j <= pad; ++j)
+            bad |= body[body_len - 1 - j] ^ cast(REBYTE, pad);
+    }
+    if (bad)
+        pad = 0;
 
-    if (pad_data)
-        rebFree(pad_data);
+    REBLEN n = body_len - (pad + 1) - mac_len;
 
-    return rebRepossess(data_out, pad_len);
+    REBYTE header[13];
+    Tls_Mac_Header(header, c->seq, rec, n);
+
+    REBYTE mac[32]; // size must be max of all digest[].len
+    Hmac_Digest(mac, c->digest, c->mac_key, mac_len, header, 13, body, n);
+
+    REBLEN j;
+    for (j = 0; j < mac_len; ++j)  // don't stop at first mismatch
+        bad |= mac[j] ^ body[n + j];
+
+    ++c->seq;
+
+    if (bad)
+        fail ("Bad TLS record MAC");
+
+    memmove(rec + 5, body, n);
+    rec[3] = cast(REBYTE, n >> 8);
+    rec[4] = cast(REBYTE, n & 0xFF);
+    TERM_BIN_LEN(VAL_SERIES(ARG(record)), VAL_INDEX(ARG(record)) + 5 + n);
+
+    RETURN (ARG(record));
 }
 
 
@@ -848,6 +1424,21 @@ REBNATIVE(init_crypto)
     }
   #endif
 
+    // RANDOM/SECURE is a ChaCha20 keystream in the core, which has no way to
+    // get OS entropy on its own.  Key it now that a source is available.
+    //
+  #ifdef TO_WINDOWS
+    if (gCryptProv != 0)
+  #else
+    if (rng_fd != -1)
+  #endif
+    {
+        uint8_t entropy[32];
+        get_random(sizeof(entropy), entropy);
+        Set_Random_Entropy(entropy, sizeof(entropy));
+        memset(entropy, 0, sizeof(entropy));
+    }
+
     return Init_Void(D_OUT);
 }
 
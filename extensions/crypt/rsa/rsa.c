@@ -117,6 +117,13 @@ void RSA_priv_key_new(RSA_CTX **ctx,
     bi_permanent(rsa_ctx->d);
 
 #ifdef CONFIG_BIGINT_CRT
+    /* REBOL: key objects need not carry the CRT values; use d without them */
+    if (p_len == 0 || q_len == 0 || dP_len == 0 || dQ_len == 0 || qInv_len == 0)
+    {
+        rsa_ctx->p = NULL;
+        return;
+    }
+
     rsa_ctx->p = bi_import(bi_ctx, p, p_len);
     rsa_ctx->q = bi_import(bi_ctx, q, q_len);
     rsa_ctx->dP = bi_import(bi_ctx, dP, dP_len);
@@ -171,6 +178,8 @@ void RSA_free(RSA_CTX *rsa_ctx)
         bi_depermanent(rsa_ctx->d);
         bi_free(bi_ctx, rsa_ctx->d);
 #ifdef CONFIG_BIGINT_CRT
+      if (rsa_ctx->p)
+      {
         bi_depermanent(rsa_ctx->dP);
         bi_depermanent(rsa_ctx->dQ);
         bi_depermanent(rsa_ctx->qInv);
@@ -179,6 +188,7 @@ void RSA_free(RSA_CTX *rsa_ctx)
         bi_free(bi_ctx, rsa_ctx->qInv);
         bi_free_mod(rsa_ctx->bi_ctx, BIGINT_P_OFFSET);
         bi_free_mod(rsa_ctx->bi_ctx, BIGINT_Q_OFFSET);
+      }
 #endif
     }
 
@@ -260,13 +270,13 @@ int RSA_decrypt(const RSA_CTX *ctx, const uint8_t *in_data,
  */
 bigint *RSA_private(const RSA_CTX *c, bigint *bi_msg)
 {
-#ifdef CONFIG_BIGINT_CRT
-    return bi_crt(c->bi_ctx, bi_msg, c->dP, c->dQ, c->p, c->q, c->qInv);
-#else
     BI_CTX *ctx = c->bi_ctx;
+#ifdef CONFIG_BIGINT_CRT
+    if (c->p)
+        return bi_crt(ctx, bi_msg, c->dP, c->dQ, c->p, c->q, c->qInv);
+#endif
     ctx->mod_offset = BIGINT_M_OFFSET;
     return bi_mod_power(ctx, bi_msg, c->d);
-#endif
 }
 
 #ifdef CONFIG_SSL_FULL_MODE
@@ -41,6 +41,37 @@ static const uint32_t k[64] = {
     0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208,0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
 };
 
+/*
+ * REBOL: Hardware paths.  x86 CPUs with the SHA extensions (CPUID leaf 7,
+ * EBX bit 29) get the SHA256RNDS2/SHA256MSG1/SHA256MSG2 version of the
+ * compression function, which is several times faster than the scalar C.
+ * Without those, AVX2 can still run eight *independent* messages through
+ * the scalar algorithm at once, one per 32-bit lane; sha256_batch() uses
+ * that to hash many small messages.  Detection is done once, at runtime.
+ *
+ * Build with REBOL_NO_SHA_SIMD defined to leave out the intrinsics.
+ */
+#if !defined(REBOL_NO_SHA_SIMD) && ( \
+    defined(__x86_64__) || defined(__i386__) \
+    || defined(_M_X64) || defined(_M_IX86) \
+) && ( \
+    (defined(_MSC_VER) && _MSC_VER >= 1900) || defined(__clang__) \
+    || (defined(__GNUC__) && __GNUC__ >= 5) \
+)
+    #define SHA256_HAVE_SIMD_CODE
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define SHA_NI_TARGET
+        #define AVX2_TARGET
+    #else
+        #include <cpuid.h>
+        #define SHA_NI_TARGET \
+            __attribute__((target("sha,sse4.1,ssse3")))
+        #define AVX2_TARGET __attribute__((target("avx2")))
+    #endif
+#endif
+
 /*********************** FUNCTION DEFINITIONS ***********************/
 void sha256_transform(SHA256_CTX *ctx, const uint8_t data[])
 {
@@ -83,6 +114,252 @@ void sha256_transform(SHA256_CTX *ctx, const uint8_t data[])
     ctx->state[7] += h;
 }
 
+#ifdef SHA256_HAVE_SIMD_CODE
+
+static int sha_simd_checked = 0;
+static int sha_ni_ok = 0;
+static int sha_avx2_ok = 0;
+
+static void sha256_check_cpu(void)
+{
+    unsigned int ecx1 = 0, ebx7 = 0;
+    int os_avx = 0;
+  #if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+        __cpuidex(info, 7, 0);
+        ebx7 = (unsigned int)info[1];
+    }
+    __cpuid(info, 1);
+    ecx1 = (unsigned int)info[2];
+    if ((ecx1 & (1u << 27)) != 0)  /* OSXSAVE, so XGETBV is usable */
+        os_avx = (_xgetbv(0) & 6) == 6;
+  #else
+    unsigned int eax, ebx, edx;
+    if (__get_cpuid_max(0, NULL) >= 7) {
+        __cpuid_count(7, 0, eax, ebx, ecx1, edx);
+        ebx7 = ebx;
+    }
+    if (!__get_cpuid(1, &eax, &ebx, &ecx1, &edx))
+        ecx1 = 0;
+    if ((ecx1 & (1u << 27)) != 0) {  /* OSXSAVE, so XGETBV is usable */
+        unsigned int xlo, xhi;
+        __asm__ ("xgetbv" : "=a"(xlo), "=d"(xhi) : "c"(0));
+        os_avx = (xlo & 6) == 6;  /* OS saves XMM and YMM state */
+    }
+  #endif
+    sha_ni_ok = (ebx7 & (1u << 29)) != 0  /* SHA */
+        && (ecx1 & (1u << 19)) != 0  /* SSE4.1 */
+        && (ecx1 & (1u << 9)) != 0;  /* SSSE3 */
+    sha_avx2_ok = os_avx && (ebx7 & (1u << 5)) != 0;  /* AVX2 */
+    sha_simd_checked = 1;
+}
+
+/* Adapted from the public domain SHA-NI code by Sean Gulley (Intel) and
+   Jeffrey Walton.  The state is kept as ABEF/CDGH as the instructions want */
+SHA_NI_TARGET
+static void sha256_blocks_ni(uint32_t state[8], const uint8_t *data, size_t n)
+{
+    const __m128i MASK = _mm_set_epi64x(
+        0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL
+    );
+    __m128i STATE0, STATE1, MSG, TMP, ABEF_SAVE, CDGH_SAVE;
+    __m128i MSG0, MSG1, MSG2, MSG3;
+
+    TMP = _mm_loadu_si128((const __m128i*)&state[0]);
+    STATE1 = _mm_loadu_si128((const __m128i*)&state[4]);
+    TMP = _mm_shuffle_epi32(TMP, 0xB1);  /* CDAB */
+    STATE1 = _mm_shuffle_epi32(STATE1, 0x1B);  /* EFGH */
+    STATE0 = _mm_alignr_epi8(TMP, STATE1, 8);  /* ABEF */
+    STATE1 = _mm_blend_epi16(STATE1, TMP, 0xF0);  /* CDGH */
+
+  /* Four rounds using message words CUR (with the round constants added) */
+  #define ROUNDS4(i,CUR) \
+    MSG = _mm_add_epi32((CUR), \
+        _mm_loadu_si128((const __m128i*)&k[4 * (i)])); \
+    STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG); \
+    MSG = _mm_shuffle_epi32(MSG, 0x0E); \
+    STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG)
+
+  /* Same, also finishing the schedule of NEXT from PREV and CUR */
+  #define ROUNDS4_SCHED(i,CUR,PREV,NEXT) \
+    MSG = _mm_add_epi32((CUR), \
+        _mm_loadu_si128((const __m128i*)&k[4 * (i)])); \
+    STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG); \
+    TMP = _mm_alignr_epi8((CUR), (PREV), 4); \
+    NEXT = _mm_add_epi32(NEXT, TMP); \
+    NEXT = _mm_sha256msg2_epu32(NEXT, (CUR)); \
+    MSG = _mm_shuffle_epi32(MSG, 0x0E); \
+    STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG)
+
+    for (; n > 0; n--, data += 64) {
+        ABEF_SAVE = STATE0;
+        CDGH_SAVE = STATE1;
+
+        MSG0 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)(data + 0)), MASK
+        );
+        MSG1 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)(data + 16)), MASK
+        );
+        MSG2 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)(data + 32)), MASK
+        );
+        MSG3 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)(data + 48)), MASK
+        );
+
+        ROUNDS4(0, MSG0);
+        ROUNDS4(1, MSG1);
+        MSG0 = _mm_sha256msg1_epu32(MSG0, MSG1);
+        ROUNDS4(2, MSG2);
+        MSG1 = _mm_sha256msg1_epu32(MSG1, MSG2);
+        ROUNDS4_SCHED(3, MSG3, MSG2, MSG0);
+        MSG2 = _mm_sha256msg1_epu32(MSG2, MSG3);
+        ROUNDS4_SCHED(4, MSG0, MSG3, MSG1);
+        MSG3 = _mm_sha256msg1_epu32(MSG3, MSG0);
+        ROUNDS4_SCHED(5, MSG1, MSG0, MSG2);
+        MSG0 = _mm_sha256msg1_epu32(MSG0, MSG1);
+        ROUNDS4_SCHED(6, MSG2, MSG1, MSG3);
+        MSG1 = _mm_sha256msg1_epu32(MSG1, MSG2);
+        ROUNDS4_SCHED(7, MSG3, MSG2, MSG0);
+        MSG2 = _mm_sha256msg1_epu32(MSG2, MSG3);
+        ROUNDS4_SCHED(8, MSG0, MSG3, MSG1);
+        MSG3 = _mm_sha256msg1_epu32(MSG3, MSG0);
+        ROUNDS4_SCHED(9, MSG1, MSG0, MSG2);
+        MSG0 = _mm_sha256msg1_epu32(MSG0, MSG1);
+        ROUNDS4_SCHED(10, MSG2, MSG1, MSG3);
+        MSG1 = _mm_sha256msg1_epu32(MSG1, MSG2);
+        ROUNDS4_SCHED(11, MSG3, MSG2, MSG0);
+        MSG2 = _mm_sha256msg1_epu32(MSG2, MSG3);
+        ROUNDS4_SCHED(12, MSG0, MSG3, MSG1);
+        MSG3 = _mm_sha256msg1_epu32(MSG3, MSG0);
+        ROUNDS4_SCHED(13, MSG1, MSG0, MSG2);
+        ROUNDS4_SCHED(14, MSG2, MSG1, MSG3);
+        ROUNDS4(15, MSG3);
+
+        STATE0 = _mm_add_epi32(STATE0, ABEF_SAVE);
+        STATE1 = _mm_add_epi32(STATE1, CDGH_SAVE);
+    }
+
+  #undef ROUNDS4
+  #undef ROUNDS4_SCHED
+
+    TMP = _mm_shuffle_epi32(STATE0, 0x1B);  /* FEBA */
+    STATE1 = _mm_shuffle_epi32(STATE1, 0xB1);  /* DCHG */
+    STATE0 = _mm_blend_epi16(TMP, STATE1, 0xF0);  /* DCBA */
+    STATE1 = _mm_alignr_epi8(STATE1, TMP, 8);  /* HGFE */
+
+    _mm_storeu_si128((__m128i*)&state[0], STATE0);
+    _mm_storeu_si128((__m128i*)&state[4], STATE1);
+}
+
+#define SHA256_LANES 8
+
+#define ROTR8(x,n) \
+    _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32-(n)))
+
+/* One compression of eight independent states.  st[j][lane] is word j of
+   the state of LANE, and blocks[lane] is the 64 bytes to mix into it */
+AVX2_TARGET
+static void sha256_compress_x8(
+    uint32_t st[8][SHA256_LANES], const uint8_t *blocks[SHA256_LANES]
+){
+    __m256i w[64];
+    __m256i a, b, c, d, e, f, g, h, t1, t2;
+    int i;
+
+    for (i = 0; i < 16; ++i) {
+        uint32_t v[SHA256_LANES];
+        int lane;
+        for (lane = 0; lane < SHA256_LANES; ++lane) {
+            const uint8_t *p = blocks[lane] + 4 * i;
+            v[lane] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16)
+                | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+        }
+        w[i] = _mm256_loadu_si256((const __m256i*)v);
+    }
+    for ( ; i < 64; ++i) {
+        __m256i s0 = _mm256_xor_si256(
+            _mm256_xor_si256(ROTR8(w[i-15], 7), ROTR8(w[i-15], 18)),
+            _mm256_srli_epi32(w[i-15], 3)
+        );
+        __m256i s1 = _mm256_xor_si256(
+            _mm256_xor_si256(ROTR8(w[i-2], 17), ROTR8(w[i-2], 19)),
+            _mm256_srli_epi32(w[i-2], 10)
+        );
+        w[i] = _mm256_add_epi32(
+            _mm256_add_epi32(s1, w[i-7]), _mm256_add_epi32(s0, w[i-16])
+        );
+    }
+
+    a = _mm256_loadu_si256((const __m256i*)st[0]);
+    b = _mm256_loadu_si256((const __m256i*)st[1]);
+    c = _mm256_loadu_si256((const __m256i*)st[2]);
+    d = _mm256_loadu_si256((const __m256i*)st[3]);
+    e = _mm256_loadu_si256((const __m256i*)st[4]);
+    f = _mm256_loadu_si256((const __m256i*)st[5]);
+    g = _mm256_loadu_si256((const __m256i*)st[6]);
+    h = _mm256_loadu_si256((const __m256i*)st[7]);
+
+    for (i = 0; i < 64; ++i) {
+        __m256i ep1 = _mm256_xor_si256(
+            _mm256_xor_si256(ROTR8(e, 6), ROTR8(e, 11)), ROTR8(e, 25)
+        );
+        __m256i ch = _mm256_xor_si256(
+            _mm256_and_si256(e, f), _mm256_andnot_si256(e, g)
+        );
+        __m256i ep0 = _mm256_xor_si256(
+            _mm256_xor_si256(ROTR8(a, 2), ROTR8(a, 13)), ROTR8(a, 22)
+        );
+        __m256i maj = _mm256_xor_si256(
+            _mm256_xor_si256(_mm256_and_si256(a, b), _mm256_and_si256(a, c)),
+            _mm256_and_si256(b, c)
+        );
+        t1 = _mm256_add_epi32(
+            _mm256_add_epi32(_mm256_add_epi32(h, ep1), ch),
+            _mm256_add_epi32(_mm256_set1_epi32((int)k[i]), w[i])
+        );
+        t2 = _mm256_add_epi32(ep0, maj);
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(t1, t2);
+    }
+
+  #define ADD_BACK(j,x) \
+    _mm256_storeu_si256((__m256i*)st[j], _mm256_add_epi32((x), \
+        _mm256_loadu_si256((const __m256i*)st[j])))
+
+    ADD_BACK(0, a); ADD_BACK(1, b); ADD_BACK(2, c); ADD_BACK(3, d);
+    ADD_BACK(4, e); ADD_BACK(5, f); ADD_BACK(6, g); ADD_BACK(7, h);
+
+  #undef ADD_BACK
+}
+
+#undef ROTR8
+
+#endif /* SHA256_HAVE_SIMD_CODE */
+
+static void sha256_blocks(SHA256_CTX *ctx, const uint8_t *data, size_t n)
+{
+#ifdef SHA256_HAVE_SIMD_CODE
+    if (!sha_simd_checked)
+        sha256_check_cpu();
+    if (sha_ni_ok) {
+        sha256_blocks_ni(ctx->state, data, n);
+        return;
+    }
+#endif
+    for ( ; n > 0; n--, data += 64)
+        sha256_transform(ctx, data);
+}
+
 void sha256_init(SHA256_CTX *ctx)
 {
     ctx->datalen = 0;
@@ -99,17 +376,35 @@ void sha256_init(SHA256_CTX *ctx)
 
 void sha256_update(SHA256_CTX *ctx, const uint8_t data[], size_t len)
 {
-    uint32_t i;
-
-    for (i = 0; i < len; ++i) {
-        ctx->data[ctx->datalen] = data[i];
-        ctx->datalen++;
-        if (ctx->datalen == 64) {
-            sha256_transform(ctx, ctx->data);
-            ctx->bitlen += 512;
-            ctx->datalen = 0;
-        }
+    size_t n;
+
+    // Top up a partial block left from a previous call.
+    if (ctx->datalen != 0) {
+        n = 64 - ctx->datalen;
+        if (n > len)
+            n = len;
+        memcpy(ctx->data + ctx->datalen, data, n);
+        ctx->datalen += n;
+        data += n;
+        len -= n;
+        if (ctx->datalen < 64)
+            return;
+        sha256_blocks(ctx, ctx->data, 1);
+        ctx->bitlen += 512;
+        ctx->datalen = 0;
     }
+
+    // Whole blocks are compressed straight from the caller's buffer.
+    n = len / 64;
+    if (n != 0) {
+        sha256_blocks(ctx, data, n);
+        ctx->bitlen += 512 * (uint64_t)n;
+        data += 64 * n;
+        len -= 64 * n;
+    }
+
+    memcpy(ctx->data, data, len);
+    ctx->datalen = len;
 }
 
 void sha256_final(SHA256_CTX *ctx, uint8_t hash[])
@@ -126,7 +421,7 @@ void sha256_final(SHA256_CTX *ctx, uint8_t hash[])
         ctx->data[i++] = 0x80;
         while (i < 64)
             ctx->data[i++] = 0x00;
-        sha256_transform(ctx, ctx->data);
+        sha256_blocks(ctx, ctx->data, 1);
         memset(ctx->data, 0, 56);
     }
 
@@ -140,7 +435,7 @@ void sha256_final(SHA256_CTX *ctx, uint8_t hash[])
     ctx->data[58] = ctx->bitlen >> 40;
     ctx->data[57] = ctx->bitlen >> 48;
     ctx->data[56] = ctx->bitlen >> 56;
-    sha256_transform(ctx, ctx->data);
+    sha256_blocks(ctx, ctx->data, 1);
 
     // Since this implementation uses little endian byte ordering and SHA uses big endian,
     // reverse all the bytes when copying the final state to the output hash.
@@ -155,3 +450,113 @@ void sha256_final(SHA256_CTX *ctx, uint8_t hash[])
         hash[i + 28] = (ctx->state[7] >> (24 - i * 8)) & 0x000000ff;
     }
 }
+
+/*
+ * Hash COUNT independent messages, writing each 32-byte digest to HASHES in
+ * order.  With AVX2 (and no SHA extensions, which are faster still one
+ * message at a time) eight messages share each compression, one per lane.
+ * A lane that finishes its message picks up the next one waiting, so the
+ * lanes stay busy when the lengths vary.
+ */
+void sha256_batch(
+    const uint8_t *const data[], const size_t lens[], size_t count,
+    uint8_t *hashes
+){
+    size_t i;
+
+#ifdef SHA256_HAVE_SIMD_CODE
+    if (!sha_simd_checked)
+        sha256_check_cpu();
+
+    if (sha_avx2_ok && !sha_ni_ok && count > 1) {
+        static const uint8_t idle[64] = {0};  // fed to lanes with no work
+        static const uint32_t iv[8] = {
+            0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+            0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+        };
+
+        struct {
+            size_t msg;  // index of message in this lane
+            size_t full;  // whole blocks read straight from the message
+            size_t next;  // next block to compress
+            size_t total;  // full blocks plus one or two padding blocks
+            uint8_t tail[128];  // padded final block(s)
+        } lane[SHA256_LANES];
+
+        uint32_t st[8][SHA256_LANES];
+        const uint8_t *blocks[SHA256_LANES];
+        size_t waiting = 0;
+        size_t busy = 0;
+        int l, j;
+
+        for (l = 0; l < SHA256_LANES; ++l)
+            lane[l].total = 0;  // idle
+
+        for (;;) {
+            for (l = 0; l < SHA256_LANES; ++l) {
+                if (lane[l].total == 0 && waiting < count) {
+                    size_t len = lens[waiting];
+                    size_t rest = len % 64;
+                    uint64_t bits = (uint64_t)len * 8;
+                    uint8_t *t = lane[l].tail;
+                    size_t tlen;
+
+                    lane[l].msg = waiting++;
+                    lane[l].full = len / 64;
+                    lane[l].next = 0;
+
+                    tlen = (rest < 56) ? 64 : 128;
+                    memset(t, 0, tlen);
+                    memcpy(t, data[lane[l].msg] + len - rest, rest);
+                    t[rest] = 0x80;
+                    for (j = 0; j < 8; ++j)
+                        t[tlen - 1 - j] = (uint8_t)(bits >> (8 * j));
+
+                    lane[l].total = lane[l].full + tlen / 64;
+                    for (j = 0; j < 8; ++j)
+                        st[j][l] = iv[j];
+                    ++busy;
+                }
+
+                if (lane[l].total == 0)
+                    blocks[l] = idle;
+                else if (lane[l].next < lane[l].full)
+                    blocks[l] = data[lane[l].msg] + 64 * lane[l].next;
+                else
+                    blocks[l] = lane[l].tail
+                        + 64 * (lane[l].next - lane[l].full);
+            }
+
+            if (busy == 0)
+                break;
+
+            sha256_compress_x8(st, blocks);
+
+            for (l = 0; l < SHA256_LANES; ++l) {
+                uint8_t *out;
+                if (lane[l].total == 0)
+                    continue;
+                if (++lane[l].next < lane[l].total)
+                    continue;
+                out = hashes + 32 * lane[l].msg;
+                for (j = 0; j < 8; ++j) {
+                    out[4*j+0] = (uint8_t)(st[j][l] >> 24);
+                    out[4*j+1] = (uint8_t)(st[j][l] >> 16);
+                    out[4*j+2] = (uint8_t)(st[j][l] >> 8);
+                    out[4*j+3] = (uint8_t)(st[j][l]);
+                }
+                lane[l].total = 0;
+                --busy;
+            }
+        }
+        return;
+    }
+#endif
+
+    for (i = 0; i < count; ++i) {
+        SHA256_CTX ctx;
+        sha256_init(&ctx);
+        sha256_update(&ctx, data[i], lens[i]);
+        sha256_final(&ctx, hashes + 32 * i);
+    }
+}
@@ -29,5 +29,9 @@ typedef struct {
 void sha256_init(SHA256_CTX *ctx);
 void sha256_update(SHA256_CTX *ctx, const uint8_t data[], size_t len);
 void sha256_final(SHA256_CTX *ctx, uint8_t hash[]);
+void sha256_batch(
+    const uint8_t *const data[], const size_t lens[], size_t count,
+    uint8_t *hashes
+);
 
 #endif   // SHA256_H
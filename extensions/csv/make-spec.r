@@ -0,0 +1,13 @@
+REBOL []
+
+name: 'CSV
+source: %csv/mod-csv.c
+includes: [
+    %prep/extensions/csv  ; for %tmp-ext-csv-init.inc
+
+    ; Numeric columns are made as VECTOR!s directly, through the internal
+    ; includes of the type (as the FFI does).  So the vector extension must
+    ; be built into the executable to use this one.
+    ;
+    %../extensions/vector
+]
@@ -0,0 +1,596 @@
+//
+//  File: %mod-csv.c
+//  Summary: "Native CSV and TSV decoder, with row or columnar output"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2019 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See %extensions/csv/README.md
+//
+// Fields are read as RFC 4180 describes: a field in double quotes may hold
+// delimiters, line breaks and doubled `""` quotes, anything else runs up to
+// the next delimiter or line break.  Lines may end in LF, CR LF or CR.
+//
+// Rows are decoded as a BLOCK! of TEXT! fields, gathered on the data stack
+// so each block is made at its final size.  Columnar decoding makes two
+// passes instead.  The first only scans, to count the rows and see which
+// columns hold nothing but numbers.  The second fills series allocated at
+// their final size: a 64-bit VECTOR! for each numeric column (so a number
+// costs 8 bytes, and no cell or series) and a BLOCK! of TEXT! for the rest.
+//
+// The bytes that end an unquoted field--the delimiter, CR and LF--are all
+// ASCII, so they are found bytewise in the UTF-8, 16 bytes a step with SSE2.
+//
+
+#include "sys-core.h"
+
+#include "tmp-mod-csv.h"
+
+#include "sys-vector.h"
+
+
+#if !defined(REBOL_NO_STRING_SIMD) && (defined(__SSE2__) \
+    || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+
+    #define CSV_SIMD_SSE2
+    #include <emmintrin.h>
+
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+
+    inline static unsigned int Lowest_Bit(unsigned int mask) {
+        unsigned long i;
+        _BitScanForward(&i, mask);
+        return i;
+    }
+  #else
+    #define Lowest_Bit(mask) \
+        cast(unsigned int, __builtin_ctz(mask))
+  #endif
+#endif
+
+#define Is_Csv_Digit(b) \
+    ((b) >= '0' and (b) <= '9')
+
+
+// Return the first `byte`, CR or LF in [cp, ep), else `ep`.
+//
+static const REBYTE *Csv_Find_Break(
+    const REBYTE *cp,
+    const REBYTE *ep,
+    REBYTE byte
+){
+  #if defined(CSV_SIMD_SSE2)
+    const __m128i target = _mm_set1_epi8(cast(char, byte));
+    const __m128i cr = _mm_set1_epi8(CR);
+    const __m128i lf = _mm_set1_epi8(LF);
+    for (; ep - cp >= 16; cp += 16) {
+        __m128i v = _mm_loadu_si128(cast(const __m128i*, cp));
+        __m128i hits = _mm_or_si128(
+            _mm_cmpeq_epi8(v, target),
+            _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf))
+        );
+        int mask = _mm_movemask_epi8(hits);
+        if (mask != 0)
+            return cp + Lowest_Bit(mask);
+    }
+  #endif
+
+    for (; cp != ep; ++cp)
+        if (*cp == byte or *cp == CR or *cp == LF)
+            return cp;
+    return ep;
+}
+
+inline static const REBYTE *Csv_Find_Quote(const REBYTE *cp, const REBYTE *ep)
+  { return cast(const REBYTE*, memchr(cp, '"', ep - cp)); }
+
+
+// Return the CR or LF that ends the row starting at `cp`, or nullptr if the
+// data stops first.  Line breaks inside quoted fields don't end the row.
+// (A doubled `""` reads as a close and reopen, so it needs no special case.)
+//
+static const REBYTE *Csv_Find_Row_End(const REBYTE *cp, const REBYTE *ep)
+{
+    while ((cp = Csv_Find_Break(cp, ep, '"')) != ep) {
+        if (*cp != '"')
+            return cp;
+
+        const REBYTE *close = Csv_Find_Quote(cp + 1, ep);
+        if (not close)
+            return nullptr;
+        cp = close + 1;
+    }
+    return nullptr;
+}
+
+
+//=//// FIELDS ////////////////////////////////////////////////////////////=//
+
+struct Csv_Scanner {
+    const REBYTE *bp;
+    const REBYTE *ep;
+    REBYTE delimiter;
+};
+
+enum Reb_Csv_End {
+    CSV_END_DELIMITER,  // another field follows in the row
+    CSV_END_LINE,
+    CSV_END_DATA
+};
+
+struct Csv_Field {
+    const REBYTE *head;  // inside the quotes, if it was quoted
+    const REBYTE *tail;
+    bool doubled_quotes;  // has `""` in it, so must be unescaped
+};
+
+static void Csv_Skip_Blank_Lines(struct Csv_Scanner *sc) {
+    while (sc->bp != sc->ep and (*sc->bp == CR or *sc->bp == LF))
+        ++sc->bp;
+}
+
+static enum Reb_Csv_End Csv_Scan_Field(
+    struct Csv_Scanner *sc,
+    struct Csv_Field *f
+){
+    const REBYTE *cp = sc->bp;
+    const REBYTE *ep = sc->ep;
+
+    f->doubled_quotes = false;
+
+    if (cp != ep and *cp == '"') {
+        f->head = ++cp;
+        while (true) {
+            cp = Csv_Find_Quote(cp, ep);
+            if (not cp)
+                fail ("CSV quoted field has no closing quote");
+            if (cp + 1 == ep or cp[1] != '"')
+                break;
+            f->doubled_quotes = true;
+            cp += 2;
+        }
+        f->tail = cp++;
+
+        if (
+            cp != ep
+            and *cp != sc->delimiter and *cp != CR and *cp != LF
+        ){
+            fail ("CSV quoted field is followed by more than a delimiter");
+        }
+    }
+    else {
+        f->head = cp;
+        cp = Csv_Find_Break(cp, ep, sc->delimiter);
+        f->tail = cp;
+    }
+
+    if (cp == ep) {
+        sc->bp = cp;
+        return CSV_END_DATA;
+    }
+    if (*cp == sc->delimiter) {
+        sc->bp = cp + 1;
+        return CSV_END_DELIMITER;
+    }
+    if (*cp == CR and cp + 1 != ep and cp[1] == LF)
+        ++cp;
+    sc->bp = cp + 1;
+    return CSV_END_LINE;
+}
+
+static REBSTR *Csv_Field_Text(const struct Csv_Field *f)
+{
+    if (not f->doubled_quotes)
+        return Append_UTF8_May_Fail(
+            nullptr,
+            cs_cast(f->head),
+            f->tail - f->head,
+            STRMODE_ALL_CODEPOINTS
+        );
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    const REBYTE *cp = f->head;
+    while (true) {
+        const REBYTE *quote = Csv_Find_Quote(cp, f->tail);
+        const REBYTE *run_end = quote ? quote + 1 : f->tail;  // one of `""`
+        Append_UTF8_May_Fail(
+            mo->series, cs_cast(cp), run_end - cp, STRMODE_ALL_CODEPOINTS
+        );
+        if (not quote)
+            break;
+        cp = quote + 2;
+    }
+
+    return Pop_Molded_String(mo);
+}
+
+static void Csv_Push_Row(struct Csv_Scanner *sc)
+{
+    REBDSP dsp_orig = DSP;
+
+    struct Csv_Field f;
+    enum Reb_Csv_End end;
+    do {
+        end = Csv_Scan_Field(sc, &f);
+        REBSTR *s = Csv_Field_Text(&f);
+        Init_Text(DS_PUSH(), s);
+    } while (end == CSV_END_DELIMITER);
+
+    REBARR *row = Pop_Stack_Values_Core(dsp_orig, NODE_FLAG_MANAGED);
+    Init_Block(DS_PUSH(), row);
+}
+
+static REBYTE Csv_Delimiter(const REBVAL *arg)
+{
+    if (IS_NULLED(arg))
+        return ',';
+
+    REBUNI c = VAL_CHAR(arg);
+    if (c >= 0x80 or c == '"' or c == CR or c == LF or c == '\0')
+        fail (arg);  // must be one byte of UTF-8, and not otherwise special
+    return cast(REBYTE, c);
+}
+
+static void Init_Csv_Scanner(struct Csv_Scanner *sc, const REBVAL *data)
+{
+    REBSIZ size;
+    sc->bp = VAL_BYTES_AT(&size, data);
+    sc->ep = sc->bp + size;
+
+    if (
+        size >= 3
+        and sc->bp[0] == 0xEF and sc->bp[1] == 0xBB and sc->bp[2] == 0xBF
+    ){
+        sc->bp += 3;  // tolerate a UTF-8 byte order mark
+    }
+}
+
+
+//=//// COLUMNS ///////////////////////////////////////////////////////////=//
+
+// Ordered so a column's kind is the greatest kind of any of its fields.
+//
+enum Reb_Csv_Kind {
+    CSV_KIND_INTEGER,
+    CSV_KIND_DECIMAL,
+    CSV_KIND_TEXT
+};
+
+// Only plain forms count as numbers: optional sign, digits with an optional
+// `.` fraction, and an optional exponent.  No spaces, `'` or `,` separators.
+//
+static enum Reb_Csv_Kind Csv_Field_Kind(const struct Csv_Field *f)
+{
+    const REBYTE *cp = f->head;
+    const REBYTE *ep = f->tail;
+
+    if (f->doubled_quotes or ep - cp > MAX_NUM_LEN)
+        return CSV_KIND_TEXT;
+
+    if (cp != ep and (*cp == '+' or *cp == '-'))
+        ++cp;
+
+    const REBYTE *digits = cp;
+    REBU64 u = 0;
+    bool overflow = false;
+    for (; cp != ep and Is_Csv_Digit(*cp); ++cp) {
+        if (u > (UINT64_MAX - 9) / 10)
+            overflow = true;
+        else
+            u = u * 10 + (*cp - '0');
+    }
+    bool whole = (cp != digits);
+
+    if (cp == ep) {
+        if (not whole)
+            return CSV_KIND_TEXT;
+        if (overflow or u > INT64_MAX)
+            return CSV_KIND_DECIMAL;
+        return CSV_KIND_INTEGER;
+    }
+
+    bool fraction = false;
+    if (*cp == '.') {
+        const REBYTE *fraction_head = ++cp;
+        while (cp != ep and Is_Csv_Digit(*cp))
+            ++cp;
+        fraction = (cp != fraction_head);
+    }
+    if (not whole and not fraction)
+        return CSV_KIND_TEXT;
+
+    if (cp != ep and (*cp == 'e' or *cp == 'E')) {
+        ++cp;
+        if (cp != ep and (*cp == '+' or *cp == '-'))
+            ++cp;
+        if (cp == ep or not Is_Csv_Digit(*cp))
+            return CSV_KIND_TEXT;
+        while (cp != ep and Is_Csv_Digit(*cp))
+            ++cp;
+    }
+
+    return cp == ep ? CSV_KIND_DECIMAL : CSV_KIND_TEXT;
+}
+
+// Only called on fields Csv_Field_Kind() said were CSV_KIND_INTEGER.
+//
+static REBI64 Csv_Field_Integer(const struct Csv_Field *f)
+{
+    const REBYTE *cp = f->head;
+    bool negative = (*cp == '-');
+    if (*cp == '+' or *cp == '-')
+        ++cp;
+
+    REBU64 u = 0;
+    for (; cp != f->tail; ++cp)
+        u = u * 10 + (*cp - '0');
+    return negative ? cast(REBI64, ~u + 1) : cast(REBI64, u);
+}
+
+// Only called on fields Csv_Field_Kind() said were numbers.
+//
+static REBDEC Csv_Field_Decimal(const struct Csv_Field *f)
+{
+    REBLEN len = f->tail - f->head;
+    REBYTE buf[MAX_NUM_LEN + 1];  // Scan_Decimal() needs a terminator
+    memcpy(buf, f->head, len);
+    buf[len] = '\0';
+
+    DECLARE_LOCAL (temp);
+    if (not Scan_Decimal(temp, buf, len, true))
+        fail (Error_Bad_Media_Raw());  // e.g. out of range
+    return VAL_DECIMAL(temp);
+}
+
+static REBVAL *Csv_Decode_Columns(
+    REBVAL *out,
+    const struct Csv_Scanner *start,
+    bool header
+){
+    // First pass: count the rows and find each column's kind, making no
+    // values.  The number of columns comes from the first row.
+    //
+    REBSER *kinds = Make_Series(16, sizeof(REBYTE));
+    REBLEN num_columns = 0;
+    REBLEN num_rows = 0;
+    bool columns_known = false;
+
+    struct Csv_Scanner sc = *start;
+    struct Csv_Field f;
+    enum Reb_Csv_End end;
+
+    Csv_Skip_Blank_Lines(&sc);
+    while (sc.bp != sc.ep) {
+        REBLEN col = 0;
+        do {
+            end = Csv_Scan_Field(&sc, &f);
+            if (not columns_known) {
+                EXPAND_SERIES_TAIL(kinds, 1);
+                *SER_AT(REBYTE, kinds, col) = CSV_KIND_INTEGER;
+                num_columns = col + 1;
+            }
+            else if (col == num_columns)
+                fail ("CSV row has more fields than the first row");
+
+            if (not (header and not columns_known)) {
+                REBYTE kind = Csv_Field_Kind(&f);
+                if (kind > *SER_AT(REBYTE, kinds, col))
+                    *SER_AT(REBYTE, kinds, col) = kind;
+            }
+            ++col;
+        } while (end == CSV_END_DELIMITER);
+
+        if (col != num_columns)
+            fail ("CSV row has fewer fields than the first row");
+
+        if (columns_known or not header)
+            ++num_rows;
+        columns_known = true;
+        Csv_Skip_Blank_Lines(&sc);
+    }
+
+    // Second pass: the header names go to the stack, then a column for each.
+    // Numeric columns are filled in as BINARY! and become vectors at the end.
+    //
+    REBDSP dsp_orig = DSP;
+    sc = *start;
+    Csv_Skip_Blank_Lines(&sc);
+
+    if (header and sc.bp != sc.ep) {
+        do {
+            end = Csv_Scan_Field(&sc, &f);
+            REBSTR *name = Csv_Field_Text(&f);
+            Init_Text(DS_PUSH(), name);
+        } while (end == CSV_END_DELIMITER);
+        Csv_Skip_Blank_Lines(&sc);
+    }
+
+    REBDSP dsp_columns = DSP;
+    REBLEN col;
+    for (col = 0; col < num_columns; ++col) {
+        if (num_rows == 0 or *SER_AT(REBYTE, kinds, col) == CSV_KIND_TEXT)
+            Init_Block(DS_PUSH(), Make_Array(num_rows));
+        else {
+            REBSER *bin = Make_Binary(num_rows * 8);
+            SET_SERIES_LEN(bin, num_rows * 8);
+            TERM_SERIES(bin);
+            Init_Binary(DS_PUSH(), bin);
+        }
+    }
+
+    REBLEN row;
+    for (row = 0; row < num_rows; ++row) {
+        col = 0;
+        do {
+            end = Csv_Scan_Field(&sc, &f);
+            REBVAL *column = DS_AT(dsp_columns + 1 + col);
+            if (IS_BLOCK(column)) {
+                REBSTR *s = Csv_Field_Text(&f);
+                Init_Text(Alloc_Tail_Array(VAL_ARRAY(column)), s);
+            }
+            else if (*SER_AT(REBYTE, kinds, col) == CSV_KIND_INTEGER) {
+                REBI64 i = Csv_Field_Integer(&f);
+                memcpy(BIN_AT(VAL_SERIES(column), row * 8), &i, 8);
+            }
+            else {
+                REBDEC d = Csv_Field_Decimal(&f);
+                memcpy(BIN_AT(VAL_SERIES(column), row * 8), &d, 8);
+            }
+            ++col;
+        } while (end == CSV_END_DELIMITER);
+        Csv_Skip_Blank_Lines(&sc);
+    }
+
+    REBARR *result = Make_Array(header ? num_columns * 2 : num_columns);
+    for (col = 0; col < num_columns; ++col) {
+        REBVAL *column = DS_AT(dsp_columns + 1 + col);
+        if (IS_BINARY(column)) {
+            const bool sign = true;
+            bool integral = (*SER_AT(REBYTE, kinds, col) == CSV_KIND_INTEGER);
+            Init_Vector(column, VAL_SERIES(column), sign, integral, 64);
+        }
+        if (header)
+            Move_Value(Alloc_Tail_Array(result), DS_AT(dsp_orig + 1 + col));
+        Move_Value(Alloc_Tail_Array(result), column);
+    }
+
+    DS_DROP_TO(dsp_orig);
+    Free_Unmanaged_Series(kinds);
+    return Init_Block(out, result);
+}
+
+
+//=//// NATIVES ///////////////////////////////////////////////////////////=//
+
+//
+//  export decode-csv: native [
+//
+//  {Codec for decoding CSV (or TSV) into rows, or into columns}
+//
+//      return: "Block of row blocks, or of columns with /COLUMNS"
+//          [block!]
+//      data "UTF-8 text"
+//          [binary! text!]
+//      /delimiter "Field separator (default is comma)"
+//          [char!]
+//      /columns "Give a VECTOR! per numeric column, BLOCK! of TEXT! per other"
+//      /header "First row names the columns, give `name column` pairs"
+//  ]
+//
+REBNATIVE(decode_csv)
+//
+// Blank lines are skipped, rather than read as rows of one empty field.
+{
+    CSV_INCLUDE_PARAMS_OF_DECODE_CSV;
+
+    if (REF(header) and not REF(columns))
+        fail (Error_Bad_Refines_Raw());
+
+    struct Csv_Scanner sc;
+    Init_Csv_Scanner(&sc, ARG(data));
+    sc.delimiter = Csv_Delimiter(ARG(delimiter));
+
+    if (REF(columns))
+        return Csv_Decode_Columns(D_OUT, &sc, did REF(header));
+
+    REBDSP dsp_orig = DSP;
+    Csv_Skip_Blank_Lines(&sc);
+    while (sc.bp != sc.ep) {
+        Csv_Push_Row(&sc);
+        Csv_Skip_Blank_Lines(&sc);
+    }
+    REBARR *rows = Pop_Stack_Values_Core(dsp_orig, NODE_FLAG_MANAGED);
+    return Init_Block(D_OUT, rows);
+}
+
+
+//
+//  export decode-csv-row: native [
+//
+//  {Decode the next row of CSV (or TSV) from data that comes in parts}
+//
+//      return: "Position after the row, null if DATA doesn't hold all of it"
+//          [<opt> binary!]
+//      var "Set to a BLOCK! of TEXT! fields, or null at the end of input"
+//          [any-word!]
+//      data [binary!]
+//      /last "DATA is the rest of the input (last row needn't end in newline)"
+//      /delimiter "Field separator (default is comma)"
+//          [char!]
+//  ]
+//
+REBNATIVE(decode_csv_row)
+//
+// A row is only decoded once the line break after it has been found outside
+// of quotes.  So a null return can always be answered by appending more data
+// and calling again at the same position.
+{
+    CSV_INCLUDE_PARAMS_OF_DECODE_CSV_ROW;
+
+    const REBYTE *head = VAL_BIN_HEAD(ARG(data));
+
+    struct Csv_Scanner sc;
+    sc.bp = VAL_BIN_AT(ARG(data));
+    sc.ep = sc.bp + VAL_LEN_AT(ARG(data));
+    sc.delimiter = Csv_Delimiter(ARG(delimiter));
+
+    if (sc.bp == head and sc.ep - sc.bp >= 3) {
+        if (sc.bp[0] == 0xEF and sc.bp[1] == 0xBB and sc.bp[2] == 0xBF)
+            sc.bp += 3;  // byte order mark at the start of input
+    }
+
+    Csv_Skip_Blank_Lines(&sc);
+    if (sc.bp == sc.ep) {
+        if (not REF(last))
+            return nullptr;
+        Init_Nulled(Sink_Var_May_Fail(ARG(var), SPECIFIED));
+        Move_Value(D_OUT, ARG(data));
+        VAL_INDEX(D_OUT) = sc.ep - head;
+        return D_OUT;
+    }
+
+    const REBYTE *row_end = Csv_Find_Row_End(sc.bp, sc.ep);
+    if (not row_end) {
+        if (not REF(last))
+            return nullptr;
+        row_end = sc.ep;
+    }
+    else if (*row_end == CR and row_end + 1 == sc.ep and not REF(last))
+        return nullptr;  // might be the CR of a CR LF split between parts
+
+    const REBYTE *ep = sc.ep;
+    sc.ep = row_end;
+    Csv_Push_Row(&sc);
+    assert(sc.bp == row_end);
+
+    if (row_end != ep) {  // step over the line break
+        if (*row_end == CR and row_end + 1 != ep and row_end[1] == LF)
+            ++row_end;
+        ++row_end;
+    }
+
+    Move_Value(Sink_Var_May_Fail(ARG(var), SPECIFIED), DS_TOP);
+    DS_DROP();
+
+    Move_Value(D_OUT, ARG(data));
+    VAL_INDEX(D_OUT) = row_end - head;
+    return D_OUT;
+}
@@ -367,3 +367,99 @@ REBNATIVE(step)
     //
     return thrown;
 }
+
+
+// Breakpoints set with SET-BREAKPOINT are checked by the core only in the
+// arrays that have them (see Step_Hooks_Throws()), so unlike STEP this hook
+// is not swapped in for the whole evaluator.  It doesn't break again while a
+// breakpoint's console session is running, as the console's own code may
+// pass through a breakpoint.
+//
+static bool In_Breakpoint_Hook = false;
+
+bool Breakpoint_Step_Hook_Throws(REBFRM * const f)
+{
+    if (In_Breakpoint_Hook)
+        return false;
+
+    In_Breakpoint_Hook = true;
+    REBVAL *r = rebRescue(&Spawn_Interrupt_Dangerous, f);
+    In_Breakpoint_Hook = false;
+
+    if (r == R_THROWN)
+        return true;
+
+    if (r)  // an error from the interrupt, not from the code being debugged
+        rebJumps("fail", rebR(r), rebEND);
+
+    return false;
+}
+
+
+//
+//  export set-breakpoint: native [
+//
+//  {Break into the debugger before the expression at a position is run}
+//
+//      return: "False if there was already a breakpoint at the position"
+//          [logic!]
+//      position "Position in code, e.g. from FIND on a function's body"
+//          [block! group!]
+//  ]
+//
+REBNATIVE(set_breakpoint)
+{
+    DEBUGGER_INCLUDE_PARAMS_OF_SET_BREAKPOINT;
+
+    REBVAL *position = ARG(position);
+    if (VAL_INDEX(position) >= VAL_LEN_HEAD(position))
+        fail (PAR(position));  // no expression can start at the tail
+
+    Set_Breakpoint_Hook(&Breakpoint_Step_Hook_Throws);
+
+    return Init_Logic(
+        D_OUT,
+        Add_Breakpoint(VAL_ARRAY(position), VAL_INDEX(position))
+    );
+}
+
+
+//
+//  export clear-breakpoint: native [
+//
+//  {Remove a breakpoint set with SET-BREAKPOINT}
+//
+//      return: "False if there wasn't a breakpoint at the position"
+//          [logic!]
+//      position [block! group!]
+//  ]
+//
+REBNATIVE(clear_breakpoint)
+{
+    DEBUGGER_INCLUDE_PARAMS_OF_CLEAR_BREAKPOINT;
+
+    REBVAL *position = ARG(position);
+    return Init_Logic(
+        D_OUT,
+        Remove_Breakpoint(VAL_ARRAY(position), VAL_INDEX(position))
+    );
+}
+
+
+//
+//  export breakpoints: native [
+//
+//  {Positions of the breakpoints set with SET-BREAKPOINT}
+//
+//      return: [block!]
+//  ]
+//
+REBNATIVE(breakpoints)
+{
+    DEBUGGER_INCLUDE_PARAMS_OF_BREAKPOINTS;
+
+    return Init_Block(
+        D_OUT,
+        Copy_Array_Shallow(VAL_ARRAY(Root_Breakpoints), SPECIFIED)
+    );
+}
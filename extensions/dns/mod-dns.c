@@ -96,6 +96,7 @@ static REB_R DNS_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
 
         UNUSED(PAR(string)); // handled in dispatcher
         UNUSED(PAR(lines)); // handled in dispatcher
+        UNUSED(PAR(into)); // handled in dispatcher
 
         if (not (sock->flags & RRF_OPEN))
             OS_DO_DEVICE_SYNC(req, RDC_OPEN);  // e.g. to call WSAStartup()
@@ -40,6 +40,7 @@
 #include <stdlib.h>
 #include <sys/time.h>
 #include <sys/wait.h>
+#include <poll.h>
 #include <errno.h>
 
 #include "sys-core.h"
@@ -105,6 +106,61 @@ DEVICE_CMD Init_Events(REBREQ *dr)
 }
 
 
+//
+//  Gather_Pending_Sockets: C
+//
+// Fill in `fds` with the sockets that pending requests on RDF_SOCKETS
+// devices are waiting on, returning how many there are.  Pass a null `fds`
+// to just count them.
+//
+static nfds_t Gather_Pending_Sockets(struct pollfd *fds)
+{
+    nfds_t n = 0;
+
+    REBDEV *dev = PG_Device_List;
+    for (; dev != nullptr; dev = dev->next) {
+        if (not (dev->flags & RDF_SOCKETS))
+            continue;
+
+        REBREQ *req = dev->pending;
+        for (; req; req = NextReq(req)) {
+            struct rebol_devreq *r = Req(req);
+            if (r->requestee.socket < 0)
+                continue;
+
+            short events;
+            switch (r->command) {
+              case RDC_READ:
+              case RDC_CREATE:  // accept is readiness to read on listener
+                events = POLLIN;
+                break;
+
+              case RDC_WRITE:
+              case RDC_CONNECT:  // connect completes as writability
+                events = POLLOUT;
+                break;
+
+              case RDC_LOOKUP:  // socket is a pipe the resolver writes to
+                events = POLLIN;
+                break;
+
+              default:
+                continue;
+            }
+
+            if (fds) {
+                fds[n].fd = r->requestee.socket;
+                fds[n].events = events;
+                fds[n].revents = 0;
+            }
+            ++n;
+        }
+    }
+
+    return n;
+}
+
+
 //
 //  Query_Events: C
 //
@@ -112,16 +168,37 @@ DEVICE_CMD Init_Events(REBREQ *dr)
 // req->length. The latter is used by WAIT as the main timing
 // method.
 //
+// Rather than sleeping blindly, this waits on the sockets of pending network
+// requests, so WAIT wakes as soon as one is ready instead of at the end of
+// its polling interval.  Poll_Default() still retries every pending request
+// when it does wake.
+//
+// !!! epoll and kqueue would only beat poll() here if devices were told
+// which requests were ready, instead of retrying them all.  Until then, the
+// registrations would have to be rebuilt from the pending lists each time.
+//
 DEVICE_CMD Query_Events(REBREQ *req)
 {
-    struct timeval tv;
-    int result;
+    int timeout = cast(int, Req(req)->length);
+
+    struct pollfd stack_fds[16];
+    struct pollfd *fds = stack_fds;
+
+    nfds_t n = Gather_Pending_Sockets(nullptr);
+    if (n > sizeof(stack_fds) / sizeof(stack_fds[0])) {
+        fds = cast(struct pollfd*, malloc(sizeof(struct pollfd) * n));
+        if (not fds)
+            rebFail_OS (ENOMEM);
+    }
+    if (n != 0)
+        n = Gather_Pending_Sockets(fds);
+
+    int result = poll(n == 0 ? nullptr : fds, n, timeout);
+    int errnum = errno;
 
-    tv.tv_sec = 0;
-    tv.tv_usec = Req(req)->length * 1000;
-    //printf("usec %d\n", tv.tv_usec);
+    if (fds != stack_fds)
+        free(fds);
 
-    result = select(0, 0, 0, 0, &tv);
     if (result < 0) {
         //
         // !!! In R3-Alpha this had a TBD that said "set error code" and had a
@@ -129,10 +206,10 @@ DEVICE_CMD Query_Events(REBREQ *req)
         // Ctrl-C interrupts a timer on a WAIT.  As a patch this is tolerant
         // of EINTR, but still returns the error code.  :-/
         //
-        if (errno == EINTR)
+        if (errnum == EINTR)
             return DR_DONE;
 
-        rebFail_OS (errno);
+        rebFail_OS (errnum);
     }
 
     return DR_DONE;
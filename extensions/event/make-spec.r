@@ -7,6 +7,7 @@ includes: [%prep/extensions/event]
 depends: compose [
     %event/t-event.c
     %event/p-event.c
+    %event/timer-wheel.c
 
     (switch system-config/os-base [
         'Windows [
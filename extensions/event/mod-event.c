@@ -63,6 +63,7 @@ REBNATIVE(register_event_hooks)
     Builtin_Type_Hooks[k][IDX_MOLD_HOOK] = cast(CFUNC*, &MF_Event);
 
     Startup_Event_Scheme();
+    Startup_Timers();
 
     return Init_Void(D_OUT);
 }
@@ -80,6 +81,7 @@ REBNATIVE(unregister_event_hooks)
 {
     EVENT_INCLUDE_PARAMS_OF_UNREGISTER_EVENT_HOOKS;
 
+    Shutdown_Timers();
     Shutdown_Event_Scheme();
 
     // !!! See notes in register-event-hooks for why we reach below the
@@ -244,6 +246,12 @@ int Wait_For_Device_Events_Interruptible(
 //     out is LOGIC! TRUE when port action happened, or FALSE for timeout
 //     if a throw happens, out will be the thrown value and returns TRUE
 //
+// !!! This blocks the whole interpreter, with AWAKE handlers as the only way
+// to interleave work on several ports.  Straight-line ASYNC code that gives
+// up control when a read or write would block needs frames that can be
+// suspended and resumed from here, which the evaluator can't do yet (see
+// the notes at the top of %c-eval.c).
+//
 bool Wait_Ports_Throws(
     REBVAL *out,
     REBARR *ports,
@@ -278,10 +286,17 @@ bool Wait_Ports_Throws(
             fail ("BREAKPOINT from SIG_INTERRUPT not currently implemented");
         }
 
+        // Run the code of any timers that are due:
+        if (Run_Timers_Throws(out))
+            return true;  // thrown
+
         REBINT ret;
 
-        // Process any waiting events:
-        if ((ret = Awake_System(ports, only)) > 0) {
+        // Process any waiting events (the AWAKE of the system port is only
+        // run if there are some, or if it has woken up ports):
+        if (not Events_Pending())
+            ret = -1;
+        else if ((ret = Awake_System(ports, only)) > 0) {
             Move_Value(out, TRUE_VALUE); // port action happened
             return false; // not thrown
         }
@@ -310,7 +325,10 @@ bool Wait_Ports_Throws(
 
         //printf("%d %d %d\n", dt, time, timeout);
 
-        Wait_For_Device_Events_Interruptible(wt, res);
+        // Don't sleep past a timer coming due (but don't change `wt`, as a
+        // zero would end the loop)
+        //
+        Wait_For_Device_Events_Interruptible(Next_Timer_Ms(wt), res);
     }
 
     //time = (REBLEN)Delta_Time(base);
@@ -430,6 +448,76 @@ REBNATIVE(wait)
 }
 
 
+//
+//  export schedule: native [
+//
+//  {Run code after a delay (or every so often) while WAIT is waiting}
+//
+//      return: "ID of the timer, for CANCEL"
+//          [integer!]
+//      delay "Seconds if a number, as for WAIT"
+//          [any-number! time!]
+//      code "Block to DO, or action to run with no arguments"
+//          [block! action!]
+//      /repeat "Run the code every DELAY until canceled"
+//  ]
+//
+REBNATIVE(schedule)
+{
+    EVENT_INCLUDE_PARAMS_OF_SCHEDULE;
+
+    REBLEN delay = Milliseconds_From_Value(ARG(delay));
+    if (REF(repeat) and delay == 0)
+        fail (Error_Out_Of_Range(ARG(delay)));
+
+    return Init_Integer(
+        D_OUT,
+        Schedule_Timer(ARG(code), delay, did REF(repeat))
+    );
+}
+
+
+//
+//  export cancel: native [
+//
+//  {Stop code given to SCHEDULE from being run}
+//
+//      return: "False if there is no such timer (e.g. the code ran already)"
+//          [logic!]
+//      timer "ID returned by SCHEDULE"
+//          [integer!]
+//  ]
+//
+REBNATIVE(cancel)
+{
+    EVENT_INCLUDE_PARAMS_OF_CANCEL;
+
+    return Init_Logic(D_OUT, Cancel_Timer(VAL_INT64(ARG(timer))));
+}
+
+
+//
+//  take-event: native [
+//
+//  {Take the oldest event out of the queue of an event port}
+//
+//      return: "NULL if there are no events (for the given ports)"
+//          [<opt> event!]
+//      port "Event port, e.g. SYSTEM/PORTS/SYSTEM"
+//          [port!]
+//      /for "Only take an event for one of these ports"
+//          [block!]
+//  ]
+//
+REBNATIVE(take_event)
+{
+    EVENT_INCLUDE_PARAMS_OF_TAKE_EVENT;
+
+    REBARR *ports = REF(for) ? VAL_ARRAY(ARG(for)) : nullptr;
+    return Take_Event(D_OUT, ARG(port), ports);
+}
+
+
 //
 //  export wake-up: native [
 //
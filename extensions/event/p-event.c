@@ -55,6 +55,161 @@
 
 #define EVENTS_LIMIT 0xFFFF //64k
 #define EVENTS_CHUNK 128
+#define EVENTS_COALESCE_SCAN 8  // how far back to look for an event to merge
+
+
+//=//// EVENT QUEUE ///////////////////////////////////////////////////////=//
+//
+// The state of an event port is a BLOCK! whose array is a ring buffer.  The
+// oldest event is at the offset in the array's LINK(), and the number of
+// queued events is in its MISC().  Every cell of the array is used (slots
+// without an event are BLANK!), so the GC marks the events wherever they are
+// in the ring.  Adding an event or taking the oldest one is O(1).
+//
+// If the ring fills up it is doubled in size, up to EVENTS_LIMIT events.
+//
+// An event that would be redundant with one already queued is merged into
+// that one instead of being added.  This is done for GUI events that just
+// report where something got to (like MOVE or RESIZE), where the newer data
+// replaces the older.  It's also done for a port's READ and WROTE events, as
+// the port's AWAKE handler looks at the port and not at the event.  Events
+// are only merged if no other event for the same target came in between, so
+// a target never sees its events in a different order.
+//
+
+#define EVENT_QUEUE_HEAD(a) \
+    LINK(a).custom.u
+
+#define EVENT_QUEUE_COUNT(a) \
+    MISC(a).custom.u
+
+static REBARR *Make_Event_Queue(REBLEN capacity)
+{
+    REBARR *a = Make_Array_Core(capacity, SERIES_FLAGS_NONE);
+
+    REBLEN n;
+    for (n = 0; n < capacity; ++n)
+        Init_Blank(ARR_AT(a, n));
+    TERM_ARRAY_LEN(a, capacity);
+
+    EVENT_QUEUE_HEAD(a) = 0;
+    EVENT_QUEUE_COUNT(a) = 0;
+    return a;
+}
+
+// The nth queued event, counting from 0 for the oldest.
+//
+inline static RELVAL *Event_Queue_At(REBARR *a, REBLEN n) {
+    assert(n < EVENT_QUEUE_COUNT(a));
+    return ARR_AT(a, (EVENT_QUEUE_HEAD(a) + n) % ARR_LEN(a));
+}
+
+// The queue array of an event port, or nullptr if it has none yet.
+//
+static REBARR *Event_Queue_Of_Port(const REBVAL *port)
+{
+    if (not IS_PORT(port))
+        return nullptr;
+
+    REBVAL *state = VAL_CONTEXT_VAR(port, STD_PORT_STATE);
+    if (not IS_BLOCK(state))
+        return nullptr;
+
+    return VAL_ARRAY(state);
+}
+
+
+// The varlist of the PORT! an event is for (or of the OBJECT!, for the
+// EVM_OBJECT model), if any.  This is what says which events go with the
+// ports given to WAIT.
+//
+static REBNOD *Event_Port_Node(const RELVAL *event)
+{
+    REBVAL *port;
+
+    switch (VAL_EVENT_MODEL(event)) {
+      case EVM_PORT:
+      case EVM_OBJECT:
+        return VAL_EVENT_NODE(event);
+
+      case EVM_DEVICE: {
+        REBREQ *req = cast(REBREQ*, VAL_EVENT_NODE(event));
+        if (not req or not ReqPortCtx(req))
+            return nullptr;
+        return NOD(CTX_VARLIST(CTX(ReqPortCtx(req)))); }
+
+      case EVM_GUI:
+        port = Get_System(SYS_VIEW, VIEW_EVENT_PORT);
+        break;
+
+      case EVM_CALLBACK:
+        port = Get_System(SYS_PORTS, PORTS_CALLBACK);
+        break;
+
+      default:
+        return nullptr;
+    }
+
+    if (not IS_PORT(port))
+        return nullptr;
+    return NOD(CTX_VARLIST(VAL_CONTEXT(port)));
+}
+
+
+// All GUI events go to the same port, so they are told apart by the GOB!.
+//
+static bool Same_Event_Target(const RELVAL *a, const RELVAL *b)
+{
+    if (VAL_EVENT_MODEL(a) != VAL_EVENT_MODEL(b))
+        return false;
+
+    if (VAL_EVENT_MODEL(a) == EVM_GUI)
+        return VAL_EVENT_NODE(a) == VAL_EVENT_NODE(b);
+
+    return Event_Port_Node(a) == Event_Port_Node(b);
+}
+
+
+static bool Is_Coalescing_Event_Type(REBSYM type)
+{
+    switch (type) {
+      case SYM_MOVE:
+      case SYM_RESIZE:
+      case SYM_OFFSET:
+      case SYM_READ:
+      case SYM_WROTE:
+        return true;
+
+      default:
+        return false;
+    }
+}
+
+
+// Find a queued event that `event` can be merged into, see notes above.
+// Only the most recent few events are looked at, to keep adding O(1).
+//
+static RELVAL *Find_Coalescing_Event(REBARR *a, const RELVAL *event)
+{
+    if (not Is_Coalescing_Event_Type(VAL_EVENT_TYPE(event)))
+        return nullptr;
+
+    REBLEN n = EVENT_QUEUE_COUNT(a);
+    REBLEN stop = n > EVENTS_COALESCE_SCAN ? n - EVENTS_COALESCE_SCAN : 0;
+    while (n != stop) {
+        RELVAL *queued = Event_Queue_At(a, --n);
+        if (not Same_Event_Target(queued, event))
+            continue;
+
+        if (VAL_EVENT_TYPE(queued) != VAL_EVENT_TYPE(event))
+            return nullptr;  // something else happened to it since
+
+        return queued;
+    }
+
+    return nullptr;
+}
+
 
 //
 //  Append_Event: C
@@ -68,23 +223,143 @@
 //
 REBVAL *Append_Event(void)
 {
-    REBVAL *port = Get_System(SYS_PORTS, PORTS_SYSTEM);
-    if (!IS_PORT(port)) return 0; // verify it is a port object
+    REBARR *a = Event_Queue_Of_Port(Get_System(SYS_PORTS, PORTS_SYSTEM));
+    if (not a or EVENT_QUEUE_COUNT(a) == ARR_LEN(a))
+        return nullptr;
+
+    Note_Series_Mutation(SER(a));
+    ++EVENT_QUEUE_COUNT(a);
+
+    RELVAL *slot = Event_Queue_At(a, EVENT_QUEUE_COUNT(a) - 1);
+    return Init_Blank(slot);
+}
+
 
-    // Get queue block:
+//
+//  Enqueue_Event: C
+//
+// Add an event to the queue of an event port (or merge it into one already
+// queued), growing the queue if needed.  Returns false if the queue is at
+// EVENTS_LIMIT.
+//
+bool Enqueue_Event(REBVAL *port, const REBVAL *event)
+{
     REBVAL *state = VAL_CONTEXT_VAR(port, STD_PORT_STATE);
-    if (!IS_BLOCK(state)) return 0;
+    REBARR *a = VAL_ARRAY(state);
+
+    RELVAL *queued = Find_Coalescing_Event(a, event);
+    if (queued) {
+        Note_Series_Mutation(SER(a));
+        Move_Value(queued, event);
+        return true;
+    }
+
+    REBLEN count = EVENT_QUEUE_COUNT(a);
+    if (count == ARR_LEN(a)) {
+        if (count >= EVENTS_LIMIT)
+            return false;
+
+        REBARR *bigger = Make_Event_Queue(MIN(count * 2, EVENTS_LIMIT));
+        REBLEN n;
+        for (n = 0; n < count; ++n)
+            Move_Value(ARR_AT(bigger, n), KNOWN(Event_Queue_At(a, n)));
+        EVENT_QUEUE_COUNT(bigger) = count;
+
+        Init_Block(state, bigger);
+        a = bigger;
+    }
+    else
+        Note_Series_Mutation(SER(a));
+
+    ++EVENT_QUEUE_COUNT(a);
+    Move_Value(Event_Queue_At(a, count), event);
+    return true;
+}
+
+
+//
+//  Take_Event: C
+//
+// Take the oldest event out of the queue of an event port.  If `opt_ports`
+// is given, it's the oldest event for one of the PORT!s in that array.
+// Returns nullptr if there is no such event.
+//
+// Events other than the oldest are removed by moving the older events up one
+// slot, since the wanted event is usually near the head.
+//
+REBVAL *Take_Event(REBVAL *out, const REBVAL *port, REBARR *opt_ports)
+{
+    REBARR *a = Event_Queue_Of_Port(port);
+    if (not a or EVENT_QUEUE_COUNT(a) == 0)
+        return nullptr;
+
+    REBLEN count = EVENT_QUEUE_COUNT(a);
+    REBLEN n;
+
+    if (not opt_ports)
+        n = 0;
+    else {
+        // Color the ports black, so each event's port can be checked in O(1)
+        // instead of searching the array for it.
+        //
+        RELVAL *item;
+        for (item = ARR_HEAD(opt_ports); NOT_END(item); ++item) {
+            if (not IS_PORT(item))
+                continue;
+            REBSER *s = SER(CTX_VARLIST(VAL_CONTEXT(item)));
+            if (Is_Series_White(s))
+                Flip_Series_To_Black(s);
+        }
+
+        for (n = 0; n < count; ++n) {
+            REBNOD *node = Event_Port_Node(Event_Queue_At(a, n));
+            if (node and Is_Series_Black(SER(node)))
+                break;
+        }
 
-    // Append to tail if room:
-    if (SER_FULL(VAL_SERIES(state))) {
-        if (VAL_LEN_HEAD(state) > EVENTS_LIMIT)
-            panic (state);
+        for (item = ARR_HEAD(opt_ports); NOT_END(item); ++item) {
+            if (not IS_PORT(item))
+                continue;
+            REBSER *s = SER(CTX_VARLIST(VAL_CONTEXT(item)));
+            if (Is_Series_Black(s))
+                Flip_Series_To_White(s);
+        }
 
-        Extend_Series(VAL_SERIES(state), EVENTS_CHUNK);
+        if (n == count)
+            return nullptr;
     }
-    TERM_ARRAY_LEN(VAL_ARRAY(state), VAL_LEN_HEAD(state) + 1);
 
-    return Init_Blank(ARR_LAST(VAL_ARRAY(state)));
+    Note_Series_Mutation(SER(a));
+
+    Move_Value(out, KNOWN(Event_Queue_At(a, n)));
+    for (; n != 0; --n)
+        Move_Value(Event_Queue_At(a, n), KNOWN(Event_Queue_At(a, n - 1)));
+    Init_Blank(Event_Queue_At(a, 0));  // don't keep the event alive
+
+    EVENT_QUEUE_HEAD(a) = (EVENT_QUEUE_HEAD(a) + 1) % ARR_LEN(a);
+    --EVENT_QUEUE_COUNT(a);
+    return out;
+}
+
+
+//
+//  Events_Pending: C
+//
+// Are there events in the system port's queue, or ports it has woken up?  If
+// not, there's no need to run its AWAKE function.
+//
+bool Events_Pending(void)
+{
+    REBVAL *port = Get_System(SYS_PORTS, PORTS_SYSTEM);
+    REBARR *a = Event_Queue_Of_Port(port);
+    if (not a)
+        return false;
+
+    if (EVENT_QUEUE_COUNT(a) != 0)
+        return true;
+
+    REBVAL *waked = VAL_CONTEXT_VAR(port, STD_PORT_DATA);
+    return IS_BLOCK(waked) and VAL_LEN_HEAD(waked) != 0;
 }
 
 
@@ -96,29 +371,21 @@ REBVAL *Append_Event(void)
 //
 REBVAL *Find_Last_Event(REBINT model, uint32_t type)
 {
-    REBVAL *port;
-    RELVAL *value;
-    REBVAL *state;
-
-    port = Get_System(SYS_PORTS, PORTS_SYSTEM);
-    if (!IS_PORT(port)) return NULL; // verify it is a port object
+    REBARR *a = Event_Queue_Of_Port(Get_System(SYS_PORTS, PORTS_SYSTEM));
+    if (not a)
+        return nullptr;
 
-    // Get queue block:
-    state = VAL_CONTEXT_VAR(port, STD_PORT_STATE);
-    if (!IS_BLOCK(state)) return NULL;
-
-    value = VAL_ARRAY_TAIL(state) - 1;
-    for (; value >= VAL_ARRAY_HEAD(state); --value) {
+    REBLEN n = EVENT_QUEUE_COUNT(a);
+    while (n != 0) {
+        RELVAL *value = Event_Queue_At(a, --n);
         if (VAL_EVENT_MODEL(value) == model) {
-            if (cast(uint32_t, VAL_EVENT_TYPE(value)) == type) {
+            if (cast(uint32_t, VAL_EVENT_TYPE(value)) == type)
                 return KNOWN(value);
-            } else {
-                return NULL;
-            }
+            return nullptr;
         }
     }
 
-    return NULL;
+    return nullptr;
 }
 
 //
@@ -139,7 +406,9 @@ REB_R Event_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
     // Get or setup internal state data:
     //
     if (!IS_BLOCK(state))
-        Init_Block(state, Make_Array(EVENTS_CHUNK - 1));
+        Init_Block(state, Make_Event_Queue(EVENTS_CHUNK));
+
+    REBARR *queue = VAL_ARRAY(state);
 
     switch (VAL_WORD_SYM(verb)) {
 
@@ -152,7 +421,7 @@ REB_R Event_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
 
         switch (property) {
         case SYM_LENGTH:
-            return Init_Integer(D_OUT, VAL_LEN_HEAD(state));
+            return Init_Integer(D_OUT, EVENT_QUEUE_COUNT(queue));
 
         default:
             break;
@@ -163,46 +432,83 @@ REB_R Event_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
     case SYM_ON_WAKE_UP:
         return Init_Void(D_OUT);
 
-    // Normal block actions done on events:
-    case SYM_POKE:
-        if (not IS_EVENT(D_ARG(3)))
-            fail (D_ARG(3));
-        goto act_blk;
+    // Queue actions done on events (PICK and POKE count from the oldest):
+    case SYM_PICK: {
+        INCLUDE_PARAMS_OF_PICK;
+
+        UNUSED(ARG(location));  // implicit in port
+        if (not IS_INTEGER(ARG(picker)))
+            fail (PAR(picker));
+
+        REBINT n = VAL_INT32(ARG(picker));
+        if (n <= 0 or cast(REBLEN, n) > EVENT_QUEUE_COUNT(queue))
+            return nullptr;
+
+        return Move_Value(D_OUT, KNOWN(Event_Queue_At(queue, n - 1))); }
+
+    case SYM_POKE: {
+        INCLUDE_PARAMS_OF_POKE;
+
+        UNUSED(ARG(location));  // implicit in port
+        if (not IS_EVENT(ARG(value)))
+            fail (PAR(value));
+        if (not IS_INTEGER(ARG(picker)))
+            fail (PAR(picker));
+
+        REBINT n = VAL_INT32(ARG(picker));
+        if (n <= 0 or cast(REBLEN, n) > EVENT_QUEUE_COUNT(queue))
+            fail (Error_Out_Of_Range(ARG(picker)));
+
+        Note_Series_Mutation(SER(queue));
+        Move_Value(Event_Queue_At(queue, n - 1), ARG(value));
+        RETURN (ARG(value)); }
 
     case SYM_INSERT:
-    case SYM_APPEND:
-        if (not IS_EVENT(D_ARG(2)))
-            fail (D_ARG(2));
-        goto act_blk;
+    case SYM_APPEND: {
+        INCLUDE_PARAMS_OF_INSERT;  // (APPEND has the same parameters)
 
-    case SYM_PICK: {
-    act_blk:;
-        //
-        // !!! For performance, this reuses the same frame built for the
-        // INSERT/etc. on a PORT! to do an INSERT/etc. on whatever kind of
-        // value the state is.  It saves the value of the port, substitutes
-        // the state value in the first slot of the frame, and calls the
-        // array type dispatcher.  :-/
-        //
-        DECLARE_LOCAL (save_port);
-        Move_Value(save_port, D_ARG(1));
-        Move_Value(D_ARG(1), state);
+        UNUSED(PAR(series));
+        UNUSED(REF(only));
+        UNUSED(REF(line));
+        if (REF(part) or REF(dup))
+            fail (Error_Bad_Refines_Raw());
+
+        if (not IS_EVENT(ARG(value)))
+            fail (PAR(value));
+
+        if (not Enqueue_Event(port, ARG(value)))
+            fail ("Event queue is full");
 
-        REB_R r = T_Array(frame_, verb);
         SET_SIGNAL(SIG_EVENT_PORT);
-        if (
-            VAL_WORD_SYM(verb) == SYM_INSERT
-            || VAL_WORD_SYM(verb) == SYM_APPEND
-            || VAL_WORD_SYM(verb) == SYM_REMOVE
-        ){
-            RETURN (save_port);
+        RETURN (port); }
+
+    case SYM_REMOVE: {
+        INCLUDE_PARAMS_OF_REMOVE;
+
+        UNUSED(PAR(series));
+
+        REBINT n = 1;
+        if (REF(part)) {
+            if (not IS_INTEGER(ARG(part)))
+                fail (PAR(part));
+            n = VAL_INT32(ARG(part));
         }
-        return r; }
 
-    case SYM_CLEAR:
-        TERM_ARRAY_LEN(VAL_ARRAY(state), 0);
+        DECLARE_LOCAL (event);
+        for (; n > 0; --n) {
+            if (not Take_Event(event, port, nullptr))
+                break;
+        }
+        RETURN (port); }
+
+    case SYM_CLEAR: {
+        REBLEN n;
+        for (n = 0; n < ARR_LEN(queue); ++n)
+            Init_Blank(ARR_AT(queue, n));
+        EVENT_QUEUE_HEAD(queue) = 0;
+        EVENT_QUEUE_COUNT(queue) = 0;
         CLR_SIGNAL(SIG_EVENT_PORT);
-        RETURN (port);
+        RETURN (port); }
 
     case SYM_OPEN: {
         INCLUDE_PARAMS_OF_OPEN;
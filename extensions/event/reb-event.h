@@ -160,6 +160,18 @@ extern REB_R PD_Event(REBPVS *pvs, const REBVAL *picker, const REBVAL *opt_setva
 // !!! The port scheme is also being included in the extension.
 
 extern REB_R Event_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb);
+extern bool Enqueue_Event(REBVAL *port, const REBVAL *event);
+extern REBVAL *Take_Event(REBVAL *out, const REBVAL *port, REBARR *opt_ports);
+extern bool Events_Pending(void);
+
+// Timers run by WAIT, see %timer-wheel.c
+
+extern void Startup_Timers(void);
+extern void Shutdown_Timers(void);
+extern REBI64 Schedule_Timer(const REBVAL *code, REBLEN delay_ms, bool repeat);
+extern bool Cancel_Timer(REBI64 id);
+extern REBLEN Next_Timer_Ms(REBLEN limit);
+extern bool Run_Timers_Throws(REBVAL *out);
 extern void Startup_Event_Scheme(void);
 extern void Shutdown_Event_Scheme(void);
 
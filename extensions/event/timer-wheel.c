@@ -0,0 +1,458 @@
+//
+//  File: %timer-wheel.c
+//  Summary: "timers run while WAIT is waiting"
+//  Section: ports
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// SCHEDULE asks for code to be run after a delay (optionally again and again
+// at that interval).  The code is run by WAIT, so a program with thousands
+// of connections can give each one a timeout without scanning a list of
+// them on each wakeup.
+//
+// Timers are kept in a "hierarchical timing wheel" (as in the Linux kernel,
+// or in Varghese and Lauck's "Hashed and Hierarchical Timing Wheels").  The
+// wheel ticks once a millisecond.  Level 0 has a slot for each of the next
+// 64 ticks.  Level 1 has a slot for each of the next 64 spans of 64 ticks,
+// and so on for 4 levels (about 4.6 hours).  Each slot holds a linked list
+// of timers, so adding or canceling a timer is O(1).  When the wheel gets
+// to the start of a span on a higher level, the timers in that span's slot
+// are moved down to the levels below ("cascaded").  Timers further out than
+// the wheel reaches go in the last slot they can, and cascade until they
+// are in range.
+//
+// Timers that come due are moved to a "due" list before any code is run, as
+// the code may SCHEDULE or CANCEL timers itself.
+//
+//=//// NOTES /////////////////////////////////////////////////////////////=//
+//
+// * The code for each timer is kept in a BLOCK! held by an API handle, at
+//   the position of the timer's number.  So the GC sees it, but the wheel
+//   itself is plain C data.  (It's malloc()'d, not rebMalloc()'d, as it
+//   must outlive any failure that happens while it's being grown.)
+//
+// * A timer's ID is its number with a serial number above it, so CANCEL on
+//   the ID of a timer that already ran doesn't cancel one that reused its
+//   number.
+//
+
+#include <stdlib.h>
+
+#include "sys-core.h"
+
+#include "reb-event.h"
+
+#define TIMER_LEVEL_BITS 6
+#define TIMER_SLOTS (1 << TIMER_LEVEL_BITS)  // 64
+#define TIMER_LEVELS 4
+
+#define TIMER_CHUNK 64  // initial number of timers to make room for
+
+#define TIMER_FREE 0xFFFF  // `where` for a timer not in use
+#define TIMER_DUE 0xFFFE  // `where` for a timer on the due list
+
+struct Reb_Timer {
+    REBLEN next;  // timer numbers are 1-based, 0 means none
+    REBLEN prev;
+    uint16_t where;  // level * TIMER_SLOTS + slot, or TIMER_FREE/TIMER_DUE
+    uint32_t serial;
+    int64_t expires;  // wheel tick (millisecond) the code is to run at
+    int64_t period;  // 0 if the code is to run just once
+};
+
+static struct Reb_Timer *Timers;  // grows, so timers go by number
+static REBLEN Timers_Capacity;
+static REBLEN Free_Timers;  // linked through `next`
+static REBLEN Due_Timers;
+static uint32_t Timer_Serial;
+
+static REBLEN Wheel[TIMER_LEVELS * TIMER_SLOTS];
+static REBLEN Level_Count[TIMER_LEVELS];
+static int64_t Wheel_Now;  // last tick the wheel has been stepped to
+
+static REBVAL *Timer_Codes;  // BLOCK! with the code of timer N at N - 1
+
+
+inline static struct Reb_Timer *TMR(REBLEN n) {
+    assert(n != 0 and n <= Timers_Capacity);
+    return &Timers[n - 1];
+}
+
+static int64_t Timer_Now(void)
+  { return Delta_Time(0) / 1000; }  // microseconds to milliseconds
+
+static REBLEN *List_Head(uint16_t where) {
+    if (where == TIMER_DUE)
+        return &Due_Timers;
+    assert(where < TIMER_LEVELS * TIMER_SLOTS);
+    return &Wheel[where];
+}
+
+
+static void Link_Timer(REBLEN n, uint16_t where)
+{
+    struct Reb_Timer *t = TMR(n);
+    REBLEN *head = List_Head(where);
+
+    t->where = where;
+    t->prev = 0;
+    t->next = *head;
+    if (*head)
+        TMR(*head)->prev = n;
+    *head = n;
+
+    if (where != TIMER_DUE)
+        ++Level_Count[where / TIMER_SLOTS];
+}
+
+
+static void Unlink_Timer(REBLEN n)
+{
+    struct Reb_Timer *t = TMR(n);
+
+    if (t->prev)
+        TMR(t->prev)->next = t->next;
+    else
+        *List_Head(t->where) = t->next;
+
+    if (t->next)
+        TMR(t->next)->prev = t->prev;
+
+    if (t->where != TIMER_DUE)
+        --Level_Count[t->where / TIMER_SLOTS];
+}
+
+
+// Put a timer on the wheel, in the slot for its expiry on the lowest level
+// whose span reaches it.
+//
+static void Wheel_Timer(REBLEN n)
+{
+    struct Reb_Timer *t = TMR(n);
+    if (t->expires <= Wheel_Now)
+        t->expires = Wheel_Now + 1;  // the slot for now has already run
+
+    int64_t expires = t->expires;
+    int64_t delta = expires - Wheel_Now;
+
+    int level;
+    for (level = 0; level < TIMER_LEVELS - 1; ++level) {
+        if (delta < (cast(int64_t, 1) << (TIMER_LEVEL_BITS * (level + 1))))
+            break;
+    }
+
+    int64_t reach = cast(int64_t, 1) << (TIMER_LEVEL_BITS * TIMER_LEVELS);
+    if (delta >= reach)
+        expires = Wheel_Now + reach - 1;  // will be cascaded until in reach
+
+    REBLEN slot = cast(REBLEN,
+        (expires >> (TIMER_LEVEL_BITS * level)) & (TIMER_SLOTS - 1)
+    );
+    Link_Timer(n, cast(uint16_t, level * TIMER_SLOTS + slot));
+}
+
+
+static void Free_Timer(REBLEN n)
+{
+    struct Reb_Timer *t = TMR(n);
+    t->where = TIMER_FREE;
+    t->next = Free_Timers;
+    Free_Timers = n;
+
+    REBARR *codes = VAL_ARRAY(Timer_Codes);
+    Init_Blank(ARR_AT(codes, n - 1));  // let GC have the code
+}
+
+
+// Move the timers in a slot to the levels below, or to the due list for the
+// timers in the current slot of level 0.
+//
+static void Empty_Slot(uint16_t where, bool due)
+{
+    REBLEN n;
+    while ((n = Wheel[where]) != 0) {
+        Unlink_Timer(n);
+        if (due)
+            Link_Timer(n, TIMER_DUE);
+        else
+            Wheel_Timer(n);
+    }
+}
+
+
+// Step the wheel to `now`, cascading timers down the levels and moving the
+// ones that come due to the due list.  Ticks where nothing can happen (no
+// timers on the levels that would move) are skipped over.
+//
+static void Advance_Wheel(int64_t now)
+{
+    while (Wheel_Now < now) {
+        int low;
+        for (low = 0; low < TIMER_LEVELS; ++low) {
+            if (Level_Count[low] != 0)
+                break;
+        }
+
+        if (low == TIMER_LEVELS) {  // no timers on the wheel at all
+            Wheel_Now = now;
+            break;
+        }
+
+        if (low != 0) {  // nothing to do until level `low` next cascades
+            int64_t span = cast(int64_t, 1) << (TIMER_LEVEL_BITS * low);
+            int64_t next = (Wheel_Now | (span - 1)) + 1;
+            if (next > now) {
+                Wheel_Now = now;
+                break;
+            }
+            Wheel_Now = next - 1;
+        }
+
+        ++Wheel_Now;
+
+        // Cascade from the top, so timers moved down land in slots that
+        // are themselves cascaded if they start a span now.
+        //
+        int level;
+        for (level = TIMER_LEVELS - 1; level > 0; --level) {
+            int shift = TIMER_LEVEL_BITS * level;
+            int64_t span = cast(int64_t, 1) << shift;
+            if ((Wheel_Now & (span - 1)) != 0)
+                continue;
+
+            REBLEN slot = cast(REBLEN,
+                (Wheel_Now >> shift) & (TIMER_SLOTS - 1)
+            );
+            Empty_Slot(cast(uint16_t, level * TIMER_SLOTS + slot), false);
+        }
+
+        Empty_Slot(cast(uint16_t, Wheel_Now & (TIMER_SLOTS - 1)), true);
+    }
+}
+
+
+//
+//  Startup_Timers: C
+//
+void Startup_Timers(void)
+{
+    Timers = nullptr;
+    Timers_Capacity = 0;
+    Free_Timers = 0;
+    Due_Timers = 0;
+    Timer_Serial = 0;
+
+    memset(Wheel, 0, sizeof(Wheel));
+    memset(Level_Count, 0, sizeof(Level_Count));
+    Wheel_Now = Timer_Now();
+
+    Timer_Codes = rebValue("copy []", rebEND);
+    rebUnmanage(Timer_Codes);  // lives until Shutdown_Timers()
+}
+
+
+//
+//  Shutdown_Timers: C
+//
+void Shutdown_Timers(void)
+{
+    rebRelease(Timer_Codes);
+    Timer_Codes = nullptr;
+
+    free(Timers);
+    Timers = nullptr;
+    Timers_Capacity = 0;
+}
+
+
+//
+//  Schedule_Timer: C
+//
+// Returns the ID of the new timer, for Cancel_Timer().
+//
+REBI64 Schedule_Timer(const REBVAL *code, REBLEN delay_ms, bool repeat)
+{
+    assert(IS_BLOCK(code) or IS_ACTION(code));
+
+    if (Free_Timers == 0) {  // make room for more timers
+        REBLEN old = Timers_Capacity;
+        REBLEN capacity = old == 0 ? TIMER_CHUNK : old * 2;
+        size_t size = sizeof(struct Reb_Timer) * capacity;
+        struct Reb_Timer *grown = cast(
+            struct Reb_Timer*, realloc(Timers, size)
+        );
+        if (not grown)
+            fail (Error_No_Memory(size));
+        Timers = grown;
+        Timers_Capacity = capacity;
+
+        REBARR *codes = VAL_ARRAY(Timer_Codes);
+        Note_Series_Mutation(SER(codes));
+
+        REBLEN n;
+        for (n = capacity; n > old; --n) {
+            TMR(n)->where = TIMER_FREE;
+            TMR(n)->serial = 0;
+            TMR(n)->next = Free_Timers;
+            Free_Timers = n;
+        }
+        for (n = old; n < capacity; ++n)
+            Init_Blank(Alloc_Tail_Array(codes));
+    }
+
+    if (Level_Count[0] + Level_Count[1] + Level_Count[2] + Level_Count[3]
+        == 0
+    ){
+        Wheel_Now = Timer_Now();  // don't step through ticks for nothing
+    }
+
+    REBLEN n = Free_Timers;
+    struct Reb_Timer *t = TMR(n);
+    Free_Timers = t->next;
+
+    t->serial = ++Timer_Serial;
+    t->expires = Timer_Now() + delay_ms;
+    t->period = repeat ? delay_ms : 0;
+    Wheel_Timer(n);
+
+    REBARR *codes = VAL_ARRAY(Timer_Codes);
+    Note_Series_Mutation(SER(codes));
+    Move_Value(ARR_AT(codes, n - 1), code);
+
+    return (cast(REBI64, t->serial) << 32) | n;
+}
+
+
+//
+//  Cancel_Timer: C
+//
+// Returns false if there is no such timer (it ran, or was canceled).
+//
+bool Cancel_Timer(REBI64 id)
+{
+    REBLEN n = cast(REBLEN, id & 0xFFFFFFFF);
+    uint32_t serial = cast(uint32_t, id >> 32);
+
+    if (n == 0 or n > Timers_Capacity)
+        return false;
+
+    struct Reb_Timer *t = TMR(n);
+    if (t->where == TIMER_FREE or t->serial != serial)
+        return false;
+
+    Unlink_Timer(n);
+    Free_Timer(n);
+    return true;
+}
+
+
+//
+//  Next_Timer_Ms: C
+//
+// How long WAIT may sleep before the wheel has something to do (a timer
+// comes due, or timers are cascaded), no more than `limit` milliseconds.
+//
+REBLEN Next_Timer_Ms(REBLEN limit)
+{
+    if (Due_Timers)
+        return 0;
+
+    int64_t when;
+    if (Level_Count[0] != 0) {
+        int64_t tick;
+        for (tick = Wheel_Now + 1; ; ++tick) {
+            if (Wheel[tick & (TIMER_SLOTS - 1)])
+                break;
+        }
+        when = tick;
+    }
+    else {
+        int level;
+        for (level = 1; level < TIMER_LEVELS; ++level) {
+            if (Level_Count[level] != 0)
+                break;
+        }
+        if (level == TIMER_LEVELS)
+            return limit;  // no timers
+
+        int64_t span = cast(int64_t, 1) << (TIMER_LEVEL_BITS * level);
+        when = (Wheel_Now | (span - 1)) + 1;
+    }
+
+    int64_t ms = when - Timer_Now();
+    if (ms <= 0)
+        return 0;
+    if (ms < cast(int64_t, limit))
+        return cast(REBLEN, ms);
+    return limit;
+}
+
+
+//
+//  Run_Timers_Throws: C
+//
+// Run the code of the timers that are due.  If the code throws, the thrown
+// value is in `out` and the remaining due timers run on the next call.
+//
+bool Run_Timers_Throws(REBVAL *out)
+{
+    if (not Timer_Codes)
+        return false;
+
+    Advance_Wheel(Timer_Now());
+
+    DECLARE_LOCAL (code);
+    SET_END(code);
+    PUSH_GC_GUARD(code);
+
+    bool threw = false;
+
+    REBLEN n;
+    while ((n = Due_Timers) != 0) {
+        struct Reb_Timer *t = TMR(n);
+        Unlink_Timer(n);
+
+        REBARR *codes = VAL_ARRAY(Timer_Codes);
+        Move_Value(code, KNOWN(ARR_AT(codes, n - 1)));
+
+        // Put a repeating timer back before its code runs, so the code can
+        // CANCEL it.  If it is behind, it skips the runs it missed.
+        //
+        if (t->period != 0) {
+            t->expires += t->period;
+            if (t->expires <= Wheel_Now)
+                t->expires = Wheel_Now + t->period;
+            Wheel_Timer(n);
+        }
+        else
+            Free_Timer(n);
+
+        if (IS_BLOCK(code))
+            threw = Do_Any_Array_At_Throws(out, code, SPECIFIED);
+        else {
+            const bool fully = true;  // error if not all arguments consumed
+            threw = RunQ_Throws(out, fully, rebU1(code), rebEND);
+        }
+
+        if (threw)
+            break;
+    }
+
+    DROP_GC_GUARD(code);
+    return threw;
+}
@@ -28,6 +28,10 @@
 
 #include "reb-struct.h"
 
+// See notes in %t-routine.c on the static linkage dependency on VECTOR!
+//
+#include "sys-vector.h"
+
 REBTYP *EG_Struct_Type = nullptr;  // (E)xtension (G)lobal
 
 // There is a platform-dependent list of legal ABIs which the MAKE-ROUTINE
@@ -375,6 +379,60 @@ REBNATIVE(addr_of) {
 }
 
 
+//
+//  export vector-at-pointer: native [
+//
+//  {Make a VECTOR! of memory that C code owns, used in place (not copied)}
+//
+//      return: [any-value!]
+//      address [integer!]
+//          {Location of the first element, e.g. as returned by a routine}
+//      type [word!]
+//          {Element type: uint8, int8, ... uint64, int64, float, or double}
+//      count [integer!]
+//          {Number of elements}
+//  ]
+//
+REBNATIVE(vector_at_pointer)
+//
+// The memory must stay valid for as long as the vector (or any VECTOR-VIEW
+// of it) is used, as it isn't tracked by Rebol.  Passing the vector back to
+// routines gives them the same address.
+{
+    FFI_INCLUDE_PARAMS_OF_VECTOR_AT_POINTER;
+
+    REBYTE *ptr = cast(REBYTE*, cast(intptr_t, VAL_INT64(ARG(address))));
+    if (ptr == nullptr)
+        fail ("FFI: void pointer illegal for VECTOR-AT-POINTER");
+
+    REBI64 count = VAL_INT64(ARG(count));
+    if (count < 0 or count > UINT32_MAX)
+        fail (PAR(count));
+
+    bool sign = true;
+    bool integral = true;
+    REBYTE bitsize;
+    switch (VAL_WORD_SYM(ARG(type))) {
+      case SYM_UINT8: sign = false; bitsize = 8; break;
+      case SYM_INT8: bitsize = 8; break;
+      case SYM_UINT16: sign = false; bitsize = 16; break;
+      case SYM_INT16: bitsize = 16; break;
+      case SYM_UINT32: sign = false; bitsize = 32; break;
+      case SYM_INT32: bitsize = 32; break;
+      case SYM_UINT64: sign = false; bitsize = 64; break;
+      case SYM_INT64: bitsize = 64; break;
+      case SYM_FLOAT: integral = false; bitsize = 32; break;
+      case SYM_DOUBLE: integral = false; bitsize = 64; break;
+      default:
+        fail (PAR(type));
+    }
+
+    return Init_Vector_External(
+        D_OUT, ptr, sign, integral, bitsize, cast(REBLEN, count), 1
+    );
+}
+
+
 //
 //  export make-similar-struct: native [
 //
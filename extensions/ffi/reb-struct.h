@@ -101,6 +101,7 @@ inline static ffi_type *Get_FFType_For_Sym(REBSYM sym) {
       case SYM_FLOAT: return &ffi_type_float;
       case SYM_DOUBLE: return &ffi_type_double;
       case SYM_POINTER: return &ffi_type_pointer;
+      case SYM_BUFFER: return &ffi_type_pointer;
       case SYM_REBVAL: return &ffi_type_pointer;
 
     // !!! SYM_INTEGER, SYM_DECIMAL, SYM_STRUCT was "-1" in original table
@@ -441,6 +442,13 @@ enum {
     //
     IDX_ROUTINE_CLOSURE = 8,
 
+    // A HANDLE! of a C array of REBLEN precomputed from the CIF, laying out
+    // one block of memory to hold the return value and all the arguments:
+    // [0] is the block's size, [1] the return value's offset in it, and
+    // [2 + n] the offset of argument n.  BLANK! if variadic.
+    //
+    IDX_ROUTINE_PLAN = 9,
+
     IDX_ROUTINE_MAX
 };
 
@@ -500,6 +508,11 @@ inline static ffi_type** RIN_ARG_FFTYPES(REBRIN *r) {
 inline static bool RIN_IS_VARIADIC(REBRIN *r)
     { return VAL_LOGIC(RIN_AT(r, IDX_ROUTINE_IS_VARIADIC)); }
 
+inline static const REBLEN *RIN_PLAN(REBRIN *r) {
+    assert(not RIN_IS_VARIADIC(r));
+    return VAL_HANDLE_POINTER(REBLEN, RIN_AT(r, IDX_ROUTINE_PLAN));
+}
+
 
 // !!! FORWARD DECLARATIONS
 //
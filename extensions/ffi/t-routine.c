@@ -56,6 +56,12 @@ static struct {
             | FLAGIT_KIND(REB_CUSTOM)  // !!! Was REB_VECTOR, must narrow (!)
             | FLAGIT_KIND(REB_ACTION)  // legal if routine or callback
     },
+    {
+        SYM_BUFFER,  // a pointer to data that is used in place, not copied
+        FLAGIT_KIND(REB_NULLED)
+            | FLAGIT_KIND(REB_BINARY)
+            | FLAGIT_KIND(REB_CUSTOM)  // VECTOR!
+    },
     {SYM_REBVAL, TS_VALUE},
     {SYM_0, 0}
 };
@@ -403,7 +409,8 @@ static uintptr_t arg_to_ffi(
         memcpy(dest, &i, sizeof(int64_t));
         break; }
 
-      case SYM_POINTER: {
+      case SYM_POINTER:
+      case SYM_BUFFER: {
         //
         // Note: Function pointers and data pointers may not be same size.
         //
@@ -412,6 +419,15 @@ static uintptr_t arg_to_ffi(
         if (not arg)
             break;
 
+        if (
+            VAL_WORD_SYM(schema) == SYM_BUFFER
+            and not IS_NULLED(arg)
+            and not IS_BINARY(arg)
+            and not IS_VECTOR(arg)
+        ){
+            fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+        }
+
         switch (VAL_TYPE(arg)) {
           case REB_NULLED: {
             intptr_t ipt = 0;
@@ -423,10 +439,10 @@ static uintptr_t arg_to_ffi(
             memcpy(dest, &ipt, sizeof(void*));
             break; }
 
-        // !!! This is a questionable idea, giving out pointers directly into
-        // Rebol series data.  The data may be relocated in memory if any
-        // modifications happen during a callback (or in the future, just for
-        // GC compaction even if not changed)...so the memory is not "stable".
+        // Pointers go directly into Rebol series data.  Routine_Dispatcher()
+        // puts a hold on the series for the duration of the call, so neither
+        // modifications by callbacks nor GC compaction can move the data.
+        // (But C code which keeps the pointer after it returns is on its own.)
         //
           case REB_TEXT: {  // !!!
             const REBYTE *utf8 = VAL_UTF8_AT(nullptr, arg);
@@ -439,6 +455,14 @@ static uintptr_t arg_to_ffi(
             break; }
 
           case REB_CUSTOM: {  // !!!
+            if (not IS_VECTOR(arg))
+                fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+
+            //
+            // A view's pointer is to its first element, so slices go to C
+            // without copying.  For a strided view, the function must take
+            // the stride separately (as BLAS routines take an increment).
+            //
             REBYTE *raw_ptr = VAL_VECTOR_HEAD(arg);
             memcpy(dest, &raw_ptr, sizeof(raw_ptr));  // copies a *pointer*!
             break; }
@@ -587,6 +611,7 @@ static void ffi_to_rebol(
         break;
 
       case SYM_POINTER:  // !!! Should 0 come back as a NULL to Rebol?
+      case SYM_BUFFER:
         Init_Integer(out, cast(uintptr_t, *cast(void**, ffi_rvalue)));
         break;
 
@@ -614,6 +639,146 @@ static void ffi_to_rebol(
 }
 
 
+//
+//  Series_To_Hold: C
+//
+// If an argument gives the C function a pointer into the data of a series,
+// return that series.  It must not be changed or relocated during the call.
+//
+static REBSER *Series_To_Hold(const REBVAL *arg, const REBVAL *schema)
+{
+    if (not IS_WORD(schema))
+        return nullptr;  // STRUCT! arguments are copied
+    REBSYM sym = VAL_WORD_SYM(schema);
+    if (sym != SYM_POINTER and sym != SYM_BUFFER)
+        return nullptr;
+
+    if (IS_BINARY(arg) or IS_TEXT(arg))
+        return VAL_SERIES(arg);
+    if (IS_VECTOR(arg))
+        return VAL_VECTOR_BINARY(arg);  // nullptr if wrapping C memory
+    return nullptr;
+}
+
+
+//
+//  Hold_Arg_Series: C
+//
+// Nothing can fail() between putting on the holds and taking them off, so
+// they can't leak.  Callbacks that try to change the series will get an
+// error, and GC compaction won't move their data.  A series held by
+// something else already (or passed twice) is left to that other hold.
+//
+static void Hold_Arg_Series(REBSER **holds, REBLEN num_holds)
+{
+    REBLEN n;
+    for (n = 0; n < num_holds; ++n) {
+        if (GET_SERIES_INFO(holds[n], HOLD))
+            holds[n] = nullptr;
+        else
+            SET_SERIES_INFO(holds[n], HOLD);
+    }
+}
+
+static void Release_Arg_Series(REBSER **holds, REBLEN num_holds)
+{
+    REBLEN n;
+    for (n = 0; n < num_holds; ++n) {
+        if (holds[n])
+            CLEAR_SERIES_INFO(holds[n], HOLD);
+    }
+}
+
+
+// Routines with up to this many arguments (and this many bytes of them) do
+// their calls without allocating anything.
+//
+#define ROUTINE_STACK_ARGS 16
+#define ROUTINE_STACK_BYTES 256
+
+//
+//  Call_Planned_Routine: C
+//
+// The routine's CIF and the layout of its arguments in memory were worked
+// out when it was made, so a call just converts each argument straight into
+// its place in one block and calls.
+//
+static REB_R Call_Planned_Routine(REBFRM *f, REBRIN *rin)
+{
+    const REBLEN *plan = RIN_PLAN(rin);
+    REBLEN num_args = RIN_NUM_FIXED_ARGS(rin);
+
+    union {  // aligned for any argument type
+        REBI64 i;
+        REBDEC d;
+        void *p;
+        REBYTE bytes[ROUTINE_STACK_BYTES];
+    } stack_block;
+    void *stack_args[ROUTINE_STACK_ARGS];
+    REBSER *stack_holds[ROUTINE_STACK_ARGS];
+
+    REBYTE *block;
+    void **args;
+    REBSER **holds;
+    if (plan[0] <= ROUTINE_STACK_BYTES)
+        block = stack_block.bytes;
+    else
+        block = rebAllocN(REBYTE, plan[0]);
+    if (num_args <= ROUTINE_STACK_ARGS) {
+        args = stack_args;
+        holds = stack_holds;
+    }
+    else {
+        args = rebAllocN(void*, num_args);
+        holds = rebAllocN(REBSER*, num_args);
+    }
+
+    REBLEN num_holds = 0;
+    REBLEN i;
+    for (i = 0; i < num_args; ++i) {
+        args[i] = block + plan[2 + i];
+        arg_to_ffi(
+            nullptr,  // no store, write to dest
+            args[i],
+            FRM_ARG(f, i + 1),  // 1-based
+            RIN_ARG_SCHEMA(rin, i),  // 0-based
+            ACT_PARAM(FRM_PHASE(f), i + 1)  // 1-based
+        );
+
+        REBSER *hold = Series_To_Hold(
+            FRM_ARG(f, i + 1),
+            RIN_ARG_SCHEMA(rin, i)
+        );
+        if (hold)
+            holds[num_holds++] = hold;
+    }
+
+    void *ret;
+    if (IS_BLANK(RIN_RET_SCHEMA(rin)))
+        ret = nullptr;
+    else
+        ret = block + plan[1];
+
+    Hold_Arg_Series(holds, num_holds);
+    ffi_call(RIN_CIF(rin), RIN_CFUNC(rin), ret, num_args == 0 ? nullptr : args);
+    Release_Arg_Series(holds, num_holds);
+
+    if (ret == nullptr)
+        Init_Nulled(f->out);
+    else
+        ffi_to_rebol(f->out, RIN_RET_SCHEMA(rin), ret);
+
+    if (block != stack_block.bytes)
+        rebFree(block);
+    if (args != stack_args) {
+        rebFree(args);
+        rebFree(holds);
+    }
+
+    return f->out;
+}
+
+
 //
 //  Routine_Dispatcher: C
 //
@@ -631,6 +796,9 @@ REB_R Routine_Dispatcher(REBFRM *f)
             fail (Error_Bad_Library_Raw());
     }
 
+    if (not RIN_IS_VARIADIC(rin))
+        return Call_Planned_Routine(f, rin);
+
     REBLEN num_fixed = RIN_NUM_FIXED_ARGS(rin);
 
     REBLEN num_variable;
@@ -730,6 +898,12 @@ REB_R Routine_Dispatcher(REBFRM *f)
     else
         arg_offsets = Make_Series(num_args, sizeof(void*));
 
+    // Series whose data is passed by pointer are gathered here, and have a
+    // hold put on them for just the duration of the call.
+    //
+    REBSER **holds = rebAllocN(REBSER*, num_args + 1);
+    REBLEN num_holds = 0;
+
     // First gather the fixed parameters from the frame.  They are known to
     // be of correct general types (they were checked by Eval_Core for the call)
     // but a STRUCT! might not be compatible with the type of STRUCT! in
@@ -750,6 +924,13 @@ REB_R Routine_Dispatcher(REBFRM *f)
         // We will convert the offset to a pointer later
         //
         *SER_AT(void*, arg_offsets, i) = cast(void*, offset);
+
+        REBSER *hold = Series_To_Hold(
+            FRM_ARG(f, i + 1),
+            RIN_ARG_SCHEMA(rin, i)
+        );
+        if (hold)
+            holds[num_holds++] = hold;
     }
   }
 
@@ -807,6 +988,10 @@ REB_R Routine_Dispatcher(REBFRM *f)
                 schema,
                 param  // used for typecheck, VAL_TYPESET_SYM for error msgs
             ));
+
+            REBSER *hold = Series_To_Hold(DS_AT(dsp), schema);
+            if (hold)
+                holds[num_holds++] = hold;
         }
 
         DS_DROP_TO(dsp_orig);  // done w/args (converted to bytes in `store`)
@@ -849,6 +1034,8 @@ REB_R Routine_Dispatcher(REBFRM *f)
     }
   }
 
+    Hold_Arg_Series(holds, num_holds);
+
     // THE ACTUAL FFI CALL
     //
     // Note that the "offsets" are now direct pointers.  Also note that
@@ -867,6 +1054,9 @@ REB_R Routine_Dispatcher(REBFRM *f)
             : SER_HEAD(void*, arg_offsets)  // also real pointers now
     );
 
+    Release_Arg_Series(holds, num_holds);
+    rebFree(holds);
+
     if (IS_BLANK(RIN_RET_SCHEMA(rin)))
         Init_Nulled(f->out);
     else
@@ -908,6 +1098,10 @@ static void cleanup_args_fftypes(const REBVAL *v) {
     FREE_N(ffi_type*, VAL_HANDLE_LEN(v), VAL_HANDLE_POINTER(ffi_type*, v));
 }
 
+static void cleanup_plan(const REBVAL *v) {
+    FREE_N(REBLEN, VAL_HANDLE_LEN(v), VAL_HANDLE_POINTER(REBLEN, v));
+}
+
 
 struct Reb_Callback_Invocation {
     ffi_cif *cif;
@@ -1187,6 +1381,7 @@ REBACT *Alloc_Ffi_Action_For_Spec(REBVAL *ffi_spec, ffi_abi abi) {
         //
         Init_Blank(RIN_AT(r, IDX_ROUTINE_CIF));
         Init_Blank(RIN_AT(r, IDX_ROUTINE_ARG_FFTYPES));
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_PLAN));
     }
     else {
         // The same CIF can be used for every call of the routine if it is
@@ -1235,6 +1430,31 @@ REBACT *Alloc_Ffi_Action_For_Spec(REBVAL *ffi_spec, ffi_abi abi) {
                 num_fixed,
                 &cleanup_args_fftypes
             );  // lifetime must match cif lifetime
+
+        // ffi_prep_cif() filled in the sizes and alignments of any struct
+        // types, so the memory for a call can be laid out once here.  libffi
+        // writes integer returns as a whole ffi_arg, so leave that much room.
+        //
+        REBLEN *plan = ALLOC_N(REBLEN, num_fixed + 2);
+        REBLEN size = 0;
+        plan[1] = 0;
+        if (cif->rtype != &ffi_type_void)
+            size = MAX(cif->rtype->size, sizeof(ffi_arg));
+
+        for (i = 0; i < num_fixed; ++i) {
+            REBLEN align = MAX(args_fftypes[i]->alignment, 1);
+            size = ((size + align - 1) / align) * align;
+            plan[2 + i] = size;
+            size += args_fftypes[i]->size;
+        }
+        plan[0] = size;
+
+        Init_Handle_Cdata_Managed(
+            RIN_AT(r, IDX_ROUTINE_PLAN),
+            plan,
+            num_fixed + 2,
+            &cleanup_plan
+        );
     }
 
     TERM_ARRAY_LEN(r, IDX_ROUTINE_MAX);
@@ -0,0 +1,57 @@
+Rebol [
+    Title: "Passing VECTOR! and BINARY! data to C in place"
+    File: %buffer.r
+
+    Description: {
+        A [buffer] argument takes a BINARY! or VECTOR! and gives the C code
+        a pointer to its data, without copying it.  This includes views
+        made by VECTOR-VIEW, whose pointer is to their first element.  The
+        series is held during the call, so it can't be changed (or moved)
+        by Rebol code in a callback.
+
+        VECTOR-AT-POINTER goes the other way, making a VECTOR! of memory
+        the C code owns.
+    }
+]
+
+recycle/torture
+
+libc: make library! %libc.so.6
+
+x64?: 40 = fifth system/version
+size_t: either x64? ['int64]['int32]
+
+memset: make-routine libc "memset" compose/deep [
+    return: [pointer]
+    s [buffer]
+    c [int32]
+    n [(size_t)]
+]
+
+malloc: make-routine libc "malloc" compose/deep [
+    return: [pointer]
+    size [(size_t)]
+]
+
+free: make-routine libc "free" [
+    ptr [pointer]
+]
+
+v: make vector! [unsigned integer! 8 [1 2 3 4 5 6]]
+memset (vector-view v 2 3) 0 3
+assert [v = make vector! [unsigned integer! 8 [1 0 0 0 5 6]]]
+
+b: #{AABBCCDD}
+memset b 255 2
+assert [b = #{FFFFCCDD}]
+
+p: malloc 4 * 4
+w: vector-at-pointer p 'int32 4
+repeat i 4 [w/(i): i * 10]
+assert [100 = vector-sum w]
+assert [(vector-view w 3 2) = make vector! [integer! 32 [30 40]]]
+memset w 0 4 * 4
+assert [0 = vector-sum w]
+free p
+
+close libc
@@ -51,6 +51,7 @@
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>  // includes `O_XXX` constant definitions
 #include <dirent.h>
 #include <errno.h>
@@ -457,17 +458,27 @@ DEVICE_CMD Read_File(REBREQ *file)
 
     assert(req->requestee.id != 0);
 
-    if ((req->modes & (RFM_SEEK | RFM_RESEEK)) != 0) {
-        req->modes &= ~RFM_RESEEK;
+    // A port opened with /SEEK positions every read at its index, so pread()
+    // can do that in one call.  The OS file position is left wherever it is,
+    // but it is never consulted in seek mode (Write_File() does the same).
+    //
+    bool positioned = (req->modes & RFM_SEEK) and ReqFile(file)->index >= 0;
+
+    if (not positioned and (req->modes & RFM_RESEEK))
         if (not Seek_File_64(file))
             rebFail_OS (errno);
-    }
+    req->modes &= ~RFM_RESEEK;
 
     // printf("read %d len %d\n", req->requestee.id, req->length);
 
-    ssize_t bytes = read(
-        req->requestee.id, req->common.data, req->length
-    );
+    ssize_t bytes = positioned
+        ? pread(
+            req->requestee.id,
+            req->common.data,
+            req->length,
+            cast(off_t, ReqFile(file)->index)
+        )
+        : read(req->requestee.id, req->common.data, req->length);
 
     if (bytes < 0)
         rebFail_OS (errno);
@@ -494,8 +505,19 @@ DEVICE_CMD Write_File(REBREQ *file)
         lseek(req->requestee.id, 0, SEEK_END);
     }
 
-    if ((req->modes & (RFM_SEEK | RFM_RESEEK | RFM_TRUNCATE)) != 0) {
-        req->modes &= ~RFM_RESEEK;
+    // Binary writes on a /SEEK port go through pwrite() at the index, saving
+    // the lseek() per call (see Read_File()).
+    //
+    bool positioned = (
+        (req->modes & RFM_SEEK)
+        and not (req->modes & (RFM_TRUNCATE | RFM_TEXT))
+        and ReqFile(file)->index >= 0
+    );
+
+    if (
+        not positioned
+        and (req->modes & (RFM_SEEK | RFM_RESEEK | RFM_TRUNCATE)) != 0
+    ){
         if (not Seek_File_64(file))
             rebFail_OS (errno);
 
@@ -503,6 +525,7 @@ DEVICE_CMD Write_File(REBREQ *file)
             if (ftruncate(req->requestee.id, ReqFile(file)->index) != 0)
                 rebFail_OS (errno);
     }
+    req->modes &= ~RFM_RESEEK;
 
     req->actual = 0;  // count actual bytes written as we go along
 
@@ -520,11 +543,14 @@ DEVICE_CMD Write_File(REBREQ *file)
         // no LF => CR LF translation or error checking needed
         //
         assert(req->length != 0);  // checked above
-        ssize_t bytes = write(
-            req->requestee.id,
-            req->common.data,
-            req->length
-        );
+        ssize_t bytes = positioned
+            ? pwrite(
+                req->requestee.id,
+                req->common.data,
+                req->length,
+                cast(off_t, ReqFile(file)->index)
+            )
+            : write(req->requestee.id, req->common.data, req->length);
         if (bytes < 0)
             rebFail_OS (errno);
 
@@ -719,6 +745,20 @@ static int Get_Timezone(struct tm *utc_tm_unused)
 {
     time_t now_secs;
     time(&now_secs); // UNIX seconds (since "epoch")
+
+    // The localtime() and mktime() calls below consult the time zone rules,
+    // which is slow enough to dominate e.g. reading a directory's file
+    // dates.  Offsets only change on a quarter hour boundary (even the zones
+    // that are offset by 30 or 45 minutes change at those), so reuse the
+    // offset until the next one.
+    //
+    // !!! Not thread-safe, but neither is localtime().
+    //
+    static time_t cached_quarter = -1;
+    static int cached_zone;
+    if (now_secs / (15 * 60) == cached_quarter)
+        return cached_zone;
+
     struct tm local_tm = *localtime(&now_secs);
 
   #if !defined(HAS_SMART_TIMEZONE)
@@ -749,7 +789,10 @@ static int Get_Timezone(struct tm *utc_tm_unused)
     time_t now_secs_gm = mktime(gmtime(&now_secs));
 
     double diff = difftime(mktime(&local_tm), now_secs_gm);
-    return cast(int, diff / 60);
+
+    cached_quarter = now_secs / (15 * 60);
+    cached_zone = cast(int, diff / 60);
+    return cached_zone;
 }
 
 
@@ -841,6 +884,153 @@ bool Set_Current_Dir_Value(const REBVAL *path)
 }
 
 
+//
+//  Read_Dir_Entries: C
+//
+// Push each entry of the directory at `rel` under `root` with Push_Dir_Entry()
+// (see WALK-DIR).  Returns 0, or the errno if the directory can't be read.
+//
+// The entries are stat'd with fstatat() relative to the open directory, so
+// the kernel doesn't resolve the whole path again for each one.  They are
+// gathered into rebMalloc() memory and only turned into values after the
+// directory is closed, so a name that isn't valid UTF-8 can't leak the
+// descriptor when it fails.
+//
+int Read_Dir_Entries(const REBVAL *root, const REBVAL *rel)
+{
+    char *path_utf8 = rebSpell(
+        "file-to-local/full join dirize", root, rel,
+    rebEND);
+    DIR *d = opendir(path_utf8);
+    rebFree(path_utf8);
+    if (not d)
+        return errno;
+
+    struct Dir_Walk_Entry {
+        size_t name_offset;
+        size_t name_size;
+        bool is_dir;
+        int64_t size;
+    };
+
+    size_t num_entries = 0;
+    size_t max_entries = 64;
+    struct Dir_Walk_Entry *entries = rebAllocN(
+        struct Dir_Walk_Entry, max_entries
+    );
+
+    size_t names_used = 0;
+    size_t names_max = 1024;
+    char *names = rebAllocN(char, names_max);
+
+    int fd = dirfd(d);
+    struct dirent *e;
+    while ((e = readdir(d)) != nullptr) {
+        const char *name = e->d_name;
+        if (name[0] == '.' and (
+            name[1] == '\0' or (name[1] == '.' and name[2] == '\0')
+        )){
+            continue;
+        }
+
+        struct stat info;
+        if (fstatat(fd, name, &info, AT_SYMLINK_NOFOLLOW) != 0)
+            continue;  // e.g. removed since readdir() saw it
+
+        size_t name_size = strlen(name);
+        if (names_used + name_size > names_max) {
+            while (names_used + name_size > names_max)
+                names_max *= 2;
+            names = cast(char*, rebRealloc(names, names_max));
+        }
+        memcpy(names + names_used, name, name_size);
+
+        if (num_entries == max_entries) {
+            max_entries *= 2;
+            entries = cast(struct Dir_Walk_Entry*, rebRealloc(
+                entries, sizeof(struct Dir_Walk_Entry) * max_entries
+            ));
+        }
+        entries[num_entries].name_offset = names_used;
+        entries[num_entries].name_size = name_size;
+        entries[num_entries].is_dir = S_ISDIR(info.st_mode);
+        entries[num_entries].size = info.st_size;
+        ++num_entries;
+
+        names_used += name_size;
+    }
+    closedir(d);
+
+    size_t i;
+    for (i = 0; i < num_entries; ++i)
+        Push_Dir_Entry(
+            rel,
+            names + entries[i].name_offset,
+            entries[i].name_size,
+            entries[i].is_dir,
+            entries[i].size
+        );
+
+    rebFree(names);
+    rebFree(entries);
+    return 0;
+}
+
+
+//
+//  Try_Map_File_Binary: C
+//
+// Map a file privately (copy-on-write) and give back a BINARY! that uses the
+// mapping as its data, or nullptr if the file can't be mapped.  The result
+// should be freed with rebRelease().
+//
+// The zero fill of the last page past the end of the file is used as the
+// terminator, so files that end exactly on a page boundary aren't mapped.
+// Mappings are intentionally never unmapped (see Make_External_Binary()).
+//
+REBVAL *Try_Map_File_Binary(const REBVAL *path)
+{
+    char *path_utf8 = rebSpell("file-to-local/full", path, rebEND);
+    int fd = open(path_utf8, O_RDONLY | O_BINARY);
+    rebFree(path_utf8);
+    if (fd < 0)
+        return nullptr;
+
+    struct stat info;
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (
+        fstat(fd, &info) != 0
+        or not S_ISREG(info.st_mode)
+        or info.st_size == 0
+        or info.st_size > INT32_MAX
+        or page_size <= 0
+        or info.st_size % page_size == 0  // no zero fill to terminate with
+    ){
+        close(fd);
+        return nullptr;
+    }
+
+    void *data = mmap(
+        nullptr,
+        info.st_size,
+        PROT_READ | PROT_WRITE,  // writes only touch private copies of pages
+        MAP_PRIVATE,
+        fd,
+        0
+    );
+    close(fd);  // the mapping stays valid without the descriptor
+
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    REBSER *bin = Make_External_Binary(
+        cast(REBYTE*, data),
+        cast(REBLEN, info.st_size)
+    );
+    return Init_Binary(Alloc_Value(), bin);
+}
+
+
 #ifdef TO_OSX
     // Should include <mach-o/dyld.h> ?
     #ifdef __cplusplus
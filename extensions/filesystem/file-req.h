@@ -31,6 +31,17 @@ inline static struct devreq_file* ReqFile(REBREQ *req) {
 extern REBVAL *File_Time_To_Rebol(REBREQ *file);
 extern REBVAL *Query_File_Or_Dir(const REBVAL *port, REBREQ *file);
 
+// WALK-DIR asks the OS-specific file for one directory's entries at a time.
+//
+extern int Read_Dir_Entries(const REBVAL *root, const REBVAL *rel);
+extern void Push_Dir_Entry(
+    const REBVAL *rel,
+    const char *name,
+    size_t name_size,
+    bool is_dir,
+    int64_t size
+);
+
 #ifdef TO_WINDOWS
     #define OS_DIR_SEP '\\'  // file path separator (Thanks Bill.)
 #else
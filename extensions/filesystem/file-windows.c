@@ -718,6 +718,176 @@ bool Set_Current_Dir_Value(const REBVAL *path)
 }
 
 
+//
+//  Read_Dir_Entries: C
+//
+// Push each entry of the directory at `rel` under `root` with Push_Dir_Entry()
+// (see WALK-DIR).  Returns 0, or the error code if it can't be read.
+//
+// FindFirstFileEx() is asked for the basic info only (no short names), with
+// large fetches, and the sizes come from the find data so nothing has to be
+// opened per file.  Names are gathered and only turned into values after
+// FindClose(), as in the POSIX version.
+//
+int Read_Dir_Entries(const REBVAL *root, const REBVAL *rel)
+{
+    WCHAR *path_wide = rebSpellWide(
+        "file-to-local/full/wild join dirize", root, rel,
+    rebEND);
+
+    WIN32_FIND_DATAW info;
+    HANDLE h = FindFirstFileExW(
+        path_wide,
+        FindExInfoBasic,
+        &info,
+        FindExSearchNameMatch,
+        NULL,
+        FIND_FIRST_EX_LARGE_FETCH
+    );
+    rebFree(path_wide);
+
+    if (h == INVALID_HANDLE_VALUE) {
+        DWORD error = GetLastError();
+        return error == ERROR_FILE_NOT_FOUND ? 0 : cast(int, error);
+    }
+
+    struct Dir_Walk_Entry {
+        size_t name_offset;
+        size_t name_size;
+        bool is_dir;
+        int64_t size;
+    };
+
+    size_t num_entries = 0;
+    size_t max_entries = 64;
+    struct Dir_Walk_Entry *entries = rebAllocN(
+        struct Dir_Walk_Entry, max_entries
+    );
+
+    size_t names_used = 0;
+    size_t names_max = 1024;
+    char *names = rebAllocN(char, names_max);
+
+    do {
+        const WCHAR *name = info.cFileName;
+        if (name[0] == '.' and (
+            name[1] == 0 or (name[1] == '.' and name[2] == 0)
+        )){
+            continue;
+        }
+
+        int name_size = WideCharToMultiByte(
+            CP_UTF8, 0, name, -1, NULL, 0, NULL, NULL
+        ) - 1;  // count includes the terminator
+        if (name_size <= 0)
+            continue;
+
+        if (names_used + name_size + 1 > names_max) {
+            while (names_used + name_size + 1 > names_max)
+                names_max *= 2;
+            names = cast(char*, rebRealloc(names, names_max));
+        }
+        WideCharToMultiByte(
+            CP_UTF8, 0, name, -1,
+            names + names_used, name_size + 1,
+            NULL, NULL
+        );
+
+        if (num_entries == max_entries) {
+            max_entries *= 2;
+            entries = cast(struct Dir_Walk_Entry*, rebRealloc(
+                entries, sizeof(struct Dir_Walk_Entry) * max_entries
+            ));
+        }
+        entries[num_entries].name_offset = names_used;
+        entries[num_entries].name_size = name_size;
+        entries[num_entries].is_dir = did (
+            info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY
+        );
+        entries[num_entries].size =
+            (cast(int64_t, info.nFileSizeHigh) << 32) + info.nFileSizeLow;
+        ++num_entries;
+
+        names_used += name_size;
+    } while (FindNextFileW(h, &info));
+
+    FindClose(h);
+
+    size_t i;
+    for (i = 0; i < num_entries; ++i)
+        Push_Dir_Entry(
+            rel,
+            names + entries[i].name_offset,
+            entries[i].name_size,
+            entries[i].is_dir,
+            entries[i].size
+        );
+
+    rebFree(names);
+    rebFree(entries);
+    return 0;
+}
+
+
+//
+//  Try_Map_File_Binary: C
+//
+// Map a file privately (copy-on-write) and give back a BINARY! that uses the
+// mapping as its data, or nullptr if the file can't be mapped.  The result
+// should be freed with rebRelease().
+//
+// The zero fill of the last page past the end of the file is used as the
+// terminator, so files that end exactly on a page boundary aren't mapped.
+// Mappings are intentionally never unmapped (see Make_External_Binary()).
+//
+REBVAL *Try_Map_File_Binary(const REBVAL *path)
+{
+    WCHAR *path_wide = rebSpellWide("file-to-local/full", path, rebEND);
+    HANDLE file = CreateFile(
+        path_wide,
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        NULL,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        NULL
+    );
+    rebFree(path_wide);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+
+    LARGE_INTEGER size;
+    if (
+        not GetFileSizeEx(file, &size)
+        or size.QuadPart == 0
+        or size.QuadPart > INT32_MAX
+        or size.QuadPart % system_info.dwPageSize == 0  // no zero fill
+    ){
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMapping(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    CloseHandle(file);  // the mapping keeps the file open
+    if (mapping == NULL)
+        return nullptr;
+
+    void *data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);  // the view keeps the mapping alive
+    if (data == NULL)
+        return nullptr;
+
+    REBSER *bin = Make_External_Binary(
+        cast(REBYTE*, data),
+        cast(REBLEN, size.QuadPart)
+    );
+    return Init_Binary(Alloc_Value(), bin);
+}
+
+
 //
 //  Get_Current_Exec: C
 //
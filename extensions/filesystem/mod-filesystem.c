@@ -585,6 +585,180 @@ REBNATIVE(change_dir)
 }
 
 
+extern REBVAL *Try_Map_File_Binary(const REBVAL *path);
+
+//
+//  export read-mapped: native [
+//
+//  {Read a file as a BINARY! that shares the file's pages instead of copying}
+//
+//      return: [binary!]
+//      file [file!]
+//      /seek "Return the binary at this offset (still sharing the pages)"
+//          [any-number!]
+//      /part "Copy just this many bytes out of the mapping"
+//          [any-number!]
+//  ]
+//
+// The binary can be changed, but changes are private to this process (and
+// growing it makes a copy).  Processes reading the same file share the one
+// copy of its pages in memory.  Files that can't be mapped are just READ.
+//
+// /PART has to copy, because a series must end in a 0 byte and a mapping
+// only has one where the file ends.  But that copy is all that's paid for
+// a random access: the rest of the file is only touched as pages fault in.
+//
+REBNATIVE(read_mapped)
+{
+    FILESYSTEM_INCLUDE_PARAMS_OF_READ_MAPPED;
+
+    Check_Security_Placeholder(Canon(SYM_FILE), SYM_READ, ARG(file));
+
+    REBVAL *mapped = Try_Map_File_Binary(ARG(file));
+    if (not mapped)
+        return rebValue(
+            "read/seek/part", ARG(file), rebQ1(REF(seek)), rebQ1(REF(part)),
+        rebEND);
+
+    if (REF(seek)) {
+        REBI64 offset = Int64s(ARG(seek), 0);
+        if (offset > BIN_LEN(VAL_SERIES(mapped)))
+            offset = BIN_LEN(VAL_SERIES(mapped));
+        VAL_INDEX(mapped) = cast(REBLEN, offset);
+    }
+
+    if (REF(part))
+        return rebValue("copy/part", rebR(mapped), ARG(part), rebEND);
+
+    return mapped;
+}
+
+
+//
+//  Push_Dir_Entry: C
+//
+// Push a WALK-DIR entry onto the data stack: the path relative to the root
+// of the walk (with a trailing slash for directories), then the size in
+// bytes--or BLANK! for a directory.
+//
+void Push_Dir_Entry(
+    const REBVAL *rel,
+    const char *name,
+    size_t name_size,
+    bool is_dir,
+    int64_t size
+){
+    REBSIZ rel_size;
+    const REBYTE *rel_utf8 = VAL_UTF8_AT(&rel_size, rel);
+
+    REBSTR *path = Make_String(rel_size + name_size + 1);
+    Append_Utf8(path, cs_cast(rel_utf8), rel_size);
+    Append_Utf8(path, name, name_size);
+    if (is_dir)
+        Append_Codepoint(path, '/');
+
+    Init_File(DS_PUSH(), path);
+    if (is_dir)
+        Init_Blank(DS_PUSH());
+    else
+        Init_Integer(DS_PUSH(), size);
+}
+
+
+//
+//  export walk-dir: native [
+//
+//  {List everything below a directory with sizes, without a QUERY per file}
+//
+//      return: "Pairs of path relative to DIR and size (BLANK! if a dir)"
+//          [block! void!]
+//      dir [file!]
+//      /each "Pass the pairs a block at a time to this, instead of returning"
+//          [action!]
+//      /batch "How many pairs to pass to /EACH at once (default 1024)"
+//          [integer!]
+//  ]
+//
+// Directories are visited breadth first, one at a time, and their entries
+// are stat'd on the OS side in one pass (see Read_Dir_Entries()).  With
+// /EACH only one batch of the results is held in memory at once.
+// Subdirectories that can't be read are skipped.  Symbolic links aren't
+// followed.
+//
+// !!! Directories could be read in parallel, but the interpreter can only
+// build values on one thread.
+//
+REBNATIVE(walk_dir)
+{
+    FILESYSTEM_INCLUDE_PARAMS_OF_WALK_DIR;
+
+    Check_Security_Placeholder(Canon(SYM_FILE), SYM_READ, ARG(dir));
+
+    REBLEN batch = 1024;
+    if (REF(batch)) {
+        if (not REF(each))
+            fail (Error_Bad_Refines_Raw());
+        if (VAL_INT64(ARG(batch)) <= 0)
+            fail (Error_Out_Of_Range(ARG(batch)));
+        batch = VAL_INT32(ARG(batch));
+    }
+
+    REBDSP dsp_orig = DSP;
+
+    // Relative paths of directories still to visit.  The first is the root.
+    //
+    REBARR *pending = Make_Array(8);
+    Init_File(Alloc_Tail_Array(pending), Make_String(0));
+    Manage_Array(pending);
+    PUSH_GC_GUARD(pending);
+
+    REBLEN next;
+    for (next = 0; next < ARR_LEN(pending); ++next) {
+        DECLARE_LOCAL (rel);  // pending may be expanded, so don't point in
+        Move_Value(rel, KNOWN(ARR_AT(pending, next)));
+
+        REBDSP dsp_dir = DSP;
+        int error = Read_Dir_Entries(ARG(dir), rel);
+        if (error != 0) {
+            if (next == 0)
+                rebFail_OS (error);
+            continue;
+        }
+
+        Note_Series_Mutation(SER(pending));  // may get younger paths
+
+        REBDSP dsp;
+        for (dsp = dsp_dir + 1; dsp < DSP; dsp += 2) {
+            if (IS_BLANK(DS_AT(dsp + 1)))
+                Append_Value(pending, DS_AT(dsp));
+        }
+
+        if (REF(each) and DSP - dsp_orig >= 2 * batch) {
+            DECLARE_LOCAL (block);
+            Init_Block(block, Pop_Stack_Values(dsp_orig));
+            PUSH_GC_GUARD(block);
+            rebElide(ARG(each), block, rebEND);
+            DROP_GC_GUARD(block);
+        }
+    }
+
+    DROP_GC_GUARD(pending);
+
+    if (not REF(each))
+        return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+
+    if (DSP != dsp_orig) {
+        DECLARE_LOCAL (block);
+        Init_Block(block, Pop_Stack_Values(dsp_orig));
+        PUSH_GC_GUARD(block);
+        rebElide(ARG(each), block, rebEND);
+        DROP_GC_GUARD(block);
+    }
+
+    return Init_Void(D_OUT);
+}
+
+
 extern REBVAL *Get_Current_Exec();
 
 //
@@ -181,6 +181,7 @@ REB_R Dir_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
 
         UNUSED(PAR(string)); // handled in dispatcher
         UNUSED(PAR(lines)); // handled in dispatcher
+        UNUSED(PAR(into)); // handled in dispatcher
 
         if (not IS_BLOCK(state)) {     // !!! ignores /SKIP and /PART, for now
             REBREQ *dir = OS_Make_Devreq(&Dev_File);
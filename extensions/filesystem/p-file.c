@@ -372,7 +372,29 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
             Set_Seek(file, ARG(seek));
 
         REBLEN len = Set_Length(file, REF(part) ? VAL_INT64(ARG(part)) : -1);
-        Read_File_Port(D_OUT, port, file, path, flags, len);
+
+        if (REF(into)) {
+            //
+            // Read straight into the spare capacity at the binary's tail, so
+            // that reading a file a window at a time doesn't allocate a new
+            // binary per window.  (The dispatcher sees the same series comes
+            // back and doesn't append it again.)
+            //
+            FAIL_IF_READ_ONLY(ARG(into));
+            REBBIN *bin = VAL_BINARY(ARG(into));
+            REBLEN tail = BIN_LEN(bin);
+            EXPAND_SERIES_TAIL(bin, len);
+            TERM_BIN_LEN(bin, tail);  // only grow by what actually gets read
+
+            req->common.data = BIN_AT(bin, tail);
+            req->length = len;
+            OS_DO_DEVICE_SYNC(file, RDC_READ);
+
+            TERM_BIN_LEN(bin, tail + req->actual);
+            Move_Value(D_OUT, ARG(into));
+        }
+        else
+            Read_File_Port(D_OUT, port, file, path, flags, len);
 
         if (opened) {
             REBVAL *result = OS_DO_DEVICE(file, RDC_CLOSE);
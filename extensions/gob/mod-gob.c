@@ -32,6 +32,43 @@
 
 REBTYP *EG_Gob_Type = nullptr;  // (E)xtension (G)lobal
 
+REBVAL *EG_Gob_Damage_Hook = nullptr;
+REBVAL *EG_Gob_Damaged = nullptr;
+REBLEN EG_Gob_Batch_Depth = 0;
+
+
+// The damage hook is told about windows after each GOB! operation finishes,
+// so these wrap the datatype's hooks (see Flush_Gob_Damage()).
+
+static REB_R T_Gob_Then_Flush(REBFRM *frame_, const REBVAL *verb)
+{
+    REB_R r = T_Gob(frame_, verb);
+    Flush_Gob_Damage();
+    return r;
+}
+
+static REB_R PD_Gob_Then_Flush(
+    REBPVS *pvs,
+    const REBVAL *picker,
+    const REBVAL *opt_setval
+){
+    REB_R r = PD_Gob(pvs, picker, opt_setval);
+    Flush_Gob_Damage();
+    return r;
+}
+
+static REB_R MAKE_Gob_Then_Flush(
+    REBVAL *out,
+    enum Reb_Kind kind,
+    const REBVAL *opt_parent,
+    const REBVAL *arg
+){
+    REB_R r = MAKE_Gob(out, kind, opt_parent, arg);
+    Flush_Gob_Damage();
+    return r;
+}
+
+
 //
 //  register-gob-hooks: native [
 //
@@ -54,14 +91,17 @@ REBNATIVE(register_gob_hooks)
     EG_Gob_Type = Hook_Datatype(
         "http://datatypes.rebol.info/gob",
         "graphical object",
-        &T_Gob,
-        &PD_Gob,
+        &T_Gob_Then_Flush,
+        &PD_Gob_Then_Flush,
         &CT_Gob,
-        &MAKE_Gob,
+        &MAKE_Gob_Then_Flush,
         &TO_Gob,
         &MF_Gob
     );
 
+    EG_Gob_Damaged = rebValue("copy []", rebEND);
+    rebUnmanage(EG_Gob_Damaged);  // lives until UNREGISTER-GOB-HOOKS
+
     return Init_Void(D_OUT);
 }
 
@@ -80,6 +120,14 @@ REBNATIVE(unregister_gob_hooks)
 
     Unhook_Datatype(EG_Gob_Type);
 
+    if (EG_Gob_Damage_Hook) {
+        rebRelease(EG_Gob_Damage_Hook);
+        EG_Gob_Damage_Hook = nullptr;
+    }
+    rebRelease(EG_Gob_Damaged);
+    EG_Gob_Damaged = nullptr;
+    EG_Gob_Batch_Depth = 0;
+
     return Init_Void(D_OUT);
 }
 
@@ -178,3 +226,217 @@ REBNATIVE(map_gob_offset)
 
     return Init_Block(D_OUT, arr);
 }
+
+
+// Area needing redraw, as corners (empty while x1 > x2)
+//
+struct Gob_Damage {
+    REBD32 x1;
+    REBD32 y1;
+    REBD32 x2;
+    REBD32 y2;
+};
+
+static void Add_Damage(
+    struct Gob_Damage *d,
+    REBD32 x,
+    REBD32 y,
+    REBD32 w,
+    REBD32 h
+){
+    if (w <= 0 or h <= 0)
+        return;
+
+    if (d->x1 > d->x2) {
+        d->x1 = x;
+        d->y1 = y;
+        d->x2 = x + w;
+        d->y2 = y + h;
+        return;
+    }
+
+    if (x < d->x1)
+        d->x1 = x;
+    if (y < d->y1)
+        d->y1 = y;
+    if (x + w > d->x2)
+        d->x2 = x + w;
+    if (y + h > d->y2)
+        d->y2 = y + h;
+}
+
+
+//
+//  Take_Gob_Damage: C
+//
+// Add the area of the gob and its pane needing redraw to `d`, where (x, y) is
+// where the pane holding the gob is.  Only panes with a dirty flag are gone
+// into.  Everything is marked clean, as drawn where it is now.
+//
+// A dirty gob covers the gobs in its pane (they're drawn clipped to it), so
+// those are only visited to clear their flags.
+//
+static void Take_Gob_Damage(
+    struct Gob_Damage *d,
+    REBGOB *gob,
+    REBD32 x,
+    REBD32 y,
+    bool covered,
+    REBINT depth
+){
+    if (GET_GOB_FLAG(gob, GOBS_DIRTY) and not covered) {
+        Add_Damage(d, x + GOB_X(gob), y + GOB_Y(gob), GOB_W(gob), GOB_H(gob));
+        if (not GET_GOB_FLAG(gob, GOBS_NEW))
+            Add_Damage(
+                d, x + GOB_XO(gob), y + GOB_YO(gob), GOB_WO(gob), GOB_HO(gob)
+            );
+        covered = true;
+    }
+
+    if (GOB_PANE(gob) and depth > 0) {
+        REBLEN len = GOB_LEN(gob);
+        REBVAL *item = GOB_HEAD(gob);
+
+        REBLEN n;
+        for (n = 0; n < len; ++n, ++item) {
+            REBGOB *child = VAL_GOB(item);
+            if (GOB_FLAGS(child) & (GOBS_DIRTY | GOBS_DIRTY_PANE))
+                Take_Gob_Damage(
+                    d,
+                    child,
+                    x + GOB_X(gob),
+                    y + GOB_Y(gob),
+                    covered,
+                    depth - 1
+                );
+        }
+    }
+
+    CLR_GOB_FLAG(gob, GOBS_DIRTY | GOBS_DIRTY_PANE | GOBS_NEW);
+    GOB_XO(gob) = GOB_X(gob);
+    GOB_YO(gob) = GOB_Y(gob);
+    GOB_WO(gob) = GOB_W(gob);
+    GOB_HO(gob) = GOB_H(gob);
+}
+
+
+//
+//  export gob-damage: native [
+//
+//  {Get the area of a GOB! that needs redrawing, and mark it all as drawn}
+//
+//      return: "[PAIR! PAIR!] offset and size, relative to the GOB!"
+//          [<opt> block!]
+//      gob [gob!]
+//  ]
+//
+REBNATIVE(gob_damage)
+{
+    GOB_INCLUDE_PARAMS_OF_GOB_DAMAGE;
+
+    REBGOB *gob = VAL_GOB(ARG(gob));
+
+    struct Gob_Damage d;
+    d.x1 = d.y1 = 1;
+    d.x2 = d.y2 = 0;
+
+    if (GOB_FLAGS(gob) & (GOBS_DIRTY | GOBS_DIRTY_PANE))
+        Take_Gob_Damage(&d, gob, - GOB_X(gob), - GOB_Y(gob), false, 1000);
+
+    if (d.x1 > d.x2)
+        return nullptr;
+
+    REBARR *arr = Make_Array(2);
+    Init_Pair_Dec(Alloc_Tail_Array(arr), d.x1, d.y1);
+    Init_Pair_Dec(Alloc_Tail_Array(arr), d.x2 - d.x1, d.y2 - d.y1);
+
+    return Init_Block(D_OUT, arr);
+}
+
+
+//
+//  export gob-dirty?: native [
+//
+//  {Test if a GOB! or any GOB! in its pane needs redrawing}
+//
+//      return: [logic!]
+//      gob [gob!]
+//  ]
+//
+REBNATIVE(gob_dirty_q)
+{
+    GOB_INCLUDE_PARAMS_OF_GOB_DIRTY_Q;
+
+    REBGOB *gob = VAL_GOB(ARG(gob));
+    return Init_Logic(
+        D_OUT,
+        did (GOB_FLAGS(gob) & (GOBS_DIRTY | GOBS_DIRTY_PANE))
+    );
+}
+
+
+//
+//  export on-gob-damage: native [
+//
+//  {Set a function to call when a window GOB! first needs redrawing}
+//
+//      return: [void!]
+//      hook "Gets the window (or topmost) GOB!, after the change to it"
+//          [<opt> action!]
+//  ]
+//
+REBNATIVE(on_gob_damage)
+{
+    GOB_INCLUDE_PARAMS_OF_ON_GOB_DAMAGE;
+
+    if (EG_Gob_Damage_Hook) {
+        rebRelease(EG_Gob_Damage_Hook);
+        EG_Gob_Damage_Hook = nullptr;
+    }
+    rebElide("clear", EG_Gob_Damaged, rebEND);
+
+    if (not IS_NULLED(ARG(hook))) {
+        EG_Gob_Damage_Hook = rebValue(rebQ1(ARG(hook)), rebEND);
+        rebUnmanage(EG_Gob_Damage_Hook);
+    }
+
+    return Init_Void(D_OUT);
+}
+
+
+//
+//  begin-gob-batch: native [
+//
+//  {Hold calls to the ON-GOB-DAMAGE hook until END-GOB-BATCH (nestable)}
+//
+//      return: [void!]
+//  ]
+//
+REBNATIVE(begin_gob_batch)
+{
+    GOB_INCLUDE_PARAMS_OF_BEGIN_GOB_BATCH;
+
+    ++EG_Gob_Batch_Depth;
+    return Init_Void(D_OUT);
+}
+
+
+//
+//  end-gob-batch: native [
+//
+//  {Make the ON-GOB-DAMAGE hook calls held since BEGIN-GOB-BATCH}
+//
+//      return: [void!]
+//  ]
+//
+REBNATIVE(end_gob_batch)
+{
+    GOB_INCLUDE_PARAMS_OF_END_GOB_BATCH;
+
+    if (EG_Gob_Batch_Depth == 0)
+        fail ("END-GOB-BATCH without BEGIN-GOB-BATCH");
+
+    --EG_Gob_Batch_Depth;
+    Flush_Gob_Damage();
+    return Init_Void(D_OUT);
+}
@@ -114,7 +114,15 @@ enum Reb_Gob_Flags {
     GOBF_MINIMIZE = 1 << 17,  // Window is minimized
     GOBF_MAXIMIZE = 1 << 18,  // Window is maximized
     GOBF_RESTORE = 1 << 19,  // Window is restored
-    GOBF_FULLSCREEN = 1 << 20  // Window is fullscreen
+    GOBF_FULLSCREEN = 1 << 20,  // Window is fullscreen
+
+    // Damage tracking (see Mark_Gob_Dirty()).  A DIRTY gob needs redrawing
+    // where it is now and where it was last drawn (old-offset, old-size).
+    // DIRTY_PANE means some GOB! under it is DIRTY, so a renderer can skip
+    // any pane without either flag.
+    //
+    GOBS_DIRTY = 1 << 21,
+    GOBS_DIRTY_PANE = 1 << 22
 };
 
 
@@ -269,6 +277,13 @@ inline static void SET_GOB_OWNER(REBGOB *g, REBGOB *owner) {
 extern REBGOB *Gob_Root;  // Top level GOB (the screen)
 extern REBTYP *EG_Gob_Type;
 
+extern REBVAL *EG_Gob_Damage_Hook;  // ACTION! told of newly damaged windows
+extern REBVAL *EG_Gob_Damaged;  // BLOCK! of windows to tell the hook about
+extern REBLEN EG_Gob_Batch_Depth;  // nonzero during GOB-BATCH
+
+extern void Mark_Gob_Dirty(REBGOB *gob);
+extern void Flush_Gob_Damage(void);
+
 inline static bool IS_GOB(const RELVAL *v)  // Note: QUOTED! does not count
   { return IS_CUSTOM(v) and CELL_CUSTOM_TYPE(v) == EG_Gob_Type; }
 
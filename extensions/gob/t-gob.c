@@ -134,6 +134,85 @@ static bool Did_Set_XYF(RELVAL *xyf, const REBVAL *val)
 }
 
 
+//
+//  Flush_Gob_Damage: C
+//
+// Call the damage hook for each window that went from clean to damaged since
+// the last time, unless a GOB-BATCH is running (it flushes at its end).  This
+// is done after each GOB! operation, not in Mark_Gob_Dirty(), since the hook
+// could run any code--while a pane might be half-updated.
+//
+void Flush_Gob_Damage(void)
+{
+    if (EG_Gob_Batch_Depth != 0 or not EG_Gob_Damage_Hook)
+        return;
+
+    if (ARR_LEN(VAL_ARRAY(EG_Gob_Damaged)) == 0)
+        return;
+
+    REBVAL *windows = rebValue("copy", EG_Gob_Damaged, rebEND);
+    rebElide("clear", EG_Gob_Damaged, rebEND);
+
+    RELVAL *item = VAL_ARRAY_HEAD(windows);
+    for (; NOT_END(item); ++item)
+        rebElide(EG_Gob_Damage_Hook, SPECIFIC(item), rebEND);
+
+    rebRelease(windows);
+}
+
+
+//
+//  Mark_Gob_Dirty: C
+//
+// Call before changing anything about how a GOB! looks.  The first time, the
+// offset and size are saved as where it was last drawn, and the parents are
+// marked as having something dirty in their panes.  That stops at the first
+// parent which already was, since the ones above it must be too.
+//
+// A top-level GOB! (or window) going from clean to damaged is remembered for
+// Flush_Gob_Damage() to report, so a renderer can schedule one redraw for
+// many changes.
+//
+void Mark_Gob_Dirty(REBGOB *gob)
+{
+    bool was_clean = not (GOB_FLAGS(gob) & (GOBS_DIRTY | GOBS_DIRTY_PANE));
+
+    if (not GET_GOB_FLAG(gob, GOBS_DIRTY)) {
+        if (not GET_GOB_FLAG(gob, GOBS_NEW)) {  // else old-xxx meaningless
+            GOB_XO(gob) = GOB_X(gob);
+            GOB_YO(gob) = GOB_Y(gob);
+            GOB_WO(gob) = GOB_W(gob);
+            GOB_HO(gob) = GOB_H(gob);
+        }
+        SET_GOB_FLAG(gob, GOBS_DIRTY);
+    }
+
+    REBINT max_depth = 1000; // avoid infinite loops
+    while (
+        GOB_PARENT(gob)
+        and not GET_GOB_FLAG(gob, GOBF_WINDOW)
+        and max_depth-- > 0
+    ){
+        gob = GOB_PARENT(gob);
+        if (GET_GOB_FLAG(gob, GOBS_DIRTY_PANE))
+            return;  // parents above were marked (and hook told) already
+
+        was_clean = not GET_GOB_FLAG(gob, GOBS_DIRTY);
+        SET_GOB_FLAG(gob, GOBS_DIRTY_PANE);
+    }
+
+    if (
+        was_clean
+        and EG_Gob_Damage_Hook
+        and GET_SERIES_FLAG(gob, MANAGED)  // e.g. not still in MAKE GOB!
+    ){
+        REBARR *list = VAL_ARRAY(EG_Gob_Damaged);
+        Note_Series_Mutation(SER(list));
+        Init_Gob(Alloc_Tail_Array(list), gob);
+    }
+}
+
+
 //
 //  Find_Gob: C
 //
@@ -170,6 +249,8 @@ static void Detach_Gob(REBGOB *gob)
         return;
 
     if (GOB_PANE(par)) {
+        Mark_Gob_Dirty(par);  // to redraw what was under the gob
+
         REBLEN i = Find_Gob(par, gob);
         if (i != NOT_FOUND)
             Remove_Series_Units(SER(GOB_PANE(par)), i, 1);
@@ -270,6 +351,7 @@ static void Insert_Gobs(
 
             SET_GOB_PARENT(VAL_GOB(val), gob);
             SET_GOB_FLAG(VAL_GOB(val), GOBS_NEW);
+            Mark_Gob_Dirty(VAL_GOB(val));
         }
     }
 
@@ -284,6 +366,8 @@ static void Insert_Gobs(
 //
 static void Remove_Gobs(REBGOB *gob, REBLEN index, REBLEN len)
 {
+    Mark_Gob_Dirty(gob);  // to redraw what was under the removed gobs
+
     REBVAL *item = GOB_AT(gob, index);
 
     REBLEN n;
@@ -359,7 +443,11 @@ static void Set_Gob_Flag(REBGOB *gob, REBSTR *name)
 //
 static bool Did_Set_GOB_Var(REBGOB *gob, const REBVAL *word, const REBVAL *val)
 {
-    switch (VAL_WORD_SYM(word)) {
+    REBSYM sym = VAL_WORD_SYM(word);
+    if (sym != SYM_OWNER and not (sym == SYM_DATA and not IS_BLANK(val)))
+        Mark_Gob_Dirty(gob);  // before the offset and size may change
+
+    switch (sym) {
       case SYM_OFFSET:
         return Did_Set_XYF(ARR_AT(gob, IDX_GOB_OFFSET_AND_FLAGS), val);
 
@@ -705,6 +793,7 @@ void Extend_Gob_Core(REBGOB *gob, const REBVAL *arg) {
         Set_GOB_Vars(gob, VAL_ARRAY_AT(arg), VAL_SPECIFIER(arg));
     }
     else if (IS_PAIR(arg)) {
+        Mark_Gob_Dirty(gob);
         GOB_X(gob) = VAL_PAIR_X_DEC(arg);
         GOB_Y(gob) = VAL_PAIR_Y_DEC(arg);
     }
@@ -747,6 +836,7 @@ REB_R MAKE_Gob(
         REBGOB *gob = Copy_Array_Shallow(VAL_GOB(opt_parent), SPECIFIED);
         Init_Blank(ARR_AT(gob, IDX_GOB_PANE));
         SET_GOB_PARENT(gob, nullptr);
+        CLR_GOB_FLAG(gob, GOBS_DIRTY | GOBS_DIRTY_PANE);
         Extend_Gob_Core(gob, arg);
         return Init_Gob(out, gob);
     }
@@ -757,6 +847,7 @@ REB_R MAKE_Gob(
     REBGOB *gob = Copy_Array_Shallow(VAL_GOB(arg), SPECIFIED);
     Init_Blank(GOB_PANE_VALUE(gob));
     SET_GOB_PARENT(gob, nullptr);
+    CLR_GOB_FLAG(gob, GOBS_DIRTY | GOBS_DIRTY_PANE);
     Manage_Array(gob);
     return Init_Gob(out, gob);
 }
@@ -1020,6 +1111,8 @@ REBTYPE(Gob)
         // !!! Could make the indexed pane into a local if we had a spare
         // local, but its' good to exercise the API as much as possible).
         //
+        Mark_Gob_Dirty(gob);  // to redraw what was under the taken gobs
+
         REBVAL *pane = KNOWN(ARR_AT(gob, IDX_GOB_PANE));
         return rebValue(
             "applique :take [",
@@ -1047,6 +1140,7 @@ REBTYPE(Gob)
         return nullptr;
 
     case SYM_REVERSE:
+        Mark_Gob_Dirty(gob);  // pane is drawn in order
         return rebValueQ(
             "reverse", ARR_AT(gob, IDX_GOB_PANE),
         rebEND);
@@ -11,6 +11,10 @@ cflags: []
 searches: []
 ldflags: []
 
-libraries: []
+; Windows threads come from kernel32, which is linked by default.
+;
+libraries: try if system-config/os-base <> 'Windows [
+    [%pthread]
+]
 
 options: []
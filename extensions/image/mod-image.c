@@ -23,6 +23,15 @@
 //
 // See notes in %extensions/image/README.md
 
+#ifdef TO_WINDOWS
+    #define WIN32_LEAN_AND_MEAN  // trim down the Win32 headers
+    #include <windows.h>
+    #undef IS_ERROR  // winerror.h defines, Rebol has a different meaning
+#else
+    #include <pthread.h>
+    #include <unistd.h>  // for sysconf()
+#endif
+
 #include "sys-core.h"
 
 #include "tmp-mod-image.h"
@@ -81,3 +90,919 @@ REBNATIVE(unregister_image_hooks)
 
     return Init_Void(D_OUT);
 }
+
+
+//=//// BULK PIXEL OPERATIONS /////////////////////////////////////////////=//
+//
+// IMAGE-FILL, IMAGE-BLEND, IMAGE-SCALE, IMAGE-CONVERT and IMAGE-MATH work on
+// the RGBA bytes of a whole image directly, instead of a pixel at a time as
+// TUPLE!s.  They ignore the image's series position.
+//
+// Alpha is not premultiplied (255 is opaque), and the rounding of products
+// like `color * alpha / 255` is exact.  Fills, channel math, inversion,
+// premultiplying and blending onto opaque pixels are done four pixels at a
+// time with SSE2 on x86 (which every x86-64 CPU has).  Images of at least
+// IMAGE_THREAD_MIN pixels are worked on by several threads, each doing a
+// band of rows.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+
+#define IMAGE_THREAD_MIN (1 << 18)
+
+#if !defined(REBOL_NO_IMAGE_SIMD) && (defined(__SSE2__) \
+    || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+
+    #define IMAGE_SIMD_X86
+    #include <emmintrin.h>
+#endif
+
+// Exactly rounded x / 255, for x up to 255 * 255
+//
+#define DIV_255(x) \
+    ((((x) + 128) + (((x) + 128) >> 8)) >> 8)
+
+enum Reb_Image_Op {
+    IOP_ADD,
+    IOP_SUBTRACT,
+    IOP_MULTIPLY,
+    IOP_MINIMUM,
+    IOP_MAXIMUM,
+    IOP_GRAYSCALE,
+    IOP_INVERT,
+    IOP_SWAP_RB,
+    IOP_PREMULTIPLY,
+    IOP_UNPREMULTIPLY
+};
+
+struct Reb_Image_Job;
+typedef void (IMAGE_ROWS)(struct Reb_Image_Job *job, REBLEN top, REBLEN end);
+
+struct Reb_Image_Job {
+    IMAGE_ROWS *rows;  // does rows [top, end) of the job
+
+    REBYTE *dst;  // first pixel to change
+    REBLEN dst_pitch;  // bytes from a row of dst to the next
+    REBLEN width;  // pixels to change in each row
+    REBLEN height;  // rows to change
+
+    const REBYTE *src;  // first source pixel (for blend and scale)
+    REBLEN src_pitch;
+    REBLEN src_width;
+    REBLEN src_height;
+
+    enum Reb_Image_Op op;
+    REBYTE pixel[4];  // fill color, or per-channel operand
+    REBLEN opacity;  // 0 to 255, source alpha is scaled by this to blend
+
+    REBLEN *x_lo;  // for scaling: where each column samples the source
+    REBLEN *x_hi;
+    REBLEN *x_weight;
+};
+
+
+#ifdef IMAGE_SIMD_X86
+
+// Spread the 4 bytes of a pixel into all four 32-bit lanes
+//
+static inline __m128i Splat_Pixel_Sse2(const REBYTE pixel[4]) {
+    uint32_t u;
+    memcpy(&u, pixel, 4);
+    return _mm_set1_epi32(cast(int, u));
+}
+
+// Exactly rounded x * y / 255 in 16-bit lanes, for x and y up to 255
+//
+static inline __m128i Mul_Div_255_Sse2(__m128i x, __m128i y) {
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(x, y), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+// Copy each 16-bit pixel's alpha lane to its other three lanes
+//
+static inline __m128i Spread_Alpha_Sse2(__m128i x) {
+    x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm_shufflehi_epi16(x, _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+#endif
+
+
+//
+//  Fill_Rows: C
+//
+static void Fill_Rows(struct Reb_Image_Job *job, REBLEN top, REBLEN end)
+{
+    REBLEN y;
+    for (y = top; y < end; ++y) {
+        REBYTE *p = job->dst + y * job->dst_pitch;
+        REBLEN n = job->width;
+
+      #ifdef IMAGE_SIMD_X86
+        __m128i v = Splat_Pixel_Sse2(job->pixel);
+        for (; n >= 4; n -= 4, p += 16)
+            _mm_storeu_si128(cast(__m128i*, p), v);
+      #endif
+
+        for (; n > 0; --n, p += 4)
+            memcpy(p, job->pixel, 4);
+    }
+}
+
+
+//
+//  Math_Rows: C
+//
+// Channel arithmetic, saturating at 0 and 255.  MULTIPLY scales by the
+// operand over 255, so 255 leaves a channel alone.  (Channels the caller
+// wants left alone get such an identity operand, so no masking is needed.)
+//
+static void Math_Rows(struct Reb_Image_Job *job, REBLEN top, REBLEN end)
+{
+    const REBYTE *v = job->pixel;
+
+    REBLEN y;
+    for (y = top; y < end; ++y) {
+        REBYTE *p = job->dst + y * job->dst_pitch;
+        REBLEN n = job->width;
+
+      #ifdef IMAGE_SIMD_X86
+        __m128i vv = Splat_Pixel_Sse2(v);
+        __m128i zero = _mm_setzero_si128();
+        for (; n >= 4; n -= 4, p += 16) {
+            __m128i x = _mm_loadu_si128(cast(__m128i*, p));
+            switch (job->op) {
+              case IOP_ADD: x = _mm_adds_epu8(x, vv); break;
+              case IOP_SUBTRACT: x = _mm_subs_epu8(x, vv); break;
+              case IOP_MINIMUM: x = _mm_min_epu8(x, vv); break;
+              case IOP_MAXIMUM: x = _mm_max_epu8(x, vv); break;
+              default: {
+                assert(job->op == IOP_MULTIPLY);
+                __m128i v16 = _mm_unpacklo_epi8(vv, zero);  // 2 pixels
+                __m128i lo = Mul_Div_255_Sse2(_mm_unpacklo_epi8(x, zero), v16);
+                __m128i hi = Mul_Div_255_Sse2(_mm_unpackhi_epi8(x, zero), v16);
+                x = _mm_packus_epi16(lo, hi);
+                break; }
+            }
+            _mm_storeu_si128(cast(__m128i*, p), x);
+        }
+      #endif
+
+        for (; n > 0; --n) {
+            int c;
+            for (c = 0; c < 4; ++c, ++p) {
+                switch (job->op) {
+                  case IOP_ADD:
+                    *p = *p + v[c] > 255 ? 255 : *p + v[c];
+                    break;
+
+                  case IOP_SUBTRACT:
+                    *p = *p < v[c] ? 0 : *p - v[c];
+                    break;
+
+                  case IOP_MINIMUM:
+                    *p = MIN(*p, v[c]);
+                    break;
+
+                  case IOP_MAXIMUM:
+                    *p = MAX(*p, v[c]);
+                    break;
+
+                  default:
+                    assert(job->op == IOP_MULTIPLY);
+                    *p = DIV_255(*p * v[c]);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+
+//
+//  Convert_Rows: C
+//
+// GRAYSCALE uses Rec. 601 luma weights, and UNPREMULTIPLY leaves pixels
+// with zero alpha as they are.
+//
+static void Convert_Rows(struct Reb_Image_Job *job, REBLEN top, REBLEN end)
+{
+    REBLEN y;
+    for (y = top; y < end; ++y) {
+        REBYTE *p = job->dst + y * job->dst_pitch;
+        REBLEN n = job->width;
+
+      #ifdef IMAGE_SIMD_X86
+        __m128i rgb = _mm_set1_epi32(0x00FFFFFF);  // lanes are little-endian
+        __m128i zero = _mm_setzero_si128();
+        for (; n >= 4; n -= 4, p += 16) {
+            __m128i x = _mm_loadu_si128(cast(__m128i*, p));
+            if (job->op == IOP_INVERT)
+                x = _mm_xor_si128(x, rgb);
+            else if (job->op == IOP_SWAP_RB) {
+                __m128i ga = _mm_andnot_si128(_mm_set1_epi32(0x00FF00FF), x);
+                __m128i r = _mm_and_si128(x, _mm_set1_epi32(0x000000FF));
+                __m128i b = _mm_and_si128(x, _mm_set1_epi32(0x00FF0000));
+                x = _mm_or_si128(
+                    ga,
+                    _mm_or_si128(_mm_slli_epi32(r, 16), _mm_srli_epi32(b, 16))
+                );
+            }
+            else if (job->op == IOP_PREMULTIPLY) {
+                __m128i lo = _mm_unpacklo_epi8(x, zero);
+                __m128i hi = _mm_unpackhi_epi8(x, zero);
+                lo = Mul_Div_255_Sse2(lo, Spread_Alpha_Sse2(lo));
+                hi = Mul_Div_255_Sse2(hi, Spread_Alpha_Sse2(hi));
+                x = _mm_or_si128(  // alpha*alpha/255 is wrong, put it back
+                    _mm_and_si128(_mm_packus_epi16(lo, hi), rgb),
+                    _mm_andnot_si128(rgb, x)
+                );
+            }
+            else
+                break;  // the rest are done a pixel at a time
+            _mm_storeu_si128(cast(__m128i*, p), x);
+        }
+      #endif
+
+        for (; n > 0; --n, p += 4) {
+            switch (job->op) {
+              case IOP_GRAYSCALE: {
+                REBYTE luma = (77 * p[0] + 150 * p[1] + 29 * p[2] + 128) >> 8;
+                p[0] = p[1] = p[2] = luma;
+                break; }
+
+              case IOP_INVERT:
+                p[0] = 255 - p[0];
+                p[1] = 255 - p[1];
+                p[2] = 255 - p[2];
+                break;
+
+              case IOP_SWAP_RB: {
+                REBYTE r = p[0];
+                p[0] = p[2];
+                p[2] = r;
+                break; }
+
+              case IOP_PREMULTIPLY:
+                p[0] = DIV_255(p[0] * p[3]);
+                p[1] = DIV_255(p[1] * p[3]);
+                p[2] = DIV_255(p[2] * p[3]);
+                break;
+
+              default: {
+                assert(job->op == IOP_UNPREMULTIPLY);
+                REBLEN a = p[3];
+                if (a == 0)
+                    break;
+                int c;
+                for (c = 0; c < 3; ++c) {
+                    REBLEN u = (p[c] * 255 + a / 2) / a;
+                    p[c] = u > 255 ? 255 : u;
+                }
+                break; }
+            }
+        }
+    }
+}
+
+
+//
+//  Blend_Rows: C
+//
+// Composite the source over the destination ("source over" in Porter-Duff
+// terms), with the source's alpha first scaled by the opacity.
+//
+static void Blend_Rows(struct Reb_Image_Job *job, REBLEN top, REBLEN end)
+{
+    REBLEN opacity = job->opacity;
+
+    REBLEN y;
+    for (y = top; y < end; ++y) {
+        REBYTE *d = job->dst + y * job->dst_pitch;
+        const REBYTE *s = job->src + y * job->src_pitch;
+        REBLEN n = job->width;
+
+      #ifdef IMAGE_SIMD_X86
+        //
+        // When all four destination pixels are opaque the result is too, and
+        // each channel is just `(s * a + d * (255 - a)) / 255`.
+        //
+        __m128i alpha = _mm_set1_epi32(cast(int, 0xFF000000));
+        __m128i ones = _mm_set1_epi16(255);
+        __m128i op16 = _mm_set1_epi16(cast(short, opacity));
+        __m128i zero = _mm_setzero_si128();
+        for (; n >= 4; n -= 4, d += 16, s += 16) {
+            __m128i dx = _mm_loadu_si128(cast(__m128i*, d));
+            __m128i opaque = _mm_cmpeq_epi32(_mm_and_si128(dx, alpha), alpha);
+            if (_mm_movemask_epi8(opaque) != 0xFFFF)
+                break;  // finish the row a pixel at a time
+
+            __m128i sx = _mm_loadu_si128(cast(const __m128i*, s));
+            __m128i out[2];
+            int half;
+            for (half = 0; half < 2; ++half) {
+                __m128i s16 = half == 0
+                    ? _mm_unpacklo_epi8(sx, zero)
+                    : _mm_unpackhi_epi8(sx, zero);
+                __m128i d16 = half == 0
+                    ? _mm_unpacklo_epi8(dx, zero)
+                    : _mm_unpackhi_epi8(dx, zero);
+                __m128i a = Spread_Alpha_Sse2(s16);
+                if (opacity != 255)
+                    a = Mul_Div_255_Sse2(a, op16);
+
+                __m128i t = _mm_add_epi16(  // at most 255 * 255, no wrap
+                    _mm_mullo_epi16(s16, a),
+                    _mm_mullo_epi16(d16, _mm_sub_epi16(ones, a))
+                );
+                t = _mm_add_epi16(t, _mm_set1_epi16(128));
+                out[half] = _mm_srli_epi16(
+                    _mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8
+                );
+            }
+            _mm_storeu_si128(
+                cast(__m128i*, d),
+                _mm_or_si128(_mm_packus_epi16(out[0], out[1]), alpha)
+            );
+        }
+      #endif
+
+        for (; n > 0; --n, d += 4, s += 4) {
+            REBLEN a = s[3];
+            if (opacity != 255)
+                a = DIV_255(a * opacity);
+            if (a == 0)
+                continue;
+
+            REBLEN da = d[3];
+            int c;
+            if (da == 255) {
+                for (c = 0; c < 3; ++c)
+                    d[c] = DIV_255(s[c] * a + d[c] * (255 - a));
+                continue;
+            }
+
+            REBLEN oa = a + DIV_255(da * (255 - a));
+            REBLEN den = oa * 255;
+            for (c = 0; c < 3; ++c) {
+                REBLEN num = s[c] * a * 255 + d[c] * da * (255 - a);
+                d[c] = (num + den / 2) / den;
+            }
+            d[3] = oa;
+        }
+    }
+}
+
+
+//
+//  Bilinear_Rows: C
+//
+// Samples are taken at pixel centers, interpolating between the nearest two
+// source rows and columns with 8-bit weights.  (x_lo, x_hi and x_weight give
+// the columns and the weight of the second one, for each output column.)
+//
+static void Bilinear_Rows(struct Reb_Image_Job *job, REBLEN top, REBLEN end)
+{
+    REBLEN y;
+    for (y = top; y < end; ++y) {
+        int64_t fy = (
+            (2 * cast(int64_t, y) + 1) * job->src_height * 256
+        ) / (2 * job->height) - 128;
+        if (fy < 0)
+            fy = 0;
+        REBLEN y_lo = cast(REBLEN, fy >> 8);
+        REBLEN wy = cast(REBLEN, fy & 255);
+        if (y_lo >= job->src_height - 1) {
+            y_lo = job->src_height - 1;
+            wy = 0;
+        }
+        REBLEN y_hi = wy == 0 ? y_lo : y_lo + 1;
+
+        const REBYTE *row_lo = job->src + y_lo * job->src_pitch;
+        const REBYTE *row_hi = job->src + y_hi * job->src_pitch;
+        REBYTE *d = job->dst + y * job->dst_pitch;
+
+        REBLEN x;
+        for (x = 0; x < job->width; ++x, d += 4) {
+            const REBYTE *p00 = row_lo + job->x_lo[x] * 4;
+            const REBYTE *p01 = row_lo + job->x_hi[x] * 4;
+            const REBYTE *p10 = row_hi + job->x_lo[x] * 4;
+            const REBYTE *p11 = row_hi + job->x_hi[x] * 4;
+            REBLEN wx = job->x_weight[x];
+
+            int c;
+            for (c = 0; c < 4; ++c) {
+                REBLEN upper = p00[c] * (256 - wx) + p01[c] * wx;
+                REBLEN lower = p10[c] * (256 - wx) + p11[c] * wx;
+                d[c] = (upper * (256 - wy) + lower * wy + 32768) >> 16;
+            }
+        }
+    }
+}
+
+
+//
+//  Box_Rows: C
+//
+// Each output pixel is the rounded average of the source pixels in its box.
+// (x_lo and x_hi give the span of source columns for each output column.)
+//
+static void Box_Rows(struct Reb_Image_Job *job, REBLEN top, REBLEN end)
+{
+    REBLEN y;
+    for (y = top; y < end; ++y) {
+        REBLEN y_lo = y * job->src_height / job->height;
+        REBLEN y_hi = (y + 1) * job->src_height / job->height;
+        if (y_hi <= y_lo)
+            y_hi = y_lo + 1;
+
+        REBYTE *d = job->dst + y * job->dst_pitch;
+
+        REBLEN x;
+        for (x = 0; x < job->width; ++x, d += 4) {
+            uint64_t sum[4] = {0, 0, 0, 0};
+            REBLEN yy;
+            for (yy = y_lo; yy < y_hi; ++yy) {
+                const REBYTE *s = job->src + yy * job->src_pitch;
+                REBLEN xx;
+                for (xx = job->x_lo[x]; xx < job->x_hi[x]; ++xx) {
+                    sum[0] += s[xx * 4];
+                    sum[1] += s[xx * 4 + 1];
+                    sum[2] += s[xx * 4 + 2];
+                    sum[3] += s[xx * 4 + 3];
+                }
+            }
+            uint64_t count = cast(uint64_t, y_hi - y_lo)
+                * (job->x_hi[x] - job->x_lo[x]);
+            int c;
+            for (c = 0; c < 4; ++c)
+                d[c] = cast(REBYTE, (sum[c] + count / 2) / count);
+        }
+    }
+}
+
+
+struct Reb_Image_Band {
+    struct Reb_Image_Job *job;
+    REBLEN top;
+    REBLEN end;
+};
+
+#ifdef TO_WINDOWS
+    static DWORD WINAPI Image_Band_Thread(LPVOID p) {
+        struct Reb_Image_Band *band = cast(struct Reb_Image_Band*, p);
+        (*band->job->rows)(band->job, band->top, band->end);
+        return 0;
+    }
+    typedef HANDLE REBTHR;
+#else
+    static void *Image_Band_Thread(void *p) {
+        struct Reb_Image_Band *band = cast(struct Reb_Image_Band*, p);
+        (*band->job->rows)(band->job, band->top, band->end);
+        return nullptr;
+    }
+    typedef pthread_t REBTHR;
+#endif
+
+
+static REBLEN Num_Cpus(void)
+{
+  #ifdef TO_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+  #else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n < 1 ? 1 : cast(REBLEN, n);
+  #endif
+}
+
+
+//
+//  Run_Image_Job: C
+//
+// Do all the rows of `job`, in bands on several threads if it is big enough.
+// The bands only write their own rows of the destination.
+//
+static void Run_Image_Job(struct Reb_Image_Job *job)
+{
+    REBLEN work = job->width * job->height;
+    if (job->src)
+        work = MAX(work, job->src_width * job->src_height);
+
+    REBLEN bands = 1;
+    if (work >= IMAGE_THREAD_MIN) {
+        bands = Num_Cpus();
+        if (bands > 64)
+            bands = 64;
+        if (bands > job->height)
+            bands = job->height;
+    }
+
+    if (bands <= 1) {
+        (*job->rows)(job, 0, job->height);
+        return;
+    }
+
+    struct Reb_Image_Band *band = rebAllocN(struct Reb_Image_Band, bands);
+    REBTHR *handles = rebAllocN(REBTHR, bands);
+    bool *started = rebAllocN(bool, bands);
+
+    REBLEN per_band = (job->height + bands - 1) / bands;
+
+    REBLEN t;
+    for (t = 0; t < bands; ++t) {
+        band[t].job = job;
+        band[t].top = MIN(t * per_band, job->height);
+        band[t].end = MIN(band[t].top + per_band, job->height);
+
+        started[t] = false;
+        if (t == 0)
+            continue;  // band 0 is done on this thread
+
+      #ifdef TO_WINDOWS
+        handles[t] = CreateThread(
+            nullptr, 0, &Image_Band_Thread, &band[t], 0, nullptr
+        );
+        started[t] = (handles[t] != nullptr);
+      #else
+        started[t] = (
+            pthread_create(
+                &handles[t], nullptr, &Image_Band_Thread, &band[t]
+            ) == 0
+        );
+      #endif
+    }
+
+    for (t = 0; t < bands; ++t) {
+        if (not started[t])
+            (*job->rows)(job, band[t].top, band[t].end);
+    }
+
+    for (t = 1; t < bands; ++t) {
+        if (not started[t])
+            continue;
+      #ifdef TO_WINDOWS
+        WaitForSingleObject(handles[t], INFINITE);
+        CloseHandle(handles[t]);
+      #else
+        pthread_join(handles[t], nullptr);
+      #endif
+    }
+
+    rebFree(started);
+    rebFree(handles);
+    rebFree(band);
+}
+
+
+//
+//  Init_Image_Job: C
+//
+// Set up a job to change every pixel of an image.
+//
+static void Init_Image_Job(
+    struct Reb_Image_Job *job,
+    IMAGE_ROWS *rows,
+    const REBVAL *image
+){
+    if (not IS_IMAGE(image))
+        fail (image);
+
+    job->rows = rows;
+    job->dst = VAL_IMAGE_HEAD(image);
+    job->dst_pitch = VAL_IMAGE_WIDTH(image) * 4;
+    job->width = VAL_IMAGE_WIDTH(image);
+    job->height = VAL_IMAGE_HEIGHT(image);
+    job->src = nullptr;
+    job->src_pitch = 0;
+    job->src_width = 0;
+    job->src_height = 0;
+    job->opacity = 255;
+    job->x_lo = job->x_hi = job->x_weight = nullptr;
+}
+
+
+//
+//  export image-fill: native [
+//
+//  {Set all the pixels of an IMAGE!, or a rectangle of them, to one color}
+//
+//      return: [any-value!]
+//      image [any-value!]
+//      color "Alpha is opaque if not given"
+//          [tuple!]
+//      /at "Top left corner of the rectangle (clipped to the image)"
+//          [pair!]
+//      /size "Width and height of the rectangle (default is to the edges)"
+//          [pair!]
+//  ]
+//
+REBNATIVE(image_fill)
+{
+    IMAGE_INCLUDE_PARAMS_OF_IMAGE_FILL;
+
+    REBVAL *image = ARG(image);
+
+    struct Reb_Image_Job job;
+    Init_Image_Job(&job, &Fill_Rows, image);
+    FAIL_IF_READ_ONLY(image);
+    Set_Pixel_Tuple(job.pixel, ARG(color));
+
+    REBINT x = REF(at) ? VAL_PAIR_X_INT(ARG(at)) : 0;
+    REBINT y = REF(at) ? VAL_PAIR_Y_INT(ARG(at)) : 0;
+    REBINT w = REF(size)
+        ? VAL_PAIR_X_INT(ARG(size))
+        : cast(REBINT, job.width) - x;
+    REBINT h = REF(size)
+        ? VAL_PAIR_Y_INT(ARG(size))
+        : cast(REBINT, job.height) - y;
+    if (REF(size) and (w < 0 or h < 0))
+        fail (PAR(size));
+
+    if (x < 0) {  // clip the left and top...
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (x + w > cast(REBINT, job.width))  // ...then the right and bottom
+        w = cast(REBINT, job.width) - x;
+    if (y + h > cast(REBINT, job.height))
+        h = cast(REBINT, job.height) - y;
+
+    if (w > 0 and h > 0) {
+        job.dst += y * job.dst_pitch + x * 4;
+        job.width = w;
+        job.height = h;
+        Run_Image_Job(&job);
+    }
+
+    RETURN (image);
+}
+
+
+//
+//  export image-blend: native [
+//
+//  {Composite one IMAGE! over another using the source's alpha channel}
+//
+//      return: "The changed IMAGE"
+//          [any-value!]
+//      image [any-value!]
+//      source "Image to draw onto IMAGE (parts falling outside are clipped)"
+//          [any-value!]
+//      /at "Where SOURCE's top left corner goes in IMAGE"
+//          [pair!]
+//      /opacity "Multiplies SOURCE's alpha, 0 to 255"
+//          [integer!]
+//  ]
+//
+REBNATIVE(image_blend)
+{
+    IMAGE_INCLUDE_PARAMS_OF_IMAGE_BLEND;
+
+    REBVAL *image = ARG(image);
+    REBVAL *source = ARG(source);
+
+    struct Reb_Image_Job job;
+    Init_Image_Job(&job, &Blend_Rows, image);
+    FAIL_IF_READ_ONLY(image);
+    if (not IS_IMAGE(source))
+        fail (PAR(source));
+
+    if (REF(opacity)) {
+        REBI64 opacity = VAL_INT64(ARG(opacity));
+        if (opacity < 0 or opacity > 255)
+            fail (Error_Out_Of_Range(ARG(opacity)));
+        job.opacity = cast(REBLEN, opacity);
+    }
+
+    REBINT sw = VAL_IMAGE_WIDTH(source);
+    REBINT sh = VAL_IMAGE_HEIGHT(source);
+    REBINT dx = REF(at) ? VAL_PAIR_X_INT(ARG(at)) : 0;
+    REBINT dy = REF(at) ? VAL_PAIR_Y_INT(ARG(at)) : 0;
+    REBINT sx = 0;
+    REBINT sy = 0;
+    if (dx < 0) {
+        sx = -dx;
+        dx = 0;
+    }
+    if (dy < 0) {
+        sy = -dy;
+        dy = 0;
+    }
+    REBINT w = MIN(sw - sx, cast(REBINT, job.width) - dx);
+    REBINT h = MIN(sh - sy, cast(REBINT, job.height) - dy);
+
+    // An image blended onto itself is the only way the two can overlap, and
+    // is fine when they line up (the source pixel is read before it is
+    // written).  Otherwise work from a copy, as rows could be read after
+    // earlier rows have changed them.
+    //
+    const REBYTE *src_head = VAL_IMAGE_HEAD(source);
+    REBYTE *copy = nullptr;
+    if (
+        src_head == VAL_IMAGE_HEAD(image)
+        and (sx != dx or sy != dy)
+        and w > 0 and h > 0
+    ){
+        REBLEN bytes = sw * sh * 4;
+        copy = rebAllocN(REBYTE, bytes);
+        memcpy(copy, src_head, bytes);
+        src_head = copy;
+    }
+
+    if (w > 0 and h > 0) {
+        job.dst += dy * job.dst_pitch + dx * 4;
+        job.width = w;
+        job.height = h;
+        job.src = src_head + (sy * sw + sx) * 4;
+        job.src_pitch = sw * 4;
+        job.src_width = w;
+        job.src_height = h;
+        Run_Image_Job(&job);
+    }
+
+    if (copy)
+        rebFree(copy);
+
+    RETURN (image);
+}
+
+
+//
+//  export image-scale: native [
+//
+//  {Resample an IMAGE! to a new size}
+//
+//      return: "A new image"
+//          [any-value!]
+//      image [any-value!]
+//      size [pair!]
+//      /box "Average the source pixels covering each new one (for shrinking)"
+//  ]
+//
+REBNATIVE(image_scale)
+{
+    IMAGE_INCLUDE_PARAMS_OF_IMAGE_SCALE;
+
+    REBVAL *image = ARG(image);
+
+    struct Reb_Image_Job job;
+    Init_Image_Job(&job, REF(box) ? &Box_Rows : &Bilinear_Rows, image);
+
+    REBINT w = VAL_PAIR_X_INT(ARG(size));
+    REBINT h = VAL_PAIR_Y_INT(ARG(size));
+    if (w < 0 or h < 0)
+        fail (PAR(size));
+
+    job.src = job.dst;
+    job.src_pitch = job.dst_pitch;
+    job.src_width = job.width;
+    job.src_height = job.height;
+
+    Init_Image_Black_Opaque(D_OUT, w, h);
+    if (w == 0 or h == 0)
+        return D_OUT;
+    if (job.src_width == 0 or job.src_height == 0)
+        fail ("Can't scale an image with no pixels to one with some");
+
+    job.dst = VAL_IMAGE_HEAD(D_OUT);
+    job.dst_pitch = w * 4;
+    job.width = w;
+    job.height = h;
+
+    job.x_lo = rebAllocN(REBLEN, w);
+    job.x_hi = rebAllocN(REBLEN, w);
+    job.x_weight = rebAllocN(REBLEN, w);
+
+    REBLEN x;
+    for (x = 0; x < job.width; ++x) {
+        if (REF(box)) {
+            job.x_lo[x] = x * job.src_width / job.width;
+            job.x_hi[x] = (x + 1) * job.src_width / job.width;
+            if (job.x_hi[x] <= job.x_lo[x])
+                job.x_hi[x] = job.x_lo[x] + 1;
+            job.x_weight[x] = 0;
+            continue;
+        }
+
+        int64_t fx = (
+            (2 * cast(int64_t, x) + 1) * job.src_width * 256
+        ) / (2 * job.width) - 128;  // source position, in 256ths of a pixel
+        if (fx < 0)
+            fx = 0;
+        job.x_lo[x] = cast(REBLEN, fx >> 8);
+        job.x_weight[x] = cast(REBLEN, fx & 255);
+        if (job.x_lo[x] >= job.src_width - 1) {
+            job.x_lo[x] = job.src_width - 1;
+            job.x_weight[x] = 0;
+        }
+        job.x_hi[x] = job.x_weight[x] == 0 ? job.x_lo[x] : job.x_lo[x] + 1;
+    }
+
+    Run_Image_Job(&job);
+
+    rebFree(job.x_weight);
+    rebFree(job.x_hi);
+    rebFree(job.x_lo);
+
+    return D_OUT;
+}
+
+
+//
+//  export image-convert: native [
+//
+//  {Change the colors of every pixel of an IMAGE!}
+//
+//      return: "The changed IMAGE"
+//          [any-value!]
+//      image [any-value!]
+//      to "GRAYSCALE, INVERT, SWAP-RB, PREMULTIPLY or UNPREMULTIPLY"
+//          [word!]
+//  ]
+//
+REBNATIVE(image_convert)
+{
+    IMAGE_INCLUDE_PARAMS_OF_IMAGE_CONVERT;
+
+    REBVAL *image = ARG(image);
+
+    struct Reb_Image_Job job;
+    Init_Image_Job(&job, &Convert_Rows, image);
+    FAIL_IF_READ_ONLY(image);
+
+    switch (VAL_WORD_SYM(ARG(to))) {
+      case SYM_GRAYSCALE: job.op = IOP_GRAYSCALE; break;
+      case SYM_INVERT: job.op = IOP_INVERT; break;
+      case SYM_SWAP_RB: job.op = IOP_SWAP_RB; break;
+      case SYM_PREMULTIPLY: job.op = IOP_PREMULTIPLY; break;
+      case SYM_UNPREMULTIPLY: job.op = IOP_UNPREMULTIPLY; break;
+      default:
+        fail (PAR(to));
+    }
+
+    Run_Image_Job(&job);
+
+    RETURN (image);
+}
+
+
+//
+//  export image-math: native [
+//
+//  {Combine each pixel of an IMAGE! with a color, channel by channel}
+//
+//      return: "The changed IMAGE (results are clipped to 0 through 255)"
+//          [any-value!]
+//      op "ADD, SUBTRACT, MULTIPLY (by the value / 255), MINIMUM or MAXIMUM"
+//          [word!]
+//      image [any-value!]
+//      value "A 3-element tuple or an integer leaves the alpha alone"
+//          [tuple! integer!]
+//  ]
+//
+REBNATIVE(image_math)
+{
+    IMAGE_INCLUDE_PARAMS_OF_IMAGE_MATH;
+
+    REBVAL *image = ARG(image);
+    REBVAL *value = ARG(value);
+
+    struct Reb_Image_Job job;
+    Init_Image_Job(&job, &Math_Rows, image);
+    FAIL_IF_READ_ONLY(image);
+
+    REBYTE identity;  // operand that leaves a channel as it is
+    switch (VAL_WORD_SYM(ARG(op))) {
+      case SYM_ADD: job.op = IOP_ADD; identity = 0; break;
+      case SYM_SUBTRACT: job.op = IOP_SUBTRACT; identity = 0; break;
+      case SYM_MULTIPLY: job.op = IOP_MULTIPLY; identity = 255; break;
+      case SYM_MINIMUM: job.op = IOP_MINIMUM; identity = 255; break;
+      case SYM_MAXIMUM: job.op = IOP_MAXIMUM; identity = 0; break;
+      default:
+        fail (PAR(op));
+    }
+
+    if (IS_INTEGER(value)) {
+        REBI64 n = VAL_INT64(value);
+        if (n < 0 or n > 255)
+            fail (Error_Out_Of_Range(value));
+        job.pixel[0] = job.pixel[1] = job.pixel[2] = cast(REBYTE, n);
+        job.pixel[3] = identity;
+    }
+    else {
+        const REBYTE *tup = VAL_TUPLE(value);
+        job.pixel[0] = tup[0];
+        job.pixel[1] = tup[1];
+        job.pixel[2] = tup[2];
+        job.pixel[3] = VAL_TUPLE_LEN(value) > 3 ? tup[3] : identity;
+    }
+
+    Run_Image_Job(&job);
+
+    RETURN (image);
+}
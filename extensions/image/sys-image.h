@@ -145,3 +145,5 @@ extern REB_R TO_Image(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg);
 extern void MF_Image(REB_MOLD *mo, const REBCEL *v, bool form);
 extern REBTYPE(Image);
 extern REB_R PD_Image(REBPVS *pvs, const REBVAL *picker, const REBVAL *opt_setval);
+
+extern void Set_Pixel_Tuple(REBYTE *dp, const RELVAL *tuple);
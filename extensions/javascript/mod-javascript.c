@@ -79,12 +79,12 @@
 //
 #include <emscripten.h>
 
-#if defined(USE_ASYNCIFY) == defined(USE_PTHREADS)
+#if (defined(USE_ASYNCIFY) + defined(USE_PTHREADS) + defined(USE_NO_YIELD)) != 1
     //
     // See %extensions/javascript/README.md for a discussion of the ASYNCIFY
-    // option vs. the PTHREAD option.
+    // option vs. the PTHREAD option vs. the NO_YIELD option.
     //
-    #error "Define one (and only one) of USE_ASYNCIFY or USE_PTHREADS"
+    #error "Define one (and only one) of USE_ASYNCIFY, USE_PTHREADS, USE_NO_YIELD"
 #endif
 
 #if defined(USE_PTHREADS)
@@ -412,7 +412,7 @@ EXTERN_C intptr_t RL_rebPromise(REBFLGS flags, void *p, va_list *vaptr)
     info->next = PG_Promises;
     PG_Promises = info;
 
-  #ifdef USE_ASYNCIFY
+  #if defined(USE_ASYNCIFY) || defined(USE_NO_YIELD)
     EM_ASM(
         { setTimeout(function() { _RL_rebIdle_internal(); }, 0); }
     );  // note `_RL` (leading underscore means no cwrap)
@@ -607,6 +607,21 @@ void RunPromise(void)
     }
 #endif
 
+#if defined(USE_NO_YIELD)
+    //
+    // The NO_YIELD build has neither Asyncify instrumentation nor a worker
+    // thread, so the promise code just runs to completion from a setTimeout.
+    // That's fine so long as nothing in it needs to wait on the MAIN thread
+    // (which is why JS-AWAITERs are refused in this configuration).
+    //
+    EXTERN_C void RL_rebIdle_internal(void)
+    {
+        TRACE("rebIdle() => begin running promise code (no yield)");
+        RunPromise();
+        TRACE("rebIdle() => finished running promise code (no yield)");
+    }
+#endif
+
 
 // The protocol for JavaScript returning Rebol API values to Rebol is to do
 // so with functions that either "resolve" (succeed) or "reject" (e.g. fail).
@@ -832,6 +847,35 @@ REB_R JavaScript_Dispatcher(REBFRM *f)
     }
     TRACE("JavaScript_Dispatcher() => end emscripten_sleep() loop");
 
+    if (PG_Native_State == NATIVE_STATE_RESOLVED)
+        Sync_Native_Result(frame_id);
+    else
+        assert(PG_Native_State == NATIVE_STATE_REJECTED);
+
+  #elif defined(USE_NO_YIELD)  // on MAIN thread, and can't leave it
+
+    // Without Asyncify there's no way to put the C stack in suspended
+    // animation, and without a worker there's no other thread to block.  So
+    // only JS code which resolves or rejects during its body can be run.
+    // (An evaluator that could unwind to a trampoline and be resumed would
+    // lift this, but the C stack is what holds the interpreter state here.)
+    //
+    if (is_awaiter) {
+        PG_Native_State = NATIVE_STATE_NONE;
+        fail ("JS-AWAITER needs a build with USE_ASYNCIFY or USE_PTHREADS");
+    }
+
+    EM_ASM(
+        { reb.RunNative_internal($0, $1) },
+        native_id,  // => $0
+        frame_id  // => $1
+    );
+
+    if (PG_Native_State == NATIVE_STATE_RUNNING) {
+        PG_Native_State = NATIVE_STATE_NONE;
+        fail ("JS-NATIVE did not resolve synchronously (USE_NO_YIELD build)");
+    }
+
     if (PG_Native_State == NATIVE_STATE_RESOLVED)
         Sync_Native_Result(frame_id);
     else
@@ -998,10 +1042,8 @@ REBNATIVE(js_native)
     REBVAL *spec = ARG(spec);
     REBVAL *source = ARG(source);
 
-    REBARR *paramlist = Make_Paramlist_Managed_May_Fail(
-        spec,
-        MKF_RETURN | MKF_KEYWORDS
-    );
+    REBFLGS flags = MKF_RETURN | MKF_KEYWORDS;
+    REBARR *paramlist = Make_Paramlist_Managed_May_Fail(spec, &flags);
 
     REBACT *native = Make_Action(
         paramlist,
@@ -261,50 +261,52 @@ void jpeg_load( char *buffer, int nbytes, char *output )
   /* Start decompressor */
   (void) jpeg_start_decompress(&cinfo);
 
-  /* Process data */
+  /* Process data.  Each batch of scanlines comes out packed at the start of
+   * its row, and is widened to RGBA in place (back to front, so nothing is
+   * overwritten before it is read) while it's still in the cache, rather
+   * than in a second pass over the whole image afterward.
+   */
   while (cinfo.output_scanline < cinfo.output_height) {
-    array[ 0 ] = (JSAMPROW)(output + cinfo.output_scanline * cinfo.image_width * 4);
+    JDIMENSION  first = cinfo.output_scanline;
+    JDIMENSION  got;
+
+    array[ 0 ] = (JSAMPROW)(output + first * cinfo.image_width * 4);
     array[ 1 ] = array[ 0 ] + cinfo.image_width * 4;
     array[ 2 ] = array[ 1 ] + cinfo.image_width * 4;
     array[ 3 ] = array[ 2 ] + cinfo.image_width * 4;
-    jpeg_read_scanlines(&cinfo, array, 4 );
-  }
-
-  if (cinfo.out_color_space != JCS_GRAYSCALE)
-  // convert 3 byte values into four byte ones
-  for ( i=0; i<cinfo.image_height; i++ ) {
-    unsigned char   *cp;
-    unsigned char   *dp;
-
-    cp = (unsigned char *)(output + cinfo.image_width * 3);
-    dp = (unsigned char *)(output + cinfo.image_width * 4);
-    output = ( char * )dp;
-    for ( j=0; j<cinfo.image_width; j++ ) {
-        cp -= 3;
-        *--dp = 0xff; // opaque alpha (going in reverse rgba order...)
-        *--dp = cp[2]; // blue
-        *--dp = cp[1]; // green
-        *--dp = cp[0]; // red
-    }
-  }
-  else
-  // convert 1 byte value into four byte ones
-    for ( i=0; i<cinfo.image_height; i++ ) {
-      unsigned char *cp;
-      unsigned char *dp;
-      unsigned char c;
-
-      cp = (unsigned char *)(output + cinfo.image_width);
-      dp = (unsigned char *)(output + cinfo.image_width * 4);
-      output = ( char * )dp;
-      for ( j=0; j<cinfo.image_width; j++ ) {
-        c = *--cp;
-        *--dp = 0xff; // opaque alpha (going in reverse rgba order...)
-        *--dp = c; // blue
-        *--dp = c; // green
-        *--dp = c; // red
+    got = jpeg_read_scanlines(&cinfo, array, 4 );
+
+    for ( i=0; i<got; i++ ) {
+      unsigned char   *cp;
+      unsigned char   *dp;
+      unsigned char   c;
+
+      dp = (unsigned char *)array[ i ] + cinfo.image_width * 4;
+
+      if (cinfo.out_color_space != JCS_GRAYSCALE) {
+        // convert 3 byte values into four byte ones
+        cp = (unsigned char *)array[ i ] + cinfo.image_width * 3;
+        for ( j=0; j<cinfo.image_width; j++ ) {
+          cp -= 3;
+          *--dp = 0xff; // opaque alpha (going in reverse rgba order...)
+          *--dp = cp[2]; // blue
+          *--dp = cp[1]; // green
+          *--dp = cp[0]; // red
+        }
+      }
+      else {
+        // convert 1 byte value into four byte ones
+        cp = (unsigned char *)array[ i ] + cinfo.image_width;
+        for ( j=0; j<cinfo.image_width; j++ ) {
+          c = *--cp;
+          *--dp = 0xff; // opaque alpha (going in reverse rgba order...)
+          *--dp = c; // blue
+          *--dp = c; // green
+          *--dp = c; // red
+        }
       }
     }
+  }
 
   /* Finish decompression and release memory.
    * I must do it in this order because output module has allocated memory
@@ -0,0 +1,820 @@
+//
+//  File: %mod-json.c
+//  Summary: "Native JSON encoder and decoder (JSON codec)"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2019 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See %extensions/json/README.md
+//
+// Decoding is a recursive descent over the UTF-8 bytes.  Items of arrays and
+// the keys and values of objects are pushed to the data stack as they are
+// decoded, so each BLOCK! is made at its final size in one step when its `]`
+// is reached, and each MAP! gets a hash table sized for its keys up front.
+// Objects become MAP!s with TEXT! keys (compared case-sensitively, as JSON
+// does), strings become TEXT!, and `null` becomes BLANK!.
+//
+// Strings are the bulk of most JSON, and the only bytes in them that need
+// attention are `"`, `\`, and the control characters.  UTF-8 never uses
+// ASCII bytes inside a multi-byte character, so the runs between those can
+// be found bytewise--16 bytes per step with SSE2--and copied (with one
+// validation pass) instead of decoded a codepoint at a time.
+//
+// Encoding goes the other way, straight into a BINARY!.  BLOCK! becomes an
+// array, MAP! and OBJECT! become objects, and words and ANY-STRING! become
+// strings.  Other datatypes have no obvious JSON form, and are errors.
+//
+
+#include "sys-core.h"
+
+#include "tmp-mod-json.h"
+
+
+#if !defined(REBOL_NO_STRING_SIMD) && (defined(__SSE2__) \
+    || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+
+    #define JSON_SIMD_SSE2
+    #include <emmintrin.h>
+
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+
+    inline static unsigned int Lowest_Bit(unsigned int mask) {
+        unsigned long i;
+        _BitScanForward(&i, mask);
+        return i;
+    }
+  #else
+    #define Lowest_Bit(mask) \
+        cast(unsigned int, __builtin_ctz(mask))
+  #endif
+#endif
+
+#define Is_Json_Digit(b) \
+    ((b) >= '0' and (b) <= '9')
+
+#define Is_Json_Space(b) \
+    ((b) == ' ' or (b) == '\t' or (b) == LF or (b) == CR)
+
+
+// Return the first `"`, `\` or control character in [cp, ep), else `ep`.
+//
+static const REBYTE *Json_Find_String_Special(
+    const REBYTE *cp,
+    const REBYTE *ep
+){
+  #if defined(JSON_SIMD_SSE2)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i last_control = _mm_set1_epi8(0x1F);
+    for (; ep - cp >= 16; cp += 16) {
+        __m128i v = _mm_loadu_si128(cast(const __m128i*, cp));
+
+        // Bytes are compared unsigned by whether the max with 0x1F changes
+        // them, as SSE2 only has signed less-than for bytes.
+        //
+        __m128i special = _mm_or_si128(
+            _mm_cmpeq_epi8(v, quote),
+            _mm_cmpeq_epi8(v, backslash)
+        );
+        special = _mm_or_si128(
+            special,
+            _mm_cmpeq_epi8(_mm_max_epu8(v, last_control), last_control)
+        );
+
+        int mask = _mm_movemask_epi8(special);
+        if (mask != 0)
+            return cp + Lowest_Bit(mask);
+    }
+  #endif
+
+    for (; cp != ep; ++cp)
+        if (*cp == '"' or *cp == '\\' or *cp < 0x20)
+            return cp;
+    return ep;
+}
+
+
+// Return the first `"`, `\`, `,`, `[`, `]`, `{` or `}` in [cp, ep), else
+// `ep`.  This is what the streaming decode uses to find where an item ends
+// without decoding it.
+//
+static const REBYTE *Json_Find_Structural(const REBYTE *cp, const REBYTE *ep)
+{
+  #if defined(JSON_SIMD_SSE2)
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    const __m128i open_brace = _mm_set1_epi8('{');
+    const __m128i close_brace = _mm_set1_epi8('}');
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i comma = _mm_set1_epi8(',');
+    for (; ep - cp >= 16; cp += 16) {
+        __m128i v = _mm_loadu_si128(cast(const __m128i*, cp));
+
+        // `[` and `]` are `{` and `}` without the 0x20 bit, and no other
+        // bytes become braces when it is set, so one OR tests for all four.
+        //
+        __m128i folded = _mm_or_si128(v, case_bit);
+        __m128i special = _mm_or_si128(
+            _mm_cmpeq_epi8(folded, open_brace),
+            _mm_cmpeq_epi8(folded, close_brace)
+        );
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(v, quote));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(v, backslash));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(v, comma));
+
+        int mask = _mm_movemask_epi8(special);
+        if (mask != 0)
+            return cp + Lowest_Bit(mask);
+    }
+  #endif
+
+    for (; cp != ep; ++cp) {
+        switch (*cp) {
+          case '"': case '\\': case ',':
+          case '[': case ']': case '{': case '}':
+            return cp;
+        }
+    }
+    return ep;
+}
+
+
+//=//// DECODING //////////////////////////////////////////////////////////=//
+
+struct Json_Decoder {
+    const REBYTE *bp;
+    const REBYTE *ep;
+};
+
+inline static void Json_Skip_Space(struct Json_Decoder *dec) {
+    while (dec->bp != dec->ep and Is_Json_Space(*dec->bp))
+        ++dec->bp;
+}
+
+static void Json_Expect_Literal(struct Json_Decoder *dec, const char *word)
+{
+    REBSIZ size = strsize(word);
+    if (
+        cast(REBSIZ, dec->ep - dec->bp) < size
+        or memcmp(dec->bp, word, size) != 0
+    ){
+        fail (Error_Bad_Media_Raw());
+    }
+    dec->bp += size;
+}
+
+static REBUNI Json_Scan_Hex4(struct Json_Decoder *dec)
+{
+    if (dec->ep - dec->bp < 4)
+        fail (Error_Bad_Media_Raw());
+
+    REBUNI c = 0;
+    REBLEN n;
+    for (n = 0; n < 4; ++n) {
+        REBYTE b = *dec->bp++;
+        REBYTE nibble;
+        if (Is_Json_Digit(b))
+            nibble = b - '0';
+        else if (b >= 'a' and b <= 'f')
+            nibble = b - 'a' + 10;
+        else if (b >= 'A' and b <= 'F')
+            nibble = b - 'A' + 10;
+        else
+            fail (Error_Bad_Media_Raw());
+        c = (c << 4) | nibble;
+    }
+    return c;
+}
+
+static REBUNI Json_Scan_Escape(struct Json_Decoder *dec)
+{
+    if (dec->bp == dec->ep)
+        fail (Error_Bad_Media_Raw());
+
+    switch (*dec->bp++) {
+      case '"': return '"';
+      case '\\': return '\\';
+      case '/': return '/';
+      case 'b': return BS;
+      case 'f': return '\f';
+      case 'n': return LF;
+      case 'r': return CR;
+      case 't': return '\t';
+      case 'u': break;
+      default:
+        fail (Error_Bad_Media_Raw());
+    }
+
+    REBUNI c = Json_Scan_Hex4(dec);
+    if (c >= 0xD800 and c <= 0xDBFF) {  // high surrogate, low must follow
+        if (
+            dec->ep - dec->bp < 2
+            or dec->bp[0] != '\\'
+            or dec->bp[1] != 'u'
+        ){
+            fail (Error_Bad_Media_Raw());
+        }
+        dec->bp += 2;
+        REBUNI low = Json_Scan_Hex4(dec);
+        if (low < 0xDC00 or low > 0xDFFF)
+            fail (Error_Bad_Media_Raw());
+        c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+    }
+    else if (c >= 0xDC00 and c <= 0xDFFF)
+        fail (Error_Bad_Media_Raw());  // low surrogate on its own
+    else if (c == 0)
+        fail (Error_Illegal_Zero_Byte_Raw());
+
+    return c;
+}
+
+// Called with dec->bp just after the opening quote.
+//
+static REBSTR *Json_Scan_String(struct Json_Decoder *dec)
+{
+    const REBYTE *cp = Json_Find_String_Special(dec->bp, dec->ep);
+    if (cp != dec->ep and *cp == '"') {  // no escapes, copy it in one step
+        REBSTR *s = Append_UTF8_May_Fail(
+            nullptr, cs_cast(dec->bp), cp - dec->bp, STRMODE_ALL_CODEPOINTS
+        );
+        dec->bp = cp + 1;
+        return s;
+    }
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    while (true) {
+        if (cp != dec->bp)
+            Append_UTF8_May_Fail(
+                mo->series,
+                cs_cast(dec->bp),
+                cp - dec->bp,
+                STRMODE_ALL_CODEPOINTS
+            );
+
+        if (cp == dec->ep or *cp < 0x20)
+            fail (Error_Bad_Media_Raw());  // unterminated, or raw control
+
+        dec->bp = cp + 1;
+        if (*cp == '"')
+            break;
+
+        Append_Codepoint(mo->series, Json_Scan_Escape(dec));
+        cp = Json_Find_String_Special(dec->bp, dec->ep);
+    }
+
+    return Pop_Molded_String(mo);
+}
+
+static void Json_Push_Number(struct Json_Decoder *dec)
+{
+    const REBYTE *start = dec->bp;
+    const REBYTE *cp = start;
+    const REBYTE *ep = dec->ep;
+
+    bool negative = false;
+    if (cp != ep and *cp == '-') {
+        negative = true;
+        ++cp;
+    }
+    if (cp == ep or not Is_Json_Digit(*cp))
+        fail (Error_Bad_Media_Raw());
+
+    // Integers are gathered as they are checked, which covers most numbers
+    // in practice.  Ones with a fraction or exponent, or too big for an
+    // INTEGER!, go to the DECIMAL! scanner once their syntax is known good.
+    //
+    REBU64 u = 0;
+    bool overflow = false;
+    if (*cp == '0')
+        ++cp;  // JSON doesn't allow leading zeros
+    else {
+        for (; cp != ep and Is_Json_Digit(*cp); ++cp) {
+            if (u > (UINT64_MAX - 9) / 10)
+                overflow = true;
+            else
+                u = u * 10 + (*cp - '0');
+        }
+    }
+
+    bool integral = true;
+    if (cp != ep and *cp == '.') {
+        integral = false;
+        ++cp;
+        if (cp == ep or not Is_Json_Digit(*cp))
+            fail (Error_Bad_Media_Raw());
+        while (cp != ep and Is_Json_Digit(*cp))
+            ++cp;
+    }
+    if (cp != ep and (*cp == 'e' or *cp == 'E')) {
+        integral = false;
+        ++cp;
+        if (cp != ep and (*cp == '+' or *cp == '-'))
+            ++cp;
+        if (cp == ep or not Is_Json_Digit(*cp))
+            fail (Error_Bad_Media_Raw());
+        while (cp != ep and Is_Json_Digit(*cp))
+            ++cp;
+    }
+    dec->bp = cp;
+
+    if (integral and not overflow) {
+        if (not negative and u <= INT64_MAX) {
+            Init_Integer(DS_PUSH(), cast(REBI64, u));
+            return;
+        }
+        if (negative and u <= cast(REBU64, INT64_MAX) + 1) {
+            Init_Integer(DS_PUSH(), cast(REBI64, ~u + 1));
+            return;
+        }
+    }
+
+    REBLEN len = cp - start;
+    if (len > MAX_NUM_LEN)
+        fail (Error_Bad_Media_Raw());
+
+    REBYTE buf[MAX_NUM_LEN + 1];  // Scan_Decimal() needs a terminator
+    memcpy(buf, start, len);
+    buf[len] = '\0';
+
+    if (not Scan_Decimal(DS_PUSH(), buf, len, true))
+        fail (Error_Bad_Media_Raw());
+}
+
+static void Json_Push_Value(struct Json_Decoder *dec)
+{
+    if (C_STACK_OVERFLOWING(&dec))
+        Fail_Stack_Overflow();
+
+    Json_Skip_Space(dec);
+    if (dec->bp == dec->ep)
+        fail (Error_Bad_Media_Raw());
+
+    switch (*dec->bp) {
+      case '[': {
+        ++dec->bp;
+        REBDSP dsp_orig = DSP;
+
+        Json_Skip_Space(dec);
+        if (dec->bp != dec->ep and *dec->bp == ']')
+            ++dec->bp;
+        else while (true) {
+            Json_Push_Value(dec);
+            Json_Skip_Space(dec);
+            if (dec->bp == dec->ep)
+                fail (Error_Bad_Media_Raw());
+            if (*dec->bp++ == ']')
+                break;
+            if (dec->bp[-1] != ',')
+                fail (Error_Bad_Media_Raw());
+        }
+
+        REBARR *a = Pop_Stack_Values_Core(dsp_orig, NODE_FLAG_MANAGED);
+        Init_Block(DS_PUSH(), a);
+        break; }
+
+      case '{': {
+        ++dec->bp;
+        REBDSP dsp_orig = DSP;
+
+        Json_Skip_Space(dec);
+        if (dec->bp != dec->ep and *dec->bp == '}')
+            ++dec->bp;
+        else while (true) {
+            Json_Skip_Space(dec);
+            if (dec->bp == dec->ep or *dec->bp != '"')
+                fail (Error_Bad_Media_Raw());
+            ++dec->bp;
+            REBSTR *key = Json_Scan_String(dec);
+            Init_Text(DS_PUSH(), key);
+
+            Json_Skip_Space(dec);
+            if (dec->bp == dec->ep or *dec->bp != ':')
+                fail (Error_Bad_Media_Raw());
+            ++dec->bp;
+
+            Json_Push_Value(dec);
+            Json_Skip_Space(dec);
+            if (dec->bp == dec->ep)
+                fail (Error_Bad_Media_Raw());
+            if (*dec->bp++ == '}')
+                break;
+            if (dec->bp[-1] != ',')
+                fail (Error_Bad_Media_Raw());
+        }
+
+        // A later duplicate of a key replaces the earlier one's value, as
+        // most JSON decoders do.
+        //
+        REBLEN count = (DSP - dsp_orig) / 2;
+        REBMAP *map = Make_Map(count);
+        REBVAL *pair = DS_AT(dsp_orig + 1);
+        REBLEN n;
+        for (n = 0; n < count; ++n, pair += 2)
+            Find_Map_Entry(map, pair, SPECIFIED, pair + 1, SPECIFIED, true);
+
+        DS_DROP_TO(dsp_orig);
+        Init_Map(DS_PUSH(), map);
+        break; }
+
+      case '"': {
+        ++dec->bp;
+        REBSTR *s = Json_Scan_String(dec);
+        Init_Text(DS_PUSH(), s);
+        break; }
+
+      case 't':
+        Json_Expect_Literal(dec, "true");
+        Init_True(DS_PUSH());
+        break;
+
+      case 'f':
+        Json_Expect_Literal(dec, "false");
+        Init_False(DS_PUSH());
+        break;
+
+      case 'n':
+        Json_Expect_Literal(dec, "null");  // nulls can't be put in blocks
+        Init_Blank(DS_PUSH());
+        break;
+
+      default:
+        Json_Push_Number(dec);
+        break;
+    }
+}
+
+// Find the `,` or `]` that ends the item starting at `cp` in a top-level
+// array, or nullptr if the data stops first.  The item itself is not
+// checked, that is left to decoding it.
+//
+static const REBYTE *Json_Find_Item_End(const REBYTE *cp, const REBYTE *ep)
+{
+    REBLEN depth = 0;
+    bool in_string = false;
+
+    for (; (cp = Json_Find_Structural(cp, ep)) != ep; ++cp) {
+        if (in_string) {
+            if (*cp == '\\') {
+                if (++cp == ep)  // skip what it escapes (may be `"`)
+                    break;
+            }
+            else if (*cp == '"')
+                in_string = false;
+            continue;
+        }
+
+        switch (*cp) {
+          case '"':
+            in_string = true;
+            break;
+
+          case '[':
+          case '{':
+            ++depth;
+            break;
+
+          case ']':
+          case '}':
+            if (depth == 0)
+                return cp;
+            --depth;
+            break;
+
+          case ',':
+            if (depth == 0)
+                return cp;
+            break;
+        }
+    }
+    return nullptr;
+}
+
+
+//
+//  export decode-json: native [
+//
+//  {Codec for decoding JSON into MAP!, BLOCK!, TEXT! and scalar values}
+//
+//      return: [any-value!]
+//      data "UTF-8 JSON text"
+//          [binary! text!]
+//  ]
+//
+REBNATIVE(decode_json)
+{
+    JSON_INCLUDE_PARAMS_OF_DECODE_JSON;
+
+    REBSIZ size;
+    struct Json_Decoder dec;
+    dec.bp = VAL_BYTES_AT(&size, ARG(data));
+    dec.ep = dec.bp + size;
+
+    if (
+        size >= 3
+        and dec.bp[0] == 0xEF and dec.bp[1] == 0xBB and dec.bp[2] == 0xBF
+    ){
+        dec.bp += 3;  // tolerate a UTF-8 byte order mark
+    }
+
+    Json_Push_Value(&dec);
+
+    Json_Skip_Space(&dec);
+    if (dec.bp != dec.ep)
+        fail (Error_Bad_Media_Raw());  // trailing garbage
+
+    Move_Value(D_OUT, DS_TOP);
+    DS_DROP();
+    return D_OUT;
+}
+
+
+//
+//  export decode-json-item: native [
+//
+//  {Decode the next item of a top-level JSON array whose data comes in parts}
+//
+//      return: "Position after the item, null if DATA doesn't hold all of it"
+//          [<opt> binary!]
+//      var "Set to the item, or null when the array's closing `]` is reached"
+//          [any-word!]
+//      data "Data following the array's `[` (or a position returned before)"
+//          [binary!]
+//      /open "DATA is from the start of the array, before the `[`"
+//  ]
+//
+REBNATIVE(decode_json_item)
+//
+// The item is decoded only once the `,` or `]` after it has been found, as
+// e.g. `12` could be the start of `1234`.  So a null return can always be
+// answered by appending more data and calling again at the same position.
+{
+    JSON_INCLUDE_PARAMS_OF_DECODE_JSON_ITEM;
+
+    const REBYTE *head = VAL_BIN_HEAD(ARG(data));
+    struct Json_Decoder dec;
+    dec.bp = VAL_BIN_AT(ARG(data));
+    dec.ep = dec.bp + VAL_LEN_AT(ARG(data));
+
+    Json_Skip_Space(&dec);
+    if (REF(open)) {
+        if (dec.bp == dec.ep)
+            return nullptr;
+        if (*dec.bp != '[')
+            fail (Error_Bad_Media_Raw());
+        ++dec.bp;
+        Json_Skip_Space(&dec);
+    }
+
+    if (dec.bp == dec.ep)
+        return nullptr;
+
+    REBVAL *var = Sink_Var_May_Fail(ARG(var), SPECIFIED);
+
+    if (*dec.bp == ']') {
+        Init_Nulled(var);
+        Move_Value(D_OUT, ARG(data));
+        VAL_INDEX(D_OUT) = dec.bp + 1 - head;
+        return D_OUT;
+    }
+
+    const REBYTE *end = Json_Find_Item_End(dec.bp, dec.ep);
+    if (not end)
+        return nullptr;
+
+    dec.ep = end;
+    Json_Push_Value(&dec);
+    Json_Skip_Space(&dec);
+    if (dec.bp != dec.ep)
+        fail (Error_Bad_Media_Raw());
+
+    Move_Value(var, DS_TOP);
+    DS_DROP();
+
+    // A `,` is consumed with its item, but a `]` is left for the next call
+    // to report as the end of the array.
+    //
+    Move_Value(D_OUT, ARG(data));
+    VAL_INDEX(D_OUT) = (*end == ',' ? end + 1 : end) - head;
+    return D_OUT;
+}
+
+
+//=//// ENCODING //////////////////////////////////////////////////////////=//
+
+struct Json_Encoder {
+    REBSER *out;  // BINARY! series being built
+    REBSER *stack;  // arrays, maps and contexts being encoded, to catch cycles
+};
+
+static void Json_Put_Bytes(
+    struct Json_Encoder *enc,
+    const REBYTE *bytes,
+    REBLEN size
+){
+    REBLEN used = SER_USED(enc->out);
+    EXPAND_SERIES_TAIL(enc->out, size);
+    memcpy(BIN_AT(enc->out, used), bytes, size);
+}
+
+inline static void Json_Put_Byte(struct Json_Encoder *enc, REBYTE b)
+  { Json_Put_Bytes(enc, &b, 1); }
+
+inline static void Json_Put_Ascii(struct Json_Encoder *enc, const char *s)
+  { Json_Put_Bytes(enc, cb_cast(s), strsize(s)); }
+
+static void Json_Put_String(
+    struct Json_Encoder *enc,
+    const REBYTE *utf8,
+    REBSIZ size
+){
+    const REBYTE *ep = utf8 + size;
+
+    Json_Put_Byte(enc, '"');
+    while (true) {
+        const REBYTE *cp = Json_Find_String_Special(utf8, ep);
+        Json_Put_Bytes(enc, utf8, cp - utf8);  // already valid UTF-8
+        if (cp == ep)
+            break;
+
+        switch (*cp) {
+          case '"': Json_Put_Ascii(enc, "\\\""); break;
+          case '\\': Json_Put_Ascii(enc, "\\\\"); break;
+          case BS: Json_Put_Ascii(enc, "\\b"); break;
+          case '\f': Json_Put_Ascii(enc, "\\f"); break;
+          case LF: Json_Put_Ascii(enc, "\\n"); break;
+          case CR: Json_Put_Ascii(enc, "\\r"); break;
+          case '\t': Json_Put_Ascii(enc, "\\t"); break;
+          default: {
+            static const char hex[] = "0123456789abcdef";
+            REBYTE buf[6] = {'\\', 'u', '0', '0', 0, 0};
+            buf[4] = hex[*cp >> 4];
+            buf[5] = hex[*cp & 0xF];
+            Json_Put_Bytes(enc, buf, 6);
+            break; }
+        }
+        utf8 = cp + 1;
+    }
+    Json_Put_Byte(enc, '"');
+}
+
+static void Json_Enter(struct Json_Encoder *enc, void *node) {
+    if (Find_Pointer_In_Series(enc->stack, node) != NOT_FOUND)
+        fail ("JSON can't represent a BLOCK!, MAP! or OBJECT! inside itself");
+    Push_Pointer_To_Series(enc->stack, node);
+}
+
+static void Json_Encode_Value(struct Json_Encoder *enc, const RELVAL *v);
+
+static void Json_Encode_Key(struct Json_Encoder *enc, const RELVAL *key) {
+    if (not ANY_STRING(key) and not ANY_WORD(key))
+        fail (Error_Invalid_Type(VAL_TYPE(key)));
+
+    REBSIZ size;
+    const REBYTE *utf8 = VAL_UTF8_AT(&size, key);
+    Json_Put_String(enc, utf8, size);
+    Json_Put_Byte(enc, ':');
+}
+
+static void Json_Encode_Value(struct Json_Encoder *enc, const RELVAL *v)
+{
+    if (C_STACK_OVERFLOWING(&v))
+        Fail_Stack_Overflow();
+
+    enum Reb_Kind kind = VAL_TYPE(v);
+    switch (kind) {
+      case REB_NULLED:
+      case REB_BLANK:
+        Json_Put_Ascii(enc, "null");
+        break;
+
+      case REB_LOGIC:
+        Json_Put_Ascii(enc, VAL_LOGIC(v) ? "true" : "false");
+        break;
+
+      case REB_INTEGER: {
+        REBYTE buf[MAX_NUM_LEN];
+        REBINT len = Emit_Integer(buf, VAL_INT64(v));
+        Json_Put_Bytes(enc, buf, len);
+        break; }
+
+      case REB_DECIMAL: {
+        REBYTE buf[60];
+        REBINT len = Emit_Decimal(buf, VAL_DECIMAL(v), 0, '.', MAX_DIGITS);
+        Json_Put_Bytes(enc, buf, len);
+        break; }
+
+      case REB_BLOCK: {
+        REBARR *a = VAL_ARRAY(v);
+        Json_Enter(enc, a);
+
+        Json_Put_Byte(enc, '[');
+        RELVAL *item = VAL_ARRAY_AT(v);
+        for (; NOT_END(item); ++item) {
+            if (item != VAL_ARRAY_AT(v))
+                Json_Put_Byte(enc, ',');
+            Json_Encode_Value(enc, item);
+        }
+        Json_Put_Byte(enc, ']');
+
+        Drop_Pointer_From_Series(enc->stack, a);
+        break; }
+
+      case REB_MAP: {
+        REBARR *pairlist = MAP_PAIRLIST(VAL_MAP(v));
+        Json_Enter(enc, pairlist);
+
+        Json_Put_Byte(enc, '{');
+        bool first = true;
+        RELVAL *key = ARR_HEAD(pairlist);
+        for (; NOT_END(key); key += 2) {
+            if (IS_NULLED(key + 1))
+                continue;  // removed key, see Find_Map_Entry()
+            if (not first)
+                Json_Put_Byte(enc, ',');
+            first = false;
+            Json_Encode_Key(enc, key);
+            Json_Encode_Value(enc, key + 1);
+        }
+        Json_Put_Byte(enc, '}');
+
+        Drop_Pointer_From_Series(enc->stack, pairlist);
+        break; }
+
+      case REB_OBJECT: {
+        REBCTX *c = VAL_CONTEXT(v);
+        Json_Enter(enc, c);
+
+        Json_Put_Byte(enc, '{');
+        bool first = true;
+        REBVAL *key = CTX_KEYS_HEAD(c);
+        REBVAL *var = CTX_VARS_HEAD(c);
+        for (; NOT_END(key); ++key, ++var) {
+            if (Is_Param_Hidden(key))
+                continue;
+            if (not first)
+                Json_Put_Byte(enc, ',');
+            first = false;
+
+            REBSTR *spelling = VAL_KEY_SPELLING(key);
+            Json_Put_String(enc, STR_HEAD(spelling), STR_SIZE(spelling));
+            Json_Put_Byte(enc, ':');
+            Json_Encode_Value(enc, var);
+        }
+        Json_Put_Byte(enc, '}');
+
+        Drop_Pointer_From_Series(enc->stack, c);
+        break; }
+
+      default:
+        if (ANY_STRING_KIND(kind) or ANY_WORD_KIND(kind)) {
+            REBSIZ size;
+            const REBYTE *utf8 = VAL_UTF8_AT(&size, v);
+            Json_Put_String(enc, utf8, size);
+            break;
+        }
+        fail (Error_Invalid_Type(kind));
+    }
+}
+
+
+//
+//  export encode-json: native [
+//
+//  {Codec for encoding a BLOCK!, MAP!, OBJECT! or scalar value as JSON}
+//
+//      return: [binary!]
+//      value [any-value!]
+//  ]
+//
+REBNATIVE(encode_json)
+{
+    JSON_INCLUDE_PARAMS_OF_ENCODE_JSON;
+
+    struct Json_Encoder enc;
+    enc.out = Make_Binary(256);
+    enc.stack = Make_Series(8, sizeof(void*));
+
+    Json_Encode_Value(&enc, ARG(value));
+    TERM_BIN(enc.out);
+
+    Free_Unmanaged_Series(enc.stack);
+    return Init_Binary(D_OUT, enc.out);
+}
@@ -27,9 +27,14 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "sys-net.h"
 
+#ifndef TO_WINDOWS
+    #include <pthread.h>  // for BACKGROUND NAME LOOKUP
+#endif
+
 #ifdef IS_ERROR
     #undef IS_ERROR  // winerror.h defines, so undef it to avoid the warning
 #endif
@@ -116,6 +121,231 @@ static bool Try_Set_Sock_Options(SOCKET sock)
 }
 
 
+//=//// BACKGROUND NAME LOOKUP ////////////////////////////////////////////=//
+//
+// getaddrinfo() blocks until the resolver answers, which for an unreachable
+// name server means its whole timeout.  So a lookup is handed to a thread of
+// its own, and the request stays pending until polling finds the answer in.
+// Lookups for several hosts run at the same time instead of one by one.
+//
+// On POSIX the thread also writes a byte to a pipe when it's done.  While the
+// lookup is pending the request's socket is that pipe (the TCP socket is kept
+// in `length`, as R3-Alpha did for its Windows async DNS), so a WAIT that is
+// sleeping in poll() wakes up for the answer.  On Windows the event loop
+// polls pending requests at least every MAX_WAIT_MS.
+//
+// Answers are cached by name.  getaddrinfo() doesn't pass on the TTL of the
+// DNS records, so entries are kept for a fixed time which is shorter than
+// most TTLs.  The OS (or a local caching resolver) has the real TTLs, and is
+// asked again when an entry expires.  Failed lookups aren't cached.
+//
+
+#ifdef TO_WINDOWS
+    static SRWLOCK Lookup_Mutex = SRWLOCK_INIT;
+    #define Lock_Lookups() AcquireSRWLockExclusive(&Lookup_Mutex)
+    #define Unlock_Lookups() ReleaseSRWLockExclusive(&Lookup_Mutex)
+#else
+    static pthread_mutex_t Lookup_Mutex = PTHREAD_MUTEX_INITIALIZER;
+    #define Lock_Lookups() pthread_mutex_lock(&Lookup_Mutex)
+    #define Unlock_Lookups() pthread_mutex_unlock(&Lookup_Mutex)
+#endif
+
+// Held in ReqNet(sock)->host_info while a lookup is pending.  It's malloc()'d
+// since either side may be the one to free it: the thread if the port was
+// closed first (`abandoned`), else the request when it picks up the answer.
+//
+struct Net_Lookup {
+    char *host;
+    uint32_t ip;  // network byte order, as is ReqNet(sock)->remote_ip
+    int error;  // getaddrinfo() result, ip is only valid if this is 0
+    bool done;
+    bool abandoned;
+  #ifndef TO_WINDOWS
+    int wake[2];  // pipe, written to when done
+  #endif
+};
+
+#define NAME_CACHE_SIZE 64
+#define NAME_CACHE_SECONDS 60
+
+static struct {
+    char host[MAX_HOST_NAME];  // empty if the slot is unused
+    uint32_t ip;
+    time_t expires;
+} Name_Cache[NAME_CACHE_SIZE];
+
+
+static bool Find_Cached_Name(uint32_t *ip_out, const char *host)
+{
+    time_t now = time(nullptr);
+    bool found = false;
+
+    Lock_Lookups();
+    int i;
+    for (i = 0; i < NAME_CACHE_SIZE; ++i) {
+        if (Name_Cache[i].expires <= now or strcmp(Name_Cache[i].host, host))
+            continue;
+        *ip_out = Name_Cache[i].ip;
+        found = true;
+        break;
+    }
+    Unlock_Lookups();
+
+    return found;
+}
+
+
+static void Cache_Name(const char *host, uint32_t ip)
+{
+    if (strlen(host) >= MAX_HOST_NAME)
+        return;  // not a name DNS could have answered for anyway
+
+    time_t now = time(nullptr);
+
+    Lock_Lookups();
+    int pick = 0;  // the same name's slot, else an expired one, else oldest
+    int i;
+    for (i = 0; i < NAME_CACHE_SIZE; ++i) {
+        if (strcmp(Name_Cache[i].host, host) == 0) {
+            pick = i;
+            break;
+        }
+        if (Name_Cache[i].expires < Name_Cache[pick].expires)
+            pick = i;
+    }
+    strcpy(Name_Cache[pick].host, host);
+    Name_Cache[pick].ip = ip;
+    Name_Cache[pick].expires = now + NAME_CACHE_SECONDS;
+    Unlock_Lookups();
+}
+
+
+static void Free_Lookup(struct Net_Lookup *lookup)
+{
+  #ifndef TO_WINDOWS
+    close(lookup->wake[0]);
+    close(lookup->wake[1]);
+  #endif
+    free(lookup->host);
+    free(lookup);
+}
+
+
+#ifdef TO_WINDOWS
+static DWORD WINAPI Lookup_Thread(LPVOID arg)
+#else
+static void *Lookup_Thread(void *arg)
+#endif
+{
+    struct Net_Lookup *lookup = cast(struct Net_Lookup*, arg);
+
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;  // remote_ip only holds IPv4 addresses
+    hints.ai_socktype = SOCK_STREAM;
+
+    struct addrinfo *info;
+    int error = getaddrinfo(lookup->host, nullptr, &hints, &info);
+    uint32_t ip = 0;
+    if (error == 0) {
+        ip = cast(struct sockaddr_in*, info->ai_addr)->sin_addr.s_addr;
+        freeaddrinfo(info);
+    }
+
+    // The wakeup is written with the lock held, so that once the request
+    // sees `done` it knows this thread won't touch the pipe again.
+    //
+    Lock_Lookups();
+    lookup->ip = ip;
+    lookup->error = error;
+    lookup->done = true;
+    bool abandoned = lookup->abandoned;
+  #ifndef TO_WINDOWS
+    if (not abandoned) {
+        char byte = 0;
+        if (write(lookup->wake[1], &byte, 1) < 0) {
+            // poll() just won't wake early, the request is still polled
+        }
+    }
+  #endif
+    Unlock_Lookups();
+
+    if (abandoned)
+        Free_Lookup(lookup);
+
+    return 0;
+}
+
+
+static struct Net_Lookup *Start_Lookup(const char *host)
+{
+    struct Net_Lookup *lookup = cast(struct Net_Lookup*,
+        calloc(1, sizeof(struct Net_Lookup))
+    );
+    if (lookup)
+        lookup->host = cast(char*, malloc(strlen(host) + 1));
+    if (not lookup or not lookup->host) {
+        free(lookup);
+        fail (Error_No_Memory(strlen(host) + 1));
+    }
+    strcpy(lookup->host, host);
+
+  #ifdef TO_WINDOWS
+    HANDLE thread = CreateThread(nullptr, 0, &Lookup_Thread, lookup, 0, nullptr);
+    bool started = (thread != nullptr);
+    if (started)
+        CloseHandle(thread);
+  #else
+    bool started = false;
+    if (pipe(lookup->wake) == 0) {
+        pthread_t thread;
+        started = (
+            pthread_create(&thread, nullptr, &Lookup_Thread, lookup) == 0
+        );
+        if (started)
+            pthread_detach(thread);
+        else {
+            close(lookup->wake[0]);
+            close(lookup->wake[1]);
+        }
+    }
+  #endif
+
+    if (not started) {
+        free(lookup->host);
+        free(lookup);
+        fail ("Could not start a thread for a host name lookup");
+    }
+    return lookup;
+}
+
+
+// For Close_Socket(), when the port is closed with a lookup still pending.
+//
+static void Abandon_Lookup(REBREQ *sock)
+{
+    struct rebol_devreq *req = Req(sock);
+    struct Net_Lookup *lookup = cast(struct Net_Lookup*,
+        ReqNet(sock)->host_info
+    );
+    ReqNet(sock)->host_info = nullptr;
+
+  #ifndef TO_WINDOWS
+    req->requestee.socket = req->length;  // restore TCP socket, see above
+  #else
+    UNUSED(req);
+  #endif
+
+    Lock_Lookups();
+    bool done = lookup->done;
+    lookup->abandoned = true;  // thread frees it if it's not done yet
+    Unlock_Lookups();
+
+    if (done)
+        Free_Lookup(lookup);
+}
+
+
 //
 //  Init_Net: C
 //
@@ -136,7 +366,9 @@ DEVICE_CMD Init_Net(REBREQ *dr)
         rebFail_OS (GET_ERROR);
   #endif
 
-    dev->flags |= RDF_INIT;
+    // Let the event device wait on this device's sockets when it sleeps.
+    //
+    dev->flags |= RDF_INIT | RDF_SOCKETS;
     return DR_DONE;
 }
 
@@ -247,11 +479,8 @@ DEVICE_CMD Close_Socket(REBREQ *sock)
 
         req->state = 0;  // clear: RSM_OPEN, RSM_CONNECT
 
-        // If DNS pending, abort it:
-        if (ReqNet(sock)->host_info) {  // indicates DNS phase active
-            rebFree(ReqNet(sock)->host_info);
-            req->requestee.socket = req->length; // Restore TCP socket (see Lookup)
-        }
+        if (ReqNet(sock)->host_info)  // lookup still pending
+            Abandon_Lookup(sock);
 
         if (CLOSE_SOCKET(req->requestee.socket) != 0)
             rebFail_OS (GET_ERROR);
@@ -261,36 +490,87 @@ DEVICE_CMD Close_Socket(REBREQ *sock)
 }
 
 
+static DEVICE_CMD Found_Host(REBREQ *sock, uint32_t ip)
+{
+    ReqNet(sock)->remote_ip = ip;
+    Req(sock)->flags &= ~RRF_DONE;
+
+    rebElide(
+        "insert system/ports/system make event! [",
+            "type: 'lookup",
+            "port:", CTX_ARCHETYPE(CTX(ReqPortCtx(sock))),
+        "]",
+    rebEND);
+
+    return DR_DONE;
+}
+
+
 //
 //  Lookup_Socket: C
 //
-// Initiate the GetHost request and return immediately.
-// This is very similar to the DNS device.
-// Note the temporary results buffer (must be freed later).
-// Note we use the sock->requestee.handle for the DNS handle. During use,
-// we store the TCP socket in the length field.
+// Look up the host name in `sock->common.data`, setting the remote IP and
+// sending a `lookup` event when it's found.  Unless the name is cached, this
+// starts the lookup in the background and returns DR_PEND, after which it's
+// called again by polling to see if the answer is in.
 //
 DEVICE_CMD Lookup_Socket(REBREQ *sock)
 {
     struct rebol_devreq *req = Req(sock);
 
-    ReqNet(sock)->host_info = NULL; // no allocated data
+    struct Net_Lookup *lookup = cast(struct Net_Lookup*,
+        ReqNet(sock)->host_info
+    );
 
-    // !!! R3-Alpha would use asynchronous DNS API on Windows, but that API
-    // was not supported by IPv6, and developers are encouraged to use normal
-    // socket APIs with their own threads.
+    if (lookup == nullptr) {  // called from OPEN
+        const char *host = s_cast(req->common.data);
 
-    HOSTENT *host = gethostbyname(s_cast(req->common.data));
-    if (host == NULL)
-        rebFail_OS (GET_ERROR);
+        uint32_t ip;
+        if (Find_Cached_Name(&ip, host))
+            return Found_Host(sock, ip);
+
+        lookup = Start_Lookup(host);
+        ReqNet(sock)->host_info = lookup;
+
+      #ifndef TO_WINDOWS
+        req->length = req->requestee.socket;  // see BACKGROUND NAME LOOKUP
+        req->requestee.socket = lookup->wake[0];
+      #endif
+        return DR_PEND;
+    }
+
+    Lock_Lookups();
+    bool done = lookup->done;
+    Unlock_Lookups();
+
+    if (not done)
+        return DR_PEND;
+
+    ReqNet(sock)->host_info = nullptr;
+  #ifndef TO_WINDOWS
+    req->requestee.socket = req->length;
+  #endif
+
+    int error = lookup->error;
+    uint32_t ip = lookup->ip;
+    if (error == 0)
+        Cache_Name(lookup->host, ip);
+    Free_Lookup(lookup);
 
-    memcpy(&ReqNet(sock)->remote_ip, *host->h_addr_list, 4); //he->h_length);
-    req->flags &= ~RRF_DONE;
+    if (error == 0)
+        return Found_Host(sock, ip);
 
+    // This is running from polling, not from the OPEN, so failing would go
+    // to whatever happened to be running WAIT.  Deliver it as an `error`
+    // event, as Transfer_Socket() does.
+    //
+    REBVAL *port = CTX_ARCHETYPE(CTX(ReqPortCtx(sock)));
     rebElide(
+        "(", port, ")/error: make error!", rebT(gai_strerror(error)),
+
         "insert system/ports/system make event! [",
-            "type: 'lookup",
-            "port:", CTX_ARCHETYPE(CTX(ReqPortCtx(sock))),
+            "type: 'error",
+            "port:", port,
         "]",
     rebEND);
 
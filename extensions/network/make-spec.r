@@ -9,3 +9,10 @@ includes: [
 depends: [
     %network/dev-net.c
 ]
+
+; Host name lookups run on threads of their own (see %dev-net.c).  Windows
+; threads come from kernel32, which is linked by default.
+;
+libraries: try if system-config/os-base <> 'Windows [
+    [%pthread]
+]
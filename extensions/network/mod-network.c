@@ -168,14 +168,16 @@ static REB_R Transport_Actor(
                 ReqNet(sock)->remote_port =
                     IS_INTEGER(port_id) ? VAL_INT32(port_id) : 80;
 
-                // Note: sets remote_ip field
+                // Sets the remote_ip field, and sends a `lookup` event when
+                // done.  Null means the lookup is pending in the background.
                 //
                 REBVAL *l_result = OS_DO_DEVICE(sock, RDC_LOOKUP);
 
-                assert(l_result != nullptr);
-                if (rebDid("error?", l_result, rebEND))
-                    rebJumps("FAIL", l_result, rebEND);
-                rebRelease(l_result); // ignore result
+                if (l_result) {
+                    if (rebDid("error?", l_result, rebEND))
+                        rebJumps("FAIL", l_result, rebEND);
+                    rebRelease(l_result); // ignore result
+                }
 
                 RETURN (port);
             }
@@ -316,7 +318,25 @@ static REB_R Transport_Actor(
             // is specified.
             //
             req->length = UINT32_MAX;  // signal "read as much as you can"
-            bufsize = NET_BUF_SIZE;
+
+            REBVAL *size = Obj_Value(spec, STD_PORT_SPEC_NET_BUFFER_SIZE);
+            if (size and IS_INTEGER(size)) {
+                if (VAL_INT64(size) <= 0)
+                    fail (Error_Out_Of_Range(size));
+                bufsize = VAL_INT32(size);
+            }
+            else
+                bufsize = NET_BUF_SIZE;
+        }
+
+        // READ/INTO makes the caller's binary the receive buffer, so servers
+        // can recycle one per connection instead of getting a new one each
+        // time PORT/DATA is taken.  Data goes at its tail (which is where
+        // the device writes, regardless of the binary's index).
+        //
+        if (REF(into)) {
+            FAIL_IF_READ_ONLY(ARG(into));
+            Init_Binary(port_data, VAL_BINARY(ARG(into)));
         }
 
         // Setup the read buffer (allocate a buffer if needed)
@@ -408,10 +428,24 @@ static REB_R Transport_Actor(
         // We also want to make sure the /PART is handled correctly, so by
         // delegating to COPY/PART we get that for free.
         //
+        // A BLOCK! like `[header-text body-binary]` is joined as part of
+        // that same copy, so callers needn't JOIN into a buffer of their own
+        // first.  (/PART would be ambiguous about units, so isn't allowed.)
+        //
         TRASH_POINTER_IF_DEBUG(req->common.data);
-        req->common.binary = rebValue(
-            "as binary! copy/part", data, rebQ1(REF(part)),
-        rebEND);
+        if (IS_BLOCK(data)) {
+            if (REF(part))
+                fail (Error_Bad_Refines_Raw());
+
+            Join_Binary_In_Byte_Buf(data, -1);
+            req->common.binary = rebSizedBinary(
+                BIN_HEAD(BYTE_BUF), BIN_LEN(BYTE_BUF)
+            );
+        }
+        else
+            req->common.binary = rebValue(
+                "as binary! copy/part", data, rebQ1(REF(part)),
+            rebEND);
 
         // Because requests can be handled asynchronously, we won't
         // necessarily free the handle before WRITE ends.  Unmanage it.
@@ -477,6 +511,9 @@ static REB_R Transport_Actor(
         RETURN (port); }
 
       case SYM_OPEN: {
+        if (ReqNet(sock)->host_info)  // lookup pending, connect after `lookup`
+            RETURN (port);
+
         REBVAL *result = OS_DO_DEVICE(sock, RDC_CONNECT);
         if (result == nullptr) {
             //
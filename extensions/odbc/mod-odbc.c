@@ -83,6 +83,8 @@
 
 
 typedef struct {
+    SQLSMALLINT c_type;
+    SQLSMALLINT sql_type;
     SQLULEN column_size;
     SQLPOINTER buffer;
     SQLULEN buffer_size;
@@ -443,16 +445,11 @@ REBNATIVE(open_statement)
 //
 // Bound parameters are a Rebol value of incoming type.  These values inform
 // the dynamic allocation of a buffer for the parameter, pre-filling it with
-// the content of the value.
+// the content of the value.  (Filling is separate from binding so that a
+// batch can gather one buffer per row before binding them as an array.)
 //
-SQLRETURN ODBC_BindParameter(
-    SQLHSTMT hstmt,
-    PARAMETER *p,
-    SQLUSMALLINT number,  // parameter number
-    const REBVAL *v
-){
-    assert(number != 0);
-
+void ODBC_FillParameter(PARAMETER *p, const REBVAL *v)
+{
     p->length = 0;  // ignored for most types
     p->column_size = 0;  // also ignored for most types
     TRASH_POINTER_IF_DEBUG(p->buffer);  // required to be set by switch()
@@ -659,6 +656,7 @@ SQLRETURN ODBC_BindParameter(
         }
 
         sql_type = SQL_VARCHAR;
+        p->buffer_size = encoded_size_no_term;
         p->length = p->column_size = cast(SQLSMALLINT, encoded_size_no_term);
         break; }
 
@@ -700,12 +698,27 @@ SQLRETURN ODBC_BindParameter(
         rebJumps ("panic {Unhandled SQL type in switch() statement}");
     }
 
+    p->c_type = c_type;
+    p->sql_type = sql_type;
+}
+
+
+SQLRETURN ODBC_BindParameter(
+    SQLHSTMT hstmt,
+    PARAMETER *p,
+    SQLUSMALLINT number,  // parameter number
+    const REBVAL *v
+){
+    assert(number != 0);
+
+    ODBC_FillParameter(p, v);
+
     SQLRETURN rc = SQLBindParameter(
         hstmt,  // StatementHandle
         number,  // ParameterNumber
         SQL_PARAM_INPUT,  // InputOutputType
-        c_type,  // ValueType
-        sql_type,  // ParameterType
+        p->c_type,  // ValueType
+        p->sql_type,  // ParameterType
         p->column_size,  // ColumnSize
         0,  // DecimalDigits
         p->buffer,  // ParameterValuePtr
@@ -717,6 +730,191 @@ SQLRETURN ODBC_BindParameter(
 }
 
 
+// Batches and block fetches set statement attributes that would change the
+// meaning of later single-row calls, and bind buffers that are freed after
+// the call (or by a fail() partway through).  This puts the statement back
+// to one row at a time with no columns bound.
+//
+static void Reset_Array_Attributes(SQLHSTMT hstmt) {
+    SQLFreeStmt(hstmt, SQL_UNBIND);
+    SQLSetStmtAttr(
+        hstmt, SQL_ATTR_PARAMSET_SIZE, cast(SQLPOINTER, cast(uintptr_t, 1)), 0
+    );
+    SQLSetStmtAttr(
+        hstmt, SQL_ATTR_ROW_ARRAY_SIZE, cast(SQLPOINTER, cast(uintptr_t, 1)), 0
+    );
+    SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, nullptr, 0);
+}
+
+inline static bool Is_Integer_C_Type(SQLSMALLINT c_type) {
+    return c_type == SQL_C_LONG or c_type == SQL_C_ULONG
+        or c_type == SQL_C_SBIGINT or c_type == SQL_C_UBIGINT;
+}
+
+inline static bool Is_Variable_Size_C_Type(SQLSMALLINT c_type) {
+    return c_type == SQL_C_CHAR or c_type == SQL_C_WCHAR
+        or c_type == SQL_C_BINARY;
+}
+
+inline static SQLBIGINT Integer_From_Parameter(PARAMETER *p) {
+    switch (p->c_type) {
+      case SQL_C_LONG: return *cast(SQLINTEGER*, p->buffer);
+      case SQL_C_ULONG: return *cast(SQLUINTEGER*, p->buffer);
+      case SQL_C_SBIGINT: return *cast(SQLBIGINT*, p->buffer);
+      case SQL_C_UBIGINT: return *cast(SQLUBIGINT*, p->buffer);
+      default: break;
+    }
+    assert(!"Integer_From_Parameter() called on non-integer parameter");
+    return 0;
+}
+
+
+//
+// A batch binds each parameter as an array with one element per row, and
+// sets SQL_ATTR_PARAMSET_SIZE so a single SQLExecute() inserts every row.
+// This saves the round trip per row that running the statement once for
+// each row would cost.
+//
+// The rows are BLOCK!s starting at the second item of `sql`.  Each column's
+// values have to fill to the same C type, except that BLANK! is NULL for
+// that row and INTEGER!s of different magnitudes are widened to BIGINT.
+//
+// The arrays are rebAlloc()'d and put in `buffers` (data then indicators for
+// each parameter), to be freed by the caller after executing.
+//
+static void ODBC_BindParameterArrays(
+    SQLHSTMT hstmt,
+    const REBVAL *sql,
+    REBLEN num_rows,
+    REBLEN num_params,
+    void **buffers  // 2 * num_params
+){
+    REBLEN row;
+    for (row = 0; row != num_rows; ++row) {
+        if (num_params != cast(REBLEN, rebUnbox(
+            "length of ensure block! pick", sql, rebI(row + 2)
+        ))){
+            fail ("All rows in an ODBC batch must have the same length");
+        }
+    }
+
+    PARAMETER *cells = rebAllocN(PARAMETER, num_rows);
+
+    REBLEN n;
+    for (n = 0; n != num_params; ++n) {
+        SQLSMALLINT c_type = SQL_C_DEFAULT;
+        SQLSMALLINT sql_type = SQL_VARCHAR;  // if column is all BLANK!
+        SQLULEN column_size = 0;
+        SQLULEN width = 1;  // a 0 BufferLength isn't allowed
+        bool widen = false;
+
+        for (row = 0; row != num_rows; ++row) {
+            PARAMETER *p = &cells[row];
+
+            REBVAL *value = rebValue(
+                "pick pick", sql, rebI(row + 2), rebI(n + 1)
+            );
+            ODBC_FillParameter(p, value);
+            rebRelease(value);
+
+            if (p->c_type == SQL_C_DEFAULT)
+                continue;  // NULL, fits any column
+
+            if (c_type == SQL_C_DEFAULT) {
+                c_type = p->c_type;
+                sql_type = p->sql_type;
+            }
+            else if (c_type != p->c_type) {
+                if (
+                    not Is_Integer_C_Type(c_type)
+                    or not Is_Integer_C_Type(p->c_type)
+                ){
+                    fail ("Mixed value types in an ODBC batch column");
+                }
+                widen = true;
+            }
+
+            if (p->column_size > column_size)
+                column_size = p->column_size;
+
+            SQLULEN size = Is_Variable_Size_C_Type(p->c_type)
+                ? cast(SQLULEN, p->length)
+                : p->buffer_size;
+            if (size > width)
+                width = size;
+        }
+
+        if (widen) {
+            c_type = SQL_C_SBIGINT;  // !!! See notes RE: ODBC BIGINT
+            width = sizeof(SQLBIGINT);
+        }
+        if (c_type == SQL_C_DEFAULT)
+            c_type = SQL_C_CHAR;
+
+        char *data = rebAllocN(char, width * num_rows);
+        SQLLEN *indicators = rebAllocN(SQLLEN, num_rows);
+        buffers[2 * n] = data;
+        buffers[2 * n + 1] = indicators;
+
+        for (row = 0; row != num_rows; ++row) {
+            PARAMETER *p = &cells[row];
+            char *elem = data + width * row;
+
+            if (p->c_type == SQL_C_DEFAULT)
+                indicators[row] = SQL_NULL_DATA;
+            else if (widen) {
+                *cast(SQLBIGINT*, elem) = Integer_From_Parameter(p);
+                indicators[row] = sizeof(SQLBIGINT);
+            }
+            else if (Is_Variable_Size_C_Type(c_type)) {
+                memcpy(elem, p->buffer, p->length);
+                indicators[row] = p->length;
+            }
+            else {
+                memcpy(elem, p->buffer, p->buffer_size);
+                indicators[row] = p->buffer_size;
+            }
+
+            if (p->buffer != nullptr)
+                rebFree(p->buffer);
+        }
+
+        SQLRETURN rc = SQLBindParameter(
+            hstmt,  // StatementHandle
+            n + 1,  // ParameterNumber
+            SQL_PARAM_INPUT,  // InputOutputType
+            c_type,  // ValueType
+            sql_type,  // ParameterType
+            column_size,  // ColumnSize
+            0,  // DecimalDigits
+            data,  // ParameterValuePtr (array, one element per row)
+            width,  // BufferLength (of each element)
+            indicators  // StrLen_Or_IndPtr (array, one per row)
+        );
+        if (not SQL_SUCCEEDED(rc))
+            fail (Error_ODBC_Stmt(hstmt));
+    }
+
+    rebFree(cells);
+
+    SQLRETURN rc = SQLSetStmtAttr(
+        hstmt,
+        SQL_ATTR_PARAM_BIND_TYPE,
+        cast(SQLPOINTER, cast(uintptr_t, SQL_PARAM_BIND_BY_COLUMN)),
+        0
+    );
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLSetStmtAttr(
+            hstmt,
+            SQL_ATTR_PARAMSET_SIZE,
+            cast(SQLPOINTER, cast(uintptr_t, num_rows)),
+            0
+        );
+    if (not SQL_SUCCEEDED(rc))
+        fail (Error_ODBC_Stmt(hstmt));
+}
+
+
 SQLRETURN ODBC_GetCatalog(
     SQLHSTMT hstmt,
     REBVAL *block
@@ -1090,6 +1288,7 @@ REBNATIVE(insert_odbc)
 
     rc = SQLFreeStmt(hstmt, SQL_RESET_PARAMS);  // !!! check rc?
     rc = SQLCloseCursor(hstmt);  // !!! check rc?
+    Reset_Array_Attributes(hstmt);  // in case a batch or block fetch failed
 
     //=//// MAKE SQL REQUEST FROM DIALECTED SQL BLOCK /////////////////////=//
     //
@@ -1154,8 +1353,27 @@ REBNATIVE(insert_odbc)
 
         ++sql_index;
 
+        // If the parameters are BLOCK!s, each is a row of a batch.  (BLOCK!
+        // isn't a mappable parameter type, so this isn't ambiguous.)
+        //
+        REBLEN num_rows = 0;
+        void **batch_buffers = nullptr;
+        if (
+            num_params != 0
+            and rebDid("block? pick", ARG(sql), rebI(sql_index))
+        ){
+            num_rows = num_params;
+            num_params = rebUnbox(
+                "length of pick", ARG(sql), rebI(sql_index)
+            );
+            batch_buffers = rebAllocN(void*, 2 * num_params + 1);
+            ODBC_BindParameterArrays(
+                hstmt, ARG(sql), num_rows, num_params, batch_buffers
+            );
+        }
+
         PARAMETER *params = nullptr;
-        if (num_params != 0) {
+        if (num_params != 0 and num_rows == 0) {
             params = rebAllocN(PARAMETER, num_params);
 
             REBLEN n;
@@ -1178,7 +1396,16 @@ REBNATIVE(insert_odbc)
         //
         rc = SQLExecute(hstmt);
 
-        if (num_params != 0) {
+        if (num_rows != 0) {
+            REBLEN n;
+            for (n = 0; n != 2 * num_params; ++n)
+                rebFree(batch_buffers[n]);
+            rebFree(batch_buffers);
+
+            Reset_Array_Attributes(hstmt);  // later executions are 1 row
+            SQLFreeStmt(hstmt, SQL_RESET_PARAMS);
+        }
+        else if (num_params != 0) {
             REBLEN n;
             for (n = 0; n != num_params; ++n) {
                 if (params[n].buffer != nullptr)
@@ -1453,6 +1680,136 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
 }
 
 
+// Fetching rows in blocks needs the columns bound with SQLBindCol(), whose
+// buffers can't grow the way the SQLGetData() loop in COPY-ODBC can.  So it's
+// only used when every column has a declared maximum size.  The LONG types
+// are capped at 32K (see ODBC_DescribeResults()) and could be truncated.
+//
+#define ROWS_PER_FETCH 64
+
+static bool Can_Block_Fetch(COLUMN *columns, SQLSMALLINT num_columns) {
+    SQLSMALLINT col_num;
+    for (col_num = 0; col_num < num_columns; ++col_num) {
+        switch (columns[col_num].sql_type) {
+          case SQL_LONGVARCHAR:
+          case SQL_WLONGVARCHAR:
+          case SQL_LONGVARBINARY:
+            return false;
+
+          default:
+            break;
+        }
+    }
+    return true;
+}
+
+
+//
+// Binds each column to an array of ROWS_PER_FETCH buffers so one SQLFetch()
+// brings back up to that many rows.  A copy of the COLUMN is aimed at each
+// row's element in turn, so the usual ODBC_Column_To_Rebol_Value() can be
+// reused.  (The COLUMN itself isn't changed, as a fail() while converting
+// would leave it pointing into the freed arrays.)
+//
+// Returns the number of rows appended to `results`.
+//
+static SQLLEN ODBC_BlockFetch(
+    SQLHSTMT hstmt,
+    COLUMN *columns,
+    SQLSMALLINT num_columns,
+    SQLLEN num_rows,  // -1 for all available rows
+    REBVAL *results
+){
+    SQLRETURN rc;
+
+    char **arrays = rebAllocN(char*, num_columns);
+    SQLLEN *lengths = rebAllocN(SQLLEN, num_columns * ROWS_PER_FETCH);
+
+    SQLSMALLINT col_num;
+    for (col_num = 0; col_num < num_columns; ++col_num) {
+        COLUMN *col = &columns[col_num];
+        arrays[col_num] = rebAllocN(char, col->buffer_size * ROWS_PER_FETCH);
+
+        rc = SQLBindCol(
+            hstmt,
+            col_num + 1,
+            col->c_type,
+            arrays[col_num],
+            col->buffer_size,
+            &lengths[col_num * ROWS_PER_FETCH]
+        );
+        if (not SQL_SUCCEEDED(rc))
+            rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+    }
+
+    SQLULEN fetched = 0;
+    rc = SQLSetStmtAttr(
+        hstmt,
+        SQL_ATTR_ROW_BIND_TYPE,
+        cast(SQLPOINTER, cast(uintptr_t, SQL_BIND_BY_COLUMN)),
+        0
+    );
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, &fetched, 0);
+    if (not SQL_SUCCEEDED(rc))
+        rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+
+    SQLLEN row = 0;
+    while (row != num_rows) {
+        //
+        // With /PART, don't fetch past the rows asked for...the cursor can't
+        // give back rows for the next COPY-ODBC to see.
+        //
+        SQLULEN want = ROWS_PER_FETCH;
+        if (num_rows != -1 and cast(SQLULEN, num_rows - row) < want)
+            want = num_rows - row;
+
+        rc = SQLSetStmtAttr(
+            hstmt,
+            SQL_ATTR_ROW_ARRAY_SIZE,
+            cast(SQLPOINTER, cast(uintptr_t, want)),
+            0
+        );
+        if (not SQL_SUCCEEDED(rc))
+            rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+
+        rc = SQLFetch(hstmt);
+        if (rc == SQL_NO_DATA)
+            break;
+        if (not SQL_SUCCEEDED(rc))  // SQL_SUCCESS_WITH_INFO ignored as below
+            rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+
+        SQLULEN i;
+        for (i = 0; i != fetched; ++i) {
+            REBVAL *record = rebValue("make block!", rebI(num_columns));
+
+            for (col_num = 0; col_num < num_columns; ++col_num) {
+                COLUMN elem = columns[col_num];
+                elem.buffer = arrays[col_num] + elem.buffer_size * i;
+                elem.length = lengths[col_num * ROWS_PER_FETCH + i];
+
+                REBVAL *temp = ODBC_Column_To_Rebol_Value(&elem);
+                rebElide("append/only", record, rebR(temp));
+            }
+
+            rebElide("append/only", results, rebR(record));
+            ++row;
+        }
+
+        if (fetched < want)
+            break;  // driver had no more rows
+    }
+
+    for (col_num = 0; col_num < num_columns; ++col_num)
+        rebFree(arrays[col_num]);
+    rebFree(arrays);
+    rebFree(lengths);
+
+    Reset_Array_Attributes(hstmt);
+    return row;
+}
+
+
 //
 //  export copy-odbc: native [
 //
@@ -1497,6 +1854,13 @@ REBNATIVE(copy_odbc)
         "make block!", rebI(num_rows == -1 ? 10 : num_rows)
     );
 
+    Reset_Array_Attributes(hstmt);  // in case a block fetch failed midway
+
+    if (Can_Block_Fetch(columns, num_columns)) {
+        ODBC_BlockFetch(hstmt, columns, num_columns, num_rows, results);
+        return results;
+    }
+
     SQLLEN row = 0;
     while (row != num_rows) {
 
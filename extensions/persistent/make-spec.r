@@ -0,0 +1,17 @@
+REBOL []
+
+name: 'Persistent
+source: %persistent/mod-persistent.c
+depends: [
+    %persistent/t-pmap.c
+    %persistent/t-pvector.c
+]
+includes: [
+    %prep/extensions/persistent
+]
+definitions: []
+cflags: []
+searches: []
+ldflags: []
+libraries: []
+options: []
@@ -0,0 +1,163 @@
+//
+//  File: %mod-persistent.c
+//  Summary: "PMAP! and PVECTOR! extension main C file"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See notes in %extensions/persistent/README.md
+
+#include "sys-core.h"
+
+#include "tmp-mod-persistent.h"
+
+#include "sys-persistent.h"
+
+
+REBTYP *EG_Pmap_Type;  // (E)xtension (G)lobal
+REBTYP *EG_Pvector_Type;
+
+//
+//  register-persistent-hooks: native [
+//
+//  {Make PMAP! and PVECTOR! work with GENERIC actions, comparison ops, etc}
+//
+//      return: [void!]
+//  ]
+//
+REBNATIVE(register_persistent_hooks)
+{
+    PERSISTENT_INCLUDE_PARAMS_OF_REGISTER_PERSISTENT_HOOKS;
+
+    // !!! See notes on Hook_Datatype for this poor-man's substitute for a
+    // coherent design of an extensible object system (as per Lisp's CLOS)
+    //
+    EG_Pmap_Type = Hook_Datatype(
+        "http://datatypes.rebol.info/pmap",
+        "persistent (never changing) map",
+        &T_Pmap,
+        &PD_Pmap,
+        &CT_Pmap,
+        &MAKE_Pmap,
+        &TO_Pmap,
+        &MF_Pmap
+    );
+
+    EG_Pvector_Type = Hook_Datatype(
+        "http://datatypes.rebol.info/pvector",
+        "persistent (never changing) list of values",
+        &T_Pvector,
+        &PD_Pvector,
+        &CT_Pvector,
+        &MAKE_Pvector,
+        &TO_Pvector,
+        &MF_Pvector
+    );
+
+    return Init_Void(D_OUT);
+}
+
+
+//
+//  unregister-persistent-hooks: native [
+//
+//  {Remove PMAP! and PVECTOR! behaviors added by REGISTER-PERSISTENT-HOOKS}
+//
+//      return: [void!]
+//  ]
+//
+REBNATIVE(unregister_persistent_hooks)
+{
+    PERSISTENT_INCLUDE_PARAMS_OF_UNREGISTER_PERSISTENT_HOOKS;
+
+    Unhook_Datatype(EG_Pvector_Type);
+    Unhook_Datatype(EG_Pmap_Type);
+
+    return Init_Void(D_OUT);
+}
+
+
+//
+//  export pmap-put: native [
+//
+//  {New PMAP! with a key set to a value (the original map is unchanged)}
+//
+//      return: [any-value!]
+//      map [any-value!]
+//      key [any-value!]
+//      value "NULL to make a map without the key"
+//          [<opt> any-value!]
+//  ]
+//
+REBNATIVE(pmap_put)
+{
+    PERSISTENT_INCLUDE_PARAMS_OF_PMAP_PUT;
+
+    if (not IS_PMAP(ARG(map)))
+        fail (PAR(map));
+
+    return Pmap_Put(D_OUT, ARG(map), ARG(key), ARG(value));
+}
+
+
+//
+//  export pvector-append: native [
+//
+//  {New PVECTOR! with a value added at the end (the original is unchanged)}
+//
+//      return: [any-value!]
+//      vector [any-value!]
+//      value [any-value!]
+//  ]
+//
+REBNATIVE(pvector_append)
+{
+    PERSISTENT_INCLUDE_PARAMS_OF_PVECTOR_APPEND;
+
+    if (not IS_PVECTOR(ARG(vector)))
+        fail (PAR(vector));
+
+    return Pvector_Append(D_OUT, ARG(vector), ARG(value));
+}
+
+
+//
+//  export pvector-poke: native [
+//
+//  {New PVECTOR! with an element changed (the original is unchanged)}
+//
+//      return: [any-value!]
+//      vector [any-value!]
+//      index "1-based position of the element"
+//          [integer!]
+//      value [any-value!]
+//  ]
+//
+REBNATIVE(pvector_poke)
+{
+    PERSISTENT_INCLUDE_PARAMS_OF_PVECTOR_POKE;
+
+    if (not IS_PVECTOR(ARG(vector)))
+        fail (PAR(vector));
+
+    REBINT n = VAL_INT32(ARG(index));
+    if (n <= 0 or cast(REBLEN, n) > VAL_PVECTOR_LEN(ARG(vector)))
+        fail (Error_Out_Of_Range(ARG(index)));
+
+    return Pvector_Poke(D_OUT, ARG(vector), n - 1, ARG(value));
+}
@@ -0,0 +1,164 @@
+//
+//  File: %sys-persistent.h
+//  Summary: "Persistent map and vector datatypes header file"
+//  Section: datatypes
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// PMAP! and PVECTOR! values are never changed.  Adding to one makes a new
+// one, which shares all of the old one's storage except for the path down a
+// tree to where the change is.  The trees are 32 wide, so that path is short
+// (at most 7 nodes for a PMAP!) and only that many small arrays are copied.
+//
+// The tree nodes are plain managed arrays, with BLOCK! cells pointing to the
+// child nodes.  So the garbage collector deals with the sharing: a node is
+// kept alive for as long as any version still reaches it.
+//
+// * A PMAP! is a "hash array mapped trie" (in the "CHAMP" layout, where the
+//   key/value pairs stored in a node come before its child nodes).  The cell
+//   points to the root node and holds the number of keys.
+//
+// * A PVECTOR! is a trie indexed by 5 bits of the element's position at each
+//   level, with the last (up to) 32 elements kept in a separate "tail" array
+//   so most appends copy only that.  The cell points to a 2-cell array with
+//   the root and the tail, and holds the number of elements.
+//
+//=//// NOTES /////////////////////////////////////////////////////////////=//
+//
+// * See %extensions/persistent/README.md
+//
+
+extern REBTYP *EG_Pmap_Type;
+extern REBTYP *EG_Pvector_Type;
+
+
+#define PERSISTENT_BITS 5
+#define PERSISTENT_WIDTH (1 << PERSISTENT_BITS)  // 32 entries a node
+#define PERSISTENT_MASK (PERSISTENT_WIDTH - 1)
+
+inline static REBLEN Count_Bits_32(uint32_t bits) {  // a.k.a. "popcount"
+    bits = bits - ((bits >> 1) & 0x55555555);
+    bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+    bits = (bits + (bits >> 4)) & 0x0F0F0F0F;
+    return (bits * 0x01010101) >> 24;
+}
+
+
+//=//// PMAP! /////////////////////////////////////////////////////////////=//
+//
+// A node array starts with 2 header cells: INTEGER!s with the bitmap of the
+// 5-bit hash fragments that have a key/value pair in the node, and of those
+// that have a child node.  Then come the pairs, then BLOCK!s of the children
+// (each in the order of their fragments).
+//
+// Keys whose hashes are the same in all 32 bits end up in a "collision" node,
+// whose header cells are BLANK!s and which is just a list of pairs.
+//
+
+#define PMAP_HEADER 2
+
+#define VAL_PMAP_ROOT(v) \
+    ARR(PAYLOAD(Any, (v)).first.node)
+
+#define VAL_PMAP_LEN(v) \
+    PAYLOAD(Any, (v)).second.u
+
+inline static bool IS_PMAP(const RELVAL *v) {  // QUOTED! doesn't count
+    return IS_CUSTOM(v) and CELL_CUSTOM_TYPE(v) == EG_Pmap_Type;
+}
+
+inline static REBVAL *Init_Pmap(RELVAL *out, REBARR *root, REBLEN len) {
+    RESET_CUSTOM_CELL(out, EG_Pmap_Type, CELL_FLAG_FIRST_IS_NODE);
+    INIT_VAL_NODE(out, root);
+    VAL_PMAP_LEN(out) = len;
+    return KNOWN(out);
+}
+
+extern REBARR *Make_Pmap_Node(uint32_t datamap, uint32_t nodemap);
+extern const RELVAL *Pmap_Lookup(REBARR *root, const RELVAL *key);
+extern REBVAL *Pmap_Put(
+    REBVAL *out,
+    const REBCEL *pmap,
+    const REBVAL *key,
+    const REBVAL *opt_value
+);
+extern void Push_Pmap_Entries(REBARR *node, bool keys, bool values);
+
+
+//=//// PVECTOR! //////////////////////////////////////////////////////////=//
+//
+// The elements before the tail are in the trie, whose leaves are full arrays
+// of 32 elements.  How many levels it has follows from how many elements it
+// holds, see Pvector_Shift().
+//
+
+#define PVECTOR_ROOT_SLOT 0  // BLOCK!, or BLANK! if nothing is before the tail
+#define PVECTOR_TAIL_SLOT 1  // BLOCK!
+
+#define VAL_PVECTOR_ARRAY(v) \
+    ARR(PAYLOAD(Any, (v)).first.node)
+
+#define VAL_PVECTOR_LEN(v) \
+    PAYLOAD(Any, (v)).second.u
+
+inline static bool IS_PVECTOR(const RELVAL *v) {  // QUOTED! doesn't count
+    return IS_CUSTOM(v) and CELL_CUSTOM_TYPE(v) == EG_Pvector_Type;
+}
+
+extern REBVAL *Init_Pvector(
+    RELVAL *out,
+    REBARR *opt_root,
+    REBARR *tail,
+    REBLEN len
+);
+extern const RELVAL *Pvector_At(const REBCEL *pvec, REBLEN n);
+extern REBVAL *Pvector_Append(
+    REBVAL *out,
+    const REBCEL *pvec,
+    const RELVAL *value
+);
+extern REBVAL *Pvector_Poke(
+    REBVAL *out,
+    const REBCEL *pvec,
+    REBLEN n,
+    const RELVAL *value
+);
+extern REBVAL *Make_Pvector_From_Values(
+    REBVAL *out,
+    const RELVAL *head,
+    REBLEN len,
+    REBSPC *specifier
+);
+
+
+// !!! These hooks allow the PMAP! and PVECTOR! cell types to dispatch to code
+// in the extension if it is loaded.
+//
+extern REBINT CT_Pmap(const REBCEL *a, const REBCEL *b, REBINT mode);
+extern REB_R MAKE_Pmap(REBVAL *out, enum Reb_Kind kind, const REBVAL *opt_parent, const REBVAL *arg);
+extern REB_R TO_Pmap(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg);
+extern void MF_Pmap(REB_MOLD *mo, const REBCEL *v, bool form);
+extern REBTYPE(Pmap);
+extern REB_R PD_Pmap(REBPVS *pvs, const REBVAL *picker, const REBVAL *opt_setval);
+
+extern REBINT CT_Pvector(const REBCEL *a, const REBCEL *b, REBINT mode);
+extern REB_R MAKE_Pvector(REBVAL *out, enum Reb_Kind kind, const REBVAL *opt_parent, const REBVAL *arg);
+extern REB_R TO_Pvector(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg);
+extern void MF_Pvector(REB_MOLD *mo, const REBCEL *v, bool form);
+extern REBTYPE(Pvector);
+extern REB_R PD_Pvector(REBPVS *pvs, const REBVAL *picker, const REBVAL *opt_setval);
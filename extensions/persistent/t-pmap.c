@@ -0,0 +1,634 @@
+//
+//  File: %t-pmap.c
+//  Summary: "persistent map datatype"
+//  Section: datatypes
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Changing a PMAP! copies just the nodes on the path from the root to the
+// node where the key goes, and makes a new root for the new version.  The
+// node layout is described in %sys-persistent.h.
+//
+// Keys compare like MAP! keys do without /CASE (so TEXT! case-insensitively)
+// and, like a MAP!'s, series keys get frozen when they are added.
+//
+
+#include "sys-core.h"
+
+#include "sys-persistent.h"
+
+
+#define Hash_Fragment(hash,shift) \
+    (((hash) >> (shift)) & PERSISTENT_MASK)
+
+inline static bool Is_Collision_Node(REBARR *node)
+  { return IS_BLANK(ARR_HEAD(node)); }
+
+inline static uint32_t Node_Datamap(REBARR *node)
+  { return cast(uint32_t, VAL_INT64(ARR_AT(node, 0))); }
+
+inline static uint32_t Node_Nodemap(REBARR *node)
+  { return cast(uint32_t, VAL_INT64(ARR_AT(node, 1))); }
+
+inline static REBLEN Node_Num_Pairs(REBARR *node) {
+    if (Is_Collision_Node(node))
+        return (ARR_LEN(node) - PMAP_HEADER) / 2;
+    return Count_Bits_32(Node_Datamap(node));
+}
+
+inline static RELVAL *Node_Pair(REBARR *node, REBLEN i)
+  { return ARR_AT(node, PMAP_HEADER + 2 * i); }
+
+inline static RELVAL *Node_Child_Cell(REBARR *node, REBLEN i)
+  { return ARR_AT(node, PMAP_HEADER + 2 * Node_Num_Pairs(node) + i); }
+
+inline static bool Pmap_Keys_Equal(const RELVAL *a, const RELVAL *b)
+  { return 0 == Cmp_Value(a, b, false); }
+
+
+// Nodes are built by pushing their cells to the data stack.
+
+inline static void Push_Node_Header(uint32_t datamap, uint32_t nodemap) {
+    Init_Integer(DS_PUSH(), datamap);
+    Init_Integer(DS_PUSH(), nodemap);
+}
+
+inline static void Push_Pair(const RELVAL *key, const RELVAL *value) {
+    Move_Value(DS_PUSH(), KNOWN(key));
+    Move_Value(DS_PUSH(), KNOWN(value));
+}
+
+#define Pop_Node(dsp) \
+    Pop_Stack_Values_Core((dsp), NODE_FLAG_MANAGED)
+
+inline static REBARR *Copy_Node(REBARR *node) {
+    return Copy_Array_At_Extra_Shallow(
+        node, 0, SPECIFIED, 0, NODE_FLAG_MANAGED
+    );
+}
+
+
+//
+//  Make_Pmap_Node: C
+//
+// An ordinary node with no pairs or children in it yet.
+//
+REBARR *Make_Pmap_Node(uint32_t datamap, uint32_t nodemap)
+{
+    REBDSP dsp_orig = DSP;
+    Push_Node_Header(datamap, nodemap);
+    return Pop_Node(dsp_orig);
+}
+
+
+//
+//  Merge_Pairs: C
+//
+// Node holding two pairs whose keys have the same hash fragments until
+// `shift`, below the node which had one of them.
+//
+static REBARR *Merge_Pairs(
+    const RELVAL *key1,
+    const RELVAL *value1,
+    uint32_t hash1,
+    const RELVAL *key2,
+    const RELVAL *value2,
+    uint32_t hash2,
+    REBLEN shift
+){
+    REBDSP dsp_orig = DSP;
+
+    if (shift >= 32) {  // all the hash bits are the same
+        Init_Blank(DS_PUSH());
+        Init_Blank(DS_PUSH());
+        Push_Pair(key1, value1);
+        Push_Pair(key2, value2);
+        return Pop_Node(dsp_orig);
+    }
+
+    REBLEN frag1 = Hash_Fragment(hash1, shift);
+    REBLEN frag2 = Hash_Fragment(hash2, shift);
+
+    if (frag1 == frag2) {
+        REBARR *child = Merge_Pairs(
+            key1, value1, hash1, key2, value2, hash2, shift + PERSISTENT_BITS
+        );
+        Push_Node_Header(0, cast(uint32_t, 1) << frag1);
+        Init_Block(DS_PUSH(), child);
+        return Pop_Node(dsp_orig);
+    }
+
+    Push_Node_Header(
+        (cast(uint32_t, 1) << frag1) | (cast(uint32_t, 1) << frag2),
+        0
+    );
+    if (frag1 < frag2) {
+        Push_Pair(key1, value1);
+        Push_Pair(key2, value2);
+    }
+    else {
+        Push_Pair(key2, value2);
+        Push_Pair(key1, value1);
+    }
+    return Pop_Node(dsp_orig);
+}
+
+
+//
+//  Pmap_Assoc: C
+//
+// New version of `node` with `key` set to `value`.  Sets `added` if the key
+// wasn't in the node (or below it) before.
+//
+static REBARR *Pmap_Assoc(
+    REBARR *node,
+    REBLEN shift,
+    uint32_t hash,
+    const REBVAL *key,
+    const REBVAL *value,
+    bool *added
+){
+    REBDSP dsp_orig = DSP;
+    REBLEN i;
+
+    if (Is_Collision_Node(node)) {
+        REBLEN num_pairs = Node_Num_Pairs(node);
+        for (i = 0; i < num_pairs; ++i) {
+            if (Pmap_Keys_Equal(Node_Pair(node, i), key)) {
+                REBARR *copy = Copy_Node(node);
+                Move_Value(ARR_AT(copy, PMAP_HEADER + 2 * i + 1), value);
+                return copy;
+            }
+        }
+        REBARR *copy = Copy_Array_At_Extra_Shallow(
+            node, 0, SPECIFIED, 2, NODE_FLAG_MANAGED
+        );
+        Move_Value(Alloc_Tail_Array(copy), key);
+        Move_Value(Alloc_Tail_Array(copy), value);
+        *added = true;
+        return copy;
+    }
+
+    uint32_t datamap = Node_Datamap(node);
+    uint32_t nodemap = Node_Nodemap(node);
+    uint32_t bit = cast(uint32_t, 1) << Hash_Fragment(hash, shift);
+    REBLEN index = Count_Bits_32(datamap & (bit - 1));
+    REBLEN num_pairs = Count_Bits_32(datamap);
+    REBLEN num_children = Count_Bits_32(nodemap);
+
+    if (datamap & bit) {
+        RELVAL *pair = Node_Pair(node, index);
+        if (Pmap_Keys_Equal(pair, key)) {  // just a new value
+            REBARR *copy = Copy_Node(node);
+            Move_Value(ARR_AT(copy, PMAP_HEADER + 2 * index + 1), value);
+            return copy;
+        }
+
+        // The fragment is taken by another key, so the two of them go down
+        // into a new child node.
+        //
+        REBARR *child = Merge_Pairs(
+            pair, pair + 1, Hash_Value(pair),
+            key, value, hash,
+            shift + PERSISTENT_BITS
+        );
+        REBLEN child_index = Count_Bits_32(nodemap & (bit - 1));
+
+        Push_Node_Header(datamap & ~bit, nodemap | bit);
+        for (i = 0; i < num_pairs; ++i) {
+            if (i != index)
+                Push_Pair(Node_Pair(node, i), Node_Pair(node, i) + 1);
+        }
+        for (i = 0; i < num_children; ++i) {
+            if (i == child_index)
+                Init_Block(DS_PUSH(), child);
+            Move_Value(DS_PUSH(), KNOWN(Node_Child_Cell(node, i)));
+        }
+        if (child_index == num_children)
+            Init_Block(DS_PUSH(), child);
+
+        *added = true;
+        return Pop_Node(dsp_orig);
+    }
+
+    if (nodemap & bit) {  // the key goes somewhere in the child
+        REBLEN child_index = Count_Bits_32(nodemap & (bit - 1));
+        RELVAL *cell = Node_Child_Cell(node, child_index);
+        REBARR *child = Pmap_Assoc(
+            VAL_ARRAY(cell), shift + PERSISTENT_BITS, hash, key, value, added
+        );
+        REBARR *copy = Copy_Node(node);
+        Init_Block(ARR_AT(copy, cell - ARR_HEAD(node)), child);
+        return copy;
+    }
+
+    Push_Node_Header(datamap | bit, nodemap);  // new pair in this node
+    for (i = 0; i < num_pairs; ++i) {
+        if (i == index)
+            Push_Pair(key, value);
+        Push_Pair(Node_Pair(node, i), Node_Pair(node, i) + 1);
+    }
+    if (index == num_pairs)
+        Push_Pair(key, value);
+    for (i = 0; i < num_children; ++i)
+        Move_Value(DS_PUSH(), KNOWN(Node_Child_Cell(node, i)));
+
+    *added = true;
+    return Pop_Node(dsp_orig);
+}
+
+
+//
+//  Pmap_Dissoc: C
+//
+// New version of `node` without `key`, or `node` itself if the key isn't
+// there.  A child node left with just one pair and no children of its own
+// is replaced by the pair (so there is only one shape of tree for any given
+// set of keys, which CT_Pmap() doesn't depend on but keeps lookups short).
+//
+static REBARR *Pmap_Dissoc(
+    REBARR *node,
+    REBLEN shift,
+    uint32_t hash,
+    const REBVAL *key
+){
+    REBDSP dsp_orig = DSP;
+    REBLEN i;
+
+    if (Is_Collision_Node(node)) {
+        REBLEN num_pairs = Node_Num_Pairs(node);
+        REBLEN found;
+        for (found = 0; found < num_pairs; ++found) {
+            if (Pmap_Keys_Equal(Node_Pair(node, found), key))
+                break;
+        }
+        if (found == num_pairs)
+            return node;
+
+        Init_Blank(DS_PUSH());
+        Init_Blank(DS_PUSH());
+        for (i = 0; i < num_pairs; ++i) {
+            if (i != found)
+                Push_Pair(Node_Pair(node, i), Node_Pair(node, i) + 1);
+        }
+        return Pop_Node(dsp_orig);
+    }
+
+    uint32_t datamap = Node_Datamap(node);
+    uint32_t nodemap = Node_Nodemap(node);
+    uint32_t bit = cast(uint32_t, 1) << Hash_Fragment(hash, shift);
+    REBLEN index = Count_Bits_32(datamap & (bit - 1));
+    REBLEN num_pairs = Count_Bits_32(datamap);
+    REBLEN num_children = Count_Bits_32(nodemap);
+
+    if (datamap & bit) {
+        if (not Pmap_Keys_Equal(Node_Pair(node, index), key))
+            return node;
+
+        Push_Node_Header(datamap & ~bit, nodemap);
+        for (i = 0; i < num_pairs; ++i) {
+            if (i != index)
+                Push_Pair(Node_Pair(node, i), Node_Pair(node, i) + 1);
+        }
+        for (i = 0; i < num_children; ++i)
+            Move_Value(DS_PUSH(), KNOWN(Node_Child_Cell(node, i)));
+        return Pop_Node(dsp_orig);
+    }
+
+    if (not (nodemap & bit))
+        return node;
+
+    REBLEN child_index = Count_Bits_32(nodemap & (bit - 1));
+    RELVAL *cell = Node_Child_Cell(node, child_index);
+    REBARR *child = Pmap_Dissoc(
+        VAL_ARRAY(cell), shift + PERSISTENT_BITS, hash, key
+    );
+    if (child == VAL_ARRAY(cell))
+        return node;
+
+    if (
+        Node_Num_Pairs(child) == 1
+        and (Is_Collision_Node(child) or Node_Nodemap(child) == 0)
+    ){
+        RELVAL *pair = Node_Pair(child, 0);  // pull it up into this node
+
+        Push_Node_Header(datamap | bit, nodemap & ~bit);
+        for (i = 0; i < num_pairs; ++i) {
+            if (i == index)
+                Push_Pair(pair, pair + 1);
+            Push_Pair(Node_Pair(node, i), Node_Pair(node, i) + 1);
+        }
+        if (index == num_pairs)
+            Push_Pair(pair, pair + 1);
+        for (i = 0; i < num_children; ++i) {
+            if (i != child_index)
+                Move_Value(DS_PUSH(), KNOWN(Node_Child_Cell(node, i)));
+        }
+        return Pop_Node(dsp_orig);
+    }
+
+    REBARR *copy = Copy_Node(node);
+    Init_Block(ARR_AT(copy, cell - ARR_HEAD(node)), child);
+    return copy;
+}
+
+
+//
+//  Pmap_Lookup: C
+//
+// The value for `key`, or nullptr if it's not in the map.
+//
+const RELVAL *Pmap_Lookup(REBARR *root, const RELVAL *key)
+{
+    uint32_t hash = Hash_Value(key);
+    REBARR *node = root;
+    REBLEN shift = 0;
+
+    while (true) {
+        REBLEN i;
+        if (Is_Collision_Node(node)) {
+            for (i = 0; i < Node_Num_Pairs(node); ++i) {
+                if (Pmap_Keys_Equal(Node_Pair(node, i), key))
+                    return Node_Pair(node, i) + 1;
+            }
+            return nullptr;
+        }
+
+        uint32_t datamap = Node_Datamap(node);
+        uint32_t nodemap = Node_Nodemap(node);
+        uint32_t bit = cast(uint32_t, 1) << Hash_Fragment(hash, shift);
+
+        if (datamap & bit) {
+            RELVAL *pair = Node_Pair(node, Count_Bits_32(datamap & (bit - 1)));
+            if (Pmap_Keys_Equal(pair, key))
+                return pair + 1;
+            return nullptr;
+        }
+
+        if (not (nodemap & bit))
+            return nullptr;
+
+        i = Count_Bits_32(nodemap & (bit - 1));
+        node = VAL_ARRAY(Node_Child_Cell(node, i));
+        shift += PERSISTENT_BITS;
+    }
+}
+
+
+//
+//  Pmap_Put: C
+//
+// New version of `pmap` with `key` set to `opt_value`, or removed if that's
+// nullptr or NULL.  (`out` may be the same cell as `pmap`.)
+//
+REBVAL *Pmap_Put(
+    REBVAL *out,
+    const REBCEL *pmap,
+    const REBVAL *key,
+    const REBVAL *opt_value
+){
+    REBARR *root = VAL_PMAP_ROOT(pmap);
+    REBLEN len = VAL_PMAP_LEN(pmap);
+    uint32_t hash = Hash_Value(key);
+
+    if (not opt_value or IS_NULLED(opt_value)) {
+        REBARR *new_root = Pmap_Dissoc(root, 0, hash, key);
+        if (new_root != root)
+            --len;
+        return Init_Pmap(out, new_root, len);
+    }
+
+    // Keys are shared by every later version, so they can't be allowed to
+    // change (see Find_Map_Entry())
+    //
+    Ensure_Value_Frozen(key, nullptr);
+
+    bool added = false;
+    REBARR *new_root = Pmap_Assoc(root, 0, hash, key, opt_value, &added);
+    return Init_Pmap(out, new_root, added ? len + 1 : len);
+}
+
+
+//
+//  Push_Pmap_Entries: C
+//
+// Push the keys and/or values under `node` to the data stack.
+//
+void Push_Pmap_Entries(REBARR *node, bool keys, bool values)
+{
+    REBLEN num_pairs = Node_Num_Pairs(node);
+    REBLEN i;
+    for (i = 0; i < num_pairs; ++i) {
+        RELVAL *pair = Node_Pair(node, i);
+        if (keys)
+            Move_Value(DS_PUSH(), KNOWN(pair));
+        if (values)
+            Move_Value(DS_PUSH(), KNOWN(pair + 1));
+    }
+
+    if (Is_Collision_Node(node))
+        return;
+
+    REBLEN num_children = Count_Bits_32(Node_Nodemap(node));
+    for (i = 0; i < num_children; ++i)
+        Push_Pmap_Entries(VAL_ARRAY(Node_Child_Cell(node, i)), keys, values);
+}
+
+
+//
+//  TO_Pmap: C
+//
+// From a block of keys and values, or from a MAP!.
+//
+REB_R TO_Pmap(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg)
+{
+    if (IS_PMAP(arg))
+        return Move_Value(out, arg);  // never changes, so no need to copy
+
+    DECLARE_LOCAL (pmap);
+    Init_Pmap(pmap, Make_Pmap_Node(0, 0), 0);
+
+    DECLARE_LOCAL (key);
+    DECLARE_LOCAL (value);
+
+    if (IS_MAP(arg)) {
+        RELVAL *item = ARR_HEAD(MAP_PAIRLIST(VAL_MAP(arg)));
+        for (; NOT_END(item); item += 2) {
+            if (IS_NULLED(item + 1))
+                continue;  // removed key, see Find_Map_Entry()
+            Move_Value(key, KNOWN(item));
+            Move_Value(value, KNOWN(item + 1));
+            Pmap_Put(pmap, pmap, key, value);
+        }
+        return Move_Value(out, pmap);
+    }
+
+    if (not IS_BLOCK(arg) or VAL_LEN_AT(arg) % 2 != 0)
+        fail (Error_Bad_Make(kind, arg));
+
+    RELVAL *item = VAL_ARRAY_AT(arg);
+    for (; NOT_END(item); item += 2) {
+        Derelativize(key, item, VAL_SPECIFIER(arg));
+        Derelativize(value, item + 1, VAL_SPECIFIER(arg));
+        Pmap_Put(pmap, pmap, key, value);
+    }
+    return Move_Value(out, pmap);
+}
+
+
+//
+//  MAKE_Pmap: C
+//
+REB_R MAKE_Pmap(
+    REBVAL *out,
+    enum Reb_Kind kind,
+    const REBVAL *opt_parent,
+    const REBVAL *arg
+){
+    if (opt_parent)
+        fail (Error_Bad_Make_Parent(kind, opt_parent));
+
+    return TO_Pmap(out, kind, arg);
+}
+
+
+//
+//  CT_Pmap: C
+//
+// Equal if they have the same keys, with equal values.
+//
+REBINT CT_Pmap(const REBCEL *a, const REBCEL *b, REBINT mode)
+{
+    if (mode < 0)
+        return -1;  // maps have no order
+
+    if (VAL_PMAP_ROOT(a) == VAL_PMAP_ROOT(b))
+        return 1;
+    if (VAL_PMAP_LEN(a) != VAL_PMAP_LEN(b))
+        return 0;
+
+    REBDSP dsp_orig = DSP;
+    Push_Pmap_Entries(VAL_PMAP_ROOT(a), true, true);
+
+    REBINT equal = 1;
+    REBDSP dsp;
+    for (dsp = dsp_orig + 1; dsp < DSP; dsp += 2) {
+        const RELVAL *other = Pmap_Lookup(VAL_PMAP_ROOT(b), DS_AT(dsp));
+        if (not other or 0 != Cmp_Value(DS_AT(dsp + 1), other, mode == 1)) {
+            equal = 0;
+            break;
+        }
+    }
+
+    DS_DROP_TO(dsp_orig);
+    return equal;
+}
+
+
+//
+//  PD_Pmap: C
+//
+// `pmap/key` is the key's value, or NULL.  Path access can't change a PMAP!
+// (use PMAP-PUT to make a new one).
+//
+REB_R PD_Pmap(
+    REBPVS *pvs,
+    const REBVAL *picker,
+    const REBVAL *opt_setval
+){
+    if (opt_setval)
+        return R_UNHANDLED;
+
+    const RELVAL *value = Pmap_Lookup(VAL_PMAP_ROOT(pvs->out), picker);
+    if (not value)
+        return Init_Nulled(pvs->out);
+    return Move_Value(pvs->out, KNOWN(value));
+}
+
+
+//
+//  REBTYPE: C
+//
+REBTYPE(Pmap)
+{
+    REBVAL *v = D_ARG(1);
+
+    switch (VAL_WORD_SYM(verb)) {
+      case SYM_REFLECT: {
+        INCLUDE_PARAMS_OF_REFLECT;
+        UNUSED(ARG(value));  // same as `v`
+
+        REBDSP dsp_orig = DSP;
+
+        REBSYM property = VAL_WORD_SYM(ARG(property));
+        switch (property) {
+          case SYM_LENGTH:
+            return Init_Integer(D_OUT, VAL_PMAP_LEN(v));
+
+          case SYM_WORDS:
+            Push_Pmap_Entries(VAL_PMAP_ROOT(v), true, false);
+            return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+
+          case SYM_VALUES:
+            Push_Pmap_Entries(VAL_PMAP_ROOT(v), false, true);
+            return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+
+          case SYM_BODY:
+            Push_Pmap_Entries(VAL_PMAP_ROOT(v), true, true);
+            return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+
+          default:
+            break;
+        }
+
+        break; }
+
+      case SYM_COPY: {
+        INCLUDE_PARAMS_OF_COPY;
+        UNUSED(PAR(value));  // same as `v`
+
+        if (REF(part) or REF(deep) or REF(types))
+            fail (Error_Bad_Refines_Raw());
+
+        RETURN (v); }  // never changes, so no need to copy
+
+      default:
+        break;
+    }
+
+    return R_UNHANDLED;
+}
+
+
+//
+//  MF_Pmap: C
+//
+void MF_Pmap(REB_MOLD *mo, const REBCEL *v, bool form)
+{
+    UNUSED(form);
+
+    Pre_Mold(mo, v);
+
+    REBDSP dsp_orig = DSP;
+    Push_Pmap_Entries(VAL_PMAP_ROOT(v), true, true);
+    REBARR *array = Pop_Stack_Values(dsp_orig);
+    Mold_Array_At(mo, array, 0, "[]");
+    Free_Unmanaged_Array(array);
+
+    End_Mold(mo);
+}
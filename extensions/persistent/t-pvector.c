@@ -0,0 +1,473 @@
+//
+//  File: %t-pvector.c
+//  Summary: "persistent vector datatype"
+//  Section: datatypes
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// The trie is like the one in Clojure's PersistentVector: element N is found
+// by taking 5 bits of N at a time from the top, with the leaves holding 32
+// elements each.  Appending copies only the tail array, until it is full and
+// becomes a leaf of the trie.  Changing an element copies the nodes on the
+// way down to it.
+//
+// !!! An "RRB" (relaxed radix balanced) trie would also allow concatenating
+// and slicing in O(log n), but needs size tables in the nodes which are not
+// full.  This doesn't offer those operations yet, so it's not done.
+//
+
+#include "sys-core.h"
+
+#include "sys-persistent.h"
+
+
+inline static REBARR *Pvector_Root(const REBCEL *v) {
+    RELVAL *root = ARR_AT(VAL_PVECTOR_ARRAY(v), PVECTOR_ROOT_SLOT);
+    return IS_BLANK(root) ? nullptr : VAL_ARRAY(root);
+}
+
+inline static REBARR *Pvector_Tail(const REBCEL *v)
+  { return VAL_ARRAY(ARR_AT(VAL_PVECTOR_ARRAY(v), PVECTOR_TAIL_SLOT)); }
+
+// Number of elements in the trie (the ones before the tail)
+//
+inline static REBLEN Pvector_Tailoff(const REBCEL *v)
+  { return VAL_PVECTOR_LEN(v) - ARR_LEN(Pvector_Tail(v)); }
+
+// The root's children are indexed by the bits of the element number from
+// `shift` up.  So a trie of `tailoff` elements needs the least shift where
+// 32 << shift is at least that many (a shift of 0 means the root is a leaf).
+//
+inline static REBLEN Pvector_Shift(REBLEN tailoff) {
+    REBLEN shift = 0;
+    while ((cast(REBLEN, PERSISTENT_WIDTH) << shift) < tailoff)
+        shift += PERSISTENT_BITS;
+    return shift;
+}
+
+inline static REBARR *Copy_Node_Extra(REBARR *node, REBLEN extra) {
+    return Copy_Array_At_Extra_Shallow(
+        node, 0, SPECIFIED, extra, NODE_FLAG_MANAGED
+    );
+}
+
+
+//
+//  Init_Pvector: C
+//
+REBVAL *Init_Pvector(
+    RELVAL *out,
+    REBARR *opt_root,
+    REBARR *tail,
+    REBLEN len
+){
+    REBARR *a = Make_Array_Core(2, NODE_FLAG_MANAGED);
+    if (opt_root)
+        Init_Block(Alloc_Tail_Array(a), opt_root);
+    else
+        Init_Blank(Alloc_Tail_Array(a));
+    Init_Block(Alloc_Tail_Array(a), tail);
+
+    RESET_CUSTOM_CELL(out, EG_Pvector_Type, CELL_FLAG_FIRST_IS_NODE);
+    INIT_VAL_NODE(out, a);
+    VAL_PVECTOR_LEN(out) = len;
+    return KNOWN(out);
+}
+
+
+//
+//  Pvector_At: C
+//
+// Element N (0-based, and the caller checks it's less than the length)
+//
+const RELVAL *Pvector_At(const REBCEL *pvec, REBLEN n)
+{
+    assert(n < VAL_PVECTOR_LEN(pvec));
+
+    REBLEN tailoff = Pvector_Tailoff(pvec);
+    if (n >= tailoff)
+        return ARR_AT(Pvector_Tail(pvec), n - tailoff);
+
+    REBARR *node = Pvector_Root(pvec);
+    REBLEN level = Pvector_Shift(tailoff);
+    for (; level > 0; level -= PERSISTENT_BITS)
+        node = VAL_ARRAY(ARR_AT(node, (n >> level) & PERSISTENT_MASK));
+
+    return ARR_AT(node, n & PERSISTENT_MASK);
+}
+
+
+// A chain of single-child nodes from `level` down to the leaf.
+//
+static REBARR *New_Path(REBLEN level, REBARR *leaf)
+{
+    if (level == 0)
+        return leaf;
+
+    REBARR *a = Make_Array_Core(1, NODE_FLAG_MANAGED);
+    Init_Block(Alloc_Tail_Array(a), New_Path(level - PERSISTENT_BITS, leaf));
+    return a;
+}
+
+
+//
+//  Push_Leaf: C
+//
+// New version of `node` (which has room) with `leaf` added after its other
+// leaves, as the leaf holding elements from `index` on.
+//
+static REBARR *Push_Leaf(
+    REBARR *node,
+    REBLEN level,
+    REBLEN index,
+    REBARR *leaf
+){
+    REBARR *copy = Copy_Node_Extra(node, 1);
+    REBLEN sub = (index >> level) & PERSISTENT_MASK;
+
+    if (level == PERSISTENT_BITS)  // children are leaves
+        Init_Block(Alloc_Tail_Array(copy), leaf);
+    else if (sub < ARR_LEN(node))  // the last child still has room
+        Init_Block(
+            ARR_AT(copy, sub),
+            Push_Leaf(
+                VAL_ARRAY(ARR_AT(node, sub)),
+                level - PERSISTENT_BITS,
+                index,
+                leaf
+            )
+        );
+    else
+        Init_Block(
+            Alloc_Tail_Array(copy),
+            New_Path(level - PERSISTENT_BITS, leaf)
+        );
+
+    return copy;
+}
+
+
+//
+//  Pvector_Append: C
+//
+// New version of `pvec` with `value` added at the end.
+//
+REBVAL *Pvector_Append(REBVAL *out, const REBCEL *pvec, const RELVAL *value)
+{
+    REBARR *root = Pvector_Root(pvec);
+    REBARR *tail = Pvector_Tail(pvec);
+    REBLEN len = VAL_PVECTOR_LEN(pvec);
+
+    if (ARR_LEN(tail) < PERSISTENT_WIDTH) {  // the usual case
+        REBARR *new_tail = Copy_Node_Extra(tail, 1);
+        Move_Value(Alloc_Tail_Array(new_tail), KNOWN(value));
+        return Init_Pvector(out, root, new_tail, len + 1);
+    }
+
+    // The full tail becomes a leaf of the trie, and a new tail is started.
+    //
+    REBLEN tailoff = len - PERSISTENT_WIDTH;
+    REBARR *new_root;
+    if (tailoff == 0)
+        new_root = tail;
+    else {
+        REBLEN shift = Pvector_Shift(tailoff);
+        if (tailoff == (cast(REBLEN, PERSISTENT_WIDTH) << shift)) {
+            new_root = Make_Array_Core(2, NODE_FLAG_MANAGED);  // one up
+            Init_Block(Alloc_Tail_Array(new_root), root);
+            Init_Block(Alloc_Tail_Array(new_root), New_Path(shift, tail));
+        }
+        else
+            new_root = Push_Leaf(root, shift, tailoff, tail);
+    }
+
+    REBARR *new_tail = Make_Array_Core(PERSISTENT_WIDTH, NODE_FLAG_MANAGED);
+    Move_Value(Alloc_Tail_Array(new_tail), KNOWN(value));
+    return Init_Pvector(out, new_root, new_tail, len + 1);
+}
+
+
+static REBARR *Poke_Node(
+    REBARR *node,
+    REBLEN level,
+    REBLEN n,
+    const RELVAL *value
+){
+    REBARR *copy = Copy_Node_Extra(node, 0);
+    if (level == 0)
+        Move_Value(ARR_AT(copy, n & PERSISTENT_MASK), KNOWN(value));
+    else {
+        REBLEN sub = (n >> level) & PERSISTENT_MASK;
+        Init_Block(
+            ARR_AT(copy, sub),
+            Poke_Node(
+                VAL_ARRAY(ARR_AT(node, sub)),
+                level - PERSISTENT_BITS,
+                n,
+                value
+            )
+        );
+    }
+    return copy;
+}
+
+
+//
+//  Pvector_Poke: C
+//
+// New version of `pvec` with element N (0-based, which the caller checks is
+// less than the length) changed to `value`.
+//
+REBVAL *Pvector_Poke(
+    REBVAL *out,
+    const REBCEL *pvec,
+    REBLEN n,
+    const RELVAL *value
+){
+    assert(n < VAL_PVECTOR_LEN(pvec));
+
+    REBARR *root = Pvector_Root(pvec);
+    REBARR *tail = Pvector_Tail(pvec);
+    REBLEN len = VAL_PVECTOR_LEN(pvec);
+    REBLEN tailoff = Pvector_Tailoff(pvec);
+
+    if (n >= tailoff) {
+        REBARR *new_tail = Copy_Node_Extra(tail, 0);
+        Move_Value(ARR_AT(new_tail, n - tailoff), KNOWN(value));
+        return Init_Pvector(out, root, new_tail, len);
+    }
+
+    REBARR *new_root = Poke_Node(root, Pvector_Shift(tailoff), n, value);
+    return Init_Pvector(out, new_root, tail, len);
+}
+
+
+//
+//  Make_Pvector_From_Values: C
+//
+// Build the trie a level at a time, instead of appending each value (which
+// would copy the path to the end over and over).
+//
+REBVAL *Make_Pvector_From_Values(
+    REBVAL *out,
+    const RELVAL *head,
+    REBLEN len,
+    REBSPC *specifier
+){
+    REBLEN tailoff = len == 0
+        ? 0
+        : ((len - 1) >> PERSISTENT_BITS) << PERSISTENT_BITS;
+
+    REBARR *tail = Make_Array_Core(PERSISTENT_WIDTH, NODE_FLAG_MANAGED);
+    REBLEN i;
+    for (i = tailoff; i < len; ++i)
+        Derelativize(Alloc_Tail_Array(tail), head + i, specifier);
+
+    REBDSP dsp_orig = DSP;
+
+    for (i = 0; i < tailoff; i += PERSISTENT_WIDTH) {
+        REBARR *leaf = Make_Array_Core(PERSISTENT_WIDTH, NODE_FLAG_MANAGED);
+        REBLEN j;
+        for (j = 0; j < PERSISTENT_WIDTH; ++j)
+            Derelativize(Alloc_Tail_Array(leaf), head + i + j, specifier);
+        Init_Block(DS_PUSH(), leaf);
+    }
+
+    // Group the nodes on the stack 32 at a time into parents, which replace
+    // them on the stack, until there is just the root.  (Parent P goes in
+    // stack slot P, which parents 0..P-1 have already taken the node from.)
+    //
+    REBLEN count = DSP - dsp_orig;
+    while (count > 1) {
+        REBLEN parents = (count + PERSISTENT_WIDTH - 1) / PERSISTENT_WIDTH;
+        REBLEN p;
+        for (p = 0; p < parents; ++p) {
+            REBLEN first = p * PERSISTENT_WIDTH;
+            REBLEN n = count - first;
+            if (n > PERSISTENT_WIDTH)
+                n = PERSISTENT_WIDTH;
+
+            REBARR *parent = Make_Array_Core(n, NODE_FLAG_MANAGED);
+            REBLEN j;
+            for (j = 0; j < n; ++j)
+                Move_Value(
+                    Alloc_Tail_Array(parent),
+                    DS_AT(dsp_orig + 1 + first + j)
+                );
+            Init_Block(DS_AT(dsp_orig + 1 + p), parent);
+        }
+        DS_DROP_TO(dsp_orig + parents);
+        count = parents;
+    }
+
+    REBARR *root = count == 0 ? nullptr : VAL_ARRAY(DS_AT(dsp_orig + 1));
+    DS_DROP_TO(dsp_orig);
+
+    return Init_Pvector(out, root, tail, len);
+}
+
+
+static void Push_Pvector_Values(const REBCEL *pvec)
+{
+    REBLEN len = VAL_PVECTOR_LEN(pvec);
+    REBLEN n;
+    for (n = 0; n < len; ++n)
+        Move_Value(DS_PUSH(), KNOWN(Pvector_At(pvec, n)));
+}
+
+
+//
+//  TO_Pvector: C
+//
+REB_R TO_Pvector(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg)
+{
+    if (IS_PVECTOR(arg))
+        return Move_Value(out, arg);  // never changes, so no need to copy
+
+    if (not IS_BLOCK(arg))
+        fail (Error_Bad_Make(kind, arg));
+
+    return Make_Pvector_From_Values(
+        out, VAL_ARRAY_AT(arg), VAL_LEN_AT(arg), VAL_SPECIFIER(arg)
+    );
+}
+
+
+//
+//  MAKE_Pvector: C
+//
+REB_R MAKE_Pvector(
+    REBVAL *out,
+    enum Reb_Kind kind,
+    const REBVAL *opt_parent,
+    const REBVAL *arg
+){
+    if (opt_parent)
+        fail (Error_Bad_Make_Parent(kind, opt_parent));
+
+    return TO_Pvector(out, kind, arg);
+}
+
+
+//
+//  CT_Pvector: C
+//
+REBINT CT_Pvector(const REBCEL *a, const REBCEL *b, REBINT mode)
+{
+    if (mode < 0)
+        return -1;  // !!! could compare like blocks do
+
+    if (VAL_PVECTOR_ARRAY(a) == VAL_PVECTOR_ARRAY(b))
+        return 1;
+    if (VAL_PVECTOR_LEN(a) != VAL_PVECTOR_LEN(b))
+        return 0;
+
+    REBLEN n;
+    for (n = 0; n < VAL_PVECTOR_LEN(a); ++n) {
+        if (0 != Cmp_Value(Pvector_At(a, n), Pvector_At(b, n), mode == 1))
+            return 0;
+    }
+    return 1;
+}
+
+
+//
+//  PD_Pvector: C
+//
+// `pvec/3` is the third element, or NULL.  Path access can't change a
+// PVECTOR! (use PVECTOR-POKE to make a new one).
+//
+REB_R PD_Pvector(
+    REBPVS *pvs,
+    const REBVAL *picker,
+    const REBVAL *opt_setval
+){
+    if (opt_setval or not IS_INTEGER(picker))
+        return R_UNHANDLED;
+
+    REBINT n = VAL_INT32(picker);
+    if (n <= 0 or cast(REBLEN, n) > VAL_PVECTOR_LEN(pvs->out))
+        return Init_Nulled(pvs->out);
+
+    return Move_Value(pvs->out, KNOWN(Pvector_At(pvs->out, n - 1)));
+}
+
+
+//
+//  REBTYPE: C
+//
+REBTYPE(Pvector)
+{
+    REBVAL *v = D_ARG(1);
+
+    switch (VAL_WORD_SYM(verb)) {
+      case SYM_REFLECT: {
+        INCLUDE_PARAMS_OF_REFLECT;
+        UNUSED(ARG(value));  // same as `v`
+
+        REBDSP dsp_orig = DSP;
+
+        REBSYM property = VAL_WORD_SYM(ARG(property));
+        switch (property) {
+          case SYM_LENGTH:
+            return Init_Integer(D_OUT, VAL_PVECTOR_LEN(v));
+
+          case SYM_VALUES:
+            Push_Pvector_Values(v);
+            return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+
+          default:
+            break;
+        }
+
+        break; }
+
+      case SYM_COPY: {
+        INCLUDE_PARAMS_OF_COPY;
+        UNUSED(PAR(value));  // same as `v`
+
+        if (REF(part) or REF(deep) or REF(types))
+            fail (Error_Bad_Refines_Raw());
+
+        RETURN (v); }  // never changes, so no need to copy
+
+      default:
+        break;
+    }
+
+    return R_UNHANDLED;
+}
+
+
+//
+//  MF_Pvector: C
+//
+void MF_Pvector(REB_MOLD *mo, const REBCEL *v, bool form)
+{
+    UNUSED(form);
+
+    Pre_Mold(mo, v);
+
+    REBDSP dsp_orig = DSP;
+    Push_Pvector_Values(v);
+    REBARR *array = Pop_Stack_Values(dsp_orig);
+    Mold_Array_At(mo, array, 0, "[]");
+    Free_Unmanaged_Array(array);
+
+    End_Mold(mo);
+}
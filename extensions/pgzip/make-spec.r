@@ -0,0 +1,13 @@
+REBOL []
+
+name: 'Pgzip
+source: %pgzip/mod-pgzip.c
+includes: [
+    %prep/extensions/pgzip
+]
+
+; Windows threads come from kernel32, which is linked by default.
+;
+libraries: try if system-config/os-base <> 'Windows [
+    [%pthread]
+]
@@ -0,0 +1,394 @@
+//
+//  File: %mod-pgzip.c
+//  Summary: "GZIP compression with blocks deflated on several threads"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// This follows the approach of Mark Adler's "pigz".  The input is cut into
+// blocks which are raw-deflated independently, each primed with the last
+// 32K of the input before it as a preset dictionary (so the compression
+// ratio is close to that of a single stream).  Every block but the last ends
+// with a sync flush, which byte-aligns it without marking the deflate stream
+// as finished--so the blocks can simply be concatenated.  The CRC-32 of each
+// block is computed on its thread too, and merged with crc32_combine().
+//
+// The result is one ordinary gzip member, which GUNZIP or any gzip tool can
+// decompress.
+//
+// Worker threads only use zlib and malloc(), never the Rebol API (which is
+// not thread-safe).  The input series can't move or be freed while they run,
+// because the calling native doesn't return to the evaluator until all of
+// them have been joined.
+//
+
+#ifdef TO_WINDOWS
+    #define WIN32_LEAN_AND_MEAN  // trim down the Win32 headers
+    #include <windows.h>
+    #undef IS_ERROR  // winerror.h defines, Rebol has a different meaning
+#else
+    #include <pthread.h>
+    #include <unistd.h>  // for sysconf()
+#endif
+
+#include "sys-core.h"
+#include "sys-zlib.h"
+
+#include "tmp-mod-pgzip.h"
+
+
+#define PGZIP_DICT_SIZE 32768  // size of the deflate window
+#define PGZIP_DEFAULT_BLOCK_SIZE (128 * 1024)  // same default as pigz
+
+
+struct Reb_Gzip_Block {
+    const REBYTE *in;
+    size_t in_size;
+    const REBYTE *dict;  // tail of the previous block's input, if any
+    size_t dict_size;
+    bool last;  // finishes the deflate stream instead of sync flushing
+
+    REBYTE *out;  // malloc()'d by the worker, freed by the caller
+    size_t out_size;
+    uLong crc;
+    int ret;  // Z_OK, or the zlib error code
+};
+
+struct Reb_Gzip_Job {
+    struct Reb_Gzip_Block *blocks;
+    REBLEN num_blocks;
+    REBLEN first;  // a job does blocks first, first + stride, ...
+    REBLEN stride;
+    int level;
+};
+
+
+static void *zalloc_thread(void *opaque, unsigned nr, unsigned size)
+{
+    UNUSED(opaque);
+    return malloc(nr * size);  // rebMalloc() can't be used off main thread
+}
+
+static void zfree_thread(void *opaque, void *addr)
+{
+    UNUSED(opaque);
+    free(addr);
+}
+
+
+//
+//  Deflate_Block: C
+//
+static void Deflate_Block(struct Reb_Gzip_Block *b, int level)
+{
+    b->crc = crc32_z(0L, b->in, b->in_size);
+    b->out = nullptr;
+    b->out_size = 0;
+
+    size_t capacity;  // declared before the gotos (C++ forbids skipping it)
+
+    z_stream strm;
+    strm.zalloc = &zalloc_thread;
+    strm.zfree = &zfree_thread;
+    strm.opaque = nullptr;
+
+    b->ret = deflateInit2(
+        &strm, level, Z_DEFLATED, -(MAX_WBITS), 8, Z_DEFAULT_STRATEGY
+    );
+    if (b->ret != Z_OK)
+        return;
+
+    if (b->dict_size != 0) {
+        b->ret = deflateSetDictionary(&strm, b->dict, b->dict_size);
+        if (b->ret != Z_OK)
+            goto cleanup;
+    }
+
+    // deflateBound() covers a finished stream, a sync flush needs a few more
+    // bytes for its empty stored block.  Grow in the unlikely case it's not
+    // enough, rather than trying to predict exactly.
+    //
+    capacity = deflateBound(&strm, b->in_size) + 16;
+    b->out = cast(REBYTE*, malloc(capacity));
+    if (not b->out) {
+        b->ret = Z_MEM_ERROR;
+        goto cleanup;
+    }
+
+    strm.next_in = b->in;
+    strm.avail_in = b->in_size;
+    strm.next_out = b->out;
+    strm.avail_out = capacity;
+
+    while (true) {
+        int ret = deflate(&strm, b->last ? Z_FINISH : Z_SYNC_FLUSH);
+        if (ret == Z_STREAM_ERROR) {
+            b->ret = ret;
+            goto cleanup;
+        }
+        if (strm.avail_out != 0)
+            break;  // there was room left, so the flush completed
+
+        size_t used = capacity;
+        capacity *= 2;
+        REBYTE *grown = cast(REBYTE*, realloc(b->out, capacity));
+        if (not grown) {
+            b->ret = Z_MEM_ERROR;
+            goto cleanup;
+        }
+        b->out = grown;
+        strm.next_out = b->out + used;
+        strm.avail_out = capacity - used;
+    }
+
+    b->out_size = capacity - strm.avail_out;
+    b->ret = Z_OK;
+
+  cleanup:
+    deflateEnd(&strm);
+}
+
+
+static void Run_Job(struct Reb_Gzip_Job *job)
+{
+    REBLEN i;
+    for (i = job->first; i < job->num_blocks; i += job->stride)
+        Deflate_Block(&job->blocks[i], job->level);
+}
+
+#ifdef TO_WINDOWS
+    static DWORD WINAPI Job_Thread(LPVOID p) {
+        Run_Job(cast(struct Reb_Gzip_Job*, p));
+        return 0;
+    }
+    typedef HANDLE REBTHR;
+#else
+    static void *Job_Thread(void *p) {
+        Run_Job(cast(struct Reb_Gzip_Job*, p));
+        return nullptr;
+    }
+    typedef pthread_t REBTHR;
+#endif
+
+
+static REBLEN Num_Cpus(void)
+{
+  #ifdef TO_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+  #else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n < 1 ? 1 : cast(REBLEN, n);
+  #endif
+}
+
+
+static void Put_U32_LE(REBYTE *bp, uLong n)
+{
+    bp[0] = n & 0xFF;
+    bp[1] = (n >> 8) & 0xFF;
+    bp[2] = (n >> 16) & 0xFF;
+    bp[3] = (n >> 24) & 0xFF;
+}
+
+
+//
+//  export parallel-gzip: native [
+//
+//  {Deflate with gzip envelope, compressing blocks of the data in parallel}
+//
+//      return: "Single gzip member, GUNZIP (or any gzip tool) decompresses"
+//          [binary!]
+//      data "If text, it will be UTF-8 encoded"
+//          [binary! text!]
+//      /part "Length of data (elements)"
+//          [any-value!]
+//      /threads "Number of threads to use (default is the number of CPUs)"
+//          [integer!]
+//      /block-size "Bytes of input compressed per block (default 128K)"
+//          [integer!]
+//      /level "Compression level from 0 (store only) to 9 (slowest)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(parallel_gzip)
+{
+    PGZIP_INCLUDE_PARAMS_OF_PARALLEL_GZIP;
+
+    REBLEN limit = Part_Len_May_Modify_Index(ARG(data), ARG(part));
+
+    REBSIZ size;
+    const REBYTE *bp = VAL_BYTES_LIMIT_AT(&size, ARG(data), limit);
+
+    REBLEN threads = Num_Cpus();
+    if (REF(threads)) {
+        REBINT n = VAL_INT32(ARG(threads));
+        if (n < 1)
+            fail (PAR(threads));
+        threads = n;
+    }
+
+    size_t block_size = PGZIP_DEFAULT_BLOCK_SIZE;
+    if (REF(block_size)) {
+        REBINT n = VAL_INT32(ARG(block_size));
+        if (n < 1 or n > (1 << 30))  // avail_in is only 32 bits
+            fail (PAR(block_size));
+        block_size = n;
+    }
+
+    int level = Z_DEFAULT_COMPRESSION;
+    if (REF(level)) {
+        level = VAL_INT32(ARG(level));
+        if (level < 0 or level > 9)
+            fail (PAR(level));
+    }
+
+    REBLEN num_blocks = (size + block_size - 1) / block_size;
+    if (num_blocks == 0)
+        num_blocks = 1;  // still need a (final, empty) deflate block
+    if (threads > num_blocks)
+        threads = num_blocks;
+
+    struct Reb_Gzip_Block *blocks = rebAllocN(
+        struct Reb_Gzip_Block, num_blocks
+    );
+    struct Reb_Gzip_Job *jobs = rebAllocN(struct Reb_Gzip_Job, threads);
+    REBTHR *handles = rebAllocN(REBTHR, threads);
+    bool *started = rebAllocN(bool, threads);
+
+    REBLEN i;
+    for (i = 0; i < num_blocks; ++i) {
+        struct Reb_Gzip_Block *b = &blocks[i];
+        size_t offset = i * block_size;
+        b->in = bp + offset;
+        b->in_size = (i == num_blocks - 1) ? size - offset : block_size;
+        b->dict_size = offset < PGZIP_DICT_SIZE ? offset : PGZIP_DICT_SIZE;
+        b->dict = b->in - b->dict_size;
+        b->last = (i == num_blocks - 1);
+        b->out = nullptr;
+        b->ret = Z_OK;
+    }
+
+    // Job 0 runs on this thread, while the others get threads of their own.
+    // If a thread can't be started, its job is run here too--slower, but
+    // still correct.
+    //
+    REBLEN t;
+    for (t = 0; t < threads; ++t) {
+        jobs[t].blocks = blocks;
+        jobs[t].num_blocks = num_blocks;
+        jobs[t].first = t;
+        jobs[t].stride = threads;
+        jobs[t].level = level;
+
+        started[t] = false;
+        if (t == 0)
+            continue;
+
+      #ifdef TO_WINDOWS
+        handles[t] = CreateThread(nullptr, 0, &Job_Thread, &jobs[t], 0, nullptr);
+        started[t] = (handles[t] != nullptr);
+      #else
+        started[t] = (
+            pthread_create(&handles[t], nullptr, &Job_Thread, &jobs[t]) == 0
+        );
+      #endif
+    }
+
+    for (t = 0; t < threads; ++t) {
+        if (not started[t])
+            Run_Job(&jobs[t]);
+    }
+
+    for (t = 1; t < threads; ++t) {
+        if (not started[t])
+            continue;
+      #ifdef TO_WINDOWS
+        WaitForSingleObject(handles[t], INFINITE);
+        CloseHandle(handles[t]);
+      #else
+        pthread_join(handles[t], nullptr);
+      #endif
+    }
+
+    // All threads are finished, so the per-block results can be gathered.
+    // Outputs are malloc()'d, so they are freed before any fail() happens.
+    //
+    int ret = Z_OK;
+    size_t compressed_size = 0;
+    uLong crc = blocks[0].crc;
+    for (i = 0; i < num_blocks; ++i) {
+        if (blocks[i].ret != Z_OK and ret == Z_OK)
+            ret = blocks[i].ret;
+        compressed_size += blocks[i].out_size;
+        if (i != 0)
+            crc = crc32_combine(crc, blocks[i].crc, blocks[i].in_size);
+    }
+
+    if (ret != Z_OK) {
+        for (i = 0; i < num_blocks; ++i)
+            free(blocks[i].out);
+
+        if (ret == Z_MEM_ERROR)
+            fail (Error_No_Memory(block_size));
+
+        DECLARE_LOCAL (arg);
+        Init_Integer(arg, ret);
+        fail (Error_Bad_Compression_Raw(arg));
+    }
+
+    // !!! If this allocation fails, the block outputs leak.  It's all that
+    // could fail here, and it's the same size as what's already allocated.
+    //
+    const size_t header_size = 10;
+    const size_t trailer_size = 8;
+    size_t total = header_size + compressed_size + trailer_size;
+    REBYTE *output = rebAllocN(REBYTE, total);
+
+    // Minimal gzip header: magic, DEFLATE method, no flags, no timestamp,
+    // extra flags for max/fast compression, unknown OS.
+    //
+    REBYTE *dest = output;
+    *dest++ = 0x1F;
+    *dest++ = 0x8B;
+    *dest++ = Z_DEFLATED;
+    *dest++ = 0;  // FLG
+    Put_U32_LE(dest, 0);  // MTIME
+    dest += 4;
+    *dest++ = (level == 9) ? 2 : (level == 1) ? 4 : 0;  // XFL
+    *dest++ = 255;  // OS
+
+    for (i = 0; i < num_blocks; ++i) {
+        memcpy(dest, blocks[i].out, blocks[i].out_size);
+        dest += blocks[i].out_size;
+        free(blocks[i].out);
+    }
+
+    Put_U32_LE(dest, crc);
+    Put_U32_LE(dest + 4, size & 0xFFFFFFFF);  // ISIZE is modulo 2^32
+    dest += trailer_size;
+    assert(dest == output + total);
+
+    rebFree(started);
+    rebFree(handles);
+    rebFree(jobs);
+    rebFree(blocks);
+
+    return rebRepossess(output, total);
+}
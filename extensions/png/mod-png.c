@@ -36,13 +36,15 @@
 //
 // Note: LodePNG is known to be slower than the more heavyweight "libpng"
 // library, and does not support the progressive/streaming decoding used by
-// web browsers.  For this reason, the extension is called "lodepng", to make
-// room for more sophisticated PNG decoders in the future.
+// web browsers.  So the most common kinds of PNG are decoded a row at a time
+// by code in this file (see Decode_Png_Rows()), with LodePNG used for the
+// rest and for encoding.
 //
 
 #include "lodepng.h"
 
 #include "sys-core.h"
+#include "sys-zlib.h"  // for the row-streaming decoder
 
 #include "tmp-mod-png.h"
 
@@ -132,6 +134,487 @@ static unsigned rebol_zlib_compress(
 }
 
 
+//=//// ROW-STREAMING DECODER FOR COMMON PNGS /////////////////////////////=//
+//
+// LodePNG gathers the IDAT chunks into one buffer, inflates that into a
+// second buffer of filtered scanlines, unfilters into a third in the PNG's
+// own color format, and converts that into a fourth in RGBA.  For a big
+// image that's a lot of peak memory and several passes over all of it.
+//
+// The most common PNGs--8 bits per channel, not interlaced, gray, gray with
+// alpha, RGB or RGBA, and no tRNS chunk--are instead decoded here a row at a
+// time.  IDAT data is inflated straight out of the input's chunks into one
+// row's worth of buffer, and each row is unfiltered and then converted into
+// its place in the RGBA pixel memory that becomes the IMAGE!.  Other PNGs,
+// and any that look damaged, go through LodePNG (which gives the errors).
+//
+// The Sub, Avg and Paeth filters for 3 and 4 byte pixels are undone with
+// SSE2 a pixel at a time, following libpng's %filter_sse2_intrinsics.c, and
+// the Up filter 16 bytes at a time.  Every x86-64 CPU has SSE2, so that is
+// decided at compile time.  RGB is expanded to RGBA with SSSE3 if the CPU
+// has it (checked once with CPUID).
+//
+//=////////////////////////////////////////////////////////////////////////=//
+
+#if !defined(REBOL_NO_PNG_SIMD) && (defined(__SSE2__) \
+    || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+
+    #define PNG_SIMD_X86
+    #include <immintrin.h>
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define SIMD_TARGET(t)
+    #else
+        #include <cpuid.h>
+        #define SIMD_TARGET(t) __attribute__((target(t)))
+    #endif
+
+static int Png_Ssse3_Ok = -1;  // -1 means CPUID hasn't been checked yet
+
+static bool Has_Png_Ssse3(void)
+{
+    if (Png_Ssse3_Ok < 0) {
+        unsigned int ecx;
+
+      #if defined(_MSC_VER)
+        int regs[4];
+        __cpuid(regs, 1);
+        ecx = cast(unsigned int, regs[2]);
+      #else
+        unsigned int eax, ebx, edx;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+            ecx = 0;
+      #endif
+
+        Png_Ssse3_Ok = (ecx & (1u << 9)) ? 1 : 0;  // bit 9 is SSSE3
+    }
+    return Png_Ssse3_Ok == 1;
+}
+
+// Pixels of 3 or 4 bytes go in and out of the low lanes of a register
+
+static __m128i Load_Pixel(const REBYTE *p, size_t bpp) {
+    uint32_t tmp = 0;
+    memcpy(&tmp, p, bpp);
+    return _mm_cvtsi32_si128(cast(int, tmp));
+}
+
+static void Store_Pixel(REBYTE *p, __m128i v, size_t bpp) {
+    uint32_t tmp = cast(uint32_t, _mm_cvtsi128_si32(v));
+    memcpy(p, &tmp, bpp);
+}
+
+// Four RGB pixels per step, each followed by an opaque alpha.  The 16-byte
+// loads read 4 bytes past the 12 used, so stop while that's still in the row.
+//
+SIMD_TARGET("ssse3")
+static unsigned Expand_Rgb_Ssse3(REBYTE *out, const REBYTE *in, unsigned w)
+{
+    const __m128i spread = _mm_setr_epi8(
+        0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1
+    );
+    const __m128i alpha = _mm_set1_epi32(cast(int, 0xFF000000u));
+
+    unsigned x;
+    for (x = 0; x + 6 <= w; x += 4) {
+        __m128i v = _mm_loadu_si128(cast(const __m128i*, in + 3 * x));
+        v = _mm_or_si128(_mm_shuffle_epi8(v, spread), alpha);
+        _mm_storeu_si128(cast(__m128i*, out + 4 * x), v);
+    }
+    return x;
+}
+
+#endif
+
+
+//
+//  Unfilter_Row: C
+//
+// Undo the PNG filter on `row` in place, given the previous unfiltered row
+// (all zero for the first row).  `bpp` is the bytes per pixel.  Returns
+// false for a filter type that doesn't exist.
+//
+static bool Unfilter_Row(
+    REBYTE *row,
+    const REBYTE *prev,
+    size_t bpp,
+    REBYTE filter,
+    size_t len
+){
+    size_t i;
+
+  #if defined(PNG_SIMD_X86)
+    if (filter == 2) {  // Up, no dependency between bytes
+        for (i = 0; i + 16 <= len; i += 16) {
+            __m128i r = _mm_loadu_si128(cast(const __m128i*, row + i));
+            __m128i p = _mm_loadu_si128(cast(const __m128i*, prev + i));
+            _mm_storeu_si128(cast(__m128i*, row + i), _mm_add_epi8(r, p));
+        }
+        for (; i < len; ++i)
+            row[i] += prev[i];
+        return true;
+    }
+
+    if ((bpp == 3 or bpp == 4) and filter != 0 and filter <= 4) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i a = zero;  // left pixel (already unfiltered)
+
+        switch (filter) {
+          case 1:  // Sub
+            for (i = 0; i < len; i += bpp) {
+                a = _mm_add_epi8(a, Load_Pixel(row + i, bpp));
+                Store_Pixel(row + i, a, bpp);
+            }
+            break;
+
+          case 3:  // Avg, floor((left + up) / 2)
+            for (i = 0; i < len; i += bpp) {
+                __m128i b = Load_Pixel(prev + i, bpp);
+                __m128i avg = _mm_avg_epu8(a, b);  // rounds up, so...
+                avg = _mm_sub_epi8(  // ...take off the odd bit
+                    avg, _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1))
+                );
+                a = _mm_add_epi8(Load_Pixel(row + i, bpp), avg);
+                Store_Pixel(row + i, a, bpp);
+            }
+            break;
+
+          case 4: {  // Paeth, in 16-bit lanes so differences can go negative
+            __m128i b = zero;
+            __m128i c;
+            for (i = 0; i < len; i += bpp) {
+                c = b;
+                b = _mm_unpacklo_epi8(Load_Pixel(prev + i, bpp), zero);
+
+                __m128i pa = _mm_sub_epi16(b, c);  // |p - a| is |b - c|
+                __m128i pb = _mm_sub_epi16(a, c);  // |p - b| is |a - c|
+                __m128i pc = _mm_add_epi16(pa, pb);  // |p - c|
+                pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+                pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+                pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+
+                // Ties go to a, then b (same as LodePNG's paethPredictor)
+                //
+                __m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+                __m128i use_a = _mm_cmpeq_epi16(smallest, pa);
+                __m128i use_b = _mm_cmpeq_epi16(smallest, pb);
+                __m128i pred = _mm_or_si128(
+                    _mm_and_si128(use_b, b), _mm_andnot_si128(use_b, c)
+                );
+                pred = _mm_or_si128(
+                    _mm_and_si128(use_a, a), _mm_andnot_si128(use_a, pred)
+                );
+
+                a = _mm_add_epi8(
+                    _mm_unpacklo_epi8(Load_Pixel(row + i, bpp), zero), pred
+                );
+                a = _mm_and_si128(a, _mm_set1_epi16(0xFF));
+                Store_Pixel(row + i, _mm_packus_epi16(a, a), bpp);
+            }
+            break; }
+        }
+        return true;
+    }
+  #endif
+
+    switch (filter) {
+      case 0:  // None
+        break;
+
+      case 1:  // Sub
+        for (i = bpp; i < len; ++i)
+            row[i] += row[i - bpp];
+        break;
+
+      case 2:  // Up
+        for (i = 0; i < len; ++i)
+            row[i] += prev[i];
+        break;
+
+      case 3:  // Avg
+        for (i = 0; i < bpp; ++i)
+            row[i] += prev[i] >> 1;
+        for (; i < len; ++i)
+            row[i] += (row[i - bpp] + prev[i]) >> 1;
+        break;
+
+      case 4:  // Paeth
+        for (i = 0; i < bpp; ++i)
+            row[i] += prev[i];
+        for (; i < len; ++i) {
+            int a = row[i - bpp];
+            int b = prev[i];
+            int c = prev[i - bpp];
+            int pa = abs(b - c);
+            int pb = abs(a - c);
+            int pc = abs(a + b - c - c);
+            if (pc < pa and pc < pb)
+                row[i] += c;
+            else if (pb < pa)
+                row[i] += b;
+            else
+                row[i] += a;
+        }
+        break;
+
+      default:
+        return false;
+    }
+    return true;
+}
+
+
+//
+//  Expand_Row_To_Rgba: C
+//
+// Convert one unfiltered row of 8-bit gray, gray + alpha, RGB or RGBA
+// (`channels` of 1 to 4) into RGBA pixels.
+//
+static void Expand_Row_To_Rgba(
+    REBYTE *out,
+    const REBYTE *in,
+    unsigned channels,
+    unsigned w
+){
+    unsigned x = 0;
+
+    switch (channels) {
+      case 1:
+        for (; x < w; ++x, out += 4) {
+            out[0] = out[1] = out[2] = in[x];
+            out[3] = 0xFF;
+        }
+        break;
+
+      case 2:
+        for (; x < w; ++x, out += 4, in += 2) {
+            out[0] = out[1] = out[2] = in[0];
+            out[3] = in[1];
+        }
+        break;
+
+      case 3:
+      #if defined(PNG_SIMD_X86)
+        if (Has_Png_Ssse3())
+            x = Expand_Rgb_Ssse3(out, in, w);
+        out += 4 * x;
+        in += 3 * x;
+      #endif
+        for (; x < w; ++x, out += 4, in += 3) {
+            out[0] = in[0];
+            out[1] = in[1];
+            out[2] = in[2];
+            out[3] = 0xFF;
+        }
+        break;
+
+      case 4:
+        memcpy(out, in, 4 * w);
+        break;
+
+      default:
+        assert(false);
+    }
+}
+
+
+//
+//  Inflate_Idats: C
+//
+// Inflate until the z_stream's output is full, feeding it the data of the
+// IDAT chunks in order.  `*chunk` is where to look for the next IDAT (the
+// chunks were validated by Decode_Png_Rows() before any are read).  Returns
+// Z_OK when the output is filled, Z_STREAM_END if zlib's data ended first,
+// Z_BUF_ERROR if the IDATs ran out first, or another zlib error code.
+//
+static int Inflate_Idats(z_stream *strm, const REBYTE **chunk)
+{
+    while (strm->avail_out != 0) {
+        int ret = inflate(strm, Z_NO_FLUSH);
+        if (ret == Z_BUF_ERROR and strm->avail_in == 0) {  // needs input
+            while (true) {
+                if (lodepng_chunk_type_equals(*chunk, "IEND"))
+                    return Z_BUF_ERROR;
+
+                const REBYTE *c = *chunk;
+                *chunk = lodepng_chunk_next_const(c);
+                if (lodepng_chunk_type_equals(c, "IDAT")) {
+                    strm->next_in = cast(
+                        const z_Bytef*, lodepng_chunk_data_const(c)
+                    );
+                    strm->avail_in = lodepng_chunk_length(c);
+                    break;
+                }
+            }
+            continue;
+        }
+        if (ret != Z_OK)
+            return ret;
+    }
+    return Z_OK;
+}
+
+
+//
+//  Error_Png_Inflate: C
+//
+// The data ran out (or didn't) at the wrong point, or zlib found an error.
+//
+static REBCTX *Error_Png_Inflate(const z_stream *strm, int ret)
+{
+    if (ret == Z_OK or ret == Z_STREAM_END)
+        return Error_User(lodepng_error_text(91));  // size doesn't match
+    if (ret == Z_BUF_ERROR)
+        return Error_User("PNG image data is truncated");
+    if (strm->msg)
+        return Error_User(strm->msg);
+    return Error_User("PNG image data is corrupt");
+}
+
+
+static void *zalloc_png(void *opaque, unsigned nr, unsigned size)
+{
+    UNUSED(opaque);
+    return rebMalloc(nr * size);
+}
+
+static void zfree_png(void *opaque, void *addr)
+{
+    UNUSED(opaque);
+    rebFree(addr);
+}
+
+
+//
+//  Decode_Png_Rows: C
+//
+// Decode a PNG into a rebMalloc()'d buffer of RGBA pixels a row at a time,
+// or return nullptr if it isn't one of the simple formats this handles (or
+// its chunks look wrong), so that LodePNG should be used instead.
+//
+static REBYTE *Decode_Png_Rows(
+    unsigned *w_out,
+    unsigned *h_out,
+    const REBYTE *in,
+    size_t insize
+){
+    LodePNGState state;
+    lodepng_state_init(&state);
+    unsigned error = lodepng_inspect(w_out, h_out, &state, in, insize);
+    LodePNGColorType colortype = state.info_png.color.colortype;
+    unsigned bitdepth = state.info_png.color.bitdepth;
+    unsigned interlace = state.info_png.interlace_method;
+    lodepng_state_cleanup(&state);
+
+    if (error != 0 or bitdepth != 8 or interlace != 0)
+        return nullptr;
+
+    unsigned channels;
+    switch (colortype) {
+      case LCT_GREY: channels = 1; break;
+      case LCT_GREY_ALPHA: channels = 2; break;
+      case LCT_RGB: channels = 3; break;
+      case LCT_RGBA: channels = 4; break;
+      default:
+        return nullptr;  // palettes
+    }
+
+    unsigned w = *w_out;
+    unsigned h = *h_out;
+    if (w == 0 or h == 0 or cast(uint64_t, w) * h > 268435455)
+        return nullptr;  // let LodePNG give its error for these
+
+    // Check the chunk layout up front, so inflating can just walk it.  Any
+    // problem LodePNG would report (or chunk like tRNS that changes pixels)
+    // leaves the PNG to LodePNG.
+    //
+    const REBYTE *first = in + 33;  // after the signature and IHDR
+    const REBYTE *chunk = first;
+    while (true) {
+        if (cast(size_t, chunk - in) + 12 > insize)
+            return nullptr;
+
+        unsigned len = lodepng_chunk_length(chunk);
+        if (len > 2147483647 or cast(size_t, chunk - in) + len + 12 > insize)
+            return nullptr;
+
+        if (lodepng_chunk_type_equals(chunk, "IEND"))
+            break;
+
+        if (lodepng_chunk_type_equals(chunk, "IDAT")) {
+            if (lodepng_chunk_check_crc(chunk))
+                return nullptr;
+        }
+        else if (
+            not lodepng_chunk_ancillary(chunk)  // PLTE, or unknown critical
+            or lodepng_chunk_type_equals(chunk, "tRNS")
+        ){
+            return nullptr;
+        }
+
+        chunk = lodepng_chunk_next_const(chunk);
+    }
+    if (lodepng_chunk_check_crc(chunk))
+        return nullptr;
+
+    size_t linebytes = cast(size_t, w) * channels;
+    size_t stride = cast(size_t, w) * 4;
+
+    REBYTE *pixels = rebAllocN(REBYTE, stride * h);
+    REBYTE *rows = rebAllocN(REBYTE, 2 * (1 + linebytes));  // filter byte...
+    REBYTE *prev = rows;  // ...then the row, for the previous one...
+    REBYTE *cur = rows + 1 + linebytes;  // ...and the one being decoded
+    memset(prev, 0, 1 + linebytes);  // first row's "up" is all zero
+
+    z_stream strm;
+    strm.zalloc = &zalloc_png;  // fail() frees these, see %u-compress.c
+    strm.zfree = &zfree_png;
+    strm.opaque = nullptr;
+    strm.next_in = nullptr;
+    strm.avail_in = 0;
+
+    int ret = inflateInit(&strm);
+    if (ret != Z_OK)
+        fail (Error_Png_Inflate(&strm, ret));
+
+    chunk = first;
+
+    unsigned y;
+    for (y = 0; y < h; ++y) {
+        strm.next_out = cur;
+        strm.avail_out = 1 + linebytes;
+        ret = Inflate_Idats(&strm, &chunk);
+        if (strm.avail_out != 0)
+            fail (Error_Png_Inflate(&strm, ret));
+
+        if (not Unfilter_Row(cur + 1, prev + 1, channels, cur[0], linebytes))
+            fail (lodepng_error_text(36));  // filter type doesn't exist
+
+        Expand_Row_To_Rgba(pixels + y * stride, cur + 1, channels, w);
+
+        REBYTE *temp = prev;
+        prev = cur;
+        cur = temp;
+    }
+
+    // The zlib data has to end right after the last row (which checks its
+    // Adler-32), with nothing more in it.
+    //
+    REBYTE extra;
+    strm.next_out = &extra;
+    strm.avail_out = 1;
+    ret = Inflate_Idats(&strm, &chunk);
+    if (strm.avail_out == 0 or ret != Z_STREAM_END)
+        fail (Error_Png_Inflate(&strm, ret));
+
+    inflateEnd(&strm);
+    rebFree(rows);
+
+    return pixels;
+}
+
+
 //
 //  identify-png?: native [
 //
@@ -186,18 +669,16 @@ REBNATIVE(identify_png_q)
 
 
 //
-//  decode-png: native [
+//  Decode_Png_Lodepng: C
 //
-//  {Codec for decoding BINARY! data for a PNG}
-//
-//      return: [image!]
-//      data [binary!]
-//  ]
+// Decode any PNG LodePNG can into a rebMalloc()'d buffer of RGBA pixels.
 //
-REBNATIVE(decode_png)
-{
-    PNG_INCLUDE_PARAMS_OF_DECODE_PNG;
-
+static unsigned char *Decode_Png_Lodepng(
+    unsigned *w_out,
+    unsigned *h_out,
+    const unsigned char *in,
+    size_t insize
+){
     LodePNGState state;
     lodepng_state_init(&state);
 
@@ -219,15 +700,13 @@ REBNATIVE(decode_png)
     state.info_png.color.bitdepth = 8;
 
     unsigned char* image_bytes;
-    unsigned w;
-    unsigned h;
     unsigned error = lodepng_decode(
         &image_bytes,
-        &w,
-        &h,
+        w_out,
+        h_out,
         &state,
-        VAL_BIN_AT(ARG(data)), // PNG data
-        VAL_LEN_AT(ARG(data)) // PNG data length
+        in, // PNG data
+        insize // PNG data length
     );
 
     // `state` can contain potentially interesting information, such as
@@ -247,6 +726,40 @@ REBNATIVE(decode_png)
     // https://github.com/lvandeve/lodepng/issues/17
     //
 
+    return image_bytes;
+}
+
+
+//
+//  decode-png: native [
+//
+//  {Codec for decoding BINARY! data for a PNG}
+//
+//      return: [image!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(decode_png)
+{
+    PNG_INCLUDE_PARAMS_OF_DECODE_PNG;
+
+    unsigned w;
+    unsigned h;
+
+    unsigned char* image_bytes = Decode_Png_Rows(
+        &w,
+        &h,
+        VAL_BIN_AT(ARG(data)),
+        VAL_LEN_AT(ARG(data))
+    );
+    if (not image_bytes)  // not a format the row decoder handles
+        image_bytes = Decode_Png_Lodepng(
+            &w,
+            &h,
+            VAL_BIN_AT(ARG(data)),
+            VAL_LEN_AT(ARG(data))
+        );
+
     REBVAL *binary = rebRepossess(image_bytes, (w * h) * 4);
 
     REBVAL *image = rebValue(
@@ -48,6 +48,15 @@
 #include <signal.h>
 #include <sys/stat.h>
 #include <sys/wait.h>
+// posix_spawn() lets libc start the child without copying the parent's page
+// tables (glibc and musl use a CLONE_VM|CLONE_VFORK child, OS X has it as a
+// system call).  fork() gets slower the bigger the interpreter's heap is.
+// Bionic only has posix_spawn() from API 28, so Android keeps using fork().
+//
+#if !defined(TO_ANDROID)
+    #define USE_POSIX_SPAWN
+    #include <spawn.h>
+#endif
 #if !defined(WIFCONTINUED) && defined(TO_ANDROID)
 // old version of bionic doesn't define WIFCONTINUED
 // https://android.googlesource.com/platform/bionic/+/c6043f6b27dc8961890fed12ddb5d99622204d6d%5E%21/#F0
@@ -107,6 +116,111 @@ static inline bool Set_Nonblocking_Fails(int fd) {
 }
 
 
+#ifdef USE_POSIX_SPAWN
+
+//
+//  Spawn_Child: C
+//
+// Everything the fork() child branch of Call_Core() does before exec() is
+// redirecting stdin/stdout/stderr, which posix_spawn() can express as file
+// actions.  The pipe ends are all FD_CLOEXEC (see Open_Pipe_Fails()), so
+// only the dup2()'d copies survive into the child.
+//
+// Returns 0 and sets *pid on success, else an errno.  Unlike the fork() path
+// a failed exec() is reported here directly, not through the info pipe.
+//
+static int Spawn_Child(
+    pid_t *pid,
+    REBFRM *frame_,
+    int stdin_read,  // read end of the stdin pipe, or -1
+    int stdout_write,  // write end of the stdout pipe, or -1
+    int stderr_write,  // write end of the stderr pipe, or -1
+    int argc,
+    const char **argv
+){
+    PROCESS_INCLUDE_PARAMS_OF_CALL_INTERNAL_P;
+
+    posix_spawn_file_actions_t actions;
+    int err = posix_spawn_file_actions_init(&actions);
+    if (err != 0)
+        return err;
+
+    // The file actions keep pointers to the paths until posix_spawn() runs,
+    // so the spelled FILE!s are freed only afterward.
+    //
+    char *paths[3] = {nullptr, nullptr, nullptr};
+
+    const REBVAL *args[3] = {ARG(input), ARG(output), ARG(error)};
+    int pipes[3] = {stdin_read, stdout_write, stderr_write};
+    int fd;
+    for (fd = 0; fd < 3 and err == 0; ++fd) {
+        const REBVAL *arg = args[fd];
+        int oflags = (fd == STDIN_FILENO) ? O_RDONLY : O_CREAT | O_WRONLY;
+
+        if (IS_NULLED(arg) or (IS_LOGIC(arg) and VAL_LOGIC(arg)))
+            continue;  // inherit from parent, the default
+
+        if (pipes[fd] != -1)
+            err = posix_spawn_file_actions_adddup2(
+                &actions, pipes[fd], fd
+            );
+        else if (IS_FILE(arg)) {
+            paths[fd] = rebSpell("file-to-local", arg, rebEND);
+            err = posix_spawn_file_actions_addopen(
+                &actions, fd, paths[fd], oflags, 0666
+            );
+        }
+        else {
+            assert(IS_LOGIC(arg));  // false is /dev/null
+            err = posix_spawn_file_actions_addopen(
+                &actions, fd, "/dev/null", oflags, 0666
+            );
+        }
+    }
+
+    const char **argv_new = nullptr;
+    const char *file = argv[0];
+
+    if (err == 0 and REF(shell)) {
+        const char *sh = getenv("SHELL");
+        if (sh == nullptr)
+            err = 2;  // same as the fork() path reports, ENOENT
+        else {
+            argv_new = rebAllocN(const char*, argc + 3);
+            argv_new[0] = sh;
+            argv_new[1] = "-c";
+            memcpy(&argv_new[2], argv, argc * sizeof(argv[0]));
+            argv_new[argc + 2] = nullptr;
+            argv = argv_new;
+            file = sh;
+        }
+    }
+
+    if (err == 0) {
+        //
+        // See the child branch in Call_Core() about tunneling under const.
+        //
+        char * const *argv_hack;
+        memcpy(&argv_hack, &argv, sizeof(argv_hack));
+
+        err = posix_spawnp(pid, file, &actions, nullptr, argv_hack, environ);
+    }
+
+    if (argv_new != nullptr)
+        rebFree(m_cast(char**, argv_new));
+
+    for (fd = 0; fd < 3; ++fd) {
+        if (paths[fd] != nullptr)
+            rebFree(paths[fd]);
+    }
+
+    posix_spawn_file_actions_destroy(&actions);
+    return err;
+}
+
+#endif
+
+
 //
 //  Call_Core: C
 //
@@ -177,8 +291,8 @@ REB_R Call_Core(REBFRM *frame_) {
 
     bool flag_wait = REF(wait) or (
         IS_TEXT(ARG(input)) or IS_BINARY(ARG(input))
-        or IS_TEXT(ARG(output)) or IS_BINARY(ARG(output))
-        or IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))
+        or Is_Piped_Sink(ARG(output))
+        or Is_Piped_Sink(ARG(error))
     );  // I/O redirection implies /WAIT
 
     // We synthesize the argc and argv from the "command", and in the process
@@ -260,6 +374,8 @@ REB_R Call_Core(REBFRM *frame_) {
     char *errbuf = nullptr;
     size_t errbuf_used = 0;
 
+    REBVAL *sink_error = nullptr;  // raised after cleanup if an ACTION! fails
+
     int status = 0;
     int ret = 0;
     int non_errno_ret = 0; // "ret" above should be valid errno
@@ -287,12 +403,12 @@ REB_R Call_Core(REBFRM *frame_) {
             goto stdin_pipe_err;
     }
 
-    if (IS_TEXT(ARG(output)) or IS_BINARY(ARG(output))) {
+    if (Is_Piped_Sink(ARG(output))) {
         if (Open_Pipe_Fails(stdout_pipe))
             goto stdout_pipe_err;
     }
 
-    if (IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))) {
+    if (Is_Piped_Sink(ARG(error))) {
         if (Open_Pipe_Fails(stderr_pipe))
             goto stdout_pipe_err;
     }
@@ -300,12 +416,28 @@ REB_R Call_Core(REBFRM *frame_) {
     if (Open_Pipe_Fails(info_pipe))
         goto info_pipe_err;
 
+  #ifdef USE_POSIX_SPAWN
+    ret = Spawn_Child(
+        &forked_pid,
+        frame_,
+        stdin_pipe[R],
+        stdout_pipe[W],
+        stderr_pipe[W],
+        argc,
+        argv
+    );
+    if (ret != 0)
+        goto error;
+
+    assert(forked_pid > 0);  // so the fork() child branch below is skipped
+  #else
     forked_pid = fork();  // can't declare here (gotos cross initialization)
 
     if (forked_pid < 0) {  // error
         ret = errno;
         goto error;
     }
+  #endif
 
     if (forked_pid == 0) {
 
@@ -357,7 +489,7 @@ REB_R Call_Core(REBFRM *frame_) {
           inherit_stdout_from_parent:
             NOOP;  // it's the default
         }
-        else if (IS_TEXT(ARG(output)) or IS_BINARY(ARG(output))) {
+        else if (Is_Piped_Sink(ARG(output))) {
             close(stdout_pipe[R]);
             if (dup2(stdout_pipe[W], STDOUT_FILENO) < 0)
                 goto child_error;
@@ -392,7 +524,7 @@ REB_R Call_Core(REBFRM *frame_) {
           inherit_stderr_from_parent:
             NOOP;  // it's the default
         }
-        else if (IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))) {
+        else if (Is_Piped_Sink(ARG(error))) {
             close(stderr_pipe[R]);
             if (dup2(stderr_pipe[W], STDERR_FILENO) < 0)
                 goto child_error;
@@ -688,21 +820,25 @@ REB_R Call_Core(REBFRM *frame_) {
                     char **buffer;
                     size_t *used;
                     size_t *capacity;
+                    const REBVAL *sink;  // ACTION! chunks are handed off
                     if (pfds[i].fd == stdout_pipe[R]) {
                         buffer = &outbuf;
                         used = &outbuf_used;
                         capacity = &outbuf_capacity;
+                        sink = ARG(output);
                     }
                     else if (pfds[i].fd == stderr_pipe[R]) {
                         buffer = &errbuf;
                         used = &errbuf_used;
                         capacity = &errbuf_capacity;
+                        sink = ARG(error);
                     }
                     else {
                         assert(pfds[i].fd == info_pipe[R]);
                         buffer = &infobuf;
                         used = &infobuf_used;
                         capacity = &infobuf_capacity;
+                        sink = nullptr;
                     }
 
                     ssize_t to_read = 0;
@@ -747,17 +883,19 @@ REB_R Call_Core(REBFRM *frame_) {
                         *used += nbytes;
                         assert(*used <= *capacity);
 
-                        if (*used == *capacity) {
-                            char *larger = rebAllocN(
-                                char,
-                                *capacity + BUF_SIZE_CHUNK
+                        if (sink and IS_ACTION(sink)) {
+                            sink_error = Flush_To_Sink_Trapped(
+                                sink, *buffer, *used
                             );
-                            if (larger == nullptr)
+                            *used = 0;
+                            if (sink_error)
                                 goto kill;
-                            memcpy(larger, *buffer, *capacity);
-                            rebFree(*buffer);
-                            *buffer = larger;
-                            *capacity += BUF_SIZE_CHUNK;
+                        }
+                        else if (*used == *capacity) {
+                            *capacity *= 2;  // geometric, see BUF_SIZE_CHUNK
+                            *buffer = cast(char*,
+                                rebRealloc(*buffer, *capacity)
+                            );
                         }
                         assert(*used < *capacity);
                     } while (nbytes == to_read);
@@ -792,7 +930,7 @@ REB_R Call_Core(REBFRM *frame_) {
 
   error:
 
-    if (ret == 0)
+    if (ret == 0 and sink_error == nullptr)
         non_errno_ret = -1024;  // !!! randomly picked
 
   cleanup:
@@ -892,7 +1030,14 @@ REB_R Call_Core(REBFRM *frame_) {
 
     rebFree(m_cast(char**, argv));
 
-    if (IS_TEXT(ARG(output))) {
+    if (IS_ACTION(ARG(output))) {  // hand off any bytes read after exit
+        if (sink_error == nullptr)
+            sink_error = Flush_To_Sink_Trapped(
+                ARG(output), outbuf, outbuf_used
+            );
+        rebFree(outbuf);
+    }
+    else if (IS_TEXT(ARG(output))) {
         REBVAL *output_val = rebRepossess(outbuf, outbuf_used);
         rebElide("insert", ARG(output), output_val, rebEND);
         rebRelease(output_val);
@@ -905,7 +1050,14 @@ REB_R Call_Core(REBFRM *frame_) {
     else
         assert(outbuf == nullptr);
 
-    if (IS_TEXT(ARG(error))) {
+    if (IS_ACTION(ARG(error))) {
+        if (sink_error == nullptr)
+            sink_error = Flush_To_Sink_Trapped(
+                ARG(error), errbuf, errbuf_used
+            );
+        rebFree(errbuf);
+    }
+    else if (IS_TEXT(ARG(error))) {
         REBVAL *error_val = rebRepossess(errbuf, errbuf_used);
         rebElide("insert", ARG(error), error_val, rebEND);
         rebRelease(error_val);
@@ -921,6 +1073,9 @@ REB_R Call_Core(REBFRM *frame_) {
     if (inbuf != nullptr)
         rebFree(inbuf);
 
+    if (sink_error != nullptr)
+        rebJumps("fail", rebR(sink_error), rebEND);
+
     if (ret != 0)
         rebFail_OS (ret);
 
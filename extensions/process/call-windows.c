@@ -122,6 +122,7 @@ static bool Try_Init_Startupinfo_Sink(
 
       case REB_TEXT:  // write to pre-existing TEXT!
       case REB_BINARY:  // write to pre-existing BINARY!
+      case REB_ACTION:  // hand each chunk to an ACTION! as it arrives
         if (not CreatePipe(hread, hwrite, NULL, 0))
             return false;
 
@@ -208,8 +209,8 @@ REB_R Call_Core(REBFRM *frame_) {
         REF(wait)
         or (
             IS_TEXT(ARG(input)) or IS_BINARY(ARG(input))
-            or IS_TEXT(ARG(output)) or IS_BINARY(ARG(output))
-            or IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))
+            or Is_Piped_Sink(ARG(output))
+            or Is_Piped_Sink(ARG(error))
         )  // I/O redirection implies /WAIT
     ){
         flag_wait = true;
@@ -302,6 +303,8 @@ REB_R Call_Core(REBFRM *frame_) {
     char *errbuf = nullptr;
     size_t errbuf_used = 0;
 
+    REBVAL *sink_error = nullptr;  // raised after cleanup if an ACTION! fails
+
     //=//// INPUT SOURCE SETUP ////////////////////////////////////////////=//
 
     if (not REF(input)) {  // get stdin normally (usually from user console)
@@ -560,13 +563,19 @@ REB_R Call_Core(REBFRM *frame_) {
                     }
                     else {
                         outbuf_used += n;
-                        if (outbuf_used >= outbuf_capacity) {
-                            outbuf_capacity += BUF_SIZE_CHUNK;
+                        if (IS_ACTION(ARG(output))) {
+                            sink_error = Flush_To_Sink_Trapped(
+                                ARG(output), outbuf, outbuf_used
+                            );
+                            outbuf_used = 0;
+                            if (sink_error)
+                                goto kill;
+                        }
+                        else if (outbuf_used >= outbuf_capacity) {
+                            outbuf_capacity *= 2;  // see BUF_SIZE_CHUNK
                             outbuf = cast(char*,
                                 rebRealloc(outbuf, outbuf_capacity)
                             );
-                            if (outbuf == NULL)  // !!! never with rebRealloc
-                                goto kill;
                         }
                     }
                 }
@@ -589,13 +598,19 @@ REB_R Call_Core(REBFRM *frame_) {
                     }
                     else {
                         errbuf_used += n;
-                        if (errbuf_used >= errbuf_capacity) {
-                            errbuf_capacity += BUF_SIZE_CHUNK;
+                        if (IS_ACTION(ARG(error))) {
+                            sink_error = Flush_To_Sink_Trapped(
+                                ARG(error), errbuf, errbuf_used
+                            );
+                            errbuf_used = 0;
+                            if (sink_error)
+                                goto kill;
+                        }
+                        else if (errbuf_used >= errbuf_capacity) {
+                            errbuf_capacity *= 2;  // see BUF_SIZE_CHUNK
                             errbuf = cast(char*,
                                 rebRealloc(errbuf, errbuf_capacity)
                             );
-                            if (errbuf == NULL)  // !!! never with rebRealloc
-                                goto kill;
                         }
                     }
                 }
@@ -699,7 +714,10 @@ REB_R Call_Core(REBFRM *frame_) {
     // remarks at the top of file about how piped data is not generally
     // assumed to be UCS-2.
     //
-    if (IS_TEXT(ARG(output))) {
+    if (IS_ACTION(ARG(output))) {  // chunks already handed off as they came
+        rebFree(outbuf);
+    }
+    else if (IS_TEXT(ARG(output))) {
         REBVAL *output_val = rebRepossess(outbuf, outbuf_used);
         rebElide("insert", ARG(output), "deline", output_val, rebEND);
         rebRelease(output_val);
@@ -712,7 +730,10 @@ REB_R Call_Core(REBFRM *frame_) {
     else
         assert(outbuf == nullptr);
 
-    if (IS_TEXT(ARG(error))) {
+    if (IS_ACTION(ARG(error))) {
+        rebFree(errbuf);
+    }
+    else if (IS_TEXT(ARG(error))) {
         REBVAL *error_val = rebRepossess(errbuf, errbuf_used);
         rebElide("insert", ARG(error), "deline", error_val, rebEND);
         rebRelease(error_val);
@@ -728,6 +749,9 @@ REB_R Call_Core(REBFRM *frame_) {
     if (inbuf != nullptr)
         rebFree(inbuf);
 
+    if (sink_error != nullptr)
+        rebJumps("fail", rebR(sink_error), rebEND);
+
     if (ret != 0)
         rebFail_OS (ret);
 
@@ -22,4 +22,7 @@ includes: copy [
     %prep/extensions/process ;for %tmp-extensions-process-init.inc
 ]
 
-requires: 'Filesystem  ; for FILE-TO-LOCAL in CALL
+requires: [
+    Filesystem  ; for FILE-TO-LOCAL in CALL
+    Stdio  ; for FLUSH-STDOUT before a child writes to inherited stdout
+]
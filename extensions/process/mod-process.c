@@ -87,9 +87,9 @@
 //      /input "Redirects stdin (false=/dev/null, true=inherit)"
 //          [text! binary! file! logic!]
 //      /output "Redirects stdout (false=/dev/null, true=inherit)"
-//          [text! binary! file! logic!]
+//          [text! binary! file! logic! action!]
 //      /error "Redirects stderr (false=/dev/null, true=inherit)"
-//          [text! binary! file! logic!]
+//          [text! binary! file! logic! action!]
 //  ]
 //
 REBNATIVE(call_internal_p)
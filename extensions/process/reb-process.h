@@ -53,9 +53,34 @@ inline static void Fail_No_Process(const REBVAL *arg) {
 // in a buffer and returned, then appended.  This wastes space when compared
 // to just appending to the string or binary itself.  With CALL rethought
 // as an extension with access to the internal API, this could be changed...
-// though for the moment, a malloc()'d buffer is expanded independently by
-// BUF_SIZE_CHUNK and returned to CALL.
+// though for the moment, a malloc()'d buffer starts at BUF_SIZE_CHUNK and is
+// doubled as it fills (so total copying stays linear in the output size).
 //
 #define BUF_SIZE_CHUNK 4096
 
+
+// An ACTION! given as /OUTPUT or /ERROR is called with each chunk of bytes
+// as it arrives, and the buffer is then reused...so a child that writes
+// gigabytes can be consumed in bounded memory.
+//
+inline static bool Is_Piped_Sink(const REBVAL *v) {
+    return IS_TEXT(v) or IS_BINARY(v) or IS_ACTION(v);
+}
+
+// The sink is run under TRAP so a failure in it doesn't longjmp past the
+// open pipes and the running child.  The error is handed back for the caller
+// to raise once it has cleaned up, or nullptr if the sink returned normally.
+//
+inline static REBVAL *Flush_To_Sink_Trapped(
+    const REBVAL *sink,
+    const char *buf,
+    size_t size
+){
+    assert(IS_ACTION(sink));
+    if (size == 0)
+        return nullptr;
+    REBVAL *chunk = rebSizedBinary(buf, size);
+    return rebValue("trap [", sink, rebR(chunk), "]", rebEND);
+}
+
 REB_R Call_Core(REBFRM *frame_);
@@ -0,0 +1,785 @@
+//
+//  File: %mod-rebin.c
+//  Summary: "Compact binary serialization of values (REBIN codec)"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2019 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See %extensions/rebin/README.md
+//
+// A SAVE and LOAD round trip molds every value to UTF-8 text and then runs
+// the full scanner on it, which re-interns each word occurrence and has to
+// rediscover the structure byte by byte.  REBIN writes cell kinds, spellings
+// and series payloads directly, so decoding is a linear walk that makes each
+// series at its final size and interns each distinct spelling only once.
+//
+// The stream is the magic bytes "REBIN" and a version byte, followed by one
+// encoded value.  (Version 2 added file and line information for arrays.  A
+// version 1 stream is still decoded, it just never has any.)  Each value starts with a byte whose low 6 bits are a tag
+// from the list below (deliberately independent of the REB_XXX enum, which
+// changes between builds), with the high bits for NEWLINE_BEFORE and for a
+// following quote level.  Integers are LEB128 varints, zig-zagged if signed.
+//
+// Spellings and series are written the first time they are seen and given
+// the next id in their table, later references are written as `id + 1` and
+// a 0 means "a definition follows".  Since an array gets its id before its
+// contents are written, shared and cyclic structures survive the trip.
+//
+// Types with no direct encoding here (dates, paths, maps, objects...) are
+// written as their MOLD/ALL text and scanned back individually, so they
+// round trip as well as SAVE/ALL and LOAD would do it.  Words come back
+// unbound, as with TRANSCODE.
+//
+
+#include "sys-core.h"
+
+#include "tmp-mod-rebin.h"
+
+
+#define REBIN_VERSION 2
+
+static const REBYTE Rebin_Magic[] = {'R', 'E', 'B', 'I', 'N', REBIN_VERSION};
+
+#define REBIN_MAGIC_SIZE \
+    sizeof(Rebin_Magic)
+
+inline static bool Is_Rebin_Magic(const REBYTE *bp) {
+    return memcmp(bp, Rebin_Magic, REBIN_MAGIC_SIZE - 1) == 0
+        and bp[REBIN_MAGIC_SIZE - 1] >= 1
+        and bp[REBIN_MAGIC_SIZE - 1] <= REBIN_VERSION;
+}
+
+enum Reb_Rebin_Tag {
+    REBIN_TAG_BLANK = 0,
+    REBIN_TAG_FALSE = 1,
+    REBIN_TAG_TRUE = 2,
+    REBIN_TAG_INTEGER = 3,
+    REBIN_TAG_DECIMAL = 4,
+    REBIN_TAG_PERCENT = 5,
+    REBIN_TAG_CHAR = 6,
+    REBIN_TAG_VOID = 7,
+    REBIN_TAG_NULLED = 8,  // only legal under a quote level
+
+    REBIN_TAG_WORD = 10,
+    REBIN_TAG_SET_WORD = 11,
+    REBIN_TAG_GET_WORD = 12,
+    REBIN_TAG_SYM_WORD = 13,
+
+    REBIN_TAG_BINARY = 20,
+    REBIN_TAG_TEXT = 21,
+    REBIN_TAG_FILE = 22,
+    REBIN_TAG_EMAIL = 23,
+    REBIN_TAG_URL = 24,
+    REBIN_TAG_TAG = 25,
+    REBIN_TAG_ISSUE = 26,
+
+    REBIN_TAG_BLOCK = 30,
+    REBIN_TAG_GROUP = 31,
+    REBIN_TAG_SET_BLOCK = 32,
+    REBIN_TAG_SET_GROUP = 33,
+    REBIN_TAG_GET_BLOCK = 34,
+    REBIN_TAG_GET_GROUP = 35,
+    REBIN_TAG_SYM_BLOCK = 36,
+    REBIN_TAG_SYM_GROUP = 37,
+
+    REBIN_TAG_MOLDED = 63
+};
+
+#define REBIN_TAG_MASK 0x3F
+#define REBIN_FLAG_NEWLINE_BEFORE 0x40
+#define REBIN_FLAG_QUOTED 0x80
+
+#define REBIN_ARRAY_NEWLINE_AT_TAIL 0x01
+#define REBIN_ARRAY_FILE_LINE 0x02  // file spelling and line number follow
+
+#define REBIN_DEFINE_ANONYMOUS 0  // series definition that gets no id
+#define REBIN_DEFINE_WITH_ID 1
+
+
+// Word, string and array kinds are mapped to and from tags by table, so
+// the encoder and decoder can't disagree about which kind is which.
+//
+static const struct {
+    enum Reb_Kind kind;
+    enum Reb_Rebin_Tag tag;
+} Rebin_Kind_Tags[] = {
+    {REB_WORD, REBIN_TAG_WORD},
+    {REB_SET_WORD, REBIN_TAG_SET_WORD},
+    {REB_GET_WORD, REBIN_TAG_GET_WORD},
+    {REB_SYM_WORD, REBIN_TAG_SYM_WORD},
+    {REB_BINARY, REBIN_TAG_BINARY},
+    {REB_TEXT, REBIN_TAG_TEXT},
+    {REB_FILE, REBIN_TAG_FILE},
+    {REB_EMAIL, REBIN_TAG_EMAIL},
+    {REB_URL, REBIN_TAG_URL},
+    {REB_TAG, REBIN_TAG_TAG},
+    {REB_ISSUE, REBIN_TAG_ISSUE},
+    {REB_BLOCK, REBIN_TAG_BLOCK},
+    {REB_GROUP, REBIN_TAG_GROUP},
+    {REB_SET_BLOCK, REBIN_TAG_SET_BLOCK},
+    {REB_SET_GROUP, REBIN_TAG_SET_GROUP},
+    {REB_GET_BLOCK, REBIN_TAG_GET_BLOCK},
+    {REB_GET_GROUP, REBIN_TAG_GET_GROUP},
+    {REB_SYM_BLOCK, REBIN_TAG_SYM_BLOCK},
+    {REB_SYM_GROUP, REBIN_TAG_SYM_GROUP},
+    {REB_0_END, REBIN_TAG_BLANK}  // terminates the list
+};
+
+static enum Reb_Rebin_Tag Tag_For_Kind(enum Reb_Kind kind) {
+    REBLEN i;
+    for (i = 0; Rebin_Kind_Tags[i].kind != REB_0_END; ++i)
+        if (Rebin_Kind_Tags[i].kind == kind)
+            return Rebin_Kind_Tags[i].tag;
+    return REBIN_TAG_MOLDED;
+}
+
+static enum Reb_Kind Kind_For_Tag(REBYTE tag) {
+    REBLEN i;
+    for (i = 0; Rebin_Kind_Tags[i].kind != REB_0_END; ++i)
+        if (cast(REBYTE, Rebin_Kind_Tags[i].tag) == tag)
+            return Rebin_Kind_Tags[i].kind;
+    fail (Error_Bad_Media_Raw());
+}
+
+
+//=//// ENCODING //////////////////////////////////////////////////////////=//
+
+// The encoder has to map spelling and series nodes it has already written
+// to their ids.  This is a small open-addressed table keyed by the node
+// pointer (the two id spaces can share it, as a node is only ever one kind).
+//
+struct Rebin_Seen {
+    const void *node;
+    REBLEN id;
+};
+
+struct Rebin_Encoder {
+    REBSER *out;  // BINARY! series being built
+    REBSER *seen;  // unmanaged series of Rebin_Seen, power of 2 capacity
+    REBLEN seen_count;
+    REBLEN num_spellings;
+    REBLEN num_series;
+};
+
+static REBSER *Make_Seen_Table(REBLEN capacity) {
+    REBSER *seen = Make_Series(capacity, sizeof(struct Rebin_Seen));
+    memset(SER_DATA_RAW(seen), 0, capacity * sizeof(struct Rebin_Seen));
+    SET_SERIES_LEN(seen, capacity);
+    return seen;
+}
+
+inline static REBLEN Seen_Slot(REBSER *seen, const void *node) {
+    REBLEN mask = SER_LEN(seen) - 1;
+    REBLEN slot = cast(REBLEN,
+        (cast(uintptr_t, node) >> 4) * 2654435761u
+    ) & mask;
+
+    struct Rebin_Seen *entries = SER_HEAD(struct Rebin_Seen, seen);
+    while (entries[slot].node != nullptr and entries[slot].node != node)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+// Returns 0 if the node had not been seen, after assigning it `new_id`.
+// Otherwise returns its existing id plus 1, in the form needed on the wire.
+//
+static REBLEN Seen_Or_Add(
+    struct Rebin_Encoder *enc,
+    const void *node,
+    REBLEN new_id
+){
+    REBLEN slot = Seen_Slot(enc->seen, node);
+    struct Rebin_Seen *entry = SER_AT(struct Rebin_Seen, enc->seen, slot);
+    if (entry->node != nullptr)
+        return entry->id + 1;
+
+    entry->node = node;
+    entry->id = new_id;
+    ++enc->seen_count;
+
+    if (enc->seen_count * 2 > SER_LEN(enc->seen)) {  // keep it half empty
+        REBSER *old = enc->seen;
+        enc->seen = Make_Seen_Table(SER_LEN(old) * 2);
+
+        struct Rebin_Seen *entries = SER_HEAD(struct Rebin_Seen, old);
+        REBLEN n;
+        for (n = 0; n < SER_LEN(old); ++n) {
+            if (entries[n].node == nullptr)
+                continue;
+            *SER_AT(
+                struct Rebin_Seen,
+                enc->seen,
+                Seen_Slot(enc->seen, entries[n].node)
+            ) = entries[n];
+        }
+        Free_Unmanaged_Series(old);
+    }
+    return 0;
+}
+
+static void Rebin_Put_Bytes(
+    struct Rebin_Encoder *enc,
+    const REBYTE *bytes,
+    REBLEN size
+){
+    REBLEN used = SER_USED(enc->out);
+    EXPAND_SERIES_TAIL(enc->out, size);
+    memcpy(BIN_AT(enc->out, used), bytes, size);
+}
+
+inline static void Rebin_Put_Byte(struct Rebin_Encoder *enc, REBYTE b)
+  { Rebin_Put_Bytes(enc, &b, 1); }
+
+static void Rebin_Put_Varint(struct Rebin_Encoder *enc, REBU64 u) {
+    REBYTE buf[10];
+    REBLEN n = 0;
+    while (u >= 0x80) {
+        buf[n++] = cast(REBYTE, u | 0x80);
+        u >>= 7;
+    }
+    buf[n++] = cast(REBYTE, u);
+    Rebin_Put_Bytes(enc, buf, n);
+}
+
+static void Rebin_Put_Utf8(
+    struct Rebin_Encoder *enc,
+    const char *utf8,
+    REBSIZ size
+){
+    Rebin_Put_Varint(enc, size);
+    Rebin_Put_Bytes(enc, cb_cast(utf8), size);
+}
+
+static void Rebin_Put_Spelling(struct Rebin_Encoder *enc, REBSTR *spelling)
+{
+    REBLEN ref = Seen_Or_Add(enc, spelling, enc->num_spellings);
+    Rebin_Put_Varint(enc, ref);
+    if (ref == 0) {
+        ++enc->num_spellings;
+        Rebin_Put_Utf8(enc, STR_UTF8(spelling), STR_SIZE(spelling));
+    }
+}
+
+static void Rebin_Encode_Value(struct Rebin_Encoder *enc, const RELVAL *v);
+
+static void Rebin_Encode_Array(struct Rebin_Encoder *enc, REBARR *a) {
+    Rebin_Put_Varint(enc, ARR_LEN(a));
+
+    // Scanned arrays know where they came from, which error messages use.
+    // The file is a spelling, so is only written out once per stream.
+    //
+    bool file_line = GET_ARRAY_FLAG(a, HAS_FILE_LINE_UNMASKED)
+        and LINK_FILE_NODE(a) != nullptr;
+
+    REBYTE aflags = 0;
+    if (GET_ARRAY_FLAG(a, NEWLINE_AT_TAIL))
+        aflags |= REBIN_ARRAY_NEWLINE_AT_TAIL;
+    if (file_line)
+        aflags |= REBIN_ARRAY_FILE_LINE;
+    Rebin_Put_Byte(enc, aflags);
+
+    if (file_line) {
+        Rebin_Put_Spelling(enc, LINK_FILE(a));
+        Rebin_Put_Varint(enc, MISC(a).line);
+    }
+
+    // Appending to the output can't disturb the array, so it's safe to walk
+    // it directly even if it contains (or is contained by) itself.
+    //
+    RELVAL *item;
+    for (item = ARR_HEAD(a); NOT_END(item); ++item)
+        Rebin_Encode_Value(enc, item);
+}
+
+static void Rebin_Encode_Value(struct Rebin_Encoder *enc, const RELVAL *v)
+{
+    REBYTE flags = 0;
+    if (GET_CELL_FLAG(v, NEWLINE_BEFORE))
+        flags |= REBIN_FLAG_NEWLINE_BEFORE;
+
+    REBLEN quotes = VAL_NUM_QUOTES(v);
+    const REBCEL *cell = VAL_UNESCAPED(v);
+    enum Reb_Kind kind = CELL_KIND(cell);
+
+    enum Reb_Rebin_Tag tag;
+    switch (kind) {
+      case REB_BLANK: tag = REBIN_TAG_BLANK; break;
+      case REB_LOGIC:
+        tag = VAL_LOGIC(cell) ? REBIN_TAG_TRUE : REBIN_TAG_FALSE;
+        break;
+      case REB_INTEGER: tag = REBIN_TAG_INTEGER; break;
+      case REB_DECIMAL: tag = REBIN_TAG_DECIMAL; break;
+      case REB_PERCENT: tag = REBIN_TAG_PERCENT; break;
+      case REB_CHAR: tag = REBIN_TAG_CHAR; break;
+      case REB_VOID: tag = REBIN_TAG_VOID; break;
+      case REB_NULLED: tag = REBIN_TAG_NULLED; break;
+
+      case REB_ACTION:
+      case REB_FRAME:
+      case REB_HANDLE:
+      case REB_PORT:
+      case REB_VARARGS:
+        fail (Error_Invalid_Type(kind));  // no meaningful serialization
+
+      default:
+        tag = Tag_For_Kind(kind);
+        break;
+    }
+
+    if (tag == REBIN_TAG_MOLDED) {
+        //
+        // MOLD/ALL writes the quote marks too, so the scan will restore them.
+        //
+        Rebin_Put_Byte(enc, REBIN_TAG_MOLDED | flags);
+
+        DECLARE_MOLD (mo);
+        SET_MOLD_FLAG(mo, MOLD_FLAG_ALL);
+        Push_Mold(mo);
+        Mold_Value(mo, v);
+        Rebin_Put_Utf8(
+            enc,
+            cs_cast(BIN_AT(SER(mo->series), mo->offset)),
+            STR_SIZE(mo->series) - mo->offset
+        );
+        Drop_Mold(mo);
+        return;
+    }
+
+    if (quotes != 0)
+        flags |= REBIN_FLAG_QUOTED;
+    Rebin_Put_Byte(enc, tag | flags);
+    if (quotes != 0)
+        Rebin_Put_Varint(enc, quotes);
+
+    switch (tag) {
+      case REBIN_TAG_INTEGER: {
+        REBI64 i = VAL_INT64(cell);
+        Rebin_Put_Varint(
+            enc,
+            (cast(REBU64, i) << 1) ^ cast(REBU64, i >> 63)  // zig-zag
+        );
+        break; }
+
+      case REBIN_TAG_DECIMAL:
+      case REBIN_TAG_PERCENT: {
+        REBDEC d = VAL_DECIMAL(cell);
+        REBU64 bits;
+        memcpy(&bits, &d, sizeof(bits));
+
+        REBYTE buf[8];
+        REBLEN n;
+        for (n = 0; n < 8; ++n, bits >>= 8)
+            buf[n] = cast(REBYTE, bits & 0xFF);  // little endian
+        Rebin_Put_Bytes(enc, buf, 8);
+        break; }
+
+      case REBIN_TAG_CHAR:
+        Rebin_Put_Varint(enc, VAL_CHAR(cell));
+        break;
+
+      default:
+        if (ANY_WORD_KIND(kind))
+            Rebin_Put_Spelling(enc, VAL_WORD_SPELLING(cell));
+        else if (ANY_SERIES_KIND(kind)) {
+            REBSER *s = VAL_SERIES(cell);
+
+            // Aliased views (e.g. AS TEXT! of a word or AS BINARY! of a
+            // string) aren't given ids, the decoder makes separate copies.
+            //
+            bool aliased;
+            if (kind == REB_BINARY)
+                aliased = IS_SER_STRING(s);
+            else if (ANY_STRING_KIND(kind))
+                aliased = IS_STR_SYMBOL(STR(s));
+            else
+                aliased = false;
+
+            REBLEN ref = aliased
+                ? 0
+                : Seen_Or_Add(enc, s, enc->num_series);
+            Rebin_Put_Varint(enc, ref);
+            if (ref == 0) {
+                if (aliased)
+                    Rebin_Put_Byte(enc, REBIN_DEFINE_ANONYMOUS);
+                else {
+                    Rebin_Put_Byte(enc, REBIN_DEFINE_WITH_ID);
+                    ++enc->num_series;
+                }
+
+                if (ANY_ARRAY_KIND(kind))
+                    Rebin_Encode_Array(enc, ARR(s));
+                else {
+                    Rebin_Put_Varint(enc, SER_USED(s));
+                    Rebin_Put_Bytes(enc, BIN_HEAD(s), SER_USED(s));
+                }
+            }
+            Rebin_Put_Varint(enc, VAL_INDEX(cell));
+        }
+        break;
+    }
+}
+
+
+//=//// DECODING //////////////////////////////////////////////////////////=//
+
+struct Rebin_Decoder {
+    const REBYTE *bp;
+    const REBYTE *ep;
+    REBARR *spellings;  // WORD! for each spelling id, in order of definition
+    REBARR *series;  // BLOCK!, TEXT! or BINARY! for each series id
+};
+
+static REBYTE Rebin_Get_Byte(struct Rebin_Decoder *dec) {
+    if (dec->bp == dec->ep)
+        fail (Error_Bad_Media_Raw());
+    return *dec->bp++;
+}
+
+static REBU64 Rebin_Get_Varint(struct Rebin_Decoder *dec) {
+    REBU64 u = 0;
+    REBLEN shift = 0;
+    while (true) {
+        REBYTE b = Rebin_Get_Byte(dec);
+        if (shift > 63)
+            fail (Error_Bad_Media_Raw());
+        u |= cast(REBU64, b & 0x7F) << shift;
+        if (not (b & 0x80))
+            return u;
+        shift += 7;
+    }
+}
+
+// Sizes and lengths are checked against the remaining input before they are
+// used to allocate anything, so a corrupt count can't ask for huge series.
+//
+static REBLEN Rebin_Get_Count(struct Rebin_Decoder *dec) {
+    REBU64 u = Rebin_Get_Varint(dec);
+    if (u > cast(REBU64, dec->ep - dec->bp))
+        fail (Error_Bad_Media_Raw());
+    return cast(REBLEN, u);
+}
+
+static const REBYTE *Rebin_Get_Bytes(struct Rebin_Decoder *dec, REBLEN size) {
+    if (size > cast(REBLEN, dec->ep - dec->bp))
+        fail (Error_Bad_Media_Raw());
+    const REBYTE *bytes = dec->bp;
+    dec->bp += size;
+    return bytes;
+}
+
+static REBSTR *Rebin_Get_Spelling(struct Rebin_Decoder *dec) {
+    REBU64 ref = Rebin_Get_Varint(dec);
+    if (ref == 0) {
+        REBLEN size = Rebin_Get_Count(dec);
+        if (size == 0)
+            fail (Error_Bad_Media_Raw());
+        REBSTR *spelling = Intern_UTF8_Managed(
+            Rebin_Get_Bytes(dec, size),
+            size
+        );
+        Init_Word(Alloc_Tail_Array(dec->spellings), spelling);
+        return spelling;
+    }
+
+    if (ref > ARR_LEN(dec->spellings))
+        fail (Error_Bad_Media_Raw());
+    return VAL_WORD_SPELLING(ARR_AT(dec->spellings, ref - 1));
+}
+
+static void Rebin_Decode_Value(struct Rebin_Decoder *dec, RELVAL *out);
+
+// Returns the series for the reference, whether it was defined here or was
+// a reference to an earlier definition.  Definitions are put in the series
+// table before any of their contents are decoded, so cycles can find them.
+//
+static REBSER *Rebin_Decode_Series(
+    struct Rebin_Decoder *dec,
+    enum Reb_Kind kind
+){
+    REBU64 ref = Rebin_Get_Varint(dec);
+    if (ref != 0) {
+        if (ref > ARR_LEN(dec->series))
+            fail (Error_Bad_Media_Raw());
+
+        const REBVAL *entry = KNOWN(ARR_AT(dec->series, ref - 1));
+        bool ok;
+        if (ANY_ARRAY_KIND(kind))
+            ok = IS_BLOCK(entry);
+        else if (kind == REB_BINARY)
+            ok = IS_BINARY(entry);
+        else
+            ok = IS_TEXT(entry);
+        if (not ok)
+            fail (Error_Bad_Media_Raw());
+        return VAL_SERIES(entry);
+    }
+
+    REBYTE define = Rebin_Get_Byte(dec);
+    if (define == REBIN_DEFINE_ANONYMOUS) {
+        if (ANY_ARRAY_KIND(kind))
+            fail (Error_Bad_Media_Raw());  // the encoder gives arrays ids
+    }
+    else if (define != REBIN_DEFINE_WITH_ID)
+        fail (Error_Bad_Media_Raw());
+
+    if (ANY_ARRAY_KIND(kind)) {
+        REBLEN len = Rebin_Get_Count(dec);
+        REBYTE aflags = Rebin_Get_Byte(dec);
+
+        if (aflags & ~(REBIN_ARRAY_NEWLINE_AT_TAIL | REBIN_ARRAY_FILE_LINE))
+            fail (Error_Bad_Media_Raw());
+
+        // Not Make_Array(), which would take the file and line of whatever
+        // code is running the decode.
+        //
+        REBARR *a = Make_Array_Core(len, SERIES_FLAGS_NONE);
+        if (aflags & REBIN_ARRAY_NEWLINE_AT_TAIL)
+            SET_ARRAY_FLAG(a, NEWLINE_AT_TAIL);
+        if (aflags & REBIN_ARRAY_FILE_LINE) {
+            LINK_FILE_NODE(a) = NOD(Rebin_Get_Spelling(dec));
+            REBU64 line = Rebin_Get_Varint(dec);
+            if (line > INT32_MAX)
+                fail (Error_Bad_Media_Raw());
+            MISC(a).line = cast(REBLIN, line);
+            SER(a)->header.bits |= ARRAY_MASK_HAS_FILE_LINE;
+        }
+        Init_Block(Alloc_Tail_Array(dec->series), a);
+
+        REBLEN n;
+        for (n = 0; n < len; ++n)
+            Rebin_Decode_Value(dec, Init_Blank(Alloc_Tail_Array(a)));
+        return SER(a);
+    }
+
+    REBLEN size = Rebin_Get_Count(dec);
+    const REBYTE *bytes = Rebin_Get_Bytes(dec, size);
+
+    REBSER *s;
+    if (kind == REB_BINARY) {
+        s = Make_Binary(size);
+        memcpy(BIN_HEAD(s), bytes, size);
+        TERM_BIN_LEN(s, size);
+    }
+    else {
+        s = SER(Append_UTF8_May_Fail(
+            nullptr, cs_cast(bytes), size, STRMODE_ALL_CODEPOINTS
+        ));
+    }
+
+    if (define == REBIN_DEFINE_WITH_ID) {
+        if (kind == REB_BINARY)
+            Init_Binary(Alloc_Tail_Array(dec->series), s);
+        else
+            Init_Text(Alloc_Tail_Array(dec->series), STR(s));
+    }
+    return s;
+}
+
+static void Rebin_Decode_Value(struct Rebin_Decoder *dec, RELVAL *out)
+{
+    REBYTE head = Rebin_Get_Byte(dec);
+    REBYTE tag = head & REBIN_TAG_MASK;
+
+    REBLEN quotes = 0;
+    if (head & REBIN_FLAG_QUOTED) {
+        REBU64 depth = Rebin_Get_Varint(dec);
+        if (depth == 0 or depth > UINT32_MAX)
+            fail (Error_Bad_Media_Raw());
+        quotes = cast(REBLEN, depth);
+    }
+
+    switch (tag) {
+      case REBIN_TAG_BLANK:
+        Init_Blank(out);
+        break;
+
+      case REBIN_TAG_FALSE:
+        Init_False(out);
+        break;
+
+      case REBIN_TAG_TRUE:
+        Init_True(out);
+        break;
+
+      case REBIN_TAG_INTEGER: {
+        REBU64 u = Rebin_Get_Varint(dec);
+        Init_Integer(out, cast(REBI64, (u >> 1) ^ (~(u & 1) + 1)));
+        break; }
+
+      case REBIN_TAG_DECIMAL:
+      case REBIN_TAG_PERCENT: {
+        const REBYTE *buf = Rebin_Get_Bytes(dec, 8);
+        REBU64 bits = 0;
+        REBLEN n;
+        for (n = 8; n != 0; --n)
+            bits = (bits << 8) | buf[n - 1];
+        REBDEC d;
+        memcpy(&d, &bits, sizeof(d));
+        if (tag == REBIN_TAG_DECIMAL)
+            Init_Decimal(out, d);
+        else
+            Init_Percent(out, d);
+        break; }
+
+      case REBIN_TAG_CHAR: {
+        REBU64 c = Rebin_Get_Varint(dec);
+        if (c > MAX_UNI)
+            fail (Error_Bad_Media_Raw());
+        Init_Char_May_Fail(out, cast(REBUNI, c));
+        break; }
+
+      case REBIN_TAG_VOID:
+        Init_Void(out);
+        break;
+
+      case REBIN_TAG_NULLED:
+        if (quotes == 0)
+            fail (Error_Bad_Media_Raw());  // nulls can't be put in arrays
+        Init_Nulled(out);
+        break;
+
+      case REBIN_TAG_MOLDED: {
+        if (quotes != 0)
+            fail (Error_Bad_Media_Raw());  // molded text carries the quotes
+
+        REBLEN size = Rebin_Get_Count(dec);
+        const REBYTE *utf8 = Rebin_Get_Bytes(dec, size);
+        REBARR *a = Scan_UTF8_Managed(Canon(SYM___ANONYMOUS__), utf8, size);
+        if (ARR_LEN(a) != 1)
+            fail (Error_Bad_Media_Raw());
+        Move_Value(out, KNOWN(ARR_HEAD(a)));
+        break; }
+
+      default: {
+        enum Reb_Kind kind = Kind_For_Tag(tag);
+
+        if (ANY_WORD_KIND(kind))
+            Init_Any_Word(out, kind, Rebin_Get_Spelling(dec));
+        else {
+            REBSER *s = Rebin_Decode_Series(dec, kind);
+
+            REBU64 index = Rebin_Get_Varint(dec);
+            if (index > UINT32_MAX)
+                fail (Error_Bad_Media_Raw());
+
+            Init_Any_Series_At(out, kind, s, cast(REBLEN, index));
+        }
+        break; }
+    }
+
+    if (quotes != 0)
+        Quotify(out, quotes);
+
+    if (head & REBIN_FLAG_NEWLINE_BEFORE)
+        SET_CELL_FLAG(out, NEWLINE_BEFORE);
+    else
+        CLEAR_CELL_FLAG(out, NEWLINE_BEFORE);
+}
+
+
+//
+//  export identify-rebin?: native [
+//
+//  {Codec for identifying BINARY! data in the REBIN format}
+//
+//      return: [logic!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(identify_rebin_q)
+{
+    REBIN_INCLUDE_PARAMS_OF_IDENTIFY_REBIN_Q;
+
+    if (VAL_LEN_AT(ARG(data)) < REBIN_MAGIC_SIZE)
+        return Init_False(D_OUT);
+
+    return Init_Logic(D_OUT, Is_Rebin_Magic(VAL_BIN_AT(ARG(data))));
+}
+
+
+//
+//  export decode-rebin: native [
+//
+//  {Codec for decoding BINARY! data in the REBIN format}
+//
+//      return: [any-value!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(decode_rebin)
+{
+    REBIN_INCLUDE_PARAMS_OF_DECODE_REBIN;
+
+    struct Rebin_Decoder dec;
+    dec.bp = VAL_BIN_AT(ARG(data));
+    dec.ep = dec.bp + VAL_LEN_AT(ARG(data));
+
+    if (
+        cast(REBLEN, dec.ep - dec.bp) < REBIN_MAGIC_SIZE
+        or not Is_Rebin_Magic(dec.bp)
+    ){
+        fail (Error_Bad_Media_Raw());
+    }
+    dec.bp += REBIN_MAGIC_SIZE;
+
+    dec.spellings = Make_Array(16);
+    PUSH_GC_GUARD(dec.spellings);
+    dec.series = Make_Array(16);
+    PUSH_GC_GUARD(dec.series);
+
+    Rebin_Decode_Value(&dec, D_OUT);
+    if (dec.bp != dec.ep)
+        fail (Error_Bad_Media_Raw());  // trailing garbage
+
+    DROP_GC_GUARD(dec.series);
+    DROP_GC_GUARD(dec.spellings);
+    Free_Unmanaged_Array(dec.series);
+    Free_Unmanaged_Array(dec.spellings);
+
+    CLEAR_CELL_FLAG(D_OUT, NEWLINE_BEFORE);
+    return D_OUT;
+}
+
+
+//
+//  export encode-rebin: native [
+//
+//  {Codec for encoding a value in the compact binary REBIN format}
+//
+//      return: [binary!]
+//      value [any-value!]
+//  ]
+//
+REBNATIVE(encode_rebin)
+{
+    REBIN_INCLUDE_PARAMS_OF_ENCODE_REBIN;
+
+    struct Rebin_Encoder enc;
+    enc.out = Make_Binary(256);
+    enc.seen = Make_Seen_Table(64);
+    enc.seen_count = 0;
+    enc.num_spellings = 0;
+    enc.num_series = 0;
+
+    Rebin_Put_Bytes(&enc, Rebin_Magic, REBIN_MAGIC_SIZE);
+    Rebin_Encode_Value(&enc, ARG(value));
+    TERM_BIN(enc.out);
+
+    Free_Unmanaged_Series(enc.seen);
+    return Init_Binary(D_OUT, enc.out);
+}
@@ -6,6 +6,13 @@ includes: [
     %prep/extensions/serial
 ]
 
+; The port is read by a background thread (see %serial-posix.c).  On Windows,
+; threads come from kernel32, which is linked by default.
+;
+libraries: try if system-config/os-base <> 'Windows [
+    [%pthread]
+]
+
 depends: compose [
     (switch system-config/os-base [
         'Windows [
@@ -117,6 +117,15 @@ static REB_R Serial_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
                     "]",
                 "] ]", rebEND);
 
+            ReqSerial(serial)->buffer_size = rebUnbox("use [size] [",
+                "size: try pick", spec, "'buffer-size",
+                "any [",
+                    "if blank? size [", rebI(SERIAL_BUFFER_SIZE), "]",
+                    "all [integer? size | size > 0 | size]",
+                "] else [",
+                    "fail [{BUFFER-SIZE should be a positive INTEGER!} size]",
+                "] ]", rebEND);
+
             OS_DO_DEVICE_SYNC(serial, RDC_OPEN);
 
             req->flags |= RRF_OPEN;
@@ -161,15 +170,42 @@ static REB_R Serial_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
         UNUSED(PAR(string)); // handled in dispatcher
         UNUSED(PAR(lines)); // handled in dispatcher
 
-        // Setup the read buffer (allocate a buffer if needed):
+        // The bytes come out of the ring buffer the background reader fills
+        // (see %serial-posix.c), and the READ stays pending until there are
+        // at least LOW-WATER of them.  Checked on each READ, so it may be
+        // changed while the port is open.
+        //
+        ReqSerial(serial)->low_water = rebUnbox("use [low] [",
+            "low: try pick", spec, "'low-water",
+            "any [",
+                "if blank? low [1]",
+                "all [integer? low | low > 0 | low]",
+            "] else [",
+                "fail [{LOW-WATER should be a positive INTEGER!} low]",
+            "] ]", rebEND);
+
+        // READ/INTO makes the caller's binary the receive buffer, as with
+        // the network port, so a loop can reuse one instead of taking a new
+        // PORT/DATA each time.  Data goes at its tail.
+        //
         REBVAL *data = CTX_VAR(ctx, STD_PORT_DATA);
+        if (REF(into)) {
+            FAIL_IF_READ_ONLY(ARG(into));
+            Init_Binary(data, VAL_BINARY(ARG(into)));
+        }
+
+        // Setup the read buffer (allocate a buffer if needed):
         if (!IS_BINARY(data))
             Init_Binary(data, Make_Binary(32000));
 
+        // Read into whatever space the binary has.  Only grow it when there
+        // is too little, so a READ/INTO binary made big enough up front is
+        // never reallocated.
+        //
         REBSER *ser = VAL_SERIES(data);
-        req->length = SER_AVAIL(ser); // space available
-        if (req->length < 32000 / 2)
-            Extend_Series(ser, 32000);
+        REBLEN low_water = ReqSerial(serial)->low_water;
+        if (SER_AVAIL(ser) < low_water)
+            Extend_Series(ser, low_water < 32000 ? 32000 : low_water);
         req->length = SER_AVAIL(ser);
 
         req->common.data = BIN_TAIL(ser); // write at tail
@@ -180,9 +216,18 @@ static REB_R Serial_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
         printf("(max read length %d)", req->length);
       #endif
 
-        // "recv can happen immediately"
-        //
-        OS_DO_DEVICE_SYNC(serial, RDC_READ);
+        REBVAL *result = OS_DO_DEVICE(serial, RDC_READ);
+        if (result == nullptr) {
+            //
+            // Request pending, until the background reader has LOW-WATER
+            // bytes buffered (then there's a 'read event)
+            //
+            RETURN (port);
+        }
+
+        if (rebDid("error?", result, rebEND))
+            rebJumps("FAIL", result, rebEND);
+        rebRelease(result); // ignore result
 
       #ifdef DEBUG_SERIAL
         for (len = 0; len < req->actual; len++) {
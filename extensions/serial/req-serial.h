@@ -1,5 +1,15 @@
 EXTERN_C REBDEV Dev_Serial;
 
+// Bytes are read from the OS by a thread of the port's own into a ring
+// buffer, so they are not lost when the interpreter is busy for longer than
+// the OS's small queue lasts at high speeds.  READ takes from the ring.  The
+// struct is defined by each platform's device (see Open_Serial()).
+//
+struct Serial_Reader;
+
+#define SERIAL_BUFFER_SIZE 65536  // default size of the ring buffer
+#define SERIAL_READER_POLL_MS 100  // how long closing may wait for the thread
+
 struct devreq_serial {
     struct rebol_devreq devreq;
     REBVAL *path;           //device path string (in OS local format)
@@ -9,6 +19,9 @@ struct devreq_serial {
     uint8_t parity;         // odd, even, mark or space
     uint8_t stop_bits;      // 1 or 2
     uint8_t flow_control;   // hardware or software
+    struct Serial_Reader *reader;  // background reader, while open
+    uint32_t buffer_size;   // ring buffer size (rounded up to a power of 2)
+    uint32_t low_water;     // READ is pending until this many bytes are in
 };
 
 inline static struct devreq_serial *ReqSerial(REBREQ *req) {
@@ -32,6 +32,8 @@
 #include <dirent.h>
 #include <errno.h>
 #include <termios.h>
+#include <poll.h>
+#include <pthread.h>
 
 #include "sys-core.h"
 
@@ -188,6 +190,177 @@ static REBINT Set_Serial_Settings(int ttyfd, REBREQ *req)
     return 0;
 }
 
+//=//// BACKGROUND READER ///////////////////////////////////////////////=//
+//
+// The thread reads whatever the tty has into the ring buffer, and waits for
+// READ to make room if it is full (so flow control, if any, holds the other
+// end off).  While at least `low_water` bytes are buffered, a byte sits in
+// the `wake` pipe.  The pipe's read end is the request's `requestee.id`, so
+// a WAIT sleeping in poll() wakes up when there's enough to READ.
+//
+// The counts only go up, with the ring positions being their low bits.  The
+// thread only writes the part of the buffer between `head` and `tail + size`
+// and READ only the part between `tail` and `head`, so the copying is done
+// without the lock.
+//
+
+struct Serial_Reader {
+    int fd;  // the tty
+    int wake[2];  // pipe, see above
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t space;  // signaled when READ takes bytes out
+    REBYTE *buf;
+    size_t size;  // a power of 2
+    size_t head;  // count of bytes ever put in the ring
+    size_t tail;  // count of bytes ever taken out
+    size_t low_water;
+    bool woken;  // the wake pipe has a byte in it
+    bool stop;
+    int error;  // errno if reading failed (the thread has then exited)
+};
+
+
+static void Wake_Reader_Locked(struct Serial_Reader *r)
+{
+    if (r->woken)
+        return;
+    char byte = 0;
+    if (write(r->wake[1], &byte, 1) == 1)
+        r->woken = true;
+}
+
+
+static void *Serial_Reader_Thread(void *arg)
+{
+    struct Serial_Reader *r = cast(struct Serial_Reader*, arg);
+
+    pthread_mutex_lock(&r->mutex);
+    while (not r->stop) {
+        size_t used = r->head - r->tail;
+        if (used == r->size) {
+            pthread_cond_wait(&r->space, &r->mutex);
+            continue;
+        }
+
+        size_t at = r->head & (r->size - 1);
+        size_t len = r->size - used;
+        if (len > r->size - at)
+            len = r->size - at;  // just up to the end of the buffer
+
+        pthread_mutex_unlock(&r->mutex);
+
+        struct pollfd pfd;
+        pfd.fd = r->fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+
+        ssize_t n = 0;
+        int error = 0;
+        int ready = poll(&pfd, 1, SERIAL_READER_POLL_MS);
+        if (ready < 0)
+            error = errno;
+        else if (ready > 0) {
+            n = read(r->fd, r->buf + at, len);
+            if (n < 0)
+                error = errno;
+            else if (n == 0 and (pfd.revents & (POLLHUP | POLLERR)))
+                error = EIO;  // device went away
+        }
+        if (error == EAGAIN or error == EWOULDBLOCK or error == EINTR)
+            error = 0;
+
+        pthread_mutex_lock(&r->mutex);
+        if (error != 0) {
+            r->error = error;
+            Wake_Reader_Locked(r);  // so READ reports it
+            break;
+        }
+        r->head += n;
+        if (r->head - r->tail >= r->low_water)
+            Wake_Reader_Locked(r);
+    }
+    pthread_mutex_unlock(&r->mutex);
+
+    return nullptr;
+}
+
+
+static void Free_Reader(struct Serial_Reader *r)
+{
+    close(r->wake[0]);
+    close(r->wake[1]);
+    pthread_cond_destroy(&r->space);
+    pthread_mutex_destroy(&r->mutex);
+    free(r->buf);
+    free(r);
+}
+
+
+static struct Serial_Reader *Start_Reader(int fd, size_t size)
+{
+    size_t rounded = 256;
+    while (rounded < size)
+        rounded *= 2;
+
+    struct Serial_Reader *r = cast(struct Serial_Reader*,
+        calloc(1, sizeof(struct Serial_Reader))
+    );
+    if (r)
+        r->buf = cast(REBYTE*, malloc(rounded));
+    if (not r or not r->buf) {
+        free(r);
+        fail (Error_No_Memory(rounded));
+    }
+    r->fd = fd;
+    r->size = rounded;
+    r->low_water = 1;
+
+    if (pipe(r->wake) != 0) {
+        int errno_cache = errno;
+        free(r->buf);
+        free(r);
+        rebFail_OS (errno_cache);
+    }
+    fcntl(r->wake[0], F_SETFL, O_NONBLOCK);  // READ drains it without waiting
+    pthread_mutex_init(&r->mutex, nullptr);
+    pthread_cond_init(&r->space, nullptr);
+
+    if (pthread_create(&r->thread, nullptr, &Serial_Reader_Thread, r) != 0) {
+        Free_Reader(r);
+        fail ("Could not start a thread to read the serial port");
+    }
+    return r;
+}
+
+
+static void Stop_Reader(struct Serial_Reader *r)
+{
+    pthread_mutex_lock(&r->mutex);
+    r->stop = true;
+    pthread_cond_signal(&r->space);
+    pthread_mutex_unlock(&r->mutex);
+
+    pthread_join(r->thread, nullptr);  // it notices within a poll() timeout
+    Free_Reader(r);
+}
+
+
+//
+//  Init_Serial: C
+//
+DEVICE_CMD Init_Serial(REBREQ *dr)
+{
+    REBDEV *dev = cast(REBDEV*, dr);
+
+    // Let the event device wait on the reader's wake pipe (see above) when a
+    // READ is pending.
+    //
+    dev->flags |= RDF_INIT | RDF_SOCKETS;
+    return DR_DONE;
+}
+
+
 //
 //  Open_Serial: C
 //
@@ -226,13 +399,18 @@ DEVICE_CMD Open_Serial(REBREQ *req)
         rebFail_OS (errno_cache);
     }
 
-    if (Set_Serial_Settings(h, req) == 0) {
+    if (Set_Serial_Settings(h, req) != 0) {
         int errno_cache = errno;
         close(h);
         rebFail_OS (errno_cache);
     }
 
-    Req(req)->requestee.id = h;
+    serial->reader = Start_Reader(
+        h,
+        serial->buffer_size != 0 ? serial->buffer_size : SERIAL_BUFFER_SIZE
+    );
+
+    Req(req)->requestee.id = serial->reader->wake[0];
     return DR_DONE;
 }
 
@@ -243,15 +421,20 @@ DEVICE_CMD Open_Serial(REBREQ *req)
 DEVICE_CMD Close_Serial(REBREQ *serial)
 {
     struct rebol_devreq *req = Req(serial);
-    if (req->requestee.id) {
+    struct Serial_Reader *r = ReqSerial(serial)->reader;
+    if (r) {
+        int fd = r->fd;
+        Stop_Reader(r);
+        ReqSerial(serial)->reader = nullptr;
+        req->requestee.id = 0;
+
         // !!! should we free serial->prior_attr termios struct?
         tcsetattr(
-            req->requestee.id,
+            fd,
             TCSANOW,
             cast(struct termios*, ReqSerial(serial)->prior_attr)
         );
-        close(req->requestee.id);
-        req->requestee.id = 0;
+        close(fd);
     }
     return DR_DONE;
 }
@@ -260,25 +443,60 @@ DEVICE_CMD Close_Serial(REBREQ *serial)
 //
 //  Read_Serial: C
 //
+// Takes what the background reader has buffered, once there's at least the
+// low water mark (or as much as was asked for, if that's less).
+//
 DEVICE_CMD Read_Serial(REBREQ *serial)
 {
     struct rebol_devreq *req = Req(serial);
+    struct Serial_Reader *r = ReqSerial(serial)->reader;
 
-    assert(req->requestee.id != 0);
+    assert(r != nullptr);
 
-    ssize_t result = read(req->requestee.id, req->common.data, req->length);
-
-#ifdef DEBUG_SERIAL
-    printf("read %d ret: %d\n", req->length, result);
-#endif
+    size_t want = ReqSerial(serial)->low_water;
+    if (want == 0)
+        want = 1;
+    if (want > req->length)
+        want = req->length;
 
-    if (result < 0)
-        rebFail_OS (errno);
+    pthread_mutex_lock(&r->mutex);
+    r->low_water = want;
 
-    if (result == 0)
+    size_t used = r->head - r->tail;
+    int error = r->error;
+    if (used == 0 and error != 0) {
+        pthread_mutex_unlock(&r->mutex);
+        rebFail_OS (error);
+    }
+    if (used < want and error == 0) {
+        pthread_mutex_unlock(&r->mutex);
         return DR_PEND;
+    }
+    pthread_mutex_unlock(&r->mutex);
+
+    size_t n = used < req->length ? used : req->length;
+    size_t at = r->tail & (r->size - 1);
+    size_t first = r->size - at;
+    if (first > n)
+        first = n;
+    memcpy(req->common.data, r->buf + at, first);
+    memcpy(req->common.data + first, r->buf, n - first);
+
+    pthread_mutex_lock(&r->mutex);
+    r->tail += n;
+    if (r->woken and r->head - r->tail < r->low_water and r->error == 0) {
+        char byte;
+        if (read(r->wake[0], &byte, 1) == 1)
+            r->woken = false;
+    }
+    pthread_cond_signal(&r->space);
+    pthread_mutex_unlock(&r->mutex);
 
-    req->actual = result;
+#ifdef DEBUG_SERIAL
+    printf("read %d ret: %d\n", req->length, cast(int, n));
+#endif
+
+    req->actual = n;
 
     rebElide(
         "insert system/ports/system make event! [",
@@ -300,12 +518,12 @@ DEVICE_CMD Write_Serial(REBREQ *serial)
 
     size_t len = req->length - req->actual;
 
-    assert(req->requestee.id != 0);
+    assert(ReqSerial(serial)->reader != nullptr);
 
     if (len <= 0)
         return DR_DONE;
 
-    int result = write(req->requestee.id, req->common.data, len);
+    int result = write(ReqSerial(serial)->reader->fd, req->common.data, len);
 
 #ifdef DEBUG_SERIAL
     printf("write %d ret: %d\n", len, result);
@@ -363,7 +581,7 @@ DEVICE_CMD Query_Serial(REBREQ *req)
 ***********************************************************************/
 
 static DEVICE_CMD_CFUNC Dev_Cmds[RDC_MAX] = {
-    0,
+    Init_Serial,
     0,
     Open_Serial,
     Close_Serial,
@@ -49,6 +49,116 @@
 
 #define MAX_SERIAL_DEV_PATH 128
 
+
+//=//// BACKGROUND READER ///////////////////////////////////////////////=//
+//
+// The thread reads whatever the port has into the ring buffer, and waits for
+// READ to make room if it is full.  Each ReadFile() gives up after at most
+// SERIAL_READER_POLL_MS, so the thread can notice it's being stopped.  A
+// pending READ is retried by the event loop (see %dev-event.c), so there is
+// nothing like the POSIX wake pipe here.
+//
+// The counts only go up, with the ring positions being their low bits.  The
+// thread only writes the part of the buffer between `head` and `tail + size`
+// and READ only the part between `tail` and `head`, so the copying is done
+// without the lock.
+//
+
+struct Serial_Reader {
+    HANDLE handle;
+    HANDLE thread;
+    SRWLOCK lock;
+    CONDITION_VARIABLE space;  // signaled when READ takes bytes out
+    REBYTE *buf;
+    size_t size;  // a power of 2
+    size_t head;  // count of bytes ever put in the ring
+    size_t tail;  // count of bytes ever taken out
+    bool stop;
+    DWORD error;  // GetLastError() if reading failed (thread has exited)
+};
+
+
+static DWORD WINAPI Serial_Reader_Thread(LPVOID arg)
+{
+    struct Serial_Reader *r = cast(struct Serial_Reader*, arg);
+
+    AcquireSRWLockExclusive(&r->lock);
+    while (not r->stop) {
+        size_t used = r->head - r->tail;
+        if (used == r->size) {
+            SleepConditionVariableSRW(&r->space, &r->lock, INFINITE, 0);
+            continue;
+        }
+
+        size_t at = r->head & (r->size - 1);
+        size_t len = r->size - used;
+        if (len > r->size - at)
+            len = r->size - at;  // just up to the end of the buffer
+
+        ReleaseSRWLockExclusive(&r->lock);
+
+        DWORD n;
+        DWORD error = 0;
+        if (not ReadFile(r->handle, r->buf + at, cast(DWORD, len), &n, 0))
+            error = GetLastError();
+
+        AcquireSRWLockExclusive(&r->lock);
+        if (error != 0) {
+            r->error = error;
+            break;
+        }
+        r->head += n;
+    }
+    ReleaseSRWLockExclusive(&r->lock);
+
+    return 0;
+}
+
+
+static struct Serial_Reader *Start_Reader(HANDLE h, size_t size)
+{
+    size_t rounded = 256;
+    while (rounded < size)
+        rounded *= 2;
+
+    struct Serial_Reader *r = cast(struct Serial_Reader*,
+        calloc(1, sizeof(struct Serial_Reader))
+    );
+    if (r)
+        r->buf = cast(REBYTE*, malloc(rounded));
+    if (not r or not r->buf) {
+        free(r);
+        fail (Error_No_Memory(rounded));
+    }
+    r->handle = h;
+    r->size = rounded;
+    InitializeSRWLock(&r->lock);
+    InitializeConditionVariable(&r->space);
+
+    r->thread = CreateThread(NULL, 0, &Serial_Reader_Thread, r, 0, NULL);
+    if (r->thread == NULL) {
+        DWORD error = GetLastError();
+        free(r->buf);
+        free(r);
+        rebFail_OS (error);
+    }
+    return r;
+}
+
+
+static void Stop_Reader(struct Serial_Reader *r)
+{
+    AcquireSRWLockExclusive(&r->lock);
+    r->stop = true;
+    WakeConditionVariable(&r->space);
+    ReleaseSRWLockExclusive(&r->lock);
+
+    WaitForSingleObject(r->thread, INFINITE);  // at most a ReadFile() timeout
+    CloseHandle(r->thread);
+    free(r->buf);
+    free(r);
+}
+
 const int speeds[] = {
     110, CBR_110,
     300, CBR_300,
@@ -168,18 +278,17 @@ DEVICE_CMD Open_Serial(REBREQ *serial)
         rebFail_OS (GetLastError());
     }
 
-    // !!! Comment said "add in timeouts? currently unused".  This might
-    // suggest a question of whether the request itself have some way of
-    // asking for custom timeouts, while the initialization of the timeouts
-    // below is the same for every request.
+    // Reads are only done by the background reader.  These settings make
+    // ReadFile() return as soon as anything arrives, or with nothing after
+    // SERIAL_READER_POLL_MS.
     //
     // http://msdn.microsoft.com/en-us/library/windows/desktop/aa363190%28v=vs.85%29.aspx
     //
     COMMTIMEOUTS timeouts;
     memset(&timeouts, '\0', sizeof(timeouts));
     timeouts.ReadIntervalTimeout = MAXDWORD;
-    timeouts.ReadTotalTimeoutMultiplier = 0;
-    timeouts.ReadTotalTimeoutConstant = 0;
+    timeouts.ReadTotalTimeoutMultiplier = MAXDWORD;
+    timeouts.ReadTotalTimeoutConstant = SERIAL_READER_POLL_MS;
     timeouts.WriteTotalTimeoutMultiplier = 1; // !!! should this be 0?
     timeouts.WriteTotalTimeoutConstant = 1; // !!! should this be 0?
 
@@ -188,6 +297,13 @@ DEVICE_CMD Open_Serial(REBREQ *serial)
         rebFail_OS (GetLastError());
     }
 
+    ReqSerial(serial)->reader = Start_Reader(
+        h,
+        ReqSerial(serial)->buffer_size != 0
+            ? ReqSerial(serial)->buffer_size
+            : SERIAL_BUFFER_SIZE
+    );
+
     req->requestee.handle = h;
     return DR_DONE;
 }
@@ -201,7 +317,9 @@ DEVICE_CMD Close_Serial(REBREQ *serial)
     struct rebol_devreq *req = Req(serial);
 
     if (req->requestee.handle != NULL) {
-        //
+        Stop_Reader(ReqSerial(serial)->reader);
+        ReqSerial(serial)->reader = NULL;
+
         // !!! Should we free req->special.serial.prior_attr termios struct?
         //
         CloseHandle(req->requestee.handle);
@@ -214,25 +332,46 @@ DEVICE_CMD Close_Serial(REBREQ *serial)
 //
 //  Read_Serial: C
 //
+// Takes what the background reader has buffered, once there's at least the
+// low water mark (or as much as was asked for, if that's less).
+//
 DEVICE_CMD Read_Serial(REBREQ *serial)
 {
     struct rebol_devreq *req = Req(serial);
+    struct Serial_Reader *r = ReqSerial(serial)->reader;
 
-    assert(req->requestee.handle != NULL);
+    assert(r != NULL);
 
-    //printf("reading %d bytes\n", req->length);
+    size_t want = ReqSerial(serial)->low_water;
+    if (want == 0)
+        want = 1;
+    if (want > req->length)
+        want = req->length;
 
-    DWORD result;
-    if (not ReadFile(
-        req->requestee.handle, req->common.data, req->length, &result, 0
-    )){
-        rebFail_OS (GetLastError());
-    }
+    AcquireSRWLockExclusive(&r->lock);
+    size_t used = r->head - r->tail;
+    DWORD error = r->error;
+    ReleaseSRWLockExclusive(&r->lock);
 
-    if (result == 0)
+    if (used == 0 and error != 0)
+        rebFail_OS (error);
+    if (used < want and error == 0)
         return DR_PEND;
 
-    req->actual = result;
+    size_t n = used < req->length ? used : req->length;
+    size_t at = r->tail & (r->size - 1);
+    size_t first = r->size - at;
+    if (first > n)
+        first = n;
+    memcpy(req->common.data, r->buf + at, first);
+    memcpy(req->common.data + first, r->buf, n - first);
+
+    AcquireSRWLockExclusive(&r->lock);
+    r->tail += n;
+    WakeConditionVariable(&r->space);
+    ReleaseSRWLockExclusive(&r->lock);
+
+    req->actual = n;
 
     rebElide(
         "insert system/ports/system make event! [",
@@ -89,7 +89,6 @@ static void Prin_OS_String(const REBYTE *utf8, REBSIZ size, REBFLGS opts)
     REBREQ *rebreq = OS_Make_Devreq(&Dev_StdIO);
     struct rebol_devreq *req = Req(rebreq);
 
-    req->flags |= RRF_FLUSH;
     if (opts & OPT_ENC_RAW)
         req->modes &= ~RFM_TEXT;
     else
@@ -221,3 +220,36 @@ REBNATIVE(write_stdout)
 
     return Init_Void(D_OUT);
 }
+
+
+//
+//  export flush-stdout: native [
+//
+//  "Write out any standard output that is being held in the output buffer"
+//
+//      return: [<opt> void!]
+//  ]
+//
+REBNATIVE(flush_stdout)
+//
+// Output to pipes and files is fully buffered, and to a terminal it is line
+// buffered, so partial lines (e.g. progress indicators) need this to be seen.
+// Reading standard input and closing the device flush automatically.
+{
+    INCLUDE_PARAMS_OF_FLUSH_STDOUT;
+
+    static REBYTE nothing[] = "";  // no bytes to add, just flush
+
+    REBREQ *req = OS_Make_Devreq(&Dev_StdIO);
+
+    Req(req)->flags |= RRF_FLUSH;
+    Req(req)->common.data = nothing;
+    Req(req)->length = 0;
+    Req(req)->actual = 0;
+
+    OS_DO_DEVICE_SYNC(req, RDC_WRITE);
+
+    Free_Req(req);
+
+    return Init_Void(D_OUT);
+}
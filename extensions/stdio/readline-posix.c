@@ -38,6 +38,7 @@
 #include <stdio.h>
 #include <unistd.h>  // has POSIX read() and write()
 #include <errno.h>
+#include <string.h>
 
 #include <termios.h>
 
@@ -62,13 +63,50 @@ enum {
 
 
 #define WRITE_UTF8(s,n) \
-    do { \
-        if (write(STDOUT_FILENO, s, n) == -1) { \
-            /* Error here, or better to "just try to keep going"? */ \
-        } \
-    } while (0)
+    Write_Out((s), (n))
 
-#define READ_BUF_LEN 64
+// A paste arrives in reads of up to this many bytes, so it should be large
+// enough that a big paste doesn't take a great many reads.
+//
+#define READ_BUF_LEN 4096
+
+// Output is gathered here and written when a terminal operation finishes
+// (or the buffer fills), instead of a write() per character.  Moving the
+// cursor over a long line would otherwise be hundreds of system calls.
+//
+#define OUT_BUF_LEN 4096
+static unsigned char Out_Buf[OUT_BUF_LEN];
+static size_t Out_Len = 0;
+
+static void Flush_Out(void)
+{
+    if (Out_Len != 0 and write(STDOUT_FILENO, Out_Buf, Out_Len) == -1) {
+        // !!! Error here, or better to "just try to keep going"?
+    }
+    Out_Len = 0;
+}
+
+static void Write_Out(const void *p, size_t n)
+{
+    if (Out_Len + n > OUT_BUF_LEN) {
+        Flush_Out();
+        if (n > OUT_BUF_LEN) {  // no use copying it, write it directly
+            if (write(STDOUT_FILENO, p, n) == -1) {
+                // !!! Error here, or better to "just try to keep going"?
+            }
+            return;
+        }
+    }
+    memcpy(Out_Buf + Out_Len, p, n);
+    Out_Len += n;
+}
+
+// Terminals that support "bracketed paste" send pasted text between these
+// sequences, once it's been switched on (which other terminals ignore).
+// That lets a paste's tabs be taken as text instead of completion requests.
+//
+#define BRACKETED_PASTE_ON "\x1b[?2004h"
+#define BRACKETED_PASTE_OFF "\x1b[?2004l"
 
 struct Reb_Terminal_Struct {
     REBVAL *buffer;  // a TEXT! used as a buffer
@@ -83,6 +121,8 @@ struct Reb_Terminal_Struct {
     //
     REBVAL *e_pending;
 
+    bool pasting;  // between bracketed paste's start and end sequences
+
     struct termios original_attrs;
 };
 
@@ -161,6 +201,10 @@ STD_TERM *Init_Terminal(void)
     t->pos = 0;
 
     t->e_pending = nullptr;
+    t->pasting = false;
+
+    WRITE_UTF8(BRACKETED_PASTE_ON, strlen(BRACKETED_PASTE_ON));
+    Flush_Out();
 
     Term_Initialized = true;
     return t;
@@ -202,6 +246,9 @@ void Quit_Terminal(STD_TERM *t)
 {
     assert(Term_Initialized);
 
+    WRITE_UTF8(BRACKETED_PASTE_OFF, strlen(BRACKETED_PASTE_OFF));
+    Flush_Out();
+
     tcsetattr(0, TCSADRAIN, &t->original_attrs);
 
     rebRelease(t->buffer);
@@ -236,6 +283,8 @@ static bool Read_Bytes_Interrupted(STD_TERM *t)
 {
     assert(*t->cp == '\0');  // Don't read more bytes if buffer not exhausted
 
+    Flush_Out();  // show everything before waiting on the user
+
     int len = read(0, t->buf, READ_BUF_LEN - 1);  // save space for '\0'
     if (len < 0) {
         if (errno == EINTR)
@@ -259,9 +308,7 @@ static bool Read_Bytes_Interrupted(STD_TERM *t)
 void Write_Char(unsigned char c, int n)
 {
     for (; n > 0; n--)
-        if (write(STDOUT_FILENO, &c, 1) == -1) {
-            // !!! Error here, or better to "just try to keep going"?
-        }
+        Write_Out(&c, 1);
 }
 
 
@@ -278,6 +325,7 @@ void Term_Clear_To_End(STD_TERM *t)
 
     Write_Char(' ', num_codepoints_to_end);  // wipe to end of line...
     Write_Char(BS, num_codepoints_to_end);  // ...then return to position
+    Flush_Out();
 }
 
 
@@ -288,9 +336,27 @@ void Term_Clear_To_End(STD_TERM *t)
 //
 void Term_Seek(STD_TERM *t, unsigned int pos)
 {
-    int delta = (pos < t->pos) ? -1 : 1;
-    while (pos != t->pos)
-        Move_Cursor(t, delta);
+    unsigned int end = Term_End(t);
+    if (pos > end)
+        pos = end;
+
+    if (pos < t->pos)
+        Write_Char(BS, t->pos - pos);  // BS moves left without overwriting
+    else if (pos > t->pos) {
+        //
+        // Moving right means writing the characters that are already there,
+        // which can be fetched from the buffer all at once.
+        //
+        size_t num_bytes;
+        unsigned char *bytes = rebBytes(&num_bytes,
+            "copy/part skip", t->buffer, rebI(t->pos), rebI(pos - t->pos)
+        );
+        WRITE_UTF8(bytes, num_bytes);
+        rebFree(bytes);
+    }
+    t->pos = pos;
+
+    Flush_Out();
 }
 
 
@@ -370,6 +436,8 @@ void Delete_Char(STD_TERM *t, bool back)
     }
     else
         t->pos = 0;
+
+    Flush_Out();
 }
 
 
@@ -406,6 +474,8 @@ void Move_Cursor(STD_TERM *t, int count)
             t->pos += 1;
         }
     }
+
+    Flush_Out();
 }
 
 
@@ -438,6 +508,46 @@ REBVAL *Unrecognized_Key_Sequence(STD_TERM *t, int delta)
 }
 
 
+// Bytes that can be taken as a run of text: printable ASCII and UTF-8.  In
+// a paste, tabs are text too (vs. asking for completion).
+//
+inline static bool Is_Run_Byte(STD_TERM *t, unsigned char b) {
+    return (b >= 32 and b != DEL) or (b == '\t' and t->pasting);
+}
+
+
+// Find the end of the run of text at t->cp, not including a UTF-8 character
+// at the end of the read that's missing some of its bytes.
+//
+static const unsigned char *Scan_Run(STD_TERM *t)
+{
+    const unsigned char *ep = t->cp;
+    while (*ep != '\0' and Is_Run_Byte(t, *ep))
+        ++ep;
+
+    const unsigned char *lead = ep;  // back up to start of last character
+    while (lead != t->cp and (lead[-1] & 0xC0) == 0x80)
+        --lead;
+    if (lead == t->cp)
+        return lead;  // just continuation bytes, let per-character code sort
+    --lead;
+
+    int size;
+    if (*lead < 0x80)
+        size = 1;
+    else if (*lead >= 0xF0)
+        size = 4;
+    else if (*lead >= 0xE0)
+        size = 3;
+    else
+        size = 2;
+
+    if (ep - lead < size)
+        return lead;  // incomplete, leave it to be read in full
+    return ep;
+}
+
+
 //
 //  Try_Get_One_Console_Event: C
 //
@@ -476,6 +586,33 @@ REBVAL *Try_Get_One_Console_Event(STD_TERM *t, bool buffered)
         assert(*t->cp != '\0');
     }
 
+    if (buffered and Is_Run_Byte(t, *t->cp)) {
+        const unsigned char *run_end = Scan_Run(t);
+        if (run_end != t->cp) {
+
+    //=//// Run of printable characters (e.g. from a paste) ///////////////=//
+            //
+            // Appending each character of a big paste through the API would
+            // be slow.  So take all the complete characters in the buffer as
+            // one piece of text.  (A character split by the end of the read
+            // is left for the per-character code below, which reads more.)
+
+            REBVAL *run = rebSizedText(
+                cast(const char*, t->cp), run_end - t->cp
+            );
+            t->cp = run_end;
+
+            if (e_buffered) {
+                rebElide("append", e_buffered, run);
+                rebRelease(run);
+            }
+            else
+                e_buffered = run;
+
+            goto start_over;
+        }
+    }
+
     if (
         (*t->cp >= 32 and *t->cp < 127)  // 32 is space, 127 is DEL(ete)
         or *t->cp > 127  // high-bit set UTF-8 start byte
@@ -628,6 +765,19 @@ REBVAL *Try_Get_One_Console_Event(STD_TERM *t, bool buffered)
             e = xrebWord("clear");
             break;
 
+          case '2':  // start (200~) or end (201~) of a bracketed paste
+            if (
+                t->cp[0] == '0'
+                and (t->cp[1] == '0' or t->cp[1] == '1')
+                and t->cp[2] == '~'
+            ){
+                t->pasting = (t->cp[1] == '0');
+                t->cp += 3;
+                goto start_over;  // not an event of its own
+            }
+            e = Unrecognized_Key_Sequence(t, -2);
+            break;
+
           default:
             e = Unrecognized_Key_Sequence(t, -2);
             break;
@@ -871,6 +1021,7 @@ void Term_Insert(STD_TERM *t, const REBVAL *v) {
     }
 
     Show_Line(t, 0);
+    Flush_Out();
 }
 
 
@@ -883,6 +1034,7 @@ void Term_Beep(STD_TERM *t)
 {
     UNUSED(t);
     Write_Char(BEL, 1);
+    Flush_Out();
 }
 
 #endif  // end guard against readline in pre-C99 compilers (would need rebEND)
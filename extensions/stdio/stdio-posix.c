@@ -37,6 +37,10 @@
 #include <unistd.h>
 #include <signal.h>
 
+#if defined(REB_THREAD_INSTANCES)
+    #include <pthread.h>
+#endif
+
 #include "readline.h"
 
 
@@ -48,9 +52,73 @@ static int Std_Out = STDOUT_FILENO;
     extern STD_TERM *Term_IO;
 #endif
 
+// Output that isn't going through the smart terminal is gathered here and
+// written in large blocks, so printing many short lines doesn't cost a
+// write() each.  A TTY is line buffered (flushed at each newline), pipes and
+// files are fully buffered.  Pending output is also flushed before reading
+// stdin (so prompts are seen), on close, and for a write request carrying
+// RRF_FLUSH (see FLUSH-STDOUT).
+//
+// The buffer is process-wide, like stdout itself.  Interpreter instances on
+// other threads (see REB_THREAD_INSTANCES) print through it too, so it is
+// only touched with Out_Mutex held.
+//
+#define OUT_BUF_SIZE (64 * 1024)
+static REBYTE Out_Buf[OUT_BUF_SIZE];
+static size_t Out_Used = 0;
+static bool Out_Line_Buffered = false;
+
+#if defined(REB_THREAD_INSTANCES)
+    static pthread_mutex_t Out_Mutex = PTHREAD_MUTEX_INITIALIZER;
+
+    #define Lock_Out() pthread_mutex_lock(&Out_Mutex)
+    #define Unlock_Out() pthread_mutex_unlock(&Out_Mutex)
+#else
+    #define Lock_Out() NOOP
+    #define Unlock_Out() NOOP
+#endif
+
+
+// Returns 0 or an errno.  write() to a pipe may take only part of the data.
+//
+static int Write_All(const REBYTE *data, size_t size)
+{
+    while (size > 0) {
+        ssize_t total = write(Std_Out, data, size);
+        if (total < 0) {
+            if (errno == EINTR)
+                continue;
+            return errno;
+        }
+        data += total;
+        size -= total;
+    }
+    return 0;
+}
+
+// Must be called with Out_Mutex held.
+//
+static int Flush_Stdout_Locked(void)
+{
+    int err = Write_All(Out_Buf, Out_Used);
+    Out_Used = 0;  // on error, don't write the same bytes again next time
+    return err;
+}
+
+static int Flush_Stdout(void)
+{
+    Lock_Out();
+    int err = Flush_Stdout_Locked();
+    Unlock_Out();
+    return err;
+}
+
 
 static void Close_Stdio(void)
 {
+    if (Std_Out >= 0)
+        Flush_Stdout();  // nowhere to report an error at this point
+
   #if defined(REBOL_SMART_CONSOLE)
     if (Term_IO) {
         Quit_Terminal(Term_IO);
@@ -92,6 +160,7 @@ DEVICE_CMD Open_IO(REBREQ *io)
     }
 
     if (not (req->modes & RDM_NULL)) {
+        Out_Line_Buffered = did isatty(Std_Out);
 
       #if defined(REBOL_SMART_CONSOLE)
         if (isatty(Std_Inp))  // is termios-capable (not redirected to a file)
@@ -130,7 +199,8 @@ DEVICE_CMD Close_IO(REBREQ *req)
 //
 // Allowed to restrict the write to a max OS buffer size.
 //
-// Returns the number of chars written.
+// Returns the number of chars written.  Unless going to the smart terminal,
+// the bytes may only have been buffered (see Out_Buf).
 //
 DEVICE_CMD Write_IO(REBREQ *io)
 {
@@ -143,7 +213,10 @@ DEVICE_CMD Write_IO(REBREQ *io)
 
     if (Std_Out >= 0) {
       #if defined(REBOL_SMART_CONSOLE)
-        if (Term_IO) {
+        if (Term_IO and req->length == 0) {
+            NOOP;  // e.g. FLUSH-STDOUT, but the terminal isn't buffered
+        }
+        else if (Term_IO) {
             //
             // We need to sync the cursor position with writes.  This means
             // being UTF-8 aware, so the buffer we get has to be valid UTF-8
@@ -166,12 +239,35 @@ DEVICE_CMD Write_IO(REBREQ *io)
         else
       #endif
         {
-            long total = write(Std_Out, req->common.data, req->length);
-
-            if (total < 0)
-                rebFail_OS(errno);
-
-            assert(cast(size_t, total) == req->length);
+            const REBYTE *data = req->common.data;
+            size_t size = req->length;
+
+            Lock_Out();
+
+            int err = 0;
+            if (Out_Used + size > OUT_BUF_SIZE)
+                err = Flush_Stdout_Locked();
+
+            if (err == 0) {
+                if (size >= OUT_BUF_SIZE)  // too big to be worth copying
+                    err = Write_All(data, size);
+                else {
+                    memcpy(Out_Buf + Out_Used, data, size);
+                    Out_Used += size;
+
+                    if (
+                        (req->flags & RRF_FLUSH)
+                        or (Out_Line_Buffered and memchr(data, '\n', size))
+                    ){
+                        err = Flush_Stdout_Locked();
+                    }
+                }
+            }
+
+            Unlock_Out();  // not held while failing
+
+            if (err != 0)
+                rebFail_OS (err);
         }
         req->actual = req->length;
     }
@@ -215,6 +311,10 @@ DEVICE_CMD Read_IO(REBREQ *io)
 
     req->actual = 0;
 
+    int err = Flush_Stdout();  // e.g. a prompt written with WRITE-STDOUT
+    if (err != 0)
+        rebFail_OS (err);
+
     total = read(Std_Inp, BIN_HEAD(bin), len);  // restarts on signal
     if (total < 0)
         rebFail_OS (errno);
@@ -57,11 +57,67 @@ static WCHAR *Wchar_Buf = nullptr;
 static bool Redir_Out = false;
 static bool Redir_Inp = false;
 
+// Output written with WriteFile() is gathered here and written in large
+// blocks, as in %stdio-posix.c.  It's line buffered when stdout is a console
+// and fully buffered when redirected, and is flushed before reading stdin,
+// on close, and for a write request carrying RRF_FLUSH (see FLUSH-STDOUT).
+// Instances on other threads print through it too, so it's only touched
+// with Out_Mutex held.
+//
+#define OUT_BUF_SIZE (64 * 1024)
+static REBYTE Out_Buf[OUT_BUF_SIZE];
+static DWORD Out_Used = 0;
+
+#if defined(REB_THREAD_INSTANCES)
+    static SRWLOCK Out_Mutex = SRWLOCK_INIT;
+
+    #define Lock_Out() AcquireSRWLockExclusive(&Out_Mutex)
+    #define Unlock_Out() ReleaseSRWLockExclusive(&Out_Mutex)
+#else
+    #define Lock_Out() NOOP
+    #define Unlock_Out() NOOP
+#endif
+
+
+// Returns 0 or a GetLastError() code.
+//
+static DWORD Write_All(const REBYTE *data, DWORD size)
+{
+    while (size > 0) {
+        DWORD total_bytes;
+        if (not WriteFile(Stdout_Handle, data, size, &total_bytes, 0))
+            return GetLastError();
+        data += total_bytes;
+        size -= total_bytes;
+    }
+    return 0;
+}
+
+// Must be called with Out_Mutex held.
+//
+static DWORD Flush_Stdout_Locked(void)
+{
+    DWORD err = Write_All(Out_Buf, Out_Used);
+    Out_Used = 0;  // on error, don't write the same bytes again next time
+    return err;
+}
+
+static DWORD Flush_Stdout(void)
+{
+    Lock_Out();
+    DWORD err = Flush_Stdout_Locked();
+    Unlock_Out();
+    return err;
+}
+
 //**********************************************************************
 
 
 static void Close_Stdio(void)
 {
+    if (Stdout_Handle != nullptr)
+        Flush_Stdout();  // nowhere to report an error at this point
+
     if (Wchar_Buf) {
         free(Wchar_Buf);
         Wchar_Buf = nullptr;
@@ -182,7 +238,10 @@ DEVICE_CMD Write_IO(REBREQ *io)
         return DR_DONE;
 
   #if defined(REBOL_SMART_CONSOLE)
-    if (Term_IO) {
+    if (Term_IO and req->length == 0) {
+        NOOP;  // e.g. FLUSH-STDOUT, but the terminal isn't buffered
+    }
+    else if (Term_IO) {
         if (req->modes & RFM_TEXT) {
             //
             // !!! This is a wasteful step as the text initially came from
@@ -275,24 +334,39 @@ DEVICE_CMD Write_IO(REBREQ *io)
         // Note that redirection on Windows does not use UTF-16 typically.
         // Even CMD.EXE requires a /U switch to do so.
 
-        DWORD total_bytes;
-        BOOL ok = WriteFile(
-            Stdout_Handle,
-            req->common.data,
-            req->length,
-            &total_bytes,
-            0
-        );
-        if (not ok)
-            rebFail_OS (GetLastError());
-        UNUSED(total_bytes);
+        const REBYTE *data = req->common.data;
+        DWORD size = req->length;
+
+        Lock_Out();
+
+        DWORD err = 0;
+        if (Out_Used + size > OUT_BUF_SIZE)
+            err = Flush_Stdout_Locked();
+
+        if (err == 0) {
+            if (size >= OUT_BUF_SIZE)  // too big to be worth copying
+                err = Write_All(data, size);
+            else {
+                memcpy(Out_Buf + Out_Used, data, size);
+                Out_Used += size;
+
+                if (
+                    (req->flags & RRF_FLUSH)
+                    or (not Redir_Out and memchr(data, '\n', size))
+                ){
+                    err = Flush_Stdout_Locked();
+                }
+            }
+        }
+
+        Unlock_Out();  // not held while failing
+
+        if (err != 0)
+            rebFail_OS (err);
     }
 
     req->actual = req->length;  // want byte count written, assume success
 
-    // !!! There was some code in R3-Alpha here which checked req->flags for
-    // "RRF_FLUSH" and would flush, but it was commented out (?)
-
     return DR_DONE;
 }
 
@@ -326,6 +400,12 @@ DEVICE_CMD Read_IO(REBREQ *io)
         return DR_DONE;
     }
 
+    if (Stdout_Handle != nullptr) {
+        DWORD err = Flush_Stdout();  // e.g. a prompt written by WRITE-STDOUT
+        if (err != 0)
+            rebFail_OS (err);
+    }
+
     // While Windows historically uses UCS-2/UTF-16 in its console I/O, the
     // plain ReadFile() style calls are byte-oriented, so you get whatever
     // code page is in use.
@@ -0,0 +1,28 @@
+REBOL []
+
+name: 'Table
+source: %table/mod-table.c
+depends: [
+    %table/t-table.c
+]
+includes: [
+    %prep/extensions/table
+
+    ; Numeric columns are VECTOR!s, used through the internal includes of the
+    ; type (as the FFI does).  So the vector extension must be built into the
+    ; executable to use this one.
+    ;
+    %../extensions/vector
+]
+definitions: []
+cflags: []
+searches: []
+ldflags: []
+
+; Windows threads come from kernel32, which is linked by default.
+;
+libraries: try if system-config/os-base <> 'Windows [
+    [%pthread]
+]
+
+options: []
@@ -0,0 +1,1122 @@
+//
+//  File: %mod-table.c
+//  Summary: "TABLE! extension main C file"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See notes in %extensions/table/README.md
+
+#ifdef TO_WINDOWS
+    #define WIN32_LEAN_AND_MEAN  // trim down the Win32 headers
+    #include <windows.h>
+    #undef IS_ERROR  // winerror.h defines, Rebol has a different meaning
+#else
+    #include <pthread.h>
+    #include <unistd.h>  // for sysconf()
+#endif
+
+#include "sys-core.h"
+
+#include "tmp-mod-table.h"
+
+#include "sys-vector.h"
+#include "sys-table.h"
+
+
+REBTYP *EG_Table_Type;  // (E)xtension (G)lobal
+
+//
+//  register-table-hooks: native [
+//
+//  {Make the TABLE! datatype work with GENERIC actions, comparison ops, etc}
+//
+//      return: [void!]
+//  ]
+//
+REBNATIVE(register_table_hooks)
+{
+    TABLE_INCLUDE_PARAMS_OF_REGISTER_TABLE_HOOKS;
+
+    // !!! See notes on Hook_Datatype for this poor-man's substitute for a
+    // coherent design of an extensible object system (as per Lisp's CLOS)
+    //
+    EG_Table_Type = Hook_Datatype(
+        "http://datatypes.rebol.info/table",
+        "named columns of vectors or blocks",
+        &T_Table,
+        &PD_Table,
+        &CT_Table,
+        &MAKE_Table,
+        &TO_Table,
+        &MF_Table
+    );
+
+    return Init_Void(D_OUT);
+}
+
+
+//
+//  unregister-table-hooks: native [
+//
+//  {Remove behaviors for TABLE! added by REGISTER-TABLE-HOOKS}
+//
+//      return: [void!]
+//  ]
+//
+REBNATIVE(unregister_table_hooks)
+{
+    TABLE_INCLUDE_PARAMS_OF_UNREGISTER_TABLE_HOOKS;
+
+    Unhook_Datatype(EG_Table_Type);
+
+    return Init_Void(D_OUT);
+}
+
+
+//=//// GATHERING ROWS ////////////////////////////////////////////////////=//
+//
+// Filtering, sorting and joining all come down to working out which rows of
+// the input go where in the output, as a C array of row numbers.  Then every
+// column is "gathered" by those row numbers into a new column.
+//
+// A VECTOR! column is gathered from its packed data straight into the new
+// vector's binary, without making a cell for any element.  That is plain
+// memory copying which touches no Rebol state, so when there is enough of it
+// the rows are split into ranges that are gathered on several threads (each
+// thread does every vector column for its range).  BLOCK! columns copy cells,
+// and are done on the calling thread.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+
+#define TABLE_THREAD_MIN (1 << 18)  // elements to gather before using threads
+
+struct Reb_Gather_Job {
+    const REBYTE *src;
+    REBLEN step;  // bytes from one source element to the next
+    REBYTE wide;
+    REBYTE *dest;
+};
+
+struct Reb_Gather_Range {
+    const struct Reb_Gather_Job *jobs;
+    REBLEN num_jobs;
+    const REBLEN *rows;  // nullptr means row N of the output is row N
+    REBLEN start;
+    REBLEN len;
+};
+
+
+#define GATHER_ELEMENTS(W) \
+    for (i = r->start; i < end; ++i) \
+        memcpy( \
+            job->dest + i * (W), \
+            job->src + (r->rows ? r->rows[i] : i) * job->step, \
+            (W) \
+        )
+
+static void Run_Gather_Range(const struct Reb_Gather_Range *r)
+{
+    REBLEN end = r->start + r->len;
+
+    REBLEN j;
+    for (j = 0; j < r->num_jobs; ++j) {  // still a column at a time
+        const struct Reb_Gather_Job *job = &r->jobs[j];
+        REBLEN i;
+        switch (job->wide) {  // constant sizes let memcpy() be inlined
+          case 1: GATHER_ELEMENTS(1); break;
+          case 2: GATHER_ELEMENTS(2); break;
+          case 4: GATHER_ELEMENTS(4); break;
+          default: GATHER_ELEMENTS(8); break;
+        }
+    }
+}
+
+#undef GATHER_ELEMENTS
+
+
+#ifdef TO_WINDOWS
+    static DWORD WINAPI Gather_Thread(LPVOID p) {
+        Run_Gather_Range(cast(struct Reb_Gather_Range*, p));
+        return 0;
+    }
+    typedef HANDLE REBTHR;
+#else
+    static void *Gather_Thread(void *p) {
+        Run_Gather_Range(cast(struct Reb_Gather_Range*, p));
+        return nullptr;
+    }
+    typedef pthread_t REBTHR;
+#endif
+
+
+static REBLEN Num_Cpus(void)
+{
+  #ifdef TO_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+  #else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n < 1 ? 1 : cast(REBLEN, n);
+  #endif
+}
+
+
+//
+//  Gather_Vectors: C
+//
+// Run the gather jobs for rows 0..len-1 of the output, in ranges on several
+// threads if there is enough to do.
+//
+static void Gather_Vectors(
+    const struct Reb_Gather_Job *jobs,
+    REBLEN num_jobs,
+    const REBLEN *rows,
+    REBLEN len
+){
+    REBLEN pieces = 1;
+    if (num_jobs * len >= TABLE_THREAD_MIN) {
+        pieces = Num_Cpus();
+        if (pieces > 64)
+            pieces = 64;
+    }
+
+    struct Reb_Gather_Range whole;
+    whole.jobs = jobs;
+    whole.num_jobs = num_jobs;
+    whole.rows = rows;
+    whole.start = 0;
+    whole.len = len;
+
+    if (pieces == 1) {
+        Run_Gather_Range(&whole);
+        return;
+    }
+
+    struct Reb_Gather_Range *ranges = rebAllocN(
+        struct Reb_Gather_Range, pieces
+    );
+    REBTHR *handles = rebAllocN(REBTHR, pieces);
+    bool *started = rebAllocN(bool, pieces);
+
+    REBLEN per_piece = (len + pieces - 1) / pieces;
+
+    REBLEN t;
+    for (t = 0; t < pieces; ++t) {
+        ranges[t] = whole;
+        ranges[t].start = t * per_piece;
+        if (ranges[t].start > len)
+            ranges[t].start = len;
+        ranges[t].len = len - ranges[t].start;
+        if (ranges[t].len > per_piece)
+            ranges[t].len = per_piece;
+
+        started[t] = false;
+        if (t == 0)
+            continue;  // range 0 runs on this thread
+
+      #ifdef TO_WINDOWS
+        handles[t] = CreateThread(
+            nullptr, 0, &Gather_Thread, &ranges[t], 0, nullptr
+        );
+        started[t] = (handles[t] != nullptr);
+      #else
+        started[t] = (
+            pthread_create(&handles[t], nullptr, &Gather_Thread, &ranges[t])
+            == 0
+        );
+      #endif
+    }
+
+    for (t = 0; t < pieces; ++t) {
+        if (not started[t])
+            Run_Gather_Range(&ranges[t]);
+    }
+
+    for (t = 1; t < pieces; ++t) {
+        if (not started[t])
+            continue;
+      #ifdef TO_WINDOWS
+        WaitForSingleObject(handles[t], INFINITE);
+        CloseHandle(handles[t]);
+      #else
+        pthread_join(handles[t], nullptr);
+      #endif
+    }
+
+    rebFree(started);
+    rebFree(handles);
+    rebFree(ranges);
+}
+
+
+// A new signed 64-bit VECTOR! of `len` elements (integer or decimal), whose
+// data the caller fills in.
+//
+static REBYTE *Init_Vector_Column(RELVAL *out, REBLEN len, bool integral)
+{
+    REBBIN *bin = Make_Binary(len * 8);
+    SET_SERIES_LEN(bin, len * 8);
+    TERM_SERIES(bin);
+    Init_Vector(out, bin, true, integral, 64);
+    return BIN_HEAD(bin);
+}
+
+
+//
+//  Push_Gathered_Column: C
+//
+// Push a new column made of the `rows` of `column` (or its first `len` rows
+// if `rows` is nullptr).  A BLOCK! column is filled in now.  For a VECTOR!
+// the new vector is pushed empty, and `job` is set up to gather it--which
+// the caller must do before anything else can see the vector.
+//
+static bool Push_Gathered_Column(
+    struct Reb_Gather_Job *job,
+    const REBVAL *column,
+    const REBLEN *rows,
+    REBLEN len
+){
+    if (IS_BLOCK(column)) {
+        REBARR *a = Make_Array(len);
+        RELVAL *src = VAL_ARRAY_AT(column);
+        REBSPC *specifier = VAL_SPECIFIER(column);
+        REBLEN i;
+        for (i = 0; i < len; ++i)
+            Derelativize(
+                Alloc_Tail_Array(a),
+                src + (rows ? rows[i] : i),
+                specifier
+            );
+        Init_Block(DS_PUSH(), a);
+        return false;
+    }
+
+    REBYTE wide = VAL_VECTOR_WIDE(column);
+    REBBIN *bin = Make_Binary(len * wide);
+    SET_SERIES_LEN(bin, len * wide);
+    TERM_SERIES(bin);
+    Init_Vector(
+        DS_PUSH(),
+        bin,
+        VAL_VECTOR_SIGN(column),
+        VAL_VECTOR_INTEGRAL(column),
+        VAL_VECTOR_BITSIZE(column)
+    );
+
+    job->src = VAL_VECTOR_HEAD(column);
+    job->step = VAL_VECTOR_STRIDE(column) * wide;
+    job->wide = wide;
+    job->dest = BIN_HEAD(bin);
+    return true;
+}
+
+
+//
+//  Gather_Table: C
+//
+// New table of the `rows` of table array `a`, in that order (or the first
+// `len` rows if `rows` is nullptr).
+//
+REBVAL *Gather_Table(
+    REBVAL *out,
+    REBARR *a,
+    const REBLEN *rows,
+    REBLEN len
+){
+    REBDSP dsp_orig = DSP;
+
+    struct Reb_Gather_Job *jobs = rebAllocN(
+        struct Reb_Gather_Job, TABLE_NUM_COLUMNS(a) + 1  // (may be 0)
+    );
+    REBLEN num_jobs = 0;
+
+    REBLEN col;
+    for (col = 0; col < TABLE_NUM_COLUMNS(a); ++col) {
+        Move_Value(DS_PUSH(), TABLE_NAME(a, col));
+        if (Push_Gathered_Column(
+            &jobs[num_jobs], TABLE_COLUMN(a, col), rows, len
+        )){
+            ++num_jobs;
+        }
+    }
+
+    Gather_Vectors(jobs, num_jobs, rows, len);
+    rebFree(jobs);
+
+    return Init_Table(out, Pop_Table_Array(dsp_orig));
+}
+
+
+//=//// KEYS //////////////////////////////////////////////////////////////=//
+//
+// Sorting, grouping and joining compare the rows of one "key" column.  When
+// the key is a VECTOR! its elements are loaded once into a C array of 64-bit
+// integers or doubles, so the comparisons are on plain C numbers.  A BLOCK!
+// key compares its cells with Cmp_Value(), and hashes them with Hash_Value(),
+// so they match as `=` does (e.g. TEXT! case-insensitively).
+//
+// !!! Unsigned 64-bit elements above the signed range are loaded as negative
+// numbers, and so sort before the others.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+
+struct Reb_Table_Key {
+    int64_t *ints;  // one of these three is used
+    double *decimals;
+    const RELVAL *cells;
+};
+
+
+//
+//  Load_Table_Key: C
+//
+// Set up `key` for the first `len` rows of `column`.  A VECTOR! is loaded as
+// integers if `as_int`, else as decimals (so integer and decimal keys can be
+// compared with each other).
+//
+static void Load_Table_Key(
+    struct Reb_Table_Key *key,
+    const REBVAL *column,
+    bool as_int,
+    REBLEN len
+){
+    key->ints = nullptr;
+    key->decimals = nullptr;
+    key->cells = nullptr;
+
+    if (IS_BLOCK(column)) {
+        key->cells = VAL_ARRAY_AT(column);
+        return;
+    }
+
+    const REBYTE *p = VAL_VECTOR_HEAD(column);
+    REBLEN step = VAL_VECTOR_STRIDE(column) * VAL_VECTOR_WIDE(column);
+    REBYTE wide = VAL_VECTOR_WIDE(column);
+    bool sign = VAL_VECTOR_SIGN(column);
+    bool integral = VAL_VECTOR_INTEGRAL(column);
+
+    if (as_int)
+        key->ints = rebAllocN(int64_t, len + 1);  // (len may be 0)
+    else
+        key->decimals = rebAllocN(double, len + 1);
+
+    REBLEN i;
+    for (i = 0; i < len; ++i, p += step) {
+        int64_t n = 0;
+        double d = 0.0;
+
+        if (not integral) {
+            if (wide == 4) {
+                float f;
+                memcpy(&f, p, 4);
+                d = f;
+            }
+            else
+                memcpy(&d, p, 8);
+        }
+        else switch (wide) {
+          case 1:
+            n = sign ? cast(int8_t, *p) : *p;
+            break;
+
+          case 2: {
+            int16_t i16;
+            uint16_t u16;
+            memcpy(&i16, p, 2);
+            memcpy(&u16, p, 2);
+            n = sign ? i16 : u16;
+            break; }
+
+          case 4: {
+            int32_t i32;
+            uint32_t u32;
+            memcpy(&i32, p, 4);
+            memcpy(&u32, p, 4);
+            n = sign ? i32 : u32;
+            break; }
+
+          default:
+            memcpy(&n, p, 8);
+            break;
+        }
+
+        if (as_int)
+            key->ints[i] = n;
+        else
+            key->decimals[i] = integral ? cast(double, n) : d;
+    }
+}
+
+
+static void Free_Table_Key(struct Reb_Table_Key *key)
+{
+    if (key->ints)
+        rebFree(key->ints);
+    if (key->decimals)
+        rebFree(key->decimals);
+}
+
+
+inline static REBINT Compare_Key_Rows(
+    const struct Reb_Table_Key *key,
+    REBLEN a,
+    REBLEN b
+){
+    if (key->ints)
+        return key->ints[a] < key->ints[b] ? -1 : key->ints[a] > key->ints[b];
+    if (key->decimals)
+        return key->decimals[a] < key->decimals[b]
+            ? -1
+            : key->decimals[a] > key->decimals[b];
+    return Cmp_Value(key->cells + a, key->cells + b, false);
+}
+
+
+inline static bool Key_Rows_Equal(
+    const struct Reb_Table_Key *a_key,
+    REBLEN a,
+    const struct Reb_Table_Key *b_key,
+    REBLEN b
+){
+    if (a_key->ints)
+        return a_key->ints[a] == b_key->ints[b];
+    if (a_key->decimals)
+        return a_key->decimals[a] == b_key->decimals[b];
+    return 0 == Cmp_Value(a_key->cells + a, b_key->cells + b, false);
+}
+
+
+static uint32_t Hash_Key_Row(const struct Reb_Table_Key *key, REBLEN row)
+{
+    uint64_t bits;
+    if (key->ints)
+        bits = cast(uint64_t, key->ints[row]);
+    else if (key->decimals) {
+        double d = key->decimals[row];
+        if (d == 0.0)
+            d = 0.0;  // -0.0 is equal to 0.0, so must hash the same
+        memcpy(&bits, &d, 8);
+    }
+    else
+        return Hash_Value(key->cells + row);
+
+    bits ^= bits >> 33;  // (finalizer of MurmurHash3, to spread the bits)
+    bits *= 0xff51afd7ed558ccdULL;
+    bits ^= bits >> 33;
+    bits *= 0xc4ceb9fe1a85ec53ULL;
+    bits ^= bits >> 33;
+    return cast(uint32_t, bits);
+}
+
+
+// Hash table of rows of a key column, as row + 1 (0 for an empty slot), for
+// finding the first row with a given key.
+//
+struct Reb_Key_Index {
+    REBLEN *slots;
+    REBLEN mask;
+};
+
+static void Init_Key_Index(struct Reb_Key_Index *index, REBLEN len)
+{
+    REBLEN size = 16;
+    while (size < len * 2)  // keep it at most half full
+        size *= 2;
+
+    index->slots = rebAllocN(REBLEN, size);
+    memset(index->slots, 0, sizeof(REBLEN) * size);
+    index->mask = size - 1;
+}
+
+// The slot holding a row of `index_key` equal to row `row` of `key`, or the
+// empty slot where such a row would go.
+//
+static REBLEN *Find_Key_Slot(
+    struct Reb_Key_Index *index,
+    const struct Reb_Table_Key *index_key,
+    const struct Reb_Table_Key *key,
+    REBLEN row
+){
+    REBLEN slot = Hash_Key_Row(key, row) & index->mask;
+    for (; index->slots[slot] != 0; slot = (slot + 1) & index->mask) {
+        if (Key_Rows_Equal(index_key, index->slots[slot] - 1, key, row))
+            break;
+    }
+    return &index->slots[slot];
+}
+
+
+//
+//  Get_Key_Column: C
+//
+// The column of a table named by `name`, failing if there's no such column.
+//
+static REBVAL *Get_Key_Column(REBARR *a, const REBVAL *name)
+{
+    REBINT col = Find_Table_Column(a, name);
+    if (col == -1)
+        fail (name);
+    return TABLE_COLUMN(a, col);
+}
+
+
+//
+//  export table-filter: native [
+//
+//  {TABLE! of the rows of a table for which a mask is true}
+//
+//      return: [any-value!]
+//      table [any-value!]
+//      mask "Non-zero VECTOR! elements (e.g. from VECTOR-MATH), or LOGIC!s"
+//          [any-value!]
+//  ]
+//
+REBNATIVE(table_filter)
+//
+// e.g. `table-filter t vector-math 'greater? t/price 10`
+{
+    TABLE_INCLUDE_PARAMS_OF_TABLE_FILTER;
+
+    REBVAL *mask = ARG(mask);
+    if (not IS_TABLE(ARG(table)))
+        fail (PAR(table));
+    if (not IS_VECTOR(mask) and not IS_BLOCK(mask))
+        fail (PAR(mask));
+
+    REBARR *a = VAL_TABLE_ARRAY(ARG(table));
+    REBLEN len = Table_Num_Rows(a);
+    if (Table_Column_Len(mask) != len)
+        fail ("TABLE-FILTER mask must have an element for each row");
+
+    REBLEN *rows = rebAllocN(REBLEN, len + 1);  // (len may be 0)
+    REBLEN count = 0;
+
+    REBLEN i;
+    if (IS_BLOCK(mask)) {
+        RELVAL *item = VAL_ARRAY_AT(mask);
+        for (i = 0; i < len; ++i, ++item) {
+            if (IS_TRUTHY(item))
+                rows[count++] = i;
+        }
+    }
+    else {
+        struct Reb_Table_Key key;
+        Load_Table_Key(&key, mask, VAL_VECTOR_INTEGRAL(mask), len);
+        for (i = 0; i < len; ++i) {
+            if (key.ints ? key.ints[i] != 0 : key.decimals[i] != 0.0)
+                rows[count++] = i;
+        }
+        Free_Table_Key(&key);
+    }
+
+    Gather_Table(D_OUT, a, rows, count);
+    rebFree(rows);
+    return D_OUT;
+}
+
+
+//
+//  Merge_Passes: C
+//
+// Bottom-up merge sort passes over rows[start..end), merging runs of `width`
+// elements into runs of 2 * `width`, and so on until runs of `limit`.  Runs
+// go back and forth between `rows` and `temp`, and which one ends up with
+// the result depends only on how many passes there are.  (So separate
+// ranges sorted to the same `limit` all end up in the same buffer.)
+//
+// Merging takes from the right run only when its row is strictly before the
+// left run's, so rows with equal keys stay in order (the sort is stable).
+//
+static REBLEN *Merge_Passes(
+    REBLEN *rows,
+    REBLEN *temp,
+    REBLEN start,
+    REBLEN end,
+    REBLEN width,
+    REBLEN limit,
+    const struct Reb_Table_Key *key,
+    bool descending
+){
+    REBLEN *src = rows;
+    REBLEN *dest = temp;
+
+    for (; width < limit; width *= 2) {
+        REBLEN lo;
+        for (lo = start; lo < end; lo += 2 * width) {
+            REBLEN mid = lo + width < end ? lo + width : end;
+            REBLEN hi = mid + width < end ? mid + width : end;
+
+            REBLEN i = lo;
+            REBLEN j = mid;
+            REBLEN k = lo;
+            while (i < mid and j < hi) {
+                REBINT diff = Compare_Key_Rows(key, src[j], src[i]);
+                if (descending ? diff > 0 : diff < 0)
+                    dest[k++] = src[j++];
+                else
+                    dest[k++] = src[i++];
+            }
+            while (i < mid)
+                dest[k++] = src[i++];
+            while (j < hi)
+                dest[k++] = src[j++];
+        }
+
+        REBLEN *swap = src;
+        src = dest;
+        dest = swap;
+    }
+
+    return src;
+}
+
+
+struct Reb_Sort_Range {
+    REBLEN *rows;
+    REBLEN *temp;
+    REBLEN start;
+    REBLEN end;
+    REBLEN limit;
+    const struct Reb_Table_Key *key;
+    bool descending;
+};
+
+static void Run_Sort_Range(struct Reb_Sort_Range *r) {
+    Merge_Passes(
+        r->rows, r->temp, r->start, r->end, 1, r->limit, r->key, r->descending
+    );
+}
+
+#ifdef TO_WINDOWS
+    static DWORD WINAPI Sort_Thread(LPVOID p) {
+        Run_Sort_Range(cast(struct Reb_Sort_Range*, p));
+        return 0;
+    }
+#else
+    static void *Sort_Thread(void *p) {
+        Run_Sort_Range(cast(struct Reb_Sort_Range*, p));
+        return nullptr;
+    }
+#endif
+
+
+//
+//  Sort_Rows: C
+//
+// Put the row numbers 0..len-1 in the order of their keys.  With a VECTOR!
+// key (whose comparisons touch no Rebol state) a big sort is split into a
+// power-of-2 sized range per thread, which are sorted at the same time and
+// then merged on this thread.
+//
+static void Sort_Rows(
+    REBLEN *rows,
+    REBLEN len,
+    const struct Reb_Table_Key *key,
+    bool descending
+){
+    REBLEN *temp = rebAllocN(REBLEN, len + 1);  // (len may be 0)
+
+    REBLEN i;
+    for (i = 0; i < len; ++i)
+        rows[i] = i;
+
+    REBLEN pieces = 1;
+    if (not key->cells and len >= TABLE_THREAD_MIN) {
+        pieces = Num_Cpus();
+        if (pieces > 64)
+            pieces = 64;
+    }
+
+    REBLEN per_piece = 1;  // power of 2, so pieces are runs of later passes
+    while (per_piece * pieces < len)
+        per_piece *= 2;
+
+    if (pieces > 1) {
+        struct Reb_Sort_Range *ranges = rebAllocN(
+            struct Reb_Sort_Range, pieces
+        );
+        REBTHR *handles = rebAllocN(REBTHR, pieces);
+        bool *started = rebAllocN(bool, pieces);
+
+        REBLEN t;
+        for (t = 0; t < pieces; ++t) {
+            ranges[t].rows = rows;
+            ranges[t].temp = temp;
+            ranges[t].start = t * per_piece < len ? t * per_piece : len;
+            ranges[t].end = ranges[t].start + per_piece < len
+                ? ranges[t].start + per_piece
+                : len;
+            ranges[t].limit = per_piece;
+            ranges[t].key = key;
+            ranges[t].descending = descending;
+
+            started[t] = false;
+            if (t == 0)
+                continue;  // range 0 runs on this thread
+
+          #ifdef TO_WINDOWS
+            handles[t] = CreateThread(
+                nullptr, 0, &Sort_Thread, &ranges[t], 0, nullptr
+            );
+            started[t] = (handles[t] != nullptr);
+          #else
+            started[t] = (
+                pthread_create(&handles[t], nullptr, &Sort_Thread, &ranges[t])
+                == 0
+            );
+          #endif
+        }
+
+        for (t = 0; t < pieces; ++t) {
+            if (not started[t])
+                Run_Sort_Range(&ranges[t]);
+        }
+
+        for (t = 1; t < pieces; ++t) {
+            if (not started[t])
+                continue;
+          #ifdef TO_WINDOWS
+            WaitForSingleObject(handles[t], INFINITE);
+            CloseHandle(handles[t]);
+          #else
+            pthread_join(handles[t], nullptr);
+          #endif
+        }
+
+        rebFree(started);
+        rebFree(handles);
+        rebFree(ranges);
+    }
+    else
+        per_piece = 1;  // do all the passes here
+
+    // Each range did the same number of passes, so they all ended up in the
+    // same buffer.  Merge them from there.
+    //
+    REBLEN *sorted = rows;
+    REBLEN width;
+    for (width = 1; width < per_piece; width *= 2)
+        sorted = (sorted == rows) ? temp : rows;
+    REBLEN *other = (sorted == rows) ? temp : rows;
+
+    REBLEN *result = Merge_Passes(
+        sorted, other, 0, len, per_piece, len, key, descending
+    );
+    if (result != rows)
+        memcpy(rows, result, sizeof(REBLEN) * len);
+
+    rebFree(temp);
+}
+
+
+//
+//  export table-sort: native [
+//
+//  {TABLE! of a table's rows, in the order of one of its columns}
+//
+//      return: [any-value!]
+//      table [any-value!]
+//      column "Column to sort by (rows with equal keys stay in order)"
+//          [word!]
+//      /descending "Largest first"
+//  ]
+//
+REBNATIVE(table_sort)
+{
+    TABLE_INCLUDE_PARAMS_OF_TABLE_SORT;
+
+    if (not IS_TABLE(ARG(table)))
+        fail (PAR(table));
+
+    REBARR *a = VAL_TABLE_ARRAY(ARG(table));
+    REBLEN len = Table_Num_Rows(a);
+    REBVAL *column = Get_Key_Column(a, ARG(column));
+
+    struct Reb_Table_Key key;
+    Load_Table_Key(
+        &key, column, IS_VECTOR(column) and VAL_VECTOR_INTEGRAL(column), len
+    );
+
+    REBLEN *rows = rebAllocN(REBLEN, len + 1);  // (len may be 0)
+    Sort_Rows(rows, len, &key, did REF(descending));
+    Free_Table_Key(&key);
+
+    Gather_Table(D_OUT, a, rows, len);
+    rebFree(rows);
+    return D_OUT;
+}
+
+
+//
+//  export table-group: native [
+//
+//  {TABLE! with a row for each distinct value in a column of a table}
+//
+//      return: "The key column, then COUNT, then any /SUM columns"
+//          [any-value!]
+//      table [any-value!]
+//      column "Name of the column to group by (groups are in order seen)"
+//          [word!]
+//      /sum "Add a column with the total of each of these for each group"
+//          [block!]
+//  ]
+//
+REBNATIVE(table_group)
+{
+    TABLE_INCLUDE_PARAMS_OF_TABLE_GROUP;
+
+    if (not IS_TABLE(ARG(table)))
+        fail (PAR(table));
+
+    REBARR *a = VAL_TABLE_ARRAY(ARG(table));
+    REBLEN len = Table_Num_Rows(a);
+    REBVAL *column = Get_Key_Column(a, ARG(column));
+
+    struct Reb_Table_Key key;
+    Load_Table_Key(
+        &key, column, IS_VECTOR(column) and VAL_VECTOR_INTEGRAL(column), len
+    );
+
+    // Give each row the number of its group, which is numbered by the first
+    // row with that key.
+    //
+    REBLEN *groups = rebAllocN(REBLEN, len + 1);  // (len may be 0)
+    REBLEN *firsts = rebAllocN(REBLEN, len + 1);  // first row of each group
+    REBLEN num_groups = 0;
+
+    struct Reb_Key_Index index;
+    Init_Key_Index(&index, len);
+
+    REBLEN row;
+    for (row = 0; row < len; ++row) {
+        REBLEN *slot = Find_Key_Slot(&index, &key, &key, row);
+        if (*slot == 0) {
+            *slot = row + 1;
+            firsts[num_groups] = row;
+            groups[row] = num_groups++;
+        }
+        else
+            groups[row] = groups[*slot - 1];
+    }
+
+    rebFree(index.slots);
+    Free_Table_Key(&key);
+
+    REBDSP dsp_orig = DSP;
+
+    struct Reb_Gather_Job job;
+    Init_Word(DS_PUSH(), VAL_WORD_SPELLING(ARG(column)));
+    if (Push_Gathered_Column(&job, column, firsts, num_groups))
+        Gather_Vectors(&job, 1, firsts, num_groups);
+
+    Init_Word(DS_PUSH(), Intern_UTF8_Managed(cb_cast("count"), 5));
+    int64_t *counts = cast(int64_t*,
+        Init_Vector_Column(DS_PUSH(), num_groups, true)
+    );
+    memset(counts, 0, sizeof(int64_t) * num_groups);
+    for (row = 0; row < len; ++row)
+        ++counts[groups[row]];
+
+    // Totals go a column at a time, over the packed elements of the vector.
+    //
+    if (REF(sum)) {
+        RELVAL *item = VAL_ARRAY_AT(ARG(sum));
+        for (; NOT_END(item); ++item) {
+            if (not IS_WORD(item))
+                fail (Error_Bad_Value_Core(item, VAL_SPECIFIER(ARG(sum))));
+
+            DECLARE_LOCAL (name);
+            Init_Word(name, VAL_WORD_SPELLING(item));
+            REBVAL *summed = Get_Key_Column(a, name);
+            if (not IS_VECTOR(summed))
+                fail (summed);
+
+            bool integral = VAL_VECTOR_INTEGRAL(summed);
+            struct Reb_Table_Key values;
+            Load_Table_Key(&values, summed, integral, len);
+
+            Move_Value(DS_PUSH(), name);
+            REBYTE *data = Init_Vector_Column(DS_PUSH(), num_groups, integral);
+            if (integral) {
+                int64_t *totals = cast(int64_t*, data);
+                memset(totals, 0, sizeof(int64_t) * num_groups);
+                for (row = 0; row < len; ++row) {
+                    int64_t *total = &totals[groups[row]];
+                    if (REB_I64_ADD_OF(*total, values.ints[row], total))
+                        fail (Error_Overflow_Raw());
+                }
+            }
+            else {
+                double *totals = cast(double*, data);
+                REBLEN g;
+                for (g = 0; g < num_groups; ++g)
+                    totals[g] = 0.0;
+                for (row = 0; row < len; ++row)
+                    totals[groups[row]] += values.decimals[row];
+            }
+
+            Free_Table_Key(&values);
+        }
+    }
+
+    rebFree(firsts);
+    rebFree(groups);
+
+    return Init_Table(D_OUT, Pop_Table_Array(dsp_orig));
+}
+
+
+//
+//  export table-join: native [
+//
+//  {TABLE! of the pairs of rows of two tables which agree on a key column}
+//
+//      return: "LEFT's columns, then RIGHT's columns besides the key"
+//          [any-value!]
+//      left [any-value!]
+//      right [any-value!]
+//      column "Name of the key column, which both tables must have"
+//          [word!]
+//  ]
+//
+REBNATIVE(table_join)
+//
+// This is an "inner join": a LEFT row with no match in RIGHT is left out, and
+// one with several matches gives several rows.  The rows come in LEFT's
+// order, and for each LEFT row its matches come in RIGHT's order.  The other
+// column names of the two tables must be distinct.
+{
+    TABLE_INCLUDE_PARAMS_OF_TABLE_JOIN;
+
+    if (not IS_TABLE(ARG(left)))
+        fail (PAR(left));
+    if (not IS_TABLE(ARG(right)))
+        fail (PAR(right));
+
+    REBARR *left = VAL_TABLE_ARRAY(ARG(left));
+    REBARR *right = VAL_TABLE_ARRAY(ARG(right));
+    REBLEN left_len = Table_Num_Rows(left);
+    REBLEN right_len = Table_Num_Rows(right);
+    REBVAL *left_column = Get_Key_Column(left, ARG(column));
+    REBVAL *right_column = Get_Key_Column(right, ARG(column));
+
+    if (IS_VECTOR(left_column) != IS_VECTOR(right_column))
+        fail ("TABLE-JOIN key columns must both be VECTOR! or both BLOCK!");
+
+    bool as_int = IS_VECTOR(left_column)
+        and VAL_VECTOR_INTEGRAL(left_column)
+        and VAL_VECTOR_INTEGRAL(right_column);
+
+    struct Reb_Table_Key left_key;
+    Load_Table_Key(&left_key, left_column, as_int, left_len);
+    struct Reb_Table_Key right_key;
+    Load_Table_Key(&right_key, right_column, as_int, right_len);
+
+    // Index RIGHT's rows by key.  The slot holds the first row with the key,
+    // and `nexts` chains from each row to the next one with the same key
+    // (going backwards makes the chains come out in order).
+    //
+    struct Reb_Key_Index index;
+    Init_Key_Index(&index, right_len);
+    REBLEN *nexts = rebAllocN(REBLEN, right_len + 1);  // (len may be 0)
+
+    REBLEN r = right_len;
+    while (r != 0) {
+        --r;
+        REBLEN *slot = Find_Key_Slot(&index, &right_key, &right_key, r);
+        nexts[r] = *slot;  // 0 if none, else row + 1
+        *slot = r + 1;
+    }
+
+    // Count the matches first, so the row lists are made at their size.
+    //
+    REBLEN *matches = rebAllocN(REBLEN, left_len + 1);  // first match + 1
+    REBLEN count = 0;
+
+    REBLEN l;
+    for (l = 0; l < left_len; ++l) {
+        REBLEN *slot = Find_Key_Slot(&index, &right_key, &left_key, l);
+        matches[l] = *slot;
+        for (r = *slot; r != 0; r = nexts[r - 1])
+            ++count;
+    }
+
+    REBLEN *left_rows = rebAllocN(REBLEN, count + 1);  // (count may be 0)
+    REBLEN *right_rows = rebAllocN(REBLEN, count + 1);
+
+    REBLEN n = 0;
+    for (l = 0; l < left_len; ++l) {
+        for (r = matches[l]; r != 0; r = nexts[r - 1]) {
+            left_rows[n] = l;
+            right_rows[n] = r - 1;
+            ++n;
+        }
+    }
+    assert(n == count);
+
+    rebFree(matches);
+    rebFree(nexts);
+    rebFree(index.slots);
+    Free_Table_Key(&right_key);
+    Free_Table_Key(&left_key);
+
+    REBDSP dsp_orig = DSP;
+
+    REBLEN num_columns = TABLE_NUM_COLUMNS(left) + TABLE_NUM_COLUMNS(right);
+    struct Reb_Gather_Job *jobs = rebAllocN(
+        struct Reb_Gather_Job, num_columns
+    );
+    REBLEN num_left_jobs = 0;
+    REBLEN num_right_jobs = 0;
+
+    REBLEN col;
+    for (col = 0; col < TABLE_NUM_COLUMNS(left); ++col) {
+        Move_Value(DS_PUSH(), TABLE_NAME(left, col));
+        if (Push_Gathered_Column(
+            &jobs[num_left_jobs], TABLE_COLUMN(left, col), left_rows, count
+        )){
+            ++num_left_jobs;
+        }
+    }
+
+    for (col = 0; col < TABLE_NUM_COLUMNS(right); ++col) {
+        if (TABLE_COLUMN(right, col) == right_column)
+            continue;
+
+        Move_Value(DS_PUSH(), TABLE_NAME(right, col));
+        if (Push_Gathered_Column(
+            &jobs[num_left_jobs + num_right_jobs],
+            TABLE_COLUMN(right, col),
+            right_rows,
+            count
+        )){
+            ++num_right_jobs;
+        }
+    }
+
+    Gather_Vectors(jobs, num_left_jobs, left_rows, count);
+    Gather_Vectors(jobs + num_left_jobs, num_right_jobs, right_rows, count);
+
+    rebFree(jobs);
+    rebFree(right_rows);
+    rebFree(left_rows);
+
+    return Init_Table(D_OUT, Pop_Table_Array(dsp_orig));
+}
@@ -0,0 +1,92 @@
+//
+//  File: %sys-table.h
+//  Summary: "Table Datatype header file"
+//  Section: datatypes
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// The cell for a TABLE! points to an array of `name column` pairs.  Each
+// name is a WORD!, and each column is either a VECTOR! (for numbers, which
+// are then stored packed at 8 bytes or less apiece) or a BLOCK! of values
+// (typically TEXT!).  All the columns have the same length, which is the
+// number of rows in the table.
+//
+// Tables are not modified by the natives that work on them--a filter, sort,
+// grouping or join makes a new table with new columns.  But a column picked
+// out of a table is the table's own VECTOR! or BLOCK!, so code which changes
+// a column's length can break the table; the natives check the lengths still
+// agree before they trust them.
+//
+//=//// NOTES /////////////////////////////////////////////////////////////=//
+//
+// * See %extensions/table/README.md
+//
+
+extern REBTYP *EG_Table_Type;
+
+#define VAL_TABLE_ARRAY(v) \
+    ARR(PAYLOAD(Any, (v)).first.node)
+
+inline static bool IS_TABLE(const RELVAL *v) {  // QUOTED! doesn't count
+    return IS_CUSTOM(v) and CELL_CUSTOM_TYPE(v) == EG_Table_Type;
+}
+
+#define TABLE_NUM_COLUMNS(a) \
+    (ARR_LEN(a) / 2)
+
+#define TABLE_NAME(a,n) \
+    KNOWN(ARR_AT((a), (n) * 2))
+
+#define TABLE_COLUMN(a,n) \
+    KNOWN(ARR_AT((a), (n) * 2 + 1))
+
+inline static REBVAL *Init_Table(RELVAL *out, REBARR *a) {
+    assert(ARR_LEN(a) % 2 == 0);
+    RESET_CUSTOM_CELL(out, EG_Table_Type, CELL_FLAG_FIRST_IS_NODE);
+    INIT_VAL_NODE(out, a);
+    return KNOWN(out);
+}
+
+
+// Helpers shared by the generics in %t-table.c and the natives in
+// %mod-table.c
+//
+extern REBLEN Table_Column_Len(const RELVAL *column);
+extern REBLEN Table_Num_Rows(REBARR *a);
+extern REBINT Find_Table_Column(REBARR *a, const REBVAL *name);
+extern REBARR *Pop_Table_Array(REBDSP dsp_orig);
+extern REBVAL *Gather_Table(
+    REBVAL *out,
+    REBARR *a,
+    const REBLEN *rows,
+    REBLEN len
+);
+
+#define Copy_Table(out,a) \
+    Gather_Table((out), (a), nullptr, Table_Num_Rows(a))
+
+
+// !!! These hooks allow the REB_TABLE cell type to dispatch to code in the
+// TABLE! extension if it is loaded.
+//
+extern REBINT CT_Table(const REBCEL *a, const REBCEL *b, REBINT mode);
+extern REB_R MAKE_Table(REBVAL *out, enum Reb_Kind kind, const REBVAL *opt_parent, const REBVAL *arg);
+extern REB_R TO_Table(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg);
+extern void MF_Table(REB_MOLD *mo, const REBCEL *v, bool form);
+extern REBTYPE(Table);
+extern REB_R PD_Table(REBPVS *pvs, const REBVAL *picker, const REBVAL *opt_setval);
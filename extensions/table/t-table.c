@@ -0,0 +1,349 @@
+//
+//  File: %t-table.c
+//  Summary: "table datatype"
+//  Section: datatypes
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+
+#include "sys-core.h"
+
+#include "sys-vector.h"
+#include "sys-table.h"
+
+
+//
+//  Table_Column_Len: C
+//
+REBLEN Table_Column_Len(const RELVAL *column)
+{
+    if (IS_VECTOR(column))
+        return VAL_VECTOR_LEN_AT(column);
+    return VAL_LEN_AT(column);
+}
+
+
+//
+//  Table_Num_Rows: C
+//
+// The columns are the table's own series, which code holding one of them
+// could have changed the length of.  So this checks they still agree.
+//
+REBLEN Table_Num_Rows(REBARR *a)
+{
+    if (TABLE_NUM_COLUMNS(a) == 0)
+        return 0;
+
+    REBLEN rows = Table_Column_Len(TABLE_COLUMN(a, 0));
+
+    REBLEN n;
+    for (n = 1; n < TABLE_NUM_COLUMNS(a); ++n) {
+        if (Table_Column_Len(TABLE_COLUMN(a, n)) != rows)
+            fail ("TABLE! columns no longer have the same length");
+    }
+    return rows;
+}
+
+
+//
+//  Find_Table_Column: C
+//
+// Returns the 0-based column number, or -1 if there's no column by the name.
+//
+REBINT Find_Table_Column(REBARR *a, const REBVAL *name)
+{
+    REBSTR *canon = VAL_WORD_CANON(name);
+
+    REBLEN n;
+    for (n = 0; n < TABLE_NUM_COLUMNS(a); ++n) {
+        if (VAL_WORD_CANON(TABLE_NAME(a, n)) == canon)
+            return n;
+    }
+    return -1;
+}
+
+
+//
+//  Pop_Table_Array: C
+//
+// Make the array for a table out of `name column` pairs pushed to the stack
+// since `dsp_orig`, checking the names are distinct WORD!s and the columns
+// are VECTOR!s or BLOCK!s of the same length.
+//
+REBARR *Pop_Table_Array(REBDSP dsp_orig)
+{
+    assert((DSP - dsp_orig) % 2 == 0);
+
+    REBLEN rows = 0;
+
+    REBDSP dsp;
+    for (dsp = dsp_orig + 1; dsp <= DSP; dsp += 2) {
+        REBVAL *name = DS_AT(dsp);
+        REBVAL *column = DS_AT(dsp + 1);
+        assert(IS_WORD(name));
+
+        if (not IS_VECTOR(column) and not IS_BLOCK(column))
+            fail (column);
+
+        REBLEN len = Table_Column_Len(column);
+        if (dsp == dsp_orig + 1)
+            rows = len;
+        else if (len != rows)
+            fail ("TABLE! columns must all have the same length");
+
+        REBDSP other;
+        for (other = dsp_orig + 1; other < dsp; other += 2) {
+            if (VAL_WORD_CANON(DS_AT(other)) == VAL_WORD_CANON(name))
+                fail (Error_Dup_Vars_Raw(name));
+        }
+
+        SET_CELL_FLAG(name, NEWLINE_BEFORE);  // mold a column to a line
+    }
+
+    return Pop_Stack_Values_Core(dsp_orig, NODE_FLAG_MANAGED);
+}
+
+
+//
+//  TO_Table: C
+//
+// A block of `name column` pairs, e.g. as DECODE-CSV/COLUMNS/HEADER gives:
+//
+//     to table! ["x" make vector! [integer! 64 [1 2]] "tag" ["a" "b"]]
+//
+// Names may be TEXT! or any kind of word.  BLOCK! columns are copied, while
+// a VECTOR! column is used as is (so the table shares its data).
+//
+REB_R TO_Table(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg)
+{
+    if (IS_TABLE(arg))
+        return Copy_Table(out, VAL_TABLE_ARRAY(arg));
+
+    if (not IS_BLOCK(arg) or VAL_LEN_AT(arg) % 2 != 0)
+        fail (Error_Bad_Make(kind, arg));
+
+    REBDSP dsp_orig = DSP;
+
+    RELVAL *item = VAL_ARRAY_AT(arg);
+    for (; NOT_END(item); item += 2) {
+        RELVAL *column = item + 1;
+
+        if (ANY_WORD(item))
+            Init_Word(DS_PUSH(), VAL_WORD_SPELLING(item));
+        else if (IS_TEXT(item)) {
+            REBSIZ utf8_size;
+            const REBYTE *utf8 = VAL_UTF8_AT(&utf8_size, item);
+            Init_Word(DS_PUSH(), Intern_UTF8_Managed(utf8, utf8_size));
+        }
+        else
+            fail (Error_Bad_Make(kind, arg));
+
+        if (IS_BLOCK(column))
+            Init_Block(
+                DS_PUSH(),
+                Copy_Array_At_Shallow(
+                    VAL_ARRAY(column),
+                    VAL_INDEX(column),
+                    Derive_Specifier(VAL_SPECIFIER(arg), column)
+                )
+            );
+        else
+            Derelativize(DS_PUSH(), column, VAL_SPECIFIER(arg));
+    }
+
+    return Init_Table(out, Pop_Table_Array(dsp_orig));
+}
+
+
+//
+//  MAKE_Table: C
+//
+REB_R MAKE_Table(
+    REBVAL *out,
+    enum Reb_Kind kind,
+    const REBVAL *opt_parent,
+    const REBVAL *arg
+){
+    if (opt_parent)
+        fail (Error_Bad_Make_Parent(kind, opt_parent));
+
+    return TO_Table(out, kind, arg);
+}
+
+
+//
+//  CT_Table: C
+//
+REBINT CT_Table(const REBCEL *a, const REBCEL *b, REBINT mode)
+{
+    if (mode < 0)
+        return -1;  // tables have no order
+
+    REBARR *a_array = VAL_TABLE_ARRAY(a);
+    REBARR *b_array = VAL_TABLE_ARRAY(b);
+    if (TABLE_NUM_COLUMNS(a_array) != TABLE_NUM_COLUMNS(b_array))
+        return 0;
+
+    REBLEN n;
+    for (n = 0; n < TABLE_NUM_COLUMNS(a_array); ++n) {
+        REBVAL *a_name = TABLE_NAME(a_array, n);
+        REBVAL *b_name = TABLE_NAME(b_array, n);
+        if (0 != Cmp_Value(a_name, b_name, mode == 1))
+            return 0;
+
+        REBVAL *a_column = TABLE_COLUMN(a_array, n);
+        REBVAL *b_column = TABLE_COLUMN(b_array, n);
+        if (IS_VECTOR(a_column) != IS_VECTOR(b_column))
+            return 0;
+
+        if (IS_VECTOR(a_column)) {  // Cmp_Value() doesn't do CUSTOM! types
+            if (not CT_Vector(a_column, b_column, mode))
+                return 0;
+        }
+        else if (0 != Cmp_Array(a_column, b_column, mode == 1))
+            return 0;
+    }
+    return 1;
+}
+
+
+//
+//  Pick_Table_Row: C
+//
+// Row N of a table as a BLOCK! of its values, in column order.
+//
+static REBVAL *Pick_Table_Row(REBVAL *out, REBARR *a, REBLEN n)
+{
+    REBDSP dsp_orig = DSP;
+
+    REBLEN col;
+    for (col = 0; col < TABLE_NUM_COLUMNS(a); ++col) {
+        REBVAL *column = TABLE_COLUMN(a, col);
+        if (IS_VECTOR(column))
+            Get_Vector_At(DS_PUSH(), column, n);
+        else
+            Derelativize(
+                DS_PUSH(),
+                ARR_AT(VAL_ARRAY(column), VAL_INDEX(column) + n),
+                VAL_SPECIFIER(column)
+            );
+    }
+
+    return Init_Block(out, Pop_Stack_Values(dsp_orig));
+}
+
+
+//
+//  PD_Table: C
+//
+// `table/name` is the column of that name, and `table/3` is the third row
+// as a BLOCK!.  Tables can't be changed through SET-PATH!.
+//
+REB_R PD_Table(
+    REBPVS *pvs,
+    const REBVAL *picker,
+    const REBVAL *opt_setval
+){
+    if (opt_setval)
+        return R_UNHANDLED;
+
+    REBARR *a = VAL_TABLE_ARRAY(pvs->out);
+
+    if (IS_WORD(picker)) {
+        REBINT col = Find_Table_Column(a, picker);
+        if (col == -1)
+            return R_UNHANDLED;
+        return Move_Value(pvs->out, TABLE_COLUMN(a, col));
+    }
+
+    if (IS_INTEGER(picker)) {
+        REBINT n = VAL_INT32(picker);
+        if (n <= 0 or cast(REBLEN, n) > Table_Num_Rows(a))
+            return Init_Nulled(pvs->out);
+        return Pick_Table_Row(pvs->out, a, n - 1);
+    }
+
+    return R_UNHANDLED;
+}
+
+
+//
+//  REBTYPE: C
+//
+REBTYPE(Table)
+{
+    REBVAL *v = D_ARG(1);
+    REBARR *a = VAL_TABLE_ARRAY(v);
+
+    switch (VAL_WORD_SYM(verb)) {
+      case SYM_REFLECT: {
+        INCLUDE_PARAMS_OF_REFLECT;
+        UNUSED(ARG(value));  // same as `v`
+
+        REBDSP dsp_orig = DSP;
+        REBLEN col;
+
+        REBSYM property = VAL_WORD_SYM(ARG(property));
+        switch (property) {
+          case SYM_LENGTH:
+            return Init_Integer(D_OUT, Table_Num_Rows(a));
+
+          case SYM_WORDS:
+            for (col = 0; col < TABLE_NUM_COLUMNS(a); ++col)
+                Init_Word(DS_PUSH(), VAL_WORD_SPELLING(TABLE_NAME(a, col)));
+            return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+
+          case SYM_VALUES:
+            for (col = 0; col < TABLE_NUM_COLUMNS(a); ++col)
+                Move_Value(DS_PUSH(), TABLE_COLUMN(a, col));
+            return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+
+          default:
+            break;
+        }
+
+        break; }
+
+      case SYM_COPY: {
+        INCLUDE_PARAMS_OF_COPY;
+        UNUSED(PAR(value));  // same as `v`
+
+        if (REF(part) or REF(deep) or REF(types))
+            fail (Error_Bad_Refines_Raw());
+
+        return Copy_Table(D_OUT, a); }
+
+      default:
+        break;
+    }
+
+    return R_UNHANDLED;
+}
+
+
+//
+//  MF_Table: C
+//
+void MF_Table(REB_MOLD *mo, const REBCEL *v, bool form)
+{
+    UNUSED(form);
+
+    Pre_Mold(mo, v);
+    Mold_Array_At(mo, VAL_TABLE_ARRAY(v), 0, "[]");
+    End_Mold(mo);
+}
@@ -0,0 +1,15 @@
+REBOL []
+
+name: 'Task
+source: %task/mod-task.c
+includes: [
+    %prep/extensions/task
+]
+
+; The core must be built with REB_THREAD_INSTANCES (e.g. via `definitions:`
+; in the config) or %mod-task.c will refuse to compile.  Windows threads
+; come from kernel32, which is linked by default.
+;
+libraries: try if system-config/os-base <> 'Windows [
+    [%pthread]
+]
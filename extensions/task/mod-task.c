@@ -0,0 +1,687 @@
+//
+//  File: %mod-task.c
+//  Summary: "Worker threads running separate interpreters, with messages"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2019 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// SPAWN starts an OS thread which calls rebStartup() for an interpreter of
+// its own (see REB_THREAD_INSTANCES in %reb-config.h), runs the code it was
+// given, and shuts down.  The only thing shared between the instances is
+// the task table in this file, guarded by one mutex.
+//
+// Booting and shutting down still touch state outside the instance (device
+// structs are statics linked into each instance's list, extensions have
+// globals of their own), so tasks take turns at it under a second mutex.
+// The interpreter that first loaded the extension booted before any task,
+// but once this extension is loaded, LOAD-EXTENSION takes that lock too.
+//
+// A task that ends without FINISH-TASK of its children waits for them to end
+// and frees them.  So does the interpreter that loaded the extension, when
+// it shuts down (see Dev_Task).  A child blocked in `receive _` gets null
+// once its spawner has ended, so it can finish.
+//
+// No REBVAL or series can cross over, since each instance allocates from
+// its own pools and is swept by its own GC.  So a message is copied out to
+// malloc()'d memory by the sender and rebuilt by the receiver:
+//
+// * BINARY! is copied as its raw bytes and comes back as a BINARY!.
+// * Anything else is sent as its MOLD/ALL and is scanned on arrival, giving
+//   an unbound value just like LOAD would.  Values that don't survive that
+//   round trip (ACTION!, HANDLE!, PORT!...) can't be sent meaningfully.
+//
+// !!! A thread is started per task instead of taking one from a pool.  The
+// cost of starting a thread is small next to booting an interpreter on it,
+// so pooling would only pay off if instances could be reused too.
+//
+
+#if !defined(REB_THREAD_INSTANCES)
+    #error "Task extension requires core built with REB_THREAD_INSTANCES"
+#endif
+
+#ifdef TO_WINDOWS
+    #define WIN32_LEAN_AND_MEAN  // trim down the Win32 headers
+    #include <windows.h>
+    #undef IS_ERROR  // winerror.h defines, Rebol has a different meaning
+#else
+    #include <pthread.h>
+#endif
+
+#include "sys-core.h"
+
+#include "tmp-mod-task.h"
+
+
+DECLARE_EXT_COLLATE(Task);  // so tasks can load the extension themselves
+
+
+#ifdef TO_WINDOWS
+    static SRWLOCK Task_Mutex = SRWLOCK_INIT;
+    static CONDITION_VARIABLE Task_Cond = CONDITION_VARIABLE_INIT;
+    static SRWLOCK Boot_Mutex = SRWLOCK_INIT;
+
+    #define Lock_Tasks() AcquireSRWLockExclusive(&Task_Mutex)
+    #define Unlock_Tasks() ReleaseSRWLockExclusive(&Task_Mutex)
+    #define Wait_Tasks() \
+        SleepConditionVariableSRW(&Task_Cond, &Task_Mutex, INFINITE, 0)
+    #define Wake_Tasks() WakeAllConditionVariable(&Task_Cond)
+
+    #define Lock_Boot() AcquireSRWLockExclusive(&Boot_Mutex)
+    #define Unlock_Boot() ReleaseSRWLockExclusive(&Boot_Mutex)
+
+    typedef HANDLE REBTHR;
+#else
+    static pthread_mutex_t Task_Mutex = PTHREAD_MUTEX_INITIALIZER;
+    static pthread_cond_t Task_Cond = PTHREAD_COND_INITIALIZER;
+    static pthread_mutex_t Boot_Mutex = PTHREAD_MUTEX_INITIALIZER;
+
+    #define Lock_Tasks() pthread_mutex_lock(&Task_Mutex)
+    #define Unlock_Tasks() pthread_mutex_unlock(&Task_Mutex)
+    #define Wait_Tasks() pthread_cond_wait(&Task_Cond, &Task_Mutex)
+    #define Wake_Tasks() pthread_cond_broadcast(&Task_Cond)
+
+    #define Lock_Boot() pthread_mutex_lock(&Boot_Mutex)
+    #define Unlock_Boot() pthread_mutex_unlock(&Boot_Mutex)
+
+    typedef pthread_t REBTHR;
+#endif
+
+
+struct Reb_Task_Message {
+    struct Reb_Task_Message *next;
+    bool is_binary;  // data is BINARY! content, else UTF-8 of a MOLD/ALL
+    size_t size;
+    REBYTE data[1];  // allocated to hold `size` bytes
+};
+
+struct Reb_Task_Queue {
+    struct Reb_Task_Message *head;
+    struct Reb_Task_Message *tail;
+};
+
+struct Reb_Task {
+    struct Reb_Task *next;  // in Task_List
+    REBINT id;
+    struct Reb_Task *parent;  // nullptr if spawned outside of any task
+
+    REBTHR thread;
+
+    REBYTE *code;  // UTF-8 source, freed by the task once it's scanned
+    size_t code_size;
+
+    struct Reb_Task_Queue inbox;  // from the parent to the task
+    struct Reb_Task_Queue outbox;  // from the task to the parent
+
+    bool finished;
+    bool orphaned;  // the spawner ended, so nothing more comes in the inbox
+    char *error;  // FORM of an error the code failed with, or nullptr
+};
+
+// Process-wide, only touched with Task_Mutex held.
+//
+static struct Reb_Task *Task_List = nullptr;
+static REBINT Task_Next_Id = 1;
+
+// Each interpreter instance knows which task (if any) it is running.
+//
+static REB_INSTANCE_VAR struct Reb_Task *Current_Task = nullptr;
+
+
+static void Enqueue_Message(
+    struct Reb_Task_Queue *q,
+    struct Reb_Task_Message *msg
+){
+    msg->next = nullptr;
+    if (q->tail)
+        q->tail->next = msg;
+    else
+        q->head = msg;
+    q->tail = msg;
+}
+
+
+static struct Reb_Task_Message *Dequeue_Message(struct Reb_Task_Queue *q)
+{
+    struct Reb_Task_Message *msg = q->head;
+    if (msg) {
+        q->head = msg->next;
+        if (not q->head)
+            q->tail = nullptr;
+    }
+    return msg;
+}
+
+
+static void Free_Queue(struct Reb_Task_Queue *q)
+{
+    struct Reb_Task_Message *msg;
+    while ((msg = Dequeue_Message(q)))
+        free(msg);
+}
+
+
+//
+//  Make_Message: C
+//
+// Copy a value out of this instance's heap.  The molding is done before the
+// message is allocated, so a failure during MOLD can't leak it.
+//
+static struct Reb_Task_Message *Make_Message(const REBVAL *v)
+{
+    struct Reb_Task_Message *msg;
+
+    if (IS_BINARY(v)) {
+        size_t size = VAL_LEN_AT(v);
+        msg = cast(struct Reb_Task_Message*,
+            malloc(sizeof(struct Reb_Task_Message) + size)
+        );
+        if (not msg)
+            fail (Error_No_Memory(size));
+        msg->is_binary = true;
+        msg->size = size;
+        memcpy(msg->data, VAL_BIN_AT(v), size);
+        return msg;
+    }
+
+    DECLARE_MOLD (mo);
+    SET_MOLD_FLAG(mo, MOLD_FLAG_ALL);
+    Push_Mold(mo);
+    Mold_Value(mo, v);
+
+    size_t size = STR_SIZE(mo->series) - mo->offset;
+    msg = cast(struct Reb_Task_Message*,
+        malloc(sizeof(struct Reb_Task_Message) + size)
+    );
+    if (not msg) {
+        Drop_Mold(mo);
+        fail (Error_No_Memory(size));
+    }
+    msg->is_binary = false;
+    msg->size = size;
+    memcpy(msg->data, BIN_AT(SER(mo->series), mo->offset), size);
+    Drop_Mold(mo);
+    return msg;
+}
+
+
+//
+//  Init_From_Message: C
+//
+// Rebuild a message's value in this instance's heap.  The message is freed
+// first, so a scanning failure won't leak it.
+//
+static REBVAL *Init_From_Message(REBVAL *out, struct Reb_Task_Message *msg)
+{
+    if (msg->is_binary) {
+        REBSER *bin = Copy_Bytes(msg->data, cast(REBINT, msg->size));
+        free(msg);
+        return Init_Binary(out, bin);
+    }
+
+    REBSTR *text = Make_Sized_String_UTF8(cs_cast(msg->data), msg->size);
+    free(msg);
+
+    DECLARE_LOCAL (temp);
+    Init_Text(temp, text);
+    PUSH_GC_GUARD(temp);
+
+    REBSIZ utf8_size;
+    const REBYTE *utf8 = VAL_UTF8_AT(&utf8_size, temp);
+    REBARR *a = Scan_UTF8_Managed(Canon(SYM___ANONYMOUS__), utf8, utf8_size);
+
+    DROP_GC_GUARD(temp);
+
+    if (ARR_LEN(a) != 1)
+        fail ("Task message did not scan back as a single value");
+    return Derelativize(out, ARR_HEAD(a), SPECIFIED);
+}
+
+
+//
+//  Find_Task: C
+//
+// Must be called with Task_Mutex held.
+//
+static struct Reb_Task *Find_Task(REBINT id)
+{
+    struct Reb_Task *task = Task_List;
+    for (; task; task = task->next) {
+        if (task->id == id)
+            return task;
+    }
+    return nullptr;
+}
+
+
+//
+//  Find_Child_Task_May_Fail: C
+//
+// Tasks are only addressable by the interpreter that spawned them.  The id
+// is looked up under the lock, but the lock must be released before failing.
+//
+static struct Reb_Task *Find_Child_Task_May_Fail(const REBVAL *id)
+{
+    Lock_Tasks();
+    struct Reb_Task *task = Find_Task(VAL_INT32(id));
+    if (task and task->parent != Current_Task)
+        task = nullptr;
+    Unlock_Tasks();
+
+    if (not task)
+        fail (Error_Bad_Value(id));
+    return task;
+}
+
+
+static void Join_Task_Thread(struct Reb_Task *task)
+{
+  #ifdef TO_WINDOWS
+    WaitForSingleObject(task->thread, INFINITE);
+    CloseHandle(task->thread);
+  #else
+    pthread_join(task->thread, nullptr);
+  #endif
+}
+
+
+// Free a task that is no longer in Task_List, and whose thread has ended.
+// Returns its error (if any), for the caller to free.
+//
+static char *Free_Task(struct Reb_Task *task)
+{
+    Free_Queue(&task->inbox);
+    Free_Queue(&task->outbox);
+
+    char *error = task->error;
+    free(task);
+    return error;
+}
+
+
+//
+//  Reap_Orphans: C
+//
+// Wait for the children a task never did a FINISH-TASK on, and free them.
+// They are told first that their spawner is gone, so a RECEIVE from it
+// returns null instead of waiting forever.
+//
+static void Reap_Orphans(struct Reb_Task *parent)
+{
+    Lock_Tasks();
+
+    struct Reb_Task *t = Task_List;
+    for (; t; t = t->next) {
+        if (t->parent == parent)
+            t->orphaned = true;
+    }
+    Wake_Tasks();
+
+    while (true) {
+        struct Reb_Task **link = &Task_List;
+        while (*link and (*link)->parent != parent)
+            link = &(*link)->next;
+
+        struct Reb_Task *child = *link;
+        if (not child)
+            break;
+        *link = child->next;  // unlinked, so no one else can find it
+
+        Unlock_Tasks();
+        Join_Task_Thread(child);  // reaps its own children before it ends
+        free(Free_Task(child));  // no one is left to report an error to
+        Lock_Tasks();
+    }
+
+    Unlock_Tasks();
+}
+
+
+static void Run_Task(struct Reb_Task *task)
+{
+    Current_Task = task;
+
+    Lock_Boot();
+    rebStartup();
+
+    REBVAL *collation = RX_COLLATE_NAME(Task)();
+    rebElide("load-extension", rebR(collation), rebEND);
+    Unlock_Boot();
+
+    REBVAL *code = rebSizedText(cs_cast(task->code), task->code_size);
+    free(task->code);
+    task->code = nullptr;
+
+    REBVAL *error = rebValue("trap [do", rebR(code), "]", rebEND);
+
+    char *utf8 = nullptr;
+    if (error) {
+        char *spelled = rebSpell("form", rebR(error), rebEND);
+        size_t size = strlen(spelled);
+        utf8 = cast(char*, malloc(size + 1));
+        if (utf8)
+            memcpy(utf8, spelled, size + 1);
+        rebFree(spelled);
+    }
+
+    Reap_Orphans(task);
+
+    Lock_Boot();
+    rebShutdown(true);
+    Unlock_Boot();
+
+    Lock_Tasks();
+    task->error = utf8;
+    task->finished = true;
+    Wake_Tasks();
+    Unlock_Tasks();
+}
+
+
+//
+//  Quit_Tasks: C
+//
+// Devices are the only thing rebShutdown() tells about shutting down (see
+// OS_Quit_Devices()), so this is how the interpreter that is not a task
+// waits for and frees the tasks it never did a FINISH-TASK on.
+//
+static DEVICE_CMD Quit_Tasks(REBREQ *dr)
+{
+    UNUSED(dr);
+
+    Reap_Orphans(Current_Task);
+    return DR_DONE;
+}
+
+static DEVICE_CMD_CFUNC Dev_Cmds[RDC_MAX] =
+{
+    0,  // init
+    Quit_Tasks,
+};
+
+static DEFINE_DEV(
+    Dev_Task,
+    "Tasks", 1, Dev_Cmds, RDC_MAX, sizeof(struct rebol_devreq)
+);
+
+
+#ifdef TO_WINDOWS
+    static DWORD WINAPI Task_Thread(LPVOID param) {
+        Run_Task(cast(struct Reb_Task*, param));
+        return 0;
+    }
+#else
+    static void *Task_Thread(void *param) {
+        Run_Task(cast(struct Reb_Task*, param));
+        return nullptr;
+    }
+#endif
+
+
+//
+//  export spawn: native [
+//
+//  {Run code in a new interpreter on a thread of its own}
+//
+//      return: "Task id, for SEND, RECEIVE, and FINISH-TASK"
+//          [integer!]
+//      code "Source to DO (the task can't see anything from this one)"
+//          [text!]
+//  ]
+//
+REBNATIVE(spawn)
+{
+    TASK_INCLUDE_PARAMS_OF_SPAWN;
+
+    REBSIZ size;
+    const REBYTE *utf8 = VAL_UTF8_AT(&size, ARG(code));
+
+    struct Reb_Task *task = cast(struct Reb_Task*,
+        calloc(1, sizeof(struct Reb_Task))
+    );
+    if (task)
+        task->code = cast(REBYTE*, malloc(size));
+    if (not task or not task->code) {
+        free(task);
+        fail (Error_No_Memory(size));
+    }
+    memcpy(task->code, utf8, size);
+    task->code_size = size;
+    task->parent = Current_Task;
+
+    // The task is linked in before its thread starts, so it can SEND right
+    // away, and the thread handle is written while still holding the lock.
+    //
+    Lock_Tasks();
+    task->id = Task_Next_Id++;
+    task->next = Task_List;
+    Task_List = task;
+
+  #ifdef TO_WINDOWS
+    task->thread = CreateThread(nullptr, 0, &Task_Thread, task, 0, nullptr);
+    bool started = (task->thread != nullptr);
+  #else
+    bool started = (
+        pthread_create(&task->thread, nullptr, &Task_Thread, task) == 0
+    );
+  #endif
+
+    if (not started) {
+        Task_List = task->next;
+        Unlock_Tasks();
+        free(task->code);
+        free(task);
+        fail ("Could not start a thread for the task");
+    }
+    Unlock_Tasks();
+
+    return Init_Integer(D_OUT, task->id);
+}
+
+
+//
+//  export send: native [
+//
+//  {Queue a copy of a value for a task (or from a task to its spawner)}
+//
+//      return: [void!]
+//      task "Task id, or BLANK! from a task to the one that spawned it"
+//          [integer! blank!]
+//      value "BINARY! is copied as bytes, all others via MOLD/ALL"
+//          [any-value!]
+//  ]
+//
+REBNATIVE(send)
+{
+    TASK_INCLUDE_PARAMS_OF_SEND;
+
+    struct Reb_Task *task;
+    if (IS_BLANK(ARG(task))) {
+        if (not Current_Task)
+            fail ("SEND to BLANK! only works from inside a task");
+        task = Current_Task;
+    }
+    else
+        task = Find_Child_Task_May_Fail(ARG(task));
+
+    struct Reb_Task_Message *msg = Make_Message(ARG(value));
+
+    Lock_Tasks();
+    Enqueue_Message(task == Current_Task ? &task->outbox : &task->inbox, msg);
+    Wake_Tasks();
+    Unlock_Tasks();
+
+    return Init_Void(D_OUT);
+}
+
+
+//
+//  export receive: native [
+//
+//  {Wait for the next value sent by a task (or to a task by its spawner)}
+//
+//      return: {Null once a task has finished and its messages are drained
+//      (or inside a task, once its spawner has ended)}
+//          [<opt> any-value!]
+//      task "Task id, or BLANK! from a task for the one that spawned it"
+//          [integer! blank!]
+//  ]
+//
+REBNATIVE(receive)
+//
+// !!! The wait is not interruptible by a HALT.
+{
+    TASK_INCLUDE_PARAMS_OF_RECEIVE;
+
+    struct Reb_Task *task;
+    if (IS_BLANK(ARG(task))) {
+        if (not Current_Task)
+            fail ("RECEIVE from BLANK! only works from inside a task");
+        task = Current_Task;
+    }
+    else
+        task = Find_Child_Task_May_Fail(ARG(task));
+
+    bool from_parent = (task == Current_Task);
+    struct Reb_Task_Queue *q = from_parent ? &task->inbox : &task->outbox;
+
+    Lock_Tasks();
+    struct Reb_Task_Message *msg;
+    while (not (msg = Dequeue_Message(q))) {
+        if (from_parent ? task->orphaned : task->finished)
+            break;
+        Wait_Tasks();
+    }
+    Unlock_Tasks();
+
+    if (not msg)
+        return nullptr;
+
+    return Init_From_Message(D_OUT, msg);
+}
+
+
+//
+//  export finish-task: native [
+//
+//  {Wait for a task's thread to end, and release the task}
+//
+//      return: [void!]
+//      task [integer!]
+//  ]
+//
+REBNATIVE(finish_task)
+//
+// Messages the spawner never RECEIVE'd are dropped.  If the task's code
+// failed, that is reported as an error here.
+{
+    TASK_INCLUDE_PARAMS_OF_FINISH_TASK;
+
+    struct Reb_Task *task = Find_Child_Task_May_Fail(ARG(task));
+
+    Join_Task_Thread(task);
+
+    Lock_Tasks();
+    struct Reb_Task **link = &Task_List;
+    while (*link != task)
+        link = &(*link)->next;
+    *link = task->next;
+    Unlock_Tasks();
+
+    char *utf8 = Free_Task(task);
+
+    if (utf8) {
+        REBCTX *error = Error_User(utf8);
+        free(utf8);
+        fail (error);
+    }
+
+    return Init_Void(D_OUT);
+}
+
+
+//
+//  register-task-device: native [
+//
+//  {Have shutdown wait for tasks that weren't finished (see Dev_Task)}
+//
+//      return: [void!]
+//  ]
+//
+REBNATIVE(register_task_device)
+//
+// Tasks load this extension too, but they reap their own children in
+// Run_Task(), and Dev_Task can only be in one instance's device list.
+{
+    TASK_INCLUDE_PARAMS_OF_REGISTER_TASK_DEVICE;
+
+    if (Current_Task == nullptr) {
+        OS_Register_Device(&Dev_Task);
+        Dev_Task.flags |= RDF_INIT;  // nothing to initialize, but quit it
+    }
+
+    return Init_Void(D_OUT);
+}
+
+
+// The part of WITH-BOOT-LOCK that runs under rebRescue(), so a fail() in
+// the code can't leave the lock held.
+//
+static const REBVAL *Boot_Locked_Dangerous(REBFRM *frame_)
+{
+    TASK_INCLUDE_PARAMS_OF_WITH_BOOT_LOCK;
+
+    if (Do_Branch_Throws(D_OUT, D_SPARE, ARG(code)))
+        return VOID_VALUE;  // signal a throw
+
+    return nullptr;
+}
+
+
+//
+//  with-boot-lock: native [
+//
+//  {Run code while no task is booting or shutting down}
+//
+//      return: [<opt> any-value!]
+//      code [block! action!]
+//  ]
+//
+REBNATIVE(with_boot_lock)
+//
+// LOAD-EXTENSION is enclosed with this (see %ext-task-init.reb), since
+// loading an extension touches the same state outside the instance as
+// booting does.
+{
+    TASK_INCLUDE_PARAMS_OF_WITH_BOOT_LOCK;
+
+    Lock_Boot();
+    REBVAL *error = rebRescue(cast(REBDNG*, &Boot_Locked_Dangerous), frame_);
+    Unlock_Boot();
+
+    UNUSED(ARG(code));  // used by the above call, via the frame_ pointer
+
+    if (not error)
+        return D_OUT;
+
+    if (IS_VOID(error))
+        return R_THROWN;
+
+    REBCTX *ctx = VAL_CONTEXT(error);
+    rebRelease(error);
+    fail (ctx);
+}
@@ -105,7 +105,7 @@ int tcc_set_lib_path_i(TCCState *s, const char *path)
 // dispatcher being used, these fields are used by "user natives"
 
 #define IDX_TCC_NATIVE_LINKNAME \
-    IDX_NATIVE_MAX // generated if the native doesn't specify
+    IDX_NATIVE_MAX // BLANK! if the native doesn't specify (see COMPILE*)
 
 #define IDX_TCC_NATIVE_STATE \
     IDX_TCC_NATIVE_LINKNAME + 1 // will be a BLANK! until COMPILE happens
@@ -314,8 +314,9 @@ REBNATIVE(make_native)
 
     REBVAL *source = ARG(source);
 
+    REBFLGS flags = MKF_MASK_NONE;
     REBACT *native = Make_Action(
-        Make_Paramlist_Managed_May_Fail(ARG(spec), MKF_MASK_NONE),
+        Make_Paramlist_Managed_May_Fail(ARG(spec), &flags),
         &Pending_Native_Dispatcher, // will be replaced e.g. by COMPILE
         nullptr, // no facade (use paramlist)
         nullptr, // no specialization exemplar (or inherited exemplar)
@@ -355,17 +356,12 @@ REBNATIVE(make_native)
         }
     }
     else {
-        // Auto-generate a linker name based on the numeric value of the
-        // paramlist pointer.  Just "N_" followed by the hexadecimal value.
-
-        REBARR *paramlist = ACT_PARAMLIST(native);  // unique for this action!
-        intptr_t heapaddr = cast(intptr_t, paramlist);
-        REBVAL *linkname = rebValue(
-            "unspaced [{N_} as text! to-hex", rebI(heapaddr), "]",
-        rebEND);
-
-        Move_Value(ARR_AT(details, IDX_TCC_NATIVE_LINKNAME), linkname);
-        rebRelease(linkname);
+        // COMPILE* generates a linker name from the native's position in the
+        // compile ("N_1", "N_2"...).  That's unique within a TCC state, and
+        // unlike a name based on a heap address, it's the same from one run
+        // to the next--so a cached object file can be linked again.
+        //
+        Init_Blank(ARR_AT(details, IDX_TCC_NATIVE_LINKNAME));
     }
 
     Init_Blank(ARR_AT(details, IDX_TCC_NATIVE_STATE)); // no TCC_State, yet...
@@ -491,6 +487,19 @@ REBNATIVE(compile_p)
     if (REF(files)) {
         RELVAL *item;
         for (item = VAL_ARRAY_AT(compilables); NOT_END(item); ++item) {
+            if (IS_ACTION(item)) {
+                //
+                // A user native whose code is already in one of the files
+                // (e.g. an object file COMPILE cached from an earlier run).
+                // Collect it so its dispatcher can be found after linking;
+                // its position among the ACTION!s must be the same as when
+                // the file was compiled, for the generated linker names.
+                //
+                assert(Is_User_Native(VAL_ACTION(item)));
+                Move_Value(DS_PUSH(), KNOWN(item));
+                continue;
+            }
+
             if (not IS_TEXT(item))
                 fail ("If COMPILE*/FILES, compilables must be TEXT! paths");
 
@@ -501,6 +510,7 @@ REBNATIVE(compile_p)
 
         if (REF(inspect)) {  // nothing to show, besides the file list
             DROP_GC_GUARD(handle);
+            DS_DROP_TO(dsp_orig);
             return rebText("/INSPECT => <file list>");
         }
     }
@@ -543,7 +553,13 @@ REBNATIVE(compile_p)
                 // https://forum.rebol.info/t/817
                 //
                 Append_Ascii(mo->series, "const REBVAL *");
-                Append_String(mo->series, linkname, VAL_LEN_AT(linkname));
+                if (IS_TEXT(linkname))
+                    Append_String(mo->series, linkname, VAL_LEN_AT(linkname));
+                else {
+                    assert(IS_BLANK(linkname));
+                    Append_Ascii(mo->series, "N_");
+                    Append_Int(mo->series, DSP - dsp_orig);
+                }
                 Append_Ascii(mo->series, "(void *frame_)\n{");
 
                 Append_String(mo->series, source, VAL_LEN_AT(source));
@@ -633,7 +649,11 @@ REBNATIVE(compile_p)
             fail ("TCC failed to relocate the code");
     }
     else {
-        assert(DSP == dsp_orig);  // no user natives if outputting file!
+        // User natives compiled into a file stay pending here.  (COMPILE's
+        // cache writes an object file and then links that into memory with
+        // COMPILE*/FILES, which is when their dispatchers get set.)
+        //
+        DS_DROP_TO(dsp_orig);
 
         char *output_file_utf8 = rebSpell(
             "ensure text! pick", config, "'output-file",
@@ -655,14 +675,19 @@ REBNATIVE(compile_p)
         REBARR *details = VAL_ACT_DETAILS(native);
         REBVAL *linkname = KNOWN(ARR_AT(details, IDX_TCC_NATIVE_LINKNAME));
 
-        char *name_utf8 = rebSpell("ensure text!", linkname, rebEND);
+        char *name_utf8 = IS_BLANK(linkname)
+            ? rebSpell("unspaced [{N_}", rebI(DSP - dsp_orig), "]", rebEND)
+            : rebSpell("ensure text!", linkname, rebEND);
         void *sym = tcc_get_symbol(state, name_utf8);
-        rebFree(name_utf8);
 
-        if (not sym)
+        if (not sym) {
+            REBVAL *name = rebText(name_utf8);
+            rebFree(name_utf8);
             rebJumps ("fail [",
-                "{TCC failed to find symbol:}", linkname,
+                "{TCC failed to find symbol:}", rebR(name),
             "]", rebEND);
+        }
+        rebFree(name_utf8);
 
         // Circumvent ISO C++ forbidding cast between function/data pointers
         //
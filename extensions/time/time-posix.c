@@ -78,6 +78,20 @@ static int Get_Timezone(struct tm *utc_tm_unused)
 {
     time_t now_secs;
     time(&now_secs); // UNIX seconds (since "epoch")
+
+    // The localtime() and mktime() calls below consult the time zone rules,
+    // which is slow enough to dominate e.g. reading a directory's file
+    // dates.  Offsets only change on a quarter hour boundary (even the zones
+    // that are offset by 30 or 45 minutes change at those), so reuse the
+    // offset until the next one.
+    //
+    // !!! Not thread-safe, but neither is localtime().
+    //
+    static time_t cached_quarter = -1;
+    static int cached_zone;
+    if (now_secs / (15 * 60) == cached_quarter)
+        return cached_zone;
+
     struct tm local_tm = *localtime(&now_secs);
 
   #if !defined(HAS_SMART_TIMEZONE)
@@ -108,7 +122,10 @@ static int Get_Timezone(struct tm *utc_tm_unused)
     time_t now_secs_gm = mktime(gmtime(&now_secs));
 
     double diff = difftime(mktime(&local_tm), now_secs_gm);
-    return cast(int, diff / 60);
+
+    cached_quarter = now_secs / (15 * 60);
+    cached_zone = cast(int, diff / 60);
+    return cached_zone;
 }
 
 
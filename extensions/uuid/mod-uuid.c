@@ -34,8 +34,13 @@
     #include <rpc.h>  // for UuidCreate()
 #elif defined(TO_OSX)
     #include <CoreFoundation/CFUUID.h>
+    #include <time.h>  // for clock_gettime()
 #else
     #include <uuid.h>
+    #include <time.h>  // for clock_gettime()
+  #if defined(TO_LINUX)
+    #include "randutils.h"  // for random_get_bytes()
+  #endif
 #endif
 
 #include "sys-core.h"
@@ -43,78 +48,261 @@
 #include "tmp-mod-uuid.h"
 
 
+#define UUID_SIZE 16
+
+
+// Fill `out` with `count` random (version 4) UUIDs, 16 bytes each, in the
+// byte order of the text form.
+//
+static void Fill_Random_Uuids(REBYTE *out, REBLEN count)
+{
+#ifdef TO_WINDOWS
+    for (; count != 0; --count, out += UUID_SIZE) {
+        UUID uuid;
+        UuidCreate(&uuid);
+
+        // uuid.data* is in litte endian
+        // the string form is in big endian
+        out[0] = cast(char*, &uuid.Data1)[3];
+        out[1] = cast(char*, &uuid.Data1)[2];
+        out[2] = cast(char*, &uuid.Data1)[1];
+        out[3] = cast(char*, &uuid.Data1)[0];
+
+        out[4] = cast(char*, &uuid.Data2)[1];
+        out[5] = cast(char*, &uuid.Data2)[0];
+
+        out[6] = cast(char*, &uuid.Data3)[1];
+        out[7] = cast(char*, &uuid.Data3)[0];
+
+        memcpy(out + 8, uuid.Data4, 8);
+    }
+
+#elif defined(TO_OSX)
+    for (; count != 0; --count, out += UUID_SIZE) {
+        CFUUIDRef newId = CFUUIDCreate(NULL);
+        CFUUIDBytes bytes = CFUUIDGetUUIDBytes(newId);
+        CFRelease(newId);
+
+        STATIC_ASSERT(sizeof(bytes) == UUID_SIZE);  // byte0 ... byte15
+        memcpy(out, &bytes, UUID_SIZE);
+    }
+
+#elif defined(TO_LINUX)
+    // Same as libuuid's uuid_generate_random(), but getting the random bytes
+    // for all of them with one call.
+    //
+    random_get_bytes(out, count * UUID_SIZE);
+    for (; count != 0; --count, out += UUID_SIZE) {
+        out[6] = (out[6] & 0x0F) | 0x40;  // version 4
+        out[8] = (out[8] & 0x3F) | 0x80;  // RFC 4122 variant
+    }
+
+#else
+    UNUSED(out);
+    UNUSED(count);
+    fail ("UUID is not implemented");
+#endif
+}
+
+
+// Milliseconds since 1970 (UTC), for the timestamp in a version 7 UUID.
+//
+static uint64_t Uuid_Unix_Ms(void)
+{
+  #ifdef TO_WINDOWS
+    FILETIME ft;  // 100ns units since 1601
+    GetSystemTimeAsFileTime(&ft);
+    uint64_t t = (cast(uint64_t, ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+    return (t - 116444736000000000ULL) / 10000;
+  #else
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return cast(uint64_t, ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+  #endif
+}
+
+
+// The 12 bits after the version in a version 7 UUID count up within each
+// millisecond, so UUIDs made by this process sort in the order they were
+// made (RFC 9562, "Fixed Bit-Length Dedicated Counter").  It starts at a
+// random point in the lower half of its range, leaving room to count.
+//
+static uint64_t Uuid_Last_Ms = 0;
+static unsigned int Uuid_Counter = 0;
+
+
+// Turn random UUIDs into version 7 ones, keeping their random bits (and the
+// variant) after the timestamp and counter.
+//
+static void Make_Time_Ordered_Uuids(REBYTE *out, REBLEN count)
+{
+    uint64_t ms = Uuid_Unix_Ms();
+
+    for (; count != 0; --count, out += UUID_SIZE) {
+        if (ms > Uuid_Last_Ms) {
+            Uuid_Last_Ms = ms;
+            Uuid_Counter = ((out[6] << 8) | out[7]) & 0x7FF;
+        }
+        else if (++Uuid_Counter > 0xFFF) {  // used up, borrow from next ms
+            ++Uuid_Last_Ms;
+            Uuid_Counter = 0;
+        }
+        // else clock went back or same ms: keep counting on from last
+
+        uint64_t t = Uuid_Last_Ms;
+        out[0] = cast(REBYTE, t >> 40);
+        out[1] = cast(REBYTE, t >> 32);
+        out[2] = cast(REBYTE, t >> 24);
+        out[3] = cast(REBYTE, t >> 16);
+        out[4] = cast(REBYTE, t >> 8);
+        out[5] = cast(REBYTE, t);
+        out[6] = 0x70 | cast(REBYTE, Uuid_Counter >> 8);  // version 7
+        out[7] = cast(REBYTE, Uuid_Counter);
+    }
+}
+
+
 //
 //  generate: native [
 //
 //  "Generate a UUID"
 //
 //      return: [binary!]
+//      /time "Time-ordered (version 7), sorting after ones made before"
 //  ]
 //
 REBNATIVE(generate)
 {
     UUID_INCLUDE_PARAMS_OF_GENERATE;
 
-#ifdef TO_WINDOWS
-    UUID uuid;
-    UuidCreate(&uuid);
+    REBBIN *bin = Make_Binary(UUID_SIZE);
+    Fill_Random_Uuids(BIN_HEAD(bin), 1);
+    if (REF(time))
+        Make_Time_Ordered_Uuids(BIN_HEAD(bin), 1);
+    TERM_BIN_LEN(bin, UUID_SIZE);
 
-    // uuid.data* is in litte endian
-    // the string form is in big endian
-    REBSER *ser = Make_Binary(16);
-    *BIN_AT(ser, 0) = cast(char*, &uuid.Data1)[3];
-    *BIN_AT(ser, 1) = cast(char*, &uuid.Data1)[2];
-    *BIN_AT(ser, 2) = cast(char*, &uuid.Data1)[1];
-    *BIN_AT(ser, 3) = cast(char*, &uuid.Data1)[0];
+    return Init_Binary(D_OUT, bin);
+}
 
-    *BIN_AT(ser, 4) = cast(char*, &uuid.Data2)[1];
-    *BIN_AT(ser, 5) = cast(char*, &uuid.Data2)[0];
 
-    *BIN_AT(ser, 6) = cast(char*, &uuid.Data3)[1];
-    *BIN_AT(ser, 7) = cast(char*, &uuid.Data3)[0];
+//
+//  generate-uuids: native [
+//
+//  "Generate many UUIDs at once, packed into a BINARY! 16 bytes apart"
+//
+//      return: [binary!]
+//      count [integer!]
+//      /time "Time-ordered (version 7), sorting after ones made before"
+//  ]
+//
+REBNATIVE(generate_uuids)
+{
+    UUID_INCLUDE_PARAMS_OF_GENERATE_UUIDS;
 
-    memcpy(BIN_AT(ser, 8), uuid.Data4, 8);
+    REBI64 count = VAL_INT64(ARG(count));
+    if (count < 0 or count > cast(REBI64, UINT32_MAX / UUID_SIZE))
+        fail (Error_Out_Of_Range(ARG(count)));
 
-    TERM_BIN_LEN(ser, 16);
+    REBLEN size = cast(REBLEN, count) * UUID_SIZE;
+    REBBIN *bin = Make_Binary(size);
+    Fill_Random_Uuids(BIN_HEAD(bin), cast(REBLEN, count));
+    if (REF(time))
+        Make_Time_Ordered_Uuids(BIN_HEAD(bin), cast(REBLEN, count));
+    TERM_BIN_LEN(bin, size);
 
-    Init_Binary(D_OUT, ser);
+    return Init_Binary(D_OUT, bin);
+}
 
-#elif defined(TO_OSX)
-    CFUUIDRef newId = CFUUIDCreate(NULL);
-    CFUUIDBytes bytes = CFUUIDGetUUIDBytes(newId);
-    CFRelease(newId);
-
-    REBSER *ser = Make_Binary(16);
-    *BIN_AT(ser, 0) = bytes.byte0;
-    *BIN_AT(ser, 1) = bytes.byte1;
-    *BIN_AT(ser, 2) = bytes.byte2;
-    *BIN_AT(ser, 3) = bytes.byte3;
-    *BIN_AT(ser, 4) = bytes.byte4;
-    *BIN_AT(ser, 5) = bytes.byte5;
-    *BIN_AT(ser, 6) = bytes.byte6;
-    *BIN_AT(ser, 7) = bytes.byte7;
-    *BIN_AT(ser, 8) = bytes.byte8;
-    *BIN_AT(ser, 9) = bytes.byte9;
-    *BIN_AT(ser, 10) = bytes.byte10;
-    *BIN_AT(ser, 11) = bytes.byte11;
-    *BIN_AT(ser, 12) = bytes.byte12;
-    *BIN_AT(ser, 13) = bytes.byte13;
-    *BIN_AT(ser, 14) = bytes.byte14;
-    *BIN_AT(ser, 15) = bytes.byte15;
-
-    TERM_BIN_LEN(ser, 16);
-
-    Init_Binary(D_OUT, ser);
 
-#elif defined(TO_LINUX)
-    uuid_t uuid;
-    uuid_generate(uuid);
+// Write the 36 characters of the text form ({8-4-4-4-12}) of a UUID.
+//
+static void Form_Uuid(REBYTE *out, const REBYTE *uuid)
+{
+    static const char hex[] = "0123456789ABCDEF";
 
-    Init_Binary(D_OUT, Copy_Bytes(uuid, sizeof(uuid)));
+    REBLEN i;
+    for (i = 0; i < UUID_SIZE; ++i) {
+        if (i == 4 or i == 6 or i == 8 or i == 10)
+            *out++ = '-';
+        *out++ = hex[uuid[i] >> 4];
+        *out++ = hex[uuid[i] & 0x0F];
+    }
+}
 
-#else
-    fail ("UUID is not implemented");
-#endif
 
-    return D_OUT;
+//
+//  to-text: native [
+//
+//  "Convert the UUID to the text string form ({8-4-4-4-12})"
+//
+//      return: "BLOCK! of TEXT! for /ALL"
+//          [text! block!]
+//      uuid [binary!]
+//      /all "Convert each of the UUIDs packed in the binary"
+//  ]
+//
+REBNATIVE(to_text)
+{
+    UUID_INCLUDE_PARAMS_OF_TO_TEXT;
+
+    const REBYTE *bp = VAL_BIN_AT(ARG(uuid));
+    REBLEN len = VAL_LEN_AT(ARG(uuid));
+    if (len < UUID_SIZE or (REF(all) and len % UUID_SIZE != 0))
+        fail (PAR(uuid));
+
+    REBYTE form[36];
+    if (not REF(all)) {
+        Form_Uuid(form, bp);
+        return Init_Text(D_OUT, Make_Sized_String_UTF8(cs_cast(form), 36));
+    }
+
+    REBLEN count = len / UUID_SIZE;
+    REBARR *a = Make_Array(count);
+    for (; count != 0; --count, bp += UUID_SIZE) {
+        Form_Uuid(form, bp);
+        Init_Text(
+            Alloc_Tail_Array(a),
+            Make_Sized_String_UTF8(cs_cast(form), 36)
+        );
+    }
+    return Init_Block(D_OUT, a);
+}
+
+
+//
+//  from-text: native [
+//
+//  "Convert the text form ({8-4-4-4-12}) of a UUID to its 16 bytes"
+//
+//      return: "NULL if not a UUID (braces around it are allowed)"
+//          [<opt> binary!]
+//      text [text!]
+//  ]
+//
+REBNATIVE(from_text)
+{
+    UUID_INCLUDE_PARAMS_OF_FROM_TEXT;
+
+    REBSIZ size;
+    const REBYTE *cp = VAL_UTF8_AT(&size, ARG(text));
+    if (size == 38 and cp[0] == '{' and cp[37] == '}') {
+        ++cp;
+        size -= 2;
+    }
+    if (size != 36)
+        return nullptr;
+
+    REBYTE uuid[UUID_SIZE];
+    REBLEN i;
+    for (i = 0; i < UUID_SIZE; ++i) {
+        if (i == 4 or i == 6 or i == 8 or i == 10) {
+            if (*cp++ != '-')
+                return nullptr;
+        }
+        cp = Scan_Hex2(&uuid[i], cp);
+        if (not cp)
+            return nullptr;
+    }
+
+    return Init_Binary(D_OUT, Copy_Bytes(uuid, UUID_SIZE));
 }
@@ -23,6 +23,15 @@
 //
 // See notes in %extensions/vector/README.md
 
+#ifdef TO_WINDOWS
+    #define WIN32_LEAN_AND_MEAN  // trim down the Win32 headers
+    #include <windows.h>
+    #undef IS_ERROR  // winerror.h defines, Rebol has a different meaning
+#else
+    #include <pthread.h>
+    #include <unistd.h>  // for sysconf()
+#endif
+
 #include "sys-core.h"
 
 #include "tmp-mod-vector.h"
@@ -78,3 +87,978 @@ REBNATIVE(unregister_vector_hooks)
 
     return Init_Void(D_OUT);
 }
+
+
+//
+//  export vector-math: native [
+//
+//  {Combine VECTOR! elements with another vector's, or a number, natively}
+//
+//      return: "Comparisons give 1 where true and 0 where false"
+//          [any-value!]
+//      op "ADD, SUBTRACT, MULTIPLY, DIVIDE, MINIMUM, MAXIMUM, or a compare"
+//          [word!]  ; EQUAL? NOT-EQUAL? LESSER? GREATER? ...-OR-EQUAL?
+//      vector [any-value!]
+//      value "Vector of the same element type and length, or a number"
+//          [any-value!]
+//      /in-place "Overwrite VECTOR with the results instead of copying"
+//  ]
+//
+REBNATIVE(vector_math)
+{
+    VECTOR_INCLUDE_PARAMS_OF_VECTOR_MATH;
+
+    if (not IS_VECTOR(ARG(vector)))
+        fail (PAR(vector));
+
+    return Vector_Math(
+        D_OUT,
+        Vector_Op_From_Word(ARG(op)),
+        ARG(vector),
+        ARG(value),
+        did REF(in_place)
+    );
+}
+
+
+//
+//  export vector-view: native [
+//
+//  {VECTOR! of some elements of another, sharing (not copying) its data}
+//
+//      return: [any-value!]
+//      vector [any-value!]
+//      index "Position of the view's first element in VECTOR"
+//          [integer!]
+//      count "Number of elements in the view"
+//          [integer!]
+//      /stride "Elements apart in VECTOR (e.g. row length, for a column)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(vector_view)
+{
+    VECTOR_INCLUDE_PARAMS_OF_VECTOR_VIEW;
+
+    REBVAL *vec = ARG(vector);
+    if (not IS_VECTOR(vec))
+        fail (PAR(vector));
+
+    REBI64 len = VAL_VECTOR_LEN_AT(vec);
+    REBI64 index = VAL_INT64(ARG(index)) - 1;
+    REBI64 count = VAL_INT64(ARG(count));
+    REBI64 stride = REF(stride) ? VAL_INT64(ARG(stride)) : 1;
+
+    if (stride < 1)
+        fail (PAR(stride));
+    if (count < 0 or count > len)
+        fail (PAR(count));
+    if (index < 0 or index > len)
+        fail (PAR(index));
+
+    if (count <= 1)
+        stride = 1;  // never stepped, don't let it compound in views of views
+    else if (stride > len)
+        fail (Error_Out_Of_Range(ARG(stride)));
+    if (count != 0 and index + (count - 1) * stride >= len)
+        fail (Error_Out_Of_Range(ARG(count)));
+
+    return Init_Vector_View(
+        D_OUT,
+        vec,
+        cast(REBLEN, index),
+        cast(REBLEN, count),
+        cast(REBLEN, stride)
+    );
+}
+
+
+//
+//  export vector-to-block: native [
+//
+//  {BLOCK! of a VECTOR!'s elements, as INTEGER!s or DECIMAL!s}
+//
+//      return: [block!]
+//      vector [any-value!]
+//  ]
+//
+REBNATIVE(vector_to_block)
+{
+    VECTOR_INCLUDE_PARAMS_OF_VECTOR_TO_BLOCK;
+
+    REBVAL *vec = ARG(vector);
+    if (not IS_VECTOR(vec))
+        fail (PAR(vector));
+
+    return Init_Block(D_OUT, Vector_To_Array(vec));
+}
+
+
+//=//// REDUCTIONS ////////////////////////////////////////////////////////=//
+//
+// VECTOR-SUM, VECTOR-DOT, VECTOR-MINIMUM, VECTOR-MAXIMUM, VECTOR-MEAN,
+// VECTOR-VARIANCE and VECTOR-HISTOGRAM read the packed data a block at a
+// time into a local buffer of int64_t or double (deciding how to read the
+// element type once per block, not per element), and work on that.  Views
+// made by VECTOR-VIEW are read where they are, stepping by their stride.
+//
+// Integer sums and dot products are exact, and fail if they overflow an
+// INTEGER!.  Decimal sums total each block with several accumulators and
+// then add the block totals pairwise, so rounding error grows with log(n)
+// instead of n.  The mean and variance are figured in decimal for every
+// element type, and variance takes a second pass summing the deviations from
+// the mean (which is more stable than summing the squares).
+//
+// Vectors of VECTOR_THREAD_MIN elements or more are split into a piece per
+// CPU, each on its own thread.  As with PARALLEL-GZIP, the threads never use
+// the Rebol API, and the native doesn't return until all of them are joined.
+// (So a decimal result can differ in the last bits from what one thread gets,
+// as the pieces are grouped differently.)
+//
+//=////////////////////////////////////////////////////////////////////////=//
+
+#define VECTOR_BLOCK 256
+#define VECTOR_THREAD_MIN (1 << 20)
+
+enum Reb_Vector_Reduce {
+    VRED_SUM_INT,
+    VRED_SUM,
+    VRED_DOT_INT,
+    VRED_DOT,
+    VRED_MIN_MAX_INT,
+    VRED_MIN_MAX,
+    VRED_SQUARED_DEVIATIONS,  // sum of (x - center)^2
+    VRED_HISTOGRAM
+};
+
+struct Reb_Vector_Job {
+    enum Reb_Vector_Reduce op;
+    bool integral;
+    bool sign;
+    REBYTE wide;
+    const REBYTE *a;
+    const REBYTE *b;  // second vector for dot products
+    REBLEN a_step;  // bytes from one element to the next (views may stride)
+    REBLEN b_step;
+    REBLEN len;
+
+    double center;  // VRED_SQUARED_DEVIATIONS
+    double low;  // VRED_HISTOGRAM...
+    double high;
+    double scale;  // ...bins per unit
+    REBLEN bins;
+    int64_t *counts;
+
+    bool overflow;  // results
+    int64_t i;
+    int64_t i_min;
+    int64_t i_max;
+    double d;
+    double d_min;
+    double d_max;
+};
+
+
+#define LOAD_ELEMENTS(T) \
+    for (k = 0; k < n; ++k) { \
+        T t; \
+        memcpy(&t, p + k * step, sizeof(T)); \
+        buf[k] = t; \
+    }
+
+static void Load_Doubles(
+    double *buf,
+    const struct Reb_Vector_Job *job,
+    const REBYTE *p,
+    REBLEN step,
+    REBLEN n
+){
+    REBLEN k;
+    if (not job->integral) {
+        if (job->wide == 4)
+            LOAD_ELEMENTS(float)
+        else
+            LOAD_ELEMENTS(double)
+    }
+    else if (job->sign) {
+        switch (job->wide) {
+          case 1: LOAD_ELEMENTS(int8_t) break;
+          case 2: LOAD_ELEMENTS(int16_t) break;
+          case 4: LOAD_ELEMENTS(int32_t) break;
+          default: LOAD_ELEMENTS(int64_t) break;
+        }
+    }
+    else {
+        switch (job->wide) {
+          case 1: LOAD_ELEMENTS(uint8_t) break;
+          case 2: LOAD_ELEMENTS(uint16_t) break;
+          case 4: LOAD_ELEMENTS(uint32_t) break;
+          default: LOAD_ELEMENTS(uint64_t) break;
+        }
+    }
+}
+
+// Returns false if an unsigned 64-bit element doesn't fit in an int64_t
+//
+static bool Load_Int64s(
+    int64_t *buf,
+    const struct Reb_Vector_Job *job,
+    const REBYTE *p,
+    REBLEN step,
+    REBLEN n
+){
+    REBLEN k;
+    assert(job->integral);
+    if (job->sign) {
+        switch (job->wide) {
+          case 1: LOAD_ELEMENTS(int8_t) break;
+          case 2: LOAD_ELEMENTS(int16_t) break;
+          case 4: LOAD_ELEMENTS(int32_t) break;
+          default: LOAD_ELEMENTS(int64_t) break;
+        }
+        return true;
+    }
+
+    switch (job->wide) {
+      case 1: LOAD_ELEMENTS(uint8_t) break;
+      case 2: LOAD_ELEMENTS(uint16_t) break;
+      case 4: LOAD_ELEMENTS(uint32_t) break;
+      default:
+        for (k = 0; k < n; ++k) {
+            uint64_t u;
+            memcpy(&u, p + k * step, sizeof(u));
+            if (u > INT64_MAX)
+                return false;
+            buf[k] = cast(int64_t, u);
+        }
+        break;
+    }
+    return true;
+}
+
+#undef LOAD_ELEMENTS
+
+
+static double Sum_Block(const double *buf, REBLEN n)
+{
+    double s0 = 0.0;
+    double s1 = 0.0;
+    double s2 = 0.0;
+    double s3 = 0.0;
+
+    REBLEN k;
+    for (k = 0; k + 4 <= n; k += 4) {
+        s0 += buf[k];
+        s1 += buf[k + 1];
+        s2 += buf[k + 2];
+        s3 += buf[k + 3];
+    }
+    for (; k < n; ++k)
+        s0 += buf[k];
+
+    return (s0 + s1) + (s2 + s3);
+}
+
+
+// Block totals are combined like a binary counter: `partial[level]` holds
+// the sum of 2^level blocks whenever bit `level` of `count` is set, and two
+// sums of the same size are added together as soon as both exist.
+//
+struct Reb_Pairwise {
+    double partial[64];
+    uint64_t count;
+};
+
+static void Pairwise_Add(struct Reb_Pairwise *pw, double block_total)
+{
+    uint64_t c = pw->count++;
+    int level = 0;
+    for (; c & 1; c >>= 1, ++level)
+        block_total = pw->partial[level] + block_total;
+    pw->partial[level] = block_total;
+}
+
+static double Pairwise_Total(const struct Reb_Pairwise *pw)
+{
+    double total = 0.0;
+    uint64_t c = pw->count;
+    int level = 0;
+    for (; c != 0; c >>= 1, ++level) {
+        if (c & 1)
+            total += pw->partial[level];
+    }
+    return total;
+}
+
+
+//
+//  Run_Vector_Job: C
+//
+// Do one reduction over one piece of a vector.  This runs on worker threads,
+// so it must not call the Rebol API (or fail()).
+//
+static void Run_Vector_Job(struct Reb_Vector_Job *job)
+{
+    double dbuf[VECTOR_BLOCK];
+    double dbuf2[VECTOR_BLOCK];
+    int64_t ibuf[VECTOR_BLOCK];
+    int64_t ibuf2[VECTOR_BLOCK];
+
+    struct Reb_Pairwise pw;
+    pw.count = 0;
+
+    job->overflow = false;
+    job->i = 0;
+    job->i_min = INT64_MAX;
+    job->i_max = INT64_MIN;
+    job->d = 0.0;
+    job->d_min = 0.0;
+    job->d_max = 0.0;
+
+    REBLEN done = 0;
+    while (done < job->len) {
+        REBLEN n = job->len - done;
+        if (n > VECTOR_BLOCK)
+            n = VECTOR_BLOCK;
+        const REBYTE *a = job->a + done * job->a_step;
+        const REBYTE *b = job->b + done * job->b_step;  // if dot product
+        REBLEN k;
+
+        switch (job->op) {
+          case VRED_SUM_INT:
+            if (not Load_Int64s(ibuf, job, a, job->a_step, n))
+                goto overflow;
+            for (k = 0; k < n; ++k) {
+                if (REB_I64_ADD_OF(job->i, ibuf[k], &job->i))
+                    goto overflow;
+            }
+            break;
+
+          case VRED_DOT_INT:
+            if (
+                not Load_Int64s(ibuf, job, a, job->a_step, n)
+                or not Load_Int64s(ibuf2, job, b, job->b_step, n)
+            ){
+                goto overflow;
+            }
+            for (k = 0; k < n; ++k) {
+                int64_t product;
+                if (
+                    REB_I64_MUL_OF(ibuf[k], ibuf2[k], &product)
+                    or REB_I64_ADD_OF(job->i, product, &job->i)
+                ){
+                    goto overflow;
+                }
+            }
+            break;
+
+          case VRED_SUM:
+            Load_Doubles(dbuf, job, a, job->a_step, n);
+            Pairwise_Add(&pw, Sum_Block(dbuf, n));
+            break;
+
+          case VRED_DOT:
+            Load_Doubles(dbuf, job, a, job->a_step, n);
+            Load_Doubles(dbuf2, job, b, job->b_step, n);
+            for (k = 0; k < n; ++k)
+                dbuf[k] *= dbuf2[k];
+            Pairwise_Add(&pw, Sum_Block(dbuf, n));
+            break;
+
+          case VRED_SQUARED_DEVIATIONS:
+            Load_Doubles(dbuf, job, a, job->a_step, n);
+            for (k = 0; k < n; ++k) {
+                double dev = dbuf[k] - job->center;
+                dbuf[k] = dev * dev;
+            }
+            Pairwise_Add(&pw, Sum_Block(dbuf, n));
+            break;
+
+          case VRED_MIN_MAX_INT:
+            if (not Load_Int64s(ibuf, job, a, job->a_step, n))
+                goto overflow;
+            for (k = 0; k < n; ++k) {
+                if (ibuf[k] < job->i_min)
+                    job->i_min = ibuf[k];
+                if (ibuf[k] > job->i_max)
+                    job->i_max = ibuf[k];
+            }
+            break;
+
+          case VRED_MIN_MAX:
+            Load_Doubles(dbuf, job, a, job->a_step, n);
+            if (done == 0)
+                job->d_min = job->d_max = dbuf[0];
+            for (k = 0; k < n; ++k) {
+                if (dbuf[k] < job->d_min)
+                    job->d_min = dbuf[k];
+                if (dbuf[k] > job->d_max)
+                    job->d_max = dbuf[k];
+            }
+            break;
+
+          case VRED_HISTOGRAM:
+            Load_Doubles(dbuf, job, a, job->a_step, n);
+            for (k = 0; k < n; ++k) {
+                double x = dbuf[k];
+                if (not (x >= job->low and x <= job->high))
+                    continue;  // outside (or NaN)
+                REBLEN bin = cast(REBLEN, (x - job->low) * job->scale);
+                if (bin >= job->bins)
+                    bin = job->bins - 1;  // x is `high`, or rounded up
+                ++job->counts[bin];
+            }
+            break;
+        }
+
+        done += n;
+    }
+
+    job->d = Pairwise_Total(&pw);
+    return;
+
+  overflow:
+    job->overflow = true;
+}
+
+
+#ifdef TO_WINDOWS
+    static DWORD WINAPI Vector_Job_Thread(LPVOID p) {
+        Run_Vector_Job(cast(struct Reb_Vector_Job*, p));
+        return 0;
+    }
+    typedef HANDLE REBTHR;
+#else
+    static void *Vector_Job_Thread(void *p) {
+        Run_Vector_Job(cast(struct Reb_Vector_Job*, p));
+        return nullptr;
+    }
+    typedef pthread_t REBTHR;
+#endif
+
+
+static REBLEN Num_Cpus(void)
+{
+  #ifdef TO_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+  #else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n < 1 ? 1 : cast(REBLEN, n);
+  #endif
+}
+
+
+//
+//  Reduce_Vector: C
+//
+// Run `job` over its whole vector, in pieces on several threads if it is
+// big enough, and leave the combined result in `job`.  Histogram counts are
+// added into job->counts (which must start zeroed).
+//
+static void Reduce_Vector(struct Reb_Vector_Job *job)
+{
+    REBLEN pieces = 1;
+    if (job->len >= VECTOR_THREAD_MIN) {
+        pieces = Num_Cpus();
+        if (pieces > 64)
+            pieces = 64;
+    }
+
+    if (pieces == 1) {
+        Run_Vector_Job(job);
+        return;
+    }
+
+    struct Reb_Vector_Job *jobs = rebAllocN(struct Reb_Vector_Job, pieces);
+    REBTHR *handles = rebAllocN(REBTHR, pieces);
+    bool *started = rebAllocN(bool, pieces);
+
+    int64_t *counts = nullptr;
+    if (job->op == VRED_HISTOGRAM) {  // each piece counts on its own
+        counts = rebAllocN(int64_t, job->bins * pieces);
+        memset(counts, 0, sizeof(int64_t) * job->bins * pieces);
+    }
+
+    // Pieces are whole numbers of blocks, except the last one.
+    //
+    REBLEN blocks = (job->len + VECTOR_BLOCK - 1) / VECTOR_BLOCK;
+    REBLEN per_piece = ((blocks + pieces - 1) / pieces) * VECTOR_BLOCK;
+
+    REBLEN t;
+    for (t = 0; t < pieces; ++t) {
+        REBLEN start = t * per_piece;
+        if (start > job->len)
+            start = job->len;
+        REBLEN len = job->len - start;
+        if (len > per_piece)
+            len = per_piece;
+
+        jobs[t] = *job;
+        jobs[t].a = job->a + start * job->a_step;
+        jobs[t].b = job->b + start * job->b_step;
+        jobs[t].len = len;
+        if (counts)
+            jobs[t].counts = counts + t * job->bins;
+
+        started[t] = false;
+        if (t == 0)
+            continue;  // job 0 runs on this thread
+
+      #ifdef TO_WINDOWS
+        handles[t] = CreateThread(
+            nullptr, 0, &Vector_Job_Thread, &jobs[t], 0, nullptr
+        );
+        started[t] = (handles[t] != nullptr);
+      #else
+        started[t] = (
+            pthread_create(
+                &handles[t], nullptr, &Vector_Job_Thread, &jobs[t]
+            ) == 0
+        );
+      #endif
+    }
+
+    for (t = 0; t < pieces; ++t) {
+        if (not started[t])
+            Run_Vector_Job(&jobs[t]);
+    }
+
+    for (t = 1; t < pieces; ++t) {
+        if (not started[t])
+            continue;
+      #ifdef TO_WINDOWS
+        WaitForSingleObject(handles[t], INFINITE);
+        CloseHandle(handles[t]);
+      #else
+        pthread_join(handles[t], nullptr);
+      #endif
+    }
+
+    // Combine the pieces' results in order.  (Empty pieces, which can only
+    // come at the end, have nothing to contribute to a minimum or maximum.)
+    //
+    job->overflow = jobs[0].overflow;
+    job->i = jobs[0].i;
+    job->i_min = jobs[0].i_min;
+    job->i_max = jobs[0].i_max;
+    job->d = jobs[0].d;
+    job->d_min = jobs[0].d_min;
+    job->d_max = jobs[0].d_max;
+    for (t = 1; t < pieces; ++t) {
+        struct Reb_Vector_Job *j = &jobs[t];
+        if (j->len == 0)
+            continue;
+
+        if (j->overflow or REB_I64_ADD_OF(job->i, j->i, &job->i))
+            job->overflow = true;
+        job->d += j->d;
+
+        if (j->i_min < job->i_min)
+            job->i_min = j->i_min;
+        if (j->i_max > job->i_max)
+            job->i_max = j->i_max;
+        if (j->d_min < job->d_min)
+            job->d_min = j->d_min;
+        if (j->d_max > job->d_max)
+            job->d_max = j->d_max;
+    }
+
+    if (counts) {
+        REBLEN bin;
+        for (t = 1; t < pieces; ++t) {
+            for (bin = 0; bin < job->bins; ++bin)
+                counts[bin] += counts[t * job->bins + bin];
+        }
+        memcpy(job->counts, counts, sizeof(int64_t) * job->bins);
+        rebFree(counts);
+    }
+
+    rebFree(started);
+    rebFree(handles);
+    rebFree(jobs);
+}
+
+
+static void Init_Vector_Job(
+    struct Reb_Vector_Job *job,
+    enum Reb_Vector_Reduce op,
+    const REBVAL *vec
+){
+    if (not IS_VECTOR(vec))
+        fail (vec);
+
+    job->op = op;
+    job->integral = VAL_VECTOR_INTEGRAL(vec);
+    job->sign = VAL_VECTOR_SIGN(vec);
+    job->wide = VAL_VECTOR_WIDE(vec);
+    job->a = VAL_VECTOR_HEAD(vec);
+    job->a_step = VAL_VECTOR_STRIDE(vec) * job->wide;
+    job->b = job->a;  // (only read for dot products, which set it)
+    job->b_step = 0;
+    job->len = VAL_VECTOR_LEN_AT(vec);
+    job->counts = nullptr;
+}
+
+
+static REBVAL *Init_Vector_Total(REBVAL *out, struct Reb_Vector_Job *job)
+{
+    Reduce_Vector(job);
+    if (not job->integral)
+        return Init_Decimal(out, job->d);
+
+    if (job->overflow)
+        fail (Error_Overflow_Raw());
+    return Init_Integer(out, job->i);
+}
+
+
+//
+//  export vector-sum: native [
+//
+//  {Total of a VECTOR!'s elements (exact for integers, fails on overflow)}
+//
+//      return: [integer! decimal!]
+//      vector [any-value!]
+//  ]
+//
+REBNATIVE(vector_sum)
+{
+    VECTOR_INCLUDE_PARAMS_OF_VECTOR_SUM;
+
+    struct Reb_Vector_Job job;
+    Init_Vector_Job(&job, VRED_SUM_INT, ARG(vector));
+    if (not job.integral)
+        job.op = VRED_SUM;
+
+    return Init_Vector_Total(D_OUT, &job);
+}
+
+
+//
+//  export vector-dot: native [
+//
+//  {Dot product of two VECTOR!s of the same element type and length}
+//
+//      return: [integer! decimal!]
+//      vector1 [any-value!]
+//      vector2 [any-value!]
+//  ]
+//
+REBNATIVE(vector_dot)
+{
+    VECTOR_INCLUDE_PARAMS_OF_VECTOR_DOT;
+
+    REBVAL *v1 = ARG(vector1);
+    REBVAL *v2 = ARG(vector2);
+
+    struct Reb_Vector_Job job;
+    Init_Vector_Job(&job, VRED_DOT_INT, v1);
+    if (not job.integral)
+        job.op = VRED_DOT;
+
+    if (not IS_VECTOR(v2))
+        fail (v2);
+    if (
+        VAL_VECTOR_INTEGRAL(v2) != job.integral
+        or VAL_VECTOR_SIGN(v2) != job.sign
+        or VAL_VECTOR_WIDE(v2) != job.wide
+    ){
+        fail (Error_Not_Same_Type_Raw());
+    }
+    if (VAL_VECTOR_LEN_AT(v2) != job.len)
+        fail ("VECTOR-DOT needs vectors of the same length");
+    job.b = VAL_VECTOR_HEAD(v2);
+    job.b_step = VAL_VECTOR_STRIDE(v2) * job.wide;
+
+    return Init_Vector_Total(D_OUT, &job);
+}
+
+
+static REB_R Vector_Min_Max(REBVAL *out, const REBVAL *vec, bool maximum)
+{
+    struct Reb_Vector_Job job;
+    Init_Vector_Job(&job, VRED_MIN_MAX_INT, vec);
+    if (job.len == 0)
+        return nullptr;
+
+    if (not job.integral) {
+        job.op = VRED_MIN_MAX;
+        Reduce_Vector(&job);
+        return Init_Decimal(out, maximum ? job.d_max : job.d_min);
+    }
+
+    Reduce_Vector(&job);
+    if (job.overflow)
+        fail ("64-bit integer out of range for INTEGER!");
+    return Init_Integer(out, maximum ? job.i_max : job.i_min);
+}
+
+
+//
+//  export vector-minimum: native [
+//
+//  {Smallest element of a VECTOR!, or null if it is empty}
+//
+//      return: [<opt> integer! decimal!]
+//      vector [any-value!]
+//  ]
+//
+REBNATIVE(vector_minimum)
+{
+    VECTOR_INCLUDE_PARAMS_OF_VECTOR_MINIMUM;
+
+    return Vector_Min_Max(D_OUT, ARG(vector), false);
+}
+
+
+//
+//  export vector-maximum: native [
+//
+//  {Largest element of a VECTOR!, or null if it is empty}
+//
+//      return: [<opt> integer! decimal!]
+//      vector [any-value!]
+//  ]
+//
+REBNATIVE(vector_maximum)
+{
+    VECTOR_INCLUDE_PARAMS_OF_VECTOR_MAXIMUM;
+
+    return Vector_Min_Max(D_OUT, ARG(vector), true);
+}
+
+
+static double Vector_Mean(struct Reb_Vector_Job *job)
+{
+    job->op = VRED_SUM;  // in decimal, even for integer vectors
+    Reduce_Vector(job);
+    return job->d / job->len;
+}
+
+
+//
+//  export vector-mean: native [
+//
+//  {Arithmetic mean of a VECTOR!'s elements, or null if it is empty}
+//
+//      return: [<opt> decimal!]
+//      vector [any-value!]
+//  ]
+//
+REBNATIVE(vector_mean)
+{
+    VECTOR_INCLUDE_PARAMS_OF_VECTOR_MEAN;
+
+    struct Reb_Vector_Job job;
+    Init_Vector_Job(&job, VRED_SUM, ARG(vector));
+    if (job.len == 0)
+        return nullptr;
+
+    return Init_Decimal(D_OUT, Vector_Mean(&job));
+}
+
+
+//
+//  export vector-variance: native [
+//
+//  {Population variance of a VECTOR!'s elements (null if too few)}
+//
+//      return: [<opt> decimal!]
+//      vector [any-value!]
+//      /sample "Divide by one less than the length (sample variance)"
+//  ]
+//
+REBNATIVE(vector_variance)
+{
+    VECTOR_INCLUDE_PARAMS_OF_VECTOR_VARIANCE;
+
+    struct Reb_Vector_Job job;
+    Init_Vector_Job(&job, VRED_SUM, ARG(vector));
+
+    REBLEN divisor = REF(sample) ? job.len - 1 : job.len;
+    if (job.len == 0 or divisor == 0)
+        return nullptr;
+
+    job.center = Vector_Mean(&job);
+    job.op = VRED_SQUARED_DEVIATIONS;
+    Reduce_Vector(&job);
+    return Init_Decimal(D_OUT, job.d / divisor);
+}
+
+
+//
+//  export vector-histogram: native [
+//
+//  {Count a VECTOR!'s elements falling in equal-width bins from LOW to HIGH}
+//
+//      return: "Vector of signed 64-bit counts, one per bin"
+//          [any-value!]
+//      vector [any-value!]
+//      bins [integer!]
+//      low "Start of the first bin"
+//          [integer! decimal!]
+//      high "End of the last bin (included in it), values outside ignored"
+//          [integer! decimal!]
+//  ]
+//
+REBNATIVE(vector_histogram)
+{
+    VECTOR_INCLUDE_PARAMS_OF_VECTOR_HISTOGRAM;
+
+    struct Reb_Vector_Job job;
+    Init_Vector_Job(&job, VRED_HISTOGRAM, ARG(vector));
+
+    if (VAL_INT64(ARG(bins)) < 1 or VAL_INT64(ARG(bins)) > INT32_MAX)
+        fail (PAR(bins));
+    job.bins = VAL_INT32(ARG(bins));
+
+    job.low = Dec64(ARG(low));
+    job.high = Dec64(ARG(high));
+    if (not (job.high > job.low))
+        fail ("VECTOR-HISTOGRAM needs HIGH to be greater than LOW");
+    job.scale = job.bins / (job.high - job.low);
+
+    job.counts = rebAllocN(int64_t, job.bins);
+    memset(job.counts, 0, sizeof(int64_t) * job.bins);
+    Reduce_Vector(&job);
+
+    REBSER *bin = Make_Binary(job.bins * sizeof(int64_t));
+    memcpy(BIN_HEAD(bin), job.counts, job.bins * sizeof(int64_t));
+    SET_SERIES_LEN(bin, job.bins * sizeof(int64_t));
+    TERM_SERIES(bin);
+    rebFree(job.counts);
+
+    return Init_Vector(D_OUT, bin, true, true, 64);
+}
+
+
+#define VECTOR_RANDOM_CHUNK 256  // 64-bit draws requested at a time
+
+//
+//  export vector-random: native [
+//
+//  {Fill a VECTOR! with random numbers, as RANDOM would give for MAX}
+//
+//      return: [any-value!]
+//      vector [any-value!]
+//      max "Integers 1 to MAX (MAX to -1 if negative), decimals 0 up to MAX"
+//          [integer! decimal!]
+//      /secure "Use the ChaCha20 generator of RANDOM/SECURE"
+//  ]
+//
+REBNATIVE(vector_random)
+//
+// Simulations can need more random numbers than a RANDOM call per element
+// can deliver.  This draws them in batches from the core's generator (see
+// RANDOM-GENERATOR) and writes them straight into the packed data.
+{
+    VECTOR_INCLUDE_PARAMS_OF_VECTOR_RANDOM;
+
+    REBVAL *vec = ARG(vector);
+    if (not IS_VECTOR(vec))
+        fail (PAR(vector));
+    Fail_If_Vector_Read_Only(vec);
+
+    bool secure = did REF(secure);
+    bool integral = VAL_VECTOR_INTEGRAL(vec);
+    REBYTE wide = VAL_VECTOR_WIDE(vec);
+    REBLEN step = VAL_VECTOR_STRIDE(vec) * wide;
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    REBYTE *p = VAL_VECTOR_HEAD(vec);
+
+    REBI64 max = 0;
+    REBU64 range = 0;  // magnitude of MAX for integer vectors
+    REBU64 limit = 0;  // rejection limit so `u % range` has no bias
+    REBDEC dmax = 0.0;
+
+    if (integral) {
+        if (not IS_INTEGER(ARG(max)))
+            fail (PAR(max));
+        max = VAL_INT64(ARG(max));
+
+        REBI64 hi;
+        REBI64 lo;
+        if (VAL_VECTOR_SIGN(vec)) {
+            hi = (wide == 8) ? INT64_MAX : (cast(REBI64, 1) << (wide * 8 - 1)) - 1;
+            lo = -hi - 1;
+        }
+        else {
+            hi = (wide == 8) ? INT64_MAX : (cast(REBI64, 1) << (wide * 8)) - 1;
+            lo = 0;
+        }
+        if (max < lo or max > hi)
+            fail (Error_Out_Of_Range(ARG(max)));
+
+        range = (max < 0) ? -cast(REBU64, max) : cast(REBU64, max);
+        if (range != 0)
+            limit = UINT64_MAX - (UINT64_MAX - range + 1) % range;
+    }
+    else
+        dmax = Dec64(ARG(max));
+
+    REBU64 buf[VECTOR_RANDOM_CHUNK];
+
+    REBLEN n = 0;
+    while (n < len) {
+        REBLEN chunk = len - n;
+        if (chunk > VECTOR_RANDOM_CHUNK)
+            chunk = VECTOR_RANDOM_CHUNK;
+        Random_Fill_U64(buf, chunk, secure);
+
+        REBLEN i;
+        for (i = 0; i < chunk; ++i, p += step) {
+            REBU64 u = buf[i];
+
+            if (not integral) {  // top 53 bits give an exact double in [0, 1)
+                REBDEC d = cast(REBDEC, u >> 11) * (1.0 / 9007199254740992.0);
+                d *= dmax;
+                if (wide == 4) {
+                    REBD32 f = cast(REBD32, d);
+                    memcpy(p, &f, sizeof(f));
+                }
+                else
+                    memcpy(p, &d, sizeof(d));
+                continue;
+            }
+
+            REBI64 r = 0;
+            if (range != 0) {
+                while (u > limit)
+                    u = Random_U64(secure);
+                r = cast(REBI64, u % range + 1);
+                if (max < 0)
+                    r = -r;
+            }
+
+            // In range for the element type, so truncating the two's
+            // complement bits gives the right signed or unsigned value.
+            //
+            switch (wide) {
+              case 1: {
+                uint8_t b = cast(uint8_t, r);
+                memcpy(p, &b, sizeof(b));
+                break; }
+
+              case 2: {
+                uint16_t h = cast(uint16_t, r);
+                memcpy(p, &h, sizeof(h));
+                break; }
+
+              case 4: {
+                uint32_t w = cast(uint32_t, r);
+                memcpy(p, &w, sizeof(w));
+                break; }
+
+              default:
+                assert(wide == 8);
+                memcpy(p, &r, sizeof(r));
+                break;
+            }
+        }
+        n += chunk;
+    }
+
+    RETURN (vec);
+}
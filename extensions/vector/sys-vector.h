@@ -27,6 +27,17 @@
 // (bit width, signedness, integral-ness) to be stored in addition to a
 // BINARY! of the vector's bytes.
 //
+// A vector may also be a "view" of another vector's bytes: a run of COUNT
+// elements starting at some byte offset and STRIDE elements apart, sharing
+// the BINARY! (so writes through either are seen by both).  The offset is
+// the index of the BINARY! cell, and the count and stride live alongside the
+// sign/integral/wide bits.  An ordinary vector is just a view of all of its
+// binary with a stride of 1.
+//
+// (If the vector is wrapping memory Rebol does not control--e.g. a buffer a
+// C library gave back through the FFI--then instead of a BINARY! the data is
+// a HANDLE! with a pointer to the first element, as STRUCT!s do.)
+//
 //=//// NOTES /////////////////////////////////////////////////////////////=//
 //
 // * See %extensions/vector/README.md
@@ -34,19 +45,27 @@
 
 extern REBTYP *EG_Vector_Type;
 
-#define VAL_VECTOR_BINARY(v) \
-    VAL(PAYLOAD(Any, (v)).first.node)  // pairing[0]
+#define VAL_VECTOR_DATA(v) \
+    VAL(PAYLOAD(Any, (v)).first.node)  // pairing[0], BINARY! or HANDLE!
 
 #define VAL_VECTOR_SIGN_INTEGRAL_WIDE(v) \
     PAIRING_KEY(VAL(PAYLOAD(Any, (v)).first.node))  // pairing[1]
 
-#define VAL_VECTOR_SIGN(v) \
-    PAYLOAD(Any, VAL_VECTOR_SIGN_INTEGRAL_WIDE(v)).first.flag
+#define VECTOR_WIDE_MASK 0x0F
+#define VECTOR_FLAG_SIGN 0x10
+#define VECTOR_FLAG_INTEGRAL 0x20
+
+#define VAL_VECTOR_BITS(v) \
+    EXTRA(Any, VAL_VECTOR_SIGN_INTEGRAL_WIDE(v)).u32
+
+inline static bool VAL_VECTOR_SIGN(const REBCEL *v) {
+    assert(CELL_CUSTOM_TYPE(v) == EG_Vector_Type);
+    return did (VAL_VECTOR_BITS(v) & VECTOR_FLAG_SIGN);
+}
 
 inline static bool VAL_VECTOR_INTEGRAL(const REBCEL *v) {
     assert(CELL_CUSTOM_TYPE(v) == EG_Vector_Type);
-    REBVAL *siw = VAL_VECTOR_SIGN_INTEGRAL_WIDE(v);
-    if (PAYLOAD(Any, siw).second.flag != 0)
+    if (VAL_VECTOR_BITS(v) & VECTOR_FLAG_INTEGRAL)
         return true;
 
     assert(VAL_VECTOR_SIGN(v));
@@ -54,41 +73,80 @@ inline static bool VAL_VECTOR_INTEGRAL(const REBCEL *v) {
 }
 
 inline static REBYTE VAL_VECTOR_WIDE(const REBCEL *v) {  // "wide" REBSER term
-    int32_t wide = EXTRA(Any, VAL_VECTOR_SIGN_INTEGRAL_WIDE(v)).i32;
-    assert(wide == 1 or wide == 2 or wide == 3 or wide == 4);
+    REBYTE wide = VAL_VECTOR_BITS(v) & VECTOR_WIDE_MASK;
+    assert(wide == 1 or wide == 2 or wide == 4 or wide == 8);
     return wide;
 }
 
 #define VAL_VECTOR_BITSIZE(v) \
     (VAL_VECTOR_WIDE(v) * 8)
 
+inline static bool IS_VECTOR(const RELVAL *v) {  // QUOTED! doesn't count
+    return IS_CUSTOM(v) and CELL_CUSTOM_TYPE(v) == EG_Vector_Type;
+}
+
+// Elements between one element of the vector and the next (1 unless it is
+// a strided view, e.g. a column of a row-major matrix)
+//
+inline static REBLEN VAL_VECTOR_STRIDE(const REBCEL *v) {
+    assert(CELL_CUSTOM_TYPE(v) == EG_Vector_Type);
+    return PAYLOAD(Any, VAL_VECTOR_SIGN_INTEGRAL_WIDE(v)).second.u;
+}
+
+// Pointer to the vector's first element.  Code which goes on to read the
+// elements after it as a C array must check VAL_VECTOR_STRIDE() is 1.
+//
 inline static REBYTE *VAL_VECTOR_HEAD(const REBCEL *v) {
     assert(CELL_CUSTOM_TYPE(v) == EG_Vector_Type);
-    return VAL_BIN_HEAD(VAL(PAYLOAD(Any, v).first.node));
+    REBVAL *data = VAL_VECTOR_DATA(v);
+    if (IS_BINARY(data))
+        return VAL_BIN_AT(data);
+    return VAL_HANDLE_POINTER(REBYTE, data);
+}
+
+// The BINARY! whose data the vector uses, or nullptr if it wraps C memory
+//
+inline static REBBIN *VAL_VECTOR_BINARY(const REBCEL *v) {
+    assert(CELL_CUSTOM_TYPE(v) == EG_Vector_Type);
+    REBVAL *data = VAL_VECTOR_DATA(v);
+    if (IS_BINARY(data))
+        return VAL_BINARY(data);
+    return nullptr;
+}
+
+inline static void Fail_If_Vector_Read_Only(const REBCEL *v) {
+    REBVAL *data = VAL_VECTOR_DATA(v);
+    if (IS_BINARY(data))  // must honor protection of the BINARY! it uses
+        FAIL_IF_READ_ONLY(data);
+}
+
+inline static REBYTE *VAL_VECTOR_AT(const REBCEL *v, REBLEN n) {
+    return VAL_VECTOR_HEAD(v) + n * VAL_VECTOR_STRIDE(v) * VAL_VECTOR_WIDE(v);
 }
 
 inline static REBLEN VAL_VECTOR_LEN_AT(const REBCEL *v) {
     assert(CELL_CUSTOM_TYPE(v) == EG_Vector_Type);
-    return VAL_LEN_HEAD(VAL_VECTOR_BINARY(v)) / VAL_VECTOR_WIDE(v);
+    return PAYLOAD(Any, VAL_VECTOR_SIGN_INTEGRAL_WIDE(v)).first.u;
 }
 
 #define VAL_VECTOR_INDEX(v) 0  // !!! Index not currently supported
 #define VAL_VECTOR_LEN_HEAD(v) VAL_VECTOR_LEN_AT(v)
 
-inline static REBVAL *Init_Vector(
+// Gives back the pairing cell the caller must initialize with the data, as
+// a BINARY! or HANDLE!.
+//
+inline static REBVAL *Init_Vector_Core(
     RELVAL *out,
-    REBBIN *bin,
     bool sign,
     bool integral,
-    REBYTE bitsize
+    REBYTE bitsize,
+    REBLEN count,
+    REBLEN stride
 ){
     RESET_CUSTOM_CELL(out, EG_Vector_Type, CELL_FLAG_FIRST_IS_NODE);
 
     REBVAL *paired = Alloc_Pairing();
 
-    Init_Binary(paired, bin);
-    assert(SER_LEN(bin) % (bitsize / 8) == 0);
-
     REBVAL *siw = RESET_CELL(
         PAIRING_KEY(paired),
         REB_V_SIGN_INTEGRAL_WIDE,
@@ -96,15 +154,122 @@ inline static REBVAL *Init_Vector(
     );
     mutable_MIRROR_BYTE(siw) = REB_LOGIC;  // fools Is_Bindable()
     assert(bitsize == 8 or bitsize == 16 or bitsize == 32 or bitsize == 64);
-    PAYLOAD(Any, siw).first.flag = sign;
-    PAYLOAD(Any, siw).second.flag = integral;
-    EXTRA(Any, siw).i32 = bitsize / 8;  // e.g. VAL_VECTOR_WIDE()
+    EXTRA(Any, siw).u32 = (bitsize / 8)  // e.g. VAL_VECTOR_WIDE()
+        | (sign ? VECTOR_FLAG_SIGN : 0)
+        | (integral ? VECTOR_FLAG_INTEGRAL : 0);
+    PAYLOAD(Any, siw).first.u = count;
+    PAYLOAD(Any, siw).second.u = stride;
 
     Manage_Pairing(paired);
     INIT_VAL_NODE(out, paired);
+    return paired;
+}
+
+inline static REBVAL *Init_Vector(
+    RELVAL *out,
+    REBBIN *bin,
+    bool sign,
+    bool integral,
+    REBYTE bitsize
+){
+    assert(SER_LEN(bin) % (bitsize / 8) == 0);
+    REBVAL *data = Init_Vector_Core(
+        out, sign, integral, bitsize, SER_LEN(bin) / (bitsize / 8), 1
+    );
+    Init_Binary(data, bin);
+    return KNOWN(out);
+}
+
+// Wrap COUNT elements of memory at `ptr`, which must stay valid for as long
+// as the vector (or any view of it) is used.
+//
+inline static REBVAL *Init_Vector_External(
+    RELVAL *out,
+    REBYTE *ptr,
+    bool sign,
+    bool integral,
+    REBYTE bitsize,
+    REBLEN count,
+    REBLEN stride
+){
+    REBVAL *data = Init_Vector_Core(
+        out, sign, integral, bitsize, count, stride
+    );
+    REBLEN span = count == 0 ? 1 : ((count - 1) * stride + 1) * (bitsize / 8);
+    Init_Handle_Cdata(data, ptr, span);  // (HANDLE! length can't be 0)
     return KNOWN(out);
 }
 
+// COUNT elements of `vec`, starting at its 0-based element `index` and
+// taking every `stride`th one, sharing its data.  (Caller checks bounds.)
+//
+inline static REBVAL *Init_Vector_View(
+    RELVAL *out,
+    const REBCEL *vec,
+    REBLEN index,
+    REBLEN count,
+    REBLEN stride
+){
+    const REBVAL *data = VAL_VECTOR_DATA(vec);
+    if (not IS_BINARY(data))
+        return Init_Vector_External(
+            out,
+            VAL_VECTOR_AT(vec, index),
+            VAL_VECTOR_SIGN(vec),
+            VAL_VECTOR_INTEGRAL(vec),
+            VAL_VECTOR_BITSIZE(vec),
+            count,
+            VAL_VECTOR_STRIDE(vec) * stride
+        );
+
+    REBLEN offset = VAL_INDEX(data)
+        + (VAL_VECTOR_AT(vec, index) - VAL_VECTOR_HEAD(vec));
+
+    REBVAL *view_data = Init_Vector_Core(
+        out,
+        VAL_VECTOR_SIGN(vec),
+        VAL_VECTOR_INTEGRAL(vec),
+        VAL_VECTOR_BITSIZE(vec),
+        count,
+        VAL_VECTOR_STRIDE(vec) * stride
+    );
+    Init_Binary_At(view_data, VAL_BINARY(data), offset);
+    return KNOWN(out);
+}
+
+
+// Element N of the vector as an INTEGER! or DECIMAL!
+//
+extern REBVAL *Get_Vector_At(RELVAL *out, const REBCEL *vec, REBLEN n);
+
+
+// Element-wise operations done natively on the packed data (see notes in
+// %t-vector.c).  Comparisons give 1 or 0 in the vector's element type.
+//
+enum Reb_Vector_Op {
+    VOP_ADD,
+    VOP_SUBTRACT,
+    VOP_MULTIPLY,
+    VOP_DIVIDE,
+    VOP_MINIMUM,
+    VOP_MAXIMUM,
+    VOP_EQUAL,
+    VOP_NOT_EQUAL,
+    VOP_LESSER,
+    VOP_LESSER_OR_EQUAL,
+    VOP_GREATER,
+    VOP_GREATER_OR_EQUAL
+};
+
+extern enum Reb_Vector_Op Vector_Op_From_Word(const REBVAL *word);
+extern REBVAL *Vector_Math(
+    REBVAL *out,
+    enum Reb_Vector_Op op,
+    const REBVAL *vec,
+    const REBVAL *arg,
+    bool in_place
+);
+
 
 // !!! These hooks allow the REB_VECTOR cell type to dispatch to code in the
 // VECTOR! extension if it is loaded.
@@ -37,7 +37,7 @@
 //
 REBVAL *Get_Vector_At(RELVAL *out, const REBCEL *vec, REBLEN n)
 {
-    REBYTE *data = VAL_VECTOR_HEAD(vec);
+    REBYTE *data = VAL_VECTOR_AT(vec, n);
 
     bool integral = VAL_VECTOR_INTEGRAL(vec);
     bool sign = VAL_VECTOR_SIGN(vec);
@@ -47,12 +47,12 @@ REBVAL *Get_Vector_At(RELVAL *out, const REBCEL *vec, REBLEN n)
         switch (bitsize) {
           case 32: {
             float f;
-            memcpy(&f, cast(float*, data) + n, sizeof(f));
+            memcpy(&f, data, sizeof(f));
             return Init_Decimal(out, f); }
 
           case 64: {
             double d;
-            memcpy(&d, cast(double*, data) + n, sizeof(d));
+            memcpy(&d, data, sizeof(d));
             return Init_Decimal(out, d); }
         }
     }
@@ -61,22 +61,22 @@ REBVAL *Get_Vector_At(RELVAL *out, const REBCEL *vec, REBLEN n)
             switch (bitsize) {
               case 8: {
                 int8_t i;
-                memcpy(&i, cast(int8_t*, data) + n, sizeof(i));
+                memcpy(&i, data, sizeof(i));
                 return Init_Integer(out, i); }
 
               case 16: {
                 int16_t i;
-                memcpy(&i, cast(int16_t*, data) + n, sizeof(i));
+                memcpy(&i, data, sizeof(i));
                 return Init_Integer(out, i); }
 
               case 32: {
                 int32_t i;
-                memcpy(&i, cast(int32_t*, data) + n, sizeof(i));
+                memcpy(&i, data, sizeof(i));
                 return Init_Integer(out, i); }
 
               case 64: {
                 int64_t i;
-                memcpy(&i, cast(int64_t*, data) + n, sizeof(i));
+                memcpy(&i, data, sizeof(i));
                 return Init_Integer(out, i); }
             }
         }
@@ -84,22 +84,22 @@ REBVAL *Get_Vector_At(RELVAL *out, const REBCEL *vec, REBLEN n)
             switch (bitsize) {
               case 8: {
                 uint8_t i;
-                memcpy(&i, cast(uint8_t*, data) + n, sizeof(i));
+                memcpy(&i, data, sizeof(i));
                 return Init_Integer(out, i); }
 
               case 16: {
                 uint16_t i;
-                memcpy(&i, cast(uint16_t*, data) + n, sizeof(i));
+                memcpy(&i, data, sizeof(i));
                 return Init_Integer(out, i); }
 
               case 32: {
                 uint32_t i;
-                memcpy(&i, cast(uint32_t*, data) + n, sizeof(i));
+                memcpy(&i, data, sizeof(i));
                 return Init_Integer(out, i); }
 
               case 64: {
                 int64_t i;
-                memcpy(&i, cast(int64_t*, data) + n, sizeof(i));
+                memcpy(&i, data, sizeof(i));
                 if (i < 0)
                     fail ("64-bit integer out of range for INTEGER!");
 
@@ -115,7 +115,7 @@ REBVAL *Get_Vector_At(RELVAL *out, const REBCEL *vec, REBLEN n)
 static void Set_Vector_At(const REBCEL *vec, REBLEN n, const RELVAL *set) {
     assert(IS_INTEGER(set) or IS_DECIMAL(set));  // caller should error
 
-    REBYTE *data = VAL_VECTOR_HEAD(vec);
+    REBYTE *data = VAL_VECTOR_AT(vec, n);
 
     bool integral = VAL_VECTOR_INTEGRAL(vec);
     bool sign = VAL_VECTOR_SIGN(vec);
@@ -134,11 +134,11 @@ static void Set_Vector_At(const REBCEL *vec, REBLEN n, const RELVAL *set) {
           case 32: {
             // Can't be "out of range", just loses precision
             REBD32 d = cast(REBD32, d64);
-            memcpy(cast(REBD32*, data) + n, &d, sizeof(d));
+            memcpy(data, &d, sizeof(d));
             return; }
 
           case 64: {
-            memcpy(cast(REBDEC*, data) + n, &d64, sizeof(d64));
+            memcpy(data, &d64, sizeof(d64));
             return; }
         }
     }
@@ -157,26 +157,26 @@ static void Set_Vector_At(const REBCEL *vec, REBLEN n, const RELVAL *set) {
                 if (i64 < INT8_MIN or i64 > INT8_MAX)
                     goto out_of_range;
                 int8_t i = cast(int8_t, i64);
-                memcpy(cast(int8_t*, data) + n, &i, sizeof(i));
+                memcpy(data, &i, sizeof(i));
                 return; }
 
               case 16: {
                 if (i64 < INT16_MIN or i64 > INT16_MAX)
                     goto out_of_range;
                 int16_t i = cast(int16_t, i64);
-                memcpy(cast(int16_t*, data) + n, &i, sizeof(i));
+                memcpy(data, &i, sizeof(i));
                 return; }
 
               case 32: {
                 if (i64 < INT32_MIN or i64 > INT32_MAX)
                     goto out_of_range;
                 int32_t i = cast(int32_t, i64);
-                memcpy(cast(int32_t*, data) + n, &i, sizeof(i));
+                memcpy(data, &i, sizeof(i));
                 return; }
 
               case 64: {
                 // type uses full range
-                memcpy(cast(int64_t*, data) + n, &i64, sizeof(i64));
+                memcpy(data, &i64, sizeof(i64));
                 return; }
             }
         }
@@ -189,26 +189,26 @@ static void Set_Vector_At(const REBCEL *vec, REBLEN n, const RELVAL *set) {
                 if (i64 > UINT8_MAX)
                     goto out_of_range;
                 uint8_t u = cast(uint8_t, i64);
-                memcpy(cast(uint8_t*, data) + n, &u, sizeof(u));
+                memcpy(data, &u, sizeof(u));
                 return; }
 
               case 16: {
                 if (i64 > UINT16_MAX)
                     goto out_of_range;
                 uint16_t u = cast(uint16_t, i64);
-                memcpy(cast(uint16_t*, data) + n, &u, sizeof(u));
+                memcpy(data, &u, sizeof(u));
                 return; }
 
               case 32: {
                 if (i64 > UINT32_MAX)
                     goto out_of_range;
                 uint32_t u = cast(uint32_t, i64);
-                memcpy(cast(uint32_t*, data) + n, &u, sizeof(u));
+                memcpy(data, &u, sizeof(u));
                 return; }
 
               case 64: {
-                uint32_t u = cast(uint32_t, i64);
-                memcpy(cast(uint64_t*, data) + n, &u, sizeof(u));
+                uint64_t u = cast(uint64_t, i64);
+                memcpy(data, &u, sizeof(u));
                 return; }
             }
         }
@@ -266,14 +266,12 @@ void Set_Vector_Row(const REBCEL *vec, const REBVAL *blk) // !!! can not be BLOC
 //
 REBARR *Vector_To_Array(const REBVAL *vect)
 {
-    REBLEN len = VAL_LEN_AT(vect);
-    if (len <= 0)
-        fail (vect);
+    REBLEN len = VAL_VECTOR_LEN_AT(vect);
 
     REBARR *arr = Make_Array(len);
     RELVAL *dest = ARR_HEAD(arr);
     REBLEN n;
-    for (n = VAL_INDEX(vect); n < VAL_LEN_HEAD(vect); ++n, ++dest)
+    for (n = 0; n < len; ++n, ++dest)
         Get_Vector_At(dest, vect, n);
 
     TERM_ARRAY_LEN(arr, len);
@@ -347,6 +345,630 @@ void Shuffle_Vector(REBVAL *vect, bool secure)
 }
 
 
+//=//// ELEMENT-WISE MATH /////////////////////////////////////////////////=//
+//
+// ADD, SUBTRACT, MULTIPLY and DIVIDE of a VECTOR! (and VECTOR-MATH, which
+// adds MINIMUM, MAXIMUM, comparisons and in-place results) run over the
+// packed data directly, instead of through an INTEGER! or DECIMAL! cell for
+// each element.  The other operand is a vector with the same element type
+// and length, or a number that is applied to every element.
+//
+// Integer results wrap around at the element size, the way the C types and
+// SIMD instructions do.  Comparisons give 1 where true and 0 where false in
+// the vector's own element type, so a result can be used as a mask by
+// multiplying with it.  Integer division by zero is an error, but decimals
+// divide as IEEE-754 does (giving infinities or NaN).
+//
+// On x86 the combinations SSE2 has instructions for (which is most of them
+// for elements up to 32 bits) are done 16 bytes at a time.  Every x86-64 CPU
+// has SSE2, so that is decided at compile time.  The rest are plain loops.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+
+#if !defined(REBOL_NO_VECTOR_SIMD) && (defined(__SSE2__) \
+    || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+
+    #define VECTOR_SIMD_X86
+    #include <emmintrin.h>
+
+// Choose `yes` where the mask lanes are all ones, else `no`
+//
+static inline __m128i Select_Sse2(__m128i mask, __m128i yes, __m128i no)
+  { return _mm_or_si128(_mm_and_si128(mask, yes), _mm_andnot_si128(mask, no)); }
+
+// Signed "greater than" mask for 1, 2 or 4 byte lanes.  (Unsigned lanes are
+// compared by flipping their top bits first.)
+//
+static inline __m128i Greater_Sse2(REBYTE wide, __m128i x, __m128i y) {
+    switch (wide) {
+      case 1: return _mm_cmpgt_epi8(x, y);
+      case 2: return _mm_cmpgt_epi16(x, y);
+      default: return _mm_cmpgt_epi32(x, y);
+    }
+}
+
+static inline __m128i Equal_Sse2(REBYTE wide, __m128i x, __m128i y) {
+    switch (wide) {
+      case 1: return _mm_cmpeq_epi8(x, y);
+      case 2: return _mm_cmpeq_epi16(x, y);
+      default: return _mm_cmpeq_epi32(x, y);
+    }
+}
+
+#define PS(v) _mm_castsi128_ps(v)
+#define PD(v) _mm_castsi128_pd(v)
+#define SI_PS(v) _mm_castps_si128(v)
+#define SI_PD(v) _mm_castpd_si128(v)
+
+// `x` is 16 bytes of `a` and `y` is the same of `b` (or the broadcast number)
+//
+#define VECTOR_LOOP_SSE2(expr) \
+    for (; i + 16 <= bytes; i += 16) { \
+        __m128i x = _mm_loadu_si128(cast(const __m128i*, a + i)); \
+        __m128i y = splat ? bcast \
+            : _mm_loadu_si128(cast(const __m128i*, b + i)); \
+        _mm_storeu_si128(cast(__m128i*, out + i), (expr)); \
+    }
+
+
+//
+//  Vector_Math_Sse2: C
+//
+// Do as many whole 16-byte blocks as there are, if SSE2 has what the
+// operation needs for this element type.  Returns how many bytes were done.
+//
+static REBLEN Vector_Math_Sse2(
+    enum Reb_Vector_Op op,
+    bool integral,
+    bool sign,
+    REBYTE wide,
+    REBYTE *out,
+    const REBYTE *a,
+    const REBYTE *b,  // one element if `splat`
+    bool splat,
+    REBLEN bytes
+){
+    REBYTE repeated[16];
+    __m128i bcast = _mm_setzero_si128();
+    if (splat) {
+        REBLEN n;
+        for (n = 0; n < 16; n += wide)
+            memcpy(repeated + n, b, wide);
+        bcast = _mm_loadu_si128(cast(const __m128i*, repeated));
+    }
+
+    REBLEN i = 0;
+
+    if (not integral and wide == 4) {
+        const __m128i one = SI_PS(_mm_set1_ps(1.0f));
+        switch (op) {
+          case VOP_ADD:
+            VECTOR_LOOP_SSE2(SI_PS(_mm_add_ps(PS(x), PS(y)))); break;
+          case VOP_SUBTRACT:
+            VECTOR_LOOP_SSE2(SI_PS(_mm_sub_ps(PS(x), PS(y)))); break;
+          case VOP_MULTIPLY:
+            VECTOR_LOOP_SSE2(SI_PS(_mm_mul_ps(PS(x), PS(y)))); break;
+          case VOP_DIVIDE:
+            VECTOR_LOOP_SSE2(SI_PS(_mm_div_ps(PS(x), PS(y)))); break;
+          case VOP_MINIMUM:
+            VECTOR_LOOP_SSE2(SI_PS(_mm_min_ps(PS(x), PS(y)))); break;
+          case VOP_MAXIMUM:
+            VECTOR_LOOP_SSE2(SI_PS(_mm_max_ps(PS(x), PS(y)))); break;
+          case VOP_EQUAL:
+            VECTOR_LOOP_SSE2(_mm_and_si128(
+                SI_PS(_mm_cmpeq_ps(PS(x), PS(y))), one
+            )); break;
+          case VOP_NOT_EQUAL:
+            VECTOR_LOOP_SSE2(_mm_and_si128(
+                SI_PS(_mm_cmpneq_ps(PS(x), PS(y))), one
+            )); break;
+          case VOP_LESSER:
+            VECTOR_LOOP_SSE2(_mm_and_si128(
+                SI_PS(_mm_cmplt_ps(PS(x), PS(y))), one
+            )); break;
+          case VOP_LESSER_OR_EQUAL:
+            VECTOR_LOOP_SSE2(_mm_and_si128(
+                SI_PS(_mm_cmple_ps(PS(x), PS(y))), one
+            )); break;
+          case VOP_GREATER:
+            VECTOR_LOOP_SSE2(_mm_and_si128(
+                SI_PS(_mm_cmpgt_ps(PS(x), PS(y))), one
+            )); break;
+          case VOP_GREATER_OR_EQUAL:
+            VECTOR_LOOP_SSE2(_mm_and_si128(
+                SI_PS(_mm_cmpge_ps(PS(x), PS(y))), one
+            )); break;
+        }
+        return i;
+    }
+
+    if (not integral) {
+        assert(wide == 8);
+        const __m128i one = SI_PD(_mm_set1_pd(1.0));
+        switch (op) {
+          case VOP_ADD:
+            VECTOR_LOOP_SSE2(SI_PD(_mm_add_pd(PD(x), PD(y)))); break;
+          case VOP_SUBTRACT:
+            VECTOR_LOOP_SSE2(SI_PD(_mm_sub_pd(PD(x), PD(y)))); break;
+          case VOP_MULTIPLY:
+            VECTOR_LOOP_SSE2(SI_PD(_mm_mul_pd(PD(x), PD(y)))); break;
+          case VOP_DIVIDE:
+            VECTOR_LOOP_SSE2(SI_PD(_mm_div_pd(PD(x), PD(y)))); break;
+          case VOP_MINIMUM:
+            VECTOR_LOOP_SSE2(SI_PD(_mm_min_pd(PD(x), PD(y)))); break;
+          case VOP_MAXIMUM:
+            VECTOR_LOOP_SSE2(SI_PD(_mm_max_pd(PD(x), PD(y)))); break;
+          case VOP_EQUAL:
+            VECTOR_LOOP_SSE2(_mm_and_si128(
+                SI_PD(_mm_cmpeq_pd(PD(x), PD(y))), one
+            )); break;
+          case VOP_NOT_EQUAL:
+            VECTOR_LOOP_SSE2(_mm_and_si128(
+                SI_PD(_mm_cmpneq_pd(PD(x), PD(y))), one
+            )); break;
+          case VOP_LESSER:
+            VECTOR_LOOP_SSE2(_mm_and_si128(
+                SI_PD(_mm_cmplt_pd(PD(x), PD(y))), one
+            )); break;
+          case VOP_LESSER_OR_EQUAL:
+            VECTOR_LOOP_SSE2(_mm_and_si128(
+                SI_PD(_mm_cmple_pd(PD(x), PD(y))), one
+            )); break;
+          case VOP_GREATER:
+            VECTOR_LOOP_SSE2(_mm_and_si128(
+                SI_PD(_mm_cmpgt_pd(PD(x), PD(y))), one
+            )); break;
+          case VOP_GREATER_OR_EQUAL:
+            VECTOR_LOOP_SSE2(_mm_and_si128(
+                SI_PD(_mm_cmpge_pd(PD(x), PD(y))), one
+            )); break;
+        }
+        return i;
+    }
+
+    // Adding and subtracting don't care about sign, and have instructions
+    // for every width.
+    //
+    if (op == VOP_ADD or op == VOP_SUBTRACT) {
+        bool add = (op == VOP_ADD);
+        switch (wide) {
+          case 1:
+            if (add) VECTOR_LOOP_SSE2(_mm_add_epi8(x, y))
+            else VECTOR_LOOP_SSE2(_mm_sub_epi8(x, y))
+            break;
+          case 2:
+            if (add) VECTOR_LOOP_SSE2(_mm_add_epi16(x, y))
+            else VECTOR_LOOP_SSE2(_mm_sub_epi16(x, y))
+            break;
+          case 4:
+            if (add) VECTOR_LOOP_SSE2(_mm_add_epi32(x, y))
+            else VECTOR_LOOP_SSE2(_mm_sub_epi32(x, y))
+            break;
+          case 8:
+            if (add) VECTOR_LOOP_SSE2(_mm_add_epi64(x, y))
+            else VECTOR_LOOP_SSE2(_mm_sub_epi64(x, y))
+            break;
+        }
+        return i;
+    }
+
+    // The low half of a product doesn't depend on sign either.  Bytes are
+    // multiplied as 16-bit lanes (the low byte of each product is right even
+    // with another byte above it), and 32-bit lanes as pairs of 64-bit ones.
+    //
+    if (op == VOP_MULTIPLY) {
+        const __m128i low_bytes = _mm_set1_epi16(0x00FF);
+        switch (wide) {
+          case 1:
+            VECTOR_LOOP_SSE2(_mm_or_si128(
+                _mm_and_si128(_mm_mullo_epi16(x, y), low_bytes),
+                _mm_slli_epi16(_mm_mullo_epi16(
+                    _mm_srli_epi16(x, 8), _mm_srli_epi16(y, 8)
+                ), 8)
+            ));
+            break;
+          case 2:
+            VECTOR_LOOP_SSE2(_mm_mullo_epi16(x, y));
+            break;
+          case 4:
+            VECTOR_LOOP_SSE2(_mm_unpacklo_epi32(
+                _mm_shuffle_epi32(
+                    _mm_mul_epu32(x, y), _MM_SHUFFLE(0, 0, 2, 0)
+                ),
+                _mm_shuffle_epi32(
+                    _mm_mul_epu32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32)),
+                    _MM_SHUFFLE(0, 0, 2, 0)
+                )
+            ));
+            break;
+        }
+        return i;
+    }
+
+    if (op == VOP_DIVIDE or wide == 8)  // no 64-bit compares until SSE4
+        return 0;
+
+    // Everything else is a comparison.  Flipping the top bit of unsigned
+    // lanes lets the signed compare instructions order them.
+    //
+    __m128i bias;
+    __m128i one;
+    switch (wide) {
+      case 1:
+        bias = _mm_set1_epi8(sign ? 0 : -128);
+        one = _mm_set1_epi8(1);
+        break;
+      case 2:
+        bias = _mm_set1_epi16(sign ? 0 : -32768);
+        one = _mm_set1_epi16(1);
+        break;
+      default:
+        bias = _mm_set1_epi32(sign ? 0 : INT32_MIN);
+        one = _mm_set1_epi32(1);
+        break;
+    }
+    bcast = _mm_xor_si128(bcast, bias);
+
+    #define BIASED(v) _mm_xor_si128((v), bias)
+    #define Y_BIASED (splat ? y : BIASED(y))  // bcast is already biased
+
+    switch (op) {
+      case VOP_MINIMUM:
+        VECTOR_LOOP_SSE2(BIASED(Select_Sse2(
+            Greater_Sse2(wide, BIASED(x), Y_BIASED), Y_BIASED, BIASED(x)
+        )));
+        break;
+      case VOP_MAXIMUM:
+        VECTOR_LOOP_SSE2(BIASED(Select_Sse2(
+            Greater_Sse2(wide, BIASED(x), Y_BIASED), BIASED(x), Y_BIASED
+        )));
+        break;
+      case VOP_EQUAL:
+        VECTOR_LOOP_SSE2(_mm_and_si128(
+            Equal_Sse2(wide, BIASED(x), Y_BIASED), one
+        ));
+        break;
+      case VOP_NOT_EQUAL:
+        VECTOR_LOOP_SSE2(_mm_andnot_si128(
+            Equal_Sse2(wide, BIASED(x), Y_BIASED), one
+        ));
+        break;
+      case VOP_LESSER:
+        VECTOR_LOOP_SSE2(_mm_and_si128(
+            Greater_Sse2(wide, Y_BIASED, BIASED(x)), one
+        ));
+        break;
+      case VOP_LESSER_OR_EQUAL:
+        VECTOR_LOOP_SSE2(_mm_andnot_si128(
+            Greater_Sse2(wide, BIASED(x), Y_BIASED), one
+        ));
+        break;
+      case VOP_GREATER:
+        VECTOR_LOOP_SSE2(_mm_and_si128(
+            Greater_Sse2(wide, BIASED(x), Y_BIASED), one
+        ));
+        break;
+      case VOP_GREATER_OR_EQUAL:
+        VECTOR_LOOP_SSE2(_mm_andnot_si128(
+            Greater_Sse2(wide, Y_BIASED, BIASED(x)), one
+        ));
+        break;
+      default:
+        assert(false);
+    }
+
+    #undef Y_BIASED
+    #undef BIASED
+
+    return i;
+}
+
+#endif
+
+
+// `x` is element `k` of `a` and `y` of `b` (or the broadcast number), read
+// and written with memcpy() per the strict aliasing notes in the README.
+//
+#define VECTOR_LOOP(T, expr) \
+    for (; k < n; ++k) { \
+        T x; \
+        T y; \
+        memcpy(&x, a + k * sizeof(T), sizeof(T)); \
+        memcpy(&y, splat ? b : b + k * sizeof(T), sizeof(T)); \
+        T z = (expr); \
+        memcpy(out + k * sizeof(T), &z, sizeof(T)); \
+    }
+
+// U is an unsigned type at least as big as `int`, so integer math wraps
+// instead of overflowing (which C doesn't define for signed types).
+//
+#define VECTOR_OPS(T, U, DIV) \
+    switch (op) { \
+      case VOP_ADD: VECTOR_LOOP(T, cast(T, cast(U, x) + cast(U, y))); break; \
+      case VOP_SUBTRACT: \
+        VECTOR_LOOP(T, cast(T, cast(U, x) - cast(U, y))); break; \
+      case VOP_MULTIPLY: \
+        VECTOR_LOOP(T, cast(T, cast(U, x) * cast(U, y))); break; \
+      case VOP_DIVIDE: VECTOR_LOOP(T, DIV); break; \
+      case VOP_MINIMUM: VECTOR_LOOP(T, x < y ? x : y); break; \
+      case VOP_MAXIMUM: VECTOR_LOOP(T, x > y ? x : y); break; \
+      case VOP_EQUAL: VECTOR_LOOP(T, cast(T, x == y)); break; \
+      case VOP_NOT_EQUAL: VECTOR_LOOP(T, cast(T, x != y)); break; \
+      case VOP_LESSER: VECTOR_LOOP(T, cast(T, x < y)); break; \
+      case VOP_LESSER_OR_EQUAL: VECTOR_LOOP(T, cast(T, x <= y)); break; \
+      case VOP_GREATER: VECTOR_LOOP(T, cast(T, x > y)); break; \
+      case VOP_GREATER_OR_EQUAL: VECTOR_LOOP(T, cast(T, x >= y)); break; \
+    }
+
+// Dividing the most negative number by -1 wraps back to itself.
+//
+#define SIGNED_DIV(T, U) \
+    (y == -1 ? cast(T, 0 - cast(U, x)) : cast(T, x / y))
+
+
+//
+//  Vector_Math_Raw: C
+//
+// Apply `op` to `n` elements of packed data, putting the results in `out`
+// (which may be the same memory as `a`, or `b`).
+//
+static void Vector_Math_Raw(
+    enum Reb_Vector_Op op,
+    bool integral,
+    bool sign,
+    REBYTE wide,
+    REBYTE *out,
+    const REBYTE *a,
+    const REBYTE *b,  // one element if `splat`
+    bool splat,
+    REBLEN n
+){
+    REBLEN k = 0;
+
+  #if defined(VECTOR_SIMD_X86)
+    k = Vector_Math_Sse2(
+        op, integral, sign, wide, out, a, b, splat, n * wide
+    ) / wide;
+  #endif
+
+    if (not integral) {
+        if (wide == 4)
+            VECTOR_OPS(float, float, x / y)
+        else
+            VECTOR_OPS(double, double, x / y)
+        return;
+    }
+
+    if (sign) {
+        switch (wide) {
+          case 1: VECTOR_OPS(int8_t, unsigned, SIGNED_DIV(int8_t, unsigned)) break;
+          case 2: VECTOR_OPS(int16_t, unsigned, SIGNED_DIV(int16_t, unsigned)) break;
+          case 4: VECTOR_OPS(int32_t, uint32_t, SIGNED_DIV(int32_t, uint32_t)) break;
+          case 8: VECTOR_OPS(int64_t, uint64_t, SIGNED_DIV(int64_t, uint64_t)) break;
+        }
+    }
+    else {
+        switch (wide) {
+          case 1: VECTOR_OPS(uint8_t, unsigned, x / y) break;
+          case 2: VECTOR_OPS(uint16_t, unsigned, x / y) break;
+          case 4: VECTOR_OPS(uint32_t, uint32_t, x / y) break;
+          case 8: VECTOR_OPS(uint64_t, uint64_t, x / y) break;
+        }
+    }
+}
+
+//
+//  Vector_Op_From_Word: C
+//
+// VECTOR-MATH names its operation with the word for what it does to one
+// pair of values (e.g. ADD, MINIMUM, LESSER-OR-EQUAL?).
+//
+enum Reb_Vector_Op Vector_Op_From_Word(const REBVAL *word)
+{
+    switch (VAL_WORD_SYM(word)) {
+      case SYM_ADD: return VOP_ADD;
+      case SYM_SUBTRACT: return VOP_SUBTRACT;
+      case SYM_MULTIPLY: return VOP_MULTIPLY;
+      case SYM_DIVIDE: return VOP_DIVIDE;
+      case SYM_MINIMUM: return VOP_MINIMUM;
+      case SYM_MAXIMUM: return VOP_MAXIMUM;
+      case SYM_EQUAL_Q: return VOP_EQUAL;
+      case SYM_NOT_EQUAL_Q: return VOP_NOT_EQUAL;
+      case SYM_LESSER_Q: return VOP_LESSER;
+      case SYM_LESSER_OR_EQUAL_Q: return VOP_LESSER_OR_EQUAL;
+      case SYM_GREATER_Q: return VOP_GREATER;
+      case SYM_GREATER_OR_EQUAL_Q: return VOP_GREATER_OR_EQUAL;
+      default:
+        break;
+    }
+    fail (word);
+}
+
+
+//
+//  Gather_Vector: C
+//
+// Copy a vector's elements (which may be a strided view) to `dest`, packed
+// one after another.
+//
+static void Gather_Vector(REBYTE *dest, const REBCEL *vec)
+{
+    REBYTE wide = VAL_VECTOR_WIDE(vec);
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    if (VAL_VECTOR_STRIDE(vec) == 1) {
+        memcpy(dest, VAL_VECTOR_HEAD(vec), len * wide);
+        return;
+    }
+
+    REBLEN n;
+    for (n = 0; n < len; ++n)
+        memcpy(dest + n * wide, VAL_VECTOR_AT(vec, n), wide);
+}
+
+
+//
+//  Contiguous_Vector_Data: C
+//
+// Pointer to a vector's elements packed one after another: its own data if
+// it has a stride of 1, otherwise a copy gathered into rebMalloc() memory
+// which is returned in `*buffer` for the caller to rebFree().
+//
+static REBYTE *Contiguous_Vector_Data(const REBCEL *vec, REBYTE **buffer)
+{
+    *buffer = nullptr;
+    if (VAL_VECTOR_STRIDE(vec) == 1)
+        return VAL_VECTOR_HEAD(vec);
+
+    REBLEN size = VAL_VECTOR_LEN_AT(vec) * VAL_VECTOR_WIDE(vec);
+    *buffer = rebAllocN(REBYTE, size + 1);  // +1 so a size of 0 is okay
+    Gather_Vector(*buffer, vec);
+    return *buffer;
+}
+
+
+//
+//  Vectors_Overlap: C
+//
+// Whether any of the bytes spanned by two vectors' elements are the same
+// memory (which can only happen if they are views sharing data).
+//
+static bool Vectors_Overlap(const REBCEL *a, const REBCEL *b)
+{
+    REBLEN a_len = VAL_VECTOR_LEN_AT(a);
+    REBLEN b_len = VAL_VECTOR_LEN_AT(b);
+    if (a_len == 0 or b_len == 0)
+        return false;
+
+    const REBYTE *a_head = VAL_VECTOR_HEAD(a);
+    const REBYTE *a_tail = VAL_VECTOR_AT(a, a_len - 1) + VAL_VECTOR_WIDE(a);
+    const REBYTE *b_head = VAL_VECTOR_HEAD(b);
+    const REBYTE *b_tail = VAL_VECTOR_AT(b, b_len - 1) + VAL_VECTOR_WIDE(b);
+    return a_head < b_tail and b_head < a_tail;
+}
+
+
+//
+//  Vector_Math: C
+//
+// Combine each element of `vec` with the matching element of `arg` (a vector
+// with the same element type and length) or with `arg` itself (a number).
+// The results go in a new vector, or overwrite `vec` if `in_place`.
+//
+REBVAL *Vector_Math(
+    REBVAL *out,
+    enum Reb_Vector_Op op,
+    const REBVAL *vec,
+    const REBVAL *arg,
+    bool in_place
+){
+    bool integral = VAL_VECTOR_INTEGRAL(vec);
+    bool sign = VAL_VECTOR_SIGN(vec);
+    REBYTE wide = VAL_VECTOR_WIDE(vec);
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+
+    DECLARE_LOCAL (number);
+
+    const REBYTE *b;
+    REBYTE *b_buffer = nullptr;
+    bool splat;
+    if (IS_INTEGER(arg) or IS_DECIMAL(arg)) {
+        //
+        // Convert the number (with the range checks POKE does) by putting it
+        // in a vector of one element of the same type.
+        //
+        REBSER *bin = Make_Binary(wide);
+        SET_SERIES_LEN(bin, wide);
+        TERM_SERIES(bin);
+        Init_Vector(number, bin, sign, integral, wide * 8);
+        Set_Vector_At(number, 0, arg);
+
+        b = VAL_VECTOR_HEAD(number);
+        splat = true;
+    }
+    else if (IS_VECTOR(arg)) {
+        if (
+            VAL_VECTOR_INTEGRAL(arg) != integral
+            or VAL_VECTOR_SIGN(arg) != sign
+            or VAL_VECTOR_WIDE(arg) != wide
+        ){
+            fail (Error_Not_Same_Type_Raw());
+        }
+        if (VAL_VECTOR_LEN_AT(arg) != len)
+            fail ("VECTOR! math needs vectors of the same length");
+
+        if (
+            in_place
+            and Vectors_Overlap(arg, vec)
+            and (
+                VAL_VECTOR_HEAD(arg) != VAL_VECTOR_HEAD(vec)
+                or VAL_VECTOR_STRIDE(arg) != VAL_VECTOR_STRIDE(vec)
+            )
+        ){
+            // Views of the same data at different places may overlap, so
+            // results would be written over elements still to be read.
+            //
+            b_buffer = rebAllocN(REBYTE, len * wide + 1);
+            Gather_Vector(b_buffer, arg);
+            b = b_buffer;
+        }
+        else
+            b = Contiguous_Vector_Data(arg, &b_buffer);
+        splat = false;
+    }
+    else
+        fail (arg);
+
+    if (op == VOP_DIVIDE and integral) {  // check before changing anything
+        static const REBYTE zero[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+        REBLEN k;
+        for (k = 0; k < (splat ? 1 : len); ++k) {
+            if (memcmp(b + k * wide, zero, wide) == 0)
+                fail (Error_Zero_Divide_Raw());
+        }
+    }
+
+    // A strided view is worked on as a packed copy of its elements, which
+    // is scattered back into the view for /IN-PLACE.
+    //
+    REBYTE *a_buffer = nullptr;
+    const REBYTE *a;
+    REBYTE *dest;
+    if (in_place) {
+        Fail_If_Vector_Read_Only(vec);
+        dest = Contiguous_Vector_Data(vec, &a_buffer);
+        a = dest;
+        Move_Value(out, vec);
+    }
+    else {
+        REBSER *bin = Make_Binary(len * wide);
+        SET_SERIES_LEN(bin, len * wide);
+        TERM_SERIES(bin);
+        Init_Vector(out, bin, sign, integral, wide * 8);
+        dest = VAL_VECTOR_HEAD(out);
+
+        if (VAL_VECTOR_STRIDE(vec) == 1)
+            a = VAL_VECTOR_HEAD(vec);
+        else {
+            Gather_Vector(dest, vec);
+            a = dest;
+        }
+    }
+
+    Vector_Math_Raw(op, integral, sign, wide, dest, a, b, splat, len);
+
+    if (b_buffer)
+        rebFree(b_buffer);
+
+    if (a_buffer) {
+        REBLEN n;
+        for (n = 0; n < len; ++n)
+            memcpy(VAL_VECTOR_AT(vec, n), a_buffer + n * wide, wide);
+        rebFree(a_buffer);
+    }
+    return out;
+}
+
+
 //
 //  Make_Vector_Spec: C
 //
@@ -411,7 +1033,7 @@ bool Make_Vector_Spec(REBVAL *out, const RELVAL *head, REBSPC *specifier)
         ++item;
     }
 
-    REBYTE len = 1;  // !!! default len to 1...why?
+    REBLEN len = 1;  // !!! default len to 1...why?
     if (NOT_END(item) && IS_INTEGER(item)) {
         if (Int32(item) < 0)
             return false;
@@ -464,12 +1086,60 @@ bool Make_Vector_Spec(REBVAL *out, const RELVAL *head, REBSPC *specifier)
 }
 
 
+//
+//  Make_Vector_Packed: C
+//
+// Make a vector from a block of just numbers, picking the element type:
+//
+//    make vector! [1 2 3]  ; integer! 64
+//    make vector! [1 2.5 3]  ; decimal! 64
+//
+// This is the way to hold a large amount of numeric data in 8 bytes per
+// element, instead of a cell each.  (`to block! vector` gives the cells
+// back, though a decimal vector gives DECIMAL!s for any INTEGER!s it had.)
+//
+// Returns false if the block is empty or has something besides numbers in
+// it, so the caller can try it as a spec.
+//
+bool Make_Vector_Packed(REBVAL *out, const RELVAL *head)
+{
+    if (IS_END(head))
+        return false;
+
+    bool integral = true;
+    REBLEN len = 0;
+    const RELVAL *item;
+    for (item = head; NOT_END(item); ++item, ++len) {
+        if (IS_DECIMAL(item))
+            integral = false;
+        else if (not IS_INTEGER(item))
+            return false;
+    }
+
+    REBLEN num_bytes = len * 8;
+    REBSER *bin = Make_Binary(num_bytes);
+    SET_SERIES_LEN(bin, num_bytes);
+    TERM_SERIES(bin);
+
+    const bool sign = true;
+    Init_Vector(out, bin, sign, integral, 64);
+
+    REBLEN n = 0;
+    for (item = head; NOT_END(item); ++item)
+        Set_Vector_At(out, n++, item);
+
+    return true;
+}
+
+
 //
 //  TO_Vector: C
 //
 REB_R TO_Vector(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg)
 {
     if (IS_BLOCK(arg)) {
+        if (Make_Vector_Packed(out, VAL_ARRAY_AT(arg)))
+            return out;
         if (Make_Vector_Spec(out, VAL_ARRAY_AT(arg), VAL_SPECIFIER(arg)))
             return out;
     }
@@ -572,7 +1242,7 @@ void Poke_Vector_Fail_If_Read_Only(
     // !!! How does this tie into CONST-ness?  How should aggregate types
     // handle their overall constness vs. that of their components?
     //
-    FAIL_IF_READ_ONLY(VAL_VECTOR_BINARY(value));
+    Fail_If_Vector_Read_Only(value);
 
     REBINT n;
     if (IS_INTEGER(picker) or IS_DECIMAL(picker)) // #2312
@@ -644,10 +1314,14 @@ REBTYPE(Vector)
         if (REF(part) or REF(deep) or REF(types))
             fail (Error_Bad_Refines_Raw());
 
-        REBBIN *bin = Copy_Sequence_Core(
-            VAL_BINARY(VAL_VECTOR_BINARY(v)),
-            NODE_FLAG_MANAGED
-        );
+        // Only copy the elements this vector sees, which may be a view on
+        // part of a bigger one.
+        //
+        REBLEN size = VAL_VECTOR_LEN_AT(v) * VAL_VECTOR_WIDE(v);
+        REBBIN *bin = Make_Binary(size);
+        Gather_Vector(BIN_HEAD(bin), v);
+        SET_SERIES_LEN(bin, size);
+        TERM_SERIES(bin);
 
         return Init_Vector(
             D_OUT,
@@ -657,11 +1331,18 @@ REBTYPE(Vector)
             VAL_VECTOR_BITSIZE(v)
         ); }
 
+    case SYM_ADD:
+    case SYM_SUBTRACT:
+    case SYM_MULTIPLY:
+    case SYM_DIVIDE: {
+        enum Reb_Vector_Op op = Vector_Op_From_Word(verb);
+        return Vector_Math(D_OUT, op, v, D_ARG(2), false); }
+
     case SYM_RANDOM: {
         INCLUDE_PARAMS_OF_RANDOM;
         UNUSED(PAR(value));
 
-        FAIL_IF_READ_ONLY(VAL_VECTOR_BINARY(v));
+        Fail_If_Vector_Read_Only(v);
 
         if (REF(seed) or REF(only))
             fail (Error_Bad_Refines_Raw());
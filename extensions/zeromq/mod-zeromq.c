@@ -69,6 +69,61 @@ ATTRIBUTE_NO_RETURN static void fail_ZeroMQ(void) {
 }
 
 
+// With ZMQ-MSG-INIT-DATA/SHARE a message points straight at a BINARY!'s
+// memory instead of at a copy.  The series gets SERIES_INFO_HOLD so it can't
+// be modified or resized while 0MQ has it, and an unmanaged API handle keeps
+// the GC from freeing it.
+//
+// 0MQ calls the message's free function when it is done with the data, which
+// may be on one of its I/O threads, where the interpreter can't be used.  So
+// the free function only queues the handle under a lock.  The queue is
+// drained (dropping the hold and the handle) by the next ZeroMQ native that
+// runs on the interpreter's thread.
+//
+struct Reb_Shared_Msg {
+    struct Reb_Shared_Msg *next;
+    REBVAL *binary;  // unmanaged API handle
+};
+
+static struct Reb_Shared_Msg *Released_Msgs = nullptr;
+
+#ifdef TO_WINDOWS
+    static SRWLOCK Released_Mutex = SRWLOCK_INIT;
+    #define Lock_Released() AcquireSRWLockExclusive(&Released_Mutex)
+    #define Unlock_Released() ReleaseSRWLockExclusive(&Released_Mutex)
+#else
+    #include <pthread.h>
+    static pthread_mutex_t Released_Mutex = PTHREAD_MUTEX_INITIALIZER;
+    #define Lock_Released() pthread_mutex_lock(&Released_Mutex)
+    #define Unlock_Released() pthread_mutex_unlock(&Released_Mutex)
+#endif
+
+static void release_shared_msg(void *data, void *hint) {  // any thread
+    UNUSED(data);
+    struct Reb_Shared_Msg *shared = cast(struct Reb_Shared_Msg*, hint);
+
+    Lock_Released();
+    shared->next = Released_Msgs;
+    Released_Msgs = shared;
+    Unlock_Released();
+}
+
+static void Drain_Released_Msgs(void) {  // interpreter's thread only
+    Lock_Released();
+    struct Reb_Shared_Msg *shared = Released_Msgs;
+    Released_Msgs = nullptr;
+    Unlock_Released();
+
+    while (shared) {
+        struct Reb_Shared_Msg *next = shared->next;
+        CLEAR_SERIES_INFO(VAL_SERIES(shared->binary), HOLD);
+        rebRelease(shared->binary);
+        free(shared);
+        shared = next;
+    }
+}
+
+
 //
 //  export zmq-init: native [  ; >= 0MQ 2.0.7
 //
@@ -104,7 +159,8 @@ REBNATIVE(zmq_term) {
 
     void *ctx = VAL_HANDLE_VOID_POINTER(ARG(ctx));
 
-    int rc = zmq_term(ctx);
+    int rc = zmq_term(ctx);  // waits for 0MQ to release all messages
+    Drain_Released_Msgs();
     if (rc != 0)
         fail_ZeroMQ();
 
@@ -210,6 +266,7 @@ void free_msg_data(void *data, void *hint) {
 //      return: <void>
 //      msg [handle!]
 //      data [binary!]
+//      /share "Don't copy; DATA is read-only until 0MQ is done sending it"
 //  ]
 //
 REBNATIVE(zmq_msg_init_data) {
@@ -217,6 +274,37 @@ REBNATIVE(zmq_msg_init_data) {
 
     zmq_msg_t *msg = VAL_HANDLE_POINTER(zmq_msg_t, ARG(msg));
 
+    Drain_Released_Msgs();
+
+    REBSER *bin = VAL_SERIES(ARG(data));
+    if (REF(share) and not GET_SERIES_INFO(bin, HOLD)) {  // else copy
+        FAIL_IF_READ_ONLY(ARG(data));  // can't take a hold off of it later
+
+        struct Reb_Shared_Msg *shared = cast(struct Reb_Shared_Msg*,
+            malloc(sizeof(struct Reb_Shared_Msg))
+        );
+        if (not shared)
+            rebJumps ("FAIL {Insufficient memory for shared message}");
+
+        int rc = zmq_msg_init_data(
+            msg,
+            VAL_BIN_AT(ARG(data)),
+            VAL_LEN_AT(ARG(data)),
+            &release_shared_msg,
+            shared  // "hint" passed to freeing function
+        );
+        if (rc != 0) {
+            free(shared);
+            fail_ZeroMQ();
+        }
+
+        shared->binary = rebValue(ARG(data));
+        rebUnmanage(shared->binary);
+        SET_SERIES_INFO(bin, HOLD);
+
+        return rebVoid();
+    }
+
     size_t msg_size = rebBytesIntoQ(nullptr, 0, ARG(data));  // query size
     REBYTE *msg_data = cast(REBYTE*, malloc(msg_size));
     if (not msg_data)
@@ -255,6 +343,7 @@ REBNATIVE(zmq_msg_close) {
     zmq_msg_t *msg = VAL_HANDLE_POINTER(zmq_msg_t, ARG(msg));
 
     int rc = zmq_msg_close(msg);
+    Drain_Released_Msgs();  // closing may have released a /SHARE message
     if (rc != 0)
         fail_ZeroMQ();
 
@@ -269,9 +358,16 @@ REBNATIVE(zmq_msg_close) {
 //
 //      return: [binary!]
 //      msg [handle!]
+//      /into "Append to this binary instead, so its memory can be reused"
+//          [binary!]
 //  ]
 //
-REBNATIVE(zmq_msg_data) {
+REBNATIVE(zmq_msg_data)
+//
+// !!! A BINARY! can't be made to alias the message's memory, since series
+// must own their data.  But with /INTO, a receive loop can CLEAR and refill
+// one buffer rather than making a new series for each message.
+{
     ZEROMQ_INCLUDE_PARAMS_OF_ZMQ_MSG_DATA;
 
     zmq_msg_t *msg = VAL_HANDLE_POINTER(zmq_msg_t, ARG(msg));
@@ -279,6 +375,18 @@ REBNATIVE(zmq_msg_data) {
     size_t msg_size = zmq_msg_size(msg);
     void *msg_data = zmq_msg_data(msg);
 
+    if (REF(into)) {
+        FAIL_IF_READ_ONLY(ARG(into));
+
+        REBBIN *bin = VAL_BINARY(ARG(into));
+        REBLEN tail = BIN_LEN(bin);
+        EXPAND_SERIES_TAIL(bin, msg_size);
+        memcpy(BIN_AT(bin, tail), msg_data, msg_size);
+        TERM_BIN_LEN(bin, tail + msg_size);
+
+        RETURN (ARG(into));
+    }
+
     return rebSizedBinary(msg_data, msg_size);
 }
 
@@ -737,6 +845,8 @@ REBNATIVE(zmq_send) {
     if (REF(sndmore))
         flags |= ZMQ_SNDMORE;
 
+    Drain_Released_Msgs();
+
     int rc = zmq_msg_send(msg, socket, flags);
     if (rc != -1)
         return rebInteger(rc); // number of bytes in the message
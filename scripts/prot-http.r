@@ -12,7 +12,7 @@ REBOL [
     Name: http
     Type: module
     File: %prot-http.r
-    Version: 0.1.48
+    Version: 0.1.50
     Purpose: {
         This program defines the HTTP protocol scheme for REBOL 3.
     }
@@ -58,6 +58,30 @@ sync-op: function [port body] [
 
     if state/mode = 'ready [do-request port]
 
+    await-response port
+
+    ; !!! Note that this dispatches to the "port actor", not the COPY generic
+    ; action.  That has been overridden to copy PORT/DATA.  :-/
+    ;
+    body: copy port
+
+    if state/close? [close port]  ; connection may go to IDLE-CONNECTIONS
+
+    either port/spec/debug [
+        state/connection/locals
+    ][
+        body
+    ]
+]
+
+await-response: function [
+    {Wait until the response to the request sent on a port has been read}
+
+    return: <void>
+    port [port!]
+][
+    state: port/state
+
     ; Wait in a WHILE loop so the timeout cannot occur during 'reading-data
     ; state.  The timeout should be triggered only when the response from
     ; the other side exceeds the timeout value.
@@ -69,22 +93,80 @@ sync-op: function [port body] [
         if state/mode = 'reading-data [
             read state/connection
         ]
+        if state/mode = 'retry [  ; reused connection was closed, see HTTP-AWAKE
+            reconnect port
+        ]
     ]
+]
 
-    ; !!! Note that this dispatches to the "port actor", not the COPY generic
-    ; action.  That has been overridden to copy PORT/DATA.  :-/
+export read-pipelined: function [
+    {Send GET requests for URLs on one connection, without awaiting replies}
+
+    return: "Response bodies, in the same order as the URLs"
+        [block!]
+    urls "URLs with the same scheme, host, and port"
+        [block!]
+][
+    ; HTTP/1.1 pipelining: all of the requests are written at once, and the
+    ; server answers them in order.  Each response is found in the buffer
+    ; where the one before it ended (see CHECK-DATA and DECHUNK).  Redirects
+    ; are not followed, since that would take the connection elsewhere, so
+    ; a 3xx response gives its body like a 2xx one does.
     ;
-    body: copy port
+    if empty? urls [return copy []]
+    port: make port! first urls
+    spec: port/spec
+    paths: map-each url urls [
+        target: construct/with/only decode-url url port/scheme/spec
+        if not all [
+            target/scheme = spec/scheme
+            target/host = spec/host
+            target/port-id = spec/port-id
+        ][
+            fail make-http-error ["Can't pipeline to another host:" url]
+        ]
+        any [target/path %/]
+    ]
+    spec/follow: 'ok
 
-    if state/close? [close port]
+    open port
+    state: port/state
+    state/pipeline: paths
 
-    either port/spec/debug [
-        state/connection/locals
-    ][
-        body
+    return collect [
+        keep sync-op port []  ; sends all the requests, reads first response
+        for-each path next state/pipeline [
+            spec/path: path
+            state/info/headers: state/info/response-line: _
+            state/info/response-parsed: port/data: _
+            state/mode: 'reading-headers
+            check-response port  ; may have arrived with the previous one
+            if state/mode = 'reading-data [read state/connection]
+            await-response port
+            keep copy port
+        ]
+        state/pipeline: _
+        close port
     ]
 ]
 
+reconnect: function [
+    {Replace a port's connection with a new one, and resend its request}
+
+    return: <void>
+    port [port!]
+][
+    state: port/state
+    conn: state/connection
+    conn/awake: _
+    attempt [close conn]
+
+    state/reused: false
+    state/mode: 'inited  ; 'connect event will do the request again
+    state/connection: conn: make-connection port
+    open conn
+]
+
 read-sync-awake: function [return: [logic!] event [event!]] [
     switch event/type [
         'connect
@@ -130,6 +212,21 @@ http-awake: function [return: [logic!] event [event!]] [
             awake make event! [type: 'connect port: http-port]
         ]
         'close [
+            state/keep-alive: false
+
+            ; A connection from IDLE-CONNECTIONS may have been closed by the
+            ; server before the request arrived.  (Servers close connections
+            ; which sit idle.)  AWAIT-RESPONSE will retry with a new one.
+            ;
+            all [
+                state/reused
+                find [doing-request reading-headers] state/mode
+                empty? any [port/data #{}]
+            ] then [
+                state/mode: 'retry
+                return true
+            ]
+
             res: try switch state/mode [
                 'ready [
                     awake make event! [type: 'close port: http-port]
@@ -160,6 +257,14 @@ http-awake: function [return: [logic!] event [event!]] [
             close http-port
             res
         ]
+        'error [
+            ; e.g. the host name lookup failed, which happens in the
+            ; background after the OPEN has returned
+            ;
+            http-port/error: port/error
+            port/error: _
+            awake make event! [type: 'error port: http-port]
+        ]
         default [true]
     ]
 ]
@@ -191,7 +296,7 @@ make-http-request: func [
     result: unspaced [
         uppercase form method space
         either file? target [next mold target] [target]
-        space "HTTP/1.0" CR LF
+        space "HTTP/1.1" CR LF
     ]
     for-each [word string] headers [
         append result unspaced [mold word space string CR LF]
@@ -226,14 +331,29 @@ do-request: function [
             form spec/host
         ]
         User-Agent: "REBOL"
+
+        ; Only synchronous READ and WRITE put connections in the pool, see
+        ; IDLE-CONNECTIONS.  Asking a server to close the connection after
+        ; responding keeps the 'close event that asynchronous code expects.
+        ;
+        Connection: either action? :port/awake ["close"] ["keep-alive"]
     ] spec/headers
     port/state/mode: 'doing-request
     info/headers: info/response-line: info/response-parsed: port/data:
     info/size: info/date: info/name: blank
-    write port/state/connection
     req: (make-http-request spec/method any [spec/path %/]
         spec/headers spec/content)
 
+    ; With READ-PIPELINED, the GETs for the other paths go in the same write
+    ;
+    if port/state/pipeline [
+        for-each path next port/state/pipeline [
+            append req make-http-request 'get path spec/headers blank
+        ]
+    ]
+
+    write port/state/connection req
+
     net-log/C as text! req  ; Note: may contain CR (can't use TO TEXT!)
 ]
 
@@ -300,6 +420,18 @@ check-response: function [port] [
 
         info/headers: headers: construct/with/only d1 http-response-headers
         info/name: to file! any [spec/path %/]
+
+        ; The connection may be reused once the response is read (see
+        ; IDLE-CONNECTIONS), which HTTP/1.1 allows unless the server says
+        ; otherwise.  After a response arrives the server is known to have
+        ; had the connection open, so it's no longer one that may be stale.
+        ;
+        state/reused: false
+        state/keep-alive: did either parse line ["HTTP/1.1" to end] [
+            headers/connection <> "close"
+        ][
+            headers/connection = "keep-alive"
+        ]
         if headers/content-length [
             info/size: (
                 headers/content-length: to-integer headers/content-length
@@ -496,6 +628,7 @@ http-response-headers: context [
     Content-Length: _
     Transfer-Encoding: _
     Last-Modified: _
+    Connection: _
 ]
 
 do-redirect: func [
@@ -568,51 +701,24 @@ check-data: function [
 
     case [
         headers/transfer-encoding = "chunked" [
-            data: conn/data
             port/data: default [  ; only clear at request start
-                make binary! length of data
+                make binary! length of conn/data
             ]
-            out: port/data
-
-            while [parse data [
-                copy chunk-size some hex-digits thru crlfbin mk1: to end
-            ]][
-                ; The chunk size is in the byte stream as ASCII chars
-                ; forming a hex string.  DEBASE to get a BINARY! and then
-                ; DEBIN to get an integer.
-                ;
-                chunk-size: debin [be +] (debase/base as text! chunk-size 16)
-
-                if chunk-size = 0 [
-                    parse mk1 [
-                        crlfbin (trailer: "") to end
-                            |
-                        copy trailer to crlf2bin to end
-                    ] then [
-                        trailer: construct/only trailer
-                        append headers body-of trailer
-                        state/mode: 'ready
-                        res: state/awake make event! [
-                            type: 'custom
-                            port: port
-                            code: 0
-                        ]
-                        clear data
-                    ]
-                    break
-                ]
-                else [
-                    parse mk1 [chunk-size skip mk2: crlfbin to end] else [
-                        break
-                    ]
 
-                    insert/part tail of out mk1 mk2
-                    remove/part data skip mk2 2
-                    empty? data
+            ; DECHUNK leaves anything after the body in CONN/DATA, which is
+            ; the start of the next response if the connection is reused.
+            ;
+            if trailer: dechunk port/data conn/data [
+                if not empty? trailer [
+                    append headers scan-net-header trailer
                 ]
-            ]
-
-            if state/mode <> 'ready [
+                state/mode: 'ready
+                res: state/awake make event! [
+                    type: 'custom
+                    port: port
+                    code: 0
+                ]
+            ] else [
                 awaken-wait-loop
             ]
         ]
@@ -620,7 +726,13 @@ check-data: function [
             port/data: conn/data
             if headers/content-length <= length of port/data [
                 state/mode: 'ready
+
+                ; Bytes past the body are the next response's, if any
+                ;
                 conn/data: make binary! 32000
+                append conn/data skip port/data headers/content-length
+                clear skip port/data headers/content-length
+
                 res: state/awake make event! [
                     type: 'custom
                     port: port
@@ -632,6 +744,7 @@ check-data: function [
         ]
     ] else [
         port/data: conn/data
+        state/keep-alive: false  ; body ends when the server closes
         if state/info/response-parsed = 'ok [
             awaken-wait-loop
         ] else [
@@ -645,7 +758,81 @@ check-data: function [
     return res
 ]
 
-hex-digits: charset "1234567890abcdefABCDEF"
+
+; Connections kept open after a response, so the next synchronous READ or
+; WRITE to the same scheme, host, and port can skip the TCP connect (and the
+; TLS handshake, for HTTPS).  Each key maps to a block of [connection time]
+; pairs, most recently used last.  Connections idle longer than IDLE-TIMEOUT
+; are closed instead of reused, since the server has likely dropped them.
+;
+idle-connections: make map! []
+max-idle-per-host: 8
+idle-timeout: 0:00:30
+
+connection-key: func [return: [text!] spec [object!]] [
+    unspaced [spec/scheme "://" spec/host ":" spec/port-id]
+]
+
+take-idle-connection: function [
+    {Get an open connection to where SPEC says from the pool, if any}
+
+    return: [<opt> port!]
+    spec [object!]
+][
+    if not idle: select idle-connections connection-key spec [return null]
+    while [not empty? idle] [
+        since: take/last idle
+        conn: take/last idle
+        if all [
+            open? conn
+            idle-timeout > difference now/precise since
+        ][
+            return conn
+        ]
+        attempt [close conn]
+    ]
+    return null
+]
+
+release-connection: function [
+    {Keep a connection in the pool, closing the oldest if there are too many}
+
+    return: <void>
+    spec [object!]
+    conn [port!]
+][
+    conn/awake: _
+    conn/locals: _
+    idle: any [
+        select idle-connections key: connection-key spec
+        idle-connections/(key): copy []
+    ]
+    if (length of idle) >= (2 * max-idle-per-host) [
+        attempt [close first idle]
+        remove/part idle 2
+    ]
+    append idle reduce [conn now/precise]
+]
+
+make-connection: function [
+    {Make the TCP (or TLS) port for an HTTP port, without opening it}
+
+    return: [port!]
+    port [port!]
+][
+    conn: make port! compose [
+        scheme: (
+            either port/spec/scheme = 'http [lit 'tcp][lit 'tls]
+        )
+        host: port/spec/host
+        port-id: port/spec/port-id
+        ref: join-all [tcp:// host ":" port-id]
+    ]
+    conn/awake: :http-awake
+    conn/locals: port
+    conn
+]
+
 sys/make-scheme [
     name: 'http
     title: "HyperText Transport Protocol v1.1"
@@ -756,18 +943,28 @@ sys/make-scheme [
                 close?: no
                 info: make port/scheme/info [type: 'file]
                 awake: ensure [action! blank!] :port/awake
+
+                reused: false  ; connection came from IDLE-CONNECTIONS
+                keep-alive: false  ; can go back there after the response
+                pipeline: _  ; paths for READ-PIPELINED
+            ]
+
+            ; Asynchronous code expects a 'connect event, so only ports
+            ; without an AWAKE handler of their own reuse connections.
+            ;
+            if not action? :port/awake [
+                conn: take-idle-connection port/spec
             ]
-            port/state/connection: conn: make port! compose [
-                scheme: (
-                    either port/spec/scheme = 'http [lit 'tcp][lit 'tls]
-                )
-                host: port/spec/host
-                port-id: port/spec/port-id
-                ref: join-all [tcp:// host ":" port-id]
+            if conn [
+                port/state/connection: conn
+                conn/awake: :http-awake
+                conn/locals: port
+                port/state/reused: true
+                port/state/mode: 'ready
+            ] else [
+                port/state/connection: conn: make-connection port
+                open conn
             ]
-            conn/awake: :http-awake
-            conn/locals: port
-            open conn
             port
         ]
 
@@ -785,10 +982,21 @@ sys/make-scheme [
 
         close: func [
             port [port!]
+            <local> conn
         ][
             if port/state [
-                close port/state/connection
-                port/state/connection/awake: _
+                conn: port/state/connection
+                all [
+                    port/state/keep-alive
+                    port/state/mode = 'ready
+                    empty? any [conn/data #{}]  ; leftovers would confuse the next user
+                    open? conn
+                ] then [
+                    release-connection port/spec conn
+                ] else [
+                    close conn
+                    conn/awake: _
+                ]
                 port/state: _
             ]
             port
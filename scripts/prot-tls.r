@@ -2,7 +2,7 @@ REBOL [
     Title: "REBOL 3 TLS Client 1.0 - 1.2 Protocol Scheme"
     Name: tls
     Type: module
-    Version: 0.7.0
+    Version: 0.8.0
     Rights: {
         Copyright 2012 Richard "Cyphre" Smolak (TLS 1.0)
         Copyright 2012-2018 Rebol Open Source Developers
@@ -65,7 +65,6 @@ REBOL [
         https://tools.ietf.org/html/rfc7568
     }
     Todo: {
-        - cached sessions
         - automagic cert data lookup
         - add more cipher suites
         - server role support
@@ -186,6 +185,21 @@ cipher-suites: compose [
 ]
 
 
+; SESSION CACHE
+;
+; A full handshake costs a key exchange (with its big number math) and a
+; round trip more than resuming a session.  When a server names the session
+; in its SERVER-HELLO, the master secret is remembered here by host and port,
+; and offered in the next CLIENT-HELLO to that host.  If the server still has
+; it, the server echoes the ID and both sides go straight to their FINISHED
+; messages (the "abbreviated handshake" of RFC 5246 section 7.3).
+;
+; Entries are [session-id master-secret suite-id version time-cached].
+;
+session-cache: make map! []
+session-lifetime: 1:00  ; RFC 5246 says at most 24 hours, servers vary
+
+
 ;
 ; SUPPORT FUNCTIONS
 ;
@@ -403,7 +417,7 @@ update-read-state: specialize 'update-state [
     direction: 'read
     transitions: [
         <client-hello> [<server-hello>]
-        <server-hello> [<certificate>]
+        <server-hello> [<certificate> <change-cipher-spec>]
         <certificate> [#server-hello-done <server-key-exchange>]
         <server-key-exchange> [#server-hello-done]
         <finished> [<change-cipher-spec> #alert]
@@ -421,7 +435,8 @@ update-write-state: specialize 'update-state [
         #server-hello-done [<client-key-exchange>]
         <client-key-exchange> [<change-cipher-spec>]
         <change-cipher-spec> [<finished>]
-        #encrypted-handshake [#application]
+        <finished> [#application]  ; after a resumed session's handshake
+        #encrypted-handshake [#application <change-cipher-spec>]
         #application [#application #alert]
         #alert [<close-notify>]
         <close-notify> []
@@ -487,11 +502,19 @@ client-hello: function [
         if binary? item [item]
     ]
 
+    ctx/offered-session: try all [
+        entry: select session-cache ctx/session-key
+        (difference now entry/5) < session-lifetime
+        entry
+    ]
+    session-id: either ctx/offered-session [ctx/offered-session/1] [#{}]
+
     emit ctx [
       ClientHello:  ; https://tools.ietf.org/html/rfc5246#section-7.4.1.2
         max-ver-bytes               ; max supported version by client
         ctx/client-random           ; 4 bytes gmt unix time + 28 random bytes
-        #{00}                       ; session ID length
+        to-1bin length of session-id  ; session ID length
+        session-id                  ; empty unless resuming, see SESSION-CACHE
         to-2bin length of cs-data   ; cipher suites length
         cs-data                     ; cipher suites list
 
@@ -708,36 +731,8 @@ client-key-exchange: function [
     change ssl-record-length to-2bin (length of ssl-record)
     change message-length to-3bin (length of message)
 
-    ; make all secure data
-    ;
     make-master-secret ctx ctx/pre-master-secret
-
-    make-key-block ctx
-
-    ; update keys
-    ctx/client-mac-key: copy/part ctx/key-block ctx/hash-size
-    ctx/server-mac-key: copy/part skip ctx/key-block ctx/hash-size ctx/hash-size
-    ctx/client-crypt-key: copy/part skip ctx/key-block 2 * ctx/hash-size ctx/crypt-size
-    ctx/server-crypt-key: copy/part skip ctx/key-block (2 * ctx/hash-size) + ctx/crypt-size ctx/crypt-size
-
-    if ctx/block-size [
-        if ctx/version = 1.0 [
-            ;
-            ; Block ciphers in TLS 1.0 used an implicit initialization vector
-            ; (IV) to seed the encryption process.  This has vulnerabilities.
-            ;
-            ctx/client-iv: copy/part skip ctx/key-block 2 * (ctx/hash-size + ctx/crypt-size) ctx/block-size
-            ctx/server-iv: copy/part skip ctx/key-block (2 * (ctx/hash-size + ctx/crypt-size)) + ctx/block-size ctx/block-size
-        ] else [
-            ;
-            ; Each encrypted message in TLS 1.1 and above carry a plaintext
-            ; initialization vector, so the ctx does not use one for the whole
-            ; session.  Unset it to make sure.
-            ;
-            unset in ctx 'client-iv
-            unset in ctx 'server-iv
-        ]
-    ]
+    make-keys ctx
 
     append ctx/handshake-messages ssl-record
 ]
@@ -753,6 +748,7 @@ change-cipher-spec: function [
         #{00 01}        ; length of SSL record data
         #{01}           ; CCS protocol type
     ]
+    ctx/encrypt-stream: make-cipher ctx
 ]
 
 
@@ -761,13 +757,7 @@ encrypted-handshake-msg: function [
     ctx [object!]
     unencrypted [binary!]
 ][
-    encrypted: encrypt-data/type ctx unencrypted #{16}
-    emit ctx [
-        #{16}                         ; protocol type (22=Handshake)
-        ctx/ver-bytes                 ; protocol version
-        to-2bin length of encrypted  ; length of SSL record data
-        encrypted
-    ]
+    tls-seal ctx/msg ctx/encrypt-stream 22 ctx/ver-bytes unencrypted  ; Handshake
     append ctx/handshake-messages unencrypted
 ]
 
@@ -777,26 +767,15 @@ application-data: function [
     ctx [object!]
     unencrypted [binary! text!]
 ][
-    encrypted: encrypt-data ctx to binary! unencrypted
-    emit ctx [
-        #{17}                         ; protocol type (23=Application)
-        ctx/ver-bytes                 ; protocol version
-        to-2bin length of encrypted  ; length of SSL record data
-        encrypted
-    ]
+    unencrypted: to binary! unencrypted
+    tls-seal ctx/msg ctx/encrypt-stream 23 ctx/ver-bytes unencrypted  ; Application
 ]
 
 
 alert-close-notify: function [
     ctx [object!]
 ][
-    encrypted: encrypt-data ctx #{0100} ; close notify
-    emit ctx [
-        #{15}                         ; protocol type (21=Alert)
-        ctx/ver-bytes                 ; protocol version
-        to-2bin length of encrypted  ; length of SSL record data
-        encrypted
-    ]
+    tls-seal ctx/msg ctx/encrypt-stream 21 ctx/ver-bytes #{0100}  ; close notify
 ]
 
 
@@ -804,7 +783,6 @@ finished: function [
     return: [binary!]
     ctx [object!]
 ][
-    ctx/seq-num-w: 0
     who-finished: if ctx/server? ["server finished"] else ["client finished"]
 
     seed: if ctx/version < 1.2 [
@@ -837,106 +815,32 @@ finished: function [
 ]
 
 
-encrypt-data: function [
-    return: [binary!]
+make-cipher: function [
+    {Record layer state for one direction, made when CHANGE-CIPHER-SPEC goes}
+
+    return: [handle!]
     ctx [object!]
-    content [binary!]
-    /type
-        [binary!] "application data is default"
+    /decrypt "Make the state for the server's records instead of ours"
 ][
-    type: default [#{17}]  ; #application
-
-    ; GenericBlockCipher: https://tools.ietf.org/html/rfc5246#section-6.2.3.2
-
-    if ctx/version > 1.0 [
-        ;
-        ; "The Initialization Vector (IV) SHOULD be chosen at random, and
-        ;  MUST be unpredictable.  Note that in versions of TLS prior to 1.1,
-        ;  there was no IV field, and the last ciphertext block of the
-        ;  previous record (the "CBC residue") was used as the IV.  This was
-        ;  changed to prevent the attacks described in [CBCATT].  For block
-        ;  ciphers, the IV length is SecurityParameters.record_iv_length,
-        ;  which is equal to the SecurityParameters.block_size."
-        ;
-        ctx/client-iv: copy #{}
-        loop ctx/block-size [append ctx/client-iv (random-secure 256) - 1]
-    ]
-
-    ; Message Authentication Code
-    ; https://tools.ietf.org/html/rfc5246#section-6.2.3.1
+    ; The MAC, padding, encryption and sequence numbers of the records are
+    ; all handled by TLS-SEAL and TLS-OPEN in the crypt extension, working in
+    ; place in the message buffers.  In TLS 1.0 the CBC state chains from the
+    ; IV in the key block through each record (the "CBC residue"), while 1.1
+    ; and above send a new random IV with each record:
     ;
-    MAC: checksum/method/key join-all [
-        to-8bin ctx/seq-num-w               ; sequence number (64-bit int)
-        type                                ; msg type
-        ctx/ver-bytes                       ; version
-        to-2bin length of content           ; msg content length
-        content                             ; msg content
-    ] (to word! ctx/hash-method) ctx/client-mac-key
-
-    data: join-all [content MAC]
-
-    if ctx/block-size [
-        ; add the padding data in CBC mode
-        padding: ctx/block-size - (
-            remainder (1 + (length of data)) ctx/block-size
-        )
-        len: 1 + padding
-        append data head of insert/dup make binary! len to-1bin padding len
-    ]
-
-    switch ctx/crypt-method [
-        @aes [
-            ctx/encrypt-stream: default [
-                aes-key ctx/client-crypt-key ctx/client-iv
-            ]
-            data: aes-stream ctx/encrypt-stream data
-
-            if ctx/version > 1.0 [
-                ; encrypt-stream must be reinitialized each time with the
-                ; new initialization vector.
-                ;
-                ctx/encrypt-stream: _
-            ]
-        ]
-    ] else [
-        fail ["Unsupported TLS crypt-method:" ctx/crypt-method]
-    ]
-
-    ; TLS versions 1.1 and above include the client-iv in plaintext.
+    ; https://tools.ietf.org/html/rfc5246#section-6.2.3.2
     ;
-    if ctx/version > 1.0 [
-        insert data ctx/client-iv
-        unset in ctx 'client-iv  ; avoid accidental reuse
-    ]
-
-    return data
-]
-
-
-decrypt-data: function [
-    return: [binary!]
-    ctx [object!]
-    data [binary!]
-][
-    switch ctx/crypt-method [
-        @aes [
-            ctx/decrypt-stream: default [
-                aes-key/decrypt ctx/server-crypt-key ctx/server-iv
-            ]
-            data: aes-stream ctx/decrypt-stream data
-
-            ; TLS 1.1 and above must use a new initialization vector each time
-            ; so the decrypt stream has to get GC'd.
-            ;
-            if ctx/version > 1.0 [
-                ctx/decrypt-stream: _
-            ]
-        ]
-    ] else [
+    if ctx/crypt-method <> @aes [
         fail ["Unsupported TLS crypt-method:" ctx/crypt-method]
     ]
-
-    return data
+    method: to word! ctx/hash-method
+    if decrypt [
+        iv: if ctx/version = 1.0 [ctx/server-iv] else [_]
+        return tls-cipher/decrypt
+            ctx/server-crypt-key ctx/server-mac-key method iv
+    ]
+    iv: if ctx/version = 1.0 [ctx/client-iv] else [_]
+    return tls-cipher ctx/client-crypt-key ctx/client-mac-key method iv
 ]
 
 
@@ -1046,36 +950,14 @@ parse-messages: function [
     result: make block! 8
     data: proto/messages
 
-    if ctx/encrypted? [
-        if ctx/block-size and [ctx/version > 1.0] [
-            ;
-            ; Grab the server's initialization vector, which will be new for
-            ; each message.
-            ;
-            ctx/server-iv: take/part data ctx/block-size
-        ]
-
-        change data decrypt-data ctx data
-        debug ["decrypting..."]
-
-        if ctx/block-size [
-            ; deal with padding in CBC mode
-            data: copy/part data (
-                ((length of data) - 1) - (last data)
-            )
-            debug ["depadding..."]
-            if ctx/version > 1.0 [
-                unset in ctx 'server-iv  ; avoid reuse in TLS 1.1 and above
-            ]
-        ]
-        debug ["data:" data]
-    ]
-    debug [ctx/seq-num-r ctx/seq-num-w "READ <--" proto/type]
+    debug ["READ <--" proto/type]
 
     if proto/type <> #handshake [
         if proto/type = #alert [
             if proto/messages/1 > 1 [
-                ; fatal alert level
+                ; fatal alert level, don't offer this session again
+                ;
+                put session-cache ctx/session-key null
                 fail [select alert-descriptions data/2 else ["unknown"]]
             ]
         ]
@@ -1181,6 +1063,29 @@ parse-messages: function [
                         ]
 
                         ctx/server-random: msg-obj/server-random
+                        ctx/suite-id: msg-obj/suite-id
+                        ctx/session-id: msg-obj/session-id
+
+                        all [
+                            ctx/offered-session
+                            not empty? ctx/session-id
+                            ctx/session-id = ctx/offered-session/1
+                        ] then [
+                            ; The server still has the session we offered, so
+                            ; there is no certificate or key exchange.  Its
+                            ; CHANGE-CIPHER-SPEC and FINISHED come next, using
+                            ; keys from the old master secret and new randoms.
+                            ;
+                            if any [
+                                ctx/suite-id <> ctx/offered-session/3
+                                ctx/version <> ctx/offered-session/4
+                            ][
+                                fail "TLS session resumed with other parameters"
+                            ]
+                            ctx/master-secret: ctx/offered-session/2
+                            ctx/resumed?: true
+                            make-keys ctx
+                        ]
                         msg-obj
                     ]
 
@@ -1359,7 +1264,6 @@ parse-messages: function [
                     ]
 
                     <finished> [
-                        ctx/seq-num-r: 0
                         who-finished: either ctx/server? [
                             "client finished"
                         ][
@@ -1387,6 +1291,13 @@ parse-messages: function [
 
                         debug "FINISHED MAC verify: OK"
 
+                        if not empty? ctx/session-id [
+                            put session-cache ctx/session-key reduce [
+                                ctx/session-id ctx/master-secret
+                                ctx/suite-id ctx/version now
+                            ]
+                        ]
+
                         context [
                             type: msg-type
                             length: len
@@ -1397,59 +1308,26 @@ parse-messages: function [
 
                 append ctx/handshake-messages copy/part data len + 4
 
-                skip-amount: either ctx/encrypted? [
-                    mac: copy/part skip data len + 4 ctx/hash-size
-
-                    mac-check: checksum/method/key join-all [
-                        to-8bin ctx/seq-num-r   ; 64-bit sequence number
-                        #{16}                   ; msg type
-                        ctx/ver-bytes           ; version
-                        to-2bin len + 4         ; msg content length
-                        copy/part data len + 4
-                    ] (to word! ctx/hash-method) ctx/server-mac-key
-
-                    if mac <> mac-check [
-                        fail "Bad handshake record MAC"
-                    ]
-
-                    4 + ctx/hash-size
-                ][
-                    4
-                ]
-
-                data: skip data (len + skip-amount)
+                data: skip data (len + 4)
             ]
         ]
 
         <change-cipher-spec> [
             ctx/encrypted?: true
+            ctx/decrypt-stream: make-cipher/decrypt ctx
             append result context [
                 type: 'ccs-message-type
             ]
         ]
 
         #application [
-            append result msg-obj: context [
+            append result context [
                 type: 'app-data
-                content: copy/part data (length of data) - ctx/hash-size
-            ]
-            len: length of msg-obj/content
-            mac: copy/part skip data len ctx/hash-size
-            mac-check: checksum/method/key join-all [
-                to-8bin ctx/seq-num-r   ; sequence number (64-bit int in R3)
-                #{17}                   ; msg type
-                ctx/ver-bytes           ; version
-                to-2bin len             ; msg content length
-                msg-obj/content         ; content
-            ] (to word! ctx/hash-method) ctx/server-mac-key
-
-            if mac <> mac-check [
-                fail "Bad application record MAC"
+                content: data
             ]
         ]
     ]
 
-    ctx/seq-num-r: ctx/seq-num-r + 1
     return result
 ]
 
@@ -1459,6 +1337,10 @@ parse-response: function [
     ctx [object!]
     msg [binary!]
 ][
+    if ctx/encrypted? [
+        tls-open ctx/decrypt-stream msg  ; in place, checks padding and MAC
+    ]
+
     proto: parse-protocol msg
     messages: parse-messages ctx proto
 
@@ -1491,58 +1373,13 @@ prf: function [
     seed [binary!]
     output-length [integer!]
 ][
-    ; The seed for the underlying P_<hash> is the PRF's seed appended to the
-    ; label.  The label is hashed as-is, so no null terminator.
-    ;
-    ; PRF(secret, label, seed) = P_<hash>(secret, label + seed)
+    ; TLS 1.2 made the PRF part of the cipher suite, but all the suites in
+    ; its RFC use P_SHA256.  Earlier versions had one fixed MD5/SHA1 mix.
     ;
-    seed: join-all [#{} label seed]
-
     if ctx/version < 1.2 [
-        ;
-        ; Prior to TLS 1.2, the pseudo-random function was driven by a strange
-        ; mixed method that's half MD5 and half SHA-1 hashing, regardless of
-        ; cipher suite used: https://tools.ietf.org/html/rfc4346#section-5
-
-        len: length of secret
-        mid: to integer! (.5 * (len + either odd? len [1] [0]))
-
-        s-1: copy/part secret mid
-        s-2: copy at secret mid + either odd? len [0] [1]
-
-        p-md5: copy #{}
-        a: seed  ; A(0)
-        while [output-length > length of p-md5] [
-            a: checksum/method/key a 'md5 s-1 ; A(n)
-            append p-md5 checksum/method/key join-all [a seed] 'md5 s-1
-        ]
-
-        p-sha1: copy #{}
-        a: seed  ; A(0)
-        while [output-length > length of p-sha1] [
-            a: checksum/method/key a 'sha1 s-2 ; A(n)
-            append p-sha1 checksum/method/key join-all [a seed] 'sha1 s-2
-        ]
-        return (
-            (copy/part p-md5 output-length)
-            xor+ (copy/part p-sha1 output-length)
-        )
-    ]
-
-    ; TLS 1.2 includes the pseudorandom function as part of its cipher
-    ; suite definition.  No cipher suites assume the md5/sha1 combination
-    ; used above by TLS 1.0 and 1.1.  All cipher suites listed in the
-    ; TLS 1.2 spec use `P_SHA256`, which is driven by the single SHA256
-    ; hash function: https://tools.ietf.org/html/rfc5246#section-5
-
-    p-sha256: copy #{}
-    a: seed  ; A(0)
-    while [output-length > length of p-sha256] [
-        a: hmac-sha256 secret a
-        append p-sha256 hmac-sha256 secret join-all [a seed]
+        return tls-prf/legacy secret label seed output-length
     ]
-    take/last/part p-sha256 ((length of p-sha256) - output-length)
-    return p-sha256
+    return tls-prf secret label seed output-length
 ]
 
 
@@ -1578,6 +1415,40 @@ make-master-secret: function [
 ]
 
 
+make-keys: function [
+    {Split the key block made from the master secret into the session keys}
+
+    return: <void>
+    ctx [object!]
+][
+    make-key-block ctx
+
+    ctx/client-mac-key: copy/part ctx/key-block ctx/hash-size
+    ctx/server-mac-key: copy/part skip ctx/key-block ctx/hash-size ctx/hash-size
+    ctx/client-crypt-key: copy/part skip ctx/key-block 2 * ctx/hash-size ctx/crypt-size
+    ctx/server-crypt-key: copy/part skip ctx/key-block (2 * ctx/hash-size) + ctx/crypt-size ctx/crypt-size
+
+    if ctx/block-size [
+        if ctx/version = 1.0 [
+            ;
+            ; Block ciphers in TLS 1.0 used an implicit initialization vector
+            ; (IV) to seed the encryption process.  This has vulnerabilities.
+            ;
+            ctx/client-iv: copy/part skip ctx/key-block 2 * (ctx/hash-size + ctx/crypt-size) ctx/block-size
+            ctx/server-iv: copy/part skip ctx/key-block (2 * (ctx/hash-size + ctx/crypt-size)) + ctx/block-size ctx/block-size
+        ] else [
+            ;
+            ; Each encrypted message in TLS 1.1 and above carry a plaintext
+            ; initialization vector, so the ctx does not use one for the whole
+            ; session.  Unset it to make sure.
+            ;
+            unset in ctx 'client-iv
+            unset in ctx 'server-iv
+        ]
+    ]
+]
+
+
 do-commands: function [
     return: <void>
     ctx [object!]
@@ -1607,8 +1478,7 @@ do-commands: function [
                     alert-close-notify ctx
                 )
             ] (
-                debug [ctx/seq-num-r ctx/seq-num-w "WRITE -->" cmd]
-                ctx/seq-num-w: ctx/seq-num-w + 1
+                debug ["WRITE -->" cmd]
                 update-write-state ctx cmd
             )
         ]
@@ -1636,8 +1506,6 @@ tls-init: function [
     return: <void>
     ctx [object!]
 ][
-    ctx/seq-num-r: 0
-    ctx/seq-num-w: 0
     ctx/mode: _
     ctx/encrypted?: false
     assert [not ctx/suite]
@@ -1726,11 +1594,19 @@ tls-awake: function [
         'connect [
             do-commands tls-port/state [<client-hello>]
 
-            if tls-port/state/resp/1/type = #handshake [
-                do-commands tls-port/state [
-                    <client-key-exchange>
-                    <change-cipher-spec>
-                    <finished>
+            case [
+                tls-port/state/resumed? [
+                    do-commands tls-port/state [
+                        <change-cipher-spec>
+                        <finished>
+                    ]
+                ]
+                tls-port/state/resp/1/type = #handshake [
+                    do-commands tls-port/state [
+                        <client-key-exchange>
+                        <change-cipher-spec>
+                        <finished>
+                    ]
                 ]
             ]
             insert system/ports/system make event! [
@@ -1745,6 +1621,11 @@ tls-awake: function [
                 <close-notify> [
                     return true
                 ]
+                <finished> [
+                    if tls-port/state/resumed? [
+                        return true  ; server finished first, nothing to read
+                    ]
+                ]
                 #application [
                     insert system/ports/system make event! [
                         type: 'wrote
@@ -1815,6 +1696,16 @@ tls-awake: function [
             ]
             return true
         ]
+
+        'error [
+            tls-port/error: port/error
+            port/error: _
+            insert system/ports/system make event! [
+                type: 'error
+                port: tls-port
+            ]
+            return true
+        ]
     ]
 
     close port
@@ -1838,7 +1729,10 @@ sys/make-scheme [
         ]
 
         write: func [port [port!] value [<opt> any-value!]] [
-            if find [#encrypted-handshake #application] port/state/mode [
+            if any [
+                find [#encrypted-handshake #application] port/state/mode
+                port/state/resumed? and [port/state/mode = <finished>]
+            ][
                 do-commands/no-wait port/state compose [
                     #application (value)
                 ]
@@ -1876,9 +1770,15 @@ sys/make-scheme [
                 ; Used by https://en.wikipedia.org/wiki/Server_Name_Indication
                 host-name: port/spec/host
 
+                session-key: unspaced [port/spec/host ":" port/spec/port-id]
+                session-id: _
+                offered-session: _  ; entry from SESSION-CACHE, if any
+                resumed?: false
+
                 mode: _
 
                 suite: _
+                suite-id: _
 
                 cipher-suite: does [first find suite word!]
 
@@ -1909,9 +1809,6 @@ sys/make-scheme [
                 server-mac-key: _
                 server-iv: _
 
-                seq-num-r: 0
-                seq-num-w: 0
-
                 msg: make binary! 4096
 
                 ; all messages from Handshake records except "HelloRequest"
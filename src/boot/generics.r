@@ -49,6 +49,7 @@ REBOL [
 
 add: generic [
     {Returns the addition of two values.}
+    <pure>
     return: [<requote> any-scalar! date! binary!]
     value1 [<dequote> any-scalar! date! binary!]
     value2
@@ -56,6 +57,7 @@ add: generic [
 
 subtract: generic [
     {Returns the second value subtracted from the first.}
+    <pure>
     return: [<requote> any-scalar! date! binary!]
     value1 [<dequote> any-scalar! date! binary!]
     value2 [any-scalar! date!]
@@ -63,6 +65,7 @@ subtract: generic [
 
 multiply: generic [
     {Returns the first value multiplied by the second.}
+    <pure>
     return: [<requote> any-scalar!]
     value1 [<dequote> any-scalar!]
     value2 [any-scalar!]
@@ -70,6 +73,7 @@ multiply: generic [
 
 divide: generic [
     {Returns the first value divided by the second.}
+    <pure>
     return: [<requote> any-scalar!]
     value1 [<dequote> any-scalar!]
     value2 [any-scalar!]
@@ -77,6 +81,7 @@ divide: generic [
 
 remainder: generic [
     {Returns the remainder of first value divided by second.}
+    <pure>
     return: [<requote> any-scalar!]
     value1 [<dequote> any-scalar!]
     value2 [any-scalar!]
@@ -84,6 +89,7 @@ remainder: generic [
 
 power: generic [
     {Returns the first number raised to the second number.}
+    <pure>
     return: [<requote> any-number!]
     number [<dequote> any-number!]
     exponent [any-number!]
@@ -151,6 +157,7 @@ difference: generic [
 
 negate: generic [
     {Changes the sign of a number.}
+    <pure>
     number [any-number! pair! money! time! bitset!]
 ]
 
@@ -161,6 +168,7 @@ complement: generic [
 
 absolute: generic [
     {Returns the absolute value.}
+    <pure>
     value [any-number! pair! money! time!]
 ]
 
@@ -190,11 +198,13 @@ random: generic [
 
 odd?: generic [
     {Returns TRUE if the number is odd.}
+    <pure>
     number [any-number! char! date! money! time! pair!]
 ]
 
 even?: generic [
     {Returns TRUE if the number is even.}
+    <pure>
     number [any-number! char! date! money! time! pair!]
 ]
 
@@ -406,6 +416,8 @@ sort: generic [
         [any-number! any-series!]
     /all "Compare all fields"
     /reverse "Reverse sort order"
+    /key "Sort by the result of an action run once on each value"
+        [action!]
 ]
 
 ; Port actions:
@@ -454,6 +466,8 @@ read: generic [
         [any-number!]
     /string "Convert UTF and line terminators to standard text string"
     /lines "Convert to block of strings (implies /string)"
+    /into "Append the data to the tail of this binary (and return it)"
+        [binary!]
 ]
 
 write: generic [
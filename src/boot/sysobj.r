@@ -117,6 +117,7 @@ options: make object! [  ; Options supplied to REBOL during startup
     current-path: _ ; Current URL! or FILE! path to use for relative lookups
 
     encap: _        ; The encapping data extracted
+    module-cache: _ ; Directory for scanned scripts (see SCAN-SCRIPT), or blank
     script: _       ; Filename of script to evaluate
     args: _         ; Command line arguments passed to script
     debug: _        ; debug flags
@@ -312,6 +313,11 @@ standard: make object! [
         ; otherwise the OS will pick an available port and stick with it.)
         ;
         local-id: _
+
+        ; How many bytes a READ without /PART makes room for in the receive
+        ; buffer (blank means the network extension's default, 32K).
+        ;
+        buffer-size: _
     ]
 
     port-spec-serial: make port-spec-head [
@@ -320,6 +326,8 @@ standard: make object! [
         parity: _
         stop-bits: 1
         flow-control: _ ;not supported on all systems
+        buffer-size: 65536 ;bytes the background reader holds for READ
+        low-water: 1 ;READ waits until this many bytes have come in
     ]
 
     port-spec-signal: make port-spec-head [
@@ -43,6 +43,10 @@ image!  ; !!! for LOAD #[image! [...]] (used in tests), and molding, temporary
 vector!  ; !!! for molding, temporary
 gob!  ; !!! for molding, temporary
 struct!  ; !!! for molding, temporary
+table!  ; !!! for molding, temporary
+pmap!  ; !!! for molding, temporary
+pvector!  ; !!! for molding, temporary
+cache!  ; !!! for molding, temporary
 library!  ; !!! for molding, temporary
 
 
@@ -259,6 +263,7 @@ local
 ;
 defer
 postpone
+pure
 
 ; Event:
 type
@@ -272,6 +277,7 @@ shift
 
 ; Checksum
 sha1
+sha256
 md4
 md5
 crc32
@@ -306,6 +312,7 @@ raw-memory
 raw-size
 extern
 rebval
+buffer
 
 ;routine
 ;void -- already specified
@@ -330,6 +337,18 @@ n64-soft-float; mips abi
 ...
 varargs
 
+; IMAGE-CONVERT
+grayscale
+invert
+swap-rb
+premultiply
+unpremultiply
+
+; RANDOM-GENERATOR
+knuth
+xoshiro256
+pcg64
+
 ; Gobs:
 gob
 offset
@@ -456,3 +475,22 @@ exclude
 ;read  ; covered above
 ;write  ; covered above
 exec
+
+; RECYCLE/POLICY choices for how the ballast is reset after each recycle
+;
+fixed
+proportional
+pause
+
+; VECTOR-MATH (in the VECTOR! extension) names its operation with the word
+; for what it does to one pair of values.  ADD, SUBTRACT, etc. are generics
+; and have SYM_XXX already.
+;
+minimum
+maximum
+equal?
+not-equal?
+lesser?
+lesser-or-equal?
+greater?
+greater-or-equal?
@@ -35,7 +35,7 @@
 #undef PVAR
 #undef TVAR
 
-#define PVAR
-#define TVAR
+#define PVAR REB_INSTANCE_VAR
+#define TVAR REB_INSTANCE_VAR
 
 #include "sys-globals.h"
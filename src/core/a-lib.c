@@ -82,7 +82,7 @@
 
 #include "sys-core.h"
 
-static bool PG_Api_Initialized = false;
+static REB_INSTANCE_VAR bool PG_Api_Initialized = false;
 
 
 //
@@ -327,6 +327,9 @@ void Startup_Api(void)
 {
     assert(not PG_Api_Initialized);
     PG_Api_Initialized = true;
+
+    TG_Api_Scoped = Make_Series(15, sizeof(REBNOD*));
+    TG_Api_Scope_Depth = 0;
 }
 
 
@@ -340,6 +343,10 @@ void Shutdown_Api(void)
 {
     assert(PG_Api_Initialized);
     PG_Api_Initialized = false;
+
+    assert(TG_Api_Scope_Depth == 0);
+    Free_Unmanaged_Series(TG_Api_Scoped);
+    TG_Api_Scoped = nullptr;
 }
 
 
@@ -885,6 +892,195 @@ bool RL_rebNot(unsigned char quotes, const void *p, va_list *vaptr)
  { return not RL_rebDid(quotes, p, vaptr); }
 
 
+//=//// PREPARED CALLS ////////////////////////////////////////////////////=//
+//
+// A host that calls the same Rebol code in a loop pays for the feed each
+// time: the UTF-8 is found in the scan cache (or scanned), and every spliced
+// argument is an API handle from Alloc_Value() to be rebRelease()'d.
+//
+// rebPrepare() evaluates its code once to an ACTION!, and gives back a
+// FRAME! for it whose argument slots can be written with C values directly:
+//
+//     REBVAL *h = rebPrepare("func [x [integer!] s [text!]] [...]");
+//     rebSlotInteger(h, 1, 10);
+//     rebSlotText(h, 2, "x");
+//     REBVAL *result = rebInvoke(h);  // h can be invoked again
+//
+// Slots are the ordinary arguments, numbered from 1 in the order the spec
+// gives them (refinements and locals don't count).  Values are type checked
+// when the action is invoked, as with DO of a FRAME!.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+
+
+//
+//  rebPrepare: RL_API
+//
+// Evaluate code to an ACTION!, returning a FRAME! that rebInvoke() can run.
+// The handle is released like any other (rebUnmanage() it to keep it past
+// the current frame).
+//
+REBVAL *RL_rebPrepare(unsigned char quotes, const void *p, va_list *vaptr)
+{
+    REBVAL *prepared = Alloc_Value();
+    Run_Va_May_Fail(prepared, quotes, p, vaptr);  // calls va_end()
+
+    if (not IS_ACTION(prepared)) {
+        rebRelease(prepared);
+        fail ("rebPrepare() code must evaluate to an ACTION!");
+    }
+
+    REBCTX *exemplar = Make_Context_For_Action(
+        prepared,  // being used here as input (e.g. the ACTION!)
+        DSP,  // no refinements to weave in
+        nullptr  // no binder needed, not running any code
+    );
+    return Init_Frame(prepared, exemplar);
+}
+
+
+// Find the cell for the nth argument of a prepared call.
+//
+static REBVAL *Prepared_Slot(const REBVAL *prepared, unsigned int n)
+{
+    if (not IS_FRAME(prepared))
+        fail ("Prepared call must be a FRAME! from rebPrepare()");
+
+    REBCTX *c = VAL_CONTEXT(prepared);  // checks for INACCESSIBLE
+    REBVAL *key = CTX_KEYS_HEAD(c);
+    REBVAL *var = CTX_VARS_HEAD(c);
+    for (; NOT_END(key); ++key, ++var) {
+        if (Is_Param_Hidden(key))
+            continue;  // specialized out
+        if (TYPE_CHECK(key, REB_TS_REFINEMENT))
+            continue;
+
+        Reb_Param_Class pclass = VAL_PARAM_CLASS(key);
+        if (pclass == REB_P_LOCAL or pclass == REB_P_RETURN)
+            continue;
+
+        if (--n == 0)
+            return var;
+    }
+
+    fail ("Prepared call has no argument slot with that number");
+}
+
+
+//
+//  rebSlot: RL_API
+//
+// Write a value into the nth argument slot of a prepared call.  Passing C's
+// nullptr makes the slot null.
+//
+void RL_rebSlot(REBVAL *prepared, unsigned int n, const REBVAL *v)
+{
+    REBVAL *slot = Prepared_Slot(prepared, n);
+    if (v == nullptr)
+        Init_Nulled(slot);
+    else
+        Move_Value(slot, v);
+}
+
+
+//
+//  rebSlotInteger: RL_API
+//
+void RL_rebSlotInteger(REBVAL *prepared, unsigned int n, int64_t i)
+  { Init_Integer(Prepared_Slot(prepared, n), i); }
+
+
+//
+//  rebSlotDecimal: RL_API
+//
+void RL_rebSlotDecimal(REBVAL *prepared, unsigned int n, double dec)
+  { Init_Decimal(Prepared_Slot(prepared, n), dec); }
+
+
+//
+//  rebSlotLogic: RL_API
+//
+void RL_rebSlotLogic(REBVAL *prepared, unsigned int n, bool logic)
+  { Init_Logic(Prepared_Slot(prepared, n), did logic); }
+
+
+//
+//  rebSlotText: RL_API
+//
+// The text is copied into a new TEXT! series (but there's no API handle).
+//
+void RL_rebSlotText(REBVAL *prepared, unsigned int n, const char *utf8)
+{
+    REBVAL *slot = Prepared_Slot(prepared, n);
+    REBSTR *s = Append_UTF8_May_Fail(
+        nullptr,
+        utf8,
+        strsize(utf8),
+        STRMODE_ALL_CODEPOINTS
+    );
+    Init_Text(slot, s);
+}
+
+
+//
+//  rebInvoke: RL_API
+//
+// Run a prepared call with the values currently in its slots.  Unlike DO of
+// a FRAME!, this doesn't steal the frame's variables: they're copied into
+// the cells of the running frame (whose storage is reused from call to
+// call), so the prepared call can be invoked over and over.
+//
+REBVAL *RL_rebInvoke(REBVAL *prepared)
+{
+    if (not IS_FRAME(prepared))
+        fail ("rebInvoke() needs a FRAME! from rebPrepare()");
+
+    REBCTX *c = VAL_CONTEXT(prepared);  // checks for INACCESSIBLE
+    REBACT *phase = VAL_PHASE(prepared);
+    assert(CTX_KEYS_HEAD(c) == ACT_PARAMS_HEAD(phase));
+
+    REBVAL *result = Alloc_Value();
+
+    REBFLGS saved_sigmask = Eval_Sigmask;
+    Eval_Sigmask &= ~SIG_HALT;  // We don't want halt or Ctrl-C during APIs
+
+    DECLARE_END_FRAME (
+        f,
+        EVAL_MASK_DEFAULT
+            | EVAL_FLAG_FULLY_SPECIALIZED
+            | EVAL_FLAG_PROCESS_ACTION
+    );
+
+    Push_Frame(result, f);
+    Push_Action(f, phase, VAL_BINDING(prepared));
+
+    REBVAL *var = CTX_VARS_HEAD(c);
+    REBVAL *arg = f->arg;
+    for (; NOT_END(var); ++var, ++arg)
+        Move_Value(Prep_Stack_Cell(arg), var);
+
+    f->special = f->arg;  // typecheck the args in place, see DO of FRAME!
+
+    REBSTR *opt_label = nullptr;
+    Begin_Prefix_Action(f, opt_label);
+
+    bool threw = Eval_Throws(f);
+
+    Drop_Frame(f);
+
+    Eval_Sigmask = saved_sigmask;
+
+    if (threw)
+        fail (Error_No_Catch_For_Throw(result));
+
+    if (not IS_NULLED(result))
+        return result;  // caller must rebRelease()
+
+    rebRelease(result);
+    return nullptr;  // No NULLED cells in API, see notes on NULLIFY_NULLED()
+}
+
+
 
 //
 //  rebUnbox: RL_API
@@ -1253,6 +1449,102 @@ unsigned char *RL_rebBytes(
 }
 
 
+//=//// DIRECT ACCESSORS //////////////////////////////////////////////////=//
+//
+// rebUnboxInteger(v), rebSpell(v) and rebBytes(v) are variadic, so even when
+// handed a single REBVAL* they run it through a feed and the evaluator, and
+// the spelling routines copy into rebMalloc() memory.  A bridge marshalling
+// values by the million can use these instead.  They take exactly one value,
+// don't evaluate, and fail if it is not of the type asked for.
+//
+// The views return a pointer *into* the series, which is not copied.  It
+// stays valid only as long as the value's handle is alive (that is what
+// keeps the series from being GC'd) and the series is not modified.  The
+// data is '\0' terminated at the tail of the series.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+
+
+//
+//  rebIntegerOf: RL_API
+//
+int64_t RL_rebIntegerOf(const REBVAL *v)
+{
+    if (v == nullptr or not IS_INTEGER(v))
+        fail ("rebIntegerOf() called on non-INTEGER!");
+
+    return VAL_INT64(v);  // fails if promoted past 64 bits
+}
+
+
+//
+//  rebDecimalOf: RL_API
+//
+double RL_rebDecimalOf(const REBVAL *v)
+{
+    if (v == nullptr or not (IS_DECIMAL(v) or IS_PERCENT(v)))
+        fail ("rebDecimalOf() called on non-DECIMAL!");
+
+    return VAL_DECIMAL(v);
+}
+
+
+//
+//  rebLogicOf: RL_API
+//
+bool RL_rebLogicOf(const REBVAL *v)
+{
+    if (v == nullptr or not IS_LOGIC(v))
+        fail ("rebLogicOf() called on non-LOGIC!");
+
+    return VAL_LOGIC(v);
+}
+
+
+//
+//  rebTextView: RL_API
+//
+// Borrow the UTF-8 of an ANY-STRING! (from its index) or ANY-WORD!.  C's
+// nullptr is passed through, giving nullptr and a size of 0.
+//
+const char *RL_rebTextView(const REBVAL *v, size_t *size_out)
+{
+    if (v == nullptr) {
+        *size_out = 0;
+        return nullptr;  // NULL is passed through, for opting out
+    }
+
+    if (not (ANY_STRING(v) or ANY_WORD(v)))
+        fail ("rebTextView() only works with ANY-STRING!/ANY-WORD!");
+
+    REBSIZ size;
+    const REBYTE *utf8 = VAL_UTF8_AT(&size, v);
+    *size_out = size;
+    return cs_cast(utf8);
+}
+
+
+//
+//  rebBytesView: RL_API
+//
+// Borrow the bytes of a BINARY! from its index.  C's nullptr is passed
+// through, giving nullptr and a size of 0.
+//
+const unsigned char *RL_rebBytesView(const REBVAL *v, size_t *size_out)
+{
+    if (v == nullptr) {
+        *size_out = 0;
+        return nullptr;  // NULL is passed through, for opting out
+    }
+
+    if (not IS_BINARY(v))
+        fail ("rebBytesView() only works with BINARY!");
+
+    *size_out = VAL_LEN_AT(v);
+    return VAL_BIN_AT(v);
+}
+
+
 //=//// EXCEPTION HANDLING ////////////////////////////////////////////////=//
 //
 // The API is approaching exception handling with three different modes.
@@ -1280,36 +1572,19 @@ unsigned char *RL_rebBytes(
 // clients being able to use normal try/catch of a RebolError instead of
 // having to go through rebRescue().
 //
-// !!! Currently only the setjmp()/longjmp() form is emulated.  Clients must
-// either explicitly TRAP errors within their Rebol code calls, or use the
-// rebRescue() abstraction to catch the setjmp/longjmp failures.  Rebol
+// !!! Currently the setjmp()/longjmp() form is the default, and C++ builds
+// may define REBOL_FAIL_USES_EXCEPTIONS for the second (see %reb-config.h).
+// Either way, clients must explicitly TRAP errors within their Rebol code
+// calls, or use the rebRescue() abstraction to catch the failures.  Rebol
 // THROW and CATCH cannot be thrown across an API call barrier--it will be
 // handled as an uncaught throw and raised as an error.
 //
 //=////////////////////////////////////////////////////////////////////////=//
 
+// The part of rebRescue() that runs under the trap.
 //
-//  rebRescue: RL_API
-//
-// This API abstracts the mechanics by which exception-handling is done.
-//
-// Using rebRescue() internally to the core allows it to be compiled and run
-// compatibly regardless of what .  It is named after Ruby's operation,
-// which deals with the identical problem:
-//
-// http://silverhammermba.github.io/emberb/c/#rescue
-//
-// !!! As a first step, this only implements the setjmp/longjmp logic.
-//
-REBVAL *RL_rebRescue(
-    REBDNG *dangerous, // !!! pure C function only if not using throw/catch!
-    void *opaque
-){
-    struct Reb_State state;
-    REBCTX *error_ctx;
-
-    PUSH_TRAP(&error_ctx, &state);
-
+static REBVAL *Rescue_Dangerous_Core(REBDNG *dangerous, void *opaque)
+{
     // We want allocations that occur in the body of the C function for the
     // rebRescue() to be automatically cleaned up in the case of an error.
     //
@@ -1320,6 +1595,9 @@ REBVAL *RL_rebRescue(
     // so it has to be an "action frame".  Improve mechanic later, but for
     // now pretend to be applying a dummy native.
     //
+    // If there is a fail(), Fail_Core() drops this frame along with the
+    // others above the trap, flagging it so its API handles may leak.
+    //
     DECLARE_END_FRAME (f, EVAL_MASK_DEFAULT);  // not FULLY_SPECIALIZED
     Push_Frame(nullptr, f);
 
@@ -1336,18 +1614,6 @@ REBVAL *RL_rebRescue(
     f->was_eval_called = true;  // "fake" frame, okay to lie
   #endif
 
-    // The first time through the following code 'error' will be null, but...
-    // `fail` can longjmp here, so 'error' won't be null *if* that happens!
-    //
-    if (error_ctx) {
-        assert(f->varlist);  // action must be running
-        REBARR *stub = f->varlist;  // will be stubbed, with info bits reset
-        Drop_Action(f);
-        SET_SERIES_FLAG(stub, VARLIST_FRAME_FAILED);  // signal API leaks ok
-        Abort_Frame(f);
-        return Init_Error(Alloc_Value(), error_ctx);
-    }
-
     REBVAL *result = (*dangerous)(opaque);
 
     Drop_Action(f);
@@ -1359,6 +1625,55 @@ REBVAL *RL_rebRescue(
     //
     Drop_Frame_Unbalanced(f);
 
+    return result;
+}
+
+
+//
+//  rebRescue: RL_API
+//
+// This API abstracts the mechanics by which exception-handling is done.
+//
+// Using rebRescue() internally to the core allows it to be compiled and run
+// compatibly regardless of what .  It is named after Ruby's operation,
+// which deals with the identical problem:
+//
+// http://silverhammermba.github.io/emberb/c/#rescue
+//
+// Builds with REBOL_FAIL_USES_EXCEPTIONS use try/catch, others setjmp().
+//
+REBVAL *RL_rebRescue(
+    REBDNG *dangerous, // !!! pure C function only if not using throw/catch!
+    void *opaque
+){
+    struct Reb_State state;
+
+  #if defined(REBOL_FAIL_USES_EXCEPTIONS)
+    PUSH_TRAP_SCOPE(&state);
+
+    REBVAL *result;
+    try {
+        result = Rescue_Dangerous_Core(dangerous, opaque);
+    }
+    catch (struct Reb_State *s) {  // thrown by Fail_Core()
+        assert(s == &state);
+        Trapped_Helper(s);
+        return Init_Error(Alloc_Value(), s->error);
+    }
+  #else
+    REBCTX *error_ctx;
+
+    PUSH_TRAP(&error_ctx, &state);
+
+    // The first time through the following code 'error' will be null, but...
+    // `fail` can longjmp here, so 'error' won't be null *if* that happens!
+    //
+    if (error_ctx)
+        return Init_Error(Alloc_Value(), error_ctx);
+
+    REBVAL *result = Rescue_Dangerous_Core(dangerous, opaque);
+  #endif
+
     DROP_TRAP_SAME_STACKLEVEL_AS_PUSH(&state);
 
     if (not result)
@@ -1406,7 +1721,22 @@ REBVAL *RL_rebRescueWith(
     struct Reb_State state;
     REBCTX *error_ctx;
 
+  #if defined(REBOL_FAIL_USES_EXCEPTIONS)
+    PUSH_TRAP_SCOPE(&state);
+
+    REBVAL *result;
+    try {
+        result = (*dangerous)(opaque);  // guarded by trap
+        error_ctx = nullptr;
+    }
+    catch (struct Reb_State *s) {  // thrown by Fail_Core()
+        assert(s == &state);
+        Trapped_Helper(s);
+        error_ctx = s->error;
+    }
+  #else
     PUSH_TRAP(&error_ctx, &state);
+  #endif
 
     // The first time through the following code 'error' will be null, but...
     // `fail` can longjmp here, so 'error' won't be null *if* that happens!
@@ -1414,13 +1744,15 @@ REBVAL *RL_rebRescueWith(
     if (error_ctx) {
         REBVAL *error = Init_Error(Alloc_Value(), error_ctx);
 
-        REBVAL *result = (*rescuer)(error, opaque);  // *not* guarded by trap!
+        REBVAL *rescued = (*rescuer)(error, opaque);  // *not* guarded by trap!
 
         rebRelease(error);
-        return result;  // no special handling, may be null
+        return rescued;  // no special handling, may be null
     }
 
+  #if !defined(REBOL_FAIL_USES_EXCEPTIONS)
     REBVAL *result = (*dangerous)(opaque);  // guarded by trap
+  #endif
     assert(not IS_NULLED(result));  // nulled cells not exposed by API
 
     DROP_TRAP_SAME_STACKLEVEL_AS_PUSH(&state);
@@ -1448,6 +1780,24 @@ void RL_rebHalt(void)
 }
 
 
+//
+//  rebSample: RL_API
+//
+// Request that the sampling profiler record the stack of running actions.
+//
+// Returns:
+//     nothing
+// Notes:
+//     Like rebHalt(), this only sets a signal, so it may be called from an
+//     OS signal handler (e.g. a SIGPROF timer from setitimer()).  Samples
+//     are only recorded while SAMPLER is on.
+//
+void RL_rebSample(void)
+{
+    SET_SIGNAL(SIG_SAMPLE);
+}
+
+
 
 //=//// API "INSTRUCTIONS" ////////////////////////////////////////////////=//
 //
@@ -1683,6 +2033,100 @@ void RL_rebRelease(const REBVAL *v)
 }
 
 
+//
+//  Note_Scoped_Api_Handle: C
+//
+// Called by Alloc_Value() while a rebPushScope() is in effect.
+//
+void Note_Scoped_Api_Handle(REBARR *singular)
+{
+    if (SER_FULL(TG_Api_Scoped))
+        Extend_Series(TG_Api_Scoped, 8);
+
+    *SER_AT(REBNOD*, TG_Api_Scoped, SER_USED(TG_Api_Scoped)) = NOD(singular);
+    SET_SERIES_USED(TG_Api_Scoped, SER_USED(TG_Api_Scoped) + 1);
+}
+
+
+//
+//  Prune_Scoped_Api_Handles: C
+//
+// Null out entries for nodes the GC has seen freed, so rebPopScope() won't
+// look at memory that may have been given back to the OS.
+//
+void Prune_Scoped_Api_Handles(void)
+{
+    REBNOD **np = SER_HEAD(REBNOD*, TG_Api_Scoped);
+    REBLEN n = SER_USED(TG_Api_Scoped);
+    for (; n != 0; --n, ++np) {
+        if (*np and IS_FREE_NODE(*np))
+            *np = nullptr;
+    }
+}
+
+
+//
+//  rebPushScope: RL_API
+//
+// Start a scope for API handles, to be ended by rebPopScope() with the
+// number this returns.  Every handle allocated until then (by this code or
+// anything it calls) is released by the rebPopScope(), so C code producing
+// lots of temporary values doesn't have to rebRelease() each one:
+//
+//     uintptr_t scope = rebPushScope();
+//     for (i = 0; i < n; ++i)
+//         process(rebValue("pick", block, rebI(i + 1)));
+//     rebPopScope(scope);
+//
+// A handle can still be rebRelease()'d early.  rebUnmanage() a handle to
+// let it outlive the scope.  Scopes nest, and a fail() ends any scopes
+// pushed since the trap that catches it.
+//
+uintptr_t RL_rebPushScope(void)
+{
+    ++TG_Api_Scope_Depth;
+    return SER_USED(TG_Api_Scoped);
+}
+
+
+//
+//  rebPopScope: RL_API
+//
+// Release the handles allocated since the matching rebPushScope().
+//
+// Handles released early were freed, and their nodes may have been reused.
+// But any node reused as an API handle while the scope was in effect was
+// noted again, so a live managed API handle in the list belongs to the
+// scope no matter which entry names it.  Anything else is skipped.
+//
+void RL_rebPopScope(uintptr_t scope)
+{
+    if (TG_Api_Scope_Depth == 0 or scope > SER_USED(TG_Api_Scoped))
+        fail ("rebPopScope() without a matching rebPushScope()");
+
+    REBLEN n = SER_USED(TG_Api_Scoped);
+    while (n != scope) {
+        --n;
+        REBNOD *node = *SER_AT(REBNOD*, TG_Api_Scoped, n);
+        if (not node)
+            continue;  // pruned by the GC, see Prune_Scoped_Api_Handles()
+
+        REBSER *s = SER(node);
+        if (IS_FREE_NODE(s))
+            continue;  // released early (or freed with a failed frame)
+        if (not (s->header.bits & NODE_FLAG_ROOT))
+            continue;  // node reused for something other than a handle
+        if (not (s->header.bits & NODE_FLAG_MANAGED))
+            continue;  // rebUnmanage()'d to outlive the scope
+
+        GC_Kill_Series(s);
+    }
+
+    SET_SERIES_USED(TG_Api_Scoped, scope);
+    --TG_Api_Scope_Depth;
+}
+
+
 //
 //  rebZdeflateAlloc: RL_API
 //
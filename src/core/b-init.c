@@ -41,6 +41,8 @@
 
 #include "sys-core.h"
 
+#include <time.h>  // clock(), used for the phase timings of STATS/STARTUP
+
 #define EVAL_DOSE 10000
 
 
@@ -160,6 +162,102 @@ void Set_Stack_Limit(void *base, uintptr_t bounds) {
 }
 
 
+// Boot records the time, memory growth, and pool node allocations of each of
+// its phases, so STATS/STARTUP (and `r3 --startup-profile`) can show where
+// startup latency goes.  This is done in all builds--it's a few dozen calls
+// to clock() per process.  Hosts can note phases of their own boot too.
+//
+// Each instance boots on its own (see REB_THREAD_INSTANCES), so it gets its
+// own table.
+//
+#define MAX_STARTUP_PHASES 32
+
+static REB_INSTANCE_VAR struct {
+    char label[32];
+    REBI64 usecs;  // processor time spent in the phase
+    REBI64 bytes;  // change in PG_Mem_Usage over the phase
+    REBI64 allocs;  // Make_Node() calls made during the phase
+} Startup_Phases[MAX_STARTUP_PHASES];
+
+static REB_INSTANCE_VAR REBLEN Num_Startup_Phases;
+static REB_INSTANCE_VAR clock_t Phase_Start_Clock;
+static REB_INSTANCE_VAR REBU64 Phase_Start_Mem;
+static REB_INSTANCE_VAR REBI64 Phase_Start_Allocs;
+
+static REBI64 Total_Pool_Allocs(void)
+{
+    if (Mem_Pools == nullptr)  // before Startup_Pools()
+        return 0;
+
+    REBI64 total = 0;
+    REBLEN n;
+    for (n = 0; n < SYSTEM_POOL; ++n)
+        total += Mem_Pools[n].allocs;
+    return total;
+}
+
+
+//
+//  Note_Startup_Phase: C
+//
+// Record the phase of startup that ended at this call.  The phase is the
+// work since the previous call (or the start of Startup_Core()).  Phases
+// past MAX_STARTUP_PHASES are folded into the last one.
+//
+void Note_Startup_Phase(const char *label)
+{
+    clock_t now = clock();
+    REBI64 allocs = Total_Pool_Allocs();
+
+    REBLEN n = Num_Startup_Phases;
+    if (n == MAX_STARTUP_PHASES)
+        --n;
+    else {
+        ++Num_Startup_Phases;
+        Startup_Phases[n].usecs = 0;
+        Startup_Phases[n].bytes = 0;
+        Startup_Phases[n].allocs = 0;
+    }
+
+    strncpy(Startup_Phases[n].label, label, sizeof(Startup_Phases[n].label));
+    Startup_Phases[n].label[sizeof(Startup_Phases[n].label) - 1] = '\0';
+
+    Startup_Phases[n].usecs += cast(REBI64,
+        (now - Phase_Start_Clock) * cast(REBI64, 1000000) / CLOCKS_PER_SEC
+    );
+    Startup_Phases[n].bytes +=
+        cast(REBI64, PG_Mem_Usage) - cast(REBI64, Phase_Start_Mem);
+    Startup_Phases[n].allocs += allocs - Phase_Start_Allocs;
+
+    Phase_Start_Clock = now;
+    Phase_Start_Mem = PG_Mem_Usage;
+    Phase_Start_Allocs = allocs;
+}
+
+
+//
+//  Make_Startup_Phases_Array: C
+//
+// Flat block of `label usecs bytes allocs` for each phase, for STATS/STARTUP.
+//
+REBARR *Make_Startup_Phases_Array(void)
+{
+    REBARR *a = Make_Array(Num_Startup_Phases * 4);
+    REBLEN n;
+    for (n = 0; n < Num_Startup_Phases; ++n) {
+        const char *label = Startup_Phases[n].label;
+        Init_Word(
+            Alloc_Tail_Array(a),
+            Intern_UTF8_Managed(cb_cast(label), strlen(label))
+        );
+        Init_Integer(Alloc_Tail_Array(a), Startup_Phases[n].usecs);
+        Init_Integer(Alloc_Tail_Array(a), Startup_Phases[n].bytes);
+        Init_Integer(Alloc_Tail_Array(a), Startup_Phases[n].allocs);
+    }
+    return a;
+}
+
+
 //
 //  Startup_True_And_False: C
 //
@@ -207,10 +305,8 @@ REBNATIVE(generic)
 
     REBVAL *spec = ARG(spec);
 
-    REBARR *paramlist = Make_Paramlist_Managed_May_Fail(
-        spec,
-        MKF_KEYWORDS | MKF_RETURN  // return type checked only in debug build
-    );
+    REBFLGS flags = MKF_KEYWORDS | MKF_RETURN;  // return checked only in debug
+    REBARR *paramlist = Make_Paramlist_Managed_May_Fail(spec, &flags);
 
     // !!! There is no system yet for extension types to register which of
     // the generic actions they can handle.  So for the moment, we just say
@@ -230,6 +326,18 @@ REBNATIVE(generic)
         ++param;
     TYPE_SET(param, REB_CUSTOM);
 
+    // A second argument that takes numbers may get a custom type too, so
+    // that e.g. `subtract vector1 vector2` reaches the VECTOR! dispatcher.
+    //
+    ++param;
+    if (
+        NOT_END(param)
+        and VAL_PARAM_CLASS(param) == REB_P_NORMAL
+        and TYPE_CHECK(param, REB_DECIMAL)
+    ){
+        TYPE_SET(param, REB_CUSTOM);
+    }
+
     REBACT *generic = Make_Action(
         paramlist,
         &Generic_Dispatcher,  // return type is only checked in debug build
@@ -241,6 +349,8 @@ REBNATIVE(generic)
     SET_ACTION_FLAG(generic, IS_NATIVE);
 
     REBARR *details = ACT_DETAILS(generic);
+    if (flags & MKF_IS_PURE)
+        SER(details)->header.bits |= DETAILS_FLAG_IS_PURE;
     Init_Word(ARR_AT(details, IDX_NATIVE_BODY), VAL_WORD_CANON(ARG(verb)));
     Init_Object(ARR_AT(details, IDX_NATIVE_CONTEXT), Lib_Context);
 
@@ -333,6 +443,7 @@ static void Init_Action_Spec_Tags(void)
     Root_Dequote_Tag = Make_Locked_Tag("dequote");
     Root_Requote_Tag = Make_Locked_Tag("requote");
     Root_Const_Tag = Make_Locked_Tag("const");
+    Root_Pure_Tag = Make_Locked_Tag("pure");
 
     // !!! Needed for bootstrap, as `@arg` won't LOAD in old r3
     //
@@ -352,6 +463,7 @@ static void Shutdown_Action_Spec_Tags(void)
     rebRelease(Root_Dequote_Tag);
     rebRelease(Root_Requote_Tag);
     rebRelease(Root_Const_Tag);
+    rebRelease(Root_Pure_Tag);
 
     rebRelease(Root_Modal_Tag);  // !!! only needed for bootstrap with old r3
 }
@@ -473,10 +585,8 @@ REBVAL *Make_Native(
     // the Natives table.  The associated C function is provided by a
     // table built in the bootstrap scripts, `Native_C_Funcs`.
 
-    REBARR *paramlist = Make_Paramlist_Managed_May_Fail(
-        KNOWN(spec),
-        MKF_KEYWORDS | MKF_RETURN  // return type checked only in debug build
-    );
+    REBFLGS flags = MKF_KEYWORDS | MKF_RETURN;  // return checked only in debug
+    REBARR *paramlist = Make_Paramlist_Managed_May_Fail(KNOWN(spec), &flags);
 
     REBACT *act = Make_Action(
         paramlist,
@@ -491,6 +601,8 @@ REBVAL *Make_Native(
         SET_ACTION_FLAG(act, ENFIXED);
 
     REBARR *details = ACT_DETAILS(act);
+    if (flags & MKF_IS_PURE)
+        SER(details)->header.bits |= DETAILS_FLAG_IS_PURE;
 
     // If a user-equivalent body was provided, we save it in the native's
     // REBVAL for later lookup.
@@ -781,6 +893,23 @@ static void Init_Root_Vars(void)
     // rely on a usermode stats module.
     //
     Root_Stats_Map = Init_Map(Alloc_Value(), Make_Map(10));
+
+    Root_Samples = Init_Block(Alloc_Value(), Make_Array(SAMPLE_RING_SIZE));
+    Root_Hotspots = Init_Blank(Alloc_Value());  // block made by HOTSPOTS
+    Root_Breakpoints = Init_Block(Alloc_Value(), Make_Array(0));
+
+    REBARR *scans = Make_Array(2 * SCAN_CACHE_SIZE);
+    REBLEN n;
+    for (n = 0; n < 2 * SCAN_CACHE_SIZE; ++n)
+        Init_Blank(Alloc_Tail_Array(scans));
+    CLEAR(TG_Scan_Cache, sizeof(TG_Scan_Cache));
+    Root_Scan_Cache = Init_Block(Alloc_Value(), scans);
+
+    REBARR *composes = Make_Array(COMPOSE_CACHE_SIZE);
+    for (n = 0; n < COMPOSE_CACHE_SIZE; ++n)
+        Init_Blank(Alloc_Tail_Array(composes));
+    CLEAR(TG_Compose_Arrays, sizeof(TG_Compose_Arrays));
+    Root_Compose_Cache = Init_Block(Alloc_Value(), composes);
 }
 
 static void Shutdown_Root_Vars(void)
@@ -788,6 +917,30 @@ static void Shutdown_Root_Vars(void)
     rebRelease(Root_Stats_Map);
     Root_Stats_Map = nullptr;
 
+    rebRelease(Root_Samples);
+    Root_Samples = nullptr;
+
+    if (TG_Hotspots) {
+        Free_Mem(TG_Hotspots, sizeof(REB_HOTSPOT) * TG_Hotspots_Size);
+        TG_Hotspots = nullptr;
+    }
+    TG_Counting_Steps = false;
+    rebRelease(Root_Hotspots);
+    Root_Hotspots = nullptr;
+
+    TG_Step_Hooks = false;
+    PG_Breakpoint_Hook_Throws = nullptr;
+    rebRelease(Root_Breakpoints);
+    Root_Breakpoints = nullptr;
+
+    rebRelease(Root_Scan_Cache);
+    Root_Scan_Cache = nullptr;
+    CLEAR(TG_Scan_Cache, sizeof(TG_Scan_Cache));
+
+    rebRelease(Root_Compose_Cache);
+    Root_Compose_Cache = nullptr;
+    CLEAR(TG_Compose_Arrays, sizeof(TG_Compose_Arrays));
+
     rebRelease(Root_Space_Char);
     Root_Space_Char = nullptr;
     rebRelease(Root_Newline_Char);
@@ -955,6 +1108,16 @@ void Startup_Task(void)
     Eval_Signals = 0;
     Eval_Sigmask = ALL_BITS;
     Eval_Limit = 0;
+    TG_Tail_Calls = true;
+    TG_Folded_Calls = 0;
+    TG_Shared_Keylists = 0;
+    TG_Sampling = false;
+    TG_Sample_Next = 0;
+    TG_Counting_Steps = false;
+    TG_Step_Hooks = false;
+    TG_Hotspots = nullptr;
+    TG_Hotspots_Size = 0;
+    TG_Hotspots_Used = 0;
 
     TG_Ballast = MEM_BALLAST; // or overwritten by debug build below...
     TG_Max_Ballast = MEM_BALLAST;
@@ -1096,8 +1259,10 @@ static void Startup_Sys(REBARR *boot_sys) {
 static REBVAL *Startup_Mezzanine(BOOT_BLK *boot)
 {
     Startup_Base(VAL_ARRAY(&boot->base));
+    Note_Startup_Phase("base");
 
     Startup_Sys(VAL_ARRAY(&boot->sys));
+    Note_Startup_Phase("sys");
 
     REBVAL *finish_init = CTX_VAR(Sys_Context, SYS_CTX_FINISH_INIT_CORE);
     assert(IS_ACTION(finish_init));
@@ -1121,6 +1286,7 @@ static REBVAL *Startup_Mezzanine(BOOT_BLK *boot)
     if (not IS_VOID(result))
         panic (result); // FINISH-INIT-CORE is a PROCEDURE, returns void
 
+    Note_Startup_Phase("mezz");
     return NULL;
 }
 
@@ -1195,6 +1361,11 @@ void Startup_Core(void)
     PG_Probe_Failures = false;
   #endif
 
+    Num_Startup_Phases = 0;
+    Phase_Start_Clock = clock();
+    Phase_Start_Mem = 0;
+    Phase_Start_Allocs = 0;
+
     // Globals
     PG_Boot_Phase = BOOT_START;
     PG_Boot_Level = BOOT_LEVEL_FULL;
@@ -1211,6 +1382,20 @@ void Startup_Core(void)
     Startup_Pools(0);
     Startup_GC();
 
+  #if defined(NDEBUG)
+    //
+    // Nearly everything boot allocates (lib, sys, the mezzanine contexts)
+    // survives to the end of boot, so collecting along the way only walks
+    // the same live graph over and over.  Release builds raise the ballast
+    // out of reach until boot is done, trading a somewhat higher peak for
+    // faster startup--which dominates the cost of short-lived scripts.
+    // Debug builds keep the normal ballast so boot exercises the GC.
+    //
+    GC_Ballast = MEM_BALLAST_MAX;
+  #endif
+
+    Note_Startup_Phase("pools");
+
 //=//// INITIALIZE API ////////////////////////////////////////////////////=//
 
     // The API is one means by which variables can be made whose lifetime is
@@ -1248,6 +1433,8 @@ void Startup_Core(void)
 
     Init_Action_Spec_Tags(); // Note: uses MOLD_BUF, not available until here
 
+    Note_Startup_Phase("runtime");
+
 //=//// LOAD BOOT BLOCK ///////////////////////////////////////////////////=//
 
     // The %make-boot.r process takes all the various definitions and
@@ -1266,6 +1453,7 @@ void Startup_Core(void)
         max,
         envelope
     ));
+    Note_Startup_Phase("decompress");
 
     REBARR *boot_array = Scan_UTF8_Managed(
         Intern("tmp-boot.r"),
@@ -1275,10 +1463,12 @@ void Startup_Core(void)
     PUSH_GC_GUARD(boot_array); // managed, so must be guarded
 
     rebFree(utf8); // don't need decompressed text after it's scanned
+    Note_Startup_Phase("scan");
 
     BOOT_BLK *boot = cast(BOOT_BLK*, VAL_ARRAY_HEAD(ARR_HEAD(boot_array)));
 
     Startup_Symbols(VAL_ARRAY(&boot->words));
+    Note_Startup_Phase("symbols");
 
     // STR_SYMBOL(), VAL_WORD_SYM() and Canon(SYM_XXX) now available
 
@@ -1314,6 +1504,7 @@ void Startup_Core(void)
 
     Startup_True_And_False();
     Add_Lib_Keys_For_Unscannable_Set_Words();
+    Note_Startup_Phase("datatypes");
 
 //=//// RUN CODE BEFORE ERROR HANDLING INITIALIZED ////////////////////////=//
 
@@ -1330,12 +1521,14 @@ void Startup_Core(void)
     REBARR *natives_catalog = Startup_Natives(KNOWN(&boot->natives));
     Manage_Array(natives_catalog);
     PUSH_GC_GUARD(natives_catalog);
+    Note_Startup_Phase("natives");
 
     // boot->generics is the list in %generics.r
     //
     REBARR *generics_catalog = Startup_Generics(KNOWN(&boot->generics));
     Manage_Array(generics_catalog);
     PUSH_GC_GUARD(generics_catalog);
+    Note_Startup_Phase("generics");
 
     // boot->errors is the error definition list from %errors.r
     //
@@ -1356,6 +1549,7 @@ void Startup_Core(void)
     DROP_GC_GUARD(datatypes_catalog);
 
     Init_Contexts_Object();
+    Note_Startup_Phase("system");
 
     PG_Boot_Phase = BOOT_ERRORS;
 
@@ -1409,7 +1603,18 @@ void Startup_Core(void)
     Check_Memory_Debug(); // old R3-Alpha check, call here to keep it working
   #endif
 
-    Recycle(); // necessary?
+  #if defined(NDEBUG)
+    //
+    // Don't pay for a full collection here: what boot leaves behind is
+    // mostly live, and the transient garbage will be picked up by the first
+    // recycle the ballast triggers normally.
+    //
+    GC_Ballast = MEM_BALLAST;
+  #else
+    Recycle();
+  #endif
+
+    Note_Startup_Phase("finish");
 }
 
 
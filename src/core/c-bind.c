@@ -257,6 +257,23 @@ static void Clonify_And_Bind_Relative(
     //
     assert(not (deep_types & FLAGIT_KIND(REB_ACTION)));
 
+    // Most cells of a body are neither copied nor bound (numbers, strings
+    // that aren't copied, etc.)  Handle the unquoted ones without dequoting
+    // and requoting.
+    //
+    REBYTE kind_byte = KIND_BYTE_UNCHECKED(v);
+    if (
+        kind_byte < REB_64
+        and kind_byte != REB_QUOTED
+        and not (deep_types & FLAGIT_KIND(kind_byte) & TS_SERIES_OBJ)
+        and not (bind_types & FLAGIT_KIND(kind_byte))
+        and not ANY_ARRAY_OR_PATH_KIND(cast(enum Reb_Kind, kind_byte))
+    ){
+        if (NOT_CELL_FLAG(v, EXPLICITLY_MUTABLE))
+            v->header.bits |= (flags & ARRAY_FLAG_CONST_SHALLOW);
+        return;
+    }
+
     // !!! It may be possible to do this faster/better, the impacts on higher
     // quoting levels could be incurring more cost than necessary...but for
     // now err on the side of correctness.  Unescape the value while cloning
@@ -283,6 +300,49 @@ static void Clonify_And_Bind_Relative(
             sub_src = BLANK_VALUE;  // don't try to look for LETs
         }
         else {
+            if (
+                IS_SER_ARRAY(VAL_SERIES(v))
+                and (deep_types & FLAGIT_KIND(kind) & TS_ARRAYS_OBJ)
+            ){
+                // Copy and clonify the cells in one pass, instead of making
+                // a shallow copy and then walking it again.  LETs are looked
+                // for in the original cells.
+                //
+                REBARR *original = VAL_ARRAY(v);
+                REBSPC *specifier = VAL_SPECIFIER(v);
+                REBLEN len = ARR_LEN(original);
+                REBARR *copy = Make_Array_For_Copy(
+                    len,
+                    NODE_FLAG_MANAGED,
+                    original
+                );
+
+                const RELVAL *sub_src = ARR_HEAD(original);
+                RELVAL *dest = ARR_HEAD(copy);
+                REBLEN n;
+                for (n = 0; n < len; ++n, ++sub_src, ++dest) {
+                    Derelativize(dest, sub_src, specifier);
+                    Clonify_And_Bind_Relative(
+                        KNOWN(dest),
+                        sub_src,
+                        flags,
+                        deep_types,
+                        binder,
+                        paramlist,
+                        bind_types,
+                        param_num
+                    );
+                }
+
+                TERM_ARRAY_LEN(copy, len);
+
+                INIT_VAL_NODE(v, copy);
+                INIT_BINDING(v, paramlist);  // relative, see below
+
+                Quotify_Core(v, num_quotes);
+                return;
+            }
+
             if (IS_SER_ARRAY(VAL_SERIES(v))) {
                 series = SER(
                     Copy_Array_At_Extra_Shallow(
@@ -553,6 +613,92 @@ void Rebind_Values_Deep(
 }
 
 
+// Tells if any word in the array (or arrays and paths nested in it) has the
+// spelling of one of the loop variables, so binding would change it.  Vars
+// that aren't WORD! (LIT-WORD!s reusing a binding, BLANK!s) don't count.
+//
+static bool Mentions_Loop_Var_Deep(
+    const RELVAL *head,
+    const RELVAL *vars,
+    REBLEN num_vars
+){
+    if (C_STACK_OVERFLOWING(&num_vars))
+        Fail_Stack_Overflow();
+
+    for (; NOT_END(head); ++head) {
+        const REBCEL *cell = VAL_UNESCAPED(head);
+        enum Reb_Kind kind = CELL_KIND(cell);
+
+        if (ANY_WORD_KIND(kind)) {
+            REBSTR *canon = VAL_WORD_CANON(cell);
+            const RELVAL *var = vars;
+            REBLEN n;
+            for (n = 0; n < num_vars; ++n, ++var) {
+                if (IS_WORD(var) and VAL_WORD_CANON(var) == canon)
+                    return true;
+            }
+        }
+        else if (ANY_ARRAY_OR_PATH_KIND(kind)) {
+            if (Mentions_Loop_Var_Deep(ARR_HEAD(VAL_ARRAY(cell)), vars, num_vars))
+                return true;
+        }
+    }
+    return false;
+}
+
+
+// Copy a loop body for binding, but only copy the nested arrays and paths
+// which mention a loop variable.  The rest are left shared with the source,
+// since binding won't touch them.  A `for-each` over a large body with few
+// uses of its variables then allocates far less on each invocation.
+//
+static REBARR *Copy_Loop_Body_Managed(
+    REBARR *original,
+    REBLEN index,
+    REBSPC *specifier,
+    REBFLGS flags,
+    const RELVAL *vars,
+    REBLEN num_vars
+){
+    REBARR *copy = Copy_Array_At_Extra_Shallow(
+        original,
+        index,
+        specifier,
+        0,  // extra
+        flags | NODE_FLAG_MANAGED
+    );
+
+    RELVAL *item = ARR_HEAD(copy);
+    for (; NOT_END(item); ++item) {  // Derelativized, so copy is specific
+        if (not ANY_ARRAY_OR_PATH_KIND(CELL_KIND(VAL_UNESCAPED(item))))
+            continue;
+
+        if (not Mentions_Loop_Var_Deep(
+            ARR_HEAD(VAL_ARRAY(VAL_UNESCAPED(item))), vars, num_vars
+        )){
+            continue;  // leave it shared, it won't be changed by binding
+        }
+
+        REBLEN num_quotes = Dequotify(item);  // must ensure new cell
+        INIT_VAL_NODE(
+            item,
+            Copy_Loop_Body_Managed(
+                VAL_ARRAY(item),
+                0,  // like Clonify(), whole array (VAL_INDEX() is kept)
+                VAL_SPECIFIER(KNOWN(item)),
+                NODE_FLAG_MANAGED,
+                vars,
+                num_vars
+            )
+        );
+        INIT_BINDING(item, UNBOUND);  // copy with specifier is not relative
+        Quotify(item, num_quotes);
+    }
+
+    return copy;
+}
+
+
 //
 //  Virtual_Bind_Deep_To_New_Context: C
 //
@@ -651,10 +797,24 @@ void Virtual_Bind_Deep_To_New_Context(
         // the same, because it's truncated before the index.  You cannot
         // go BACK on it before the index.
         //
+        // A CONST body can't be mutated through the loop (e.g. a literal
+        // block appended to each time), so parts binding doesn't change can
+        // be shared with the original.  Otherwise, every invocation of the
+        // loop needs its own copy of everything.
+        //
         bool in_const = GET_CELL_FLAG(body_in_out, CONST);
-        Init_Block(
-            body_in_out,
-            Copy_Array_Core_Managed(
+        REBARR *copy;
+        if (in_const)
+            copy = Copy_Loop_Body_Managed(
+                VAL_ARRAY(body_in_out),
+                VAL_INDEX(body_in_out), // at
+                VAL_SPECIFIER(body_in_out),
+                ARRAY_MASK_HAS_FILE_LINE, // flags
+                IS_BLOCK(spec) ? VAL_ARRAY_AT(spec) : spec,
+                num_vars
+            );
+        else
+            copy = Copy_Array_Core_Managed(
                 VAL_ARRAY(body_in_out),
                 VAL_INDEX(body_in_out), // at
                 VAL_SPECIFIER(body_in_out),
@@ -662,8 +822,8 @@ void Virtual_Bind_Deep_To_New_Context(
                 0, // extra
                 ARRAY_MASK_HAS_FILE_LINE, // flags
                 TS_ARRAY | TS_PATH // types to copy deeply
-            )
-        );
+            );
+        Init_Block(body_in_out, copy);
 
         if (in_const)  // preserve CONST-ness of the original body
             Constify(body_in_out);
@@ -156,6 +156,12 @@ bool Expand_Context_Keylist_Core(REBCTX *context, REBLEN delta)
         Manage_Array(copy);
         INIT_CTX_KEYLIST_UNIQUE(context, copy);
 
+        // The copy is a new keylist identity, so derived lookups through
+        // this context would just miss in the override cache.  But clear
+        // it anyway, so no path relies on that subtlety.
+        //
+        Invalidate_Override_Cache();
+
         return true;
     }
 
@@ -369,8 +375,10 @@ REBARR *Grab_Collected_Array_Managed(
 //
 //  Collect_End: C
 //
-// Reset the bind markers in the canon series nodes so they can be reused,
-// and empty the BUF_COLLECT.
+// Remove the collected words from the collector's binder, and empty the
+// BUF_COLLECT.  A null collector is passed when an error interrupted the
+// collection, and then only BUF_COLLECT is emptied (the binder's state is
+// on the C stack, with any table series freed by the trap).
 //
 void Collect_End(struct Reb_Collector *cl)
 {
@@ -380,33 +388,17 @@ void Collect_End(struct Reb_Collector *cl)
 
     // Reset binding table (note BUF_COLLECT may have expanded)
     //
-    RELVAL *v =
-        (cl == NULL or (cl->flags & COLLECT_AS_TYPESET))
+    if (cl != NULL) {
+        RELVAL *v = (cl->flags & COLLECT_AS_TYPESET)
             ? ARR_HEAD(BUF_COLLECT) + 1
             : ARR_HEAD(BUF_COLLECT);
-    for (; NOT_END(v); ++v) {
-        REBSTR *canon =
-            (cl == NULL or (cl->flags & COLLECT_AS_TYPESET))
+        for (; NOT_END(v); ++v) {
+            REBSTR *canon = (cl->flags & COLLECT_AS_TYPESET)
                 ? VAL_KEY_CANON(v)
                 : VAL_WORD_CANON(v);
 
-        if (cl != NULL) {
             Remove_Binder_Index(&cl->binder, canon);
-            continue;
         }
-
-        // !!! This doesn't have a "binder" available to clear out the
-        // keys with.  The nature of handling error states means that if
-        // a thread-safe binding system was implemented, we'd have to know
-        // which thread had the error to roll back any binding structures.
-        // For now just zero it out based on the collect buffer.
-        //
-        assert(
-            MISC(canon).bind_index.high != 0
-            or MISC(canon).bind_index.low != 0
-        );
-        MISC(canon).bind_index.high = 0;
-        MISC(canon).bind_index.low = 0;
     }
 
     SET_ARRAY_LEN_NOTERM(BUF_COLLECT, 0);
@@ -758,6 +750,126 @@ void Rebind_Context_Deep(
 }
 
 
+// If every top-level SET-WORD! in the body is already bound to an object
+// made with the parent's keylist (as happens after the first time a body is
+// used with `make proto [...]`), the derived object can't get any new keys.
+// Then the keylist collection can be skipped.  Returns the SELF index in the
+// parent, or 0 if the keys have to be collected.
+//
+static REBLEN Self_Index_If_Shared_Keylist(
+    const RELVAL *head,
+    REBCTX *parent
+){
+    REBNOD *keylist = LINK_KEYSOURCE(parent);
+    if (keylist->header.bits & NODE_FLAG_CELL)
+        return 0;  // parent is a running frame
+
+    for (; NOT_END(head); ++head) {
+        REBYTE kind_byte = KIND_BYTE(head);
+        if (kind_byte >= REB_64 or kind_byte == REB_QUOTED)
+            return 0;  // collection looks at quoted SET-WORD!s too
+        if (kind_byte != REB_SET_WORD)
+            continue;
+
+        REBNOD *binding = VAL_BINDING(head);
+        if (
+            binding == UNBOUND
+            or (binding->header.bits & NODE_FLAG_CELL)
+            or not (binding->header.bits & ARRAY_FLAG_IS_VARLIST)
+            or LINK_KEYSOURCE(binding) != keylist
+        ){
+            return 0;
+        }
+    }
+
+    return Find_Canon_In_Context(parent, Canon(SYM_SELF), true);
+}
+
+
+//
+//  Make_Derived_Context_Shared_Managed: C
+//
+// Make an object derived from `parent` which has the same keys, so it can
+// share the parent's keylist.  The parent's variables are copied as a block
+// of cells, and only the values that can hold references to the parent
+// (series that get cloned, words and actions) are visited again to rebind.
+//
+REBCTX *Make_Derived_Context_Shared_Managed(
+    enum Reb_Kind kind,
+    REBCTX *parent,
+    REBLEN self_index
+){
+    REBARR *keylist = CTX_KEYLIST(parent);
+    REBLEN len = ARR_LEN(keylist);
+    assert(len == ARR_LEN(CTX_VARLIST(parent)));
+
+    REBARR *varlist = Make_Array_Core(
+        len,
+        SERIES_MASK_VARLIST
+            | NODE_FLAG_MANAGED // Note: Rebind below requires managed context
+    );
+    memcpy(  // all cells in varlists, so their formatting bits are the same
+        ARR_HEAD(varlist),
+        ARR_HEAD(CTX_VARLIST(parent)),
+        len * sizeof(RELVAL)
+    );
+    TERM_ARRAY_LEN(varlist, len);
+    MISC_META_NODE(varlist) = nullptr;  // clear meta object (GC sees this)
+
+    REBCTX *context = CTX(varlist);
+    INIT_CTX_KEYLIST_SHARED(context, keylist);
+    ++TG_Shared_Keylists;
+
+    REBVAL *var = RESET_CELL(
+        ARR_HEAD(varlist),
+        kind,
+        CELL_MASK_CONTEXT
+    );
+    INIT_VAL_CONTEXT_VARLIST(var, varlist);
+    INIT_VAL_CONTEXT_PHASE(var, nullptr);
+    INIT_BINDING(var, UNBOUND);
+
+    // Drop the bits Move_Value() wouldn't have copied, then clone the series
+    // as Make_Selfish_Context_Detect_Managed() does.
+    //
+    bool rebind = false;
+    for (++var; NOT_END(var); ++var) {
+        var->header.bits &= ~(
+            NODE_FLAG_MARKED | CELL_FLAG_PROTECTED | CELL_FLAG_UNEVALUATED
+        );
+
+        REBYTE kind_byte = KIND_BYTE(var);
+        if (kind_byte >= REB_64 or kind_byte == REB_QUOTED) {
+            Clonify(var, NODE_FLAG_MANAGED, TS_CLONE);
+            continue;  // Rebind_Values_Deep() doesn't look in quoteds
+        }
+        if (
+            ANY_ARRAY_OR_PATH_KIND(kind_byte)
+            or ANY_WORD_KIND(kind_byte)
+            or kind_byte == REB_ACTION
+        ){
+            rebind = true;
+        }
+        if (TS_CLONE & FLAGIT_KIND(kind_byte))
+            Clonify(var, NODE_FLAG_MANAGED, TS_CLONE);
+    }
+
+    assert(CTX_KEY_SYM(context, self_index) == SYM_SELF);
+    Move_Value(CTX_VAR(context, self_index), CTX_ARCHETYPE(context));
+
+    if (rebind)
+        Rebind_Context_Deep(parent, context, NULL);  // NULL=no more binds
+
+    ASSERT_CONTEXT(context);
+
+#if !defined(NDEBUG)
+    PG_Reb_Stats->Objects++;
+#endif
+
+    return context;
+}
+
+
 //
 //  Make_Selfish_Context_Detect_Managed: C
 //
@@ -785,6 +897,16 @@ REBCTX *Make_Selfish_Context_Detect_Managed(
     const RELVAL *head,
     REBCTX *opt_parent
 ) {
+    if (opt_parent) {
+        REBLEN self_index = Self_Index_If_Shared_Keylist(head, opt_parent);
+        if (self_index != 0)
+            return Make_Derived_Context_Shared_Managed(
+                kind,
+                opt_parent,
+                self_index
+            );
+    }
+
     REBLEN self_index;
     REBARR *keylist = Collect_Keylist_Managed(
         &self_index,
@@ -816,6 +938,7 @@ REBCTX *Make_Selfish_Context_Detect_Managed(
     else {
         if (keylist == CTX_KEYLIST(opt_parent)) {
             INIT_CTX_KEYLIST_SHARED(context, keylist);
+            ++TG_Shared_Keylists;
 
             // We leave the ancestor link as-is in the shared keylist--so
             // whatever the parent had...if we didn't have to make a new
@@ -1291,6 +1414,131 @@ void Resolve_Context(
 }
 
 
+// Keylists of contexts with at least this many keys get a hash of their keys
+// the first time a key is looked up by canon.
+//
+#define MIN_HASHED_KEYLIST_LEN 32
+
+// The hash of a keylist is a managed series of REBLENs in the keylist's
+// MISC(), which is flagged to be marked.  It's shared by every context that
+// shares the keylist.  The first cell counts the keys that have been hashed
+// (keys appended since are hashed on the next lookup), the second is the
+// slot mask, and then come the slots holding key indices (0 is empty).
+// Keys are hashed by the symbol hash of their spelling, which synonyms share
+// (the canon pointer itself can change if a canon is GC'd).
+//
+static void Hash_Keylist_Keys(REBSER *hash, REBARR *keylist, REBLEN from)
+{
+    REBLEN *head = SER_HEAD(REBLEN, hash);
+    REBLEN mask = head[1];
+    REBLEN *slots = head + 2;
+
+    REBLEN len = ARR_LEN(keylist) - 1;
+    REBLEN n;
+    for (n = from; n <= len; ++n) {
+        REBSTR *spelling = VAL_KEY_SPELLING(ARR_AT(keylist, n));
+        REBLEN slot = STR_SYMBOL_HASH(spelling) & mask;
+        while (slots[slot] != 0)
+            slot = (slot + 1) & mask;
+        slots[slot] = n;
+    }
+    head[0] = len;
+}
+
+static REBSER *Make_Keylist_Hash(REBARR *keylist)
+{
+    REBLEN len = ARR_LEN(keylist) - 1;
+    REBLEN num_slots = 64;
+    while (num_slots < len * 4)  // room to grow before the next rebuild
+        num_slots *= 2;
+
+    REBSER *hash = Make_Series_Core(
+        num_slots + 2,
+        sizeof(REBLEN),
+        NODE_FLAG_MANAGED
+    );
+    memset(SER_HEAD(REBLEN, hash), 0, (num_slots + 2) * sizeof(REBLEN));
+    SER_HEAD(REBLEN, hash)[1] = num_slots - 1;
+    Hash_Keylist_Keys(hash, keylist, 1);
+
+    Note_Series_Mutation(SER(keylist));  // may be older than the hash
+    MISC(keylist).custom.node = NOD(hash);
+    SET_SERIES_FLAG(keylist, MISC_NODE_NEEDS_MARK);
+    return hash;
+}
+
+// Returns the hash of the keylist (made or updated as needed), or nullptr
+// if the keylist is too short to bother, or can't carry a hash.  Paramlists
+// use their MISC() for the meta, and unmanaged keylists wouldn't keep the
+// managed hash alive.
+//
+static REBSER *Get_Keylist_Hash(REBARR *keylist)
+{
+    REBLEN len = ARR_LEN(keylist) - 1;
+    if (
+        len < MIN_HASHED_KEYLIST_LEN
+        or GET_ARRAY_FLAG(keylist, IS_PARAMLIST)
+        or GET_ARRAY_FLAG(keylist, HAS_FILE_LINE_UNMASKED)
+        or NOT_SERIES_FLAG(keylist, MANAGED)
+    ){
+        return nullptr;
+    }
+
+    if (NOT_SERIES_FLAG(keylist, MISC_NODE_NEEDS_MARK))
+        return Make_Keylist_Hash(keylist);
+
+    REBSER *hash = SER(MISC(keylist).custom.node);
+    REBLEN *head = SER_HEAD(REBLEN, hash);
+    if (head[0] == len)
+        return hash;
+
+    if (head[0] > len or len * 2 > head[1] + 1)  // shrunk, or half full
+        return Make_Keylist_Hash(keylist);
+
+    Hash_Keylist_Keys(hash, keylist, head[0] + 1);
+    return hash;
+}
+
+
+//
+//  Find_Canon_In_Keylist: C
+//
+// Uncached part of Find_Canon_In_Context(), which leaves the unbindable
+// check to the caller.
+//
+static REBLEN Find_Canon_In_Keylist(REBCTX *context, REBSTR *canon, REBLEN len)
+{
+    REBSER *hash = Get_Keylist_Hash(CTX_KEYLIST(context));
+    if (hash) {
+        REBLEN *head = SER_HEAD(REBLEN, hash);
+        REBLEN mask = head[1];
+        REBLEN *slots = head + 2;
+
+        REBLEN slot = STR_SYMBOL_HASH(canon) & mask;
+        for (; slots[slot] != 0; slot = (slot + 1) & mask) {
+            REBLEN n = slots[slot];
+            if (n > len)
+                continue;  // keylist is ahead of the varlist during appends
+
+            if (canon == VAL_KEY_CANON(CTX_KEY(context, n)))
+                return n;
+        }
+        return 0;
+    }
+
+    REBVAL *key = CTX_KEYS_HEAD(context);
+
+    REBLEN n;
+    for (n = 1; n <= len; n++, key++) {
+        if (canon == VAL_KEY_CANON(key))
+            return n;
+    }
+
+    // !!! Should this be changed to NOT_FOUND?
+    return 0;
+}
+
+
 //
 //  Find_Canon_In_Context: C
 //
@@ -1301,22 +1549,37 @@ REBLEN Find_Canon_In_Context(REBCTX *context, REBSTR *canon, bool always)
 {
     assert(GET_SERIES_INFO(canon, STRING_CANON));
 
-    REBVAL *key = CTX_KEYS_HEAD(context);
     REBLEN len = CTX_LEN(context);
+    REBARR *keylist = CTX_KEYLIST(context);
+
+    uintptr_t h = (
+        cast(uintptr_t, keylist) ^ (cast(uintptr_t, canon) >> 3)
+    ) >> 4;
+    REB_FIELD_ENTRY *entry = &TG_Field_Cache[h & (FIELD_CACHE_SIZE - 1)];
 
     REBLEN n;
-    for (n = 1; n <= len; n++, key++) {
-        if (canon == VAL_KEY_CANON(key)) {
-            if (Is_Param_Unbindable(key)) {
-                if (not always)
-                    return 0;
-            }
-            return n;
-        }
+    if (
+        entry->keylist == keylist
+        and entry->canon == canon
+        and entry->index <= len
+        and canon == VAL_KEY_CANON(CTX_KEY(context, entry->index))
+    ){
+        n = entry->index;
     }
+    else {
+        n = Find_Canon_In_Keylist(context, canon, len);
+        if (n == 0)
+            return 0;
 
-    // !!! Should this be changed to NOT_FOUND?
-    return 0;
+        entry->keylist = keylist;
+        entry->canon = canon;
+        entry->index = n;
+    }
+
+    if (Is_Param_Unbindable(CTX_KEY(context, n)) and not always)
+        return 0;
+
+    return n;
 }
 
 
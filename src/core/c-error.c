@@ -48,6 +48,8 @@ void Snap_State_Core(struct Reb_State *s)
     s->frame = FS_TOP;
 
     s->manuals_len = SER_LEN(GC_Manuals);
+    s->api_scoped_len = SER_USED(TG_Api_Scoped);
+    s->api_scope_depth = TG_Api_Scope_Depth;
     s->mold_buf_len = STR_LEN(STR(MOLD_BUF));
     s->mold_buf_size = STR_SIZE(STR(MOLD_BUF));
     s->mold_loop_tail = ARR_LEN(TG_Mold_Stack);
@@ -160,12 +162,11 @@ void Trapped_Helper(struct Reb_State *s)
     DS_DROP_TO(s->dsp);
 
     // If we were in the middle of a Collect_Keys and an error occurs, then
-    // the binding lookup table has entries in it that need to be zeroed out.
-    // We can tell if that's necessary by whether there is anything
-    // accumulated in the collect buffer.
+    // the collect buffer needs to be emptied.  (The collector's binder is
+    // on the C stack, and a table series it grew is freed below.)
     //
     if (ARR_LEN(BUF_COLLECT) != 0)
-        Collect_End(NULL); // !!! No binder, review implications
+        Collect_End(NULL);
 
     // Free any manual series that were extant at the time of the error
     // (that were created since this PUSH_TRAP started).  This includes
@@ -181,6 +182,13 @@ void Trapped_Helper(struct Reb_State *s)
     }
 
     SET_SERIES_LEN(GC_Guarded, s->guarded_len);
+
+    // Scopes pushed since the trap are abandoned.  Their handles belong to
+    // the failed frames, and are freed with them (see Mark_Root_Series()).
+    //
+    SET_SERIES_USED(TG_Api_Scoped, s->api_scoped_len);
+    TG_Api_Scope_Depth = s->api_scope_depth;
+
     TG_Top_Frame = s->frame;
     TERM_STR_LEN_SIZE(STR(MOLD_BUF), s->mold_buf_len, s->mold_buf_size);
 
@@ -241,7 +249,7 @@ ATTRIBUTE_NO_RETURN void Fail_Core(const void *p)
 
   #ifdef DEBUG_HAS_PROBE
     if (PG_Probe_Failures) {  // see R3_PROBE_FAILURES environment variable
-        static bool probing = false;
+        static REB_INSTANCE_VAR bool probing = false;
 
         if (p == cast(void*, VAL_CONTEXT(Root_Stackoverflow_Error))) {
             printf("PROBE(Stack Overflow): mold in PROBE would recurse\n");
@@ -353,7 +361,45 @@ ATTRIBUTE_NO_RETURN void Fail_Core(const void *p)
     SET_END(&TG_Thrown_Arg);
   #endif
 
+  #if defined(REBOL_FAIL_USES_EXCEPTIONS)
+    throw Saved_State;  // caught by the `try` in rebRescue()/rebRescueWith()
+  #else
     LONG_JUMP(Saved_State->cpu_state, 1);
+  #endif
+}
+
+
+//
+//  Raise_Error_Core: C
+//
+// The "definitional" alternative to fail(), for natives (see RAISE()).  The
+// error is thrown with the RAISE native as the label, so it unwinds through
+// the frames by ordinary return like any other throw.  TRAP and ENTRAP catch
+// it, CATCH/ANY lets it pass, and anything else that gets a throw it can't
+// handle turns it back into the same error with Error_No_Catch_For_Throw()...
+// so it behaves as if it had been raised by fail().
+//
+REB_R Raise_Error_Core(REBFRM *f, REBCTX *error)
+{
+    ASSERT_CONTEXT(error);
+    assert(CTX_TYPE(error) == REB_ERROR);
+
+    ERROR_VARS *vars = ERR_VARS(error);
+    if (IS_NULLED_OR_BLANK(&vars->where))
+        Set_Location_Of_Error(error, f);
+
+    DECLARE_LOCAL (arg);
+    Init_Error(arg, error);
+    return Init_Thrown_With_Label(f->out, arg, NAT_VALUE(raise));
+}
+
+
+//
+//  Is_Raised_Error_Label: C
+//
+bool Is_Raised_Error_Label(const REBVAL *label)
+{
+    return IS_ACTION(label) and VAL_ACT_DISPATCHER(label) == &N_raise;
 }
 
 
@@ -1192,6 +1238,9 @@ REBCTX *Error_No_Catch_For_Throw(REBVAL *thrown)
     DECLARE_LOCAL (arg);
     CATCH_THROWN(arg, thrown);
 
+    if (Is_Raised_Error_Label(label))  // no TRAP caught it, so fail() it
+        return VAL_CONTEXT(arg);
+
     return Error_No_Catch_Raw(arg, label);
 }
 
@@ -62,6 +62,17 @@
 //   See `Reb_Feed` for the code that provides this abstraction over Rebol
 //   arrays as well as C va_list.
 //
+// * !!! Nested evaluations (GROUP!s, argument gathering, natives like IF
+//   running a branch) recurse on the C stack, and fail() longjmps to the
+//   nearest PUSH_TRAP().  So a computation can only be suspended if its
+//   whole C stack is, which is why generators and coroutines aren't cheap.
+//   A stackless design would have each such point push its subframe and
+//   return to a trampoline, with the frame saying where to resume; natives
+//   would need the same treatment (returning "continue with this frame"
+//   instead of calling the evaluator).  The REBFRM state is mostly there
+//   already--what's missing is resumption points and natives that don't
+//   hold C locals across an evaluation.
+//
 
 #include "sys-core.h"
 
@@ -132,6 +143,17 @@ REB_R Dispatch_Internal(REBFRM * const f)
     (f->special != f->param and f->special != f->arg)
 
 
+// Parameter typesets fold the <blank>, <const>, <dequote> and refinement
+// behaviors in as pseudotype bits.  A parameter with none of them set needs
+// nothing but the typecheck, which would otherwise have to wait on four
+// separate tests of its typeset.
+//
+#define TS_FINALIZE_SPECIAL \
+    (FLAGIT_KIND(REB_TS_NOOP_IF_BLANK) | FLAGIT_KIND(REB_TS_CONST) \
+        | FLAGIT_KIND(REB_TS_DEQUOTE_REQUOTE) \
+        | FLAGIT_KIND(REB_TS_REFINEMENT))
+
+
 // It's called "Finalize" because in addition to checking, any other handling
 // that an argument needs once being put into a frame is handled.  VARARGS!,
 // for instance, that may come from an APPLY need to have their linkage
@@ -158,6 +180,9 @@ inline static void Finalize_Arg(REBFRM *f) {
     assert(NOT_CELL_FLAG(f->arg, ARG_MARKED_CHECKED));
   #endif
 
+    if (not TYPE_CHECK_BITS(f->param, TS_FINALIZE_SPECIAL))
+        goto typecheck;  // the overwhelmingly common case
+
     if (
         kind_byte == REB_BLANK
         and TYPE_CHECK(f->param, REB_TS_NOOP_IF_BLANK) // e.g. <blank> param
@@ -212,6 +237,8 @@ inline static void Finalize_Arg(REBFRM *f) {
         return;
     }
 
+  typecheck:
+
     if (not Typecheck_Including_Quoteds(f->param, f->arg)) {
         fail (Error_Arg_Type(f, f->param, VAL_TYPE(f->arg)));
     }
@@ -220,6 +247,66 @@ inline static void Finalize_Arg(REBFRM *f) {
 }
 
 
+// A call is a "self tail call" if it is the last thing in an interpreted
+// action's body, and calls that same action (e.g. `f: func [n] [... f n]`).
+// Then there is no need to run it in a new level of C recursion.  Its args
+// can be moved into the running frame, which restarts as if by REDO.
+//
+// That must not be observable, so the running frame's varlist can't be
+// managed.  Once it is, something may hold a reference (a FRAME!, a block
+// bound to it like `f [n] n - 1` passes, or a closure's body) that would see
+// the new args.  Branches written as blocks in the body manage it, so this
+// mostly helps bodies which end with a check such as `if n = 0 done`.
+//
+// The frames reused this way don't show up in backtraces (e.g. the WHERE of
+// an error), so TAIL-CALLS can turn it off for debugging.
+//
+inline static bool Is_Self_Tail_Call(REBFRM *f) {
+    if (not TG_Tail_Calls)
+        return false;
+
+    if (NOT_END(f->feed->value) or FRM_IS_VALIST(f))
+        return false;  // body not finished, or not a body at all
+
+    if (f->flags.bits & (
+        EVAL_FLAG_RUNNING_ENFIX | EVAL_FLAG_FULFILLING_ARG
+    )){
+        return false;
+    }
+    if (f->requotes != 0 or DSP != f->dsp_orig)
+        return false;
+
+    REBFRM *caller = f->prior;
+    if (not Is_Action_Frame(caller) or Is_Action_Frame_Fulfilling(caller))
+        return false;
+    if (GET_SERIES_FLAG(caller->varlist, MANAGED))
+        return false;  // something may refer to the frame, see above
+
+    REBACT *phase = FRM_PHASE(f);
+    if (FRM_PHASE(caller) != phase or FRM_BINDING(caller) != FRM_BINDING(f))
+        return false;
+
+    REBNAT dispatcher = ACT_DISPATCHER(phase);
+    if (
+        dispatcher != &Unchecked_Dispatcher
+        and dispatcher != &Returner_Dispatcher
+        and dispatcher != &Voider_Dispatcher
+    ){
+        return false;  // e.g. the phase is an ADAPT or ENCLOSE, not a body
+    }
+    if (f->feed->array != VAL_ARRAY(ARR_HEAD(ACT_DETAILS(phase))))
+        return false;  // e.g. a function body running DO of another block
+
+    REBVAL *param = ACT_PARAMS_HEAD(phase);
+    for (; NOT_END(param); ++param) {
+        if (Is_Param_Variadic(param))
+            return false;  // VARARGS! would point to the frame being dropped
+    }
+
+    return true;
+}
+
+
 // While "checking" the variadic argument we actually re-stamp it with
 // this parameter and frame's signature.  It reuses whatever the original
 // data feed was (this frame, another frame, or just an array from MAKE
@@ -554,6 +641,9 @@ bool Eval_Internal_Maybe_Stale_Throws(REBFRM * const f)
     if (kind.byte == REB_0_END)
         goto finished;
 
+    if (TG_Step_Hooks and Step_Hooks_Throws(f))  // HOTSPOTS or breakpoints
+        goto return_thrown;
+
     gotten = *next_gotten;
     v = Lookback_While_Fetching_Next(f);
     // ^-- can't just `v = *next`, fetch may overwrite--request lookback!
@@ -1559,6 +1649,24 @@ bool Eval_Internal_Maybe_Stale_Throws(REBFRM * const f)
 
         *next_gotten = nullptr; // arbitrary code changes fetched variables
 
+        if (Is_Self_Tail_Call(f)) {
+            //
+            // Give the args to the calling frame, then throw a REDO with no
+            // binding to it--it is the next action frame up, and catches it
+            // below as a restart.  That unwinds this frame's C recursion.
+            //
+            REBVAL *dest = FRM_ARGS_HEAD(f->prior);
+            f->arg = FRM_ARGS_HEAD(f);
+            for (; NOT_END(f->arg); ++f->arg, ++dest)
+                Move_Value(dest, f->arg);
+
+            Init_Action_Maybe_Bound(spare, FRM_PHASE(f), FRM_BINDING(f));
+            Move_Value(f->out, NAT_VALUE(redo));
+            assert(VAL_BINDING(f->out) == UNBOUND);
+            Init_Thrown_With_Label(f->out, spare, f->out);
+            goto abort_action;
+        }
+
         // Note that the dispatcher may push ACTION! values to the data stack
         // which are used to process the return result after the switch.
         //
@@ -1659,6 +1767,19 @@ bool Eval_Internal_Maybe_Stale_Throws(REBFRM * const f)
                     FRM_BINDING(f) = VAL_BINDING(f->out);
                     goto redo_checked;
                 }
+                else if (
+                    VAL_ACTION(label) == NAT_ACTION(redo)
+                    and VAL_BINDING(label) == UNBOUND
+                ){
+                    // A self tail call from the body this frame is running
+                    // (see Is_Self_Tail_Call()), which already put the args
+                    // in this frame.  Typecheck them and run again.
+                    //
+                    CATCH_THROWN(f->out, f->out);
+                    assert(IS_ACTION(f->out));
+                    assert(VAL_ACTION(f->out) == FRM_PHASE(f));
+                    goto redo_checked;
+                }
             }
 
             // Stay THROWN and let stack levels above try and catch
@@ -24,6 +24,8 @@
 
 #include "sys-core.h"
 
+#include "sys-int-funcs.h"
+
 
 struct Params_Of_State {
     REBARR *arr;
@@ -244,6 +246,10 @@ void Push_Paramlist_Triads_May_Fail(
                 item = Get_System(SYS_STANDARD, STD_PROC_RETURN_TYPE);
                 goto process_typeset_block;
             }
+            else if (0 == Compare_String_Vals(item, Root_Pure_Tag, true)) {
+                *flags |= MKF_IS_PURE;  // caller puts it on the details
+                continue;
+            }
             else
                 fail (Error_Bad_Func_Def_Core(item, VAL_SPECIFIER(spec)));
         }
@@ -884,9 +890,12 @@ REBARR *Pop_Paramlist_With_Meta_May_Fail(
 // more asserts.  So the fixed size flag is *not* added here, but ensured
 // in the Make_Action() step.
 //
+// The flags are updated with what the spec analysis found (e.g. MKF_IS_PURE)
+// so the caller can apply properties that live on the action's details.
+//
 REBARR *Make_Paramlist_Managed_May_Fail(
     const REBVAL *spec,
-    REBFLGS flags
+    REBFLGS *flags
 ){
     REBDSP dsp_orig = DSP;
     assert(DS_TOP == DS_AT(dsp_orig));
@@ -910,13 +919,13 @@ REBARR *Make_Paramlist_Managed_May_Fail(
     //
     Push_Paramlist_Triads_May_Fail(
         spec,
-        &flags,
+        flags,
         dsp_orig,
         &definitional_return_dsp
     );
     return Pop_Paramlist_With_Meta_May_Fail(
         dsp_orig,
-        flags,
+        *flags,
         definitional_return_dsp
     );
 }
@@ -1144,6 +1153,12 @@ void Get_Maybe_Fake_Action_Body(REBVAL *out, const REBVAL *action)
     REBSPC *binding = VAL_BINDING(action);
     REBACT *a = VAL_ACTION(action);
 
+    // A stub from LAZY has no body yet.  Asking for it is a good enough
+    // reason to make the real action (e.g. for SOURCE).
+    //
+    if (ACT_DISPATCHER(a) == &Lazy_Dispatcher)
+        Force_Lazy_Action(a);
+
     // A Hijacker *might* not need to splice itself in with a dispatcher.
     // But if it does, bypass it to get to the "real" action implementation.
     //
@@ -1168,6 +1183,7 @@ void Get_Maybe_Fake_Action_Body(REBVAL *out, const REBVAL *action)
         or ACT_DISPATCHER(a) == &Unchecked_Dispatcher
         or ACT_DISPATCHER(a) == &Voider_Dispatcher
         or ACT_DISPATCHER(a) == &Returner_Dispatcher
+        or ACT_DISPATCHER(a) == &Datum_Dispatcher
         or ACT_DISPATCHER(a) == &Block_Dispatcher
     ){
         // Interpreted code, the body is a block with some bindings relative
@@ -1259,6 +1275,17 @@ void Get_Maybe_Fake_Action_Body(REBVAL *out, const REBVAL *action)
 }
 
 
+// A body consisting of just one inert value would evaluate to that value.
+//
+inline static bool Is_Datum_Body(REBARR *body) {
+    if (ARR_LEN(body) != 1)
+        return false;
+
+    RELVAL *datum = ARR_HEAD(body);
+    return not IS_VOID(datum) and ANY_INERT(datum);
+}
+
+
 //
 //  Make_Interpreted_Action_May_Fail: C
 //
@@ -1304,13 +1331,16 @@ REBACT *Make_Interpreted_Action_May_Fail(
     assert(IS_BLOCK(spec) and IS_BLOCK(body));
 
     REBACT *a = Make_Action(
-        Make_Paramlist_Managed_May_Fail(spec, mkf_flags),
+        Make_Paramlist_Managed_May_Fail(spec, &mkf_flags),
         &Null_Dispatcher,  // will be overwritten if non-[] body
         nullptr,  // no underlying action (use paramlist)
         nullptr,  // no specialization exemplar (or inherited exemplar)
         1  // details array capacity
     );
 
+    if (mkf_flags & MKF_IS_PURE)
+        SER(ACT_DETAILS(a))->header.bits |= DETAILS_FLAG_IS_PURE;
+
     // We look at the *actual* function flags; e.g. the person may have used
     // the FUNC generator (with MKF_RETURN) but then named a parameter RETURN
     // which overrides it, so the value won't have PARAMLIST_HAS_RETURN.
@@ -1355,6 +1385,21 @@ REBACT *Make_Interpreted_Action_May_Fail(
             TS_WORD,
             true  // gather the LETs (transitional method)
         );
+
+        // Stubs like `does [10]` or `func [] [{text}]` are common, and need
+        // no evaluator at all.  (Datum_Dispatcher() checks that the body is
+        // still like this, then handles both the Returner and Unchecked
+        // cases.)
+        //
+        if (
+            (
+                ACT_DISPATCHER(a) == &Returner_Dispatcher
+                or ACT_DISPATCHER(a) == &Unchecked_Dispatcher
+            )
+            and Is_Datum_Body(copy)
+        ){
+            ACT_DISPATCHER(a) = &Datum_Dispatcher;
+        }
     }
 
     // Favor the spec first, then the body, for file and line information.
@@ -1474,6 +1519,51 @@ REB_R Generic_Dispatcher(REBFRM *f)
         ? FRM_ARG(f, 2)
         : FRM_ARG(f, 1);
 
+    // Loops spend much of their time adding, subtracting and multiplying two
+    // INTEGER!s or two DECIMAL!s.  Do those here instead of going through
+    // the type's hook and its verb switch.  Integer overflow (and integers
+    // already promoted past 64 bits) go through the hook, which promotes.
+    // (all three take their operands as the first two arguments)
+    //
+    REBSYM sym = VAL_WORD_SYM(verb);
+    if (sym == SYM_ADD or sym == SYM_SUBTRACT or sym == SYM_MULTIPLY) {
+        REBVAL *second_arg = first_arg + 1;
+
+        if (
+            IS_INTEGER(first_arg) and not IS_INTEGER_BIG(first_arg)
+            and IS_INTEGER(second_arg) and not IS_INTEGER_BIG(second_arg)
+        ){
+            REBI64 num = VAL_INT64(first_arg);
+            REBI64 arg = VAL_INT64(second_arg);
+            REBI64 result;
+            bool overflow;
+            if (sym == SYM_ADD)
+                overflow = REB_I64_ADD_OF(num, arg, &result);
+            else if (sym == SYM_SUBTRACT)
+                overflow = REB_I64_SUB_OF(num, arg, &result);
+            else
+                overflow = REB_I64_MUL_OF(num, arg, &result);
+
+            if (not overflow)
+                return Init_Integer(f->out, result);
+        }
+
+        if (IS_DECIMAL(first_arg) and IS_DECIMAL(second_arg)) {
+            REBDEC d1 = VAL_DECIMAL(first_arg);
+            REBDEC d2 = VAL_DECIMAL(second_arg);
+            if (sym == SYM_ADD)
+                d1 += d2;
+            else if (sym == SYM_SUBTRACT)
+                d1 -= d2;
+            else
+                d1 *= d2;
+
+            if (not FINITE(d1))
+                fail (Error_Overflow_Raw());
+            return Init_Decimal(f->out, d1);
+        }
+    }
+
     return Run_Generic_Dispatch(first_arg, f, verb);
 }
 
@@ -1565,7 +1655,10 @@ REB_R Typeset_Checker_Dispatcher(REBFRM *f)
     RELVAL *typeset = ARR_HEAD(details);
     assert(IS_TYPESET(typeset));
 
-    return Init_Logic(f->out, TYPE_CHECK(typeset, VAL_TYPE(FRM_ARG(f, 1))));
+    return Init_Logic(
+        f->out,
+        TYPE_CHECK_KIND_BYTE(typeset, KIND_BYTE(FRM_ARG(f, 1)))
+    );
 }
 
 
@@ -1631,6 +1724,48 @@ REB_R Returner_Dispatcher(REBFRM *f)
 }
 
 
+//
+//  Datum_Dispatcher: C
+//
+// Body is a single inert value, so produce it without running the evaluator.
+// Then typecheck it if there's a RETURN: (as Returner_Dispatcher() would).
+//
+// The body could be changed after the action was made if it is not locked,
+// e.g. via `append body-of :f ...` on an action made with MAKE ACTION!.  So
+// it is checked on each call, and any change falls back to evaluation.
+//
+REB_R Datum_Dispatcher(REBFRM *f)
+{
+    REBARR *details = ACT_DETAILS(FRM_PHASE(f));
+    RELVAL *body = ARR_HEAD(details);
+
+    if (not Is_Datum_Body(VAL_ARRAY(body))) {
+        if (Interpreted_Dispatch_Throws(f->out, f))
+            return R_THROWN;
+    }
+    else {
+        RELVAL *datum = ARR_HEAD(VAL_ARRAY(body));
+        Derelativize(f->out, datum, SPC(f->varlist));
+
+        // Mimic the constness an evaluation of the body would have given,
+        // see Prep_Any_Array_Feed() and Inertly_Derelativize_Inheriting_Const()
+        //
+        if (
+            NOT_CELL_FLAG(body, EXPLICITLY_MUTABLE)
+            and NOT_CELL_FLAG(datum, EXPLICITLY_MUTABLE)
+        ){
+            f->out->header.bits |= (
+                (f->feed->flags.bits | body->header.bits) & CELL_FLAG_CONST
+            );
+        }
+    }
+
+    if (GET_ACTION_FLAG(FRM_PHASE(f), HAS_RETURN))
+        FAIL_IF_BAD_RETURN_TYPE(f);
+    return f->out;
+}
+
+
 //
 //  Elider_Dispatcher: C
 //
@@ -1720,6 +1855,259 @@ REB_R Hijacker_Dispatcher(REBFRM *f)
 }
 
 
+//
+//  Force_Lazy_Action: C
+//
+// Run the generator a LAZY stub was holding on to, and make the stub a proxy
+// for the action it produces.  This is done the same way HIJACK does it when
+// frames are not compatible, so every existing reference to the stub (words,
+// ADAPTs, SPECIALIZEs) keeps working--and keeps its identity.
+//
+void Force_Lazy_Action(REBACT *a)
+{
+    REBARR *details = ACT_DETAILS(a);
+    assert(ACT_DISPATCHER(a) == &Lazy_Dispatcher);
+
+    REBVAL *action = rebValue(
+        KNOWN(ARR_AT(details, IDX_LAZY_GENERATOR)),
+        KNOWN(ARR_AT(details, IDX_LAZY_SPEC)),
+        KNOWN(ARR_AT(details, IDX_LAZY_BODY)),
+    rebEND);
+    if (not IS_ACTION(action))
+        fail ("Generator given to LAZY did not make an ACTION!");
+
+    Note_Series_Mutation(SER(details));
+
+    SER(details)->header.bits |=
+        (SER(ACT_DETAILS(VAL_ACTION(action)))->header.bits
+            & DETAILS_FLAG_IS_PURE);
+
+    MISC(details).dispatcher = &Hijacker_Dispatcher;
+    Move_Value(ARR_HEAD(details), action);
+    TERM_ARRAY_LEN(details, 1);
+
+    rebRelease(action);
+}
+
+
+//
+//  Lazy_Dispatcher: C
+//
+// Dispatcher used by LAZY, until the first call replaces it.
+//
+REB_R Lazy_Dispatcher(REBFRM *f)
+{
+    Force_Lazy_Action(FRM_PHASE(f));
+    return Hijacker_Dispatcher(f);
+}
+
+
+//=//// COMPOSITION PLANS ///////////////////////////////////////////////=//
+//
+// ADAPT, CHAIN and SPECIALIZE make actions out of other actions, which may
+// themselves have been made that way.  Running such an action layer by layer
+// means a trip back through the evaluator for each one: a SPECIALIZE just
+// switches the phase and redoes, and an ADAPT redoes with a full pass over
+// the arguments to typecheck them.  A library wrapping a native 4 or 5 deep
+// pays for that on every call.
+//
+// So when one of these actions is made, a "plan" is worked out and put in
+// the last slot of its details.  It is a BLOCK! of ACTION!s (with bindings)
+// with the layers that add nothing at runtime skipped:
+//
+// * SPECIALIZE: the action that will finally be run.  The specialized values
+//   were all merged into the exemplar when the specialization was made.
+//
+// * ADAPT: any adaptations directly inside, whose preludes are run in a
+//   loop by the one dispatcher, and then the action to redo with.
+//
+// * CHAIN: the pipeline with any nested chains spliced in.
+//
+// HIJACK can change what any of the skipped layers do.  Plans record the
+// PG_Hijack_Epoch they were made in, and are remade if a hijack happened
+// since.  (ENCLOSE is not flattened, because the FRAME! it passes to the
+// outer action is visible to user code.)
+//
+
+#define PLAN_EPOCH(plan) \
+    MISC(plan).custom.u  // so the plan can't have ARRAY_FLAG_HAS_FILE_LINE
+
+
+// Layers that only switch the phase and binding.  Note the frame must have
+// been built from the exemplar of the outermost one for these to be skipped.
+//
+static REBACT *Skip_Specializers(REBNOD **binding, REBACT *a)
+{
+    while (ACT_DISPATCHER(a) == &Specializer_Dispatcher) {
+        REBARR *details = ACT_DETAILS(a);
+        assert(ARR_LEN(details) == IDX_SPECIALIZER_MAX);
+
+        REBVAL *frame = KNOWN(ARR_AT(details, IDX_SPECIALIZER_FRAME));
+        *binding = VAL_BINDING(frame);
+        a = VAL_PHASE(frame);
+    }
+    return a;
+}
+
+
+// An adaptation whose prelude can be run inline by an outer adaptation must
+// not have parameters needing more from the typecheck between the preludes
+// than Recheck_Adapted_Args() does.
+//
+static bool Is_Flattenable_Adapter(REBACT *a)
+{
+    if (ACT_DISPATCHER(a) != &Adapter_Dispatcher)
+        return false;
+
+    REBVAL *param = ACT_PARAMS_HEAD(a);
+    for (; NOT_END(param); ++param) {
+        if (
+            Is_Param_Variadic(param)
+            or TYPE_CHECK(param, REB_TS_NOOP_IF_BLANK)
+            or TYPE_CHECK(param, REB_TS_CONST)
+            or TYPE_CHECK(param, REB_TS_DEQUOTE_REQUOTE)
+        ){
+            return false;
+        }
+    }
+    return true;
+}
+
+
+// What R_REDO_CHECKED does to the arguments of a frame, for a phase that
+// Is_Flattenable_Adapter() allowed.  Locals and RETURN are reset, and any
+// argument changed by the last prelude is typechecked.
+//
+static void Recheck_Adapted_Args(REBFRM *f, REBACT *phase)
+{
+    REBVAL *param = ACT_PARAMS_HEAD(phase);
+    REBVAL *arg = FRM_ARGS_HEAD(f);
+    for (; NOT_END(param); ++param, ++arg) {
+        if (TYPE_CHECK(param, REB_TS_REFINEMENT)) {
+            if (NOT_CELL_FLAG(arg, ARG_MARKED_CHECKED))
+                Typecheck_Refinement_And_Canonize(param, arg);
+            continue;
+        }
+
+        switch (VAL_PARAM_CLASS(param)) {
+          case REB_P_LOCAL:
+            Init_Void(arg);
+            SET_CELL_FLAG(arg, ARG_MARKED_CHECKED);
+            continue;
+
+          case REB_P_RETURN:
+            Move_Value(arg, NAT_VALUE(return));
+            INIT_BINDING(arg, f->varlist);
+            SET_CELL_FLAG(arg, ARG_MARKED_CHECKED);
+            continue;
+
+          default:
+            break;
+        }
+
+        if (GET_CELL_FLAG(arg, ARG_MARKED_CHECKED))
+            continue;
+
+        if (not Typecheck_Including_Quoteds(param, arg))
+            fail (Error_Arg_Type(f, param, VAL_TYPE(arg)));
+
+        SET_CELL_FLAG(arg, ARG_MARKED_CHECKED);
+    }
+}
+
+
+// Only the head of a chain is run in the frame built from the chain's own
+// exemplar, so only there can specializations be skipped.
+//
+static void Push_Chain_Steps(const RELVAL *pipeline, bool head)
+{
+    const RELVAL *item = ARR_HEAD(VAL_ARRAY(pipeline));
+    for (; NOT_END(item); ++item, head = false) {
+        REBACT *a = VAL_ACTION(item);
+        REBNOD *binding = VAL_BINDING(item);
+        if (head)
+            a = Skip_Specializers(&binding, a);
+
+        if (ACT_DISPATCHER(a) == &Chainer_Dispatcher) {
+            REBARR *details = ACT_DETAILS(a);
+            Push_Chain_Steps(ARR_AT(details, IDX_CHAINER_PIPELINE), head);
+            continue;
+        }
+
+        Init_Action_Maybe_Bound(DS_PUSH(), a, binding);
+    }
+}
+
+
+//
+//  Make_Composition_Plan: C
+//
+// Flatten the layers under an ADAPT, CHAIN or SPECIALIZE action into the
+// plan its dispatcher follows (see notes on COMPOSITION PLANS above).
+//
+REBARR *Make_Composition_Plan(REBACT *a)
+{
+    REBDSP dsp_orig = DSP;
+
+    REBARR *details = ACT_DETAILS(a);
+    REBNAT dispatcher = ACT_DISPATCHER(a);
+
+    if (dispatcher == &Specializer_Dispatcher) {
+        REBNOD *binding = UNBOUND;
+        REBACT *target = Skip_Specializers(&binding, a);
+        Init_Action_Maybe_Bound(DS_PUSH(), target, binding);
+    }
+    else if (dispatcher == &Adapter_Dispatcher) {
+        REBVAL *adaptee = KNOWN(ARR_AT(details, IDX_ADAPTER_ADAPTEE));
+        REBACT *step = VAL_ACTION(adaptee);
+        REBNOD *binding = VAL_BINDING(adaptee);
+        while (true) {
+            step = Skip_Specializers(&binding, step);
+            if (not Is_Flattenable_Adapter(step))
+                break;
+
+            Init_Action_Maybe_Bound(DS_PUSH(), step, binding);
+
+            adaptee = KNOWN(ARR_AT(ACT_DETAILS(step), IDX_ADAPTER_ADAPTEE));
+            step = VAL_ACTION(adaptee);
+            binding = VAL_BINDING(adaptee);
+        }
+        Init_Action_Maybe_Bound(DS_PUSH(), step, binding);  // redo with this
+    }
+    else {
+        assert(dispatcher == &Chainer_Dispatcher);
+        Push_Chain_Steps(ARR_AT(details, IDX_CHAINER_PIPELINE), true);
+    }
+
+    // No ARRAY_MASK_HAS_FILE_LINE, since MISC() holds the epoch instead
+    //
+    REBARR *plan = Pop_Stack_Values_Core(dsp_orig, SERIES_FLAGS_NONE);
+    PLAN_EPOCH(plan) = PG_Hijack_Epoch;
+    Manage_Array(plan);
+    return plan;
+}
+
+
+//
+//  Get_Composition_Plan: C
+//
+// The plan in the given slot of the action's details, remade if a HIJACK
+// happened since it was made.
+//
+REBARR *Get_Composition_Plan(REBACT *a, REBLEN idx)
+{
+    REBARR *details = ACT_DETAILS(a);
+    RELVAL *slot = ARR_AT(details, idx);
+    if (IS_BLOCK(slot) and PLAN_EPOCH(VAL_ARRAY(slot)) == PG_Hijack_Epoch)
+        return VAL_ARRAY(slot);
+
+    REBARR *plan = Make_Composition_Plan(a);
+    Note_Series_Mutation(SER(details));
+    Init_Block(slot, plan);
+    return plan;
+}
+
+
 //
 //  Adapter_Dispatcher: C
 //
@@ -1728,10 +2116,10 @@ REB_R Hijacker_Dispatcher(REBFRM *f)
 REB_R Adapter_Dispatcher(REBFRM *f)
 {
     REBARR *details = ACT_DETAILS(FRM_PHASE(f));
-    assert(ARR_LEN(details) == 2);
+    assert(ARR_LEN(details) == IDX_ADAPTER_MAX);
 
-    RELVAL* prelude = ARR_AT(details, 0);
-    REBVAL* adaptee = KNOWN(ARR_AT(details, 1));
+    RELVAL* prelude = ARR_AT(details, IDX_ADAPTER_PRELUDE);
+    REBVAL* adaptee = KNOWN(ARR_AT(details, IDX_ADAPTER_ADAPTEE));
 
     // The first thing to do is run the prelude code, which may throw.  If it
     // does throw--including a RETURN--that means the adapted function will
@@ -1744,10 +2132,49 @@ REB_R Adapter_Dispatcher(REBFRM *f)
         return R_THROWN;
     }
 
+    // Instead of switching to the adaptee and redoing, run the preludes of
+    // any adaptations inside of it here.  The redo is then only done once,
+    // with whatever they adapt.
+    //
+    REBLEN epoch = PG_Hijack_Epoch;
+    REBARR *plan = Get_Composition_Plan(FRM_PHASE(f), IDX_ADAPTER_PLAN);
+    PUSH_GC_GUARD(plan);  // a prelude could HIJACK, and the plan be remade
+
+    RELVAL *step = ARR_HEAD(plan);
+    for (; NOT_END(step + 1); ++step) {  // all but the last are adaptations
+        INIT_FRM_PHASE(f, VAL_ACTION(step));
+        FRM_BINDING(f) = VAL_BINDING(step);
+        Recheck_Adapted_Args(f, VAL_ACTION(step));
+
+        REBARR *inner = ACT_DETAILS(VAL_ACTION(step));
+        adaptee = KNOWN(ARR_AT(inner, IDX_ADAPTER_ADAPTEE));
+        if (Do_Any_Array_At_Throws(
+            discarded,
+            ARR_AT(inner, IDX_ADAPTER_PRELUDE),
+            SPC(f->varlist)
+        )){
+            DROP_GC_GUARD(plan);
+            Move_Value(f->out, discarded);
+            return R_THROWN;
+        }
+
+        if (epoch != PG_Hijack_Epoch)
+            goto redo_with_adaptee;  // rest of the plan may be out of date
+    }
+
+    INIT_FRM_PHASE(f, VAL_ACTION(step));
+    FRM_BINDING(f) = VAL_BINDING(step);
+    DROP_GC_GUARD(plan);
+    return R_REDO_CHECKED;  // the redo will use the updated phase & binding
+
+  redo_with_adaptee:
+
+    DROP_GC_GUARD(plan);
+
     INIT_FRM_PHASE(f, VAL_ACTION(adaptee));
     FRM_BINDING(f) = VAL_BINDING(adaptee);
 
-    return R_REDO_CHECKED;  // the redo will use the updated phase & binding
+    return R_REDO_CHECKED;
 }
 
 
@@ -1820,20 +2247,20 @@ REB_R Encloser_Dispatcher(REBFRM *f)
 //
 REB_R Chainer_Dispatcher(REBFRM *f)
 {
-    REBARR *details = ACT_DETAILS(FRM_PHASE(f));
-    REBARR *pipeline = VAL_ARRAY(ARR_HEAD(details));
+    REBARR *plan = Get_Composition_Plan(FRM_PHASE(f), IDX_CHAINER_PLAN);
 
     // The post-processing pipeline has to be "pushed" so it is not forgotten.
     // Go in reverse order, so the function to apply last is at the bottom of
-    // the stack.
+    // the stack.  (The plan has any nested chains spliced in, so they don't
+    // need their own trip through here.)
     //
-    REBVAL *chained = KNOWN(ARR_LAST(pipeline));
-    for (; chained != ARR_HEAD(pipeline); --chained) {
+    REBVAL *chained = KNOWN(ARR_LAST(plan));
+    for (; chained != ARR_HEAD(plan); --chained) {
         assert(IS_ACTION(chained));
         Move_Value(DS_PUSH(), KNOWN(chained));
     }
 
-    // Extract the first function, itself which might be a chain.
+    // Extract the first function, with any specializations of it skipped.
     //
     INIT_FRM_PHASE(f, VAL_ACTION(chained));
     FRM_BINDING(f) = VAL_BINDING(chained);
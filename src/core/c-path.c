@@ -276,6 +276,107 @@ bool Next_Path_Throws(REBPVS *pvs)
 }
 
 
+//
+//  Try_Simple_Path: C
+//
+// Many paths are just chains of WORD!s and INTEGER!s walking through OBJECT!,
+// BLOCK!, and MAP! values, e.g. `obj/sub/field` or `data/2/name:`.  Those
+// don't need a path frame or a dispatch through the PD_XXX() hooks, so this
+// walks them directly and returns true if it was able to do the GET or SET.
+//
+// Anything that isn't covered (GROUP!s, refinements on ACTION!s, nulls that
+// would need errors, protected targets, out of range picks...) returns false
+// and the caller runs the full path machinery from the beginning.  Nothing
+// is written to variables unless true is returned, so that is always safe.
+//
+// The CONST flag is propagated as Next_Path_Throws() would for references,
+// and not for MAP! picks (PD_Map() hands back the value it finds as-is).
+//
+static bool Try_Simple_Path(
+    REBVAL *out,
+    const RELVAL *item,
+    REBSPC *specifier,
+    const REBVAL *opt_setval
+){
+    if (not IS_WORD(item) or IS_END(item + 1))
+        return false;
+
+    Move_Value(out, Get_Mutable_Var_May_Fail(item, specifier));
+    ++item;
+
+    for (; NOT_END(item); ++item) {
+        bool last = IS_END(item + 1);
+        enum Reb_Kind kind = VAL_TYPE(out);
+
+        if (kind == REB_OBJECT and IS_WORD(item)) {
+            REBCTX *c = VAL_CONTEXT(out);
+            REBLEN n = Find_Canon_In_Context(c, VAL_WORD_CANON(item), false);
+            if (n == 0)
+                return false;
+
+            REBVAL *var = CTX_VAR(c, n);
+
+            if (last and opt_setval) {
+                if (
+                    GET_CELL_FLAG(out, CONST)
+                    or Is_Series_Read_Only(SER(CTX_VARLIST(c)))
+                    or GET_CELL_FLAG(var, PROTECTED)
+                ){
+                    return false;  // let PD_Context() give the error
+                }
+                Move_Value(var, opt_setval);
+                return true;
+            }
+
+            bool was_const = GET_CELL_FLAG(out, CONST);
+            Move_Value(out, var);
+            if (was_const)
+                SET_CELL_FLAG(out, CONST);
+        }
+        else if (kind == REB_BLOCK and IS_INTEGER(item) and not opt_setval) {
+            REBI64 n = VAL_INT64(item);
+            if (n <= 0 or n > cast(REBI64, VAL_LEN_AT(out)))
+                return false;  // 0 and negative picks have special rules
+
+            bool was_const = GET_CELL_FLAG(out, CONST);
+            Derelativize(
+                out,
+                VAL_ARRAY_AT(out) + (n - 1),
+                VAL_SPECIFIER(out)
+            );
+            if (was_const)
+                SET_CELL_FLAG(out, CONST);
+        }
+        else if (kind == REB_MAP and IS_WORD(item) and not opt_setval) {
+            DECLARE_LOCAL (picker);
+            Derelativize(picker, item, specifier);
+
+            const bool cased = false;  // path access is case-insensitive
+            REBLEN n = Find_Map_Entry(
+                VAL_MAP(out), picker, SPECIFIED, nullptr, SPECIFIED, cased
+            );
+            if (n == 0)
+                return false;
+
+            REBVAL *val = KNOWN(
+                ARR_AT(MAP_PAIRLIST(VAL_MAP(out)), ((n - 1) * 2) + 1)
+            );
+            if (IS_NULLED(val))  // zombie entry
+                return false;
+
+            Move_Value(out, val);
+        }
+        else
+            return false;
+
+        if (IS_NULLED(out) ? not last : IS_ACTION(out))
+            return false;  // errors and refinements need the full machinery
+    }
+
+    return not opt_setval;  // a SET that got here didn't end on an OBJECT!
+}
+
+
 //
 //  Eval_Path_Throws_Core: C
 //
@@ -325,6 +426,12 @@ bool Eval_Path_Throws_Core(
         return false;
     }
 
+    if (Try_Simple_Path(out, ARR_AT(array, index), specifier, opt_setval)) {
+        if (label_out)
+            *label_out = nullptr;
+        return false;
+    }
+
     DECLARE_ARRAY_FEED (feed, array, index, specifier);
     DECLARE_FRAME (pvs, feed, flags | EVAL_FLAG_PATH_MODE);
 
@@ -1009,6 +1116,9 @@ REB_R TO_Path(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg) {
 //
 REBINT CT_Path(const REBCEL *a, const REBCEL *b, REBINT mode)
 {
+    if (mode >= 0 and VAL_LEN_AT(a) != VAL_LEN_AT(b))
+        return 0;  // can't be equal, don't bother comparing the items
+
     REBINT num = Cmp_Array(a, b, mode == 1);
     if (mode >= 0)
         return (num == 0);
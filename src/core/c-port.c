@@ -96,7 +96,8 @@ REBINT Awake_System(REBARR *ports, bool only)
     if (!IS_PORT(port))
         return -10; // verify it is a port object
 
-    // Get wait queue block (the state field):
+    // Get wait queue (the state field).  Its layout is up to the port's
+    // actor, so the caller checks if there is anything new to do.
     REBVAL *state = VAL_CONTEXT_VAR(port, STD_PORT_STATE);
     if (!IS_BLOCK(state))
         return -10;
@@ -106,10 +107,6 @@ REBINT Awake_System(REBARR *ports, bool only)
     if (!IS_BLOCK(waked))
         return -10;
 
-    // If there is nothing new to do, return now:
-    if (VAL_LEN_HEAD(state) == 0 and VAL_LEN_HEAD(waked) == 0)
-        return -1;
-
     // Get the system port AWAKE function:
     REBVAL *awake = VAL_CONTEXT_VAR(port, STD_PORT_AWAKE);
     if (not IS_ACTION(awake))
@@ -164,27 +161,53 @@ void Sieve_Ports(REBARR *ports)
 {
     REBVAL *port;
     REBVAL *waked;
-    REBLEN n;
 
     port = Get_System(SYS_PORTS, PORTS_SYSTEM);
     if (!IS_PORT(port)) return;
     waked = VAL_CONTEXT_VAR(port, STD_PORT_DATA);
     if (!IS_BLOCK(waked)) return;
 
-    for (n = 0; ports and n < ARR_LEN(ports);) {
-        RELVAL *val = ARR_AT(ports, n);
-        if (IS_PORT(val)) {
-            assert(VAL_LEN_HEAD(waked) != 0);
-            if (
-                Find_In_Array_Simple(VAL_ARRAY(waked), 0, val)
-                == VAL_LEN_HEAD(waked) // `=len` means not found
-            ) {
-                Remove_Series_Len(SER(ports), n, 1);
+    if (ports) {
+        //
+        // Color the waked ports black, so each port can be checked in O(1)
+        // and the sieve is one pass (instead of searching the wake list for
+        // each port, and removing non-waked ports one at a time).
+        //
+        RELVAL *item;
+        for (item = VAL_ARRAY_HEAD(waked); NOT_END(item); ++item) {
+            if (not IS_PORT(item))
                 continue;
+            REBSER *s = SER(CTX_VARLIST(VAL_CONTEXT(item)));
+            if (Is_Series_White(s))
+                Flip_Series_To_Black(s);
+        }
+
+        REBLEN len = ARR_LEN(ports);
+        REBLEN n;
+        REBLEN kept = 0;
+        for (n = 0; n < len; ++n) {
+            RELVAL *val = ARR_AT(ports, n);
+            if (
+                IS_PORT(val)
+                and Is_Series_White(SER(CTX_VARLIST(VAL_CONTEXT(val))))
+            ){
+                continue;  // not in the wake list
             }
+            if (kept != n)
+                Move_Value(ARR_AT(ports, kept), KNOWN(val));
+            ++kept;
+        }
+        TERM_ARRAY_LEN(ports, kept);
+
+        for (item = VAL_ARRAY_HEAD(waked); NOT_END(item); ++item) {
+            if (not IS_PORT(item))
+                continue;
+            REBSER *s = SER(CTX_VARLIST(VAL_CONTEXT(item)));
+            if (Is_Series_Black(s))
+                Flip_Series_To_White(s);
         }
-        n++;
     }
+
     //clear waked list
     RESET_ARRAY(VAL_ARRAY(waked));
 }
@@ -370,6 +393,9 @@ REB_R Do_Port_Action(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
                 assert(!"Bad REB_R in READ workaround for /STRING /LINES");
         }
 
+        if ((REF(string) or REF(lines)) and REF(into))
+            fail (Error_Bad_Refines_Raw());
+
         if ((REF(string) or REF(lines)) and not IS_TEXT(D_OUT)) {
             if (not IS_BINARY(D_OUT))
                 fail ("/STRING or /LINES used on a non-BINARY!/STRING! read");
@@ -388,6 +414,26 @@ REB_R Do_Port_Action(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
             Move_Value(temp, D_OUT);
             Init_Block(D_OUT, Split_Lines(temp));
         }
+
+        // Actors that can fill the /INTO binary directly (e.g. network ports,
+        // which use it as their receive buffer) return it or the PORT!.  The
+        // rest had their data read into a new binary, which is appended.
+        //
+        if (REF(into) and IS_BINARY(D_OUT)) {
+            if (VAL_SERIES(D_OUT) != VAL_SERIES(ARG(into))) {
+                FAIL_IF_READ_ONLY(ARG(into));
+
+                REBBIN *bin = VAL_BINARY(ARG(into));
+                REBLEN tail = BIN_LEN(bin);
+                REBLEN len = VAL_LEN_AT(D_OUT);
+                EXPAND_SERIES_TAIL(bin, len);
+                memcpy(BIN_AT(bin, tail), VAL_BIN_AT(D_OUT), len);
+                TERM_BIN_LEN(bin, tail + len);
+            }
+            Move_Value(D_OUT, ARG(into));
+        }
+        else if (REF(into) and not IS_PORT(D_OUT))
+            fail ("READ/INTO only works on ports that read BINARY!");
     }
 
     return r;
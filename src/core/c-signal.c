@@ -100,7 +100,7 @@ bool Do_Signals_Throws(REBVAL *out)
 
     if (filtered_sigs & SIG_RECYCLE) {
         CLR_SIGNAL(SIG_RECYCLE);
-        Recycle();
+        Recycle_Auto();
     }
 
 #ifdef NOT_USED_INVESTIGATE
@@ -145,6 +145,60 @@ bool Do_Signals_Throws(REBVAL *out)
         fail ("BREAKPOINT from SIG_INTERRUPT not currently implemented");
     }
 
+    // The sampling profiler takes a sample each time the Eval_Dose runs out
+    // (SAMPLER/EVERY adjusts the dose), or when asked to by rebSample().
+    //
+    if (TG_Sampling) {
+        CLR_SIGNAL(SIG_SAMPLE);
+        Sample_Frame_Stack();
+    }
+    else if (filtered_sigs & SIG_SAMPLE)
+        CLR_SIGNAL(SIG_SAMPLE);  // sampler not running, disregard
+
     Eval_Sigmask = saved_mask;
     return thrown;
 }
+
+
+//
+//  Poll_Signals_Core: C
+//
+// Service signals from inside a native that runs a long time in C without
+// evaluating (sorting, searching, compressing).  See Poll_Signals(), which
+// only calls this when one of the `sigs` the caller can handle is pending.
+//
+// SIG_RECYCLE is only in `sigs` where a GC can run, i.e. everything the
+// native holds is reachable or guarded.  The GC may do an incremental slice
+// and raise the signal again for the next poll.
+//
+// A halt can't be thrown from here, as the native may be deep inside of a
+// qsort() or a loop returning a plain index.  So SIG_HALT is left set for
+// the evaluator to throw at its next step, and true is returned to tell the
+// native to give up on its work.  Whatever it returns instead will not be
+// seen by any code (short of a CATCH of the HALT).
+//
+bool Poll_Signals_Core(REBFLGS sigs)
+{
+    REBFLGS filtered_sigs = Eval_Signals & Eval_Sigmask & sigs;
+    REBFLGS saved_mask = Eval_Sigmask;
+    Eval_Sigmask = 0;  // no recursion, see Do_Signals_Throws()
+
+    if (filtered_sigs & SIG_RECYCLE) {
+        CLR_SIGNAL(SIG_RECYCLE);
+        Recycle_Auto();
+    }
+
+    if (filtered_sigs & SIG_SAMPLE) {
+        CLR_SIGNAL(SIG_SAMPLE);
+        if (TG_Sampling)
+            Sample_Frame_Stack();
+    }
+
+    Eval_Sigmask = saved_mask;
+
+    if (filtered_sigs & SIG_HALT) {
+        Eval_Count = 1;  // have the evaluator throw it on its next step
+        return true;
+    }
+    return false;
+}
@@ -510,7 +510,7 @@ bool Specialize_Action_Throws(
         &Specializer_Dispatcher,
         ACT_UNDERLYING(unspecialized),  // same underlying action as this
         exemplar,  // also provide a context of specialization values
-        1  // details array capacity
+        IDX_SPECIALIZER_MAX  // details array capacity
     );
     assert(CTX_KEYLIST(exemplar) == ACT_PARAMLIST(unspecialized));
 
@@ -524,11 +524,17 @@ bool Specialize_Action_Throws(
     // that binding has to be UNBOUND).  It also remembers the original
     // action in the phase, so Specializer_Dispatcher() knows what to call.
     //
-    RELVAL *body = ARR_HEAD(ACT_DETAILS(specialized));
+    REBARR *details = ACT_DETAILS(specialized);
+    RELVAL *body = ARR_AT(details, IDX_SPECIALIZER_FRAME);
     Move_Value(body, CTX_ARCHETYPE(exemplar));
     INIT_BINDING(body, VAL_BINDING(specializee));
     INIT_VAL_CONTEXT_PHASE(body, unspecialized);
 
+    Init_Block(
+        ARR_AT(details, IDX_SPECIALIZER_PLAN),
+        Make_Composition_Plan(specialized)
+    );
+
     Init_Action_Unbound(out, specialized);
     return false;  // code block did not throw
 }
@@ -545,13 +551,15 @@ bool Specialize_Action_Throws(
 //
 REB_R Specializer_Dispatcher(REBFRM *f)
 {
-    REBARR *details = ACT_DETAILS(FRM_PHASE(f));
-
-    REBVAL *exemplar = KNOWN(ARR_HEAD(details));
-    assert(IS_FRAME(exemplar));
+    // Specializations of specializations would each just switch the phase
+    // again, so the plan goes straight to the last one's phase and binding.
+    //
+    REBARR *plan = Get_Composition_Plan(FRM_PHASE(f), IDX_SPECIALIZER_PLAN);
+    REBVAL *target = KNOWN(ARR_HEAD(plan));
+    assert(IS_ACTION(target));
 
-    INIT_FRM_PHASE(f, VAL_PHASE(exemplar));
-    FRM_BINDING(f) = VAL_BINDING(exemplar);
+    INIT_FRM_PHASE(f, VAL_ACTION(target));
+    FRM_BINDING(f) = VAL_BINDING(target);
 
     return R_REDO_UNCHECKED; // redo uses the updated phase and binding
 }
@@ -1125,10 +1133,15 @@ REBACT *Make_Action_From_Exemplar(REBCTX *exemplar)
         &Specializer_Dispatcher,
         ACT_UNDERLYING(unspecialized), // common underlying action
         exemplar, // also provide a context of specialization values
-        1 // details array capacity
+        IDX_SPECIALIZER_MAX // details array capacity
     );
 
-    Init_Frame(ARR_HEAD(ACT_DETAILS(action)), exemplar);
+    REBARR *details = ACT_DETAILS(action);
+    Init_Frame(ARR_AT(details, IDX_SPECIALIZER_FRAME), exemplar);
+    Init_Block(
+        ARR_AT(details, IDX_SPECIALIZER_PLAN),
+        Make_Composition_Plan(action)
+    );
     return action;
 }
 
@@ -30,6 +30,7 @@
 #include "sys-core.h"
 
 #define WORD_TABLE_SIZE 1024  // initial size in words
+#define WORD_TABLE_MIGRATE_SLOTS 8  // moved per interning while resizing
 
 
 //
@@ -119,20 +120,92 @@ static REBSTR PG_Deleted_Canon;
 #define DELETED_CANON &PG_Deleted_Canon
 
 
+// Put a canon in the first empty slot of its probe sequence.  Deleted slots
+// are passed over, as when rehashing (they are cleaned out by not copying
+// them to the new table).
+//
+static void Insert_Canon_Slot(REBSER *table, REBSTR *canon)
+{
+    REBLEN num_slots = SER_LEN(table);
+    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, table);
+
+    REBLEN skip;
+    REBLEN slot = First_Hash_Candidate_Slot(
+        &skip,
+        Hash_String(canon),
+        num_slots
+    );
+
+    while (canons_by_hash[slot]) { // skip occupied slots
+        slot += skip;
+        if (slot >= num_slots)
+            slot -= num_slots;
+    }
+    canons_by_hash[slot] = canon;
+}
+
+
+//
+//  Migrate_Canon_Slots: C
+//
+// While the word table is being resized, PG_Old_Canons_By_Hash is the table
+// that was outgrown.  Each interning moves a few of its slots into the new
+// table, so the cost of growing is spread out instead of one long stall.
+//
+// A canon that has been moved leaves a DELETED_CANON behind, so probes for
+// keys that collided with it still go on past its slot in the old table.
+// When the last slot has been moved the old table is freed.
+//
+static void Migrate_Canon_Slots(REBLEN count)
+{
+    REBSER *old = PG_Old_Canons_By_Hash;
+    REBLEN old_num_slots = SER_LEN(old);
+    REBSTR* *old_canons_by_hash = SER_HEAD(REBSTR*, old);
+
+    for (; count != 0; --count) {
+        if (PG_Canon_Migrate_Slot == old_num_slots)
+            break;
+
+        REBSTR* *slot = &old_canons_by_hash[PG_Canon_Migrate_Slot++];
+        REBSTR *canon = *slot;
+        if (not canon)
+            continue;
+
+        if (canon == DELETED_CANON) { // clean out any deleted canon entries
+          #if !defined(NDEBUG)
+            --PG_Num_Canon_Deleteds; // keep track for shutdown assert
+          #endif
+            continue;
+        }
+
+        Insert_Canon_Slot(PG_Canons_By_Hash, canon);
+        ++PG_Num_Canon_Slots_In_Use;
+        *slot = DELETED_CANON;  // (moved, so not counted as a deleted)
+    }
+
+    if (PG_Canon_Migrate_Slot == old_num_slots) {
+        Free_Unmanaged_Series(old);
+        PG_Old_Canons_By_Hash = nullptr;
+    }
+}
+
+
 //
 //  Expand_Word_Table: C
 //
-// Expand the hash table part of the word_table by allocating
-// the next larger table size and rehashing all the words of
-// the current table.  Free the old hash array.
+// Allocate the next larger table size for the word table, and start moving
+// the canons of the current table into it (see Migrate_Canon_Slots()).
+//
+// The new table is about twice the size of the old one, which was at most
+// half full.  Each interning moves WORD_TABLE_MIGRATE_SLOTS of the old
+// table's slots, so it's all moved well before the new one is half full.
 //
 static void Expand_Word_Table(void)
 {
-    // The only full list of canon words available is the old hash table.
-    // Hold onto it while creating the new hash table.
+    if (PG_Old_Canons_By_Hash)  // !!! shouldn't happen, but finish if so
+        Migrate_Canon_Slots(SER_LEN(PG_Old_Canons_By_Hash));
 
     REBLEN old_num_slots = SER_LEN(PG_Canons_By_Hash);
-    REBSTR* *old_canons_by_hash = SER_HEAD(REBSTR*, PG_Canons_By_Hash);
 
     REBLEN num_slots = Get_Hash_Prime_May_Fail(old_num_slots + 1);
     assert(SER_WIDE(PG_Canons_By_Hash) == sizeof(REBSTR*));
@@ -143,41 +216,69 @@ static void Expand_Word_Table(void)
     Clear_Series(ser);
     SET_SERIES_LEN(ser, num_slots);
 
-    // Rehash all the symbols:
+    PG_Old_Canons_By_Hash = PG_Canons_By_Hash;
+    PG_Canon_Migrate_Slot = 0;
 
-    REBSTR **new_canons_by_hash = SER_HEAD(REBSTR*, ser);
+    PG_Canons_By_Hash = ser;
+    PG_Num_Canon_Slots_In_Use = 0;  // counts are for the new table
+}
 
-    REBLEN old_slot;
-    for (old_slot = 0; old_slot != old_num_slots; ++old_slot) {
-        REBSTR *canon = old_canons_by_hash[old_slot];
-        if (not canon)
-            continue;
 
-        if (canon == DELETED_CANON) { // clean out any deleted canon entries
-            --PG_Num_Canon_Slots_In_Use;
-          #if !defined(NDEBUG)
-            --PG_Num_Canon_Deleteds; // keep track for shutdown assert
-          #endif
-            continue;
+// Find the canon of a spelling's synonyms in one of the word tables, or
+// nullptr.  If `vacant_out` is given, it's set to the slot where a new canon
+// for the spelling would go (the first deleted slot seen, else the empty
+// slot the probing stopped at).
+//
+static REBSTR *Probe_Canons(
+    REBSTR* **vacant_out,
+    REBSER *table,
+    uint32_t hash,
+    const REBYTE *utf8,
+    size_t size
+){
+    REBLEN num_slots = SER_LEN(table);
+    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, table);
+
+    REBLEN skip; // how many slots to skip when occupied candidates found
+    REBLEN slot = First_Hash_Candidate_Slot(&skip, hash, num_slots);
+
+    // The hash table only indexes the canon form of each spelling.  So when
+    // testing a slot to see if it's a match (or a collision that needs to
+    // be skipped to try again) the search uses a comparison that is
+    // case-insensitive...but reports if synonyms via > 0 results.
+    //
+    REBSTR* *deleted_slot = nullptr;
+    REBSTR *canon;
+    while ((canon = canons_by_hash[slot])) {
+        if (canon == DELETED_CANON) {
+            if (not deleted_slot)
+                deleted_slot = &canons_by_hash[slot];
+            goto next_candidate_slot;
         }
 
-        REBLEN skip;
-        REBLEN slot = First_Hash_Candidate_Slot(
-            &skip,
-            Hash_String(canon),
-            num_slots
-        );
+        assert(GET_SERIES_INFO(canon, STRING_CANON));
 
-        while (new_canons_by_hash[slot]) { // skip occupied slots
-            slot += skip;
-            if (slot >= num_slots)
-                slot -= num_slots;
+        // Every spelling's case-insensitive hash is stored in its symbol, so
+        // a collision with a different word is usually ruled out without
+        // comparing the UTF-8.  (Synonyms share the hash of their canon.)
+        //
+        if (
+            STR_SYMBOL_HASH(canon) == hash
+            and Compare_UTF8(STR_HEAD(canon), utf8, size) >= 0
+        ){
+            return canon;  // exact match, or an alternate casing
         }
-        new_canons_by_hash[slot] = canon;
+
+      next_candidate_slot:  // https://en.wikipedia.org/wiki/Linear_probing
+
+        slot += skip;
+        if (slot >= num_slots)
+            slot -= num_slots;
     }
 
-    Free_Unmanaged_Series(PG_Canons_By_Hash);
-    PG_Canons_By_Hash = ser;
+    if (vacant_out)
+        *vacant_out = deleted_slot ? deleted_slot : &canons_by_hash[slot];
+    return nullptr;
 }
 
 
@@ -207,82 +308,56 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
     // actually kept larger than that, but to be on the right side of theory,
     // the table is always checked for expansion needs *before* the search.)
     //
+    if (PG_Old_Canons_By_Hash)
+        Migrate_Canon_Slots(WORD_TABLE_MIGRATE_SLOTS);
+
     REBLEN num_slots = SER_LEN(PG_Canons_By_Hash);
-    if (PG_Num_Canon_Slots_In_Use > num_slots / 2) {
+    if (PG_Num_Canon_Slots_In_Use > num_slots / 2)
         Expand_Word_Table();
-        num_slots = SER_LEN(PG_Canons_By_Hash); // got larger
-    }
 
-    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, PG_Canons_By_Hash);
-
-    REBLEN skip; // how many slots to skip when occupied candidates found
-    REBLEN slot = First_Hash_Candidate_Slot(
-        &skip,
-        Hash_UTF8(utf8, size),
-        num_slots
-    );
+    uint32_t hash = cast(uint32_t, Hash_UTF8(utf8, size));  // cached in symbol
 
-    // The hash table only indexes the canon form of each spelling.  So when
-    // testing a slot to see if it's a match (or a collision that needs to
-    // be skipped to try again) the search uses a comparison that is
-    // case-insensitive...but reports if synonyms via > 0 results.
+    // A canon is in the new table or (while it's being moved) the old one.
+    // New canons only ever go in the new table.
     //
-    REBSTR **deleted_slot = nullptr;
-    REBSTR* canon;
-    while ((canon = canons_by_hash[slot])) {
-        if (canon == DELETED_CANON) {
-            deleted_slot = &canons_by_hash[slot];
-            goto next_candidate_slot;
-        }
-
-        assert(GET_SERIES_INFO(canon, STRING_CANON));
+    REBSTR* *vacant_slot;
+    REBSTR *canon = Probe_Canons(
+        &vacant_slot, PG_Canons_By_Hash, hash, utf8, size
+    );
+    if (not canon and PG_Old_Canons_By_Hash)
+        canon = Probe_Canons(
+            nullptr, PG_Old_Canons_By_Hash, hash, utf8, size
+        );
 
-      blockscope {
-        REBINT cmp = Compare_UTF8(STR_HEAD(canon), utf8, size);
-        if (cmp == 0)
-            return canon;  // was a case-sensitive match
-        if (cmp < 0)
-            goto next_candidate_slot;  // wasn't an alternate casing
-      }
-
-        // The > 0 result means that the canon word that was found is an
-        // alternate casing ("synonym") for the string we're interning.  The
-        // synonyms are attached to the canon form with a circularly linked
-        // list.  Walk the list to see if any of the synonyms are a match.
+    if (canon) {
         //
-      blockscope {
-        REBSTR *synonym = LINK_SYNONYM(canon);
-        while (synonym != canon) {
-            assert(NOT_SERIES_INFO(synonym, STRING_CANON));
-
+        // The canon word that was found is the spelling, or an alternate
+        // casing ("synonym") of it.  The synonyms are attached to the canon
+        // form with a circularly linked list.  Walk the list to see if any
+        // of them are a match.
+        //
+        REBSTR *synonym = canon;
+        do {
             REBINT cmp = Compare_UTF8(STR_HEAD(synonym), utf8, size);
             if (cmp == 0)
                 return synonym;  // exact match means no new interning
 
             assert(cmp > 0);  // at least a synonym if in this list
             synonym = LINK_SYNONYM(synonym);  // look until cycle
-        }
-      }
-
-        goto new_interning;  // no synonym matched, make new synonym for canon
-
-      next_candidate_slot:  // https://en.wikipedia.org/wiki/Linear_probing
+        } while (synonym != canon);
 
-        slot += skip;
-        if (slot >= num_slots)
-            slot -= num_slots;
+        // no synonym matched, make new synonym for canon
     }
 
-    assert(not canon);  // loop exits when it finds a vacant canon slot
-
-  new_interning:;
-
     // If possible, the allocation should be fit into a REBSER node with no
     // separate allocation.  Because automatically doing this is a new
     // feature, double check with an assert that the behavior matches.
     //
+    // The hash is stored just past the terminator (see STR_SYMBOL_HASH()), so
+    // that hashing a WORD! doesn't have to rescan its spelling.
+    //
     REBSER *s = Make_Series_Core(
-        size + 1,
+        size + 1 + sizeof(uint32_t),
         sizeof(REBYTE),
         SERIES_FLAG_IS_STRING | SERIES_FLAG_FIXED_SIZE
     );
@@ -292,6 +367,20 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
     //
     memcpy(BIN_HEAD(s), utf8, size);
     TERM_BIN_LEN(s, size);
+    memcpy(BIN_AT(s, size + 1), &hash, sizeof(uint32_t));  // may be unaligned
+
+    // Symbols cache their codepoint count like other strings do, so that
+    // STR_LEN() and the ASCII test don't have to scan an aliased spelling.
+    // (Count the bytes that aren't UTF-8 continuation bytes.)
+    //
+  blockscope {
+    REBLEN len = 0;
+    REBSIZ i;
+    for (i = 0; i < size; ++i)
+        if ((utf8[i] & 0xC0) != 0x80)
+            ++len;
+    MISC(s).length = len;
+  }
 
     // The UTF-8 series can be aliased with AS to become an ANY-STRING! or a
     // BINARY!.  If it is, then it should not be modified.
@@ -303,36 +392,23 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
 
         LINK_SYNONYM_NODE(s) = NOD(s);  // 1-item in circular list
 
-        // Canon symbols use their MISC() to hold binding information.  Long
-        // term, it may become a design that lets multiple binds run at once.
-        // So the slot could hold an atomic pointer that would "pop out" to a
-        // structure.  But for the moment only one bind runs at a time, and
-        // it's randomized to keep its information in high bits or low bits
-        // as a poor-man's demo that there is an infrastructure in place for
-        // sharing (start with 2, grow to N eventually).
-        //
-        MISC(s).bind_index.high = 0;
-        MISC(s).bind_index.low = 0;
-
         // leave header.bits as 0 for SYM_0 as answer to VAL_WORD_SYM()
         // Startup_Symbols() tags values from %words.r after the fact.
 
-        if (deleted_slot) {
-            *deleted_slot = STR(s);  // reuse the deleted slot
+        if (*vacant_slot == DELETED_CANON) {  // reuse the deleted slot
           #if !defined(NDEBUG)
             --PG_Num_Canon_Deleteds;  // note slot usage count stays constant
           #endif
         }
-        else {
-            canons_by_hash[slot] = STR(s);
+        else
             ++PG_Num_Canon_Slots_In_Use;
-        }
+
+        *vacant_slot = STR(s);
     }
     else {
         // This is a synonym for an existing canon.  Link it into the synonyms
         // circularly linked list, and direct link the canon form.
         //
-        MISC(s).length = 0;  // !!! TBD: codepoint count
         LINK_SYNONYM_NODE(s) = LINK_SYNONYM_NODE(canon);
         LINK_SYNONYM_NODE(canon) = NOD(s);
 
@@ -359,6 +435,36 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
 }
 
 
+// Find the slot holding a canon, or return false if it's not in the table.
+//
+static bool Find_Canon_Slot(
+    REBLEN *slot_out,
+    REBLEN *skip_out,
+    REBSER *table,
+    REBSTR *canon
+){
+    REBLEN num_slots = SER_LEN(table);
+    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, table);
+
+    REBLEN slot = First_Hash_Candidate_Slot(
+        skip_out,
+        Hash_String(canon),
+        num_slots
+    );
+
+    while (canons_by_hash[slot] != canon) {
+        if (not canons_by_hash[slot])
+            return false;
+        slot += *skip_out;
+        if (slot >= num_slots)
+            slot -= num_slots;
+    }
+
+    *slot_out = slot;
+    return true;
+}
+
+
 //
 //  GC_Kill_Interning: C
 //
@@ -368,6 +474,8 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
 //
 void GC_Kill_Interning(REBSTR *intern)
 {
+    ++GC_Stats.Symbols_Freed;
+
     REBSTR *synonym = LINK_SYNONYM(intern);
 
     // Note synonym and intern may be the same here.
@@ -380,27 +488,22 @@ void GC_Kill_Interning(REBSTR *intern)
     if (NOT_SERIES_INFO(intern, STRING_CANON))
         return;  // for non-canon forms, removing from chain is all you need
 
-    assert(MISC(intern).bind_index.high == 0);  // shouldn't GC during binds?
-    assert(MISC(intern).bind_index.low == 0);
-
-    REBLEN num_slots = SER_LEN(PG_Canons_By_Hash);
-    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, PG_Canons_By_Hash);
-
-    REBLEN skip;
-    REBLEN slot = First_Hash_Candidate_Slot(
-        &skip,
-        Hash_String(intern),
-        num_slots
-    );
-
-    // We *will* find the canon form in the hash table.
+    // We *will* find the canon form in the hash table, or in the old table
+    // if the word table is being resized and it hasn't been moved yet.
     //
-    while (canons_by_hash[slot] != intern) {
-        slot += skip;
-        if (slot >= num_slots)
-            slot -= num_slots;
+    REBSER *table = PG_Canons_By_Hash;
+    REBLEN slot;
+    REBLEN skip;
+    if (not Find_Canon_Slot(&slot, &skip, table, intern)) {
+        table = PG_Old_Canons_By_Hash;
+        bool found = Find_Canon_Slot(&slot, &skip, table, intern);
+        assert(found);
+        UNUSED(found);
     }
 
+    REBLEN num_slots = SER_LEN(table);
+    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, table);
+
     if (synonym != intern) {
         //
         // If there was a synonym in the circularly linked list distinct from
@@ -408,19 +511,23 @@ void GC_Kill_Interning(REBSTR *intern)
         // It should hash the same, and be able to take over the hash slot.
         //
     #ifdef SLOW_INTERN_HASH_DOUBLE_CHECK
-        assert(hash == Hash_String(synonym));
+        assert(STR_SYMBOL_HASH(synonym) == STR_SYMBOL_HASH(intern));
+        assert(
+            STR_SYMBOL_HASH(synonym)
+            == cast(uint32_t, Hash_UTF8(STR_HEAD(synonym), STR_SIZE(synonym)))
+        );
     #endif
         canons_by_hash[slot] = synonym;
         SET_SERIES_INFO(synonym, STRING_CANON);
-        MISC(synonym).bind_index.low = 0;
-        MISC(synonym).bind_index.high = 0;
     }
     else {
         // This canon form must be removed from the hash table.  Ripple the
         // collision slots back until a NULL is found, to reduce search times.
+        // (Not in the old table, where that could move a canon back past
+        // the point the migration has reached, so it would never be moved.)
         //
         REBLEN previous_slot = slot;
-        while (canons_by_hash[slot]) {
+        while (table == PG_Canons_By_Hash and canons_by_hash[slot]) {
             slot += skip;
             if (slot >= num_slots)
                 slot -= num_slots;
@@ -500,11 +607,26 @@ void Startup_Interning(void)
     n = 1; // forces exercise of rehashing logic in debug build
 #endif
 
+    // A workload that will make millions of distinct words (e.g. loading
+    // machine-generated identifiers) can say how many it expects, so that
+    // the table doesn't go through a dozen resizings on the way there.
+    //
+    const char *env_words = getenv("R3_WORD_TABLE_SIZE");
+    if (env_words) {
+        unsigned long words = strtoul(env_words, nullptr, 10);
+        REBLEN prime = cast(REBLEN, Try_Get_Hash_Prime(words * 4));
+        if (words != 0 and prime != 0 and prime > n)
+            n = prime;  // (no error reporting this early, just ignore)
+    }
+
     PG_Canons_By_Hash = Make_Series_Core(
         n, sizeof(REBSTR*), SERIES_FLAG_POWER_OF_2
     );
     Clear_Series(PG_Canons_By_Hash); // all slots start at NULL
     SET_SERIES_LEN(PG_Canons_By_Hash, n);
+
+    PG_Old_Canons_By_Hash = nullptr;  // not resizing
+    PG_Canon_Migrate_Slot = 0;
 }
 
 
@@ -600,6 +722,9 @@ void Shutdown_Symbols(void)
 //
 void Shutdown_Interning(void)
 {
+    if (PG_Old_Canons_By_Hash)  // finish any resizing, so there's one table
+        Migrate_Canon_Slots(SER_LEN(PG_Old_Canons_By_Hash));
+
   #if !defined(NDEBUG)
     if (PG_Num_Canon_Slots_In_Use - PG_Num_Canon_Deleteds != 0) {
         //
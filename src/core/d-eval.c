@@ -263,11 +263,11 @@ void Do_After_Action_Checks_Debug(REBFRM *f) {
 
     REBACT *phase = FRM_PHASE(f);
 
-  #ifdef DEBUG_UTF8_EVERYWHERE
-    if (ANY_STRING(f->out)) {
-        REBLEN len = STR_LEN(VAL_SERIES(f->out));
-        UNUSED(len); // just one invariant for now, SER_LEN checks it
-    }
+  #ifdef DEBUG_VERIFY_STR_LEN
+    if (ANY_STRING(f->out))
+        Verify_Str_Len_Debug(VAL_STRING(f->out));
+    else if (ANY_WORD(f->out))
+        Verify_Str_Len_Debug(VAL_WORD_SPELLING(f->out));
   #endif
 
     // Usermode functions check the return type via Returner_Dispatcher(),
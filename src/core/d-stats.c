@@ -28,16 +28,49 @@
 
 #include "sys-core.h"
 
+#if defined(INCLUDE_PERF_COUNTERS) && defined(TO_LINUX)
+    #include <unistd.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <linux/perf_event.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #include <x86intrin.h>
+    #define HAS_RDTSC
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define HAS_RDTSC
+#endif
+
+
+// qsort() comparator for the pause history percentiles in STATS/GC
+//
+static int Compare_Pauses(const void *a, const void *b)
+{
+    REBI64 pa = *cast(const REBI64*, a);
+    REBI64 pb = *cast(const REBI64*, b);
+    return pa < pb ? -1 : pa > pb ? 1 : 0;
+}
+
 
 //
 //  stats: native [
 //
 //  {Provides status and statistics information about the interpreter.}
 //
-//      return: [<opt> time! integer!]
+//      return: [<opt> time! integer! object! block!]
 //      /show "Print formatted results to console"
 //      /profile "Returns profiler object"
 //      /evals "Number of values evaluated by interpreter"
+//      /folds "Number of pure calls replaced by their results by FOLD"
+//      /shared-keylists "Number of objects derived using the parent's keys"
+//      /gc "Garbage collector pause and generation counters"
+//      /pools "Width, segment units, units, free, fills, allocs of each pool"
+//      /heap "Series in use by flavor, cell types, creation sites, roots"
+//      /startup "Label, microseconds, bytes, allocs of each phase of boot"
+//      /phase "Note end of a host startup phase (for /STARTUP)"
+//          [word!]
 //      /pool "Dump all series in pool"
 //          [integer!]
 //  ]
@@ -51,6 +84,149 @@ REBNATIVE(stats)
         return Init_Integer(D_OUT, n);
     }
 
+    if (REF(folds))  // available in release builds
+        return Init_Integer(D_OUT, TG_Folded_Calls);
+
+    if (REF(shared_keylists))  // available in release builds
+        return Init_Integer(D_OUT, TG_Shared_Keylists);
+
+    if (REF(phase)) {  // available in release builds
+        Note_Startup_Phase(STR_UTF8(VAL_WORD_SPELLING(ARG(phase))));
+        if (not REF(startup))
+            return nullptr;
+    }
+
+    if (REF(startup))  // available in release builds
+        return Init_Block(D_OUT, Make_Startup_Phases_Array());
+
+    if (REF(pools)) {  // available in release builds
+        REBARR *a = Make_Array(SYSTEM_POOL * 6);
+        REBLEN n;
+        for (n = 0; n < SYSTEM_POOL; ++n) {
+            REBPOL *pool = &Mem_Pools[n];
+            Init_Integer(Alloc_Tail_Array(a), pool->wide);
+            Init_Integer(Alloc_Tail_Array(a), pool->units);
+            Init_Integer(Alloc_Tail_Array(a), pool->has);
+            Init_Integer(Alloc_Tail_Array(a), pool->free);
+            Init_Integer(Alloc_Tail_Array(a), pool->fills);
+            Init_Integer(Alloc_Tail_Array(a), pool->allocs);
+        }
+        return Init_Block(D_OUT, a);
+    }
+
+    if (REF(heap)) {  // available in release builds
+        REBVAL *obj = rebValue("make object! [",
+            "flavors:",  // flavor count bytes, e.g. varlist, string, pairing
+            "types:",  // datatype count, for cells in arrays
+            "sites:",  // file line count bytes, where the arrays were made
+            "roots:",  // group count bytes, reachable from lib, api, etc.
+                "_",
+        "]", rebEND);
+
+        Move_Value(D_OUT, obj);
+        rebRelease(obj);
+
+        REBVAL *heap = VAL_CONTEXT_VAR(D_OUT, 1);
+        Init_Block(heap, Make_Heap_Flavors_Array());
+        heap++;
+        Init_Block(heap, Make_Heap_Types_Array());
+        heap++;
+        Init_Block(heap, Make_Heap_Sites_Array(20));
+        heap++;
+        Init_Block(heap, Make_Heap_Roots_Array());  // marks, so do it last
+
+        return D_OUT;
+    }
+
+    if (REF(gc)) {  // available in release builds, see REB_GC_STATS
+        REBVAL *obj = rebValue("make object! [",
+            "majors:",
+            "minors:",
+            "major-usecs:",
+            "minor-usecs:",
+            "max-major-usecs:",
+            "max-minor-usecs:",
+            "promoted:",
+            "slices:",
+            "max-slice-usecs:",
+            "live-bytes:",
+            "survival:",
+            "trigger:",
+            "released-bytes:",
+            "compacted-bytes:",
+            "mark-usecs:",
+            "sweep-usecs:",
+            "p50-usecs:",
+            "p99-usecs:",
+            "policy:",
+            "generational:",
+            "symbols-freed:",
+                "_",
+        "]", rebEND);
+
+        Move_Value(D_OUT, obj);
+        rebRelease(obj);
+
+        REBVAL *stats = VAL_CONTEXT_VAR(D_OUT, 1);
+        Init_Integer(stats, GC_Stats.Major_Count);
+        stats++;
+        Init_Integer(stats, GC_Stats.Minor_Count);
+        stats++;
+        Init_Integer(stats, GC_Stats.Major_Usecs);
+        stats++;
+        Init_Integer(stats, GC_Stats.Minor_Usecs);
+        stats++;
+        Init_Integer(stats, GC_Stats.Max_Major_Usecs);
+        stats++;
+        Init_Integer(stats, GC_Stats.Max_Minor_Usecs);
+        stats++;
+        Init_Integer(stats, GC_Stats.Promoted);
+        stats++;
+        Init_Integer(stats, GC_Stats.Slice_Count);
+        stats++;
+        Init_Integer(stats, GC_Stats.Max_Slice_Usecs);
+        stats++;
+        Init_Integer(stats, GC_Stats.Live_Bytes);
+        stats++;
+        Init_Percent(stats, GC_Stats.Survival_Percent / 100.0);
+        stats++;
+        Init_Integer(stats, GC_Stats.Trigger);
+        stats++;
+        Init_Integer(stats, GC_Stats.Released_Bytes);
+        stats++;
+        Init_Integer(stats, GC_Stats.Compacted_Bytes);
+        stats++;
+        Init_Integer(stats, GC_Stats.Mark_Usecs);
+        stats++;
+        Init_Integer(stats, GC_Stats.Sweep_Usecs);
+        stats++;
+
+        REBLEN num_pauses = MIN(GC_Stats.Pause_Count, GC_PAUSE_HISTORY);
+        if (num_pauses == 0) {
+            Init_Blank(stats);
+            stats++;
+            Init_Blank(stats);
+            stats++;
+        }
+        else {
+            REBI64 sorted[GC_PAUSE_HISTORY];
+            memcpy(sorted, GC_Stats.Pauses, num_pauses * sizeof(REBI64));
+            qsort(sorted, num_pauses, sizeof(REBI64), &Compare_Pauses);
+            Init_Integer(stats, sorted[(num_pauses - 1) / 2]);
+            stats++;
+            Init_Integer(stats, sorted[((num_pauses - 1) * 99) / 100]);
+            stats++;
+        }
+
+        Init_Word(stats, Canon(GC_Policy));
+        stats++;
+        Init_Logic(stats, GC_Generational);
+        stats++;
+        Init_Integer(stats, GC_Stats.Symbols_Freed);
+
+        return D_OUT;
+    }
+
 #ifdef NDEBUG
     UNUSED(REF(show));
     UNUSED(REF(profile));
@@ -131,14 +307,143 @@ enum {
     //
     IDX_STATS_NUMCALLS = 1,
 
-    // !!! More will be added here when timing data is included, but timing
-    // is tricky to do meaningfully while subtracting the instrumentation
-    // itself out.
+    // Series nodes allocated while the function ran, including those made by
+    // functions it called (Make_Node() count for SER_POOL, so pairings too)
+    //
+    IDX_STATS_ALLOCS = 2,
+
+    // CPU cycles, instructions retired, and cache misses while the function
+    // ran (inclusive of functions it called).  Cycles come from hardware
+    // performance counters if built with INCLUDE_PERF_COUNTERS on Linux, or
+    // else the timestamp counter.  Quantities the platform has no way of
+    // measuring are BLANK!.
+    //
+    // !!! This includes the instrumentation's own overhead in the callees.
+    //
+    IDX_STATS_CYCLES = 3,
+    IDX_STATS_INSTRUCTIONS = 4,
+    IDX_STATS_CACHE_MISSES = 5,
 
     IDX_STATS_MAX
 };
 
 
+struct Reb_Cost {
+    REBI64 cycles;
+    REBI64 instructions;
+    REBI64 cache_misses;
+};
+
+#if defined(INCLUDE_PERF_COUNTERS) && defined(TO_LINUX)
+    // The counters are opened for the calling thread, so each instance
+    // needs its own (see REB_THREAD_INSTANCES).
+    //
+    static REB_INSTANCE_VAR int Perf_Group_Fd = -1;  // group leader, or -1
+    static REB_INSTANCE_VAR int Perf_Fds[3] = {-1, -1, -1};
+
+    static int Open_Perf_Counter(uint64_t config, int group_fd) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = (group_fd == -1) ? 1 : 0;  // leader enables group
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return cast(int, syscall(
+            __NR_perf_event_open, &attr, 0, -1, group_fd, 0
+        ));
+    }
+
+    // Counting may not be permitted (see /proc/sys/kernel/perf_event_paranoid)
+    // in which case the timestamp counter is used as a fallback.
+    //
+    static void Open_Perf_Counters(void) {
+        if (Perf_Group_Fd != -1)
+            return;
+
+        Perf_Fds[0] = Open_Perf_Counter(PERF_COUNT_HW_CPU_CYCLES, -1);
+        if (Perf_Fds[0] == -1)
+            return;
+        Perf_Fds[1] = Open_Perf_Counter(
+            PERF_COUNT_HW_INSTRUCTIONS, Perf_Fds[0]
+        );
+        Perf_Fds[2] = Open_Perf_Counter(
+            PERF_COUNT_HW_CACHE_MISSES, Perf_Fds[0]
+        );
+        if (Perf_Fds[1] == -1 or Perf_Fds[2] == -1) {
+            int i;
+            for (i = 0; i < 3; ++i) {
+                if (Perf_Fds[i] != -1)
+                    close(Perf_Fds[i]);
+                Perf_Fds[i] = -1;
+            }
+            return;
+        }
+
+        Perf_Group_Fd = Perf_Fds[0];
+        ioctl(Perf_Group_Fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(Perf_Group_Fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    static void Close_Perf_Counters(void) {
+        int i;
+        for (i = 0; i < 3; ++i) {
+            if (Perf_Fds[i] != -1)
+                close(Perf_Fds[i]);
+            Perf_Fds[i] = -1;
+        }
+        Perf_Group_Fd = -1;
+    }
+#endif
+
+
+// Fills in -1 for any quantity that can't be measured.  One read() gets all
+// of the perf counters in the group at once, which is the main expense.
+//
+static void Read_Cost(struct Reb_Cost *cost)
+{
+  #if defined(INCLUDE_PERF_COUNTERS) && defined(TO_LINUX)
+    if (Perf_Group_Fd != -1) {
+        uint64_t data[1 + 3];  // PERF_FORMAT_GROUP: count, then values
+        if (read(Perf_Group_Fd, data, sizeof(data)) == sizeof(data)) {
+            cost->cycles = cast(REBI64, data[1]);
+            cost->instructions = cast(REBI64, data[2]);
+            cost->cache_misses = cast(REBI64, data[3]);
+            return;
+        }
+    }
+  #endif
+
+  #if defined(HAS_RDTSC)
+    cost->cycles = cast(REBI64, __rdtsc());
+  #else
+    cost->cycles = -1;
+  #endif
+    cost->instructions = -1;
+    cost->cache_misses = -1;
+}
+
+
+// The stats block holds BLANK! for quantities that can't be measured, and
+// otherwise accumulates into an INTEGER!.
+//
+static void Accumulate_Cost(RELVAL *slot, REBI64 before, REBI64 after)
+{
+    if (before == -1 or after == -1) {
+        if (not IS_INTEGER(slot))
+            Init_Blank(slot);
+        return;
+    }
+
+    REBI64 delta = after - before;
+    if (IS_INTEGER(slot))
+        delta += VAL_INT64(slot);
+    Init_Integer(slot, delta);
+}
+
+
 //
 //  Measured_Dispatch_Hook: C
 //
@@ -173,9 +478,19 @@ REB_R Measured_Dispatch_Hook(REBFRM * const f)
         // being studied for starters...of just counting.
     }
 
+    REBLEN allocs_before = Mem_Pools[SER_POOL].allocs;
+
+    struct Reb_Cost before;
+    Read_Cost(&before);
+
     REB_R r = Dispatch_Internal(f);
     assert(r->header.bits & NODE_FLAG_CELL);
 
+    struct Reb_Cost after;
+    Read_Cost(&after);
+
+    REBLEN allocs = Mem_Pools[SER_POOL].allocs - allocs_before;  // wraps ok
+
     if (is_last_phase) {
         //
         // Finalize the inclusive time if it's the last phase.  Timing info
@@ -202,6 +517,23 @@ REB_R Measured_Dispatch_Hook(REBFRM * const f)
             else
                 Init_Blank(ARR_AT(a, IDX_STATS_SYMBOL));
             Init_Integer(ARR_AT(a, IDX_STATS_NUMCALLS), 1);
+            Init_Integer(ARR_AT(a, IDX_STATS_ALLOCS), allocs);
+            Init_Blank(ARR_AT(a, IDX_STATS_CYCLES));
+            Init_Blank(ARR_AT(a, IDX_STATS_INSTRUCTIONS));
+            Init_Blank(ARR_AT(a, IDX_STATS_CACHE_MISSES));
+            Accumulate_Cost(
+                ARR_AT(a, IDX_STATS_CYCLES), before.cycles, after.cycles
+            );
+            Accumulate_Cost(
+                ARR_AT(a, IDX_STATS_INSTRUCTIONS),
+                before.instructions,
+                after.instructions
+            );
+            Accumulate_Cost(
+                ARR_AT(a, IDX_STATS_CACHE_MISSES),
+                before.cache_misses,
+                after.cache_misses
+            );
             TERM_ARRAY_LEN(a, IDX_STATS_MAX);
 
             DECLARE_LOCAL (stats);
@@ -230,7 +562,22 @@ REB_R Measured_Dispatch_Hook(REBFRM * const f)
                     || IS_BLANK(ARR_AT(a, IDX_STATS_SYMBOL))
                 )
                 && IS_INTEGER(ARR_AT(a, IDX_STATS_NUMCALLS))
+                && IS_INTEGER(ARR_AT(a, IDX_STATS_ALLOCS))
             ){
+                Accumulate_Cost(
+                    ARR_AT(a, IDX_STATS_CYCLES), before.cycles, after.cycles
+                );
+                Accumulate_Cost(
+                    ARR_AT(a, IDX_STATS_INSTRUCTIONS),
+                    before.instructions,
+                    after.instructions
+                );
+                Accumulate_Cost(
+                    ARR_AT(a, IDX_STATS_CACHE_MISSES),
+                    before.cache_misses,
+                    after.cache_misses
+                );
+
                 if (
                     IS_BLANK(ARR_AT(a, IDX_STATS_SYMBOL))
                     && f->opt_label != NULL
@@ -241,6 +588,10 @@ REB_R Measured_Dispatch_Hook(REBFRM * const f)
                     ARR_AT(a, IDX_STATS_NUMCALLS),
                     VAL_INT64(ARR_AT(a, IDX_STATS_NUMCALLS)) + 1
                 );
+                Init_Integer(
+                    ARR_AT(a, IDX_STATS_ALLOCS),
+                    VAL_INT64(ARR_AT(a, IDX_STATS_ALLOCS)) + allocs
+                );
             }
             else if (not IS_ERROR(stats)) {
                 //
@@ -290,7 +641,7 @@ REB_R Measured_Dispatch_Hook(REBFRM * const f)
 //
 //  metrics: native [
 //
-//  {Track function calls and inclusive timings for those calls.}
+//  {Track function calls, with series allocated and CPU cost inclusively}
 //
 //      return: [map!]
 //      mode [logic!]
@@ -310,15 +661,405 @@ REBNATIVE(metrics)
     // the user could do about that.  And it just contaminates the timing they
     // are interested in, which is how long their functions take.
 
-    if (VAL_LOGIC(mode))
+    if (VAL_LOGIC(mode)) {
+      #if defined(INCLUDE_PERF_COUNTERS) && defined(TO_LINUX)
+        Open_Perf_Counters();
+      #endif
         PG_Dispatch = &Measured_Dispatch_Hook;
-    else
+    }
+    else {
         PG_Dispatch = &Dispatch_Internal;
+      #if defined(INCLUDE_PERF_COUNTERS) && defined(TO_LINUX)
+        Close_Perf_Counters();
+      #endif
+    }
 
     return Root_Stats_Map;
 }
 
 
+//
+//  Sample_Frame_Stack: C
+//
+// Record the running actions as a line in "folded stack" form, outermost
+// first and separated by semicolons, e.g. `main;foo (%x.r:10);bar (%x.r:3)`.
+// The file and line are of the callsite.  This is the input format taken by
+// flame graph tools like flamegraph.pl, once a count is added to each line.
+//
+// Unlike METRICS, nothing is done on each dispatch.  The cost is paid only
+// when Do_Signals_Throws() runs and a sample is taken.
+//
+void Sample_Frame_Stack(void)
+{
+    REBFRM *stack[SAMPLE_MAX_DEPTH];
+    REBLEN depth = 0;
+    REBLEN skip = 0;
+
+    REBFRM *f = FS_TOP;
+    for (; f != FS_BOTTOM; f = f->prior) {
+        if (Is_Action_Frame(f))
+            ++skip;
+    }
+    if (skip > SAMPLE_MAX_DEPTH)
+        skip -= SAMPLE_MAX_DEPTH;  // drop the innermost
+    else
+        skip = 0;
+
+    for (f = FS_TOP; f != FS_BOTTOM; f = f->prior) {
+        if (not Is_Action_Frame(f))
+            continue;
+        if (skip != 0) {
+            --skip;
+            continue;
+        }
+        stack[depth++] = f;
+    }
+
+    if (depth == 0)
+        return;  // not inside any action, nothing to attribute time to
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    while (depth != 0) {
+        f = stack[--depth];
+        if (f->opt_label)
+            Append_Spelling(mo->series, f->opt_label);
+        else
+            Append_Ascii(mo->series, "~anonymous~");
+
+        REBSTR *file = FRM_FILE(f);
+        if (file) {
+            Append_Ascii(mo->series, " (");
+            Append_Spelling(mo->series, file);
+            Append_Codepoint(mo->series, ':');
+            Append_Int(mo->series, FRM_LINE(f));
+            Append_Codepoint(mo->series, ')');
+        }
+
+        if (depth != 0)
+            Append_Codepoint(mo->series, ';');
+    }
+
+    REBARR *ring = VAL_ARRAY(Root_Samples);
+    if (TG_Sample_Next == ARR_LEN(ring))
+        Init_Text(Alloc_Tail_Array(ring), Pop_Molded_String(mo));
+    else {
+        Note_Series_Mutation(SER(ring));  // ring is old, the text is new
+        Init_Text(ARR_AT(ring, TG_Sample_Next), Pop_Molded_String(mo));
+    }
+
+    TG_Sample_Next = (TG_Sample_Next + 1) % SAMPLE_RING_SIZE;
+}
+
+
+// qsort() comparator to bring identical folded stacks together in SAMPLER
+//
+static int Compare_Samples(const void *a, const void *b)
+{
+    return Compare_String_Vals(
+        cast(const REBVAL*, a),
+        cast(const REBVAL*, b),
+        false  // case matters
+    );
+}
+
+
+//
+//  sampler: native [
+//
+//  {Sampling profiler, recording the running actions at a regular interval}
+//
+//      return: "When stopping, folded stacks with counts (for flamegraph.pl)"
+//          [<opt> text!]
+//      mode "Start (dropping any prior samples) or stop"
+//          [logic!]
+//      /every "Evaluation steps between samples (default is the EVAL dose)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(sampler)
+//
+// Only the most recent SAMPLE_RING_SIZE samples are kept.  A host which
+// wants samples by time instead of by evaluation count can call rebSample()
+// from a timer signal, in which case /EVERY can be used to make the
+// evaluation-count samples infrequent.
+{
+    INCLUDE_PARAMS_OF_SAMPLER;
+
+    Check_Security_Placeholder(Canon(SYM_DEBUG), SYM_READ, 0);
+
+    REBARR *ring = VAL_ARRAY(Root_Samples);
+
+    if (VAL_LOGIC(ARG(mode))) {
+        if (not TG_Sampling)
+            TG_Sampling_Saved_Dose = Eval_Dose;
+
+        if (REF(every)) {
+            REBINT every = VAL_INT32(ARG(every));
+            if (every <= 0)
+                fail (PAR(every));
+            Eval_Dose = every;
+        }
+        else
+            Eval_Dose = TG_Sampling_Saved_Dose;
+        Eval_Count = Eval_Dose;
+
+        TERM_ARRAY_LEN(ring, 0);
+        TG_Sample_Next = 0;
+        TG_Sampling = true;
+        return nullptr;
+    }
+
+    if (REF(every))
+        fail ("SAMPLER/EVERY only applies when starting the sampler");
+
+    if (not TG_Sampling)
+        return nullptr;
+
+    TG_Sampling = false;
+    Eval_Dose = TG_Sampling_Saved_Dose;
+    if (Eval_Count > cast(int_fast32_t, Eval_Dose))
+        Eval_Count = Eval_Dose;
+
+    REBLEN len = ARR_LEN(ring);
+    qsort(ARR_HEAD(ring), len, sizeof(REBVAL), &Compare_Samples);
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    REBLEN n = 0;
+    while (n < len) {
+        RELVAL *sample = ARR_AT(ring, n);
+        REBLEN count = 1;
+        while (
+            n + count < len
+            and 0 == Compare_String_Vals(sample, ARR_AT(ring, n + count), false)
+        ){
+            ++count;
+        }
+
+        Append_String(mo->series, sample, VAL_LEN_AT(sample));
+        Append_Codepoint(mo->series, ' ');
+        Append_Int(mo->series, count);
+        Append_Codepoint(mo->series, '\n');
+
+        n += count;
+    }
+
+    TERM_ARRAY_LEN(ring, 0);
+    TG_Sample_Next = 0;
+
+    return Init_Text(D_OUT, Pop_Molded_String(mo));
+}
+
+
+// Slot in TG_Hotspots where the array and index are counted, or the unused
+// slot where they would go.  (The table is never full, see REB_HOTSPOT.)
+//
+static REBLEN Find_Hotspot_Slot(REBARR *a, REBLEN index)
+{
+    REBLEN mask = TG_Hotspots_Size - 1;
+    uintptr_t h = cast(uintptr_t, a) >> 4;
+    h ^= index * 2654435761u;  // spread nearby indices of one array apart
+
+    REBLEN slot = cast(REBLEN, h) & mask;
+    while (
+        TG_Hotspots[slot].array
+        and (TG_Hotspots[slot].array != a or TG_Hotspots[slot].index != index)
+    ){
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+
+// Move the counts into a table of `size` slots, with a new Root_Hotspots
+// array to hold their arrays.  (No GC can run between the swap of the
+// roots and the arrays being put back in, as nothing is evaluated.)
+//
+static void Resize_Hotspots(REBLEN size)
+{
+    REB_HOTSPOT *old = TG_Hotspots;
+    REBLEN old_size = TG_Hotspots_Size;
+
+    REBARR *arrays = Make_Array(size);
+    REBLEN n;
+    for (n = 0; n < size; ++n)
+        Init_Blank(Alloc_Tail_Array(arrays));
+
+    TG_Hotspots = cast(REB_HOTSPOT*, Alloc_Mem(sizeof(REB_HOTSPOT) * size));
+    CLEAR(TG_Hotspots, sizeof(REB_HOTSPOT) * size);
+    TG_Hotspots_Size = size;
+
+    for (n = 0; n < old_size; ++n) {
+        if (not old[n].array)
+            continue;
+        REBLEN slot = Find_Hotspot_Slot(old[n].array, old[n].index);
+        TG_Hotspots[slot] = old[n];
+        Init_Block(ARR_AT(arrays, slot), old[n].array);
+    }
+    Init_Block(Root_Hotspots, arrays);
+
+    if (old)
+        Free_Mem(old, sizeof(REB_HOTSPOT) * old_size);
+}
+
+
+//
+//  Count_Eval_Step: C
+//
+// Called by Step_Hooks_Throws() at the start of each expression while
+// HOTSPOTS is on.
+//
+void Count_Eval_Step(REBFRM *f)
+{
+    if (FRM_IS_VALIST(f) or not f->feed->array)
+        return;  // no position to count against, e.g. code in rebValue()
+
+    REBARR *a = f->feed->array;
+    if (NOT_SERIES_FLAG(a, MANAGED))
+        return;  // can't be held by Root_Hotspots, its owner will free it
+
+    REBLEN index = FRM_EXPR_INDEX(f);
+    REBLEN slot = Find_Hotspot_Slot(a, index);
+    if (TG_Hotspots[slot].array) {
+        ++TG_Hotspots[slot].count;
+        return;
+    }
+
+    if (2 * (TG_Hotspots_Used + 1) > TG_Hotspots_Size) {
+        Resize_Hotspots(2 * TG_Hotspots_Size);
+        slot = Find_Hotspot_Slot(a, index);
+    }
+
+    TG_Hotspots[slot].array = a;
+    TG_Hotspots[slot].index = index;
+    TG_Hotspots[slot].count = 1;
+    ++TG_Hotspots_Used;
+    Note_Series_Mutation(SER(VAL_ARRAY(Root_Hotspots)));  // `a` may be newer
+    Init_Block(ARR_AT(VAL_ARRAY(Root_Hotspots), slot), a);
+}
+
+
+// qsort() comparator putting the most counted positions first in HOTSPOTS
+//
+static int Compare_Hotspots(const void *a, const void *b)
+{
+    REBI64 count_a = cast(const REB_HOTSPOT*, a)->count;
+    REBI64 count_b = cast(const REB_HOTSPOT*, b)->count;
+    if (count_a > count_b)
+        return -1;
+    return count_a < count_b ? 1 : 0;
+}
+
+
+//
+//  hotspots: native [
+//
+//  {Count evaluation steps by the source position of each expression}
+//
+//      return: "When stopping, [count file line near ...] busiest first"
+//          [<opt> block!]
+//      mode "Start (dropping any prior counts) or stop"
+//          [logic!]
+//      /top "Most positions to report (default 20)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(hotspots)
+//
+// Unlike SAMPLER, every step is counted, so the counts are exact.  Steps of
+// arrays that were never managed (internal temporaries) and of C va_lists
+// aren't counted.  FILE and LINE are of the array holding the expression,
+// as used in error messages, and are blank if it has none.  NEAR is the
+// start of the expression, molded.  Since the arrays are held until the
+// counting stops, this can keep a lot of garbage alive in a long run.
+//
+// `r3 --hotspots script.r` counts for the whole run and prints the report
+// on exit.
+{
+    INCLUDE_PARAMS_OF_HOTSPOTS;
+
+    Check_Security_Placeholder(Canon(SYM_DEBUG), SYM_READ, 0);
+
+    if (VAL_LOGIC(ARG(mode))) {
+        if (REF(top))
+            fail ("HOTSPOTS/TOP only applies when stopping the counting");
+
+        if (TG_Hotspots) {
+            Free_Mem(TG_Hotspots, sizeof(REB_HOTSPOT) * TG_Hotspots_Size);
+            TG_Hotspots = nullptr;
+            TG_Hotspots_Size = 0;
+        }
+        TG_Hotspots_Used = 0;
+        Resize_Hotspots(HOTSPOTS_MIN_SIZE);
+
+        TG_Counting_Steps = true;
+        Update_Step_Hooks();
+        return nullptr;
+    }
+
+    if (not TG_Counting_Steps)
+        return nullptr;
+
+    TG_Counting_Steps = false;
+    Update_Step_Hooks();
+
+    REBLEN top = 20;
+    if (REF(top)) {
+        REBINT n = VAL_INT32(ARG(top));
+        if (n < 0)
+            fail (PAR(top));
+        top = n;
+    }
+    if (top > TG_Hotspots_Used)
+        top = TG_Hotspots_Used;
+
+    // Sorting scrambles the slots, but Root_Hotspots still holds the arrays.
+    //
+    qsort(
+        TG_Hotspots, TG_Hotspots_Size, sizeof(REB_HOTSPOT), &Compare_Hotspots
+    );
+
+    REBARR *report = Make_Array(4 * top);
+
+    REBLEN n;
+    for (n = 0; n < top; ++n) {
+        REB_HOTSPOT *h = &TG_Hotspots[n];
+        Init_Integer(Alloc_Tail_Array(report), h->count);
+
+        if (GET_ARRAY_FLAG(h->array, HAS_FILE_LINE_UNMASKED)) {
+            Init_File(Alloc_Tail_Array(report), LINK_FILE(h->array));
+            Init_Integer(Alloc_Tail_Array(report), MISC(h->array).line);
+        }
+        else {
+            Init_Blank(Alloc_Tail_Array(report));
+            Init_Blank(Alloc_Tail_Array(report));
+        }
+
+        if (h->index >= ARR_LEN(h->array))
+            Init_Blank(Alloc_Tail_Array(report));  // array shrank since
+        else {
+            DECLARE_MOLD (mo);
+            SET_MOLD_FLAG(mo, MOLD_FLAG_LIMIT);
+            mo->limit = 40;
+            Push_Mold(mo);
+            Mold_Value(mo, ARR_AT(h->array, h->index));
+            Init_Text(Alloc_Tail_Array(report), Pop_Molded_String(mo));
+        }
+    }
+
+    Free_Mem(TG_Hotspots, sizeof(REB_HOTSPOT) * TG_Hotspots_Size);
+    TG_Hotspots = nullptr;
+    TG_Hotspots_Size = 0;
+    TG_Hotspots_Used = 0;
+    Init_Blank(Root_Hotspots);
+
+    return Init_Block(D_OUT, report);
+}
+
+
 #if defined(INCLUDE_CALLGRIND_NATIVE)
     #include <valgrind/callgrind.h>
 #endif
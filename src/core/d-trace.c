@@ -422,6 +422,142 @@ REB_R Traced_Dispatch_Hook(REBFRM * const f)
 }
 
 
+//=//// BREAKPOINTS /////////////////////////////////////////////////////=//
+//
+// A debugger could break at a position by swapping in an evaluator hook that
+// checks every step, as TRACE does.  But then all code pays for the check,
+// which makes it impractical to leave a debugger attached to a long-running
+// process.  Instead, the positions are kept in Root_Breakpoints and their
+// arrays get ARRAY_FLAG_HAS_BREAKPOINTS.  The evaluator only calls in here
+// if TG_Step_Hooks is set, and the list is only searched at expressions in
+// an array with the flag.
+//
+// What to do on reaching a breakpoint is up to PG_Breakpoint_Hook_Throws,
+// which the debugger extension sets.  Breakpoints are kept by index, so one
+// stays at the same index if the array is changed.
+//
+
+//
+//  Update_Step_Hooks: C
+//
+// Recalculate TG_Step_Hooks after HOTSPOTS or the breakpoints change.
+//
+void Update_Step_Hooks(void)
+{
+    TG_Step_Hooks = TG_Counting_Steps or (
+        PG_Breakpoint_Hook_Throws != nullptr
+        and ARR_LEN(VAL_ARRAY(Root_Breakpoints)) != 0
+    );
+}
+
+
+//
+//  Set_Breakpoint_Hook: C
+//
+void Set_Breakpoint_Hook(REBEVL *hook)
+{
+    PG_Breakpoint_Hook_Throws = hook;
+    Update_Step_Hooks();
+}
+
+
+// Index of the breakpoint in Root_Breakpoints, or -1 if there isn't one.
+//
+static REBINT Find_Breakpoint(REBARR *a, REBLEN index)
+{
+    REBARR *list = VAL_ARRAY(Root_Breakpoints);
+    REBINT n;
+    for (n = 0; n < cast(REBINT, ARR_LEN(list)); ++n) {
+        RELVAL *item = ARR_AT(list, n);
+        if (VAL_ARRAY(item) == a and VAL_INDEX(item) == index)
+            return n;
+    }
+    return -1;
+}
+
+
+//
+//  Add_Breakpoint: C
+//
+// Break before the expression starting at `index` in `a`.  Returns false if
+// there was already a breakpoint there.
+//
+bool Add_Breakpoint(REBARR *a, REBLEN index)
+{
+    if (GET_ARRAY_FLAG(a, HAS_BREAKPOINTS) and Find_Breakpoint(a, index) >= 0)
+        return false;
+
+    REBARR *list = VAL_ARRAY(Root_Breakpoints);
+    Note_Series_Mutation(SER(list));
+    Init_Any_Array_At(Alloc_Tail_Array(list), REB_BLOCK, a, index);
+
+    SET_ARRAY_FLAG(a, HAS_BREAKPOINTS);
+    Update_Step_Hooks();
+    return true;
+}
+
+
+//
+//  Remove_Breakpoint: C
+//
+// Returns false if there wasn't a breakpoint at the position.
+//
+bool Remove_Breakpoint(REBARR *a, REBLEN index)
+{
+    if (NOT_ARRAY_FLAG(a, HAS_BREAKPOINTS))
+        return false;
+
+    REBINT n = Find_Breakpoint(a, index);
+    if (n < 0)
+        return false;
+
+    REBARR *list = VAL_ARRAY(Root_Breakpoints);
+    Note_Series_Mutation(SER(list));
+    Remove_Series_Units(SER(list), n, 1);
+
+    // Only take the flag off if no other breakpoints are in the array.
+    //
+    RELVAL *item = ARR_HEAD(list);
+    for (; NOT_END(item); ++item) {
+        if (VAL_ARRAY(item) == a)
+            break;
+    }
+    if (IS_END(item))
+        CLEAR_ARRAY_FLAG(a, HAS_BREAKPOINTS);
+
+    Update_Step_Hooks();
+    return true;
+}
+
+
+//
+//  Step_Hooks_Throws: C
+//
+// Called by the evaluator at the start of each expression while HOTSPOTS is
+// on or there are breakpoints.  When neither, the only cost is the test of
+// TG_Step_Hooks.
+//
+bool Step_Hooks_Throws(REBFRM *f)
+{
+    if (TG_Counting_Steps)
+        Count_Eval_Step(f);
+
+    if (FRM_IS_VALIST(f) or not f->feed->array)
+        return false;  // no position, e.g. code in rebValue()
+
+    if (NOT_ARRAY_FLAG(f->feed->array, HAS_BREAKPOINTS))
+        return false;
+
+    if (not PG_Breakpoint_Hook_Throws)
+        return false;
+
+    if (Find_Breakpoint(f->feed->array, FRM_EXPR_INDEX(f)) < 0)
+        return false;
+
+    return (*PG_Breakpoint_Hook_Throws)(f);
+}
+
+
 //
 //  trace: native [
 //
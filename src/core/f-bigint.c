@@ -0,0 +1,700 @@
+//
+//  File: %f-bigint.c
+//  Summary: "arbitrary precision INTEGER! arithmetic"
+//  Section: functional
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// An INTEGER! is a plain 64-bit number in its cell unless the value doesn't
+// fit.  ADD, SUBTRACT, MULTIPLY etc. check for overflow the same way they
+// always did, but instead of failing they call into this file to work out
+// the answer with 32-bit "limbs", and the result goes into a series:
+//
+// * The cell has CELL_FLAG_FIRST_IS_NODE, with the series as its node.  The
+//   series holds the magnitude, least significant limb first, with no
+//   leading zero limbs.  It is never modified once made, so cells can share
+//   it.  MISC(s).negated is the sign (as with bitsets).
+//
+// * A value is only ever big if it can't be represented in 64 bits, so
+//   small and big integers are never equal.  Any result that fits is turned
+//   back into an ordinary integer.
+//
+// * VAL_INT64() of a big integer raises an overflow error, so code that has
+//   no business with such numbers (indices, counts...) acts as it did when
+//   the arithmetic producing them raised the error instead.
+//
+// Multiplication switches from the schoolbook method to Karatsuba's above
+// BIG_KARATSUBA_MIN limbs, and division is Knuth's Algorithm D.
+//
+
+#include "sys-core.h"
+
+#define BIG_KARATSUBA_MIN 32  // fewer limbs than this, schoolbook is faster
+
+
+// Lets small and big integers be handled the same way, as limbs.  Note that
+// `limbs` may point into the view itself, so it can't be copied.
+//
+struct Reb_Big_View {
+    const uint32_t *limbs;
+    REBLEN len;
+    bool negative;
+    uint32_t small[2];
+};
+
+static void Init_Big_View(struct Reb_Big_View *v, const REBCEL *cell)
+{
+    assert(CELL_KIND(cell) == REB_INTEGER);
+
+    if (IS_INTEGER_BIG(cell)) {
+        REBSER *s = SER(PAYLOAD(Any, cell).first.node);
+        v->limbs = SER_HEAD(uint32_t, s);
+        v->len = SER_LEN(s);
+        v->negative = MISC(s).negated;
+        return;
+    }
+
+    REBI64 i = PAYLOAD(Integer, cell).i64;
+    REBU64 u = i < 0 ? cast(REBU64, 0) - cast(REBU64, i) : cast(REBU64, i);
+    v->small[0] = cast(uint32_t, u);
+    v->small[1] = cast(uint32_t, u >> 32);
+    v->len = v->small[1] != 0 ? 2 : v->small[0] != 0 ? 1 : 0;
+    v->negative = (i < 0);
+    v->limbs = v->small;
+}
+
+
+static REBLEN Trim_Limbs(const uint32_t *a, REBLEN n) {
+    while (n > 0 and a[n - 1] == 0)
+        --n;
+    return n;
+}
+
+
+//
+//  Init_Integer_Limbs: C
+//
+// Make an INTEGER! from a magnitude and sign, a plain 64-bit one if it fits.
+//
+REBVAL *Init_Integer_Limbs(
+    RELVAL *out,
+    const uint32_t *limbs,
+    REBLEN len,
+    bool negative
+){
+    len = Trim_Limbs(limbs, len);
+
+    if (len <= 2) {
+        REBU64 u = len == 0 ? 0 : limbs[0];
+        if (len == 2)
+            u |= cast(REBU64, limbs[1]) << 32;
+        if (not negative and u <= cast(REBU64, INT64_MAX))
+            return Init_Integer(out, cast(REBI64, u));
+        if (negative and u <= cast(REBU64, INT64_MAX) + 1)
+            return Init_Integer(out, cast(REBI64, cast(REBU64, 0) - u));
+    }
+
+    REBSER *s = Make_Series(len, sizeof(uint32_t));
+    memcpy(SER_DATA_RAW(s), limbs, len * sizeof(uint32_t));
+    SET_SERIES_LEN(s, len);
+    MISC(s).negated = negative;
+    Manage_Series(s);
+
+    RESET_CELL(out, REB_INTEGER, CELL_FLAG_FIRST_IS_NODE);
+    INIT_VAL_NODE(out, s);
+    return KNOWN(out);
+}
+
+
+//=//// MAGNITUDES ////////////////////////////////////////////////////////=//
+//
+// These work on arrays of limbs which may have leading zero limbs.  Outputs
+// never overlap inputs.
+//
+
+static int Mag_Compare(
+    const uint32_t *a, REBLEN an,
+    const uint32_t *b, REBLEN bn
+){
+    an = Trim_Limbs(a, an);
+    bn = Trim_Limbs(b, bn);
+    if (an != bn)
+        return an < bn ? -1 : 1;
+    while (an-- > 0) {
+        if (a[an] != b[an])
+            return a[an] < b[an] ? -1 : 1;
+    }
+    return 0;
+}
+
+
+// Add b into the n limbs at `a` (n >= bn), returning the final carry.
+//
+static uint32_t Mag_Add_Into(
+    uint32_t *a, REBLEN n,
+    const uint32_t *b, REBLEN bn
+){
+    REBU64 carry = 0;
+    REBLEN i;
+    for (i = 0; i < bn; ++i) {
+        carry += cast(REBU64, a[i]) + b[i];
+        a[i] = cast(uint32_t, carry);
+        carry >>= 32;
+    }
+    for (; carry != 0 and i < n; ++i) {
+        carry += a[i];
+        a[i] = cast(uint32_t, carry);
+        carry >>= 32;
+    }
+    return cast(uint32_t, carry);
+}
+
+
+// Subtract b from the n limbs at `a` (which must be at least as big).
+//
+static void Mag_Sub_From(
+    uint32_t *a, REBLEN n,
+    const uint32_t *b, REBLEN bn
+){
+    REBI64 borrow = 0;
+    REBLEN i;
+    for (i = 0; i < bn; ++i) {
+        borrow += cast(REBI64, a[i]) - b[i];
+        a[i] = cast(uint32_t, borrow);
+        borrow >>= 32;  // arithmetic shift, 0 or -1
+    }
+    for (; borrow != 0 and i < n; ++i) {
+        borrow += a[i];
+        a[i] = cast(uint32_t, borrow);
+        borrow >>= 32;
+    }
+    assert(borrow == 0);
+}
+
+
+static void Mag_Mul_Schoolbook(
+    uint32_t *out,  // an + bn limbs
+    const uint32_t *a, REBLEN an,
+    const uint32_t *b, REBLEN bn
+){
+    memset(out, 0, (an + bn) * sizeof(uint32_t));
+
+    REBLEN i;
+    for (i = 0; i < an; ++i) {
+        REBU64 carry = 0;
+        REBU64 ai = a[i];
+        if (ai == 0)
+            continue;
+        REBLEN j;
+        for (j = 0; j < bn; ++j) {
+            carry += ai * b[j] + out[i + j];  // can't overflow 64 bits
+            out[i + j] = cast(uint32_t, carry);
+            carry >>= 32;
+        }
+        out[i + bn] = cast(uint32_t, carry);
+    }
+}
+
+
+//
+//  Mag_Multiply: C
+//
+// Karatsuba splits a = a1 * B^m + a0 and b = b1 * B^m + b0, and gets the
+// middle term of the product from (a0 + a1) * (b0 + b1) - a0*b0 - a1*b1,
+// for three half-size multiplications instead of four.
+//
+static void Mag_Multiply(
+    uint32_t *out,  // an + bn limbs
+    const uint32_t *a, REBLEN an,
+    const uint32_t *b, REBLEN bn
+){
+    if (an < bn) {
+        const uint32_t *t = a;
+        a = b;
+        b = t;
+        REBLEN tn = an;
+        an = bn;
+        bn = tn;
+    }
+
+    if (bn < BIG_KARATSUBA_MIN) {
+        Mag_Mul_Schoolbook(out, a, an, b, bn);
+        return;
+    }
+
+    REBLEN size = an + bn;
+
+    if (2 * bn <= an) {  // lopsided, multiply b by bn-limb slices of a
+        memset(out, 0, size * sizeof(uint32_t));
+        uint32_t *part = ALLOC_N(uint32_t, 2 * bn);
+        REBLEN i;
+        for (i = 0; i < an; i += bn) {
+            REBLEN n = MIN(bn, an - i);
+            Mag_Multiply(part, a + i, n, b, bn);
+            Mag_Add_Into(out + i, size - i, part, n + bn);
+        }
+        FREE_N(uint32_t, 2 * bn, part);
+        return;
+    }
+
+    REBLEN m = an / 2;  // bn > m, so both halves of b are nonempty
+    const uint32_t *a0 = a;
+    const uint32_t *a1 = a + m;
+    const uint32_t *b0 = b;
+    const uint32_t *b1 = b + m;
+    REBLEN a1n = an - m;
+    REBLEN b1n = bn - m;
+
+    Mag_Multiply(out, a0, m, b0, m);  // z0 in out[0, 2m)
+    Mag_Multiply(out + 2 * m, a1, a1n, b1, b1n);  // z2 in out[2m, size)
+
+    REBLEN sn = a1n + 1;  // a1n >= b1n, and a1n >= m
+    uint32_t *sums = ALLOC_N(uint32_t, 2 * sn + 2 * sn);
+    uint32_t *sa = sums;
+    uint32_t *sb = sums + sn;
+    uint32_t *z1 = sums + 2 * sn;
+
+    memset(sa, 0, 2 * sn * sizeof(uint32_t));
+    memcpy(sa, a1, a1n * sizeof(uint32_t));
+    Mag_Add_Into(sa, sn, a0, m);
+    memcpy(sb, b1, b1n * sizeof(uint32_t));
+    Mag_Add_Into(sb, sn, b0, m);
+
+    Mag_Multiply(z1, sa, sn, sb, sn);  // (a0 + a1) * (b0 + b1)
+    Mag_Sub_From(z1, 2 * sn, out, 2 * m);  // - z0
+    Mag_Sub_From(z1, 2 * sn, out + 2 * m, size - 2 * m);  // - z2
+
+    Mag_Add_Into(out + m, size - m, z1, Trim_Limbs(z1, 2 * sn));
+
+    FREE_N(uint32_t, 2 * sn + 2 * sn, sums);
+}
+
+
+// Divide by one limb in place, returning the remainder.
+//
+static uint32_t Mag_Divide_Small(uint32_t *a, REBLEN an, uint32_t d)
+{
+    REBU64 rem = 0;
+    while (an-- > 0) {
+        REBU64 cur = (rem << 32) | a[an];
+        a[an] = cast(uint32_t, cur / d);
+        rem = cur % d;
+    }
+    return cast(uint32_t, rem);
+}
+
+
+static int Leading_Zeros_32(uint32_t x) {
+    int n = 0;
+    assert(x != 0);
+    while (not (x & 0x80000000)) {
+        x <<= 1;
+        ++n;
+    }
+    return n;
+}
+
+
+//
+//  Mag_Divide: C
+//
+// Knuth's Algorithm D (TAOCP Vol 2, 4.3.1).  Both operands are normalized
+// (shifted so the divisor's top bit is set) and each quotient limb is
+// estimated from the top two limbs of the remainder, then corrected.
+//
+static void Mag_Divide(
+    uint32_t *q,  // an - bn + 1 limbs, or nullptr
+    uint32_t *r,  // bn limbs, or nullptr
+    const uint32_t *a, REBLEN an,
+    const uint32_t *b, REBLEN bn  // bn >= 2, no leading zero limbs
+){
+    assert(bn >= 2 and b[bn - 1] != 0 and an >= bn);
+
+    int shift = Leading_Zeros_32(b[bn - 1]);
+
+    uint32_t *work = ALLOC_N(uint32_t, (an + 1) + bn);
+    uint32_t *u = work;  // an + 1 limbs
+    uint32_t *v = work + an + 1;  // bn limbs
+
+    REBLEN i;
+    for (i = bn - 1; i > 0; --i)
+        v[i] = (b[i] << shift) | (shift ? b[i - 1] >> (32 - shift) : 0);
+    v[0] = b[0] << shift;
+
+    u[an] = shift ? a[an - 1] >> (32 - shift) : 0;
+    for (i = an - 1; i > 0; --i)
+        u[i] = (a[i] << shift) | (shift ? a[i - 1] >> (32 - shift) : 0);
+    u[0] = a[0] << shift;
+
+    REBLEN j = an - bn + 1;
+    while (j-- > 0) {
+        REBU64 num = (cast(REBU64, u[j + bn]) << 32) | u[j + bn - 1];
+        REBU64 qhat = num / v[bn - 1];
+        REBU64 rhat = num % v[bn - 1];
+        while (
+            qhat > 0xFFFFFFFF
+            or qhat * v[bn - 2] > ((rhat << 32) | u[j + bn - 2])
+        ){
+            --qhat;
+            rhat += v[bn - 1];
+            if (rhat > 0xFFFFFFFF)
+                break;
+        }
+
+        REBI64 borrow = 0;  // u[j .. j + bn] -= qhat * v
+        REBU64 carry = 0;
+        for (i = 0; i < bn; ++i) {
+            REBU64 p = qhat * v[i] + carry;
+            carry = p >> 32;
+            borrow += cast(REBI64, u[i + j]) - cast(uint32_t, p);
+            u[i + j] = cast(uint32_t, borrow);
+            borrow >>= 32;
+        }
+        borrow += cast(REBI64, u[j + bn]) - cast(REBI64, carry);
+        u[j + bn] = cast(uint32_t, borrow);
+
+        if (borrow < 0) {  // qhat was one too big (rare), add v back
+            --qhat;
+            REBU64 c = 0;
+            for (i = 0; i < bn; ++i) {
+                c += cast(REBU64, u[i + j]) + v[i];
+                u[i + j] = cast(uint32_t, c);
+                c >>= 32;
+            }
+            u[j + bn] += cast(uint32_t, c);
+        }
+
+        if (q)
+            q[j] = cast(uint32_t, qhat);
+    }
+
+    if (r) {  // un-normalize the remainder
+        for (i = 0; i < bn - 1; ++i)
+            r[i] = (u[i] >> shift) | (shift ? u[i + 1] << (32 - shift) : 0);
+        r[bn - 1] = u[bn - 1] >> shift;
+    }
+
+    FREE_N(uint32_t, (an + 1) + bn, work);
+}
+
+
+//=//// INTEGER! OPERATIONS ///////////////////////////////////////////////=//
+//
+// These take INTEGER! cells which may be big or not.
+//
+
+//
+//  Big_Add: C
+//
+REBVAL *Big_Add(
+    RELVAL *out,
+    const REBCEL *a,
+    const REBCEL *b,
+    bool subtract
+){
+    struct Reb_Big_View x;
+    struct Reb_Big_View y;
+    Init_Big_View(&x, a);
+    Init_Big_View(&y, b);
+    bool y_negative = subtract ? not y.negative : y.negative;
+
+    REBLEN n = MAX(x.len, y.len) + 1;
+    uint32_t *sum = ALLOC_N_ZEROFILL(uint32_t, n);
+
+    bool negative;
+    if (x.negative == y_negative) {  // magnitudes add, sign is shared
+        memcpy(sum, x.limbs, x.len * sizeof(uint32_t));
+        Mag_Add_Into(sum, n, y.limbs, y.len);
+        negative = x.negative;
+    }
+    else if (Mag_Compare(x.limbs, x.len, y.limbs, y.len) >= 0) {
+        memcpy(sum, x.limbs, x.len * sizeof(uint32_t));
+        Mag_Sub_From(sum, n, y.limbs, y.len);
+        negative = x.negative;
+    }
+    else {
+        memcpy(sum, y.limbs, y.len * sizeof(uint32_t));
+        Mag_Sub_From(sum, n, x.limbs, x.len);
+        negative = y_negative;
+    }
+
+    Init_Integer_Limbs(out, sum, n, negative);
+    FREE_N(uint32_t, n, sum);
+    return KNOWN(out);
+}
+
+
+//
+//  Big_Multiply: C
+//
+REBVAL *Big_Multiply(RELVAL *out, const REBCEL *a, const REBCEL *b)
+{
+    struct Reb_Big_View x;
+    struct Reb_Big_View y;
+    Init_Big_View(&x, a);
+    Init_Big_View(&y, b);
+
+    if (x.len == 0 or y.len == 0)
+        return Init_Integer(out, 0);
+
+    REBLEN n = x.len + y.len;
+    uint32_t *product = ALLOC_N(uint32_t, n);
+    Mag_Multiply(product, x.limbs, x.len, y.limbs, y.len);
+
+    Init_Integer_Limbs(out, product, n, x.negative != y.negative);
+    FREE_N(uint32_t, n, product);
+    return KNOWN(out);
+}
+
+
+//
+//  Big_Divide: C
+//
+// Truncating division, as C does it: the quotient rounds toward zero and
+// the remainder has the sign of the dividend.  Either output may be nullptr.
+//
+void Big_Divide(
+    RELVAL *quotient_out,
+    RELVAL *remainder_out,
+    const REBCEL *a,
+    const REBCEL *b
+){
+    struct Reb_Big_View x;
+    struct Reb_Big_View y;
+    Init_Big_View(&x, a);
+    Init_Big_View(&y, b);
+
+    if (y.len == 0)
+        fail (Error_Zero_Divide_Raw());
+
+    if (Mag_Compare(x.limbs, x.len, y.limbs, y.len) < 0) {  // |a| < |b|
+        if (quotient_out)
+            Init_Integer(quotient_out, 0);
+        if (remainder_out)
+            Init_Integer_Limbs(remainder_out, x.limbs, x.len, x.negative);
+        return;
+    }
+
+    REBLEN qn = x.len - y.len + 1;
+    uint32_t *q = ALLOC_N(uint32_t, qn + y.len);
+    uint32_t *r = q + qn;
+
+    if (y.len == 1) {
+        memcpy(q, x.limbs, x.len * sizeof(uint32_t));  // qn == x.len
+        r[0] = Mag_Divide_Small(q, x.len, y.limbs[0]);
+    }
+    else
+        Mag_Divide(q, r, x.limbs, x.len, y.limbs, y.len);
+
+    if (quotient_out)
+        Init_Integer_Limbs(quotient_out, q, qn, x.negative != y.negative);
+    if (remainder_out)
+        Init_Integer_Limbs(remainder_out, r, y.len, x.negative);
+
+    FREE_N(uint32_t, qn + y.len, q);
+}
+
+
+//
+//  Big_Negate: C
+//
+REBVAL *Big_Negate(RELVAL *out, const REBCEL *a)
+{
+    struct Reb_Big_View x;
+    Init_Big_View(&x, a);
+    return Init_Integer_Limbs(out, x.limbs, x.len, not x.negative);
+}
+
+
+//
+//  Big_Compare: C
+//
+// Returns -1, 0 or 1 as a is less than, equal to or greater than b.
+//
+REBINT Big_Compare(const REBCEL *a, const REBCEL *b)
+{
+    struct Reb_Big_View x;
+    struct Reb_Big_View y;
+    Init_Big_View(&x, a);
+    Init_Big_View(&y, b);
+
+    if (x.negative != y.negative)
+        return x.negative ? -1 : 1;
+
+    int mag = Mag_Compare(x.limbs, x.len, y.limbs, y.len);
+    return x.negative ? -mag : mag;
+}
+
+
+//
+//  Big_Is_Negative: C
+//
+bool Big_Is_Negative(const REBCEL *a)
+{
+    if (not IS_INTEGER_BIG(a))
+        return PAYLOAD(Integer, a).i64 < 0;
+    return MISC(SER(PAYLOAD(Any, a).first.node)).negated;
+}
+
+
+//
+//  Big_Is_Odd: C
+//
+bool Big_Is_Odd(const REBCEL *a)
+{
+    struct Reb_Big_View x;
+    Init_Big_View(&x, a);
+    return x.len != 0 and (x.limbs[0] & 1);
+}
+
+
+//
+//  Integer_To_Decimal: C
+//
+// The nearest DECIMAL! to an INTEGER!, big or not (may be infinite).
+//
+REBDEC Integer_To_Decimal(const REBCEL *a)
+{
+    if (not IS_INTEGER_BIG(a))
+        return cast(REBDEC, PAYLOAD(Integer, a).i64);
+
+    struct Reb_Big_View x;
+    Init_Big_View(&x, a);
+
+    REBDEC d = 0;
+    REBLEN i = x.len;
+    while (i-- > 0)
+        d = d * 4294967296.0 + x.limbs[i];
+    return x.negative ? -d : d;
+}
+
+
+//
+//  Hash_Big_Integer: C
+//
+uint32_t Hash_Big_Integer(const REBCEL *a)
+{
+    struct Reb_Big_View x;
+    Init_Big_View(&x, a);
+
+    uint32_t hash = x.negative ? 0x9E3779B9 : 0;
+    REBLEN i;
+    for (i = 0; i < x.len; ++i)
+        hash = (hash ^ x.limbs[i]) * 0x01000193;  // FNV-1a style mixing
+    return hash;
+}
+
+
+//
+//  Mold_Big_Integer: C
+//
+// Peel off nine decimal digits at a time with single-limb division.
+//
+void Mold_Big_Integer(REB_MOLD *mo, const REBCEL *a)
+{
+    struct Reb_Big_View x;
+    Init_Big_View(&x, a);
+
+    uint32_t *work = ALLOC_N(uint32_t, x.len);
+    memcpy(work, x.limbs, x.len * sizeof(uint32_t));
+
+    REBLEN max_chunks = (x.len * 32) / 29 + 1;  // 10^9 > 2^29
+    uint32_t *chunks = ALLOC_N(uint32_t, max_chunks);
+    REBLEN num_chunks = 0;
+
+    REBLEN n = x.len;
+    while (n > 0) {
+        assert(num_chunks < max_chunks);
+        chunks[num_chunks++] = Mag_Divide_Small(work, n, 1000000000);
+        n = Trim_Limbs(work, n);
+    }
+
+    if (x.negative)
+        Append_Codepoint(mo->series, '-');
+
+    bool leading = true;  // the first chunk isn't padded with zeros
+    while (num_chunks-- > 0) {
+        char buf[10];
+        uint32_t chunk = chunks[num_chunks];
+        int i;
+        for (i = 8; i >= 0; --i) {
+            buf[i] = '0' + chunk % 10;
+            chunk /= 10;
+        }
+        buf[9] = '\0';
+
+        const char *digits = buf;
+        if (leading) {
+            while (*digits == '0' and digits[1] != '\0')
+                ++digits;
+            leading = false;
+        }
+        Append_Ascii(mo->series, digits);
+    }
+
+    FREE_N(uint32_t, max_chunks, chunks);
+    FREE_N(uint32_t, x.len, work);
+}
+
+
+//
+//  Scan_Big_Integer: C
+//
+// Make an INTEGER! from a string of decimal digits (no signs or separators)
+// too long for 64 bits.  Nine digits are multiplied in at a time.
+//
+REBVAL *Scan_Big_Integer(
+    RELVAL *out,
+    const REBYTE *digits,
+    REBLEN len,
+    bool negative
+){
+    REBLEN n = len / 9 + 2;  // each chunk of 9 digits adds at most one limb
+    uint32_t *limbs = ALLOC_N_ZEROFILL(uint32_t, n);
+
+    REBLEN used = 0;
+    while (len > 0) {
+        REBLEN take = len % 9 == 0 ? 9 : len % 9;  // first chunk is short
+        uint32_t chunk = 0;
+        uint32_t scale = 1;
+        REBLEN k;
+        for (k = 0; k < take; ++k) {
+            assert(digits[k] >= '0' and digits[k] <= '9');
+            chunk = chunk * 10 + (digits[k] - '0');
+            scale *= 10;
+        }
+        digits += take;
+        len -= take;
+
+        REBU64 carry = chunk;  // limbs = limbs * scale + chunk
+        REBLEN i;
+        for (i = 0; i < used; ++i) {
+            carry += cast(REBU64, limbs[i]) * scale;
+            limbs[i] = cast(uint32_t, carry);
+            carry >>= 32;
+        }
+        if (carry != 0) {
+            assert(used < n);
+            limbs[used++] = cast(uint32_t, carry);
+        }
+    }
+
+    Init_Integer_Limbs(out, limbs, used, negative);
+    FREE_N(uint32_t, n, limbs);
+    return KNOWN(out);
+}
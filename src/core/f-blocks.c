@@ -149,6 +149,20 @@ void Clonify(
     //
     assert(not (deep_types & FLAGIT_KIND(REB_ACTION)));
 
+    // Most cells in a deep copy are not copied themselves (words, numbers,
+    // etc.)  Handle unquoted ones without the dequoting and requoting.
+    //
+    REBYTE kind_byte = KIND_BYTE_UNCHECKED(v);
+    if (
+        kind_byte < REB_64
+        and kind_byte != REB_QUOTED
+        and not (deep_types & FLAGIT_KIND(kind_byte) & TS_SERIES_OBJ)
+    ){
+        if (NOT_CELL_FLAG(v, EXPLICITLY_MUTABLE))
+            v->header.bits |= (flags & ARRAY_FLAG_CONST_SHALLOW);
+        return;
+    }
+
     // !!! It may be possible to do this faster/better, the impacts on higher
     // quoting levels could be incurring more cost than necessary...but for
     // now err on the side of correctness.  Unescape the value while cloning
@@ -173,6 +187,39 @@ void Clonify(
             series = SER(CTX_VARLIST(VAL_CONTEXT(v)));
         }
         else {
+            if (
+                IS_SER_ARRAY(VAL_SERIES(v))
+                and (deep_types & FLAGIT_KIND(kind) & TS_ARRAYS_OBJ)
+            ){
+                // Copy and clonify the cells in one pass, instead of making
+                // a shallow copy and then walking it again.
+                //
+                REBARR *original = VAL_ARRAY(v);
+                REBSPC *specifier = VAL_SPECIFIER(v);
+                REBLEN len = ARR_LEN(original);
+                REBARR *copy = Make_Array_For_Copy(
+                    len,
+                    NODE_FLAG_MANAGED,
+                    original
+                );
+
+                RELVAL *src = ARR_HEAD(original);
+                RELVAL *dest = ARR_HEAD(copy);
+                REBLEN n;
+                for (n = 0; n < len; ++n, ++src, ++dest) {
+                    Derelativize(dest, src, specifier);
+                    Clonify(KNOWN(dest), flags, deep_types);
+                }
+
+                TERM_ARRAY_LEN(copy, len);
+
+                INIT_VAL_NODE(v, copy);
+                INIT_BINDING(v, UNBOUND);  // copy was made with specifier
+
+                Quotify(v, num_quotes);
+                return;
+            }
+
             if (IS_SER_ARRAY(VAL_SERIES(v))) {
                 series = SER(
                     Copy_Array_At_Extra_Shallow(
@@ -401,8 +401,21 @@ inline static void make_comparable(
         *ea = *eb;
         return;
     }
-    shift1 = max_shift_left (a) + 1;
     shift = *ea - *eb;
+
+    /*
+        if a * 10 ** shift stays below 1e27 the complete shift fits and b
+        needs no truncation; testing against a table entry is much cheaper
+        than the double logarithm in max_shift_left (), and it is the usual
+        case when mixing amounts like $1 and $1.25
+    */
+    if ((shift <= 26) && (m_cmp (3, a, P[27 - shift]) < 0)) {
+        dsl (3, a, shift);
+        *ea = *eb;
+        return;
+    }
+
+    shift1 = max_shift_left (a) + 1;
     dsl (3, a, shift1 = shift1 < shift ? shift1 : shift);
     *ea -= shift1;
 
@@ -423,6 +436,13 @@ inline static void make_comparable(
 bool deci_is_equal(deci a, deci b) {
     int32_t ea = a.e, eb = b.e, ta, tb;
 
+    /* equal exponents compare without any shifting or rounding */
+    if (a.e == b.e) {
+        if ((a.m0 != b.m0) || (a.m1 != b.m1) || (a.m2 != b.m2))
+            return false;
+        return (a.s == b.s) or deci_is_zero(a);
+    }
+
     // Must be compile-time const for '= {...}' style init (-Wc99-extensions)
     uint32_t sa[4];
     uint32_t sb[4];
@@ -471,6 +491,12 @@ bool deci_is_lesser_or_equal(deci a, deci b) {
     if (!a.s && b.s)
         return m_is_zero(3, sa) and m_is_zero(3, sb);
 
+    if (a.e == b.e) {
+        if (a.s)
+            return m_cmp (3, sa, sb) >= 0;
+        return m_cmp (3, sa, sb) <= 0;
+    }
+
     make_comparable (sa, &ea, &ta, sb, &eb, &tb);
 
     /* round */
@@ -488,6 +514,35 @@ deci deci_add(deci a, deci b) {
     uint32_t sc[4];
     int32_t ea = a.e, eb = b.e, ta, tb, tc, test;
 
+    /*
+        equal exponents with significands below 2 ** 64 (about 1.8e19) are
+        the common case for ledger amounts; the exact result is below 1e26,
+        so no normalization or rounding is needed;
+        using 64-bit arithmetic;
+    */
+    if ((a.e == b.e) && (a.m2 == 0) && (b.m2 == 0)) {
+        REBU64 la = ((REBU64) a.m1 << 32) | a.m0;
+        REBU64 lb = ((REBU64) b.m1 << 32) | b.m0;
+        REBU64 lc;
+        c.e = a.e;
+        if (a.s == b.s) {
+            c.s = a.s;
+            lc = la + lb;
+            c.m2 = (lc < la) ? 1 : 0;
+        } else if (la >= lb) {
+            c.s = a.s;
+            lc = la - lb;
+            c.m2 = 0;
+        } else {
+            c.s = b.s;
+            lc = lb - la;
+            c.m2 = 0;
+        }
+        c.m0 = MASK32(lc);
+        c.m1 = (uint32_t) (lc >> 32);
+        return c;
+    }
+
     // Must be compile-time const for '= {...}' style init (-Wc99-extensions)
     uint32_t sa[4];
     uint32_t sb[4];
@@ -975,7 +1030,7 @@ deci deci_half_floor(deci a, deci b) {
 deci deci_multiply(const deci a, const deci b) {
     deci c;
     uint32_t sc[7];
-    int32_t shift, tc = 0, e, f = 0;
+    int32_t shift, tc = 0, e, f = 0, na, nb;
 
     // Must be compile-time const for '= {...}' style init (-Wc99-extensions)
     uint32_t sa[3];
@@ -992,8 +1047,14 @@ deci deci_multiply(const deci a, const deci b) {
     /* compute the sign */
     c.s = (!a.s && b.s) || (a.s && !b.s);
 
-    /* multiply sa by sb yielding "double significand" sc */
-    m_multiply (sc, 3, sa, 3, sb);
+    /*
+        multiply sa by sb yielding "double significand" sc; leading zero
+        limbs are skipped, so amounts below 2 ** 32 take a single product
+    */
+    na = sa[2] ? 3 : (sa[1] ? 2 : 1);
+    nb = sb[2] ? 3 : (sb[1] ? 2 : 1);
+    m_multiply (sc, na, sa, nb, sb);
+    memset (sc + na + nb, 0, (6 - na - nb) * sizeof (uint32_t));
 
     /* normalize "double significand" sc and round if needed */
     shift = min_shift_right (sc);
@@ -26,6 +26,25 @@
 
 #define IEEE_8087  // We define using floating point as on most PCs
 
+// This file doesn't include %sys-core.h.  When REB_THREAD_INSTANCES gives
+// each thread its own interpreter, the Bigint freelists and private memory
+// pool get made per-thread here, instead of using dtoa's MULTIPLE_THREADS
+// option (which needs locks and thread numbering from the client).
+//
+#if defined(REB_THREAD_INSTANCES)
+    #if defined(__cplusplus) && __cplusplus >= 201103L
+        #define DTOA_THREAD_LOCAL thread_local
+    #elif defined(_MSC_VER)
+        #define DTOA_THREAD_LOCAL __declspec(thread)
+    #elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+        #define DTOA_THREAD_LOCAL _Thread_local
+    #else
+        #define DTOA_THREAD_LOCAL __thread
+    #endif
+#else
+    #define DTOA_THREAD_LOCAL
+#endif
+
 
 /****************************************************************
  *
@@ -297,7 +316,8 @@ extern void *REALLOC(void*,size_t);
 #define PRIVATE_MEM 2304
 #endif
 #define PRIVATE_mem ((PRIVATE_MEM+sizeof(double)-1)/sizeof(double))
-static double private_mem[PRIVATE_mem], *pmem_next = private_mem;
+static DTOA_THREAD_LOCAL double private_mem[PRIVATE_mem];
+static DTOA_THREAD_LOCAL double *pmem_next;  /* Rebol: null means private_mem */
 #endif
 
 #undef IEEE_Arith
@@ -1554,7 +1574,7 @@ ThInfo {
     Bigint *P5s;
     } ThInfo;
 
- static ThInfo TI0;
+ static DTOA_THREAD_LOCAL ThInfo TI0;
 
 #ifdef MULTIPLE_THREADS
  static ThInfo *TI1;
@@ -1630,6 +1650,8 @@ Balloc(int k MTd)
 #else
         len = (sizeof(Bigint) + (x-1)*sizeof(ULong) + sizeof(double) - 1)
             /sizeof(double);
+        if (!pmem_next)  /* Rebol: can't be statically set if thread-local */
+            pmem_next = private_mem;
         if (k <= Kmax && pmem_next - private_mem + len <= PRIVATE_mem
 #ifdef MULTIPLE_THREADS
             && TI == TI1
@@ -425,10 +425,16 @@ REBNATIVE(unload_extension)
 // if the information were not used immediately or it otherwise was not run.
 // This has to be considered in the unloading mechanics.
 //
+// An extension whose script header has `Options: [lazy]` also gets the
+// specs of its exported natives as plain UTF-8, so boot can make LAZY stubs
+// for them without decompressing or scanning anything else.  (An empty
+// string means the extension is loaded eagerly.)
+//
 REBVAL *rebCollateExtension_internal(
     const REBYTE script_compressed[], REBLEN script_compressed_len,
     const REBYTE specs_compressed[], REBLEN specs_compressed_len,
-    REBNAT dispatchers[], REBLEN dispatchers_len
+    REBNAT dispatchers[], REBLEN dispatchers_len,
+    const REBYTE lazy_exports[]
 ) {
 
     REBARR *a = Make_Array(IDX_COLLATOR_MAX); // details
@@ -447,6 +453,13 @@ REBVAL *rebCollateExtension_internal(
         dispatchers,
         dispatchers_len
     );
+    if (lazy_exports[0] == '\0')
+        Init_Blank(ARR_AT(a, IDX_COLLATOR_LAZY));
+    else
+        Init_Text(
+            ARR_AT(a, IDX_COLLATOR_LAZY),
+            Make_String_UTF8(cs_cast(lazy_exports))
+        );
     TERM_ARRAY_LEN(a, IDX_COLLATOR_MAX);
 
     return Init_Block(Alloc_Value(), a);
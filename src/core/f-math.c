@@ -96,6 +96,21 @@ const REBYTE *Grab_Int_Scale(const REBYTE *cp, REBINT *val, REBLEN scale)
 }
 
 
+// "00" through "99", so integers can be formed two digits per division.
+//
+static const char Digit_Pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+
 //
 //  Form_Int_Len: C
 //
@@ -110,12 +125,6 @@ const REBYTE *Grab_Int_Scale(const REBYTE *cp, REBINT *val, REBLEN scale)
 //
 REBINT Form_Int_Len(REBYTE *buf, REBI64 val, REBINT maxl)
 {
-    REBYTE tmp[MAX_NUM_LEN];
-    REBYTE *tp = tmp;
-    REBI64 n;
-    REBI64 r;
-    REBINT len = 0;
-
     // defaults for problem cases
     buf[0] = '?';
     buf[1] = 0;
@@ -128,37 +137,36 @@ REBINT Form_Int_Len(REBYTE *buf, REBI64 val, REBINT maxl)
         return 1;
     }
 
-#define MIN_I64_STR "-9223372036854775808"
-    if (val == INT64_MIN) {
-        len = strlen(MIN_I64_STR);
-        if (maxl < len + 1) return 0;
-        memcpy(buf, MIN_I64_STR, len + 1);
-        return len;
+    // Negating in unsigned arithmetic is well-defined even for INT64_MIN.
+    //
+    bool neg = (val < 0);
+    REBU64 u = neg ? (cast(REBU64, 0) - cast(REBU64, val)) : cast(REBU64, val);
+
+    // Generate digits backwards from the end of tmp, two at a time:
+    REBYTE tmp[MAX_INT_LEN];
+    REBYTE *tp = tmp + MAX_INT_LEN;
+    while (u >= 100) {
+        REBLEN r = cast(REBLEN, u % 100);
+        u /= 100;
+        tp -= 2;
+        memcpy(tp, Digit_Pairs + (r * 2), 2);
     }
-
-    if (val < 0) {
-        val = -val;
-        *buf++ = '-';
-        maxl--;
-        len = 1;
+    if (u >= 10) {
+        tp -= 2;
+        memcpy(tp, Digit_Pairs + (u * 2), 2);
     }
+    else
+        *--tp = cast(REBYTE, '0' + u);
 
-    // Generate string in reverse:
-    *tp++ = 0;
-    while (val != 0 && maxl > 0 && tp < tmp + MAX_NUM_LEN) {
-        n = val / 10;   // not using ldiv for easier compatibility
-        r = val % 10;
-        *tp++ = (REBYTE)('0' + (REBYTE)(r));
-        val = n;
-        maxl --;
-    }
-    tp--;
-
-    if (maxl == 0) {
+    REBINT digits = (tmp + MAX_INT_LEN) - tp;
+    REBINT len = neg ? digits + 1 : digits;
+    if (len >= maxl)
         return 0;
-    }
 
-    while ((*buf++ = *tp--)) len++;
+    if (neg)
+        *buf++ = '-';
+    memcpy(buf, tp, digits);
+    buf[digits] = 0;
     return len;
 }
 
@@ -259,7 +267,30 @@ REBINT Emit_Decimal(
     if (decimal_digits < MIN_DIGITS) decimal_digits = MIN_DIGITS;
     else if (decimal_digits > MAX_DIGITS) decimal_digits = MAX_DIGITS;
 
-    sig = (REBYTE *) dtoa (d, 0, decimal_digits, &e, &sgn, (char **) &rve);
+    // Whole numbers below 2^53 are common (e.g. 100.0) and every integer in
+    // that range is exactly representable.  So no shorter digit string can
+    // round-trip to them, and their digits are what dtoa() would give back
+    // (trailing zeros dropped, E counting the integer digits).
+    //
+    REBYTE whole[MAX_DIGITS + 1];
+    if (d != 0 and fabs(d) < 9007199254740992.0 and d == floor(d)) {
+        REBU64 u = cast(REBU64, fabs(d));
+        sig = whole + sizeof(whole);
+        e = 0;
+        do {
+            *--sig = cast(REBYTE, '0' + u % 10);
+            u /= 10;
+            ++e;
+        } while (u != 0);
+
+        rve = whole + sizeof(whole);
+        while (rve[-1] == '0')
+            --rve;
+
+        sgn = (d < 0) ? 1 : 0;
+    }
+    else
+        sig = (REBYTE *) dtoa (d, 0, decimal_digits, &e, &sgn, (char **) &rve);
 
     digits_obtained = rve - sig;
 
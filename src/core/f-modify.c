@@ -367,6 +367,18 @@ REBLEN Modify_String_Or_Binary(
                 REBSIZ bytes_left = src_size_raw;
                 const REBYTE *bp = src_ptr;
                 for (; bytes_left > 0; --bytes_left, ++bp) {
+                    const REBYTE *run_end = Skip_Ascii_Run(bp, bp + bytes_left);
+                    REBLEN run = run_end - bp;
+                    if (run > limit - src_len_raw)  // /PART in codepoints
+                        run = limit - src_len_raw;
+                    if (run != 0) {  // count ASCII runs all at once
+                        src_len_raw += run;
+                        bytes_left -= run;
+                        bp += run;
+                        if (bytes_left == 0 or limit == src_len_raw)
+                            break;
+                    }
+
                     REBUNI c = *bp;
                     if (c >= 0x80) {
                         bp = Back_Scan_UTF8_Char(&c, bp, &bytes_left);
@@ -499,10 +511,6 @@ REBLEN Modify_String_Or_Binary(
         src_len_total = src_len_raw * dups;
     }
 
-    REBBMK *bookmark = nullptr;
-    if (IS_SER_STRING(dst_ser))
-        bookmark = LINK(dst_ser).bookmarks;
-
     // For strings, we should have generated a bookmark in the process of this
     // modification in most cases where the size is notable.  If we had not,
     // we might add a new bookmark pertinent to the end of the insertion for
@@ -513,9 +521,12 @@ REBLEN Modify_String_Or_Binary(
         SET_SERIES_USED(dst_ser, dst_used + src_size_total);
 
         if (IS_SER_STRING(dst_ser)) {
-            if (bookmark and BMK_INDEX(bookmark) > dst_idx)  // only INSERT
-                BMK_OFFSET(bookmark) += src_size_total;
             MISC(dst_ser).length = dst_len_old + src_len_total;
+            Adjust_Bookmarks(  // only INSERT has bookmarks past dst_idx
+                STR(dst_ser), dst_idx, dst_off,
+                0, 0,
+                src_len_total, src_size_total
+            );
         }
     }
     else {  // CHANGE only expands if more content added than overwritten
@@ -592,16 +603,16 @@ REBLEN Modify_String_Or_Binary(
         }
 
         // CHANGE can do arbitrary changes to what index maps to what offset
-        // in the region of interest.  The manipulations here would be
-        // complicated--but just assume that the start of the change is as
-        // good a cache as any to be relevant for the next operation.
+        // in the region of interest, so bookmarks inside it are moved to the
+        // start of the change.  Those after it just slide by the difference.
         //
         if (IS_SER_STRING(dst_ser)) {
-            if (bookmark and BMK_INDEX(bookmark) > dst_idx) {
-                BMK_INDEX(bookmark) = dst_idx;
-                BMK_OFFSET(bookmark) = dst_off;
-            }
             MISC(dst_ser).length = dst_len_old + src_len_total - part;
+            Adjust_Bookmarks(
+                STR(dst_ser), dst_idx, dst_off,
+                part, part_size,
+                src_len_total, src_size_total
+            );
         }
     }
 
@@ -627,20 +638,10 @@ REBLEN Modify_String_Or_Binary(
     // !!! Should BYTE_BUF's memory be reclaimed also (or should it be
     // unified with the mold buffer?)
 
-    if (bookmark) {
-        if (BMK_INDEX(bookmark) > STR_LEN(STR(dst_ser))) {  // past active
-            assert(sym == SYM_CHANGE);  // only change removes material
-            Free_Bookmarks_Maybe_Null(STR(dst_ser));
-        }
-        else {
-          #if defined(DEBUG_BOOKMARKS_ON_MODIFY)
-            Check_Bookmarks_Debug(dst_ser);
-          #endif
-
-            if (STR_LEN(STR(dst_ser)) < sizeof(REBVAL))  // not kept if small
-                Free_Bookmarks_Maybe_Null(STR(dst_ser));
-        }
-    }
+  #if defined(DEBUG_BOOKMARKS_ON_MODIFY)
+    if (IS_SER_STRING(dst_ser))
+        Check_Bookmarks_Debug(STR(dst_ser));
+  #endif
 
     ASSERT_SERIES_TERM(dst_ser);
     return (sym == SYM_APPEND) ? 0 : dst_idx + src_len_total;
@@ -50,7 +50,7 @@
 #define MM ((REBI64)1<<62)                  /* the modulus, 2^62 */
 #define mod_diff(x,y) (((x)-(y))&(MM-1))    /* subtraction mod MM */
 
-static REBI64 ran_x[KK];                    /* the generator state */
+static REB_INSTANCE_VAR REBI64 ran_x[KK];  /* the generator state */
 
 void ran_array(REBI64 aa[], int n)
 {
@@ -62,20 +62,17 @@ void ran_array(REBI64 aa[], int n)
 }
 
 /* the following routines are from exercise 3.6--15 */
-/* after calling Set_Random, get new randoms by, e.g., "x=ran_arr_next()" */
+/* after calling Set_Knuth_Random, get new randoms by, e.g., "x=ran_arr_next()" */
 
 #define QUALITY 1009 /* recommended quality level for high-res use */
-static REBI64 ran_arr_buf[QUALITY];
-static REBI64 ran_arr_dummy=-1, ran_arr_started=-1;
-static REBI64 *ran_arr_ptr=&ran_arr_dummy;  /* the next random number, or -1 */
+static REB_INSTANCE_VAR REBI64 ran_arr_buf[QUALITY];
+static REBI64 ran_arr_dummy=-1, ran_arr_started=-1;  /* never written */
+static REB_INSTANCE_VAR REBI64 *ran_arr_ptr=&ran_arr_dummy;  /* the next random number, or -1 */
 
 #define TT  70      /* guaranteed separation between streams */
 #define is_odd(x)   ((x)&1)         /* units bit of x */
 
-//
-//  Set_Random: C
-//
-void Set_Random(REBI64 seed)
+static void Set_Knuth_Random(REBI64 seed)
 {
     int t,j;
     REBI64 x[KK+KK-1];                  /* the preparation buffer */
@@ -107,40 +104,335 @@ void Set_Random(REBI64 seed)
 static REBI64 ran_arr_cycle(void)
 {
     if (ran_arr_ptr==&ran_arr_dummy)
-        Set_Random(314159L); /* the user forgot to initialize */
+        Set_Knuth_Random(314159L); /* the user forgot to initialize */
     ran_array(ran_arr_buf,QUALITY);
     ran_arr_buf[KK]=-1;
     ran_arr_ptr=ran_arr_buf+1;
     return ran_arr_buf[0];
 }
 
+
+//=//// XOSHIRO256** AND PCG64 ////////////////////////////////////////////=//
 //
-//  Random_Int: C
+// Knuth's generator above remains the default, so that a RANDOM/SEED gives
+// the same sequences it always has.  RANDOM-GENERATOR can switch to one of
+// these, which produce a full 64 bits per step from a few registers of
+// state and are much faster for simulations drawing many numbers:
 //
-// Return random integer. Secure uses SHA1 for better safety.
+//   http://prng.di.unimi.it/ (xoshiro256**)
+//   http://www.pcg-random.org/ (PCG64, the 128-bit state XSL-RR variant)
 //
-REBI64 Random_Int(bool secure)
+// Both are seeded by expanding the 64-bit seed with SplitMix64.  Like the
+// Knuth state, all of this is per interpreter instance (REB_INSTANCE_VAR).
+//
+
+static REB_INSTANCE_VAR REBSYM random_generator = SYM_KNUTH;
+static REB_INSTANCE_VAR REBI64 random_seed;
+
+static REB_INSTANCE_VAR REBU64 xoshiro_s[4];
+
+static REB_INSTANCE_VAR REBU64 pcg_hi;  // 128-bit state, high half
+static REB_INSTANCE_VAR REBU64 pcg_lo;
+
+#define PCG_MULT_HI 0x2360ED051FC65DA4ULL
+#define PCG_MULT_LO 0x4385DF649FCCF645ULL
+#define PCG_INC_HI 0x5851F42D4C957F2DULL
+#define PCG_INC_LO 0x14057B7EF767814FULL
+
+inline static REBU64 Rotl64(REBU64 x, int k)
+  { return (x << k) | (x >> (64 - k)); }
+
+inline static REBU64 Rotr64(REBU64 x, unsigned int k)
+  { return (x >> k) | (x << ((64 - k) & 63)); }
+
+inline static REBU64 Split_Mix_64(REBU64 *x) {
+    REBU64 z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+inline static REBU64 Xoshiro_Next(void) {
+    REBU64 *s = xoshiro_s;
+    REBU64 result = Rotl64(s[1] * 5, 7) * 9;
+    REBU64 t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = Rotl64(s[3], 45);
+    return result;
+}
+
+// 64x64 => 128 bit multiply
+//
+inline static REBU64 Mul_64_128(REBU64 a, REBU64 b, REBU64 *hi) {
+  #if defined(__SIZEOF_INT128__)
+    __uint128_t r = cast(__uint128_t, a) * b;
+    *hi = cast(REBU64, r >> 64);
+    return cast(REBU64, r);
+  #else
+    REBU64 al = cast(uint32_t, a), ah = a >> 32;
+    REBU64 bl = cast(uint32_t, b), bh = b >> 32;
+    REBU64 ll = al * bl;
+    REBU64 lh = al * bh;
+    REBU64 hl = ah * bl;
+    REBU64 mid = (ll >> 32) + cast(uint32_t, lh) + cast(uint32_t, hl);
+    *hi = ah * bh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return (mid << 32) | cast(uint32_t, ll);
+  #endif
+}
+
+inline static void Pcg_Step(void) {
+    REBU64 hi;
+    REBU64 lo = Mul_64_128(pcg_lo, PCG_MULT_LO, &hi);
+    hi += pcg_lo * PCG_MULT_HI + pcg_hi * PCG_MULT_LO;
+
+    pcg_lo = lo + PCG_INC_LO;
+    pcg_hi = hi + PCG_INC_HI + (pcg_lo < lo ? 1 : 0);
+}
+
+inline static REBU64 Pcg_Next(void) {
+    Pcg_Step();
+    return Rotr64(pcg_hi ^ pcg_lo, cast(unsigned int, pcg_hi >> 58));
+}
+
+
+//=//// CHACHA20 FOR /SECURE //////////////////////////////////////////////=//
+//
+// RANDOM/SECURE draws from a ChaCha20 keystream (RFC 8439 block function,
+// 64-bit block counter).  The core has no access to OS entropy, so the key
+// comes from Set_Random_Entropy(), which the Crypt extension calls with
+// bytes from /dev/urandom or CryptGenRandom() when it starts up.  Until
+// then /SECURE is an error rather than a silently predictable sequence.
+//
+
+static REB_INSTANCE_VAR bool chacha_keyed = false;
+static REB_INSTANCE_VAR uint32_t chacha_input[16];
+static REB_INSTANCE_VAR uint32_t chacha_block[16];
+static REB_INSTANCE_VAR REBLEN chacha_used = 16;  // words of block consumed
+
+#define CHACHA_QUARTER(a,b,c,d) \
+    a += b; d ^= a; d = (d << 16) | (d >> 16); \
+    c += d; b ^= c; b = (b << 12) | (b >> 20); \
+    a += b; d ^= a; d = (d << 8) | (d >> 24); \
+    c += d; b ^= c; b = (b << 7) | (b >> 25);
+
+static void ChaCha20_Block(uint32_t out[16], const uint32_t in[16])
 {
-    REBI64 tmp = ran_arr_next();
+    uint32_t x[16];
+    memcpy(x, in, sizeof(x));
 
-    if (secure) {
+    int i;
+    for (i = 0; i < 10; ++i) {
+        CHACHA_QUARTER(x[0], x[4], x[8], x[12]);
+        CHACHA_QUARTER(x[1], x[5], x[9], x[13]);
+        CHACHA_QUARTER(x[2], x[6], x[10], x[14]);
+        CHACHA_QUARTER(x[3], x[7], x[11], x[15]);
+        CHACHA_QUARTER(x[0], x[5], x[10], x[15]);
+        CHACHA_QUARTER(x[1], x[6], x[11], x[12]);
+        CHACHA_QUARTER(x[2], x[7], x[8], x[13]);
+        CHACHA_QUARTER(x[3], x[4], x[9], x[14]);
+    }
+
+    for (i = 0; i < 16; ++i)
+        out[i] = x[i] + in[i];
+}
+
+static REBU64 ChaCha_Next(void)
+{
+    if (not chacha_keyed)
         fail (
-            "/SECURE relied on SHA1, which is now in the Crypt extension"
-            " and not the core build.  Speak up if you need a workaround."
+            "RANDOM/SECURE needs OS entropy, which is provided by the Crypt"
+            " extension's INIT-CRYPTO (not loaded in this build)."
         );
 
-        /*REBYTE srcbuf[20], dstbuf[20];
+    if (chacha_used == 16) {
+        ChaCha20_Block(chacha_block, chacha_input);
+        if (++chacha_input[12] == 0)
+            ++chacha_input[13];
+        chacha_used = 0;
+    }
+
+    REBU64 lo = chacha_block[chacha_used++];
+    REBU64 hi = chacha_block[chacha_used++];
+    return (hi << 32) | lo;
+}
 
-        memcpy(srcbuf, &tmp, sizeof(tmp));
-        memset(srcbuf + sizeof(tmp), *(REBYTE*)&tmp, 20 - sizeof(tmp));
 
-        SHA1(srcbuf, 20, dstbuf);
-        memcpy(&tmp, dstbuf, sizeof(tmp));*/
+//
+//  Set_Random_Entropy: C
+//
+// Key the /SECURE generator.  Bytes are XOR'd into the 256-bit key, so this
+// can be called again to stir in more entropy without losing the old.
+//
+void Set_Random_Entropy(const REBYTE *bytes, REBLEN len)
+{
+    if (not chacha_keyed) {
+        chacha_input[0] = 0x61707865;  // "expand 32-byte k"
+        chacha_input[1] = 0x3320646e;
+        chacha_input[2] = 0x79622d32;
+        chacha_input[3] = 0x6b206574;
+        memset(&chacha_input[4], 0, 12 * sizeof(uint32_t));
     }
 
-    return tmp;
+    REBLEN i;
+    for (i = 0; i < len; ++i)
+        chacha_input[4 + (i % 32) / 4] ^= cast(uint32_t, bytes[i]) << (8 * (i % 4));
+
+    chacha_input[12] = 0;  // restart the block counter under the new key
+    chacha_input[13] = 0;
+    chacha_used = 16;
+    if (len != 0)
+        chacha_keyed = true;
 }
 
+
+//
+//  Set_Random: C
+//
+// Seed the generator RANDOM-GENERATOR has selected (Knuth's by default).
+//
+void Set_Random(REBI64 seed)
+{
+    random_seed = seed;
+
+    REBU64 x = cast(REBU64, seed);
+    switch (random_generator) {
+      case SYM_XOSHIRO256:
+        xoshiro_s[0] = Split_Mix_64(&x);
+        xoshiro_s[1] = Split_Mix_64(&x);
+        xoshiro_s[2] = Split_Mix_64(&x);
+        xoshiro_s[3] = Split_Mix_64(&x);
+        break;
+
+      case SYM_PCG64: {  // as pcg_setseq_128_srandom_r(), with fixed stream
+        REBU64 init_hi = Split_Mix_64(&x);
+        REBU64 init_lo = Split_Mix_64(&x);
+        pcg_hi = 0;
+        pcg_lo = 0;
+        Pcg_Step();
+        pcg_lo += init_lo;
+        pcg_hi += init_hi + (pcg_lo < init_lo ? 1 : 0);
+        Pcg_Step();
+        break; }
+
+      default:
+        assert(random_generator == SYM_KNUTH);
+        Set_Knuth_Random(seed);
+        break;
+    }
+}
+
+
+//
+//  Set_Random_Generator: C
+//
+// Switch RANDOM to KNUTH, XOSHIRO256 or PCG64, seeding the new generator
+// with the last seed given.  Returns false if the name isn't recognized.
+//
+bool Set_Random_Generator(REBSYM sym)
+{
+    if (sym != SYM_KNUTH and sym != SYM_XOSHIRO256 and sym != SYM_PCG64)
+        return false;
+
+    random_generator = sym;
+    Set_Random(random_seed);
+    return true;
+}
+
+
+//
+//  Get_Random_Generator: C
+//
+REBSYM Get_Random_Generator(void)
+{
+    return random_generator;
+}
+
+
+// Knuth's generator makes 62 bits at a time; two steps make up a full 64.
+//
+inline static REBU64 Random_U64_Inline(bool secure) {
+    if (secure)
+        return ChaCha_Next();
+
+    switch (random_generator) {
+      case SYM_XOSHIRO256:
+        return Xoshiro_Next();
+
+      case SYM_PCG64:
+        return Pcg_Next();
+
+      default: {
+        REBU64 hi = ran_arr_next();
+        return (hi << 2) | (cast(REBU64, ran_arr_next()) >> 60); }
+    }
+}
+
+
+//
+//  Random_U64: C
+//
+// Return 64 uniformly random bits.
+//
+REBU64 Random_U64(bool secure)
+{
+    return Random_U64_Inline(secure);
+}
+
+
+//
+//  Random_Fill_U64: C
+//
+// Bulk version of Random_U64(), choosing the generator once for the whole
+// buffer so the loop compiles down to just the generator's arithmetic.
+//
+void Random_Fill_U64(REBU64 *buf, REBLEN n, bool secure)
+{
+    REBU64 *end = buf + n;
+
+    if (secure) {
+        for (; buf != end; ++buf)
+            *buf = ChaCha_Next();
+        return;
+    }
+
+    switch (random_generator) {
+      case SYM_XOSHIRO256:
+        for (; buf != end; ++buf)
+            *buf = Xoshiro_Next();
+        break;
+
+      case SYM_PCG64:
+        for (; buf != end; ++buf)
+            *buf = Pcg_Next();
+        break;
+
+      default:
+        for (; buf != end; ++buf)
+            *buf = Random_U64_Inline(false);
+        break;
+    }
+}
+
+
+//
+//  Random_Int: C
+//
+// Return random nonnegative integer (62 bits from the Knuth generator, 63
+// bits from the others).
+//
+REBI64 Random_Int(bool secure)
+{
+    if (not secure and random_generator == SYM_KNUTH)
+        return ran_arr_next();
+
+    return cast(REBI64, Random_U64_Inline(secure) >> 1);
+}
+
+
 //
 //  Random_Range: C
 //
@@ -149,34 +441,42 @@ REBI64 Random_Range(REBI64 r, bool secure)
     if (r == 0)
         return 0;
 
-    REBU64 s = (r < 0) ? -r : r;
-    if (not secure and s > MM)
-        fail (Error_Overflow_Raw());
+    REBU64 s = (r < 0) ? -cast(REBU64, r) : cast(REBU64, r);
+    REBU64 u;
 
-    REBU64 m; // rejection limit
-    if (secure)
-        m = UINT64_MAX - (UINT64_MAX - s + 1) % s;
-    else
-        m = MM - MM % s - 1;
+    if (not secure and random_generator == SYM_KNUTH) {
+        if (s > MM)
+            fail (Error_Overflow_Raw());
 
-    REBU64 u;
-    do {
-        u = Random_Int(secure);
-    } while (u > m); // get a random value below the limit
+        REBU64 m = MM - MM % s - 1;  // rejection limit
+        do {
+            u = ran_arr_next();
+        } while (u > m);  // get a random value below the limit
+    }
+    else {
+        REBU64 m = UINT64_MAX - (UINT64_MAX - s + 1) % s;
+        do {
+            u = Random_U64_Inline(secure);
+        } while (u > m);
+    }
 
     u = u % s + 1;
     return (r > 0) ? cast(REBI64, u) : -cast(REBI64, u);
 }
 
+
 //
 //  Random_Dec: C
 //
 REBDEC Random_Dec(REBDEC r, bool secure)
 {
-    REBDEC t, s;
-    t = secure ? 5.4210108624275222e-20 /* 2^-64 */ :  2.1684043449710089e-19 /* 2^-62 */;
-    /* care is taken to never overflow and yield a correct sign */
-    s = (REBDEC)Random_Int(secure);
-    if (s < 0.0) s += 1.8446744073709552e19;
-    return (s * t) * r;
+    if (not secure and random_generator == SYM_KNUTH) {
+        REBDEC s = cast(REBDEC, ran_arr_next());
+        return (s * 2.1684043449710089e-19 /* 2^-62 */) * r;
+    }
+
+    // care is taken to never overflow and yield a correct sign
+    //
+    REBDEC s = cast(REBDEC, Random_U64_Inline(secure));
+    return (s * 5.4210108624275222e-20 /* 2^-64 */) * r;
 }
@@ -216,6 +216,38 @@ REB_R Series_Common_Action_Maybe_Unhandled(
 }
 
 
+// Homogeneous blocks of INTEGER!, CHAR!, LOGIC! or BLANK! are common (e.g.
+// when comparing cached results), and Cmp_Value() pays for unescaping the
+// quotes and a type switch on every cell.  Equal runs of such cells only
+// need their payloads checked.  (Whole cells can't be memcmp()'d, since the
+// header carries flags like NEWLINE_BEFORE and unused payload bits aren't
+// canonized.)
+//
+inline static bool Same_Simple_Cells(const RELVAL *s, const RELVAL *t)
+{
+    REBYTE kind = KIND_BYTE(s);
+    if (kind != KIND_BYTE(t))
+        return false;  // also covers differing quote levels
+
+    switch (kind) {
+      case REB_BLANK:
+        return true;
+
+      case REB_INTEGER:
+        return VAL_INT64(s) == VAL_INT64(t);
+
+      case REB_CHAR:
+        return VAL_CHAR(s) == VAL_CHAR(t);
+
+      case REB_LOGIC:
+        return VAL_LOGIC(s) == VAL_LOGIC(t);
+
+      default:
+        return false;
+    }
+}
+
+
 //
 //  Cmp_Array: C
 //
@@ -244,9 +276,11 @@ REBINT Cmp_Array(const REBCEL *sval, const REBCEL *tval, bool is_case)
         VAL_TYPE(s) == VAL_TYPE(t)
         or (ANY_NUMBER(s) and ANY_NUMBER(t))
     ){
-        REBINT diff;
-        if ((diff = Cmp_Value(s, t, is_case)) != 0)
-            return diff;
+        if (not Same_Simple_Cells(s, t)) {  // equal runs skip Cmp_Value()
+            REBINT diff;
+            if ((diff = Cmp_Value(s, t, is_case)) != 0)
+                return diff;
+        }
 
         s++;
         t++;
@@ -306,10 +340,12 @@ REBINT Cmp_Value(const RELVAL *sval, const RELVAL *tval, bool is_case)
     switch (s_kind) {
       case REB_INTEGER:
         if (t_kind == REB_DECIMAL) {
-            d1 = cast(REBDEC, VAL_INT64(s));
+            d1 = Integer_To_Decimal(s);
             d2 = VAL_DECIMAL(t);
             goto chkDecimal;
         }
+        if (IS_INTEGER_BIG(s) or IS_INTEGER_BIG(t))
+            return Big_Compare(s, t);
         return THE_SIGN(VAL_INT64(s) - VAL_INT64(t));
 
       case REB_LOGIC:
@@ -338,7 +374,7 @@ REBINT Cmp_Value(const RELVAL *sval, const RELVAL *tval, bool is_case)
         else
             d1 = VAL_DECIMAL(s);
         if (t_kind == REB_INTEGER)
-            d2 = cast(REBDEC, VAL_INT64(t));
+            d2 = Integer_To_Decimal(t);
         else if (t_kind == REB_MONEY)
             d2 = deci_to_decimal(VAL_MONEY_AMOUNT(t));
         else
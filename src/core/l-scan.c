@@ -415,6 +415,25 @@ static const REBYTE *Scan_Quote_Push_Mold(
     REBINT nest = 0;
     REBLEN lines = 0;
     while (*src != term or nest > 0) {
+        //
+        // Most of the content of strings in data files is printable ASCII
+        // with nothing to escape or track.  Copy such runs as a block, and
+        // only go codepoint by codepoint for the bytes the switch handles
+        // (braces, escapes, line breaks, controls, and UTF-8 sequences).
+        //
+        const REBYTE *run = src;
+        while (
+            *src >= ' ' and *src < 0x80
+            and *src != '"' and *src != '^'
+            and *src != '{' and *src != '}'
+        ){
+            ++src;
+        }
+        if (src != run) {
+            Append_Ascii_Len(mo->series, cs_cast(run), src - run);
+            continue;
+        }
+
         REBUNI c = *src;
 
         switch (c) {
@@ -937,6 +956,9 @@ static enum Reb_Token Locate_Token_May_Push_Mold(
         if (not ss->feed)  // not a variadic va_list-based scan...
             return TOKEN_END;  // ...so end of utf-8 input was *the* end
 
+        if (not ss->feed->vaptr)  // just one fragment, see Scan_Feed_Utf8...
+            return TOKEN_END;
+
         const void *p = va_arg(*ss->feed->vaptr, const void*);
         if (not p or Detect_Rebol_Pointer(p) != DETECTED_AS_UTF8) {
             //
@@ -1578,6 +1600,164 @@ void Init_Scan_State(
 }
 
 
+//
+//  Rescue_Scan_Utf8_Feed: C
+//
+// Scan a UTF-8 fragment of a variadic feed to the stack, binding any words
+// into the feed's context.  If `rest` is false then the scan stops at the
+// end of the fragment, and the va_list isn't touched.
+//
+static REBVAL *Rescue_Scan_Utf8_Feed(
+    bool *newline_pending,  // in and out
+    struct Reb_Feed *feed,
+    const REBYTE *utf8,
+    bool rest
+){
+    struct Reb_Binder binder;
+    Init_Interning_Binder(&binder, feed->context);
+    feed->binder = &binder;
+
+    SCAN_STATE ss;
+    const REBLIN start_line = 1;
+    Init_Va_Scan_State_Core(&ss, Intern("sys-do.h"), start_line, utf8, feed);
+    ss.newline_pending = *newline_pending;
+
+    va_list *vaptr = feed->vaptr;
+    if (not rest)
+        feed->vaptr = nullptr;  // Locate_Token() treats as the end
+
+    REBVAL *error = rebRescue(cast(REBDNG*, &Scan_To_Stack), &ss);
+
+    if (not rest)
+        feed->vaptr = vaptr;
+
+    Shutdown_Interning_Binder(&binder, feed->context);
+    feed->binder = nullptr;
+
+    *newline_pending = ss.newline_pending;
+    return error;
+}
+
+
+//
+//  Scan_Feed_Utf8_To_Stack: C
+//
+// Scan the UTF-8 fragment a variadic feed has reached, and the rest of the
+// feed after it.  The fragment is looked up in TG_Scan_Cache by its pointer
+// first.  A hit pushes copies of the values it scanned to last time, which
+// skips the scanner...and the interning binder, which has to visit every
+// word in lib.  The binder is only set up if later fragments need it.
+//
+// A pointer alone doesn't identify a string (hosts may reuse buffers), so
+// hits are checked against a copy of the text.  Only fragments that scan on
+// their own are cached.  An unbalanced one like "append [" or one ending in
+// an apostrophe depends on what comes after it, so it is always rescanned.
+//
+void Scan_Feed_Utf8_To_Stack(struct Reb_Feed *feed, const REBYTE *utf8)
+{
+    REBDSP dsp_orig = DSP;
+    bool newline_pending = false;
+    REBVAL *error;
+
+    if (not Root_Scan_Cache)  // API used before the root vars are made
+        goto scan_rest;
+
+  blockscope {
+    uintptr_t h = cast(uintptr_t, utf8);
+    REBLEN slot = (h ^ (h >> 6)) & (SCAN_CACHE_SIZE - 1);
+    REB_SCAN_ENTRY *entry = &TG_Scan_Cache[slot];
+
+    REBARR *cache = VAL_ARRAY(Root_Scan_Cache);
+    RELVAL *text = ARR_AT(cache, 2 * slot);
+    RELVAL *block = ARR_AT(cache, 2 * slot + 1);
+
+    if (
+        entry->utf8 != utf8
+        or entry->context != feed->context
+        or strncmp(
+            cs_cast(utf8),
+            cs_cast(BIN_HEAD(VAL_BINARY(text))),
+            entry->size
+        ) != 0
+        or utf8[entry->size] != '\0'
+    ){
+        REBSIZ size = strsize(cs_cast(utf8));
+
+        Note_Series_Mutation(SER(cache));
+        Init_Binary(text, Copy_Bytes(utf8, size));
+        Init_Blank(block);
+
+        entry->utf8 = utf8;
+        entry->context = feed->context;
+        entry->size = size;
+        entry->cached = false;
+
+        const REBYTE *tail = utf8 + size;
+        while (tail != utf8 and IS_LEX_ANY_SPACE(tail[-1]))
+            --tail;
+        if (tail != utf8 and tail[-1] == '\'')
+            goto scan_rest;
+
+        error = Rescue_Scan_Utf8_Feed(&newline_pending, feed, utf8, false);
+        if (error) {  // e.g. "append [" ... rescan with the va_list
+            rebRelease(error);
+            newline_pending = false;
+            goto scan_rest;
+        }
+
+        REBARR *a = Pop_Stack_Values(dsp_orig);
+        Manage_Array(a);
+        Init_Block(block, a);
+
+        entry->cached = true;
+        entry->newline_pending = newline_pending;
+    }
+    else if (not entry->cached)
+        goto scan_rest;
+
+    // Series in the values are copied, so mutations made by the code that
+    // runs don't show up in the next call.
+    //
+    RELVAL *item = ARR_HEAD(VAL_ARRAY(block));
+    for (; NOT_END(item); ++item) {
+        Derelativize(DS_PUSH(), item, SPECIFIED);
+        Clonify(DS_TOP, NODE_FLAG_MANAGED, TS_SERIES & ~TS_NOT_COPIED);
+    }
+    newline_pending = entry->newline_pending;
+  }
+
+    // Splice values from the va_list the way Locate_Token() would, until
+    // the end or another UTF-8 fragment turns up that needs the scanner.
+    //
+    while (true) {
+        const void *p = va_arg(*feed->vaptr, const void*);
+        if (p and Detect_Rebol_Pointer(p) == DETECTED_AS_UTF8) {
+            utf8 = cast(const REBYTE*, p);
+            goto scan_rest;
+        }
+
+        Detect_Feed_Pointer_Maybe_Fetch(feed, p, false);
+        if (IS_END(feed->value))
+            return;
+
+        Derelativize(DS_PUSH(), feed->value, feed->specifier);
+        if (newline_pending) {
+            newline_pending = false;
+            SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+        }
+    }
+
+  scan_rest:
+
+    error = Rescue_Scan_Utf8_Feed(&newline_pending, feed, utf8, true);
+    if (error) {
+        REBCTX *error_ctx = VAL_CONTEXT(error);
+        rebRelease(error);
+        fail (error_ctx);
+    }
+}
+
+
 //
 //  Scan_Head: C
 //
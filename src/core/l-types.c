@@ -25,6 +25,7 @@
 #include "sys-core.h"
 #include "sys-dec-to-char.h"
 #include <errno.h>
+#include <float.h>  // FLT_EVAL_METHOD
 
 
 //
@@ -38,6 +39,18 @@
     do { Init_Unreadable_Blank(out); return NULL; } while (1)
 
 
+// Up to 15 decimal digits always fit in the 53-bit mantissa of a double, and
+// 10^22 is the largest power of ten that a double holds exactly.
+//
+#define MAX_EXACT_DECIMAL_DIGITS 15
+#define MAX_EXACT_POWER_OF_TEN 22
+
+static const double Exact_Powers_Of_Ten[MAX_EXACT_POWER_OF_TEN + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+
 //
 //  MAKE_Fail: C
 //
@@ -574,6 +587,14 @@ const REBYTE *Scan_Decimal(
 
     const REBYTE *bp = cp;
 
+    // While the digits are copied out for strtod(), also gather them into
+    // an integer mantissa and a power of ten, for the fast path below.
+    //
+    REBU64 mantissa = 0;
+    REBLEN sig_digits = 0;  // leading zeros don't count
+    REBINT scale = 0;
+
+    bool negative = (*cp == '-');
     if (*cp == '+' || *cp == '-')
         *ep++ = *cp++;
 
@@ -581,6 +602,10 @@ const REBYTE *Scan_Decimal(
 
     while (IS_LEX_NUMBER(*cp) || *cp == '\'') {
         if (*cp != '\'') {
+            if (sig_digits != 0 or *cp != '0') {
+                if (++sig_digits <= MAX_EXACT_DECIMAL_DIGITS)
+                    mantissa = mantissa * 10 + (*cp - '0');
+            }
             *ep++ = *cp++;
             digit_present = true;
         }
@@ -595,6 +620,11 @@ const REBYTE *Scan_Decimal(
 
     while (IS_LEX_NUMBER(*cp) || *cp == '\'') {
         if (*cp != '\'') {
+            if (sig_digits != 0 or *cp != '0') {
+                if (++sig_digits <= MAX_EXACT_DECIMAL_DIGITS)
+                    mantissa = mantissa * 10 + (*cp - '0');
+            }
+            --scale;
             *ep++ = *cp++;
             digit_present = true;
         }
@@ -609,16 +639,22 @@ const REBYTE *Scan_Decimal(
         *ep++ = *cp++;
         digit_present = false;
 
+        bool exp_negative = (*cp == '-');
         if (*cp == '-' || *cp == '+')
             *ep++ = *cp++;
 
+        REBINT exponent = 0;
         while (IS_LEX_NUMBER(*cp)) {
+            if (exponent < 10000)  // just needs to stay out of fast range
+                exponent = exponent * 10 + (*cp - '0');
             *ep++ = *cp++;
             digit_present = true;
         }
 
         if (not digit_present)
             return_NULL;
+
+        scale += exp_negative ? -exponent : exponent;
     }
 
     if (*cp == '%') {
@@ -635,6 +671,27 @@ const REBYTE *Scan_Decimal(
 
     RESET_VAL_HEADER(out, REB_DECIMAL, CELL_MASK_NONE);
 
+    // Clinger's fast path: when the mantissa and the power of ten are both
+    // exactly representable doubles, one IEEE multiply or divide rounds
+    // correctly, giving the same bits strtod() would.  That needs doubles to
+    // be evaluated at double precision (not e.g. x87 extended precision).
+    //
+  #if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    if (
+        sig_digits <= MAX_EXACT_DECIMAL_DIGITS
+        and scale >= -MAX_EXACT_POWER_OF_TEN
+        and scale <= MAX_EXACT_POWER_OF_TEN
+    ){
+        double d = cast(double, mantissa);
+        if (scale < 0)
+            d /= Exact_Powers_Of_Ten[-scale];
+        else
+            d *= Exact_Powers_Of_Ten[scale];
+        VAL_DECIMAL(out) = negative ? -d : d;
+        return cp;
+    }
+  #endif
+
     char *se;
     VAL_DECIMAL(out) = strtod(s_cast(buf), &se);
 
@@ -647,6 +704,33 @@ const REBYTE *Scan_Decimal(
 }
 
 
+// Convert eight ASCII digits to their value with a few multiplies, instead
+// of one multiply-add per digit.  The bytes are assembled little-endian by
+// hand, so it works the same on big-endian machines.
+//
+// https://lemire.me/blog/2022/01/21/swar-explained-parsing-eight-digits/
+//
+static REBU64 Scan_8_Digits(const REBYTE *p)
+{
+    REBU64 v =
+        cast(REBU64, p[0])
+        | (cast(REBU64, p[1]) << 8)
+        | (cast(REBU64, p[2]) << 16)
+        | (cast(REBU64, p[3]) << 24)
+        | (cast(REBU64, p[4]) << 32)
+        | (cast(REBU64, p[5]) << 40)
+        | (cast(REBU64, p[6]) << 48)
+        | (cast(REBU64, p[7]) << 56);
+
+    v -= 0x3030303030303030ULL;  // '0' from each byte
+    v = (v * 10) + (v >> 8);  // pairs of digits into every other byte
+    return (
+        ((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)))
+        + (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))
+    ) >> 32;
+}
+
+
 //
 //  Scan_Integer: C
 //
@@ -702,7 +786,7 @@ const REBYTE *Scan_Integer(
     }
 
     if (num == 0) { // all zeros or '
-        // return early to avoid platform dependant error handling in CHR_TO_INT
+        // return early, the conversion below assumes at least one digit
         Init_Integer(out, 0);
         return cp;
     }
@@ -718,28 +802,132 @@ const REBYTE *Scan_Integer(
     }
     *bp = '\0';
 
-    // Too many digits?
     len = bp - &buf[0];
     if (neg)
         --len;
+
+    // Numbers too big for 64 bits become "big" INTEGER!s (see %f-bigint.c).
+    // More than 19 digits always is one.
+    //
+    const REBYTE *digits = neg ? buf + 1 : buf;
     if (len > 19) {
-        // !!! magic number :-( How does it relate to MAX_INT_LEN (also magic)
-        return_NULL;
+        Scan_Big_Integer(out, digits, len, neg);
+        return cp;
     }
 
-    // Convert, check, and return:
-    errno = 0;
+    // Convert, eight digits at a time while there are that many.  Up to 19
+    // digits can't overflow a REBU64, so range checking can wait until the
+    // end (the magnitude of INT64_MIN is one more than INT64_MAX).
+    //
+    const REBYTE *dp = digits;
+    REBLEN n = len;
+    REBU64 u = 0;
+    for (; n >= 8; n -= 8, dp += 8)
+        u = u * 100000000 + Scan_8_Digits(dp);
+    for (; n > 0; --n, ++dp)
+        u = u * 10 + (*dp - '0');
+
+    if (u > cast(REBU64, INT64_MAX) + (neg ? 1 : 0)) {
+        Scan_Big_Integer(out, digits, len, neg);
+        return cp;
+    }
 
     RESET_VAL_HEADER(out, REB_INTEGER, CELL_MASK_NONE);
+    VAL_INT64(out) = neg
+        ? cast(REBI64, cast(REBU64, 0) - u)
+        : cast(REBI64, u);
 
-    VAL_INT64(out) = CHR_TO_INT(buf);
-    if (errno != 0)
-        return_NULL; // overflow
+    return cp;
+}
 
-    if ((VAL_INT64(out) > 0 && neg) || (VAL_INT64(out) < 0 && !neg))
-        return_NULL;
 
-    return cp;
+// Value of n ASCII digits at p, or -1 if they aren't all digits.
+//
+static REBINT Scan_Fixed_Digits(const REBYTE *p, REBLEN n)
+{
+    REBINT num = 0;
+    for (; n > 0; --n, ++p) {
+        if (*p < '0' or *p > '9')
+            return -1;
+        num = num * 10 + (*p - '0');
+    }
+    return num;
+}
+
+
+// Scan the ISO 8601 form that most machine-written dates use, YYYY-MM-DD,
+// optionally followed by /HH:MM:SS and then a zone of +HH:MM or -HH:MM.  The
+// fields are at fixed offsets, so it doesn't need Scan_Date()'s searching
+// for separators and month names.  Returns nullptr for anything else--or
+// anything out of range--and Scan_Date() then decides if it is legal.
+//
+static const REBYTE *Scan_Iso_Date(
+    RELVAL *out,
+    const REBYTE *cp,
+    REBLEN len
+){
+    if (len < 10 or cp[4] != '-' or cp[7] != '-')
+        return nullptr;
+
+    REBINT year = Scan_Fixed_Digits(cp, 4);
+    REBINT month = Scan_Fixed_Digits(cp + 5, 2);
+    REBINT day = Scan_Fixed_Digits(cp + 8, 2);
+    if (year < 0 or month < 1 or month > 12 or day < 1)
+        return nullptr;
+    if (day > Month_Max_Days[month - 1])
+        return nullptr;
+    if (
+        month == 2 and day == 29
+        and ((year % 4) != 0 or ((year % 100) == 0 and (year % 400) != 0))
+    ){
+        return nullptr;
+    }
+
+    REBI64 nano = NO_DATE_TIME;
+    REBINT tz = NO_DATE_ZONE;
+
+    const REBYTE *ep = cp + 10;
+    const REBYTE *end = cp + len;
+    if (ep != end) {
+        if (end - ep < 9 or ep[0] != '/' or ep[3] != ':' or ep[6] != ':')
+            return nullptr;
+
+        REBINT h = Scan_Fixed_Digits(ep + 1, 2);
+        REBINT m = Scan_Fixed_Digits(ep + 4, 2);
+        REBINT s = Scan_Fixed_Digits(ep + 7, 2);
+        if (h < 0 or h > 23 or m < 0 or m > 59 or s < 0 or s > 59)
+            return nullptr;
+        nano = SECS_TO_NANO((h * 60 + m) * 60 + s);
+
+        ep += 9;
+        if (ep != end) {
+            if (end - ep != 6 or (ep[0] != '+' and ep[0] != '-'))
+                return nullptr;
+            if (ep[3] != ':')
+                return nullptr;
+
+            REBINT zh = Scan_Fixed_Digits(ep + 1, 2);
+            REBINT zm = Scan_Fixed_Digits(ep + 4, 2);
+            if (zh < 0 or zh > 15 or zm < 0 or zm > 59 or zm % ZONE_MINS != 0)
+                return nullptr;
+
+            tz = (zh * 60 + zm) / ZONE_MINS;
+            if (ep[0] == '-')
+                tz = -tz;
+            ep = end;
+        }
+    }
+
+    RESET_VAL_HEADER(out, REB_DATE, CELL_MASK_NONE);
+    PAYLOAD(Time, out).nanoseconds = nano;
+    VAL_YEAR(out) = year;
+    VAL_MONTH(out) = month;
+    VAL_DAY(out) = day;
+    VAL_DATE(out).zone = tz;
+
+    Adjust_Date_Zone(out, true);  // no effect if NO_DATE_ZONE
+
+    return ep;
 }
 
 
@@ -755,6 +943,10 @@ const REBYTE *Scan_Date(
 ) {
     TRASH_CELL_IF_DEBUG(out);
 
+    const REBYTE *iso = Scan_Iso_Date(out, cp, len);
+    if (iso)
+        return iso;
+
     const REBYTE *end = cp + len;
 
     // Skip spaces:
@@ -1131,37 +1323,28 @@ const REBYTE *Scan_Pair(
     if (*ep != 'x' && *ep != 'X')
         return_NULL;
 
-    REBVAL *paired = Alloc_Pairing();
-
-    // X is in the key pairing cell
+    DECLARE_LOCAL (x);
     if (is_integral)
-        Init_Integer(PAIRING_KEY(paired), atoi(cast(char*, &buf[0])));
+        Init_Integer(x, atoi(cast(char*, &buf[0])));
     else
-        Init_Decimal(PAIRING_KEY(paired), atof(cast(char*, &buf[0])));
+        Init_Decimal(x, atof(cast(char*, &buf[0])));
 
     ep++;
 
     const REBYTE *xp = Scan_Dec_Buf(&buf[0], &is_integral, ep, MAX_NUM_LEN);
-    if (!xp) {
-        Free_Pairing(paired);
+    if (!xp)
         return_NULL;
-    }
 
-    // Y is in the non-key pairing cell
+    DECLARE_LOCAL (y);
     if (is_integral)
-        Init_Integer(paired, atoi(cast(char*, &buf[0])));
+        Init_Integer(y, atoi(cast(char*, &buf[0])));
     else
-        Init_Decimal(paired, atof(cast(char*, &buf[0])));
+        Init_Decimal(y, atof(cast(char*, &buf[0])));
 
-    if (len > cast(REBLEN, xp - cp)) {
-        Free_Pairing(paired);
+    if (len > cast(REBLEN, xp - cp))
         return_NULL;
-    }
 
-    Manage_Pairing(paired);
-
-    RESET_CELL(out, REB_PAIR, CELL_FLAG_FIRST_IS_NODE);
-    VAL_PAIR_NODE(out) = NOD(paired);
+    Init_Pair(out, x, y);
     return xp;
 }
 
@@ -1443,3 +1626,108 @@ REBNATIVE(scan_net_header)
 
     return Init_Block(D_OUT, result);
 }
+
+
+// Position of the CR of the first CR LF in [cp, tail), or nullptr if none.
+//
+static const REBYTE *Find_CR_LF(const REBYTE *cp, const REBYTE *tail)
+{
+    for (; cp + 1 < tail; ++cp) {
+        if (cp[0] == CR and cp[1] == LF)
+            return cp;
+    }
+    return nullptr;
+}
+
+
+//
+//  dechunk: native [
+//
+//  {Decode the complete chunks of an HTTP/1.1 "chunked" transfer encoding}
+//
+//      return: "Trailer header lines if the body has ended (may be empty)"
+//          [<opt> binary!]
+//      out "Receives the data of each complete chunk"
+//          [binary!]
+//      data "Chunked data, from which decoded chunks are removed"
+//          [binary!]
+//  ]
+//
+REBNATIVE(dechunk)
+//
+// A chunk which hasn't all arrived is left in DATA, so this can be called
+// each time more is read.  Once the last (empty) chunk and the trailer are
+// decoded, DATA holds only what came after the body, e.g. the next response
+// on a keep-alive or pipelined connection.  Chunk extensions are ignored.
+//
+// This was PARSE code in %prot-http.r, which DEBASE'd and DEBIN'd each size
+// and copied the rest of the buffer for each chunk.
+{
+    INCLUDE_PARAMS_OF_DECHUNK;
+
+    REBVAL *out = ARG(out);
+    REBVAL *data = ARG(data);
+    FAIL_IF_READ_ONLY(out);
+    FAIL_IF_READ_ONLY(data);
+
+    if (VAL_SERIES(out) == VAL_SERIES(data))
+        fail ("DECHUNK can't decode DATA into itself");
+
+    const REBYTE *head = VAL_BIN_AT(data);
+    const REBYTE *tail = head + VAL_LEN_AT(data);
+    const REBYTE *cp = head;  // start of the first chunk not yet decoded
+
+    DECLARE_LOCAL (size);
+
+    while (true) {
+        const REBYTE *eol = Find_CR_LF(cp, tail);
+        if (not eol)
+            break;  // size line hasn't all arrived
+
+        const REBYTE *ep = Scan_Hex(size, cp, 1, 15);
+        if (not ep or (ep != eol and *ep != ';'))
+            fail ("Bad chunk size in HTTP chunked transfer encoding");
+
+        REBI64 n = VAL_INT64(size);
+        const REBYTE *start = eol + 2;
+
+        if (n == 0) {  // last chunk, then trailer lines and an empty line
+            const REBYTE *end = start;
+            while (true) {
+                const REBYTE *line_end = Find_CR_LF(end, tail);
+                if (not line_end)
+                    goto incomplete;
+                bool empty = (line_end == end);
+                end = line_end + 2;
+                if (empty)
+                    break;
+            }
+
+            Init_Binary(D_OUT, Copy_Bytes(start, (end - start) - 2));
+            Remove_Series_Units(
+                VAL_SERIES(data),
+                VAL_INDEX(data),
+                cast(REBINT, end - head)
+            );
+            return D_OUT;
+        }
+
+        if (tail - start < n + 2)
+            break;  // chunk's data hasn't all arrived
+
+        if (start[n] != CR or start[n + 1] != LF)
+            fail ("Chunk not followed by CR LF in HTTP chunked encoding");
+
+        Append_Series(VAL_SERIES(out), start, cast(REBLEN, n));
+        cp = start + n + 2;
+    }
+
+  incomplete:
+
+    Remove_Series_Units(
+        VAL_SERIES(data),
+        VAL_INDEX(data),
+        cast(REBINT, cp - head)
+    );
+    return nullptr;
+}
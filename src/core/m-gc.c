@@ -60,11 +60,33 @@
 // approaches used.
 //
 
+#include <time.h>  // clock(), used for pause timing in GC_Stats
+
 #include "sys-core.h"
 
 #include "sys-int-funcs.h"
 
 
+// When RECYCLE/GENERATIONAL is on, automatic recycles only trace series that
+// are not yet SERIES_INFO_GC_OLD (see Recycle_Auto()).  Old series are only
+// freed by a major collection, so one is forced after this many minors.
+//
+#define GC_MAX_MINORS 8
+
+// Generations are also used by Push_Arena(), to make everything that existed
+// before the arena "old" so its scope can be collected with a minor recycle.
+//
+#define Tracking_Generations() \
+    (GC_Generational or GC_Arena_Depth != 0)
+
+// Frames reuse the varlists of finished calls via TG_Reuse.  Each recycle
+// culls that list, but keeps this many small varlists so the calls right
+// after a recycle don't all have to allocate (and charge the ballast) anew.
+//
+#define REUSE_KEEP_MAX 32
+#define REUSE_KEEP_CELLS 16  // rootvar and end included
+
+
 //
 // !!! In R3-Alpha, the core included specialized structures which required
 // their own GC participation.  This is because rather than store their
@@ -89,7 +111,7 @@ static void Mark_Devices_Deep(void);
 
 
 #ifndef NDEBUG
-    static bool in_mark = false; // needs to be per-GC thread
+    static REB_INSTANCE_VAR bool in_mark = false; // needs to be per-GC thread
 #endif
 
 #define ASSERT_NO_GC_MARKS_PENDING() \
@@ -97,6 +119,8 @@ static void Mark_Devices_Deep(void);
 
 
 static void Queue_Mark_Opt_End_Cell_Deep(const RELVAL *v);
+static void Queue_Mark_Series_Core(REBSER *s);
+static void Abandon_Incremental_Mark(void);
 
 inline static void Queue_Mark_Opt_Value_Deep(const RELVAL *v)
 {
@@ -180,7 +204,13 @@ static void Queue_Mark_Node_Deep(void *p)
         return;  // it's 2 cells, sizeof(REBSER), but no room for REBSER data
     }
 
+    if (*bp & NODE_BYTEMASK_0x08_FROZEN_HEAP)
+        return;  // never traced, its externals are roots (no header write)
+
     REBSER *s = SER(p);
+    if (GC_Minor and GET_SERIES_INFO(s, GC_OLD))
+        return;  // old series are only traced as roots in a minor recycle
+
     if (GET_SERIES_INFO(s, INACCESSIBLE)) {
         //
         // !!! All inaccessible nodes should be collapsed and canonized into
@@ -207,6 +237,16 @@ static void Queue_Mark_Node_Deep(void *p)
     }
   #endif
 
+    Queue_Mark_Series_Core(s);
+}
+
+
+// Marks a series and queues its LINK()/MISC() nodes and array content.  This
+// is split out of Queue_Mark_Node_Deep() so that a minor recycle can use it
+// to trace old series that act as roots, without being filtered as old.
+//
+static void Queue_Mark_Series_Core(REBSER *s)
+{
     s->header.bits |= NODE_FLAG_MARKED; // may be already set
 
     if (GET_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK) and LINK(s).custom.node)
@@ -232,10 +272,23 @@ static void Queue_Mark_Node_Deep(void *p)
             Extend_Series(GC_Mark_Stack, 8);
         *SER_AT(REBARR*, GC_Mark_Stack, SER_USED(GC_Mark_Stack)) = ARR(s);
         SET_SERIES_USED(GC_Mark_Stack, SER_USED(GC_Mark_Stack) + 1);  // !term
+
+        // The mark stack is last-in-first-out, so this array's cells are
+        // likely to be scanned soon.  Its node was just written, so reading
+        // where its cells are is cheap--start fetching them.
+        //
+        if (NOT_SERIES_INFO(s, INACCESSIBLE))
+            PREFETCH(ARR_HEAD(ARR(s)));
     }
 }
 
 
+// Kinds below REB_PAIR carry no nodes, except a big INTEGER! (its limbs).
+//
+inline static bool Is_Scalar_With_Node(enum Reb_Kind kind, const RELVAL *v)
+  { return kind == REB_INTEGER and GET_CELL_FLAG(v, FIRST_IS_NODE); }
+
+
 //
 //  Queue_Mark_Opt_End_Cell_Deep: C
 //
@@ -249,11 +302,12 @@ static void Queue_Mark_Opt_End_Cell_Deep(const RELVAL *v)
     // to mark the cell as if it were a plain word.  Use the CELL_KIND.
     //
     // See %types.r for how all the scalar types are at the bottom.  These
-    // kinds that don't need marking include REB_0_END.  REB_INTEGER will
-    // need marking when it becomes arbitrary precision and has a node...
+    // kinds that don't need marking include REB_0_END.  The exception is an
+    // INTEGER! too big for 64 bits, which holds its limbs in a series (see
+    // %f-bigint.c) and must have that series marked.
     //
     enum Reb_Kind kind = CELL_KIND_UNCHECKED(v);
-    if (kind < REB_PAIR)
+    if (kind < REB_PAIR and not Is_Scalar_With_Node(kind, v))
         return;
 
   #if !defined(NDEBUG)  // see Queue_Mark_Node_Deep() for notes on recursion
@@ -280,21 +334,85 @@ static void Queue_Mark_Opt_End_Cell_Deep(const RELVAL *v)
 }
 
 
+// Marking a cell usually touches a node somewhere else in the pool (to see
+// if it's marked, and mark it), which is a cache miss.  So cells are put
+// into a small FIFO when they are reached, with a prefetch of their node,
+// and only marked when they come out of it MARK_PREFETCH_DISTANCE cells
+// later.  By then the node has hopefully arrived in the cache.
 //
-//  Propagate_All_GC_Marks: C
+#define MARK_PREFETCH_DISTANCE 8
+
+struct Reb_Mark_Pending {
+    const RELVAL *cell;
+    REBARR *array;  // array the cell lives in
+};
+
+static void Mark_Pending_Cell(struct Reb_Mark_Pending *pending)
+{
+    const RELVAL *v = pending->cell;
+    Queue_Mark_Opt_Value_Deep(v);
+
+  #if !defined(NDEBUG)
+    //
+    // Nulls are illegal in most arrays, but context varlists use "nulled
+    // cells" to denote that the variable is not set.  Also reified C
+    // va_lists as Eval_Core() sources can have them.
+    //
+    REBARR *a = pending->array;
+    if (
+        KIND_BYTE_UNCHECKED(v) == REB_NULLED
+        and NOT_ARRAY_FLAG(a, IS_VARLIST)
+        and NOT_ARRAY_FLAG(a, NULLEDS_LEGAL)
+    ){
+        panic(a);
+    }
+  #else
+    UNUSED(pending->array);
+  #endif
+}
+
+
+//
+//  Propagate_GC_Marks: C
 //
 // The Mark Stack is a series containing series pointers.  They have already
 // had their SERIES_FLAG_MARK set to prevent being added to the stack multiple
 // times, but the items they can reach are not necessarily marked yet.
 //
 // Processing continues until all reachable items from the mark stack are
-// known to be marked.
+// known to be marked, or until `budget` arrays have been scanned (0 means
+// no limit).  Returns true if the stack was drained.
+//
+// The FIFO of pending cells is always emptied before returning, because the
+// evaluator may change the arrays between incremental slices.
 //
-static void Propagate_All_GC_Marks(void)
+static bool Propagate_GC_Marks(REBLEN budget)
 {
     assert(not in_mark);
 
-    while (SER_USED(GC_Mark_Stack) != 0) {
+    struct Reb_Mark_Pending pending[MARK_PREFETCH_DISTANCE];
+    REBLEN oldest = 0;  // position in `pending` of the next cell to mark
+    REBLEN num_pending = 0;
+
+    REBLEN scanned = 0;
+    while (SER_USED(GC_Mark_Stack) != 0 or num_pending != 0) {
+        bool out_of_budget = (budget != 0 and scanned == budget);
+        if (SER_USED(GC_Mark_Stack) == 0 or out_of_budget) {
+            //
+            // Nothing left to scan, or out of budget: mark the pending cells
+            // (which may queue more arrays, to scan if there's budget).
+            //
+            if (num_pending == 0) {
+                assert(out_of_budget);
+                return false;  // more to do, resume on next incremental slice
+            }
+            Mark_Pending_Cell(&pending[oldest]);
+            oldest = (oldest + 1) % MARK_PREFETCH_DISTANCE;
+            --num_pending;
+            continue;
+        }
+        ++scanned;
+
         SET_SERIES_USED(GC_Mark_Stack, SER_USED(GC_Mark_Stack) - 1);  // safe
 
         // Data pointer may change in response to an expansion during
@@ -314,30 +432,76 @@ static void Propagate_All_GC_Marks(void)
          //
         assert(SER(a)->header.bits & NODE_FLAG_MARKED);
 
-        RELVAL *v = ARR_HEAD(a);
-        for (; NOT_END(v); ++v) {
-            Queue_Mark_Opt_Value_Deep(v);
+        // Incremental marking lets the evaluator run while arrays are still
+        // pending, so one might have been FREE'd since it was queued.
+        //
+        if (GET_SERIES_INFO(a, INACCESSIBLE))
+            continue;
 
-          #if !defined(NDEBUG)
-            //
-            // Nulls are illegal in most arrays, but context varlists use
-            // "nulled cells" to denote that the variable is not set.  Also
-            // reified C va_lists as Eval_Core() sources can have them.
-            //
-            if (
-                KIND_BYTE_UNCHECKED(v) == REB_NULLED
-                and NOT_ARRAY_FLAG(a, IS_VARLIST)
-                and NOT_ARRAY_FLAG(a, NULLEDS_LEGAL)
-            ){
-                panic(a);
+        const RELVAL *v = ARR_HEAD(a);
+        for (; NOT_END(v); ++v) {
+            if (num_pending == MARK_PREFETCH_DISTANCE) {
+                Mark_Pending_Cell(&pending[oldest]);
+                oldest = (oldest + 1) % MARK_PREFETCH_DISTANCE;
+                --num_pending;
             }
-          #endif
+
+            if (v->header.bits & CELL_FLAG_FIRST_IS_NODE)
+                PREFETCH(PAYLOAD(Any, v).first.node);
+
+            REBLEN slot = (oldest + num_pending) % MARK_PREFETCH_DISTANCE;
+            pending[slot].cell = v;
+            pending[slot].array = a;
+            ++num_pending;
         }
 
       #if !defined(NDEBUG)
+        //
+        // The debug build marks the pending cells before checking the array,
+        // so the check sees all of them marked.  (This means the prefetching
+        // only overlaps marking within an array in debug builds.)
+        //
+        for (; num_pending != 0; --num_pending) {
+            Mark_Pending_Cell(&pending[oldest]);
+            oldest = (oldest + 1) % MARK_PREFETCH_DISTANCE;
+        }
         Assert_Array_Marked_Correctly(a);
       #endif
     }
+
+    return true;
+}
+
+// The mark routines for each category of root propagate when they finish,
+// but Start_Incremental_Mark() wants to leave that to the later slices.
+//
+static REB_INSTANCE_VAR bool defer_propagation = false;
+
+#define Propagate_All_GC_Marks() \
+    cast(void, defer_propagation or Propagate_GC_Marks(0))
+
+
+// Contexts, paramlists and maps have their slots written in place by too many
+// routines to put the Note_Series_Mutation() barrier on all of them.  So when
+// a GC mode skips tracing a series it visited before (an old series in a
+// minor recycle, or one already marked by incremental slices), these must be
+// traced again as roots.  Non-arrays only matter with LINK()/MISC() nodes.
+//
+inline static bool Needs_Rescan_As_Root(REBSER *s)
+{
+    if (GET_SERIES_INFO(s, GC_REMEMBERED))
+        return true;
+
+    if (IS_SER_ARRAY(s) and (
+        GET_ARRAY_FLAG(s, IS_VARLIST)
+        or GET_ARRAY_FLAG(s, IS_PARAMLIST)
+        or GET_ARRAY_FLAG(s, IS_PAIRLIST)
+    )){
+        return true;
+    }
+
+    return GET_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK)
+        or GET_SERIES_FLAG(s, MISC_NODE_NEEDS_MARK);
 }
 
 
@@ -491,7 +655,7 @@ static void Mark_Root_Series(void)
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER *, seg + 1);
         REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = Seg_Units(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
             //
             // !!! A smarter switch statement here could do this more
             // optimally...see the sweep code for an example.
@@ -545,6 +709,17 @@ static void Mark_Root_Series(void)
                 if (s->header.bits & NODE_FLAG_STACK)
                     assert(!"stack pairings not believed to exist");
 
+                if (GC_Minor and (s->header.bits & NODE_FLAG_MANAGED)) {
+                    //
+                    // Pairings have no info bits to say if they are old, and
+                    // are never freed by a minor recycle.  Since the value
+                    // holding one may be old (hence not traced), treat its
+                    // cells as roots so nothing young they refer to is lost.
+                    //
+                    Queue_Mark_Pairing_Deep(cast(REBVAL*, s));
+                    continue;
+                }
+
                 if (s->header.bits & NODE_FLAG_MANAGED)
                     continue; // PAIR! or other value will mark it
 
@@ -554,6 +729,29 @@ static void Mark_Root_Series(void)
                 Queue_Mark_Opt_Value_Deep(PAIRING_KEY(paired));
             }
 
+            if (GC_Marking and (s->header.bits & NODE_FLAG_MARKED)) {
+                //
+                // Finishing an incremental mark: this series was marked by
+                // an earlier slice, and the evaluator may have written into
+                // it since.  Roots like the frame stack are re-marked after
+                // this, but anything only reachable through a mutated series
+                // needs that series scanned again.
+                //
+                if (Needs_Rescan_As_Root(s))
+                    Queue_Mark_Series_Core(s);
+                continue;
+            }
+
+            if (GC_Minor and GET_SERIES_INFO(s, GC_OLD)) {
+                //
+                // A minor recycle does not trace old series, so those which
+                // may refer to younger ones must be traced as roots.
+                //
+                if (Needs_Rescan_As_Root(s))
+                    Queue_Mark_Series_Core(s);
+                continue;
+            }
+
             if (IS_SER_ARRAY(s)) {
                 if (s->header.bits & (NODE_FLAG_MANAGED | NODE_FLAG_STACK))
                     continue; // BLOCK!, Mark_Frame_Stack_Deep() etc. mark it
@@ -607,12 +805,12 @@ static void Mark_Root_Series(void)
 // values are not END markers, they are considered fine as far as a NOT_END()
 // test is concerned to indicate unused capacity.  So the values are good
 // for the testing purpose, yet the GC doesn't want to consider those to be
-// "live" references.  So rather than to a full Queue_Mark_Array_Deep() on
-// the capacity of the data stack's underlying array, it begins at DS_TOP.
+// "live" references.  So rather than marking the data stack's full capacity,
+// it begins at DS_TOP.
 //
 static void Mark_Data_Stack(void)
 {
-    REBVAL *head = KNOWN(ARR_HEAD(DS_Array));
+    REBVAL *head = DS_Head;
     ASSERT_UNREADABLE_IF_DEBUG(head);  // DS_AT(0) is deliberately invalid
 
     REBVAL *stackval = DS_TOP;
@@ -688,6 +886,172 @@ static void Mark_Guarded_Nodes(void)
 }
 
 
+//
+//  Mark_Frozen_Externals: C
+//
+// Series in the frozen heap are never traced, so the nodes they reference
+// outside of it were recorded by Freeze_Into_Heap() and are marked from here.
+//
+static void Mark_Frozen_Externals(void)
+{
+    REBNOD **np = SER_HEAD(REBNOD*, GC_Frozen_Externals);
+    REBLEN n = SER_USED(GC_Frozen_Externals);
+    for (; n > 0; --n, ++np)
+        Queue_Mark_Node_Deep(*np);  // pairings and series alike
+
+    Propagate_All_GC_Marks();
+}
+
+
+// Record a node that the frozen heap references but which can't be moved
+// into it.  Series are colored black so each is only recorded once per
+// freeze, returning false if it was already seen.
+//
+static bool Note_Frozen_External(REBNOD *node)
+{
+    if (not (node->header.bits & NODE_FLAG_CELL)) {
+        REBSER *s = SER(node);
+        if (GET_SERIES_INFO(s, BLACK))
+            return false;
+        Flip_Series_To_Black(s);
+    }
+
+    if (SER_FULL(GC_Frozen_Externals))
+        Extend_Series(GC_Frozen_Externals, 8);
+    *SER_AT(REBNOD*, GC_Frozen_Externals, SER_USED(GC_Frozen_Externals))
+        = node;
+    SET_SERIES_USED(GC_Frozen_Externals, SER_USED(GC_Frozen_Externals) + 1);
+    return true;
+}
+
+
+static void Freeze_Node_Into_Heap(REBNOD *node);
+
+static void Freeze_Cell_Into_Heap(const RELVAL *v)
+{
+    enum Reb_Kind kind = CELL_KIND_UNCHECKED(v);
+    if (kind < REB_PAIR and not Is_Scalar_With_Node(kind, v))
+        return;  // no nodes, see Queue_Mark_Opt_End_Cell_Deep()
+
+    if (IS_BINDABLE_KIND(kind)) {
+        REBNOD *binding = EXTRA(Binding, v).node;
+        if (binding != UNBOUND and (binding->header.bits & NODE_FLAG_MANAGED))
+            Note_Frozen_External(binding);
+    }
+
+    if (GET_CELL_FLAG(v, FIRST_IS_NODE) and PAYLOAD(Any, v).first.node)
+        Freeze_Node_Into_Heap(PAYLOAD(Any, v).first.node);
+
+    if (GET_CELL_FLAG(v, SECOND_IS_NODE) and PAYLOAD(Any, v).second.node)
+        Freeze_Node_Into_Heap(PAYLOAD(Any, v).second.node);
+}
+
+
+// Only plain frozen series can move.  Varlists, paramlists and pairlists
+// have LINK() and MISC() that the GC interprets by their flavor, symbols
+// are GC'd and chained to their synonyms, and API handles are roots.
+//
+static void Freeze_Node_Into_Heap(REBNOD *node)
+{
+    if (node->header.bits & NODE_FLAG_CELL) {  // pairing
+        Note_Frozen_External(node);
+        return;
+    }
+
+    REBSER *s = SER(node);
+    if (s->header.bits & SERIES_FLAG_FROZEN_HEAP)
+        return;
+
+    if (
+        NOT_SERIES_FLAG(s, MANAGED)
+        or GET_SERIES_FLAG(s, ROOT)
+        or NOT_SERIES_INFO(s, FROZEN)
+        or GET_SERIES_INFO(s, INACCESSIBLE)
+        or (IS_SER_STRING(s) and IS_STR_SYMBOL(s))
+        or (IS_SER_ARRAY(s) and (s->header.bits & (
+            ARRAY_FLAG_IS_VARLIST
+                | ARRAY_FLAG_IS_PARAMLIST
+                | ARRAY_FLAG_IS_PAIRLIST
+        )))
+    ){
+        if (
+            Note_Frozen_External(node)
+            and IS_SER_ARRAY(s)
+            and GET_ARRAY_FLAG(s, IS_VARLIST)
+            and GET_SERIES_INFO(s, FROZEN)
+        ){
+            RELVAL *var = ARR_HEAD(ARR(s)) + 1;  // skip the archetype
+            for (; NOT_END(var); ++var)
+                Freeze_Cell_Into_Heap(var);  // frozen object's fields can go
+        }
+        return;
+    }
+
+    s->header.bits |= SERIES_FLAG_FROZEN_HEAP;
+
+    if (GET_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK) and LINK(s).custom.node)
+        Note_Frozen_External(LINK(s).custom.node);  // e.g. file of an array
+    if (GET_SERIES_FLAG(s, MISC_NODE_NEEDS_MARK) and MISC(s).custom.node)
+        Note_Frozen_External(MISC(s).custom.node);
+
+    if (IS_SER_ARRAY(s)) {
+        RELVAL *item = ARR_HEAD(ARR(s));
+        for (; NOT_END(item); ++item)
+            Freeze_Cell_Into_Heap(item);
+    }
+}
+
+
+//
+//  Freeze_Into_Heap: C
+//
+// Move the series of an already deeply frozen value into the frozen heap.
+// The GC won't trace or free them again, so a recycle costs nothing for them
+// however large they are, and they take no write barriers (being frozen, no
+// write to them succeeds).  The price is that they are kept for the rest of
+// the session even once nothing refers to them.
+//
+// What they reference that can't join them (contexts, actions, symbols, and
+// series that aren't frozen) goes into GC_Frozen_Externals, which is marked
+// as a root instead.
+//
+void Freeze_Into_Heap(const RELVAL *v)
+{
+    REBLEN old_used = SER_USED(GC_Frozen_Externals);
+
+    Freeze_Cell_Into_Heap(v);
+
+    REBNOD **np = SER_AT(REBNOD*, GC_Frozen_Externals, old_used);
+    REBLEN n = SER_USED(GC_Frozen_Externals) - old_used;
+    for (; n > 0; --n, ++np) {
+        if (not ((*np)->header.bits & NODE_FLAG_CELL))
+            Flip_Series_To_White(SER(*np));
+    }
+}
+
+
+//
+//  Thaw_Frozen_Heap: C
+//
+// Return the frozen heap's series to the GC's management, for the shutdown
+// recycle which must free everything.
+//
+static void Thaw_Frozen_Heap(void)
+{
+    REBSEG *seg = Mem_Pools[SER_POOL].segs;
+    for (; seg != nullptr; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBLEN n = Seg_Units(&Mem_Pools[SER_POOL], seg);
+        for (; n > 0; --n, ++s) {
+            if (IS_FREE_NODE(s) or (s->header.bits & NODE_FLAG_CELL))
+                continue;
+            s->header.bits &= ~SERIES_FLAG_FROZEN_HEAP;
+        }
+    }
+    SET_SERIES_USED(GC_Frozen_Externals, 0);
+}
+
+
 //
 //  Mark_Frame_Stack_Deep: C
 //
@@ -859,114 +1223,154 @@ static void Mark_Frame_Stack_Deep(void)
 
 
 //
-//  Sweep_Series: C
+//  Sweep_Series_Segment: C
 //
-// Scans all series nodes (REBSER structs) in all segments that are part of
-// the SER_POOL.  If a series had its lifetime management delegated to the
-// garbage collector with Manage_Series(), then if it didn't get "marked" as
-// live during the marking phase then free it.
+// Sweep one segment of the SER_POOL, returning how many nodes were freed.
 //
-static REBLEN Sweep_Series(void)
+// This is the unit of work for the sweep: it only reads the header byte of
+// each node, then either clears the mark or frees the node.  Segments could
+// in principle be partitioned across threads.  But freeing a series runs
+// Decay_Series(), which returns data to the other pools through their
+// shared free lists and may call HANDLE! cleanup functions.  None of that
+// is thread-safe while the interpreter state is global, so it's serial.
+//
+static REBLEN Sweep_Series_Segment(REBSEG *seg)
 {
     REBLEN count = 0;
+    REBLEN n = Seg_Units(&Mem_Pools[SER_POOL], seg);
 
-    REBSEG *seg = Mem_Pools[SER_POOL].segs;
-    for (; seg != nullptr; seg = seg->next) {
-        REBLEN n = Mem_Pools[SER_POOL].units;
-
-        // We use a generic byte pointer (unsigned char*) to dodge the rules
-        // for strict aliasing, as the pool may contain pairs of REBVAL from
-        // Alloc_Pairing(), or a REBSER from Alloc_Series_Node().  The shared
-        // first byte node masks are defined and explained in %sys-rebnod.h
-        //
-        // NOTE: If you are using a build with UNUSUAL_REBVAL_SIZE such as
-        // DEBUG_TRACK_EXTEND_CELLS, then this will be processing the REBSER
-        // nodes only--see loop lower down for the pairing pool enumeration.
-
-        REBYTE *bp = cast(REBYTE*, seg + 1);
-
-        for (; n > 0; --n, bp += sizeof(REBSER)) {
-            switch (*bp >> 4) {
-              case 0:
-              case 1:  // 0x1
-              case 2:  // 0x2
-              case 3:  // 0x2 + 0x1
-              case 4:  // 0x4
-              case 5:  // 0x4 + 0x1
-              case 6:  // 0x4 + 0x2
-              case 7:  // 0x4 + 0x2 + 0x1
-                //
-                // NODE_FLAG_NODE (0x8) is clear.  This signature is
-                // reserved for UTF-8 strings (corresponding to valid ASCII
-                // values in the first byte).
-                //
-                panic (bp);
+    // We use a generic byte pointer (unsigned char*) to dodge the rules
+    // for strict aliasing, as the pool may contain pairs of REBVAL from
+    // Alloc_Pairing(), or a REBSER from Alloc_Series_Node().  The shared
+    // first byte node masks are defined and explained in %sys-rebnod.h
+    //
+    // NOTE: If you are using a build with UNUSUAL_REBVAL_SIZE such as
+    // DEBUG_TRACK_EXTEND_CELLS, then this will be processing the REBSER
+    // nodes only--see Sweep_Series() for the pairing pool enumeration.
+
+    REBYTE *bp = cast(REBYTE*, seg + 1);
+
+    for (; n > 0; --n, bp += sizeof(REBSER)) {
+        switch (*bp >> 4) {
+          case 0:
+          case 1:  // 0x1
+          case 2:  // 0x2
+          case 3:  // 0x2 + 0x1
+          case 4:  // 0x4
+          case 5:  // 0x4 + 0x1
+          case 6:  // 0x4 + 0x2
+          case 7:  // 0x4 + 0x2 + 0x1
+            //
+            // NODE_FLAG_NODE (0x8) is clear.  This signature is
+            // reserved for UTF-8 strings (corresponding to valid ASCII
+            // values in the first byte).
+            //
+            panic (bp);
 
-            // v-- Everything below here has NODE_FLAG_NODE set (0x8)
+        // v-- Everything below here has NODE_FLAG_NODE set (0x8)
 
-              case 8:
-                // 0x8: unmanaged and unmarked, e.g. a series that was made
-                // with Make_Series() and hasn't been managed.  It doesn't
-                // participate in the GC.  Leave it as is.
-                //
-                // !!! Are there actually legitimate reasons to do this with
-                // arrays, where the creator knows the cells do not need
-                // GC protection?  Should finding an array in this state be
-                // considered a problem (e.g. the GC ran when you thought it
-                // couldn't run yet, hence would be able to free the array?)
-                //
-                break;
+          case 8:
+            // 0x8: unmanaged and unmarked, e.g. a series that was made
+            // with Make_Series() and hasn't been managed.  It doesn't
+            // participate in the GC.  Leave it as is.
+            //
+            // !!! Are there actually legitimate reasons to do this with
+            // arrays, where the creator knows the cells do not need
+            // GC protection?  Should finding an array in this state be
+            // considered a problem (e.g. the GC ran when you thought it
+            // couldn't run yet, hence would be able to free the array?)
+            //
+            break;
 
-              case 9:
-                // 0x8 + 0x1: marked but not managed, this can't happen,
-                // because the marking itself asserts nodes are managed.
-                //
-                panic (bp);
+          case 9:
+            // 0x8 + 0x1: marked but not managed, this can't happen,
+            // because the marking itself asserts nodes are managed.
+            //
+            panic (bp);
 
-              case 10:
-                // 0x8 + 0x2: managed but didn't get marked, should be GC'd
-                //
-                // !!! It would be nice if we could have NODE_FLAG_CELL here
-                // as part of the switch, but see its definition for why it
-                // is at position 8 from left and not an earlier bit.
-                //
-                if (*bp & NODE_BYTEMASK_0x01_CELL) {
-                    assert(not (*bp & NODE_BYTEMASK_0x04_ROOT));
-                    Free_Node(SER_POOL, NOD(bp));  // Free_Pairing for manuals
-                }
-                else {
-                    REBSER *s = cast(REBSER*, bp);
-                    GC_Kill_Series(s);
+          case 10:
+            // 0x8 + 0x2: managed but didn't get marked, should be GC'd
+            //
+            // !!! It would be nice if we could have NODE_FLAG_CELL here
+            // as part of the switch, but see its definition for why it
+            // is at position 8 from left and not an earlier bit.
+            //
+            if (*bp & NODE_BYTEMASK_0x01_CELL) {
+                assert(not (*bp & NODE_BYTEMASK_0x04_ROOT));
+                if (GC_Minor)
+                    break;  // pairings can't be known young, keep them
+                Free_Node(SER_POOL, NOD(bp));  // Free_Pairing for manuals
+            }
+            else {
+                if (*bp & NODE_BYTEMASK_0x08_FROZEN_HEAP)
+                    break;  // not marked because it is never traced
+                REBSER *s = cast(REBSER*, bp);
+                if (GC_Minor and GET_SERIES_INFO(s, GC_OLD)) {
+                    CLEAR_SERIES_INFO(s, GC_REMEMBERED);
+                    break;  // old series not traced, not known dead
                 }
-                ++count;
-                break;
+                GC_Kill_Series(s);
+            }
+            ++count;
+            break;
 
-              case 11:
-                // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
-                // Don't GC it, just clear the mark.
-                //
-                *bp &= ~NODE_BYTEMASK_0x10_MARKED;
-                break;
+          case 11:
+            // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
+            // Don't GC it, just clear the mark.  In generational mode a
+            // surviving series is promoted to old, and anything it was
+            // remembered for has now been promoted with it.
+            //
+            *bp &= ~NODE_BYTEMASK_0x10_MARKED;
+            if (not (*bp & NODE_BYTEMASK_0x01_CELL)) {
+                REBSER *s = cast(REBSER*, bp);
+                CLEAR_SERIES_INFO(s, GC_REMEMBERED);
+                if (not Tracking_Generations())
+                    CLEAR_SERIES_INFO(s, GC_OLD);
+                else if (NOT_SERIES_INFO(s, GC_OLD)) {
+                    SET_SERIES_INFO(s, GC_OLD);
+                    ++GC_Stats.Promoted;
+                }
+            }
+            break;
 
-            // v-- Everything below this line has the two leftmost bits set
-            // in the header.  In the *general* case this could be a valid
-            // first byte of a multi-byte sequence in UTF-8...so only the
-            // special bit pattern of the free case uses this.
+        // v-- Everything below this line has the two leftmost bits set
+        // in the header.  In the *general* case this could be a valid
+        // first byte of a multi-byte sequence in UTF-8...so only the
+        // special bit pattern of the free case uses this.
 
-              case 12:
-                // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
-                //
-                assert(*bp == FREED_SERIES_BYTE);
-                break;
+          case 12:
+            // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
+            //
+            assert(*bp == FREED_SERIES_BYTE);
+            break;
 
-              case 13:
-              case 14:
-              case 15:
-                panic (bp);  // 0x8 + 0x4 + ... reserved for UTF-8
-            }
+          case 13:
+          case 14:
+          case 15:
+            panic (bp);  // 0x8 + 0x4 + ... reserved for UTF-8
         }
     }
 
+    return count;
+}
+
+
+//
+//  Sweep_Series: C
+//
+// Scans all series nodes (REBSER structs) in all segments that are part of
+// the SER_POOL.  If a series had its lifetime management delegated to the
+// garbage collector with Manage_Series(), then if it didn't get "marked" as
+// live during the marking phase then free it.
+//
+static REBLEN Sweep_Series(void)
+{
+    REBLEN count = 0;
+
+    REBSEG *seg = Mem_Pools[SER_POOL].segs;
+    for (; seg != nullptr; seg = seg->next)
+        count += Sweep_Series_Segment(seg);
+
     // For efficiency of memory use, REBSER is nominally defined as
     // 2*sizeof(REBVAL), and so pairs can use the same nodes.  But features
     // that might make the cells a size greater than REBSER size require
@@ -975,7 +1379,7 @@ static REBLEN Sweep_Series(void)
   #ifdef UNUSUAL_REBVAL_SIZE
     for (seg = Mem_Pools[PAR_POOL].segs; seg != NULL; seg = seg->next) {
         REBVAL *v = cast(REBVAL*, seg + 1);
-        REBLEN n = Mem_Pools[PAR_POOL].units;
+        REBLEN n = Seg_Units(&Mem_Pools[PAR_POOL], seg);
         for (; n > 0; --n, v += 2) {
             if (v->header.bits & NODE_FLAG_FREE) {
                 assert(FIRST_BYTE(v->header) == FREED_SERIES_BYTE);
@@ -1017,7 +1421,7 @@ REBLEN Fill_Sweeplist(REBSER *sweeplist)
     for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = Seg_Units(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
             switch (FIRST_BYTE(s->header) >> 4) {
             case 9: // 0x8 + 0x1
                 ASSERT_SERIES_MANAGED(s);
@@ -1056,6 +1460,88 @@ REBLEN Fill_Sweeplist(REBSER *sweeplist)
 #endif
 
 
+//
+//  Mem_In_Use: C
+//
+// Bytes held by live allocations.  PG_Mem_Usage counts whole pool segments,
+// which the pools never give back, so subtract the units that are free.
+//
+static REBI64 Mem_In_Use(void)
+{
+    REBI64 bytes = cast(REBI64, PG_Mem_Usage);
+
+    REBLEN n;
+    for (n = 0; n < SYSTEM_POOL; ++n)
+        bytes -= cast(REBI64, Mem_Pools[n].free) * Mem_Pools[n].wide;
+
+    return bytes;
+}
+
+
+static REB_INSTANCE_VAR clock_t last_recycle_end;  // share of time in GC
+
+
+//
+//  Reset_Ballast: C
+//
+// Choose how many bytes may be allocated before the next automatic recycle,
+// according to GC_Policy:
+//
+// * SYM_FIXED - Always TG_Ballast, as in R3-Alpha.  A process with a large
+//   live heap recycles just as often as a small one, so each recycle is a
+//   larger fraction of the run time.
+//
+// * SYM_PROPORTIONAL - GC_Growth percent of the bytes that survived, so
+//   memory may grow to (100 + GC_Growth)% of the live heap before the next
+//   recycle.  TG_Ballast is used as the minimum.
+//
+// * SYM_PAUSE - Start from the previous ballast, doubling it if the last
+//   recycle took more than GC_Target percent of the time since the one
+//   before, and halving it if it took less than half of that.
+//
+// All policies are capped at MEM_BALLAST_MAX.
+//
+static void Reset_Ballast(REBI64 bytes_before, REBI64 usecs, clock_t start)
+{
+    REBI64 live = Mem_In_Use();
+    GC_Stats.Live_Bytes = live;
+    GC_Stats.Survival_Percent = bytes_before <= 0
+        ? 100
+        : cast(REBLEN, (live * 100) / bytes_before);
+
+    REBI64 ballast;
+    switch (GC_Policy) {
+      case SYM_PROPORTIONAL:
+        ballast = (live / 100) * GC_Growth;
+        break;
+
+      case SYM_PAUSE: {
+        REBI64 between = cast(REBI64,
+            (start - last_recycle_end) * cast(REBI64, 1000000) / CLOCKS_PER_SEC
+        );
+        ballast = GC_Stats.Trigger != 0 ? GC_Stats.Trigger : TG_Ballast;
+        if (usecs * 100 > (between + usecs) * GC_Target)
+            ballast *= 2;  // too much time in the GC, recycle less often
+        else if (usecs * 200 < (between + usecs) * GC_Target)
+            ballast /= 2;
+        break; }
+
+      default:
+        assert(GC_Policy == SYM_FIXED);
+        ballast = TG_Ballast;
+        break;
+    }
+
+    if (ballast < TG_Ballast)
+        ballast = TG_Ballast;
+    if (ballast > MEM_BALLAST_MAX)
+        ballast = MEM_BALLAST_MAX;
+
+    GC_Ballast = cast(REBINT, ballast);
+    GC_Stats.Trigger = ballast;
+}
+
+
 //
 //  Recycle_Core: C
 //
@@ -1065,6 +1551,14 @@ REBLEN Fill_Sweeplist(REBSER *sweeplist)
 //
 REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
 {
+    // A minor recycle is requested by setting GC_Minor before the call (see
+    // Recycle_Auto()).  It's a one-shot request, and only honored when old
+    // series are being tracked and a full sweep is being done.
+    //
+    bool minor = GC_Minor and Tracking_Generations() and not GC_Marking
+        and not shutdown and sweeplist == nullptr;
+    GC_Minor = false;
+
     // Ordinarily, it should not be possible to spawn a recycle during a
     // recycle.  But when debug code is added into the recycling code, it
     // could cause a recursion.  Be tolerant of such recursions to make that
@@ -1100,7 +1594,15 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     GC_Recycling = true;
   #endif
 
-    ASSERT_NO_GC_MARKS_PENDING();
+    GC_Minor = minor;  // consulted by the mark and sweep routines
+    clock_t start = clock();
+    REBI64 bytes_before = Mem_In_Use();
+
+    if (GC_Marking and shutdown)
+        Abandon_Incremental_Mark();
+
+    if (not GC_Marking)  // else slices may have left arrays on the stack
+        ASSERT_NO_GC_MARKS_PENDING();
     Reify_Any_C_Valist_Frames();
 
   #if !defined(NDEBUG)
@@ -1118,11 +1620,23 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     // The TG_Reuse list consists of entries which could grow to arbitrary
     // length, and which aren't being tracked anywhere.  Cull them during GC
     // in case the stack at one point got very deep and isn't going to use
-    // them again, and the memory needs reclaiming.
+    // them again, and the memory needs reclaiming.  (A few small ones are
+    // kept, see REUSE_KEEP_MAX.)
     //
-    while (TG_Reuse) {
-        REBARR *varlist = TG_Reuse;
-        TG_Reuse = LINK(TG_Reuse).reuse;
+    REBLEN reuse_kept = 0;
+    REBARR **reuse_link = &TG_Reuse;
+    while (*reuse_link) {
+        REBARR *varlist = *reuse_link;
+        if (
+            not shutdown
+            and reuse_kept < REUSE_KEEP_MAX
+            and SER_REST(varlist) <= REUSE_KEEP_CELLS
+        ){
+            ++reuse_kept;
+            reuse_link = &LINK(varlist).reuse;
+            continue;
+        }
+        *reuse_link = LINK(varlist).reuse;
         GC_Kill_Series(SER(varlist)); // no track for Free_Unmanaged_Series()
     }
 
@@ -1133,6 +1647,7 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     // are bound to frames will be freed, if the frame is expired.)
     //
     Mark_Root_Series();
+    GC_Marking = false;  // rescans of incrementally marked series are done
 
     if (not shutdown) {
         Mark_Natives();
@@ -1141,6 +1656,7 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
         Mark_Data_Stack();
 
         Mark_Guarded_Nodes();
+        Mark_Frozen_Externals();
 
         Mark_Frame_Stack_Deep();
 
@@ -1151,7 +1667,11 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
 
     // SWEEPING PHASE
 
+    if (shutdown)
+        Thaw_Frozen_Heap();  // so its series are freed like any others
+
     ASSERT_NO_GC_MARKS_PENDING();
+    clock_t sweep_start = clock();
 
     REBLEN count = 0;
 
@@ -1162,9 +1682,30 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
         count += Fill_Sweeplist(sweeplist);
     #endif
     }
-    else
+    else {
         count += Sweep_Series();
 
+        // Freed keylist nodes may be reused by new keylists, which would
+        // make stale answers look like hits (even a minor recycle frees).
+        //
+        Invalidate_Override_Cache();
+
+        // Handles released early in a rebPushScope() leave their node in
+        // the scope's list, and the segment holding it may be released next.
+        //
+        Prune_Scoped_Api_Handles();
+
+        // A minor recycle doesn't free old nodes, so is unlikely to empty a
+        // whole segment.  Leave releasing memory to the major recycles.
+        //
+        if (not minor and not shutdown) {
+            GC_Stats.Released_Bytes += Release_Free_Segments(SER_POOL);
+          #ifdef UNUSUAL_REBVAL_SIZE
+            GC_Stats.Released_Bytes += Release_Free_Segments(PAR_POOL);
+          #endif
+        }
+    }
+
 #if !defined(NDEBUG)
     // Compute new stats:
     PG_Reb_Stats->Recycle_Series
@@ -1184,11 +1725,48 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     // Reverted to the R3-Alpha state, accommodating a comment "do not adjust
     // task variables or boot strings in shutdown when they are being freed."
     //
+    // That fixed reset is still the default, but RECYCLE/POLICY can select
+    // a ballast that scales with the live heap or with the time spent in GC.
+    //
+    clock_t end = clock();
+    REBI64 usecs = cast(REBI64,
+        (end - start) * cast(REBI64, 1000000) / CLOCKS_PER_SEC
+    );
+    GC_Stats.Mark_Usecs += cast(REBI64,
+        (sweep_start - start) * cast(REBI64, 1000000) / CLOCKS_PER_SEC
+    );
+    GC_Stats.Sweep_Usecs += cast(REBI64,
+        (end - sweep_start) * cast(REBI64, 1000000) / CLOCKS_PER_SEC
+    );
+    GC_Stats.Pauses[GC_Stats.Pause_Count % GC_PAUSE_HISTORY] = usecs;
+    ++GC_Stats.Pause_Count;
+
     if (not shutdown)
-        GC_Ballast = TG_Ballast;
+        Reset_Ballast(bytes_before, usecs, start);
+    last_recycle_end = end;
+
+    REBLEN pool_id;
+    for (pool_id = 0; pool_id < SYSTEM_POOL; ++pool_id)
+        Mem_Pools[pool_id].fills_since_recycle = 0;  // see Fill_Pool()
 
     ASSERT_NO_GC_MARKS_PENDING();
 
+    if (minor) {
+        ++GC_Stats.Minor_Count;
+        GC_Stats.Minor_Usecs += usecs;
+        if (usecs > GC_Stats.Max_Minor_Usecs)
+            GC_Stats.Max_Minor_Usecs = usecs;
+        ++GC_Minors_Since_Major;
+    }
+    else {
+        ++GC_Stats.Major_Count;
+        GC_Stats.Major_Usecs += usecs;
+        if (usecs > GC_Stats.Max_Major_Usecs)
+            GC_Stats.Max_Major_Usecs = usecs;
+        GC_Minors_Since_Major = 0;
+    }
+    GC_Minor = false;
+
   #if !defined(NDEBUG)
     GC_Recycling = false;
   #endif
@@ -1236,6 +1814,331 @@ REBLEN Recycle(void)
 }
 
 
+//
+//  Abandon_Incremental_Mark: C
+//
+// Throw away the progress of an incremental mark, clearing the marks it made.
+// Used at shutdown, where the marks would keep everything from being freed.
+//
+static void Abandon_Incremental_Mark(void)
+{
+    SET_SERIES_USED(GC_Mark_Stack, 0);
+
+    REBSEG *seg = Mem_Pools[SER_POOL].segs;
+    for (; seg != nullptr; seg = seg->next) {
+        REBYTE *bp = cast(REBYTE*, seg + 1);
+        REBLEN n = Seg_Units(&Mem_Pools[SER_POOL], seg);
+        for (; n > 0; --n, bp += sizeof(REBSER)) {
+            if (*bp != FREED_SERIES_BYTE)
+                *bp &= ~NODE_BYTEMASK_0x10_MARKED;
+        }
+    }
+
+    GC_Marking = false;
+}
+
+
+//
+//  Start_Incremental_Mark: C
+//
+// Queue everything reachable from the stacks, natives, and guarded nodes,
+// but don't propagate the marks.  The evaluator then runs as usual, with
+// Recycle_Auto() doing a bounded slice of propagation each time it is
+// signaled, until the stack is drained and a Recycle() finishes the job.
+//
+// Mark_Root_Series() is not run here, since it walks the whole pool and has
+// to be run at the end anyway to find any series written since being marked.
+//
+static void Start_Incremental_Mark(void)
+{
+    ASSERT_NO_GC_MARKS_PENDING();
+    Reify_Any_C_Valist_Frames();
+
+    defer_propagation = true;
+    Mark_Natives();
+    Mark_Symbol_Series();
+    Mark_Data_Stack();
+    Mark_Guarded_Nodes();
+    Mark_Frozen_Externals();
+    Mark_Frame_Stack_Deep();
+    Mark_Devices_Deep();
+    defer_propagation = false;
+
+    GC_Marking = true;
+}
+
+
+//
+//  Recycle_Auto: C
+//
+// Recycle requested by the evaluator because the ballast ran out.  If the
+// GC is in generational mode (RECYCLE/GENERATIONAL) this will usually be a
+// minor recycle that only traces and frees series not yet promoted to old.
+// Every GC_MAX_MINORS minors a major recycle is done instead, so that old
+// series which became garbage are eventually reclaimed.
+//
+// If RECYCLE/INCREMENTAL set a slice budget, a major recycle is instead
+// spread out.  Each call marks at most GC_Slice_Budget arrays and re-sets
+// SIG_RECYCLE so it is called again on the next evaluator step.  Returns
+// the number of nodes freed, which is 0 until the final slice.
+//
+// Both modes depend on the write barrier, Note_Series_Mutation(), which is
+// on every path that appends to or changes an array (see notes on it).  Since
+// contexts and maps are written in place all over, they are always rescanned
+// instead.  Pairings have no info bits, and writing their cells can clear
+// their mark bit...they are assumed to be write-once.
+//
+// !!! Running the slices on a helper thread while the evaluator keeps going
+// would be a concurrent mark.  That isn't just a matter of a thread: the
+// mark bit lives in the same header word the mutator writes flags into,
+// cells are copied non-atomically by Move_Value(), and GC_Mark_Stack is
+// unsynchronized.  So that isn't done, and neither is incremental sweeping:
+// only the mark is split into slices, and the final slice still sweeps the
+// whole heap in one pause.  Pauses are shorter than a full recycle's, but
+// not bounded by the budget.
+//
+REBLEN Recycle_Auto(void)
+{
+    if (not GC_Marking) {
+        if (GC_Generational and GC_Minors_Since_Major < GC_MAX_MINORS) {
+            GC_Minor = true;
+            return Recycle();
+        }
+
+        if (GC_Slice_Budget == 0 or GC_Disabled)
+            return Recycle();
+
+        Start_Incremental_Mark();
+    }
+
+    clock_t start = clock();
+    bool drained = Propagate_GC_Marks(GC_Slice_Budget);
+
+    REBI64 usecs = cast(REBI64,
+        (clock() - start) * cast(REBI64, 1000000) / CLOCKS_PER_SEC
+    );
+    ++GC_Stats.Slice_Count;
+    if (usecs > GC_Stats.Max_Slice_Usecs)
+        GC_Stats.Max_Slice_Usecs = usecs;
+
+    if (drained)
+        return Recycle();  // rescans mutated series, re-marks roots, sweeps
+
+    SET_SIGNAL(SIG_RECYCLE);
+    return 0;
+}
+
+
+//
+//  Set_Generation_Bits: C
+//
+// Set or clear SERIES_INFO_GC_OLD on every managed series, clearing the
+// remembered bit either way.
+//
+static void Set_Generation_Bits(bool old)
+{
+    REBSEG *seg = Mem_Pools[SER_POOL].segs;
+    for (; seg != nullptr; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBLEN n = Seg_Units(&Mem_Pools[SER_POOL], seg);
+        for (; n > 0; --n, ++s) {
+            if (IS_FREE_NODE(s) or (s->header.bits & NODE_FLAG_CELL))
+                continue;
+            if (NOT_SERIES_FLAG(s, MANAGED))
+                continue;
+            CLEAR_SERIES_INFO(s, GC_REMEMBERED);
+            if (old)
+                SET_SERIES_INFO(s, GC_OLD);
+            else
+                CLEAR_SERIES_INFO(s, GC_OLD);
+        }
+    }
+}
+
+
+// Groups of roots that STATS/HEAP reports the retained size of.
+//
+static const char *Heap_Root_Names[] = {
+    "lib", "user", "api", "guarded", "stack", nullptr
+};
+
+
+// Total up the nodes marked since the last clearing (each is one REBSER in
+// size, plus the content of dynamic series), and clear their marks.
+//
+static void Total_And_Clear_Marks(
+    REBLEN pool_id,
+    REBI64 *count,
+    REBI64 *bytes
+){
+    REBSEG *seg = Mem_Pools[pool_id].segs;
+    for (; seg != nullptr; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBLEN n = Seg_Units(&Mem_Pools[pool_id], seg);
+        for (; n > 0; --n, ++s) {
+            if (IS_FREE_NODE(s))
+                continue;
+            if (not (s->header.bits & NODE_FLAG_MARKED))
+                continue;
+
+            ++*count;
+            *bytes += sizeof(REBSER);
+            if (not (s->header.bits & NODE_FLAG_CELL))  // not a pairing
+                *bytes += SER_TOTAL_IF_DYNAMIC(s);
+
+            *cast(REBYTE*, s) &= ~NODE_BYTEMASK_0x10_MARKED;
+        }
+    }
+}
+
+
+//
+//  Make_Heap_Roots_Array: C
+//
+// Flat block of `name count bytes` for STATS/HEAP, giving what is reachable
+// from each group of roots: the lib and user contexts, API handles, nodes
+// guarded with PUSH_GC_GUARD(), and the data and frame stacks.  This runs
+// the mark phase from each group alone and totals what got marked.
+//
+// A node reachable from more than one group is counted in each.  (Most
+// everything reaches the natives and symbols through lib, for instance.)
+//
+REBARR *Make_Heap_Roots_Array(void)
+{
+    assert(not GC_Recycling);
+
+    if (GC_Marking)  // an incremental mark's progress would be counted
+        Abandon_Incremental_Mark();  // harmless, next recycle starts over
+
+    ASSERT_NO_GC_MARKS_PENDING();
+    Reify_Any_C_Valist_Frames();
+
+    REBARR *a = Make_Array(5 * 3);  // no evaluation here, so no GC
+
+    REBLEN i;
+    for (i = 0; Heap_Root_Names[i] != nullptr; ++i) {
+        switch (i) {
+          case 0:
+            Queue_Mark_Node_Deep(CTX_VARLIST(Lib_Context));
+            break;
+
+          case 1: {
+            REBVAL *user = Get_System(SYS_CONTEXTS, CTX_USER);
+            if (ANY_CONTEXT(user))
+                Queue_Mark_Node_Deep(CTX_VARLIST(VAL_CONTEXT(user)));
+            break; }
+
+          case 2: {  // API handles (see Mark_Root_Series())
+            REBSEG *seg = Mem_Pools[SER_POOL].segs;
+            for (; seg != nullptr; seg = seg->next) {
+                REBSER *s = cast(REBSER*, seg + 1);
+                REBLEN n = Seg_Units(&Mem_Pools[SER_POOL], seg);
+                for (; n > 0; --n, ++s) {
+                    if (IS_FREE_NODE(s))
+                        continue;
+                    if (not (s->header.bits & NODE_FLAG_ROOT))
+                        continue;
+                    s->header.bits |= NODE_FLAG_MARKED;
+                    Queue_Mark_Opt_End_Cell_Deep(ARR_SINGLE(ARR(s)));
+                }
+            }
+            break; }
+
+          case 3:
+            Mark_Guarded_Nodes();
+            break;
+
+          case 4:
+            Mark_Data_Stack();
+            Mark_Frame_Stack_Deep();
+            break;
+
+          default:
+            assert(false);
+        }
+        Propagate_All_GC_Marks();
+
+        REBI64 count = 0;
+        REBI64 bytes = 0;
+        Total_And_Clear_Marks(SER_POOL, &count, &bytes);
+      #ifdef UNUSUAL_REBVAL_SIZE
+        Total_And_Clear_Marks(PAR_POOL, &count, &bytes);
+      #endif
+
+        const char *name = Heap_Root_Names[i];
+        Init_Word(
+            Alloc_Tail_Array(a),
+            Intern_UTF8_Managed(cb_cast(name), strlen(name))
+        );
+        Init_Integer(Alloc_Tail_Array(a), count);
+        Init_Integer(Alloc_Tail_Array(a), bytes);
+    }
+
+    return a;
+}
+
+
+//
+//  Push_Arena: C
+//
+// Begin a scope whose garbage can be freed all at once by Pop_Arena(), e.g.
+// the temporary blocks and strings made while handling one request.
+//
+// Rather than a separate allocator, this uses the generational machinery:
+// every series that exists is marked as old, so that anything made in the
+// scope is "young".  Mutations of old series in the scope are caught by the
+// write barrier, and Pop_Arena() runs a minor recycle which only traces and
+// frees the young series.  Those that escaped (are reachable from the old
+// series or the stack) survive and become ordinary series.
+//
+// So this is only as sound as the barrier.  Any new path that writes into
+// an existing array without FAIL_IF_READ_ONLY() or EXPAND_SERIES_TAIL() must
+// call Note_Series_Mutation(), or WITH-ARENA will free what it stored.
+//
+// Only the outermost arena does anything, inner ones are merged into it.
+//
+void Push_Arena(void)
+{
+    if (GC_Arena_Depth++ != 0)
+        return;
+
+    if (not GC_Generational)  // otherwise survivors were already promoted
+        Set_Generation_Bits(true);
+}
+
+
+//
+//  Pop_Arena: C
+//
+// End the scope started by Push_Arena(), returning the number of series
+// nodes freed.  The caller must ensure anything it wants to keep is on the
+// stack (e.g. in a frame's output cell) or referenced from an old series.
+//
+// Pass false for `collect` if in a thrown state (the GC may not run then),
+// in which case the arena's series are just left for the next recycle.
+//
+REBLEN Pop_Arena(bool collect)
+{
+    assert(GC_Arena_Depth != 0);
+    if (GC_Arena_Depth != 1) {
+        --GC_Arena_Depth;
+        return 0;
+    }
+
+    REBLEN count = 0;
+    if (collect) {
+        GC_Minor = true;
+        count = Recycle();  // minor, since Tracking_Generations()
+    }
+
+    --GC_Arena_Depth;
+    if (not GC_Generational)
+        Set_Generation_Bits(false);
+
+    return count;
+}
+
+
 //
 //  Push_Guard_Node: C
 //
@@ -1294,10 +2197,29 @@ void Startup_GC(void)
 
     GC_Ballast = MEM_BALLAST;
 
+    GC_Generational = false;
+    GC_Arena_Depth = 0;
+    GC_Minor = false;
+    GC_Minors_Since_Major = 0;
+    memset(&GC_Stats, 0, sizeof(GC_Stats));
+
+    GC_Slice_Budget = 0;  // incremental marking is off by default
+    GC_Marking = false;
+
+    GC_Policy = SYM_FIXED;
+    GC_Growth = GC_GROWTH_DEFAULT;
+    GC_Target = GC_TARGET_DEFAULT;
+    last_recycle_end = clock();
+
     // Temporary series and values protected from GC. Holds node pointers.
     //
     GC_Guarded = Make_Series(15, sizeof(REBNOD*));
 
+    // Nodes outside the frozen heap which series inside of it reference, see
+    // Freeze_Into_Heap().  Also holds node pointers.
+    //
+    GC_Frozen_Externals = Make_Series(15, sizeof(REBNOD*));
+
     // The marking queue used in lieu of recursion to ensure that deeply
     // nested structures don't cause the C stack to overflow.
     //
@@ -1312,6 +2234,7 @@ void Startup_GC(void)
 void Shutdown_GC(void)
 {
     Free_Unmanaged_Series(GC_Guarded);
+    Free_Unmanaged_Series(GC_Frozen_Externals);
     Free_Unmanaged_Series(GC_Mark_Stack);
 }
 
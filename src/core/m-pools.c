@@ -267,6 +267,29 @@ void Startup_Pools(REBINT scale)
         if (Mem_Pools[n].units < 2) Mem_Pools[n].units = 2;
         Mem_Pools[n].free = 0;
         Mem_Pools[n].has = 0;
+        Mem_Pools[n].fills = 0;
+        Mem_Pools[n].fills_since_recycle = 0;
+        Mem_Pools[n].allocs = 0;
+    }
+
+    // A workload that knows its allocation profile can give the starting
+    // units per segment for any pools, as `pool:units` pairs separated by
+    // commas (pool numbers are as shown by Dump_Pools()).  e.g. a program
+    // making millions of series nodes might use R3_POOL_PROFILE=24:65536
+    //
+    const char *env_profile = getenv("R3_POOL_PROFILE");
+    while (env_profile and *env_profile != '\0') {
+        char *end;
+        unsigned long pool_id = strtoul(env_profile, &end, 10);
+        if (end == env_profile or *end != ':')
+            break;  // malformed, ignore rest (no error reporting this early)
+        env_profile = end + 1;
+        unsigned long units = strtoul(env_profile, &end, 10);
+        if (end == env_profile)
+            break;
+        if (pool_id < SYSTEM_POOL and units >= 2)
+            Mem_Pools[pool_id].units = units;
+        env_profile = (*end == ',') ? end + 1 : end;
     }
 
     // For pool lookup. Maps size to pool index. (See Find_Pool below)
@@ -320,7 +343,8 @@ void Shutdown_Pools(void)
     for(; debug_seg != NULL; debug_seg = debug_seg->next) {
         REBSER *series = cast(REBSER*, debug_seg + 1);
         REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; n--, series++) {
+        n = Seg_Units(&Mem_Pools[SER_POOL], debug_seg);
+        for (; n > 0; n--, series++) {
             if (IS_FREE_NODE(series))
                 continue;
 
@@ -335,13 +359,12 @@ void Shutdown_Pools(void)
     REBLEN pool_num;
     for (pool_num = 0; pool_num < MAX_POOLS; pool_num++) {
         REBPOL *pool = &Mem_Pools[pool_num];
-        REBLEN mem_size = pool->wide * pool->units + sizeof(REBSEG);
 
         REBSEG *seg = pool->segs;
         while (seg) {
             REBSEG *next;
             next = seg->next;
-            FREE_N(char, mem_size, cast(char*, seg));
+            FREE_N(char, seg->size, cast(char*, seg));  // sizes vary
             seg = next;
         }
     }
@@ -391,6 +414,19 @@ void Shutdown_Pools(void)
 //
 void Fill_Pool(REBPOL *pool)
 {
+    // If a pool has to be filled more than once between recycles, it is
+    // growing, so grow its segments geometrically to amortize the fills.
+    // (Note: GC enumerations use Seg_Units(), since segment sizes differ.)
+    //
+    if (
+        pool->fills_since_recycle >= 2
+        and pool->wide * pool->units * 2 <= MEM_SEG_MAX
+    ){
+        pool->units *= 2;
+    }
+    ++pool->fills;
+    ++pool->fills_since_recycle;
+
     REBLEN units = pool->units;
     REBLEN mem_size = pool->wide * units + sizeof(REBSEG);
 
@@ -420,7 +456,9 @@ void Fill_Pool(REBPOL *pool)
     REBNOD *node = cast(REBNOD*, seg + 1);
 
     if (not pool->first) {
-        assert(not pool->last);
+      #if !defined(NDEBUG)
+        assert(not pool->last);  // release builds don't maintain on Make_Node
+      #endif
         pool->first = node;
     }
     else {
@@ -446,6 +484,90 @@ void Fill_Pool(REBPOL *pool)
 }
 
 
+//
+//  Release_Free_Segments: C
+//
+// Give segments of a pool in which every unit is free back to the system,
+// returning how many bytes were released.  Without this, a transient spike
+// in use would leave the memory allocated until Shutdown_Pools().
+//
+// It is only valid for pools of nodes (series stubs and pairings), since
+// their first byte is FREED_SERIES_BYTE if and only if they are free.  Data
+// pools hold arbitrary bytes which could coincidentally look freed.
+//
+// For hysteresis, a segment's worth of free units (at the current, possibly
+// grown size) is kept, so a workload that oscillates near a segment boundary
+// does not release and refill on every recycle.  Call after a sweep, since
+// that is when whole segments are likely to have become free.
+//
+REBLEN Release_Free_Segments(REBLEN pool_id)
+{
+    assert(pool_id == SER_POOL or pool_id == PAR_POOL);
+    REBPOL *pool = &Mem_Pools[pool_id];
+
+    if (pool->free < pool->units * 2)
+        return 0;  // fast check, can't possibly release anything
+
+    REBLEN released = 0;
+
+    REBSEG **link = &pool->segs;
+    while (*link != nullptr) {
+        REBSEG *seg = *link;
+        REBLEN units = Seg_Units(pool, seg);
+
+        if (pool->free < units + pool->units) {  // keep some spare
+            link = &seg->next;
+            continue;
+        }
+
+        REBYTE *bp = cast(REBYTE*, seg + 1);
+        REBLEN n = units;
+        for (; n > 0; --n, bp += pool->wide) {
+            if (*bp != FREED_SERIES_BYTE)
+                break;
+        }
+        if (n != 0) {  // some unit in use
+            link = &seg->next;
+            continue;
+        }
+
+        *link = seg->next;
+        pool->has -= units;
+        pool->free -= units;
+        released += seg->size;
+        FREE_N(char, seg->size, cast(char*, seg));
+    }
+
+    if (released == 0)
+        return 0;
+
+    // The free list threads through all segments, so rebuild it from what is
+    // left.  This costs as much as the sweep that preceded it, but only is
+    // done when memory is actually being given back.
+    //
+    pool->first = nullptr;
+    pool->last = nullptr;
+
+    REBNOD **tail = &pool->first;
+    REBSEG *seg = pool->segs;
+    for (; seg != nullptr; seg = seg->next) {
+        REBYTE *bp = cast(REBYTE*, seg + 1);
+        REBLEN n = Seg_Units(pool, seg);
+        for (; n > 0; --n, bp += pool->wide) {
+            if (*bp != FREED_SERIES_BYTE)
+                continue;
+            REBNOD *node = cast(REBNOD*, bp);  // can't NOD(), tests for free
+            *tail = node;
+            tail = &node->next_if_free;
+            pool->last = node;
+        }
+    }
+    *tail = nullptr;
+
+    return released;
+}
+
+
 #if !defined(NDEBUG)
 
 //
@@ -462,7 +584,7 @@ REBNOD *Try_Find_Containing_Node_Debug(const void *p)
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = Seg_Units(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -639,6 +761,39 @@ void Free_Unbiased_Series_Data(char *unbiased, REBLEN total)
 }
 
 
+//
+//  Make_External_Binary: C
+//
+// Make a managed BINARY! series whose data is `size` bytes at `data`, without
+// copying them.  The byte at `data[size]` must be readable and 0, as series
+// are terminated.  The memory has to stay valid for as long as the series
+// might be using it, which is until the process ends (there is no notice
+// given when the series is GC'd).
+//
+// Mutations in place write to the memory, so if the memory is a file mapping
+// it should be a private (copy-on-write) one.  Mutations that grow the
+// series copy it into a normal allocation first, see Expand_Series().
+//
+REBSER *Make_External_Binary(REBYTE *data, REBLEN size)
+{
+    assert(data[size] == '\0');
+
+    REBSER *s = Alloc_Series_Node(NODE_FLAG_MANAGED);
+    s->info.bits =
+        SERIES_INFO_0_IS_TRUE
+        | FLAG_WIDE_BYTE_OR_0(sizeof(REBYTE))
+        | BINARY_INFO_MISC_EXTERNAL;
+
+    mutable_LEN_BYTE_OR_255(s) = 255;  // dynamic
+    s->content.dynamic.data = cast(char*, data);
+    s->content.dynamic.bias = 0;
+    s->content.dynamic.used = size;
+    s->content.dynamic.rest = size + 1;  // no room to grow in place
+
+    return s;
+}
+
+
 //
 //  Expand_Series: C
 //
@@ -692,6 +847,11 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     if (delta == 0)
         return;
 
+    // Expansion is done so new values can be written into the gap, which
+    // could reference series newer than `s` (see Note_Series_Mutation())
+    //
+    Note_Series_Mutation(s);
+
     REBLEN used_old = SER_USED(s);
 
     REBYTE wide = SER_WIDE(s);
@@ -726,6 +886,21 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
         return;
     }
 
+    // A series used as a queue takes from the head (which adds bias) and
+    // appends at the tail.  When the tail runs out of room but the bias is
+    // at least as big as the data, sliding the data back to the start of
+    // the allocation costs no more than the removals that made the bias,
+    // and avoids growing the allocation.
+    //
+    if (
+        was_dynamic
+        and SER_BIAS(s) >= used_old
+        and used_old + delta + 1 > SER_REST(s)
+        and used_old + delta + 1 <= SER_REST(s) + SER_BIAS(s)
+    ){
+        Unbias_Series(s, true);
+    }
+
     // Width adjusted variables:
 
     REBLEN start = index * wide;
@@ -733,6 +908,46 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     REBLEN size = SER_USED(s) * wide;
 
     // + wide for terminator
+    if (
+        was_dynamic
+        and index == 0
+        and (size + extra + wide) <= SER_REST(s) * SER_WIDE(s)
+    ){
+    //=//// HEAD INSERTION WITHOUT ENOUGH BIAS ////////////////////////////=//
+
+        // The data has to slide anyway, so slide it further and leave half
+        // of the unused space at the head as bias.  Inserting repeatedly at
+        // the head then only slides the data each time the bias runs out,
+        // which is amortized constant time.  (Bias is kept in 16 bits.)
+        //
+        REBLEN bias_old = SER_BIAS(s);
+        REBLEN total = SER_REST(s) + bias_old;
+        REBLEN bias = (total - (used_old + delta + 1)) / 2;
+        if (bias > 0xffff)
+            bias = 0xffff;
+
+        REBYTE *alloc = cast(REBYTE*, s->content.dynamic.data)
+            - (wide * bias_old);
+        memmove(
+            alloc + (wide * (bias + delta)),
+            s->content.dynamic.data,
+            size
+        );
+        s->content.dynamic.data = cast(char*, alloc + (wide * bias));
+        s->content.dynamic.rest = total - bias;
+        s->content.dynamic.used = used_old + delta;
+        SER_SET_BIAS(s, bias);
+
+      #if !defined(NDEBUG)
+        if (IS_SER_ARRAY(s)) {
+            for (index = 0; index < delta; index++)
+                Prep_Non_Stack_Cell(ARR_AT(ARR(s), index));
+        }
+      #endif
+        TERM_SERIES(s);
+        return;
+    }
+
     if ((size + extra + wide) <= SER_REST(s) * SER_WIDE(s)) {
         //
         // No expansion was needed.  Slide data down if necessary.  Note that
@@ -793,20 +1008,28 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     }
   #endif
 
-    // Have we recently expanded the same series?
+    // Have we recently expanded the same series?  Growth is geometric in
+    // either case (see SERIES_GROWTH_PERCENT), but more generous for series
+    // that keep coming back (one extra unit is for the terminator).
 
-    REBLEN x = 1;
+    REBU64 percent = SERIES_GROWTH_PERCENT;
     REBLEN n_available = 0;
     REBLEN n_found;
     for (n_found = 0; n_found < MAX_EXPAND_LIST; n_found++) {
         if (Prior_Expand[n_found] == s) {
-            x = SER_USED(s) + delta + 1; // Double the size
+            percent = SERIES_REGROWTH_PERCENT;
             break;
         }
         if (!Prior_Expand[n_found])
             n_available = n_found;
     }
 
+    REBU64 wanted = cast(REBU64, used_old) + delta;
+    REBU64 grow = wanted * percent / 100;
+    if (wanted + grow >= 0x7FFFFFFF)  // don't let spare room pass 2GB max
+        grow = (wanted >= 0x7FFFFFFF) ? 0 : 0x7FFFFFFF - wanted - 1;
+    REBLEN x = cast(REBLEN, grow) + 1;
+
   #ifndef NDEBUG
     if (Reb_Opts->watch_expand) {
         // Print_Num("Expand:", series->tail + delta + 1);
@@ -870,10 +1093,14 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
 
     if (was_dynamic) {
         //
-        // We have to de-bias the data pointer before we can free it.
+        // We have to de-bias the data pointer before we can free it.  (If it
+        // was external, the series now owns a copy and leaves the original.)
         //
         assert(SER_BIAS(s) == 0); // should be reset
-        Free_Unbiased_Series_Data(data_old - (wide * bias_old), size_old);
+        if (wide == 1 and (s->info.bits & BINARY_INFO_MISC_EXTERNAL))
+            s->info.bits &= ~BINARY_INFO_MISC_EXTERNAL;
+        else
+            Free_Unbiased_Series_Data(data_old - (wide * bias_old), size_old);
     }
 
   #if !defined(NDEBUG)
@@ -906,6 +1133,9 @@ void Swap_Series_Content(REBSER* a, REBSER* b)
     assert(IS_SER_ARRAY(a) == IS_SER_ARRAY(b));
     assert(SER_WIDE(a) == SER_WIDE(b));
 
+    Note_Series_Mutation(a);  // either may now refer to younger content
+    Note_Series_Mutation(b);
+
     // There are bits in the ->info and ->header which pertain to the content,
     // which includes whether the series is dynamic or if the data lives in
     // the node itself, the width (right 8 bits), etc.
@@ -914,6 +1144,14 @@ void Swap_Series_Content(REBSER* a, REBSER* b)
     mutable_LEN_BYTE_OR_255(a) = LEN_BYTE_OR_255(b);
     mutable_LEN_BYTE_OR_255(b) = a_len;
 
+    if (SER_WIDE(a) == 1) {  // external data has to stay marked as such
+        uintptr_t a_external = a->info.bits & BINARY_INFO_MISC_EXTERNAL;
+        a->info.bits &= ~BINARY_INFO_MISC_EXTERNAL;
+        a->info.bits |= b->info.bits & BINARY_INFO_MISC_EXTERNAL;
+        b->info.bits &= ~BINARY_INFO_MISC_EXTERNAL;
+        b->info.bits |= a_external;
+    }
+
     union Reb_Series_Content a_content;
 
     // `char*` casts needed: https://stackoverflow.com/q/57721104
@@ -1037,8 +1275,90 @@ void Remake_Series(REBSER *s, REBLEN units, REBYTE wide, REBFLGS flags)
     }
   #endif
 
-    if (was_dynamic)
-        Free_Unbiased_Series_Data(data_old - (wide_old * bias_old), size_old);
+    if (was_dynamic) {
+        if (wide_old == 1 and (s->info.bits & BINARY_INFO_MISC_EXTERNAL))
+            s->info.bits &= ~BINARY_INFO_MISC_EXTERNAL;  // now owns a copy
+        else
+            Free_Unbiased_Series_Data(
+                data_old - (wide_old * bias_old),
+                size_old
+            );
+    }
+}
+
+
+//
+//  Compact_Series_Data: C
+//
+// Reallocate the data of large series so that it fits their content, giving
+// back the bytes that were wasted on unused capacity and head bias.  Only
+// series whose data is too big for the pools are considered, since those
+// are the allocations whose growth and shrinking fragments the C heap.  The
+// number of bytes saved is returned.
+//
+// Series nodes themselves are never moved; only the dynamic data.  Those
+// whose data pointers may be held elsewhere are skipped: anything that is
+// SERIES_FLAG_DONT_RELOCATE (e.g. from rebRepossess() or rebBytes()), held
+// by an enumeration or running frame (SERIES_INFO_HOLD), or a context,
+// paramlist, or map (frames keep pointers into their arguments).
+//
+// !!! C code which keeps a RELVAL* into an array across an evaluation would
+// be broken by expansion, too.  But reallocating series the code believes
+// can't be reached by user code might expose such bugs, so this is only run
+// when asked for with RECYCLE/COMPACT.
+//
+REBLEN Compact_Series_Data(void)
+{
+    REBLEN saved = 0;
+
+    REBSEG *seg;
+    for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBLEN n;
+        for (n = Seg_Units(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
+            if (IS_FREE_NODE(s) or (s->header.bits & NODE_FLAG_CELL))
+                continue;
+            if (not IS_SER_DYNAMIC(s) or NOT_SERIES_FLAG(s, MANAGED))
+                continue;
+            if (GET_SERIES_FLAG(s, DONT_RELOCATE))
+                continue;
+            if (Is_Series_Data_External(s))
+                continue;  // copying would lose the sharing of the mapping
+            if (s->info.bits & (SERIES_INFO_INACCESSIBLE | SERIES_INFO_HOLD))
+                continue;
+            if (IS_SER_ARRAY(s) and (
+                GET_ARRAY_FLAG(s, IS_VARLIST)
+                or GET_ARRAY_FLAG(s, IS_PARAMLIST)
+                or GET_ARRAY_FLAG(s, IS_PAIRLIST)
+            )){
+                continue;
+            }
+            if (GET_SERIES_FLAG(s, IS_STRING)) {
+                if (IS_STR_SYMBOL(STR(s)))
+                    continue;
+              #ifdef DEBUG_UTF8_EVERYWHERE
+                continue;  // Remake_Series() trashes the cached length
+              #endif
+            }
+
+            size_t total = SER_TOTAL(s);
+            if (FIND_POOL(total) != SYSTEM_POOL)
+                continue;  // pooled data doesn't fragment the C heap
+
+            REBLEN used = SER_USED(s);
+            size_t fit = (used + 1) * SER_WIDE(s);  // +1 for terminator
+            if (fit > total - (total / 4))
+                continue;  // not worth moving for less than 25% savings
+
+            CLEAR_SERIES_FLAG(s, POWER_OF_2);  // reallocate at exact size
+            Remake_Series(s, used, SER_WIDE(s), NODE_FLAG_NODE);  // preserve
+
+            assert(SER_TOTAL(s) <= total);
+            saved += total - SER_TOTAL(s);
+        }
+    }
+
+    return saved;
 }
 
 
@@ -1086,7 +1406,10 @@ void Decay_Series(REBSER *s)
                 );
             }
 
-        Free_Unbiased_Series_Data(unbiased, total);
+        if (Is_Series_Data_External(s))
+            total = 0;  // not ours to free, and never charged to the ballast
+        else
+            Free_Unbiased_Series_Data(unbiased, total);
 
         // !!! This indicates reclaiming of the space, not for the series
         // nodes themselves...have they never been accounted for, e.g. in
@@ -1167,7 +1490,7 @@ void GC_Kill_Series(REBSER *s)
 
     Free_Node(SER_POOL, NOD(s));
 
-    if (GC_Ballast > 0)
+    if (GC_Ballast > 0 and not GC_Marking)  // incremental slices must go on
         CLR_SIGNAL(SIG_RECYCLE);  // Enough space that requested GC can cancel
 
   #if !defined(NDEBUG)
@@ -1280,7 +1603,7 @@ REBLEN Check_Memory_Debug(void)
         REBSER *s = cast(REBSER*, seg + 1);
 
         REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = Seg_Units(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -1360,7 +1683,7 @@ void Dump_All_Series_Of_Width(REBSIZ wide)
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = Seg_Units(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -1390,7 +1713,7 @@ void Dump_Series_In_Pool(REBLEN pool_id)
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBLEN n = 0;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = Seg_Units(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -1445,7 +1768,12 @@ void Dump_Pools(void)
                 Mem_Pools[n].has != 0 ? ((used * 100) / Mem_Pools[n].has) : 0
             )
         );
-        printf("%-2d segs, %-7d total\n", cast(int, segs), cast(int, size));
+        printf(
+            "%-2d segs, %-7d total, %d fills\n",
+            cast(int, segs),
+            cast(int, size),
+            cast(int, Mem_Pools[n].fills)
+        );
 
         tused += used * Mem_Pools[n].wide;
         total += size;
@@ -1496,7 +1824,7 @@ REBU64 Inspect_Series(bool show)
         REBSER *s = cast(REBSER*, seg + 1);
 
         REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; n--) {
+        for (n = Seg_Units(&Mem_Pools[SER_POOL], seg); n > 0; n--) {
             if (IS_FREE_NODE(s)) {
                 ++fre;
                 continue;
@@ -1574,3 +1902,282 @@ REBU64 Inspect_Series(bool show)
 }
 
 #endif
+
+
+//=//// HEAP SNAPSHOT (STATS/HEAP) ////////////////////////////////////////=//
+//
+// These walk the series pool to break down what is in it.  Unlike the dumps
+// above they are in release builds, and they only read the nodes.  Sizes are
+// the REBSER node plus the content of dynamic series.  See also
+// Make_Heap_Roots_Array() in %m-gc.c, for what each group of roots retains.
+//
+
+enum Reb_Heap_Flavor {
+    HEAP_FLAVOR_PAIRING,
+    HEAP_FLAVOR_ARRAY,
+    HEAP_FLAVOR_VARLIST,
+    HEAP_FLAVOR_PARAMLIST,
+    HEAP_FLAVOR_PAIRLIST,
+    HEAP_FLAVOR_STRING,
+    HEAP_FLAVOR_SYMBOL,
+    HEAP_FLAVOR_BINARY,
+    HEAP_FLAVOR_OTHER,
+    HEAP_FLAVOR_MAX
+};
+
+static const char *Heap_Flavor_Names[HEAP_FLAVOR_MAX] = {
+    "pairing", "array", "varlist", "paramlist", "pairlist",
+    "string", "symbol", "binary", "other"
+};
+
+static enum Reb_Heap_Flavor Heap_Flavor(REBSER *s)
+{
+    if (s->header.bits & NODE_FLAG_CELL)
+        return HEAP_FLAVOR_PAIRING;
+
+    if (IS_SER_ARRAY(s)) {
+        if (GET_ARRAY_FLAG(s, IS_VARLIST))
+            return HEAP_FLAVOR_VARLIST;
+        if (GET_ARRAY_FLAG(s, IS_PARAMLIST))
+            return HEAP_FLAVOR_PARAMLIST;
+        if (GET_ARRAY_FLAG(s, IS_PAIRLIST))
+            return HEAP_FLAVOR_PAIRLIST;
+        return HEAP_FLAVOR_ARRAY;
+    }
+
+    if (GET_SERIES_FLAG(s, IS_STRING))
+        return IS_STR_SYMBOL(STR(s))
+            ? HEAP_FLAVOR_SYMBOL
+            : HEAP_FLAVOR_STRING;
+
+    if (SER_WIDE(s) == 1)
+        return HEAP_FLAVOR_BINARY;
+
+    return HEAP_FLAVOR_OTHER;
+}
+
+inline static REBI64 Heap_Bytes(REBSER *s) {
+    if (s->header.bits & NODE_FLAG_CELL)
+        return sizeof(REBSER);
+    return sizeof(REBSER) + SER_TOTAL_IF_DYNAMIC(s);
+}
+
+
+//
+//  Make_Heap_Flavors_Array: C
+//
+// Flat block of `flavor count bytes` for the nodes in use, for STATS/HEAP.
+//
+REBARR *Make_Heap_Flavors_Array(void)
+{
+    REBI64 counts[HEAP_FLAVOR_MAX];
+    REBI64 bytes[HEAP_FLAVOR_MAX];
+    CLEAR(counts, sizeof(counts));
+    CLEAR(bytes, sizeof(bytes));
+
+    REBSEG *seg;
+    for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBLEN n;
+        for (n = Seg_Units(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
+            if (IS_FREE_NODE(s))
+                continue;
+            enum Reb_Heap_Flavor flavor = Heap_Flavor(s);
+            ++counts[flavor];
+            bytes[flavor] += Heap_Bytes(s);
+        }
+    }
+
+    REBARR *a = Make_Array(HEAP_FLAVOR_MAX * 3);
+    REBLEN i;
+    for (i = 0; i < HEAP_FLAVOR_MAX; ++i) {
+        const char *name = Heap_Flavor_Names[i];
+        Init_Word(
+            Alloc_Tail_Array(a),
+            Intern_UTF8_Managed(cb_cast(name), strlen(name))
+        );
+        Init_Integer(Alloc_Tail_Array(a), counts[i]);
+        Init_Integer(Alloc_Tail_Array(a), bytes[i]);
+    }
+    return a;
+}
+
+
+//
+//  Make_Heap_Types_Array: C
+//
+// Flat block of `datatype count` for the cells in arrays in use (with the
+// most common first), for STATS/HEAP.  All quoted cells count as QUOTED!.
+//
+REBARR *Make_Heap_Types_Array(void)
+{
+    REBI64 counts[REB_MAX];
+    CLEAR(counts, sizeof(counts));
+
+    REBSEG *seg;
+    for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBLEN n;
+        for (n = Seg_Units(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
+            if (IS_FREE_NODE(s) or (s->header.bits & NODE_FLAG_CELL))
+                continue;
+            if (not IS_SER_ARRAY(s) or GET_SERIES_INFO(s, INACCESSIBLE))
+                continue;
+
+            RELVAL *v = ARR_HEAD(ARR(s));
+            for (; NOT_END(v); ++v) {
+                REBYTE kind = KIND_BYTE_UNCHECKED(v);
+                if (kind >= REB_64)
+                    kind = REB_QUOTED;
+                if (kind < REB_MAX)  // skip internal pseudotypes
+                    ++counts[kind];
+            }
+        }
+    }
+
+    REBARR *a = Make_Array(REB_MAX * 2);
+    while (true) {  // selection sort is fine for a few dozen types
+        REBLEN best = REB_MAX;
+        REBLEN k;
+        for (k = REB_0 + 1; k < REB_MAX; ++k) {
+            if (k == REB_NULLED)
+                continue;  // has no datatype, shown as BLANK! below
+            if (counts[k] == 0)
+                continue;
+            if (best == REB_MAX or counts[k] > counts[best])
+                best = k;
+        }
+        if (best == REB_MAX)
+            break;
+
+        Init_Builtin_Datatype(Alloc_Tail_Array(a), cast(enum Reb_Kind, best));
+        Init_Integer(Alloc_Tail_Array(a), counts[best]);
+        counts[best] = 0;
+    }
+
+    if (counts[REB_NULLED] != 0) {  // unset variables in varlists
+        Init_Blank(Alloc_Tail_Array(a));
+        Init_Integer(Alloc_Tail_Array(a), counts[REB_NULLED]);
+    }
+    return a;
+}
+
+
+struct Reb_Heap_Site {
+    REBNOD *file;
+    REBLIN line;
+    REBI64 count;
+    REBI64 bytes;
+};
+
+static int Compare_Heap_Sites_By_Place(const void *a, const void *b)
+{
+    const struct Reb_Heap_Site *sa = cast(const struct Reb_Heap_Site*, a);
+    const struct Reb_Heap_Site *sb = cast(const struct Reb_Heap_Site*, b);
+    if (sa->file != sb->file)
+        return cast(uintptr_t, sa->file) < cast(uintptr_t, sb->file) ? -1 : 1;
+    if (sa->line != sb->line)
+        return sa->line < sb->line ? -1 : 1;
+    return 0;
+}
+
+static int Compare_Heap_Sites_By_Bytes(const void *a, const void *b)
+{
+    const struct Reb_Heap_Site *sa = cast(const struct Reb_Heap_Site*, a);
+    const struct Reb_Heap_Site *sb = cast(const struct Reb_Heap_Site*, b);
+    if (sa->bytes != sb->bytes)
+        return sa->bytes > sb->bytes ? -1 : 1;  // biggest first
+    return 0;
+}
+
+
+//
+//  Make_Heap_Sites_Array: C
+//
+// Flat block of `file line count bytes` for the `limit` source locations
+// whose arrays take the most memory, for STATS/HEAP.
+//
+// Arrays made while running code (e.g. by REDUCE, COLLECT, COPY) are stamped
+// with the file and line of the array that was executing, as are arrays that
+// are LOADed from a file.  So this finds where blocks are being created.
+// (Only arrays carry a file and line, other series aren't included.)
+//
+REBARR *Make_Heap_Sites_Array(REBLEN limit)
+{
+    REBLEN num_arrays = 0;
+
+    REBSEG *seg;
+    for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBLEN n;
+        for (n = Seg_Units(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
+            if (IS_FREE_NODE(s) or (s->header.bits & NODE_FLAG_CELL))
+                continue;
+            if (IS_SER_ARRAY(s) and GET_ARRAY_FLAG(s, HAS_FILE_LINE_UNMASKED))
+                ++num_arrays;
+        }
+    }
+
+    if (num_arrays == 0)
+        return Make_Array(0);
+
+    struct Reb_Heap_Site *sites = cast(struct Reb_Heap_Site*, Alloc_Mem(
+        num_arrays * sizeof(struct Reb_Heap_Site)
+    ));
+
+    REBLEN num_sites = 0;
+    for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBLEN n;
+        for (n = Seg_Units(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
+            if (IS_FREE_NODE(s) or (s->header.bits & NODE_FLAG_CELL))
+                continue;
+            if (not IS_SER_ARRAY(s))
+                continue;
+            if (NOT_ARRAY_FLAG(s, HAS_FILE_LINE_UNMASKED))
+                continue;
+
+            struct Reb_Heap_Site *site = &sites[num_sites++];
+            site->file = LINK_FILE_NODE(s);
+            site->line = MISC(s).line;
+            site->count = 1;
+            site->bytes = Heap_Bytes(s);
+        }
+    }
+    assert(num_sites == num_arrays);
+
+    // Sort by place to merge the arrays from the same place, then by size
+    //
+    qsort(
+        sites, num_sites, sizeof(struct Reb_Heap_Site),
+        &Compare_Heap_Sites_By_Place
+    );
+    REBLEN merged = 0;
+    REBLEN i;
+    for (i = 0; i < num_sites; ++i) {
+        if (
+            merged != 0
+            and Compare_Heap_Sites_By_Place(&sites[merged - 1], &sites[i]) == 0
+        ){
+            sites[merged - 1].count += sites[i].count;
+            sites[merged - 1].bytes += sites[i].bytes;
+        }
+        else
+            sites[merged++] = sites[i];
+    }
+    qsort(
+        sites, merged, sizeof(struct Reb_Heap_Site),
+        &Compare_Heap_Sites_By_Bytes
+    );
+
+    REBARR *a = Make_Array(MIN(merged, limit) * 4);  // (after the walk)
+    for (i = 0; i < merged and i < limit; ++i) {
+        Init_File(Alloc_Tail_Array(a), STR(sites[i].file));
+        Init_Integer(Alloc_Tail_Array(a), sites[i].line);
+        Init_Integer(Alloc_Tail_Array(a), sites[i].count);
+        Init_Integer(Alloc_Tail_Array(a), sites[i].bytes);
+    }
+
+    Free_Mem(sites, num_arrays * sizeof(struct Reb_Heap_Site));
+    return a;
+}
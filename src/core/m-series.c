@@ -40,6 +40,38 @@ void Extend_Series(REBSER *s, REBLEN delta)
 }
 
 
+//
+//  Reserve_Series: C
+//
+// Make sure a series has room for `amount` more units past its tail without
+// reallocating.  Unlike Extend_Series(), this sizes the allocation for just
+// what was asked, instead of applying Expand_Series() growth on top of it.
+//
+void Reserve_Series(REBSER *s, REBLEN amount)
+{
+    if (amount & 0x80000000)
+        fail (Error_Past_End_Raw());  // 2GB max
+
+    if (SER_FITS(s, amount))
+        return;
+
+    if (GET_SERIES_FLAG(s, FIXED_SIZE))
+        fail (Error_Locked_Series_Raw());
+
+  #if defined(DEBUG_UTF8_EVERYWHERE)
+    REBLEN len_old = GET_SERIES_FLAG(s, IS_STRING) ? MISC(s).length : 0;
+  #endif
+
+    CLEAR_SERIES_FLAG(s, POWER_OF_2);  // the caller knows the size it wants
+    Remake_Series(s, SER_USED(s) + amount, SER_WIDE(s), NODE_FLAG_NODE);
+
+  #if defined(DEBUG_UTF8_EVERYWHERE)
+    if (GET_SERIES_FLAG(s, IS_STRING))
+        MISC(s).length = len_old;  // Remake_Series() trashes cached length
+  #endif
+}
+
+
 //
 //  Insert_Series: C
 //
@@ -83,6 +115,7 @@ void Append_Series(REBSER *s, const void *data, REBLEN len)
     REBYTE wide = SER_WIDE(s);
 
     assert(not IS_SER_ARRAY(s));
+    assert(not IS_SER_STRING(s));  // wouldn't update cached codepoint length
 
     EXPAND_SERIES_TAIL(s, len);
     memcpy(SER_DATA_RAW(s) + (wide * used_old), data, wide * len);
@@ -252,9 +285,16 @@ void Remove_Series_Units(REBSER *s, REBSIZ offset, REBINT quantity)
                 s->content.dynamic.rest -= quantity;
                 s->content.dynamic.data += SER_WIDE(s) * quantity;
                 if ((start = SER_BIAS(s)) != 0) {
-                    // If more than half biased:
-                    if (start >= MAX_SERIES_BIAS or start > SER_REST(s))
+                    // If more than half biased, or if the bias is big and
+                    // sliding the data back costs no more than the removals
+                    // that made the bias (so queues stay amortized O(1)):
+                    //
+                    if (
+                        start > SER_REST(s)
+                        or (start >= MAX_SERIES_BIAS and start >= SER_USED(s))
+                    ){
                         Unbias_Series(s, true);
+                    }
                 }
             }
         }
@@ -304,9 +344,11 @@ void Remove_Series_Len(REBSER *s, REBLEN index, REBINT len)
 
         assert(len <= len_old);
 
-        Remove_Series_Units(s, cp - STR_HEAD(str), ep - cp);
-        Free_Bookmarks_Maybe_Null(str);
-        SET_STR_LEN_SIZE(str, len_old - len, size_old - (ep - cp));
+        REBSIZ offset = cp - STR_HEAD(str);
+        REBSIZ size = ep - cp;
+        Remove_Series_Units(s, offset, size);
+        SET_STR_LEN_SIZE(str, len_old - len, size_old - size);
+        Adjust_Bookmarks(str, index, offset, cast(REBLEN, len), size, 0, 0);
     }
     else
         Remove_Series_Units(s, index, len);
@@ -26,36 +26,90 @@
 
 #include "sys-core.h"
 
+#if defined(TO_WINDOWS)
+    #undef IS_ERROR  // windows has its own meaning for this.
+    #define WIN32_LEAN_AND_MEAN  // trim down the Win32 headers
+    #include <windows.h>
+    #define DATA_STACK_RESERVES_ADDRESS_SPACE
+#elif (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+    #include <sys/mman.h>
+    #if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+        #define MAP_ANONYMOUS MAP_ANON  // older BSDs and macOS
+    #endif
+    #if !defined(MAP_NORESERVE)
+        #define MAP_NORESERVE 0  // not all platforms overcommit, but most do
+    #endif
+    #define DATA_STACK_RESERVES_ADDRESS_SPACE
+#endif
+
+
+// The data stack is a C array of cells.  Where the platform allows it, the
+// address space for all STACK_LIMIT cells is reserved at startup and only
+// committed as the stack grows.  So an expansion doesn't move the stack, it
+// just formats the next cells in place--there's no copying, and extant
+// pointers into the stack stay valid.  (Pointer stability isn't promised by
+// the DS_XXX interface, so code must still use REBDSP across pushes to work
+// on the other platforms, which fall back on allocate-and-copy growth.)
+//
+// On POSIX the mapping is made with MAP_NORESERVE, and the kernel commits
+// pages when they are first touched.  On Windows the pages are committed
+// explicitly with VirtualAlloc() as the expansions reach them.
+//
+#define DS_RESERVE_BYTES     ((STACK_LIMIT + 1) * sizeof(REBVAL))  // + 1 for the END marker
+
 
 //
 //  Startup_Data_Stack: C
 //
 void Startup_Data_Stack(REBLEN capacity)
 {
+  #if defined(TO_WINDOWS)
+    DS_Head = cast(REBVAL*, VirtualAlloc(
+        nullptr, DS_RESERVE_BYTES, MEM_RESERVE, PAGE_NOACCESS
+    ));
+    if (DS_Head == nullptr)
+        panic ("Could not reserve address space for the data stack");
+    if (not VirtualAlloc(DS_Head, sizeof(REBVAL), MEM_COMMIT, PAGE_READWRITE))
+        panic ("Could not commit memory for the data stack");
+  #elif defined(DATA_STACK_RESERVES_ADDRESS_SPACE)
+    void *p = mmap(
+        nullptr,
+        DS_RESERVE_BYTES,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+        -1,
+        0
+    );
+    if (p == MAP_FAILED)
+        panic ("Could not reserve address space for the data stack");
+    DS_Head = cast(REBVAL*, p);
+  #else
+    DS_Head = cast(REBVAL*, Alloc_Mem(sizeof(REBVAL)));
+  #endif
+
     // Start the data stack out with just one element in it, and make it an
     // unreadable blank in the debug build.  This helps avoid accidental
     // reads and is easy to notice when it is overwritten.  It also means
     // that indices into the data stack can be unsigned (no need for -1 to
     // mean empty, because 0 can)
     //
-    DS_Array = Make_Array_Core(1, ARRAY_FLAG_NULLEDS_LEGAL);
-    Init_Unreadable_Blank(ARR_HEAD(DS_Array));
-    SET_CELL_FLAG(ARR_HEAD(DS_Array), PROTECTED);
-
-    // The END marker will signal DS_PUSH() that it has run out of space,
-    // and it will perform the allocation at that time.
+    // That one cell is the END marker until the expansion below, which will
+    // write the blank in it--so DS_AT(0) gets the same initialization as
+    // all the other cells.
     //
-    TERM_ARRAY_LEN(DS_Array, 1);
-    ASSERT_ARRAY(DS_Array);
+    Prep_Non_Stack_Cell(DS_Head);
+    SET_END(DS_Head);
+    DS_Capacity = 0;
 
     // Reuse the expansion logic that happens on a DS_PUSH() to get the
     // initial stack size.  It requires you to be on an END to run.
     //
-    DS_Index = 1;
-    DS_Movable_Top = KNOWN(ARR_AT(DS_Array, DS_Index));  // can't push RELVALs
+    DS_Index = 0;
+    DS_Movable_Top = DS_Head;
     Expand_Data_Stack_May_Fail(capacity);
 
-    DS_DROP();  // drop the hypothetical thing that triggered the expand
+    SET_CELL_FLAG(DS_Head, PROTECTED);
+    ASSERT_UNREADABLE_IF_DEBUG(DS_Head);
 }
 
 
@@ -65,9 +119,19 @@ void Startup_Data_Stack(REBLEN capacity)
 void Shutdown_Data_Stack(void)
 {
     assert(DSP == 0);
-    ASSERT_UNREADABLE_IF_DEBUG(ARR_HEAD(DS_Array));
+    ASSERT_UNREADABLE_IF_DEBUG(DS_Head);
+
+  #if defined(TO_WINDOWS)
+    VirtualFree(DS_Head, 0, MEM_RELEASE);
+  #elif defined(DATA_STACK_RESERVES_ADDRESS_SPACE)
+    munmap(DS_Head, DS_RESERVE_BYTES);
+  #else
+    Free_Mem(DS_Head, (DS_Capacity + 1) * sizeof(REBVAL));
+  #endif
 
-    Free_Unmanaged_Array(DS_Array);
+    DS_Head = nullptr;
+    DS_Movable_Top = nullptr;
+    DS_Capacity = 0;
 }
 
 
@@ -240,42 +304,65 @@ REBCTX *Get_Context_From_Stack(void)
 // So each push looks to see if it's pushing to a cell that contains an END
 // and if so requests an expansion.
 //
-// WARNING: This will invalidate any extant pointers to REBVALs living in
-// the stack.  It is for this reason that stack access should be done by
-// REBDSP "data stack pointers" and not by REBVAL* across *any* operation
-// which could do a push or pop.  (Currently stable w.r.t. pop but there may
-// be compaction at some point.)
+// Where the stack's address space is reserved up front (see notes above)
+// this doesn't move the stack.  Elsewhere it will invalidate any extant
+// pointers to REBVALs living in the stack.  It is for this reason that stack
+// access should be done by REBDSP "data stack pointers" and not by REBVAL*
+// across *any* operation which could do a push or pop.
 //
 REBVAL *Expand_Data_Stack_May_Fail(REBLEN amount)
 {
-    REBLEN len_old = ARR_LEN(DS_Array);
+    REBLEN len_old = DS_Capacity;
 
     // The current requests for expansion should only happen when the stack
     // is at its end.  Sanity check that.
     //
     assert(len_old == DS_Index);
     assert(IS_END(DS_Movable_Top));
-    assert(DS_Movable_Top == KNOWN(ARR_TAIL(DS_Array)));
-    assert(DS_Movable_Top - KNOWN(ARR_HEAD(DS_Array)) == cast(int, len_old));
+    assert(DS_Movable_Top == DS_Head + len_old);
 
     // If adding in the requested amount would overflow the stack limit, then
     // give a data stack overflow error.
     //
-    if (SER_REST(SER(DS_Array)) + amount >= STACK_LIMIT) {
+    if (len_old + amount >= STACK_LIMIT) {
         //
         // Because the stack pointer was incremented and hit the END marker
         // before the expansion, we have to decrement it if failing.
         //
         --DS_Index;
+        --DS_Movable_Top;
         Fail_Stack_Overflow(); // !!! Should this be a "data stack" message?
     }
 
-    Extend_Series(SER(DS_Array), amount);
+    REBLEN len_new = len_old + amount;
+
+  #if defined(TO_WINDOWS)
+    //
+    // Commit the pages for the new cells and the END marker after them.
+    // VirtualAlloc() rounds to page boundaries, and committing pages that
+    // are already committed is harmless.
+    //
+    if (not VirtualAlloc(
+        DS_Head + len_old,
+        (amount + 1) * sizeof(REBVAL),
+        MEM_COMMIT,
+        PAGE_READWRITE
+    )){
+        --DS_Index;
+        --DS_Movable_Top;
+        fail (Error_No_Memory((amount + 1) * sizeof(REBVAL)));
+    }
+  #elif !defined(DATA_STACK_RESERVES_ADDRESS_SPACE)
+    REBVAL *head = cast(REBVAL*, Alloc_Mem((len_new + 1) * sizeof(REBVAL)));
+    memcpy(head, DS_Head, len_old * sizeof(REBVAL));
+    Free_Mem(DS_Head, (len_old + 1) * sizeof(REBVAL));
+    DS_Head = head;
 
     // Update the pointer used for fast access to the top of the stack that
-    // likely was moved by the above allocation (needed before using DS_TOP)
+    // was moved by the above allocation (needed before using DS_TOP)
     //
-    DS_Movable_Top = cast(REBVAL*, ARR_AT(DS_Array, DS_Index));
+    DS_Movable_Top = DS_Head + DS_Index;
+  #endif
 
     // We fill in the data stack with "GC safe trash" (which is void in the
     // release build, but will raise an alarm if VAL_TYPE() called on it in
@@ -284,9 +371,9 @@ REBVAL *Expand_Data_Stack_May_Fail(REBLEN amount)
 
     REBVAL *cell = DS_Movable_Top;
 
-    REBLEN len_new = len_old + amount;
     REBLEN n;
     for (n = len_old; n < len_new; ++n) {
+        Prep_Non_Stack_Cell(cell);
         Init_Unreadable_Blank(cell);
         cell->header.bits |= (CELL_FLAG_STACK_LIFETIME | CELL_FLAG_TRANSIENT);
         ++cell;
@@ -295,10 +382,11 @@ REBVAL *Expand_Data_Stack_May_Fail(REBLEN amount)
     // Update the end marker to serve as the indicator for when the next
     // stack push would need to expand.
     //
-    TERM_ARRAY_LEN(DS_Array, len_new);
-    assert(cell == ARR_TAIL(DS_Array));
+    Prep_Non_Stack_Cell(cell);
+    SET_END(cell);
+    DS_Capacity = len_new;
+    assert(cell == DS_Head + DS_Capacity);
 
-    ASSERT_ARRAY(DS_Array);
     return DS_TOP;
 }
 
@@ -330,7 +418,7 @@ REBARR *Pop_Stack_Values_Core(REBDSP dsp_start, REBFLGS flags)
 //
 void Pop_Stack_Values_Into(REBVAL *into, REBDSP dsp_start) {
     REBLEN len = DSP - dsp_start;
-    REBVAL *values = KNOWN(ARR_AT(DS_Array, dsp_start + 1));
+    REBVAL *values = DS_AT(dsp_start + 1);
 
     FAIL_IF_READ_ONLY(into);
 
@@ -1354,6 +1354,8 @@ REBNATIVE(catch)
     if (REF(any) and not (
         IS_ACTION(label)
         and VAL_ACT_DISPATCHER(label) == &N_quit
+    ) and not (
+        Is_Raised_Error_Label(label)  // it's an error, so it's for TRAP
     )){
         goto was_caught;
     }
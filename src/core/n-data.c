@@ -983,6 +983,29 @@ REBNATIVE(free_q)
 }
 
 
+//
+//  reserve: native [
+//
+//  {Preallocate room for more items past the tail, to avoid reallocations}
+//
+//      return: [any-array! any-string! binary!]
+//      series [any-array! any-string! binary!]
+//      amount "Items to make room for (bytes for strings, as MAKE counts)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(reserve)
+{
+    INCLUDE_PARAMS_OF_RESERVE;
+
+    REBVAL *v = ARG(series);
+    FAIL_IF_READ_ONLY(v);
+
+    Reserve_Series(VAL_SERIES(v), Int32s(ARG(amount), 0));
+    RETURN (v);
+}
+
+
 //
 //  As_String_May_Fail: C
 //
@@ -1044,6 +1067,21 @@ bool Try_As_String(
             REBSIZ bytes_left = BIN_LEN(bin);
             const REBYTE *bp = BIN_HEAD(bin);
             for (; bytes_left > 0; --bytes_left, ++bp) {
+                const REBYTE *run_end = Skip_Plain_Ascii_Run(
+                    bp,
+                    bp + bytes_left
+                );
+                if (run_end != bp) {  // count runs needing no checks at once
+                    REBLEN run = run_end - bp;
+                    if (bp < at_ptr)
+                        index += MIN(run, cast(REBLEN, at_ptr - bp));
+                    num_codepoints += run;
+                    bytes_left -= run;
+                    bp = run_end;
+                    if (bytes_left == 0)
+                        break;
+                }
+
                 if (bp < at_ptr)
                     ++index;
 
@@ -1072,19 +1110,13 @@ bool Try_As_String(
             UNUSED(all_ascii);  // TBD: maintain cache
         }
         else {
-            // !!! It's a string series, but or mapping acceleration is
-            // from index to offset... not offset to index.  Recalculate
-            // the slow way for now.
+            // It's already a string series, so the length is cached.  Only
+            // the index has to be found, which is free for ASCII strings.
+            // (Mapping acceleration is from index to offset, not offset to
+            // index, so others have to scan for now.)
 
             str = STR(bin);
-            index = 0;
-
-            REBCHR(*) cp = STR_HEAD(str);
-            REBLEN len = STR_LEN(str);
-            while (index < len and cp != at_ptr) {
-                ++index;
-                cp = NEXT_STR(cp);
-            }
+            index = STR_INDEX_AT(str, offset);
         }
 
         Init_Any_String_At(out, new_kind, str, index);
@@ -1250,9 +1282,16 @@ REBNATIVE(as)
                 str = Intern_UTF8_Managed(VAL_BIN_AT(v), VAL_LEN_AT(v));
 
                 // Constrain the input in the way it would be if we were doing
-                // the more efficient reuse.
+                // the more efficient reuse.  If the binary wasn't aliased as
+                // a string already, it becomes one with the same codepoint
+                // count as the interning (it is the whole binary).
                 //
-                SET_SERIES_FLAG(bin, IS_STRING);  // might be set already
+                if (not IS_SER_STRING(bin)) {
+                    SET_SERIES_FLAG(bin, IS_STRING);
+                    SET_SERIES_FLAG(bin, UTF8_NONWORD);
+                    MISC(bin).length = STR_LEN(str);
+                    LINK(bin).bookmarks = nullptr;
+                }
                 Freeze_Sequence(bin);
             }
 
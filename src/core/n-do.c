@@ -727,6 +727,31 @@ REBNATIVE(redo)
 }
 
 
+//
+//  tail-calls: native [
+//
+//  {Set whether a body's final call to its own action reuses the frame}
+//
+//      return: "The previous setting"
+//          [logic!]
+//      enable "On by default, turn off to keep every frame in backtraces"
+//          [logic!]
+//  ]
+//
+REBNATIVE(tail_calls)
+//
+// When on, `f: func [n] [... f n - 1]` moves the new arguments into the
+// running frame and restarts it, the way REDO does, instead of recursing.
+// See Is_Self_Tail_Call() in %c-eval.c for what qualifies.
+{
+    INCLUDE_PARAMS_OF_TAIL_CALLS;
+
+    bool previous = TG_Tail_Calls;
+    TG_Tail_Calls = VAL_LOGIC(ARG(enable));
+    return Init_Logic(D_OUT, previous);
+}
+
+
 //
 //  applique: native [
 //
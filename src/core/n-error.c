@@ -64,8 +64,14 @@ REBNATIVE(trap)
     if (not error)
         return nullptr; // code didn't fail() or throw
 
-    if (IS_VOID(error)) // signal used to indicate a throw
-        return R_THROWN;
+    if (IS_VOID(error)) {  // signal used to indicate a throw
+        if (not Is_Raised_Error_Label(VAL_THROWN_LABEL(D_OUT)))
+            return R_THROWN;
+
+        CATCH_THROWN(D_OUT, D_OUT);  // RAISE, see Raise_Error_Core()
+        assert(IS_ERROR(D_OUT));
+        return D_OUT;
+    }
 
     assert(IS_ERROR(error));
     return error;
@@ -117,6 +123,29 @@ REBNATIVE(entrap)
 }
 
 
+//
+//  raise: native [
+//
+//  {Raises an error to the nearest TRAP, like DO of an ERROR! (but cheaper)}
+//
+//      error [error!]
+//  ]
+//
+REBNATIVE(raise)
+//
+// DO of an ERROR! is a fail(), which longjmp()s to the nearest TRAP.  RAISE
+// instead throws the error, so it's caught by the TRAP when the throw gets
+// to it.  This makes FAIL less costly in code that uses TRAP to handle
+// failures as part of normal operation (e.g. parsing untrusted input).
+//
+// The label of the throw is RAISE itself, the way QUIT does it.
+{
+    INCLUDE_PARAMS_OF_RAISE;
+
+    RAISE (VAL_CONTEXT(ARG(error)));
+}
+
+
 //
 //  set-location-of-error: native [
 //
@@ -337,10 +337,16 @@ REBNATIVE(chain_p)  // see extended definition CHAIN in %base-defs.r
         &Chainer_Dispatcher,
         ACT_UNDERLYING(VAL_ACTION(first)),  // same underlying as first action
         ACT_EXEMPLAR(VAL_ACTION(first)),  // same exemplar as first action
-        1  // details array capacity
+        IDX_CHAINER_MAX  // details array capacity
     );
     Deep_Freeze_Array(VAL_ARRAY(pipeline));
-    Move_Value(ARR_HEAD(ACT_DETAILS(chain)), pipeline);
+
+    REBARR *details = ACT_DETAILS(chain);
+    Move_Value(ARR_AT(details, IDX_CHAINER_PIPELINE), pipeline);
+    Init_Block(
+        ARR_AT(details, IDX_CHAINER_PLAN),
+        Make_Composition_Plan(chain)
+    );
 
     return Init_Action_Unbound(out, chain);
 }
@@ -397,7 +403,7 @@ REBNATIVE(adapt_p)  // see extended definition ADAPT in %base-defs.r
         &Adapter_Dispatcher,
         underlying,  // same underlying as adaptee
         ACT_EXEMPLAR(VAL_ACTION(adaptee)),  // same exemplar as adaptee
-        2  // details array capacity => [prelude, adaptee]
+        IDX_ADAPTER_MAX  // details array capacity => [prelude, adaptee, plan]
     );
 
     // !!! In a future branch it may be possible that specific binding allows
@@ -417,8 +423,16 @@ REBNATIVE(adapt_p)  // see extended definition ADAPT in %base-defs.r
     // it can be executed (e.g. the `REBFRM *f` it is dispatching).
     //
     REBARR *details = ACT_DETAILS(adaptation);
-    Init_Relative_Block(ARR_AT(details, 0), underlying, prelude);
-    Move_Value(ARR_AT(details, 1), adaptee);
+    Init_Relative_Block(
+        ARR_AT(details, IDX_ADAPTER_PRELUDE),
+        underlying,
+        prelude
+    );
+    Move_Value(ARR_AT(details, IDX_ADAPTER_ADAPTEE), adaptee);
+    Init_Block(
+        ARR_AT(details, IDX_ADAPTER_PLAN),
+        Make_Composition_Plan(adaptation)
+    );
 
     return Init_Action_Unbound(D_OUT, adaptation);
 }
@@ -675,11 +689,25 @@ REBNATIVE(hijack)
     if (victim == hijacker)
         return nullptr; // permitting no-op hijack has some practical uses
 
+    ++PG_Hijack_Epoch;  // ADAPT/CHAIN/SPECIALIZE plans may skip the victim
+
     REBARR *victim_paramlist = ACT_PARAMLIST(victim);
     REBARR *victim_details = ACT_DETAILS(victim);
     REBARR *hijacker_paramlist = ACT_PARAMLIST(hijacker);
     REBARR *hijacker_details = ACT_DETAILS(hijacker);
 
+    // The victim's details and paramlist are rewritten in place to point at
+    // the hijacker's (possibly younger) content.
+    //
+    Note_Series_Mutation(SER(victim_details));
+    Note_Series_Mutation(SER(victim_paramlist));
+
+    // Purity is a property of the implementation, which is now the hijacker.
+    //
+    SER(victim_details)->header.bits &= ~DETAILS_FLAG_IS_PURE;
+    SER(victim_details)->header.bits |=
+        (SER(hijacker_details)->header.bits & DETAILS_FLAG_IS_PURE);
+
     if (
         ACT_UNDERLYING(hijacker) == ACT_UNDERLYING(victim)
         and (ACT_NUM_PARAMS(hijacker) == ACT_NUM_PARAMS(victim))
@@ -748,6 +776,50 @@ REBNATIVE(hijack)
 }
 
 
+//
+//  lazy: native [
+//
+//  {Make an action with SPEC's interface that is generated on first call}
+//
+//      return: [action!]
+//      generator "Called as `generator spec body` to make the real action"
+//          [action!]
+//      spec [block!]
+//      body [block!]
+//  ]
+//
+REBNATIVE(lazy)
+//
+// The mezzanine has a lot of functions that most sessions never call (HELP,
+// SOURCE, DUMP...).  Making them eagerly costs a run of FUNC per definition,
+// with the deep copy and relativization of each body.  A stub only needs the
+// paramlist, so it answers HELP and can be ADAPT-ed or SPECIALIZE-d, and the
+// generator is run on the first call.  See Force_Lazy_Action().
+//
+// Since the stub and the real action don't share an underlying paramlist,
+// calls proxy through Hijacker_Dispatcher() afterward.  So LAZY is for code
+// where startup matters more than the speed of each call.
+{
+    INCLUDE_PARAMS_OF_LAZY;
+
+    REBFLGS mkf_flags = MKF_RETURN | MKF_KEYWORDS;
+    REBACT *stub = Make_Action(
+        Make_Paramlist_Managed_May_Fail(ARG(spec), &mkf_flags),
+        &Lazy_Dispatcher,
+        nullptr,  // no underlying action (use paramlist)
+        nullptr,  // no specialization exemplar (or inherited exemplar)
+        IDX_LAZY_MAX  // details array capacity
+    );
+
+    REBARR *details = ACT_DETAILS(stub);
+    Move_Value(ARR_AT(details, IDX_LAZY_GENERATOR), ARG(generator));
+    Move_Value(ARR_AT(details, IDX_LAZY_SPEC), ARG(spec));
+    Move_Value(ARR_AT(details, IDX_LAZY_BODY), ARG(body));
+
+    return Init_Action_Unbound(D_OUT, stub);
+}
+
+
 //
 //  variadic?: native [
 //
@@ -1143,7 +1215,7 @@ REBNATIVE(reskinned)
 //          [action!]
 //      action "(modified) Action to modify property of"
 //          [action!]
-//      property "Currently must be [defer postpone]"
+//      property "Currently must be [defer postpone pure]"
 //          [word!]
 //      enable [logic!]
 //  ]
@@ -1173,8 +1245,16 @@ REBNATIVE(tweak)
         flag = PARAMLIST_FLAG_POSTPONES_ENTIRELY;
         break;
 
+      case SYM_PURE: {  // No side effects, result depends only on arguments
+        REBARR *details = ACT_DETAILS(act);
+        if (VAL_LOGIC(ARG(enable)))
+            SER(details)->header.bits |= DETAILS_FLAG_IS_PURE;
+        else
+            SER(details)->header.bits &= ~DETAILS_FLAG_IS_PURE;
+        RETURN (ARG(action)); }
+
       default:
-        fail ("TWEAK currently only supports [defer postpone]");
+        fail ("TWEAK currently only supports [defer postpone pure]");
     }
 
     if (VAL_LOGIC(ARG(enable)))
@@ -1186,6 +1266,228 @@ REBNATIVE(tweak)
 }
 
 
+// FOLD will only run an action if all its arguments can be gathered from
+// inert values immediately after it.  Refinements are okay (they will just
+// be unused), but quoting, skippable, or variadic parameters could take
+// something other than the one literal value that follows.
+//
+static bool Get_Fold_Arity(REBLEN *arity_out, REBACT *act)
+{
+    if (ACT_EXEMPLAR(act))
+        return false;  // specializations may have gathered args already
+
+    REBLEN arity = 0;
+    REBVAL *param = ACT_PARAMS_HEAD(act);
+    for (; NOT_END(param); ++param) {
+        Reb_Param_Class pclass = VAL_PARAM_CLASS(param);
+        if (pclass == REB_P_LOCAL or pclass == REB_P_RETURN)
+            continue;
+        if (TYPE_CHECK(param, REB_TS_REFINEMENT))
+            continue;
+        if (pclass != REB_P_NORMAL)
+            return false;
+        if (Is_Param_Variadic(param) or Is_Param_Skippable(param))
+            return false;
+        ++arity;
+    }
+
+    *arity_out = arity;
+    return true;
+}
+
+
+// The result of a call can only stand in for the call if it's something
+// that isn't modified in place.  `join "a" "b"` makes a new string on each
+// run, so replacing it with one string that is shared would be visible.
+//
+static bool Is_Foldable_Result(const REBVAL *v)
+{
+    if (IS_NULLED(v) or IS_VOID(v))
+        return false;  // can't be put in an array (or means something else)
+
+    return ANY_SCALAR(v) or IS_LOGIC(v) or IS_BLANK(v) or IS_DATATYPE(v)
+        or ANY_WORD(v);
+}
+
+
+struct Reb_Fold_Step {
+    REBVAL *out;
+    const REBVAL *position;  // ANY-ARRAY! at the call to run
+    REBLEN index_out;
+};
+
+static REBVAL *Fold_Step_Dangerous(struct Reb_Fold_Step *s)
+{
+    if (Eval_Step_In_Any_Array_At_Throws(
+        s->out,
+        &s->index_out,
+        s->position,
+        SPECIFIED,
+        EVAL_MASK_DEFAULT
+    )){
+        fail (Error_No_Catch_For_Throw(s->out));
+    }
+    return nullptr;
+}
+
+
+// Push the items of the array to the data stack, with calls to pure actions
+// on inert arguments replaced with their results.  A call whose arguments
+// don't typecheck (or which fails for any other reason) is left as-is, as
+// the code may never have been going to run it.
+//
+static void Push_Folded_Items(
+    REBARR *a,
+    REBLEN index,
+    REBSPC *specifier,
+    bool deep
+){
+    RELVAL *head = ARR_HEAD(a);
+    REBLEN len = ARR_LEN(a);
+
+    if (C_STACK_OVERFLOWING(&len))
+        Fail_Stack_Overflow();
+
+    DECLARE_LOCAL (position);
+    SET_END(position);
+    DECLARE_LOCAL (result);
+    SET_END(result);
+    PUSH_GC_GUARD(position);
+    PUSH_GC_GUARD(result);
+
+    while (index < len) {
+        const RELVAL *item = head + index;
+        REBLEN arity = 0;
+
+        const REBVAL *var;
+        if (
+            not IS_WORD(item)
+            or not (var = Try_Get_Opt_Var(item, specifier))
+            or not IS_ACTION(var)
+            or not Is_Action_Pure(VAL_ACTION(var))
+            or GET_ACTION_FLAG(VAL_ACTION(var), ENFIXED)
+            or not Get_Fold_Arity(&arity, VAL_ACTION(var))
+            or index + 1 + arity > len
+        ){
+            goto push_item;
+        }
+
+      blockscope {
+        REBLEN n;
+        for (n = 1; n <= arity; ++n) {
+            if (not ANY_INERT(head + index + n))
+                goto push_item;
+        }
+
+        // An enfix operator after the last argument would take it (e.g. in
+        // `add 1 2 * 3` the * runs first), so don't fold in that case.
+        //
+        if (index + 1 + arity < len) {
+            const RELVAL *next = head + index + 1 + arity;
+            const REBVAL *next_var;
+            if (
+                IS_WORD(next)
+                and (next_var = Try_Get_Opt_Var(next, specifier))
+                and IS_ACTION(next_var)
+                and GET_ACTION_FLAG(VAL_ACTION(next_var), ENFIXED)
+            ){
+                goto push_item;
+            }
+        }
+
+        Init_Any_Series_At_Core(position, REB_BLOCK, SER(a), index, specifier);
+
+        struct Reb_Fold_Step s;
+        s.out = result;
+        s.position = position;
+
+        REBVAL *error = rebRescue(cast(REBDNG*, &Fold_Step_Dangerous), &s);
+        if (error) {
+            rebRelease(error);
+            goto push_item;
+        }
+        if (
+            s.index_out != index + 1 + arity
+            or IS_END(result)  // invisible
+            or not Is_Foldable_Result(result)
+        ){
+            goto push_item;
+        }
+
+        Move_Value(DS_PUSH(), result);
+        if (not ANY_INERT(DS_TOP))
+            Quotify(DS_TOP, 1);  // e.g. a WORD! result shouldn't be looked up
+        if (GET_CELL_FLAG(item, NEWLINE_BEFORE))
+            SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+
+        ++TG_Folded_Calls;
+        index += 1 + arity;
+        continue;
+      }
+
+      push_item:
+        if (deep and (IS_BLOCK(item) or IS_GROUP(item))) {
+            REBDSP dsp_orig = DSP;
+            REBSPC *derived = Derive_Specifier(specifier, item);
+            Push_Folded_Items(VAL_ARRAY(item), 0, derived, deep);
+            REBARR *folded = Pop_Stack_Values_Core(
+                dsp_orig,
+                NODE_FLAG_MANAGED | ARRAY_MASK_HAS_FILE_LINE
+            );
+            if (GET_ARRAY_FLAG(VAL_ARRAY(item), NEWLINE_AT_TAIL))
+                SET_ARRAY_FLAG(folded, NEWLINE_AT_TAIL);
+            Init_Any_Array_At(DS_PUSH(), VAL_TYPE(item), folded, VAL_INDEX(item));
+            if (GET_CELL_FLAG(item, NEWLINE_BEFORE))
+                SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+        }
+        else
+            Derelativize(DS_PUSH(), item, specifier);
+        ++index;
+    }
+
+    DROP_GC_GUARD(result);
+    DROP_GC_GUARD(position);
+}
+
+
+//
+//  fold: native [
+//
+//  {Copy a block with calls to <pure> actions on literals run in advance}
+//
+//      return: [block!]
+//      block "Not modified, the result is a new block"
+//          [block!]
+//      /deep "Fold inside of nested BLOCK!s and GROUP!s too"
+//  ]
+//
+REBNATIVE(fold)
+//
+// Usermode code can only know a call like `add 1 2` is pure if the action is
+// marked as such (see DETAILS_FLAG_IS_PURE).  Folding is something the caller
+// asks for, like COMPOSE: it can't tell if a call is the literal argument of
+// some quoting function, and will fold it regardless.  STATS/FOLDS counts
+// how many calls have been replaced.
+{
+    INCLUDE_PARAMS_OF_FOLD;
+
+    REBVAL *block = ARG(block);
+
+    REBDSP dsp_orig = DSP;
+    Push_Folded_Items(
+        VAL_ARRAY(block),
+        VAL_INDEX(block),
+        VAL_SPECIFIER(block),
+        did REF(deep)
+    );
+
+    REBARR *folded = Pop_Stack_Values_Core(dsp_orig, ARRAY_MASK_HAS_FILE_LINE);
+    if (GET_ARRAY_FLAG(VAL_ARRAY(block), NEWLINE_AT_TAIL))
+        SET_ARRAY_FLAG(folded, NEWLINE_AT_TAIL);
+    return Init_Block(D_OUT, folded);
+}
+
+
 REB_R Downshot_Dispatcher(REBFRM *f) // runs until count is reached
 {
     REBARR *details = ACT_DETAILS(FRM_PHASE(f));
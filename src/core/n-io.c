@@ -54,9 +54,16 @@ REBNATIVE(form)
 //      /flat "No indentation"
 //      /limit "Limit to a certain length"
 //          [integer!]
+//      /sink "Pass BINARY! chunks of UTF-8 to this action, don't make TEXT!"
+//          [action!]
 //  ]
 //
 REBNATIVE(mold)
+//
+// A sink lets something like `mold/sink data :write-chunk` write out a large
+// block without the whole molded form sitting in the mold buffer.  Chunks are
+// split only between items of the outermost array, so each is whole UTF-8.
+// (See Flush_Mold_To_Sink())
 {
     INCLUDE_PARAMS_OF_MOLD;
 
@@ -69,15 +76,33 @@ REBNATIVE(mold)
         SET_MOLD_FLAG(mo, MOLD_FLAG_LIMIT);
         mo->limit = Int32(ARG(limit));
     }
+    if (REF(sink)) {
+        if (REF(limit))
+            fail (Error_Bad_Refines_Raw());
+        mo->sink = ARG(sink);
+    }
 
     Push_Mold(mo);
 
     if (REF(only) and IS_BLOCK(ARG(value)))
         SET_MOLD_FLAG(mo, MOLD_FLAG_ONLY);
 
+    mo->sink_depth = SER_LEN(TG_Mold_Stack);
     Mold_Value(mo, ARG(value));
 
-    return Init_Text(D_OUT, Pop_Molded_String(mo));
+    if (not REF(sink))
+        return Init_Text(D_OUT, Pop_Molded_String(mo));
+
+    REBSIZ size = STR_SIZE(mo->series) - mo->offset;
+    REBVAL *chunk = rebSizedBinary(BIN_AT(SER(mo->series), mo->offset), size);
+    Drop_Mold(mo);
+
+    if (size != 0)
+        rebElide(ARG(sink), rebR(chunk), rebEND);
+    else
+        rebRelease(chunk);
+
+    return Init_Void(D_OUT);
 }
 
 
@@ -201,6 +201,275 @@ static REB_R Loop_Series_Common(
 }
 
 
+//=//// FUSED INTEGER BODIES //////////////////////////////////////////////=//
+//
+// Counting loops like `repeat i n [total: total + i]` spend nearly all their
+// time in the evaluator: a frame for the body, a lookup for each word, and a
+// dispatch to ADD for every `+`.  When a REPEAT or FOR body consists only of
+// statements shaped like:
+//
+//     word: term op term op term ...
+//
+// ...where each term is an INTEGER! literal or a WORD!, and each op is a
+// WORD! that looks up to the enfixed ADD, SUBTRACT or MULTIPLY generic, the
+// body is compiled once into a list of steps and run directly on the int64
+// payloads of the variables, which are looked up just once for the loop.
+//
+// Nothing but these steps runs while fused, so the variable cells can't move
+// and the ops can't be redefined.  If a term isn't a 64-bit INTEGER! when
+// read, or an operation overflows, the rest of that iteration's body is run
+// by the evaluator from the statement in progress (promoting, or raising
+// whatever error it would have) and fusion is dropped for the rest of the
+// loop, as arbitrary code may then have run.
+//
+
+#define MAX_FUSED_STEPS 32
+
+enum Reb_Fused_Kind {
+    FUSED_LOAD,  // start a statement with a term
+    FUSED_ADD,
+    FUSED_SUBTRACT,
+    FUSED_MULTIPLY,
+    FUSED_STORE  // end a statement by writing the SET-WORD!'s variable
+};
+
+struct Reb_Fused_Step {
+    enum Reb_Fused_Kind kind;
+    REBVAL *var;  // variable of a WORD! term or the SET-WORD!, else nullptr
+    REBI64 literal;  // term that was an INTEGER! in the body
+    REBLEN index;  // FUSED_LOAD: body index of the statement's SET-WORD!
+};
+
+struct Reb_Fused_Body {
+    REBLEN num_steps;  // 0 if the body can't be (or is no longer) fused
+    struct Reb_Fused_Step steps[MAX_FUSED_STEPS];
+};
+
+
+// Variable for a word in the body, or nullptr if it isn't bound to one we
+// could get or set without the evaluator raising an error.
+//
+static REBVAL *Try_Get_Fusable_Var(
+    const RELVAL *word,
+    REBSPC *specifier,
+    bool writable
+){
+    if (not VAL_BINDING(word))
+        return nullptr;
+
+    REBCTX *c = Get_Var_Context(word, specifier);
+    if (GET_SERIES_INFO(c, INACCESSIBLE))
+        return nullptr;
+    if (writable and Is_Series_Read_Only(SER(CTX_VARLIST(c))))
+        return nullptr;
+
+    REBVAL *var = CTX_VAR(c, VAL_WORD_INDEX(word));
+    if (writable and GET_CELL_FLAG(var, PROTECTED))
+        return nullptr;
+    return var;
+}
+
+
+// If a WORD! in the body looks up to the infix math generics, give the step
+// for it.  FUSED_LOAD means it isn't one (it can't be fused either way).
+//
+static enum Reb_Fused_Kind Fused_Op_Kind(const RELVAL *word, REBSPC *spec)
+{
+    REBVAL *var = Try_Get_Fusable_Var(word, spec, false);
+    if (
+        not var
+        or not IS_ACTION(var)
+        or NOT_ACTION_FLAG(VAL_ACTION(var), ENFIXED)
+        or ACT_DISPATCHER(VAL_ACTION(var)) != &Generic_Dispatcher
+    ){
+        return FUSED_LOAD;
+    }
+
+    switch (VAL_WORD_SYM(ARR_HEAD(ACT_DETAILS(VAL_ACTION(var))))) {
+      case SYM_ADD:
+        return FUSED_ADD;
+      case SYM_SUBTRACT:
+        return FUSED_SUBTRACT;
+      case SYM_MULTIPLY:
+        return FUSED_MULTIPLY;
+      default:
+        return FUSED_LOAD;
+    }
+}
+
+
+static bool Fuse_Term(
+    struct Reb_Fused_Step *step,
+    const RELVAL *item,
+    REBSPC *specifier
+){
+    step->var = nullptr;
+    step->literal = 0;
+    if (IS_INTEGER(item) and not IS_INTEGER_BIG(item)) {
+        step->literal = VAL_INT64(item);
+        return true;
+    }
+    if (IS_WORD(item)) {
+        step->var = Try_Get_Fusable_Var(item, specifier, false);
+        return step->var != nullptr;
+    }
+    return false;
+}
+
+
+//
+//  Fuse_Loop_Body: C
+//
+// Compile a loop body into `fb` if it has the form described above.  The
+// body is <const>, so it can't change under the compiled steps.
+//
+static void Fuse_Loop_Body(struct Reb_Fused_Body *fb, const REBVAL *body)
+{
+    fb->num_steps = 0;
+    if (not IS_BLOCK(body) or VAL_LEN_AT(body) == 0)
+        return;
+
+    REBSPC *specifier = VAL_SPECIFIER(body);
+    const RELVAL *item = VAL_ARRAY_AT(body);
+    REBLEN index = VAL_INDEX(body);
+    REBLEN n = 0;
+
+    while (NOT_END(item)) {
+        if (not IS_SET_WORD(item) or n + 2 > MAX_FUSED_STEPS)
+            return;
+        const RELVAL *set_word = item;
+
+        fb->steps[n].kind = FUSED_LOAD;
+        fb->steps[n].index = index;
+        ++item;
+        ++index;
+        if (IS_END(item) or not Fuse_Term(&fb->steps[n], item, specifier))
+            return;
+        ++n;
+        ++item;
+        ++index;
+
+        while (NOT_END(item) and IS_WORD(item)) {  // must be an op, or fail
+            enum Reb_Fused_Kind kind = Fused_Op_Kind(item, specifier);
+            if (kind == FUSED_LOAD or n + 2 > MAX_FUSED_STEPS)
+                return;
+            fb->steps[n].kind = kind;
+            ++item;
+            ++index;
+            if (IS_END(item) or not Fuse_Term(&fb->steps[n], item, specifier))
+                return;
+            ++n;
+            ++item;
+            ++index;
+        }
+
+        fb->steps[n].kind = FUSED_STORE;
+        fb->steps[n].var = Try_Get_Fusable_Var(set_word, specifier, true);
+        if (not fb->steps[n].var)
+            return;
+        ++n;
+    }
+
+    fb->num_steps = n;
+}
+
+
+// Returns false if a term wasn't a 64-bit integer or math overflowed, with
+// `resume` set to the index of the statement that was in progress.
+//
+static bool Run_Fused_Steps(
+    REBVAL *out,
+    const struct Reb_Fused_Body *fb,
+    REBLEN *resume
+){
+    REBI64 acc = 0;
+    REBI64 term;
+
+    const struct Reb_Fused_Step *step = fb->steps;
+    const struct Reb_Fused_Step *tail = step + fb->num_steps;
+    for (; step != tail; ++step) {
+        if (step->kind == FUSED_STORE) {
+            Init_Integer(step->var, acc);
+            continue;
+        }
+
+        if (not step->var)
+            term = step->literal;
+        else if (IS_INTEGER(step->var) and not IS_INTEGER_BIG(step->var))
+            term = VAL_INT64(step->var);
+        else
+            goto bail;
+
+        switch (step->kind) {
+          case FUSED_LOAD:
+            *resume = step->index;
+            acc = term;
+            break;
+
+          case FUSED_ADD:
+            if (REB_I64_ADD_OF(acc, term, &acc))
+                goto bail;
+            break;
+
+          case FUSED_SUBTRACT:
+            if (REB_I64_SUB_OF(acc, term, &acc))
+                goto bail;
+            break;
+
+          default:
+            assert(step->kind == FUSED_MULTIPLY);
+            if (REB_I64_MUL_OF(acc, term, &acc))
+                goto bail;
+            break;
+        }
+    }
+
+    Init_Integer(out, acc);  // body's result is its last assignment
+    return true;
+
+  bail:
+    return false;
+}
+
+
+// Do_Branch_Throws() for the body of a counting loop, using the fused steps
+// if there are any.
+//
+static bool Do_Loop_Body_Throws(
+    REBVAL *out,
+    const REBVAL *body,
+    struct Reb_Fused_Body *fb
+){
+    if (fb->num_steps == 0)
+        return Do_Branch_Throws(out, nullptr, body);
+
+    // Fused steps don't go through the evaluator, so they must count down
+    // to the signal check it would make--else a HALT couldn't stop the loop.
+    // The signals may run code that changes the variables, so recompile.
+    //
+    assert(Eval_Count >= 0);
+    if (--Eval_Count == 0) {
+        if (Do_Signals_Throws(out))
+            return true;
+
+        Fuse_Loop_Body(fb, body);
+        if (fb->num_steps == 0)
+            return Do_Branch_Throws(out, nullptr, body);
+    }
+
+    REBLEN resume = VAL_INDEX(body);
+    if (Run_Fused_Steps(out, fb, &resume))
+        return false;
+
+    fb->num_steps = 0;  // the evaluator may run arbitrary code from here on
+
+    DECLARE_LOCAL (rest);
+    Move_Value(rest, body);
+    VAL_INDEX(rest) = resume;
+    return Do_Any_Array_At_Throws(out, rest, SPECIFIED);
+}
+
+
 //
 //  Loop_Integer_Common: C
 //
@@ -222,10 +491,13 @@ static REB_R Loop_Integer_Common(
     REBI64 *state = &VAL_INT64(var);
     *state = start;
 
+    struct Reb_Fused_Body fused;
+    Fuse_Loop_Body(&fused, body);
+
     // Run only once if start is equal to end...edge case.
     //
     if (start == end) {
-        if (Do_Branch_Throws(out, nullptr, body)) {
+        if (Do_Loop_Body_Throws(out, body, &fused)) {
             bool broke;
             if (not Catching_Break_Or_Continue(out, &broke))
                 return R_THROWN;
@@ -244,7 +516,7 @@ static REB_R Loop_Integer_Common(
         return nullptr;  // avoid infinite loops
 
     while (counting_up ? *state <= end : *state >= end) {
-        if (Do_Branch_Throws(out, nullptr, body)) {
+        if (Do_Loop_Body_Throws(out, body, &fused)) {
             bool broke;
             if (not Catching_Break_Or_Continue(out, &broke))
                 return R_THROWN;
@@ -255,6 +527,8 @@ static REB_R Loop_Integer_Common(
 
         if (not IS_INTEGER(var))
             fail (Error_Invalid_Type(VAL_TYPE(var)));
+        if (IS_INTEGER_BIG(var))  // payload is no longer an int64
+            fail (Error_Overflow_Raw());
 
         if (REB_I64_ADD_OF(*state, bump, state))
             fail (Error_Overflow_Raw());
@@ -308,10 +582,13 @@ static REB_R Loop_Number_Common(
     REBDEC *state = &VAL_DECIMAL(var);
     *state = s;
 
+    struct Reb_Fused_Body fused;  // integer math not on the counter can fuse
+    Fuse_Loop_Body(&fused, body);
+
     // Run only once if start is equal to end...edge case.
     //
     if (s == e) {
-        if (Do_Branch_Throws(out, nullptr, body)) {
+        if (Do_Loop_Body_Throws(out, body, &fused)) {
             bool broke;
             if (not Catching_Break_Or_Continue(out, &broke))
                 return R_THROWN;
@@ -328,7 +605,7 @@ static REB_R Loop_Number_Common(
         return Init_Blank(out);  // avoid infinite loop, blank means never ran
 
     while (counting_up ? *state <= e : *state >= e) {
-        if (Do_Branch_Throws(out, nullptr, body)) {
+        if (Do_Loop_Body_Throws(out, body, &fused)) {
             bool broke;
             if (not Catching_Break_Or_Continue(out, &broke))
                 return R_THROWN;
@@ -42,7 +42,7 @@
     #define DBL_EPSILON 2.2204460492503131E-16
 #endif
 
-#define AS_DECIMAL(n) (IS_INTEGER(n) ? (REBDEC)VAL_INT64(n) : VAL_DECIMAL(n))
+#define AS_DECIMAL(n) (IS_INTEGER(n) ? Integer_To_Decimal(n) : VAL_DECIMAL(n))
 
 enum {SINE, COSINE, TANGENT};
 
@@ -102,6 +102,7 @@ static void Arc_Trans(REBVAL *out, const REBVAL *value, bool radians, REBLEN kin
 //
 //  "Returns the trigonometric cosine."
 //
+//      <pure>
 //      return: [decimal!]
 //      angle [any-number!]
 //      /radians
@@ -125,6 +126,7 @@ REBNATIVE(cosine)
 //
 //  "Returns the trigonometric sine."
 //
+//      <pure>
 //      return: [decimal!]
 //      angle [any-number!]
 //      /radians
@@ -292,6 +294,7 @@ REBNATIVE(log_2)
 //
 //  {Returns the natural (base-E) logarithm of the given value}
 //
+//      <pure>
 //      value [any-number!]
 //  ]
 //
@@ -312,6 +315,7 @@ REBNATIVE(log_e)
 //
 //  "Returns the square root of a number."
 //
+//      <pure>
 //      value [any-number!]
 //  ]
 //
@@ -327,6 +331,37 @@ REBNATIVE(square_root)
 }
 
 
+//
+//  random-generator: native [
+//
+//  {Select the generator RANDOM uses (reseeded with the last seed given)}
+//
+//      return: "The generator in effect before the call"
+//          [word!]
+//      name "KNUTH (the default), XOSHIRO256 or PCG64, BLANK! to just query"
+//          [blank! word!]
+//  ]
+//
+REBNATIVE(random_generator)
+//
+// Knuth's lagged Fibonacci generator stays the default so RANDOM/SEED keeps
+// reproducing the sequences it always has.  The others make 64 bits per
+// step from much less state, which matters for simulations.  /SECURE uses
+// ChaCha20 regardless of this setting.
+{
+    INCLUDE_PARAMS_OF_RANDOM_GENERATOR;
+
+    REBSYM old = Get_Random_Generator();
+
+    if (IS_WORD(ARG(name))) {
+        if (not Set_Random_Generator(VAL_WORD_SYM(ARG(name))))
+            fail (PAR(name));
+    }
+
+    return Init_Word(D_OUT, Canon(old));
+}
+
+
 
 //
 // The SHIFT native uses negation of an unsigned number.  Although the
@@ -348,6 +383,7 @@ REBNATIVE(square_root)
 //
 //  {Shifts an integer left or right by a number of bits.}
 //
+//      <pure>
 //      value [integer!]
 //      bits [integer!]
 //          "Positive for left shift, negative for right shift"
@@ -515,7 +551,7 @@ REBINT Compare_Modify_Values(RELVAL *a, RELVAL *b, REBINT strictness)
 
           case REB_INTEGER:
             if (tb == REB_DECIMAL || tb == REB_PERCENT) {
-                REBDEC dec_a = cast(REBDEC, VAL_INT64(a));
+                REBDEC dec_a = Integer_To_Decimal(a);
                 Init_Decimal(a, dec_a);
                 goto compare;
             }
@@ -529,7 +565,7 @@ REBINT Compare_Modify_Values(RELVAL *a, RELVAL *b, REBINT strictness)
           case REB_DECIMAL:
           case REB_PERCENT:
             if (tb == REB_INTEGER) {
-                REBDEC dec_b = cast(REBDEC, VAL_INT64(b));
+                REBDEC dec_b = Integer_To_Decimal(b);
                 Init_Decimal(b, dec_b);
                 goto compare;
             }
@@ -606,6 +642,7 @@ REBINT Compare_Modify_Values(RELVAL *a, RELVAL *b, REBINT strictness)
 //
 //  {TRUE if the values are equal}
 //
+//      <pure>
 //      return: [logic!]
 //      value1 [<opt> any-value!]
 //      value2 [<opt> any-value!]
@@ -777,6 +814,7 @@ REBNATIVE(same_q)
 //
 //  {TRUE if the first value is less than the second value}
 //
+//      <pure>
 //      return: [logic!]
 //      value1 value2
 //  ]
@@ -817,6 +855,7 @@ REBNATIVE(equal_or_lesser_q)
 //
 //  {TRUE if the first value is greater than the second value}
 //
+//      <pure>
 //      return: [logic!]
 //      value1 value2
 //  ]
@@ -857,6 +896,7 @@ REBNATIVE(greater_or_equal_q)
 //
 //  "Returns the greater of the two values."
 //
+//      <pure>
 //      value1 [any-scalar! date! any-series!]
 //      value2 [any-scalar! date! any-series!]
 //  ]
@@ -891,6 +931,7 @@ REBNATIVE(maximum)
 //
 //  "Returns the lesser of the two values."
 //
+//      <pure>
 //      value1 [any-scalar! date! any-series!]
 //      value2 [any-scalar! date! any-series!]
 //  ]
@@ -969,6 +1010,7 @@ REBNATIVE(positive_q)
 //
 //  {Returns TRUE if the value is zero (for its datatype).}
 //
+//      <pure>
 //      value
 //  ]
 //
@@ -606,3 +606,29 @@ REBNATIVE(lock)
 
     return D_OUT;
 }
+
+
+//
+//  freeze: native [
+//
+//  {Lock a value deeply, and move its series where the GC won't trace them}
+//
+//      return: [any-value!]
+//      value [any-value!]
+//  ]
+//
+REBNATIVE(freeze)
+//
+// This is for large data that is loaded once and then only read, such as
+// tables and configuration.  Recycles no longer pay to mark it, at the cost
+// of it never being freed.  (See Freeze_Into_Heap().)
+{
+    INCLUDE_PARAMS_OF_FREEZE;
+
+    REBVAL *v = ARG(value);
+
+    Ensure_Value_Frozen(v, nullptr);
+    Freeze_Into_Heap(v);
+
+    RETURN (v);
+}
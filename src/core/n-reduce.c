@@ -24,14 +24,21 @@
 #include "sys-core.h"
 
 //
-//  Reduce_To_Stack_Throws: C
+//  Reduce_Core_Throws: C
 //
-// Reduce array from the index position specified in the value.
+// Reduce array from the index position specified in the value.  If `into`
+// is nullptr the results are pushed to the data stack, otherwise they are
+// appended directly to the tail of that array.
 //
-bool Reduce_To_Stack_Throws(
+// Writing into the array saves a copy when the caller would just pop the
+// stack into a fresh array anyway.  The tail is fetched fresh for each
+// result, since the evaluation may have modified the target array.
+//
+bool Reduce_Core_Throws(
     REBVAL *out,
     const RELVAL *any_array,
-    REBSPC *specifier
+    REBSPC *specifier,
+    REBARR *into  // if not nullptr, append here instead of pushing
 ){
     REBDSP dsp_orig = DSP;
 
@@ -60,18 +67,20 @@ bool Reduce_To_Stack_Throws(
             break;
         }
 
+        RELVAL *dest = into ? Alloc_Tail_Array(into) : DS_PUSH();
+
         // We can't put nulls into array cells, so we put BLANK!.  This is
         // compatible with historical behavior of `reduce [if 1 = 2 [<x>]]`
         // which produced `[#[none]]`, and is generally more useful than
         // putting VOID!, as more operations skip blanks vs. erroring.
         //
         if (IS_NULLED(out))
-            Init_Blank(DS_PUSH());
+            Init_Blank(dest);
         else
-            Move_Value(DS_PUSH(), out);
+            Move_Value(dest, out);
 
         if (line)
-            SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+            SET_CELL_FLAG(dest, NEWLINE_BEFORE);
     } while (NOT_END(*v));
 
     Drop_Frame_Unbalanced(f); // Drop_Frame() asserts on accumulation
@@ -79,6 +88,52 @@ bool Reduce_To_Stack_Throws(
 }
 
 
+//
+//  Reduce_To_Stack_Throws: C
+//
+bool Reduce_To_Stack_Throws(
+    REBVAL *out,
+    const RELVAL *any_array,
+    REBSPC *specifier
+){
+    return Reduce_Core_Throws(out, any_array, specifier, nullptr);
+}
+
+
+//
+//  Is_Array_Inert_At: C
+//
+// True if nothing from this position to the end of the array would evaluate
+// to anything but itself.  REDUCE and COMPOSE check this first, because
+// data blocks (e.g. `reduce [1 "a" <b>]`) are common and can be copied
+// without pushing a frame or accumulating on the stack.
+//
+bool Is_Array_Inert_At(const RELVAL *item)
+{
+    for (; NOT_END(item); ++item) {
+        if (not ANY_INERT(item))
+            return false;
+    }
+    return true;
+}
+
+
+//
+//  Append_Array_At_Shallow: C
+//
+// Append the values from an array position onto the tail of another array,
+// deriving any relative values.
+//
+void Append_Array_At_Shallow(
+    REBARR *a,
+    const RELVAL *item,
+    REBSPC *specifier
+){
+    for (; NOT_END(item); ++item)
+        Derelativize(Alloc_Tail_Array(a), item, specifier);
+}
+
+
 //
 //  reduce: native [
 //
@@ -88,6 +143,8 @@ bool Reduce_To_Stack_Throws(
 //          [<opt> any-value!]
 //      value "GROUP! and BLOCK! evaluate each item, single values evaluate"
 //          [any-value!]
+//      /into "Append the results to the tail of this array (and return it)"
+//          [any-array!]
 //  ]
 //
 REBNATIVE(reduce)
@@ -97,22 +154,60 @@ REBNATIVE(reduce)
     REBVAL *v = ARG(value);
 
     if (IS_BLOCK(v) or IS_GROUP(v)) {
-        REBDSP dsp_orig = DSP;
+        REBSPC *specifier = VAL_SPECIFIER(v);
 
-        if (Reduce_To_Stack_Throws(D_OUT, v, VAL_SPECIFIER(v)))
-            return R_THROWN;
+        if (REF(into)) {
+            FAIL_IF_READ_ONLY(ARG(into));
+            REBARR *into = VAL_ARRAY(ARG(into));  // frame arg keeps it alive
+
+            if (Is_Array_Inert_At(VAL_ARRAY_AT(v)))
+                Append_Array_At_Shallow(into, VAL_ARRAY_AT(v), specifier);
+            else if (Reduce_Core_Throws(D_OUT, v, specifier, into))
+                return R_THROWN;
+
+            RETURN (ARG(into));
+        }
 
-        REBFLGS pop_flags = NODE_FLAG_MANAGED | ARRAY_MASK_HAS_FILE_LINE;
+        // Inert content reduces to itself, so just copy.  (This is a shallow
+        // copy, as REDUCE has always given back new arrays.)
+        //
+        if (Is_Array_Inert_At(VAL_ARRAY_AT(v)))
+            return Init_Any_Array(
+                D_OUT,
+                VAL_TYPE(v),
+                Copy_Array_At_Extra_Shallow(
+                    VAL_ARRAY(v),
+                    VAL_INDEX(v),
+                    specifier,
+                    0,  // no extra capacity
+                    NODE_FLAG_MANAGED | ARRAY_MASK_HAS_FILE_LINE
+                )
+            );
+
+        // Most expressions produce one value, so the remaining length is a
+        // good guess for the result's size.  Reducing directly into it saves
+        // the copy from the data stack.  It's managed so it can be guarded
+        // during the evaluations, and abandoned to the GC on a throw.
+        //
+        REBFLGS flags = NODE_FLAG_MANAGED | ARRAY_MASK_HAS_FILE_LINE;
         if (GET_ARRAY_FLAG(VAL_ARRAY(v), NEWLINE_AT_TAIL))
-            pop_flags |= ARRAY_FLAG_NEWLINE_AT_TAIL;
+            flags |= ARRAY_FLAG_NEWLINE_AT_TAIL;
 
-        return Init_Any_Array(
-            D_OUT,
-            VAL_TYPE(v),
-            Pop_Stack_Values_Core(dsp_orig, pop_flags)
-        );
+        REBARR *a = Make_Array_Core(VAL_LEN_AT(v), flags);
+        PUSH_GC_GUARD(a);
+
+        bool threw = Reduce_Core_Throws(D_OUT, v, specifier, a);
+
+        DROP_GC_GUARD(a);
+        if (threw)
+            return R_THROWN;
+
+        return Init_Any_Array(D_OUT, VAL_TYPE(v), a);
     }
 
+    if (REF(into))
+        fail (Error_Bad_Refines_Raw());
+
     // Single element REDUCE does an EVAL, but doesn't allow arguments.
     // (R3-Alpha, would just return the input, e.g. `reduce :foo` => :foo)
     // If there are arguments required, Eval_Value_Throws() will error.
@@ -143,6 +238,56 @@ bool Match_For_Compose(const RELVAL *group, const REBVAL *label) {
 }
 
 
+//
+//  Compose_Positions: C
+//
+// Get the positions in an array of the cells COMPOSE can't just copy (any
+// ANY-ARRAY! or ANY-PATH!, quoted or not), as a BINARY! of REBLENs.  These
+// are remembered per template (see TG_Compose_Arrays), since the same one
+// tends to be composed over and over with different values for its groups.
+//
+// The binary should be guarded while in use.  Composing a nested template
+// may evict this one from the cache, and the GC would free it.  Returns
+// nullptr if the cache isn't made yet (e.g. during boot).
+//
+REBSER *Compose_Positions(REBARR *a)
+{
+    if (not Root_Compose_Cache)
+        return nullptr;
+
+    uintptr_t h = cast(uintptr_t, a) >> 4;
+    REBLEN slot = (h ^ (h >> 8)) & (COMPOSE_CACHE_SIZE - 1);
+
+    RELVAL *cached = ARR_AT(VAL_ARRAY(Root_Compose_Cache), slot);
+    if (TG_Compose_Arrays[slot] == a and GET_ARRAY_FLAG(a, HAS_COMPOSE_CACHE))
+        return VAL_BINARY(cached);
+
+    REBLEN count = 0;
+    RELVAL *item = ARR_HEAD(a);
+    for (; NOT_END(item); ++item) {
+        if (ANY_ARRAY_OR_PATH_KIND(CELL_KIND(VAL_UNESCAPED(item))))
+            ++count;
+    }
+
+    REBSER *bin = Make_Binary(count * sizeof(REBLEN));
+    REBLEN *positions = cast(REBLEN*, BIN_HEAD(bin));
+    REBLEN n = 0;
+    for (item = ARR_HEAD(a); NOT_END(item); ++item) {
+        if (ANY_ARRAY_OR_PATH_KIND(CELL_KIND(VAL_UNESCAPED(item))))
+            *positions++ = n;
+        ++n;
+    }
+    TERM_BIN_LEN(bin, count * sizeof(REBLEN));
+
+    Note_Series_Mutation(SER(VAL_ARRAY(Root_Compose_Cache)));
+    Init_Binary(cached, bin);  // manages it
+    TG_Compose_Arrays[slot] = a;
+    SET_ARRAY_FLAG(a, HAS_COMPOSE_CACHE);
+
+    return bin;
+}
+
+
 //
 //  Compose_To_Stack_Core: C
 //
@@ -155,6 +300,11 @@ bool Match_For_Compose(const RELVAL *group, const REBVAL *label) {
 // an array also offers more options for avoiding that intermediate if the
 // caller wants to add part or all of the popped data to an existing array.
 //
+// Only the positions from Compose_Positions() are examined.  The runs of
+// cells between them are copied without a look.  The frame is just there to
+// hold the template against modification while the groups run, and to
+// release that hold if there's a failure.
+//
 // Returns R_UNHANDLED if the composed series is identical to the input, or
 // nullptr if there were compositions.  R_THROWN if there was a throw.  It
 // leaves the accumulated values for the current stack level, so the caller
@@ -175,10 +325,29 @@ REB_R Compose_To_Stack_Core(
 
     bool changed = false;
 
+    REBARR *array = VAL_ARRAY(any_array);
+    const RELVAL *tail = ARR_TAIL(array);
+    const RELVAL *item = VAL_INDEX(any_array) < ARR_LEN(array)
+        ? VAL_ARRAY_AT(any_array)
+        : tail;
+
+    // With no positions, every cell is looked at (as if all were listed).
+    //
+    REBSER *bin = Compose_Positions(array);
+    const REBLEN *positions = nullptr;
+    const REBLEN *positions_tail = nullptr;
+    if (bin) {
+        PUSH_GC_GUARD(bin);
+        positions = cast(const REBLEN*, BIN_HEAD(bin));
+        positions_tail = positions + BIN_LEN(bin) / sizeof(REBLEN);
+        REBLEN index = VAL_INDEX(any_array);
+        while (positions != positions_tail and *positions < index)
+            ++positions;
+    }
+
     DECLARE_FEED_AT_CORE (feed, any_array, specifier);
 
     DECLARE_FRAME (f, feed, EVAL_MASK_DEFAULT);
-    SHORTHAND (v, f->feed->value, NEVERNULL(const RELVAL*));
 
     Push_Frame(nullptr, f);
 
@@ -186,16 +355,28 @@ REB_R Compose_To_Stack_Core(
     f->was_eval_called = true;  // lie since we're using frame for enumeration
   #endif
 
-    for (; NOT_END(*v); Fetch_Next_Forget_Lookback(f)) {
-        const REBCEL *cell = VAL_UNESCAPED(*v);
+    for (; item != tail; ++item) {
+        if (bin) {
+            const RELVAL *stop = (positions == positions_tail)
+                ? tail
+                : ARR_AT(array, *positions++);
+
+            for (; item != stop; ++item)
+                Derelativize(DS_PUSH(), item, specifier);  // keep newline flag
+
+            if (item == tail)
+                break;
+        }
+
+        const REBCEL *cell = VAL_UNESCAPED(item);
         enum Reb_Kind kind = CELL_KIND(cell); // notice `''(...)`
 
         if (not ANY_ARRAY_OR_PATH_KIND(kind)) { // won't substitute/recurse
-            Derelativize(DS_PUSH(), *v, specifier); // keep newline flag
+            Derelativize(DS_PUSH(), item, specifier); // keep newline flag
             continue;
         }
 
-        REBLEN quotes = VAL_NUM_QUOTES(*v);
+        REBLEN quotes = VAL_NUM_QUOTES(item);
 
         bool doubled_group = false;  // override predicate with ((...))
 
@@ -207,8 +388,8 @@ REB_R Compose_To_Stack_Core(
             // Don't compose at this level, but may need to walk deeply to
             // find compositions inside it if /DEEP and it's an array
         }
-        else if (not only and Is_Any_Doubled_Group(*v)) {
-            RELVAL *inner = VAL_ARRAY_AT(*v);
+        else if (not only and Is_Any_Doubled_Group(item)) {
+            RELVAL *inner = VAL_ARRAY_AT(item);
             if (Match_For_Compose(inner, label)) {
                 doubled_group = true;
                 match = inner;
@@ -216,8 +397,8 @@ REB_R Compose_To_Stack_Core(
             }
         }
         else {  // plain compose, if match
-            if (Match_For_Compose(*v, label)) {
-                match = *v;
+            if (Match_For_Compose(item, label)) {
+                match = item;
                 match_specifier = specifier;
             }
         }
@@ -235,6 +416,8 @@ REB_R Compose_To_Stack_Core(
             if (Do_Feed_To_End_Maybe_Stale_Throws(out, subfeed)) {
                 DS_DROP_TO(dsp_orig);
                 Abort_Frame(f);
+                if (bin)
+                    DROP_GC_GUARD(bin);
                 return R_THROWN;
             }
             CLEAR_CELL_FLAG(out, OUT_MARKED_STALE);
@@ -277,7 +460,7 @@ REB_R Compose_To_Stack_Core(
                     // that block to fit on one line?
                     //
                     Derelativize(DS_PUSH(), push, VAL_SPECIFIER(insert));
-                    if (GET_CELL_FLAG(*v, NEWLINE_BEFORE))
+                    if (GET_CELL_FLAG(item, NEWLINE_BEFORE))
                         SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
                     else
                         CLEAR_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
@@ -311,7 +494,7 @@ REB_R Compose_To_Stack_Core(
 
                 // Use newline intent from the GROUP! in the compose pattern
                 //
-                if (GET_CELL_FLAG(*v, NEWLINE_BEFORE))
+                if (GET_CELL_FLAG(item, NEWLINE_BEFORE))
                     SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
                 else
                     CLEAR_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
@@ -343,6 +526,8 @@ REB_R Compose_To_Stack_Core(
             if (r == R_THROWN) {
                 DS_DROP_TO(dsp_orig);  // drop to outer DSP (@ function start)
                 Abort_Frame(f);
+                if (bin)
+                    DROP_GC_GUARD(bin);
                 return R_THROWN;
             }
 
@@ -353,7 +538,7 @@ REB_R Compose_To_Stack_Core(
                 // may be controlled by a switch if it turns out to be needed.
                 //
                 DS_DROP_TO(dsp_deep);
-                Derelativize(DS_PUSH(), *v, specifier);
+                Derelativize(DS_PUSH(), item, specifier);
                 continue;
             }
 
@@ -377,7 +562,7 @@ REB_R Compose_To_Stack_Core(
 
             Quotify(DS_TOP, quotes);  // match original quoting
 
-            if (GET_CELL_FLAG(*v, NEWLINE_BEFORE))
+            if (GET_CELL_FLAG(item, NEWLINE_BEFORE))
                 SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
 
             changed = true;
@@ -385,11 +570,22 @@ REB_R Compose_To_Stack_Core(
         else {
             // compose [[(1 + 2)] (3 + 4)] => [[(1 + 2)] 7]  ; non-deep
             //
-            Derelativize(DS_PUSH(), *v, specifier);  // keep newline flag
+            Derelativize(DS_PUSH(), item, specifier);  // keep newline flag
         }
     }
 
+    // The feed was never fetched to its end, which is what would release
+    // the hold on the template.
+    //
+    if (GET_FEED_FLAG(f->feed, TOOK_HOLD)) {
+        CLEAR_SERIES_INFO(f->feed->array, HOLD);
+        CLEAR_FEED_FLAG(f->feed, TOOK_HOLD);
+    }
     Drop_Frame_Unbalanced(f);  // Drop_Frame() asserts on stack accumulation
+
+    if (bin)
+        DROP_GC_GUARD(bin);
+
     return changed ? nullptr : R_UNHANDLED;
 }
 
@@ -408,12 +604,18 @@ REB_R Compose_To_Stack_Core(
 //          [any-array! any-path! any-word! action!]
 //      /deep "Compose deeply into nested arrays"
 //      /only "Do not exempt ((...)) from predicate application"
+//      /into "Append the results to the tail of this array (and return it)"
+//          [any-array!]
 //  ]
 //
 REBNATIVE(compose)
 //
-// Note: /INTO is intentionally no longer supported
+// Note: /INTO was dropped for a time as part of "stopping the /INTO virus":
 // https://forum.rebol.info/t/stopping-the-into-virus/705
+//
+// It's back only as an append to the tail, and only because the stack can
+// be popped straight into the target, skipping the intermediate array that
+// `append target compose [...]` has to make.
 {
     INCLUDE_PARAMS_OF_COMPOSE;
 
@@ -435,8 +637,14 @@ REBNATIVE(compose)
         Move_Value(predicate, D_OUT);
     }
 
-    if (ANY_WORD(ARG(value)) or IS_ACTION(ARG(value)))
+    if (ANY_WORD(ARG(value)) or IS_ACTION(ARG(value))) {
+        if (REF(into))
+            fail (Error_Bad_Refines_Raw());
         RETURN (ARG(value));  // makes it easier to `set/hard compose target`
+    }
+
+    if (REF(into))
+        FAIL_IF_READ_ONLY(ARG(into));
 
     REBDSP dsp_orig = DSP;
 
@@ -462,6 +670,13 @@ REBNATIVE(compose)
     else
         assert(r == nullptr); // normal result, changed
 
+    if (REF(into)) {
+        REBARR *into = VAL_ARRAY(ARG(into));
+        Append_Values_Len(into, DS_AT(dsp_orig + 1), DSP - dsp_orig);
+        DS_DROP_TO(dsp_orig);
+        RETURN (ARG(into));
+    }
+
     // The stack values contain N NEWLINE_BEFORE flags, and we need N + 1
     // flags.  Borrow the one for the tail directly from the input REBARR.
     //
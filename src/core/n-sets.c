@@ -25,6 +25,131 @@
 #include "sys-core.h"
 
 
+// Set operations on strings track which codepoints they have seen.  ASCII
+// gets a flat table, and other codepoints go in an open-addressed hash that
+// is only allocated if one shows up.  (Zero marks an empty slot, which is
+// fine since NUL is ASCII.)
+//
+struct Reb_Codepoint_Set {
+    bool ascii[128];
+    REBSER *high;  // unmanaged series of REBUNI slots, nullptr if none yet
+    REBLEN high_mask;  // number of slots minus one (a power of 2)
+    REBLEN high_count;
+};
+
+#define MIN_CODEPOINT_SET_SLOTS 64
+
+static void Init_Codepoint_Set(struct Reb_Codepoint_Set *set)
+{
+    memset(set->ascii, 0, sizeof(set->ascii));
+    set->high = nullptr;
+    set->high_mask = 0;
+    set->high_count = 0;
+}
+
+static void Free_Codepoint_Set(struct Reb_Codepoint_Set *set)
+{
+    if (set->high)
+        Free_Unmanaged_Series(set->high);
+}
+
+inline static REBLEN Codepoint_Slot(REBUNI c, REBLEN mask) {
+    uint32_t h = cast(uint32_t, c) * 0x9E3779B1u;  // Fibonacci hashing
+    return (h ^ (h >> 15)) & mask;
+}
+
+static bool Codepoint_Set_Has(struct Reb_Codepoint_Set *set, REBUNI c)
+{
+    if (c < 0x80)
+        return set->ascii[c];
+
+    if (not set->high)
+        return false;
+
+    REBUNI *slots = SER_HEAD(REBUNI, set->high);
+    REBLEN slot = Codepoint_Slot(c, set->high_mask);
+    for (; slots[slot] != 0; slot = (slot + 1) & set->high_mask) {
+        if (slots[slot] == c)
+            return true;
+    }
+    return false;
+}
+
+static void Resize_Codepoint_Set(struct Reb_Codepoint_Set *set, REBLEN num)
+{
+    REBSER *old = set->high;
+    REBLEN old_num = old ? set->high_mask + 1 : 0;
+
+    set->high = Make_Series(num, sizeof(REBUNI));
+    set->high_mask = num - 1;
+    REBUNI *slots = SER_HEAD(REBUNI, set->high);
+    memset(slots, 0, num * sizeof(REBUNI));
+
+    if (not old)
+        return;
+
+    REBUNI *old_slots = SER_HEAD(REBUNI, old);
+    REBLEN n;
+    for (n = 0; n < old_num; ++n) {
+        if (old_slots[n] == 0)
+            continue;
+        REBLEN slot = Codepoint_Slot(old_slots[n], set->high_mask);
+        while (slots[slot] != 0)
+            slot = (slot + 1) & set->high_mask;
+        slots[slot] = old_slots[n];
+    }
+    Free_Unmanaged_Series(old);
+}
+
+// Returns false if the codepoint was already in the set.
+//
+static bool Add_To_Codepoint_Set(struct Reb_Codepoint_Set *set, REBUNI c)
+{
+    if (c < 0x80) {
+        if (set->ascii[c])
+            return false;
+        set->ascii[c] = true;
+        return true;
+    }
+
+    if (not set->high)
+        Resize_Codepoint_Set(set, MIN_CODEPOINT_SET_SLOTS);
+    else if ((set->high_count + 1) * 2 > set->high_mask + 1)
+        Resize_Codepoint_Set(set, (set->high_mask + 1) * 2);  // half full
+
+    REBUNI *slots = SER_HEAD(REBUNI, set->high);
+    REBLEN slot = Codepoint_Slot(c, set->high_mask);
+    for (; slots[slot] != 0; slot = (slot + 1) & set->high_mask) {
+        if (slots[slot] == c)
+            return false;
+    }
+    slots[slot] = c;
+    ++set->high_count;
+    return true;
+}
+
+
+//
+//  Find_Bin_Record: C
+//
+// Linear search for a `skip`-sized record of bytes, at positions that are
+// multiples of `skip` from `index`.
+//
+static bool Find_Bin_Record(
+    const REBYTE *record,
+    REBBIN *bin,
+    REBLEN index,
+    REBLEN skip
+){
+    REBLEN len = BIN_LEN(bin);
+    for (; index + skip <= len; index += skip) {
+        if (0 == memcmp(BIN_AT(bin, index), record, skip))
+            return true;
+    }
+    return false;
+}
+
+
 //
 //  Make_Set_Operation_Series: C
 //
@@ -173,6 +298,72 @@ REBSER *Make_Set_Operation_Series(
         out_ser = SER(Copy_Array_Shallow(ARR(buffer), SPECIFIED));
         Free_Unmanaged_Array(ARR(buffer));
     }
+    else if (ANY_STRING(val1) and skip == 1) {
+        DECLARE_MOLD (mo);
+
+        SET_MOLD_FLAG(mo, MOLD_FLAG_RESERVE);
+        mo->reserve = i;
+        Push_Mold(mo);
+
+        // Rather than searching the other string and the result so far for
+        // each character (quadratic), each pass puts the characters of the
+        // other string in a set, and a set is kept of what was emitted.
+        // Caseless operations put the lowercase form in the sets.
+        //
+        struct Reb_Codepoint_Set emitted;
+        Init_Codepoint_Set(&emitted);
+
+        do {
+            struct Reb_Codepoint_Set check;
+            if (flags & SOP_FLAG_CHECK) {
+                Init_Codepoint_Set(&check);
+
+                REBCHR(const*) cp = VAL_STRING_AT(val2);
+                REBLEN n = VAL_LEN_AT(val2);
+                for (; n != 0; --n) {
+                    REBUNI c;
+                    cp = NEXT_CHR(&c, cp);
+                    Add_To_Codepoint_Set(&check, cased ? c : LO_CASE(c));
+                }
+            }
+
+            REBCHR(const*) cp = VAL_STRING_AT(val1);
+            REBLEN n = VAL_LEN_AT(val1);
+            for (; n != 0; --n) {
+                REBUNI c;
+                cp = NEXT_CHR(&c, cp);
+                REBUNI key = cased ? c : LO_CASE(c);
+
+                if (flags & SOP_FLAG_CHECK) {
+                    h = Codepoint_Set_Has(&check, key);
+                    if (flags & SOP_FLAG_INVERT) h = !h;
+                    if (!h) continue;
+                }
+
+                if (Add_To_Codepoint_Set(&emitted, key))
+                    Append_Codepoint(mo->series, c);
+            }
+
+            if (flags & SOP_FLAG_CHECK)
+                Free_Codepoint_Set(&check);
+
+            if (not first_pass)
+                break;
+            first_pass = false;
+
+            // Iterate over second series?
+            //
+            if ((i = ((flags & SOP_FLAG_BOTH) != 0))) {
+                const REBVAL *temp = val1;
+                val1 = val2;
+                val2 = temp;
+            }
+        } while (i);
+
+        Free_Codepoint_Set(&emitted);
+
+        out_ser = SER(Pop_Molded_String(mo));
+    }
     else if (ANY_STRING(val1)) {
         DECLARE_MOLD (mo);
 
@@ -239,66 +430,67 @@ REBSER *Make_Set_Operation_Series(
         out_ser = SER(Pop_Molded_String(mo));
     }
     else {
-        assert(IS_BINARY(val1) and IS_BINARY(val2));
-
-        DECLARE_MOLD (mo);
+        assert(IS_BINARY(val1) and (not val2 or IS_BINARY(val2)));
 
         // All binaries use "case-sensitive" comparison (e.g. each byte
-        // is treated distinctly)
+        // is treated distinctly).  Single bytes are tracked with flat
+        // tables, while records of several bytes are searched for.
         //
-        cased = true;
+        UNUSED(cased);
 
-        // ask mo->series to have at least `i` capacity beyond mo->start
-        //
-        SET_MOLD_FLAG(mo, MOLD_FLAG_RESERVE);
-        mo->reserve = i;
-        Push_Mold(mo);
+        REBBIN *buffer = Make_Binary(i);
+        REBYTE *tail = BIN_HEAD(buffer);
+
+        bool emitted[256];
+        memset(emitted, 0, sizeof(emitted));
 
         do {
             REBBIN *bin = VAL_SERIES(val1); // val1 and val2 swapped 2nd pass!
-            REBYTE b;
+
+            bool check[256];
+            if ((flags & SOP_FLAG_CHECK) and skip == 1) {
+                memset(check, 0, sizeof(check));
+                REBLEN n;
+                for (n = VAL_INDEX(val2); n < VAL_LEN_HEAD(val2); ++n)
+                    check[*BIN_AT(VAL_SERIES(val2), n)] = true;
+            }
 
             // Iterate over first series
             //
             i = VAL_INDEX(val1);
-            for (; i < BIN_LEN(bin); i += skip) {
-                b = *BIN_AT(bin, i);
+            for (; i + skip <= BIN_LEN(bin); i += skip) {
+                REBYTE *record = BIN_AT(bin, i);
                 if (flags & SOP_FLAG_CHECK) {
-                    h = (NOT_FOUND != Find_Char_In_Bin(
-                        b,
-                        VAL_SERIES(val2),
-                        0,
-                        VAL_INDEX(val2),
-                        VAL_LEN_HEAD(val2),
-                        skip,
-                        cased ? AM_FIND_CASE : 0
-                    ));
+                    if (skip == 1)
+                        h = check[*record];
+                    else
+                        h = Find_Bin_Record(
+                            record, VAL_SERIES(val2), VAL_INDEX(val2), skip
+                        );
 
                     if (flags & SOP_FLAG_INVERT) h = !h;
                 }
 
                 if (!h) continue;
 
-                if (
-                    NOT_FOUND == Find_Char_In_Bin(
-                        b, // c2 (the character to find)
-                        SER(mo->series), // ser
-                        mo->offset, // head - !!! was mo->start
-                        mo->offset, // index - !!! was also mo->start
-                        STR_SIZE(mo->series), // tail
-                        skip, // skip
-                        cased ? AM_FIND_CASE : 0 // flags
-                    )
-                ){
-                    // This would append non-valid UTF-8 to the mold buffer.
-                    // There should probably be a byte buffer.
-                    //
-                    fail ("Binary set operations temporarily unsupported.");
-
-                    // Append_String(mo->series, ser, i, skip);
+                if (skip == 1) {
+                    if (emitted[*record])
+                        continue;
+                    emitted[*record] = true;
+                }
+                else {
+                    SET_SERIES_USED(buffer, tail - BIN_HEAD(buffer));
+                    if (Find_Bin_Record(record, buffer, 0, skip))
+                        continue;
                 }
+
+                memcpy(tail, record, skip);
+                tail += skip;
             }
 
+            if (i != BIN_LEN(bin))
+                fail (Error_Block_Skip_Wrong_Raw());
+
             if (not first_pass)
                 break;
             first_pass = false;
@@ -312,7 +504,8 @@ REBSER *Make_Set_Operation_Series(
             }
         } while (i);
 
-        out_ser = Pop_Molded_Binary(mo);
+        TERM_BIN_LEN(buffer, tail - BIN_HEAD(buffer));
+        out_ser = buffer;
     }
 
     return out_ser;
@@ -356,6 +549,9 @@ REBNATIVE(exclude)
         Init_Word(verb, Canon(SYM_EXCLUDE));
         REBBIN *result = Xandor_Binary(verb, bin1, bin2);
         INIT_BITS_NOT(result, false);
+        Combine_Bitset_Ranges(
+            result, VAL_BITSET(val1), VAL_BITSET(val2), SYM_EXCLUDE
+        );
         return Init_Bitset(D_OUT, Manage_Series(result));
     }
 
@@ -27,6 +27,172 @@
 #include "datatypes/sys-money.h"
 
 
+//=//// BYTE SCANNING FOR ENHEX, DEHEX, DELINE, ENLINE ////////////////////=//
+//
+// These natives only act on ASCII bytes: CR, LF, '%', and the characters
+// that must be percent encoded.  UTF-8 never uses bytes in the ASCII range
+// inside a multi-byte character, so the UTF-8 of a string can be scanned
+// bytewise for the next byte of interest, and the runs between copied in
+// bulk instead of decoded and re-encoded a codepoint at a time.
+//
+// On x86 the scans test 16 bytes per step with SSE2.  Every x86-64 CPU has
+// SSE2, so this is decided at compile time with no runtime check.
+//
+
+#if !defined(REBOL_NO_STRING_SIMD) && (defined(__SSE2__) \
+    || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+
+    #define STRING_SIMD_SSE2
+    #include <emmintrin.h>
+
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+
+    inline static unsigned int Lowest_Bit(unsigned int mask) {
+        unsigned long i;
+        _BitScanForward(&i, mask);
+        return i;
+    }
+
+    inline static unsigned int Highest_Bit(unsigned int mask) {
+        unsigned long i;
+        _BitScanReverse(&i, mask);
+        return i;
+    }
+  #else
+    #define Lowest_Bit(mask) \
+        cast(unsigned int, __builtin_ctz(mask))
+
+    #define Highest_Bit(mask) \
+        (31 - cast(unsigned int, __builtin_clz(mask)))
+  #endif
+#endif
+
+
+// RFC 3986 characters that ENHEX leaves alone, as a bitset over ASCII:
+//
+//     A-Z a-z 0-9 - . _ ~ : / ? # [ ] @ ! $ & ' ( ) * + , ; =
+//
+// https://stackoverflow.com/a/7109208/
+//
+static const uint32_t No_Encode_Bits[4] = {
+    0x00000000,  // controls
+    0xafffffda,  // ! # $ & ' ( ) * + , - . / 0-9 : ; = ?
+    0xafffffff,  // @ A-Z [ ] _
+    0x47fffffe  // a-z ~
+};
+
+#define Is_Url_Safe_Byte(b) \
+    ((b) < 0x80 and (No_Encode_Bits[(b) >> 5] & (1u << ((b) & 31))))
+
+
+//
+//  Skip_Url_Safe: C
+//
+// Return the first byte in [cp, ep) that ENHEX must encode, else `ep`.
+//
+static const REBYTE *Skip_Url_Safe(const REBYTE *cp, const REBYTE *ep)
+{
+  #if defined(STRING_SIMD_SSE2)
+    for (; ep - cp >= 16; cp += 16) {
+        __m128i v = _mm_loadu_si128(cast(const __m128i*, cp));
+
+        // Signed compare catches controls, space, and all of 0x80-0xFF
+        //
+        __m128i bad = _mm_cmplt_epi8(v, _mm_set1_epi8('!'));
+        bad = _mm_or_si128(bad, _mm_cmpeq_epi8(v, _mm_set1_epi8(0x7F)));
+
+        static const char others[] = "\"%<>\\^`{|}";
+        const char *o;
+        for (o = others; *o != '\0'; ++o)
+            bad = _mm_or_si128(bad, _mm_cmpeq_epi8(v, _mm_set1_epi8(*o)));
+
+        int mask = _mm_movemask_epi8(bad);
+        if (mask != 0)
+            return cp + Lowest_Bit(mask);
+    }
+  #endif
+
+    for (; cp != ep; ++cp)
+        if (not Is_Url_Safe_Byte(*cp))
+            return cp;
+    return ep;
+}
+
+
+//
+//  Find_Cr_Or_Lf: C
+//
+// Return the first CR or LF byte in [cp, ep), else `ep`.
+//
+static const REBYTE *Find_Cr_Or_Lf(const REBYTE *cp, const REBYTE *ep)
+{
+  #if defined(STRING_SIMD_SSE2)
+    const __m128i cr = _mm_set1_epi8(CR);
+    const __m128i lf = _mm_set1_epi8(LF);
+    for (; ep - cp >= 16; cp += 16) {
+        __m128i v = _mm_loadu_si128(cast(const __m128i*, cp));
+        int mask = _mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf))
+        );
+        if (mask != 0)
+            return cp + Lowest_Bit(mask);
+    }
+  #endif
+
+    for (; cp != ep; ++cp)
+        if (*cp == CR or *cp == LF)
+            return cp;
+    return ep;
+}
+
+
+//
+//  Find_Last_Lf: C
+//
+// Return the last LF byte in [bp, ep), else nullptr.
+//
+static const REBYTE *Find_Last_Lf(const REBYTE *bp, const REBYTE *ep)
+{
+  #if defined(STRING_SIMD_SSE2)
+    const __m128i lf = _mm_set1_epi8(LF);
+    for (; ep - bp >= 16; ep -= 16) {
+        __m128i v = _mm_loadu_si128(cast(const __m128i*, ep - 16));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v, lf));
+        if (mask != 0)
+            return ep - 16 + Highest_Bit(mask);
+    }
+  #endif
+
+    while (ep != bp)
+        if (*--ep == LF)
+            return ep;
+    return nullptr;
+}
+
+
+//
+//  Append_Utf8_Run: C
+//
+// Append UTF-8 that is known to be valid (e.g. a piece of another string),
+// so the only work is counting its codepoints for the cached length.
+//
+static void Append_Utf8_Run(REBSTR *dst, const REBYTE *utf8, REBSIZ size)
+{
+    REBLEN len = 0;
+    REBSIZ n;
+    for (n = 0; n < size; ++n)
+        if ((utf8[n] & 0xC0) != 0x80)  // not a continuation byte
+            ++len;
+
+    REBLEN old_len = STR_LEN(dst);
+    REBSIZ old_size = STR_SIZE(dst);
+    EXPAND_SERIES_TAIL(SER(dst), size);
+    memcpy(BIN_AT(SER(dst), old_size), utf8, size);
+    TERM_STR_LEN_SIZE(dst, old_len + len, old_size + size);
+}
+
+
 //
 //  delimit: native [
 //
@@ -289,139 +455,55 @@ REBNATIVE(enhex)
     INCLUDE_PARAMS_OF_ENHEX;
 
     // The details of what ASCII characters must be percent encoded
-    // are contained in RFC 3896, but a summary is here:
-    //
-    // https://stackoverflow.com/a/7109208/
+    // are contained in RFC 3896, see No_Encode_Bits for a summary.
     //
-    // Everything but: A-Z a-z 0-9 - . _ ~ : / ? # [ ] @ ! $ & ' ( ) * + , ; =
+    // All non-ASCII characters *must* be percent encoded, byte by byte of
+    // their UTF-8.  So the encoding works on the bytes of the string, and
+    // the output is all ASCII (size and length are the same).
+
+    REBSIZ size = VAL_SIZE_AT(ARG(string));
+    const REBYTE *head = cast(const REBYTE*, VAL_STRING_AT(ARG(string)));
+    const REBYTE *tail = head + size;
+
+    // Count the bytes needing encoding so the output is made in one step.
     //
-  #if !defined(NDEBUG)
-    const char *no_encode =
-        "ABCDEFGHIJKLKMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789" \
-            "-._~:/?#[]@!$&'()*+,;=";
-  #endif
+    REBSIZ num_encoded = 0;
+    const REBYTE *cp = head;
+    while ((cp = Skip_Url_Safe(cp, tail)) != tail) {
+        ++num_encoded;
+        ++cp;
+    }
 
     DECLARE_MOLD (mo);
     Push_Mold (mo);
 
-    REBLEN len = VAL_LEN_AT(ARG(string));
-    REBCHR(const*) cp = VAL_STRING_AT(ARG(string));
-
-    REBUNI c;
-    cp = NEXT_CHR(&c, cp);
+    REBLEN old_len = STR_LEN(mo->series);
+    REBSIZ old_size = STR_SIZE(mo->series);
+    REBSIZ added = size + 2 * num_encoded;
+    REBYTE *dp = Prep_Mold_Overestimated(mo, added);  // exact, not over
+
+    cp = head;
+    while (true) {
+        const REBYTE *run_tail = Skip_Url_Safe(cp, tail);
+        memcpy(dp, cp, run_tail - cp);
+        dp += run_tail - cp;
+        cp = run_tail;
+        if (cp == tail)
+            break;
 
-    REBLEN i;
-    for (i = 0; i < len; cp = NEXT_CHR(&c, cp), ++i) {
-        //
-        // !!! Length 4 should be legal here, but a warning in an older GCC
-        // is complaining that Encode_UTF8_Char reaches out of array bounds
-        // when it does not appear to.  Possibly related to this:
+        // Use uppercase hex digits, per RFC 3896 2.1, which is also
+        // consistent with JavaScript's encodeURIComponent()
         //
-        // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=43949
+        // https://tools.ietf.org/html/rfc3986#section-2.1
         //
-        REBYTE encoded[6];
-        REBLEN encoded_size;
-
-        if (c >= 0x80) {  // all non-ASCII characters *must* be percent encoded
-            encoded_size = Encoded_Size_For_Codepoint(c);
-            Encode_UTF8_Char(encoded, c, encoded_size);
-        }
-        else {
-            // "Everything else must be url-encoded".  Rebol's LEX_MAP does
-            // not have a bit for this in particular, though maybe it could
-            // be retooled to help more with this.  For now just use it to
-            // speed things up a little.
-
-            encoded[0] = cast(REBYTE, c);
-            encoded_size = 1;
-
-            switch (GET_LEX_CLASS(c)) {
-            case LEX_CLASS_DELIMIT:
-                switch (GET_LEX_VALUE(c)) {
-                case LEX_DELIMIT_LEFT_PAREN:
-                case LEX_DELIMIT_RIGHT_PAREN:
-                case LEX_DELIMIT_LEFT_BRACKET:
-                case LEX_DELIMIT_RIGHT_BRACKET:
-                case LEX_DELIMIT_SLASH:
-                case LEX_DELIMIT_SEMICOLON:
-                    goto leave_as_is;
-
-                case LEX_DELIMIT_SPACE: // includes control characters
-                case LEX_DELIMIT_END: // 00 null terminator
-                case LEX_DELIMIT_LINEFEED:
-                case LEX_DELIMIT_RETURN: // e.g. ^M
-                case LEX_DELIMIT_LEFT_BRACE:
-                case LEX_DELIMIT_RIGHT_BRACE:
-                case LEX_DELIMIT_DOUBLE_QUOTE:
-                    goto needs_encoding;
-
-                case LEX_DELIMIT_UTF8_ERROR: // not for c < 0x80
-                default:
-                    panic ("Internal LEX_DELIMIT table error");
-                }
-                goto leave_as_is;
-
-            case LEX_CLASS_SPECIAL:
-                switch (GET_LEX_VALUE(c)) {
-                case LEX_SPECIAL_AT:
-                case LEX_SPECIAL_COLON:
-                case LEX_SPECIAL_APOSTROPHE:
-                case LEX_SPECIAL_PLUS:
-                case LEX_SPECIAL_MINUS:
-                case LEX_SPECIAL_BLANK:
-                case LEX_SPECIAL_PERIOD:
-                case LEX_SPECIAL_COMMA:
-                case LEX_SPECIAL_POUND:
-                case LEX_SPECIAL_DOLLAR:
-                    goto leave_as_is;
-
-                default:
-                    goto needs_encoding; // what is LEX_SPECIAL_WORD?
-                }
-                goto leave_as_is;
-
-            case LEX_CLASS_WORD:
-                if (
-                    (c >= 'a' and c <= 'z') or (c >= 'A' and c <= 'Z')
-                    or c == '?' or c == '!' or c == '&'
-                    or c == '*' or c == '=' or c == '~'
-                ){
-                    goto leave_as_is; // this is all that's leftover
-                }
-                goto needs_encoding;
-
-            case LEX_CLASS_NUMBER:
-                goto leave_as_is; // 0-9 needs no encoding.
-            }
-
-        leave_as_is:;
-          #if !defined(NDEBUG)
-            assert(strchr(no_encode, c) != NULL);
-          #endif
-            Append_Codepoint(mo->series, c);
-            continue;
-        }
-
-    needs_encoding:;
-      #if !defined(NDEBUG)
-        if (c < 0x80)
-           assert(strchr(no_encode, c) == NULL);
-      #endif
-
-        REBLEN n;
-        for (n = 0; n != encoded_size; ++n) {
-            Append_Codepoint(mo->series, '%');
-
-            // Use uppercase hex digits, per RFC 3896 2.1, which is also
-            // consistent with JavaScript's encodeURIComponent()
-            //
-            // https://tools.ietf.org/html/rfc3986#section-2.1
-            //
-            Append_Codepoint(mo->series, Hex_Digits[(encoded[n] & 0xf0) >> 4]);
-            Append_Codepoint(mo->series, Hex_Digits[encoded[n] & 0xf]);
-        }
+        *dp++ = '%';
+        *dp++ = Hex_Digits[(*cp & 0xf0) >> 4];
+        *dp++ = Hex_Digits[*cp & 0xf];
+        ++cp;
     }
 
+    TERM_STR_LEN_SIZE(mo->series, old_len + added, old_size + added);
+
     Init_Any_String(D_OUT, VAL_TYPE(ARG(string)), Pop_Molded_String(mo));
     return D_OUT;
 }
@@ -445,6 +527,13 @@ REBNATIVE(dehex)
     DECLARE_MOLD (mo);
     Push_Mold(mo);
 
+    // Everything between %XX sequences is copied as-is, in bulk.  Only the
+    // bytes are looked at to find the '%' (see notes on Find_Cr_Or_Lf()).
+    //
+    REBSIZ size = VAL_SIZE_AT(ARG(string));
+    const REBYTE *cp = cast(const REBYTE*, VAL_STRING_AT(ARG(string)));
+    const REBYTE *tail = cp + size;
+
     // RFC 3986 says the encoding/decoding must use UTF-8.  This temporary
     // buffer is used to hold up to 4 bytes (and a terminator) that need
     // UTF-8 decoding--the maximum one UTF-8 encoded codepoint may have.
@@ -452,36 +541,27 @@ REBNATIVE(dehex)
     REBYTE scan[5];
     REBSIZ scan_size = 0;
 
-    REBLEN len = VAL_LEN_AT(ARG(string));
-    REBCHR(const*) cp = VAL_STRING_AT(ARG(string));
+    while (cp != tail) {
+        const REBYTE *percent = cast(const REBYTE*,
+            memchr(cp, '%', tail - cp)
+        );
+        if (percent == nullptr)
+            percent = tail;
 
-    REBUNI c;
-    cp = NEXT_CHR(&c, cp);
+        Append_Utf8_Run(mo->series, cp, percent - cp);
+        cp = percent;
 
-    REBLEN i;
-    for (i = 0; i < len;) {
-        if (c != '%')
-            Append_Codepoint(mo->series, c);
-        else {
-            if (i + 2 >= len)
+        while (cp != tail and *cp == '%') {
+            if (tail - cp < 3)
                fail ("Percent decode has less than two codepoints after %");
 
-            cp = NEXT_CHR(&c, cp);
-            ++i;
-            if (c > UINT8_MAX)
-                c = '\0'; // LEX_DELIMIT, will cause error below
-            REBYTE lex1 = Lex_Map[cast(REBYTE, c)];
-
-            cp = NEXT_CHR(&c, cp);
-            ++i;
-            if (c > UINT8_MAX)
-                c = '\0'; // LEX_DELIMIT, will cause error below
-            REBYTE lex2 = Lex_Map[cast(REBYTE, c)];
-
             // If class LEX_WORD or LEX_NUMBER, there is a value contained in
             // the mask which is the value of that "digit".  So A-F and
-            // a-f can quickly get their numeric values.
+            // a-f can quickly get their numeric values.  (Bytes of UTF-8
+            // sequences are LEX_WORD with no value, so they will error.)
             //
+            REBYTE lex1 = Lex_Map[cp[1]];
+            REBYTE lex2 = Lex_Map[cp[2]];
             REBYTE d1 = lex1 & LEX_VALUE;
             REBYTE d2 = lex2 & LEX_VALUE;
 
@@ -492,24 +572,18 @@ REBNATIVE(dehex)
                 fail ("Percent must be followed by 2 hex digits, e.g. %XX");
             }
 
-            // !!! We might optimize here for ASCII codepoints, but would
-            // need to consider it a "flushing point" for the scan buffer,
-            // in order to not gloss over incomplete UTF-8 sequences.
-            //
-            REBYTE b = (d1 << 4) + d2;
-            scan[scan_size++] = b;
-        }
+            scan[scan_size++] = (d1 << 4) + d2;
+            cp += 3;
 
-        cp = NEXT_CHR(&c, cp); // c may be '\0', guaranteed if `i == len`
-        ++i;
+            bool more = (cp != tail and *cp == '%');
 
-        // If our scanning buffer is full (and hence should contain at *least*
-        // one full codepoint) or there are no more UTF-8 bytes coming (due
-        // to end of string or the next input not a %XX pattern), then try
-        // to decode what we've got.
-        //
-        if (scan_size > 0 and (c != '%' or scan_size == 4)) {
-            assert(i != len or c == '\0');
+            // If our scanning buffer is full (and hence should contain at
+            // *least* one full codepoint) or there are no more UTF-8 bytes
+            // coming (due to end of string or the next input not a %XX
+            // pattern), then try to decode what we've got.
+            //
+            if (more and scan_size != 4)
+                continue;
 
           decode_codepoint:
             scan[scan_size] = '\0';
@@ -539,7 +613,7 @@ REBNATIVE(dehex)
             // are coming, this is the last chance to decode those bytes,
             // keep going.
             //
-            if (scan_size != 0 and c != '%')
+            if (scan_size != 0 and not more)
                 goto decode_codepoint;
         }
     }
@@ -566,22 +640,34 @@ REBNATIVE(deline)
 
     // AS TEXT! verifies the UTF-8 validity of a BINARY!, and checks for any
     // embedded '\0' bytes, illegal in texts...without copying the input.
+    // A TEXT! is used directly, so that no API handle is needed.
     //
-    REBVAL *input = rebValue("as text!", ARG(input), rebEND);
+    REBVAL *input;
+    if (IS_TEXT(ARG(input)))
+        input = ARG(input);
+    else
+        input = rebValue("as text!", ARG(input), rebEND);
 
     if (REF(lines)) {
         Init_Block(D_OUT, Split_Lines(input));
-        rebRelease(input);
+        if (input != ARG(input))
+            rebRelease(input);
         return D_OUT;
     }
 
     REBSTR *s = VAL_STRING(input);
     REBLEN len_head = STR_LEN(s);
 
-    REBLEN len_at = VAL_LEN_AT(input);
+    REBYTE *at = cast(REBYTE*, VAL_STRING_AT(input));
+    REBYTE *tail = at + VAL_SIZE_AT(input);
 
-    REBCHR(*) dest = VAL_STRING_AT(input);
-    REBCHR(const*) src = dest;
+    // Only CR bytes get removed, so a string without any is left as it is.
+    // Otherwise the input is compacted in place from the first CR onward,
+    // moving the runs between line breaks with memmove().
+    //
+    const REBYTE *src = cast(const REBYTE*, memchr(at, CR, tail - at));
+    if (src == nullptr)
+        goto done;
 
     // DELINE tolerates either LF or CR LF, in order to avoid disincentivizing
     // remote data in CR LF format from being "fixed" to pure LF format, for
@@ -589,41 +675,40 @@ REBNATIVE(deline)
     // *all* CR LF or *all* LF format.  If they are mixed they are considered
     // to be malformed...and need custom handling.
     //
-    bool seen_a_cr_lf = false;
-    bool seen_a_lone_lf = false;
+    if (memchr(at, LF, src - at) != nullptr)
+        fail (Error_Mixed_Cr_Lf_Found_Raw());  // lone LF before the CR
 
-    REBLEN n;
-    for (n = 0; n < len_at;) {
-        REBUNI c;
-        src = NEXT_CHR(&c, src);
-        ++n;
-        if (c == LF) {
-            if (seen_a_cr_lf)
-                fail (Error_Mixed_Cr_Lf_Found_Raw());
-            seen_a_lone_lf = true;
-        }
+    Free_Bookmarks_Maybe_Null(s);  // offsets past the first CR will move
 
-        if (c == CR) {
-            if (seen_a_lone_lf)
-                fail (Error_Mixed_Cr_Lf_Found_Raw());
+    REBYTE *dest;
+    dest = m_cast(REBYTE*, src);  // goto would cross initialization
 
-            dest = WRITE_CHR(dest, LF);
-            src = NEXT_CHR(&c, src);
-            ++n;  // will see '\0' terminator before loop check, so is safe
-            if (c == LF) {
-                --len_head;  // don't write carraige return, note loss of char
-                seen_a_cr_lf = true;
-                continue;
-            }
+    while (src != tail) {
+        if (*src == LF)  // lone LF, having seen a CR LF
+            fail (Error_Mixed_Cr_Lf_Found_Raw());
+
+        assert(*src == CR);
+        if (src + 1 == tail or src[1] != LF) {
             // DELINE requires any CR to be followed by an LF
-            fail (Error_Illegal_Cr(BACK_STR(src), STR_HEAD(s)));
+            fail (Error_Illegal_Cr(src, STR_HEAD(s)));
         }
-        dest = WRITE_CHR(dest, c);
+
+        *dest++ = LF;
+        src += 2;
+        --len_head;  // don't write carriage return, note loss of char
+
+        const REBYTE *next = Find_Cr_Or_Lf(src, tail);
+        memmove(dest, src, next - src);
+        dest += next - src;
+        src = next;
     }
 
-    TERM_STR_LEN_SIZE(s, len_head, dest - VAL_STRING_AT(input));
+    TERM_STR_LEN_SIZE(s, len_head, dest - STR_HEAD(s));
 
-    return input;
+  done:
+    if (input != ARG(input))
+        return input;
+    RETURN (input);
 }
 
 
@@ -643,43 +728,33 @@ REBNATIVE(enline)
     REBVAL *val = ARG(string);
 
     REBSTR *s = VAL_STRING(val);
-    REBLEN idx = VAL_INDEX(val);
 
-    REBLEN len;
-    REBSIZ size = VAL_SIZE_LIMIT_AT(&len, val, UNKNOWN);
-
-    REBLEN delta = 0;
+    REBSIZ offset = VAL_OFFSET(val);
+    REBSIZ size = VAL_SIZE_AT(val);
 
-    // Calculate the size difference by counting the number of LF's
-    // that have no CR's in front of them.
+    // Calculate the size difference by counting the number of LF's.  Any CR
+    // is an error, so there's no need to check for LFs with CR in front.
     //
-    // !!! The REBCHR(*) interface isn't technically necessary if one is
-    // counting to the end (one could just go by bytes instead of characters)
-    // but this would not work if someone added, say, an ENLINE/PART...since
-    // the byte ending position of interest might not be end of the string.
-
-    REBCHR(*) cp = STR_AT(s, idx);
-
-    bool relax = false;  // !!! in case we wanted to tolerate CR LF already?
-    REBUNI c_prev = '\0';
+    // !!! R3-Alpha tolerated CR LF already in the input.  If that is wanted,
+    // it would need to be skipped here and when adding the CRs below.
+    //
+    const REBYTE *cp = cast(const REBYTE*, VAL_STRING_AT(val));
+    const REBYTE *ep = cp + size;
 
-    REBLEN n;
-    for (n = 0; n < len; ++n) {
-        REBUNI c;
-        cp = NEXT_CHR(&c, cp);
-        if (c == LF and (not relax or c_prev != CR))
-            ++delta;
-        if (c == CR and not relax)  // !!! Note: `relax` fixed at false, ATM
-            fail (Error_Illegal_Cr(BACK_STR(cp), STR_HEAD(s)));
-        c_prev = c;
+    REBLEN delta = 0;
+    while ((cp = Find_Cr_Or_Lf(cp, ep)) != ep) {
+        if (*cp == CR)
+            fail (Error_Illegal_Cr(cp, STR_HEAD(s)));
+        ++delta;
+        ++cp;
     }
 
     if (delta == 0)
         RETURN (ARG(string)); // nothing to do
 
-    REBLEN old_len = MISC(s).length;
+    REBLEN old_len = STR_LEN(s);
+    REBSIZ old_size = STR_SIZE(s);
     EXPAND_SERIES_TAIL(SER(s), delta);  // corrupts MISC(str).length
-    MISC(s).length = old_len + delta;  // just adding CR's
 
     // One feature of using UTF-8 for strings is that CR/LF substitution can
     // stay a byte-oriented process..because UTF-8 doesn't reuse bytes in the
@@ -688,29 +763,29 @@ REBNATIVE(enline)
 
     Free_Bookmarks_Maybe_Null(s);  // !!! Could this be avoided sometimes?
 
-    REBYTE* bp = STR_HEAD(s); // expand may change the pointer
-    REBSIZ tail = STR_SIZE(s); // size in bytes after expansion
+    REBYTE *head = STR_HEAD(s);  // expand may change the pointer
+    REBYTE *at = head + offset;
 
-    // Add missing CRs
+    // Work back from the old tail, moving each run that starts with an LF
+    // over by the number of CRs still to insert in front of it.
 
-    while (delta > 0) {
+    REBYTE *src = head + old_size;
+    REBYTE *dest = src + delta;
 
-        bp[tail--] = bp[size];  // Copy src to dst.
+    REBLEN remaining = delta;
+    while (remaining > 0) {
+        REBYTE *lf = m_cast(REBYTE*, Find_Last_Lf(at, src));
+        assert(lf != nullptr);
 
-        if (
-            bp[size] == LF
-            and (
-                not relax  // !!! Note: `relax` fixed at false, ATM
-                or size == 0
-                or bp[size - 1] != CR
-            )
-        ){
-            bp[tail--] = CR;
-            --delta;
-        }
-        --size;
+        dest -= src - lf;
+        memmove(dest, lf, src - lf);
+        *--dest = CR;
+        --remaining;
+        src = lf;
     }
 
+    TERM_STR_LEN_SIZE(s, old_len + delta, old_size + delta);
+
     RETURN (ARG(string));
 }
 
@@ -1028,6 +1103,10 @@ REBNATIVE(invalid_utf8_q)
 
     REBLEN trail;
     for (; utf8 != end; utf8 += trail) {
+        utf8 = m_cast(REBYTE*, Skip_Ascii_Run(utf8, end));
+        if (utf8 == end)
+            break;
+
         trail = trailingBytesForUTF8[*utf8] + 1;
         if (utf8 + trail > end or not isLegalUTF8(utf8, trail)) {
             Move_Value(D_OUT, arg);
@@ -105,6 +105,18 @@ REBNATIVE(exit_rebol)
 //      /ballast "Trigger for auto-recycle (memory used)"
 //          [integer!]
 //      /torture "Constant recycle (for internal debugging)"
+//      /generational "Make auto-recycles only trace new series (or not)"
+//          [logic!]
+//      /minor "Only recycle series that are new (if /GENERATIONAL is on)"
+//      /incremental "Mark at most N arrays per evaluator step (0 is off)"
+//          [integer!]
+//      /policy "Ballast reset after recycle: FIXED, PROPORTIONAL, or PAUSE"
+//          [word!]
+//      /growth "Percent of live memory allowed before next PROPORTIONAL"
+//          [integer!]
+//      /target "Percent of run time to aim to spend in GC, for PAUSE"
+//          [integer!]
+//      /compact "Also shrink the data of large series to fit their content"
 //      /watch "Monitor recycling (debug only)"
 //      /verbose "Dump information about series being recycled (debug only)"
 //  ]
@@ -133,6 +145,37 @@ REBNATIVE(recycle)
         TG_Ballast = 0;
     }
 
+    if (REF(generational))
+        GC_Generational = VAL_LOGIC(ARG(generational));
+
+    if (REF(policy)) {
+        REBSYM sym = VAL_WORD_SYM(ARG(policy));
+        if (sym != SYM_FIXED and sym != SYM_PROPORTIONAL and sym != SYM_PAUSE)
+            fail (PAR(policy));
+        GC_Policy = sym;
+    }
+
+    if (REF(growth)) {
+        REBINT growth = VAL_INT32(ARG(growth));
+        if (growth <= 0)
+            fail (PAR(growth));
+        GC_Growth = growth;
+    }
+
+    if (REF(target)) {
+        REBINT target = VAL_INT32(ARG(target));
+        if (target <= 0 or target >= 100)
+            fail (PAR(target));
+        GC_Target = target;
+    }
+
+    if (REF(incremental)) {
+        REBINT budget = VAL_INT32(ARG(incremental));
+        if (budget < 0)
+            fail (PAR(incremental));
+        GC_Slice_Budget = budget;
+    }
+
     if (GC_Disabled)
         return nullptr; // don't give misleading "0", since no recycle ran
 
@@ -160,9 +203,13 @@ REBNATIVE(recycle)
       #endif
     }
     else {
+        GC_Minor = did REF(minor);  // ignored by Recycle_Core() if no old
         count = Recycle();
     }
 
+    if (REF(compact))
+        GC_Stats.Compacted_Bytes += Compact_Series_Data();
+
     if (REF(watch)) {
       #if defined(NDEBUG)
         fail (Error_Debug_Only_Raw());
@@ -179,6 +226,54 @@ REBNATIVE(recycle)
 }
 
 
+static const REBVAL *With_Arena_Dangerous(REBFRM *frame_) {
+    INCLUDE_PARAMS_OF_WITH_ARENA;
+
+    if (Do_Branch_Throws(D_OUT, D_SPARE, ARG(body)))
+        return VOID_VALUE;
+
+    return nullptr;
+}
+
+
+//
+//  with-arena: native [
+//
+//  {Evaluate code, then free the series it made that are no longer in use}
+//
+//      return: "Result of the body (any series it refers to are kept)"
+//          [<opt> any-value!]
+//      body [block!]
+//  ]
+//
+REBNATIVE(with_arena)
+//
+// This uses Push_Arena() and Pop_Arena(), see notes on them.  The body is
+// run under rebRescue() so that the arena is popped even on a fail().
+{
+    INCLUDE_PARAMS_OF_WITH_ARENA;
+
+    Push_Arena();
+    REBVAL *error = rebRescue(cast(REBDNG*, &With_Arena_Dangerous), frame_);
+    UNUSED(ARG(body));  // gets used by the above call, via the frame_ pointer
+
+    if (error and IS_VOID(error)) {  // signal used to indicate a throw
+        Pop_Arena(false);  // can't recycle while the throw is in flight
+        return R_THROWN;
+    }
+
+    Pop_Arena(true);  // D_OUT and API handles like `error` are kept
+
+    if (not error)
+        return D_OUT;
+
+    assert(IS_ERROR(error));
+    REBCTX *ctx = VAL_CONTEXT(error);
+    rebRelease(error);
+    fail (ctx);
+}
+
+
 //
 //  limit-usage: native [
 //
@@ -898,6 +898,178 @@ static const REBUNI Char_Cases[] = {
 };
 
 
+//=//// ASCII FAST PATHS //////////////////////////////////////////////////=//
+//
+// The tables above go codepoint by codepoint, after decoding the UTF-8.  But
+// most text is ASCII, where the only letters with case are A-Z and a-z, and
+// changing their case is flipping the 0x20 bit.  So the routines below take
+// a chunk of bytes at a time, and if they are all ASCII do the whole chunk
+// at once.  Callers go back to decoding and the tables for the rest.
+//
+// On x86 a chunk is 16 bytes done with SSE2 (which all x86-64 CPUs have, so
+// this is decided at compile time).  Elsewhere it is 8 bytes done in a 64-bit
+// integer ("SIMD within a register").
+//
+
+#if !defined(REBOL_NO_STRING_SIMD) && (defined(__SSE2__) \
+    || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+
+    #define CASES_SIMD_SSE2
+    #include <emmintrin.h>
+
+    #define ASCII_CHUNK 16
+
+    // Bytes of `v` from `first` to `last` (which must be ASCII), as 0xFF
+    //
+    inline static __m128i Ascii_Range_Mask(__m128i v, char first, char last) {
+        return _mm_and_si128(
+            _mm_cmpgt_epi8(v, _mm_set1_epi8(first - 1)),
+            _mm_cmplt_epi8(v, _mm_set1_epi8(last + 1))
+        );
+    }
+
+    // Lowercase the 'A'..'Z' bytes of a chunk known to be all ASCII
+    //
+    inline static __m128i Lowercase_Ascii_Chunk(__m128i v) {
+        __m128i upper = Ascii_Range_Mask(v, 'A', 'Z');
+        return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+    }
+#else
+    #define ASCII_CHUNK 8
+
+    // Flip the case bit of the bytes from `first` to `first + 25` in a word
+    // known to be all ASCII.  (Adding to an ASCII byte can't carry into the
+    // next one, so the high bit of each sum says if it was in range.)
+    //
+    inline static uint64_t Flip_Ascii_Letters_Word(uint64_t w, REBYTE first) {
+        const uint64_t ones = 0x0101010101010101ULL;
+        uint64_t ge_first = w + ones * (0x80 - first);
+        uint64_t gt_last = w + ones * (0x7F - (first + 25));
+        uint64_t in = (ge_first & ~gt_last) & (ones * 0x80);
+        return w ^ (in >> 2);  // 0x80 >> 2 is 0x20, the case bit
+    }
+
+    inline static uint64_t Lowercase_Ascii_Word(uint64_t w)
+      { return Flip_Ascii_Letters_Word(w, 'A'); }
+#endif
+
+#define ASCII_HIGH_BITS 0x8080808080808080ULL
+
+
+//
+//  Change_Ascii_Case: C
+//
+// Change the case of the bytes at `bp` up to `size` of them, stopping at the
+// first byte that isn't ASCII.  Returns how many bytes it went through.
+//
+REBSIZ Change_Ascii_Case(REBYTE *bp, REBSIZ size, bool upper)
+{
+    REBYTE *start = bp;
+    REBYTE *ep = bp + size;
+
+  #if defined(CASES_SIMD_SSE2)
+    for (; ep - bp >= ASCII_CHUNK; bp += ASCII_CHUNK) {
+        __m128i v = _mm_loadu_si128(cast(__m128i*, bp));
+        if (_mm_movemask_epi8(v) != 0)
+            break;  // has a non-ASCII byte, finish up a byte at a time
+
+        __m128i letters = upper
+            ? Ascii_Range_Mask(v, 'a', 'z')
+            : Ascii_Range_Mask(v, 'A', 'Z');
+        v = _mm_xor_si128(v, _mm_and_si128(letters, _mm_set1_epi8(0x20)));
+        _mm_storeu_si128(cast(__m128i*, bp), v);
+    }
+  #else
+    for (; ep - bp >= ASCII_CHUNK; bp += ASCII_CHUNK) {
+        uint64_t w;
+        memcpy(&w, bp, sizeof(w));  // (compiles to an unaligned load)
+        if (w & ASCII_HIGH_BITS)
+            break;  // has a non-ASCII byte, finish up a byte at a time
+
+        w = Flip_Ascii_Letters_Word(w, upper ? 'a' : 'A');
+        memcpy(bp, &w, sizeof(w));
+    }
+  #endif
+
+    for (; bp != ep and *bp < 0x80; ++bp)
+        *bp = cast(REBYTE, upper ? UP_CASE(*bp) : LO_CASE(*bp));
+
+    return bp - start;
+}
+
+
+//
+//  Match_Ascii_Run: C
+//
+// How many bytes at `a` and `b` (up to `size` of them) are ASCII and the
+// same, or the same after case folding if `uncase`.  This goes a chunk at a
+// time and stops at the first chunk that isn't, so it may say less than the
+// real length of the match: callers go on a codepoint at a time from there.
+//
+// If `case_diff` isn't nullptr, it is set to where the first byte in the run
+// that differs only by case is, or to the returned size if there isn't one.
+//
+REBSIZ Match_Ascii_Run(
+    REBSIZ *case_diff,
+    const REBYTE *a,
+    const REBYTE *b,
+    REBSIZ size,
+    bool uncase
+){
+    REBSIZ n = 0;
+    bool case_differs = false;
+
+    for (; size - n >= ASCII_CHUNK; n += ASCII_CHUNK) {
+      #if defined(CASES_SIMD_SSE2)
+        __m128i va = _mm_loadu_si128(cast(const __m128i*, a + n));
+        __m128i vb = _mm_loadu_si128(cast(const __m128i*, b + n));
+        if (_mm_movemask_epi8(_mm_or_si128(va, vb)) != 0)
+            break;  // non-ASCII, LO_CASE() could fold it to ASCII
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) == 0xFFFF)
+            continue;
+
+        if (not uncase)
+            break;
+
+        __m128i fa = Lowercase_Ascii_Chunk(va);
+        __m128i fb = Lowercase_Ascii_Chunk(vb);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(fa, fb)) != 0xFFFF)
+            break;
+      #else
+        uint64_t wa;
+        uint64_t wb;
+        memcpy(&wa, a + n, sizeof(wa));
+        memcpy(&wb, b + n, sizeof(wb));
+        if ((wa | wb) & ASCII_HIGH_BITS)
+            break;  // non-ASCII, LO_CASE() could fold it to ASCII
+
+        if (wa == wb)
+            continue;
+
+        if (not uncase)
+            break;
+
+        if (Lowercase_Ascii_Word(wa) != Lowercase_Ascii_Word(wb))
+            break;
+      #endif
+
+        if (case_diff and not case_differs) {
+            case_differs = true;
+            REBSIZ i = n;
+            while (a[i] == b[i])
+                ++i;
+            *case_diff = i;
+        }
+    }
+
+    if (case_diff and not case_differs)
+        *case_diff = n;
+
+    return n;
+}
+
+
 //
 //  Init_Char_Cases: C
 //
@@ -42,7 +42,7 @@ const z_crc_t *crc32_table; // pointer to the zlib CRC32 table
 #define PRZCRC   0x864cfb   /* PRZ's 24-bit CRC generator polynomial */
 #define CRCINIT  0xB704CE   /* Init value for CRC accumulator */
 
-static REBLEN *crc24_table;
+static REB_INSTANCE_VAR REBLEN *crc24_table;  // made by each Startup
 
 //
 //  Generate_CRC24: C
@@ -136,41 +136,197 @@ REBINT Compute_CRC24(const REBYTE *str, REBLEN len)
 }
 
 
+//=//// HASHING ////////////////////////////////////////////////////////////=//
+//
+// Hashes for MAP! keys, set operations and word interning are made with a
+// multiply-and-fold mixer in the style of wyhash, consuming 8 bytes at a
+// time.  This is much faster than a CRC over each byte, and mixes into all
+// 64 bits instead of 24 (which caused clustering in large tables).  Callers
+// still get 32 bits, as that's what the hashlists hold.
+//
+// Caseless hashes are taken over the UTF-8 encoding of the *lowercased*
+// codepoints, so that any two strings which compare equal lax-ly hash the
+// same (even if LO_CASE() changes how many bytes a codepoint takes).  Runs
+// of ASCII are lowercased a word at a time.
+//
+
+#define HASH_SECRET_0 0xa0761d6478bd642fULL
+#define HASH_SECRET_1 0xe7037ed1a0b428dbULL
+#define HASH_SECRET_2 0x8ebc6af09c88c6e3ULL
+
+struct Reb_Hasher {
+    uint64_t state;
+    uint64_t pending;  // bytes not yet mixed in, least significant first
+    REBLEN pending_bits;
+    uint64_t total;  // count of bytes fed
+};
+
+// 64x64 => 128 bit multiply, folding the high and low halves together
+//
+inline static uint64_t Hash_Mum(uint64_t a, uint64_t b) {
+  #if defined(__SIZEOF_INT128__)
+    __uint128_t r = cast(__uint128_t, a) * b;
+    return cast(uint64_t, r) ^ cast(uint64_t, r >> 64);
+  #else
+    uint64_t ha = a >> 32;
+    uint64_t la = cast(uint32_t, a);
+    uint64_t hb = b >> 32;
+    uint64_t lb = cast(uint32_t, b);
+    uint64_t rh = ha * hb;
+    uint64_t rm0 = ha * lb;
+    uint64_t rm1 = hb * la;
+    uint64_t rl = la * lb;
+    uint64_t t = rl + (rm0 << 32);
+    uint64_t carry = (t < rl) ? 1 : 0;
+    uint64_t lo = t + (rm1 << 32);
+    carry += (lo < t) ? 1 : 0;
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+    return hi ^ lo;
+  #endif
+}
+
+inline static void Init_Hasher(struct Reb_Hasher *h) {
+    h->state = HASH_SECRET_0;
+    h->pending = 0;
+    h->pending_bits = 0;
+    h->total = 0;
+}
+
+inline static void Hash_Mix_Word(struct Reb_Hasher *h, uint64_t w) {
+    h->state = Hash_Mum(w ^ HASH_SECRET_1, h->state ^ HASH_SECRET_2);
+}
+
+inline static void Hash_Feed_Word(struct Reb_Hasher *h, uint64_t w) {
+    h->total += 8;
+    if (h->pending_bits == 0) {
+        Hash_Mix_Word(h, w);
+        return;
+    }
+    Hash_Mix_Word(h, h->pending | (w << h->pending_bits));
+    h->pending = w >> (64 - h->pending_bits);
+}
+
+inline static void Hash_Feed_Byte(struct Reb_Hasher *h, REBYTE b) {
+    h->total += 1;
+    h->pending |= cast(uint64_t, b) << h->pending_bits;
+    h->pending_bits += 8;
+    if (h->pending_bits == 64) {
+        Hash_Mix_Word(h, h->pending);
+        h->pending = 0;
+        h->pending_bits = 0;
+    }
+}
+
+inline static uint32_t Finish_Hasher(struct Reb_Hasher *h) {
+    uint64_t x = Hash_Mum(
+        h->state ^ h->pending ^ HASH_SECRET_1,
+        h->total ^ HASH_SECRET_0
+    );
+    return cast(uint32_t, x ^ (x >> 32));
+}
+
+inline static uint64_t Read_Word_Unaligned(const REBYTE *bp) {
+    uint64_t w;
+    memcpy(&w, bp, sizeof(uint64_t));
+  #if defined(ENDIAN_BIG)
+    w = (  // bytes must be fed in the same order on all platforms
+        ((w & 0x00000000000000FFULL) << 56)
+        | ((w & 0x000000000000FF00ULL) << 40)
+        | ((w & 0x0000000000FF0000ULL) << 24)
+        | ((w & 0x00000000FF000000ULL) << 8)
+        | ((w & 0x000000FF00000000ULL) >> 8)
+        | ((w & 0x0000FF0000000000ULL) >> 24)
+        | ((w & 0x00FF000000000000ULL) >> 40)
+        | ((w & 0xFF00000000000000ULL) >> 56)
+    );
+  #endif
+    return w;
+}
+
+// Lowercase the 'A'..'Z' bytes in a word known to be all ASCII
 //
-//  Hash_UTF8: C
-//
-// Return a case insensitive hash value for the string.
+inline static uint64_t Lowercase_Ascii_Word(uint64_t w) {
+    const uint64_t ones = 0x0101010101010101ULL;
+    uint64_t ge_a = w + ones * (0x80 - 'A');  // high bit set if >= 'A'
+    uint64_t gt_z = w + ones * (0x7F - 'Z');  // high bit set if > 'Z'
+    uint64_t upper = (ge_a & ~gt_z) & (ones * 0x80);
+    return w | (upper >> 2);  // 0x80 >> 2 is 0x20, the case bit
+}
+
+// Shared by Hash_UTF8() (which knows the size) and Hash_UTF8_Caseless()
+// (which knows the length), so they give the same hashes for the same data.
+// Stops when either one runs out, so pass UNKNOWN for the other.
 //
-REBINT Hash_UTF8(const REBYTE *utf8, REBSIZ size)
+static uint32_t Hash_UTF8_Core(const REBYTE *utf8, REBSIZ size, REBLEN len)
 {
-    REBINT hash =
-        cast(REBINT, size) + cast(REBINT, cast(REBYTE, LO_CASE(*utf8)));
-
-    for (; size != 0; ++utf8, --size) {
-        REBUNI n = *utf8;
-
-        if (n >= 0x80) {
-            utf8 = Back_Scan_UTF8_Char(&n, utf8, &size);
-            assert(utf8 != NULL); // should have already been verified good
+    struct Reb_Hasher h;
+    Init_Hasher(&h);
+
+    while (size != 0 and len != 0) {
+        if (size >= 8 and len >= 8) {
+            uint64_t w = Read_Word_Unaligned(utf8);
+            if ((w & 0x8080808080808080ULL) == 0) {  // 8 ASCII codepoints
+                Hash_Feed_Word(&h, Lowercase_Ascii_Word(w));
+                utf8 += 8;
+                size -= 8;
+                len -= 8;
+                continue;
+            }
         }
 
-        // Optimize `n = cast(REBYTE, LO_CASE(n))` (drop upper 8 bits)
-        // !!! Is this actually faster?
-        //
-        n = cast(REBYTE, LO_CASE(n));
+        REBUNI c = *utf8;
+        if (c < 0x80) {
+            Hash_Feed_Byte(&h, cast(REBYTE, LO_CASE(c)));
+            ++utf8;
+            --size;
+            --len;
+            continue;
+        }
 
-        n = cast(REBYTE, (hash >> CRCSHIFTS) ^ n);
+        REBSIZ left = size;
+        const REBYTE *last = Back_Scan_UTF8_Char(&c, utf8, &left);
+        assert(last != nullptr);  // should have already been verified good
+        size -= (last - utf8) + 1;
+        utf8 = last + 1;
+        --len;
 
-        // Left shift math must use unsigned to avoid undefined behavior
-        // http://stackoverflow.com/q/3784996/211160
-        //
-        hash = cast(REBINT, MASK_CRC(cast(REBLEN, hash) << 8) ^ crc24_table[n]);
+        c = LO_CASE(c);
+        REBYTE encoded[4];
+        REBLEN encoded_size = Encoded_Size_For_Codepoint(c);
+        Encode_UTF8_Char(encoded, c, encoded_size);
+        REBLEN i;
+        for (i = 0; i < encoded_size; ++i)
+            Hash_Feed_Byte(&h, encoded[i]);
     }
 
-    return hash;
+    return Finish_Hasher(&h);
 }
 
 
+//
+//  Hash_UTF8: C
+//
+// Return a case insensitive hash value for the string.  UTF-8 size is in
+// bytes, see also Hash_UTF8_Caseless() for when the length is known.
+//
+REBINT Hash_UTF8(const REBYTE *utf8, REBSIZ size)
+{
+    return cast(REBINT, Hash_UTF8_Core(utf8, size, UNKNOWN));
+}
+
+
+//
+//  Hash_Integer: C
+//
+// Mixes all 64 bits, as sequential integers would otherwise land in
+// sequential slots (and the high bits would be lost entirely).
+//
+uint32_t Hash_Integer(REBI64 i)
+{
+    uint64_t x = Hash_Mum(cast(uint64_t, i) ^ HASH_SECRET_1, HASH_SECRET_2);
+    return cast(uint32_t, x ^ (x >> 32));
+}
+
 
 //
 //  Hash_Value: C
@@ -203,15 +359,18 @@ uint32_t Hash_Value(const RELVAL *v)
         //
         // R3-Alpha XOR'd with (VAL_INT64(val) >> 32).  But: "XOR with high
         // bits collapses -1 with 0 etc.  (If your key k is |k| < 2^32 high
-        // bits are 0-informative." -Giulio
+        // bits are 0-informative." -Giulio  So all the bits are mixed.
         //
-        hash = cast(uint32_t, VAL_INT64(cell));
+        if (IS_INTEGER_BIG(cell))
+            hash = Hash_Big_Integer(cell);
+        else
+            hash = Hash_Integer(VAL_INT64(cell));
         break;
 
       case REB_DECIMAL:
       case REB_PERCENT:
         // depends on INT64 sharing the DEC64 bits
-        hash = (VAL_INT64(cell) >> 32) ^ (VAL_INT64(cell));
+        hash = Hash_Integer(VAL_INT64(cell));
         break;
 
       case REB_MONEY: {
@@ -229,10 +388,11 @@ uint32_t Hash_Value(const RELVAL *v)
         hash = LO_CASE(VAL_CHAR(cell));
         break;
 
-      case REB_PAIR:
-        hash = Hash_Value(VAL_PAIR_X(cell));
-        hash ^= Hash_Value(VAL_PAIR_Y(cell));
-        break;
+      case REB_PAIR: {
+        DECLARE_LOCAL (temp);
+        hash = Hash_Value(Get_Pair_X(temp, cell));
+        hash ^= Hash_Value(Get_Pair_Y(temp, cell));
+        break; }
 
       case REB_TUPLE:
         hash = Hash_Bytes(VAL_TUPLE(cell), VAL_TUPLE_LEN(cell));
@@ -327,7 +487,12 @@ uint32_t Hash_Value(const RELVAL *v)
         // !!! Should this hash be cached on the words somehow, e.g. in the
         // data payload before the actual string?
         //
+        // All the word kinds hash alike, because FIND of a word in a block
+        // matches any kind of word with the same spelling (see the hash
+        // index used by Find_In_Array()).
+        //
         hash = Hash_String(VAL_WORD_SPELLING(cell));
+        kind = REB_WORD;
         break; }
 
       case REB_ACTION:
@@ -395,10 +560,22 @@ uint32_t Hash_Value(const RELVAL *v)
 //
 //  Make_Hash_Sequence: C
 //
+// The table is a power of 2 in size, at least twice the number of keys (see
+// %sys-map.h for how the slots are probed).
+//
 REBSER *Make_Hash_Sequence(REBLEN len)
 {
-    REBLEN n = Get_Hash_Prime_May_Fail(len * 2);  // best when 2X # of keys
-    REBSER *ser = Make_Series(n + 1, sizeof(REBLEN));
+    if (len > MAX_HASH_SLOTS / 2) {
+        DECLARE_LOCAL (temp);
+        Init_Integer(temp, len);
+        fail (Error_Size_Limit_Raw(temp));
+    }
+
+    REBLEN n = 8;
+    while (n < len * 2)
+        n *= 2;
+
+    REBSER *ser = Make_Series(n + 1, sizeof(struct Reb_Hash_Slot));
     Clear_Series(ser);
     SET_SERIES_LEN(ser, n);
 
@@ -440,13 +617,13 @@ REBSER *Hash_Block(const REBVAL *block, REBLEN skip, bool cased)
 {
     REBLEN n;
     REBSER *hashlist;
-    REBLEN *hashes;
+    struct Reb_Hash_Slot *hashes;
     REBARR *array = VAL_ARRAY(block);
     RELVAL *value;
 
     // Create the hash array (integer indexes):
     hashlist = Make_Hash_Sequence(VAL_LEN_AT(block));
-    hashes = SER_HEAD(REBLEN, hashlist);
+    hashes = SER_HEAD(struct Reb_Hash_Slot, hashlist);
 
     value = VAL_ARRAY_AT(block);
     if (IS_END(value))
@@ -456,10 +633,10 @@ REBSER *Hash_Block(const REBVAL *block, REBLEN skip, bool cased)
     while (true) {
         REBLEN skip_index = skip;
 
-        REBLEN hash = Find_Key_Hashed(
-            array, hashlist, value, VAL_SPECIFIER(block), 1, cased, 0
+        REBINT slot = Find_Key_Hashed(
+            array, hashlist, value, VAL_SPECIFIER(block), skip, cased, 0
         );
-        hashes[hash] = (n / skip) + 1;
+        hashes[slot].index = (n / skip) + 1;
 
         while (skip_index != 0) {
             value++;
@@ -528,13 +705,15 @@ REBINT Compute_IPC(REBYTE *data, REBLEN length)
 // Return a 32-bit hash value for the bytes.
 //
 REBINT Hash_Bytes(const REBYTE *data, REBLEN len) {
-    uint32_t crc = 0x00000000;
+    struct Reb_Hasher h;
+    Init_Hasher(&h);
 
-    REBLEN n;
-    for (n = 0; n != len; ++n)
-        crc = (crc >> 8) ^ crc32_table[(crc ^ data[n]) & 0xff];
+    for (; len >= 8; data += 8, len -= 8)
+        Hash_Feed_Word(&h, Read_Word_Unaligned(data));
+    for (; len != 0; ++data, --len)
+        Hash_Feed_Byte(&h, *data);
 
-    return cast(REBINT, ~crc);
+    return cast(REBINT, Finish_Hasher(&h));
 }
 
 
@@ -542,37 +721,15 @@ REBINT Hash_Bytes(const REBYTE *data, REBLEN len) {
 //  Hash_UTF8_Caseless: C
 //
 // Return a 32-bit case insensitive hash value for UTF-8 data.  Length is in
-// characters, not bytes.
-//
-// !!! See redundant code in Hash_UTF8 which takes a size, not a length
+// characters, not bytes.  Gives the same result as Hash_UTF8() would with
+// the size of those characters.
 //
 REBINT Hash_UTF8_Caseless(const REBYTE *utf8, REBLEN len) {
     //
     // Note: can't make the argument a REBCHR() because the C++ build and C
     // build can't have different ABIs for %sys-core.h
     //
-    REBCHR(const*) cp = cast(REBCHR(const*), utf8);
-
-    uint32_t crc = 0x00000000;
-
-    REBLEN n;
-    for (n = 0; n < len; n++) {
-        REBUNI c;
-        cp = NEXT_CHR(&c, cp);
-
-        c = LO_CASE(c);
-
-        // !!! This takes into account all 4 bytes of the lowercase codepoint
-        // for the CRC calculation.  In ASCII strings this will involve a lot
-        // of zeros.  Review if there's a better way.
-        //
-        crc = (crc >> 8) ^ crc32_table[(crc ^ c) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 8)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 16)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 24)) & 0xff];
-    }
-
-    return cast(REBINT, ~crc);
+    return cast(REBINT, Hash_UTF8_Core(utf8, UNKNOWN, len));
 }
 
 
@@ -118,7 +118,23 @@ REBINT Compare_Uni_Str(
     REBCHR(const*) u1 = cast(REBCHR(const*), bp1);
     REBCHR(const*) u2 = cast(REBCHR(const*), bp2);
 
+    REBLEN retry = len;  // try an ASCII run when `len` drops to this
+
     for (; len > 0; len--) {
+        if (len == retry and len >= ASCII_RUN_MIN) {
+            const REBYTE *b1 = u1;
+            const REBYTE *b2 = u2;
+            if (*b1 < 0x80 and *b2 < 0x80) {  // (bytes are codepoints)
+                REBSIZ n = Match_Ascii_Run(nullptr, b1, b2, len, uncase);
+                u1 = cast(REBCHR(const*), b1 + n);
+                u2 = cast(REBCHR(const*), b2 + n);
+                len -= n;
+                if (len == 0)
+                    break;
+            }
+            retry = len > ASCII_RUN_MIN ? len - ASCII_RUN_MIN : 0;
+        }
+
         REBUNI c1;
         REBUNI c2;
 
@@ -196,7 +212,28 @@ REBINT Compare_UTF8(const REBYTE *s1, const REBYTE *s2, REBSIZ l2)
     REBSIZ l1 = LEN_BYTES(s1);
     REBINT result = 0;
 
+    const REBYTE *retry = s1;  // try an ASCII run when `s1` gets here
+
     for (; l1 > 0 && l2 > 0; s1++, s2++, l1--, l2--) {
+        if (s1 >= retry) {  // (multibyte codepoints may step over it)
+            if (
+                l1 >= ASCII_RUN_MIN and l2 >= ASCII_RUN_MIN
+                and *s1 < 0x80 and *s2 < 0x80
+            ){
+                REBSIZ diff;
+                REBSIZ n = Match_Ascii_Run(&diff, s1, s2, MIN(l1, l2), true);
+                if (result == 0 and diff < n)
+                    result = (s1[diff] > s2[diff]) ? 3 : 1;
+                s1 += n;
+                s2 += n;
+                l1 -= n;
+                l2 -= n;
+                if (l1 == 0 or l2 == 0)
+                    break;
+            }
+            retry = s1 + ASCII_RUN_MIN;
+        }
+
         c1 = *s1;
         c2 = *s2;
         if (c1 > 127) {
@@ -223,6 +260,203 @@ REBINT Compare_UTF8(const REBYTE *s1, const REBYTE *s2, REBSIZ l2)
 }
 
 
+//
+//  Find_Bytes: C
+//
+// Find `size2` bytes at `bp2` within the `size1` bytes at `bp1`, returning a
+// pointer to the first match or nullptr.  If `uncase` then bytes are folded
+// with LO_CASE() before comparison, which only makes sense for ASCII data.
+//
+// Long patterns are searched for with the "Two-Way" algorithm of Crochemore
+// and Perrin, which needs no allocations and is linear in the worst case:
+//
+// http://www-igm.univ-mlv.fr/~mac/Articles-PDF/CP-1991-jacm.pdf
+//
+// It is combined with a Horspool-style shift on the byte under the end of
+// the pattern, so the usual case of a mismatch skips ahead by up to the
+// whole pattern length.  (The structure follows musl's memmem(), which has
+// a good explanation of the moving parts.)  Short patterns aren't worth the
+// setup, and for them memchr() is used to find candidate first bytes.
+//
+const REBYTE *Find_Bytes(
+    const REBYTE *bp1,
+    REBSIZ size1,
+    const REBYTE *bp2,
+    REBSIZ size2,
+    bool uncase
+){
+    #define FOLD(b) \
+        (uncase ? cast(REBYTE, LO_CASE(b)) : (b))
+
+    if (size2 == 0)
+        return bp1;
+    if (size2 > size1)
+        return nullptr;
+
+    const REBYTE *end1 = bp1 + size1;
+
+    if (not uncase) {  // any match must start with the first pattern byte
+        bp1 = cast(const REBYTE*, memchr(bp1, *bp2, size1 - (size2 - 1)));
+        if (not bp1 or size2 == 1)
+            return bp1;
+    }
+
+    if (size2 < 4) {  // naive search, tables aren't worth it
+        REBYTE b2 = FOLD(*bp2);
+        const REBYTE *last1 = end1 - size2;
+        for (; bp1 <= last1; ++bp1) {
+            if (FOLD(*bp1) != b2)
+                continue;
+            REBSIZ n;
+            for (n = 1; n < size2; ++n)
+                if (FOLD(bp1[n]) != FOLD(bp2[n]))
+                    break;
+            if (n == size2)
+                return bp1;
+        }
+        return nullptr;
+    }
+
+    // Shift table: how far the pattern must move to line up the last
+    // occurrence of a byte with a position under the end of the pattern.
+    // Bytes not in the pattern (shift of 0) let it move past entirely.
+    //
+    REBSIZ shift[256];
+    memset(shift, 0, sizeof(shift));
+
+    REBSIZ i;
+    for (i = 0; i < size2; ++i)
+        shift[FOLD(bp2[i])] = i + 1;
+
+    // Critical factorization, via the maximal suffix of the pattern under
+    // both orderings of bytes.  `ms` is the position just before the split,
+    // and `period` the period of the right half.  (`ip` starts as -1 and
+    // relies on unsigned wraparound, as in the reference implementation.)
+    //
+    REBSIZ ms;
+    REBSIZ period;
+    REBSIZ saved_period;
+
+    REBSIZ ip = cast(REBSIZ, -1);
+    REBSIZ jp = 0;
+    REBSIZ k = 1;
+    REBSIZ p = 1;
+    while (jp + k < size2) {
+        REBYTE a = FOLD(bp2[ip + k]);
+        REBYTE b = FOLD(bp2[jp + k]);
+        if (a == b) {
+            if (k == p) {
+                jp += p;
+                k = 1;
+            }
+            else
+                ++k;
+        }
+        else if (a > b) {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        }
+        else {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+    ms = ip;
+    saved_period = p;
+
+    ip = cast(REBSIZ, -1);
+    jp = 0;
+    k = p = 1;
+    while (jp + k < size2) {
+        REBYTE a = FOLD(bp2[ip + k]);
+        REBYTE b = FOLD(bp2[jp + k]);
+        if (a == b) {
+            if (k == p) {
+                jp += p;
+                k = 1;
+            }
+            else
+                ++k;
+        }
+        else if (a < b) {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        }
+        else {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+    if (ip + 1 > ms + 1)
+        ms = ip;
+    else
+        p = saved_period;
+    period = p;
+
+    // If the pattern is periodic, a partial match of the left half can be
+    // remembered across shifts (`memory`).  Otherwise there's no need, and
+    // a mismatch can move at least as far as the longer half.
+    //
+    bool periodic = true;
+    for (i = 0; i < ms + 1; ++i) {
+        if (FOLD(bp2[i]) != FOLD(bp2[i + period])) {
+            periodic = false;
+            break;
+        }
+    }
+
+    REBSIZ memory_reset;
+    if (periodic)
+        memory_reset = size2 - period;
+    else {
+        memory_reset = 0;
+        period = MAX(ms, size2 - ms - 1) + 1;
+    }
+
+    REBSIZ memory = 0;
+    while (cast(REBSIZ, end1 - bp1) >= size2) {
+        REBSIZ s = shift[FOLD(bp1[size2 - 1])];
+        if (s == 0) {  // byte not in pattern, skip completely past it
+            bp1 += size2;
+            memory = 0;
+            continue;
+        }
+        if (s != size2) {  // byte is in the pattern, but not at its end
+            REBSIZ skip = size2 - s;
+            if (skip < memory)
+                skip = memory;
+            bp1 += skip;
+            memory = 0;
+            continue;
+        }
+
+        for (k = MAX(ms + 1, memory); k < size2; ++k)  // right half
+            if (FOLD(bp2[k]) != FOLD(bp1[k]))
+                break;
+        if (k < size2) {
+            bp1 += k - ms;
+            memory = 0;
+            continue;
+        }
+
+        for (k = ms + 1; k > memory; --k)  // left half
+            if (FOLD(bp2[k - 1]) != FOLD(bp1[k - 1]))
+                break;
+        if (k <= memory)
+            return bp1;
+
+        bp1 += period;
+        memory = memory_reset;
+    }
+
+    return nullptr;
+
+    #undef FOLD
+}
+
+
 //
 //  Find_Bin_In_Bin: C
 //
@@ -245,24 +479,36 @@ REBLEN Find_Bin_In_Bin(
     REBYTE *bp1 = BIN_AT(series, offset);
     REBLEN size1 = BIN_LEN(series) - offset;
 
-    REBYTE *end1 = bp1 + ((flags & AM_FIND_MATCH) ? 1 : size1 - (size2 - 1));
-
-    REBYTE b2 = *bp2; // first byte
+    if (flags & AM_FIND_MATCH) {
+        if (memcmp(bp1, bp2, size2) != 0)
+            return NOT_FOUND;
+        return offset;
+    }
 
-    while (bp1 != end1) {
-        if (*bp1 == b2) { // matched first byte
-            REBLEN n;
-            for (n = 1; n < size2; n++) {
-                if (bp1[n] != bp2[n])
-                    break;
-            }
-            if (n == size2)
-                return bp1 - BIN_HEAD(series);
+    // Search a window at a time, so that a search of a huge binary can be
+    // halted.  Windows overlap by the pattern size less one, so each tests
+    // a window's worth of starting positions.
+    //
+    const REBSIZ window = POLL_CHUNK * 16;
+    const REBYTE *found;
+    while (true) {
+        if (size1 <= window + size2) {
+            found = Find_Bytes(bp1, size1, bp2, size2, false);
+            break;
         }
-        ++bp1;
+        found = Find_Bytes(bp1, window + size2 - 1, bp2, size2, false);
+        if (found)
+            break;
+        bp1 += window;
+        size1 -= window;
+
+        if (Poll_Signals(SIGS_POLL_ANYWHERE))
+            return NOT_FOUND;  // halting, see Poll_Signals_Core()
     }
 
-    return NOT_FOUND;
+    if (not found)
+        return NOT_FOUND;
+    return found - BIN_HEAD(series);
 }
 
 
@@ -414,6 +660,7 @@ REBLEN Find_Str_In_Str(
     else
         NEXT_CHR(&c1, cp1);
 
+    REBLEN poll = POLL_CHUNK;
     while (skip < 0 ? index >= start : index < end) {
         if (c1 == c2_canon or (uncase and LO_CASE(c1) == c2_canon)) {
             REBCHR(const*) tp1 = cp1;
@@ -440,6 +687,12 @@ REBLEN Find_Str_In_Str(
         if (flags & AM_FIND_MATCH)
             break;
 
+        if (--poll == 0) {
+            poll = POLL_CHUNK;
+            if (Poll_Signals(SIGS_POLL_ANYWHERE))
+                return NOT_FOUND;  // halting, see Poll_Signals_Core()
+        }
+
         cp1 = SKIP_CHR(&c1, cp1, skip);
         index += skip;
     }
@@ -448,6 +701,172 @@ REBLEN Find_Str_In_Str(
 }
 
 
+//=//// BYTE SET SCANNING /////////////////////////////////////////////////=//
+//
+// Searching for a character or a bitset in a long string one codepoint at a
+// time decodes every codepoint and tests it.  But most of the bytes can be
+// ruled out without decoding: when looking for a `,` in ASCII data, only the
+// bytes that are `,` need any attention.  So the searches below build a set
+// of the bytes which *might* start a match, skip to the next one (16 bytes
+// at a time with SSE2 if the set is small--as delimiters usually are), and
+// then apply the real test at that position.
+//
+// If the set includes "high" bytes then every non-ASCII codepoint stops the
+// scan, so it can be decoded and tested (e.g. caseless matching, where LO_CASE()
+// maps some non-ASCII codepoints to ASCII ones).
+//
+
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define BYTE_SET_SSE2
+#endif
+
+#define MAX_FEW_BYTES 4
+
+// Searches on short spans aren't worth building a set for (the bitset
+// table in particular means 128 Check_Bit() calls)
+//
+#define MIN_BYTE_SET_SPAN 64
+
+struct Reb_Byte_Set {
+    bool table[256];  // true for bytes that stop the scan
+    REBYTE few[MAX_FEW_BYTES];  // the ASCII members, if there aren't many
+    REBLEN num_few;  // more than MAX_FEW_BYTES means use the table
+    bool high;  // stop on any byte >= 0x80
+};
+
+static void Init_Byte_Set(struct Reb_Byte_Set *set) {
+    memset(set->table, 0, sizeof(set->table));
+    set->num_few = 0;
+    set->high = false;
+}
+
+static void Add_Byte_To_Set(struct Reb_Byte_Set *set, REBYTE b) {
+    assert(b < 0x80 or not set->high);
+    if (set->table[b])
+        return;
+    set->table[b] = true;
+    if (set->num_few < MAX_FEW_BYTES)
+        set->few[set->num_few] = b;
+    ++set->num_few;
+}
+
+static void Add_High_Bytes_To_Set(struct Reb_Byte_Set *set) {
+    REBLEN b;
+    for (b = 0xC0; b < 256; ++b)  // UTF-8 lead bytes, scans start on one
+        set->table[b] = true;
+    set->high = true;
+}
+
+static const REBYTE *Scan_For_Byte_Set(
+    const REBYTE *bp,
+    const REBYTE *end,
+    const struct Reb_Byte_Set *set
+){
+    if (set->num_few == 0 and not set->high)
+        return end;  // nothing can match (e.g. empty bitset)
+
+  #if defined(BYTE_SET_SSE2)
+    if (set->num_few <= MAX_FEW_BYTES) {
+        REBYTE fill = set->num_few == 0 ? 0x80 : set->few[0];
+        __m128i b0 = _mm_set1_epi8(cast(char, fill));
+        __m128i b1 = set->num_few > 1
+            ? _mm_set1_epi8(cast(char, set->few[1]))
+            : b0;
+        __m128i b2 = set->num_few > 2
+            ? _mm_set1_epi8(cast(char, set->few[2]))
+            : b0;
+        __m128i b3 = set->num_few > 3
+            ? _mm_set1_epi8(cast(char, set->few[3]))
+            : b0;
+        __m128i high = _mm_set1_epi8(cast(char, set->high ? 0x80 : 0x00));
+
+        for (; end - bp >= 16; bp += 16) {
+            __m128i chunk = _mm_loadu_si128(cast(const __m128i*, bp));
+            __m128i hits = _mm_or_si128(
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(chunk, b0),
+                    _mm_cmpeq_epi8(chunk, b1)
+                ),
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(chunk, b2),
+                    _mm_cmpeq_epi8(chunk, b3)
+                )
+            );
+            hits = _mm_or_si128(hits, _mm_and_si128(chunk, high));
+            int mask = _mm_movemask_epi8(hits);
+            if (mask != 0) {
+                while (not (mask & 1)) {
+                    mask >>= 1;
+                    ++bp;
+                }
+                return bp;
+            }
+        }
+    }
+  #endif
+
+    if (set->num_few == 1 and not set->high) {
+        const REBYTE *found = cast(const REBYTE*,
+            memchr(bp, set->few[0], end - bp)
+        );
+        return found ? found : end;
+    }
+
+    for (; bp != end; ++bp)
+        if (set->table[*bp])
+            break;
+    return bp;
+}
+
+
+// Shared forward search for Find_Char_In_Str() and Find_Str_Bitset(), used
+// when the skip is 1 and the span is long enough to be worth it.  If `bset`
+// is nullptr then it is looking for `uni`, otherwise it is testing the bits.
+//
+static REBLEN Find_Str_With_Byte_Set(
+    REBSTR *str,
+    REBLEN index,
+    REBLEN end,
+    const struct Reb_Byte_Set *set,
+    REBUNI uni,
+    REBSER *bset,
+    bool uncase
+){
+    bool ascii = Is_Definitely_Ascii(str);
+    REBUNI canon = uncase ? LO_CASE(uni) : uni;
+
+    const REBYTE *bp = cast(const REBYTE*, STR_AT(str, index));
+    const REBYTE *limit = cast(const REBYTE*, STR_AT(str, end));
+
+    while (true) {
+        const REBYTE *stop = Scan_For_Byte_Set(bp, limit, set);
+        if (ascii)
+            index += stop - bp;
+        else {
+            for (; bp != stop; ++bp)
+                if (not Is_Continuation_Byte_If_Utf8(*bp))
+                    ++index;
+        }
+        if (stop == limit)
+            return NOT_FOUND;
+
+        REBUNI c;
+        bp = cast(const REBYTE*, NEXT_CHR(&c, cast(REBCHR(const*), stop)));
+
+        if (bset) {
+            if (Check_Bit(bset, c, uncase))
+                return index;
+        }
+        else if (c == canon or (uncase and LO_CASE(c) == canon))
+            return index;
+
+        ++index;
+    }
+}
+
+
 //
 //  Find_Char_In_Str: C
 //
@@ -470,6 +889,38 @@ REBLEN Find_Char_In_Str(
 ){
     assert((flags & ~(AM_FIND_CASE | AM_FIND_MATCH)) == 0);
 
+    bool uncase = not (flags & AM_FIND_CASE);
+
+    if (
+        skip == 1
+        and not (flags & AM_FIND_MATCH)
+        and index_orig < highest
+        and highest - index_orig >= MIN_BYTE_SET_SPAN
+    ){
+        struct Reb_Byte_Set set;
+        Init_Byte_Set(&set);
+        if (uncase) {
+            REBUNI canon = LO_CASE(uni);
+            if (canon < 0x80) {  // only ASCII codepoints fold to ASCII
+                Add_Byte_To_Set(&set, cast(REBYTE, canon));
+                Add_Byte_To_Set(&set, cast(REBYTE, UP_CASE(canon)));
+            }
+        }
+        else if (uni < 0x80)
+            Add_Byte_To_Set(&set, cast(REBYTE, uni));
+        else {
+            REBYTE encoded[4];
+            Encode_UTF8_Char(encoded, uni, Encoded_Size_For_Codepoint(uni));
+            Add_Byte_To_Set(&set, encoded[0]);  // verified after the stop
+        }
+        if (uncase and not Is_Definitely_Ascii(s))
+            Add_High_Bytes_To_Set(&set);  // LO_CASE() may map them to `uni`
+
+        return Find_Str_With_Byte_Set(
+            s, index_orig, highest, &set, uni, nullptr, uncase
+        );
+    }
+
     // !!! In UTF-8, finding a char in a string is really just like finding a
     // string in a string.  Optimize as this all folds together.
 
@@ -557,6 +1008,30 @@ REBLEN Find_Bin_Bitset(
 
     assert((flags & ~AM_FIND_MATCH) == 0); // no AM_FIND_CASE
 
+    if (
+        skip == 1
+        and not (flags & AM_FIND_MATCH)
+        and offset < tail
+        and tail - offset >= MIN_BYTE_SET_SPAN
+    ){
+        struct Reb_Byte_Set set;
+        Init_Byte_Set(&set);
+
+        REBLEN b;
+        for (b = 0; b < 256; ++b) {
+            const bool uncase = false;
+            if (Check_Bit(bset, b, uncase))
+                Add_Byte_To_Set(&set, cast(REBYTE, b));
+        }
+
+        const REBYTE *start = BIN_AT(bin, offset);
+        const REBYTE *limit = BIN_AT(bin, tail);
+        const REBYTE *found = Scan_For_Byte_Set(start, limit, &set);
+        if (found == limit)
+            return NOT_FOUND;
+        return offset + (found - start);
+    }
+
     REBYTE *bp1 = BIN_AT(bin, offset);
 
     while (skip < 0 ? offset >= head : offset < tail) {
@@ -607,6 +1082,28 @@ REBLEN Find_Str_Bitset(
 
     bool uncase = not (flags & AM_FIND_CASE); // case insensitive
 
+    if (
+        skip == 1
+        and not (flags & AM_FIND_MATCH)
+        and index < end
+        and end - index >= MIN_BYTE_SET_SPAN
+    ){
+        struct Reb_Byte_Set set;
+        Init_Byte_Set(&set);
+
+        REBLEN b;
+        for (b = 0; b < 0x80; ++b) {
+            if (Check_Bit(bset, b, uncase))
+                Add_Byte_To_Set(&set, cast(REBYTE, b));
+        }
+        if (not Is_Definitely_Ascii(str))
+            Add_High_Bytes_To_Set(&set);  // decode and Check_Bit() those
+
+        return Find_Str_With_Byte_Set(
+            str, index, end, &set, 0, bset, uncase
+        );
+    }
+
     REBCHR(const*) cp1 = STR_AT(str, index);
     REBUNI c1;
     if (skip > 0)
@@ -290,6 +290,17 @@ REBSTR *Append_UTF8_May_Fail(
 
     REBSIZ bytes_left = size; // see remarks on Back_Scan_UTF8_Char's 3rd arg
     for (; bytes_left > 0; --bytes_left, ++bp) {
+        const REBYTE *run_end = Skip_Plain_Ascii_Run(bp, bp + bytes_left);
+        if (run_end != bp) {  // copy runs needing no checks all at once
+            REBLEN run = run_end - bp;
+            Append_Ascii_Len(mo->series, cs_cast(bp), run);
+            num_codepoints += run;
+            bytes_left -= run;
+            bp = run_end;
+            if (bytes_left == 0)
+                break;
+        }
+
         REBUNI c = *bp;
         if (c >= 0x80) {
             bp = Back_Scan_UTF8_Char(&c, bp, &bytes_left);
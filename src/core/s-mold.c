@@ -93,7 +93,7 @@
 //
 REBYTE *Prep_Mold_Overestimated(REB_MOLD *mo, REBLEN num_bytes)
 {
-    REBLEN tail = STR_LEN(mo->series);
+    REBSIZ tail = STR_SIZE(mo->series);  // a byte offset, not a length
     EXPAND_SERIES_TAIL(SER(mo->series), num_bytes);  // terminates at guess
     return BIN_AT(SER(mo->series), tail);
 }
@@ -266,8 +266,17 @@ void Mold_Array_At(
 
     bool first_item = true;
 
-    RELVAL *item = ARR_AT(a, index);
-    while (NOT_END(item)) {
+    // Walk by index, since a sink can run arbitrary code that modifies the
+    // array between items (see Flush_Mold_To_Sink()).
+    //
+    bool sink_level = (
+        mo->sink != nullptr
+        and SER_LEN(TG_Mold_Stack) == mo->sink_depth + 1
+    );
+
+    REBLEN n = index;
+    while (n < ARR_LEN(a)) {
+        RELVAL *item = ARR_AT(a, n);
         if (GET_CELL_FLAG(item, NEWLINE_BEFORE)) {
            if (not indented and (sep[1] != '\0')) {
                 ++mo->indent;
@@ -286,10 +295,18 @@ void Mold_Array_At(
 
         Mold_Value(mo, item);
 
-        ++item;
-        if (IS_END(item))
+        if (
+            sink_level
+            and STR_SIZE(mo->series) - mo->offset > MOLD_SINK_THRESHOLD
+        ){
+            Flush_Mold_To_Sink(mo);
+        }
+
+        ++n;
+        if (n >= ARR_LEN(a))
             break;
 
+        item = ARR_AT(a, n);
         if (NOT_CELL_FLAG(item, NEWLINE_BEFORE))
             Append_Codepoint(mo->series, ' ');
     }
@@ -470,6 +487,58 @@ REBSTR *Copy_Mold_Or_Form_Value(const RELVAL *v, REBFLGS opts, bool form)
 }
 
 
+//
+//  Form_Value_Quick: C
+//
+// Same result as Form_Value(), but the types most often joined together in
+// reports (numbers, words, text) are appended to the buffer right here.  So
+// they skip the hook dispatch, stack and limit checks of a general FORM.
+//
+static void Form_Value_Quick(REB_MOLD *mo, const RELVAL *v)
+{
+    assert(not GET_MOLD_FLAG(mo, MOLD_FLAG_LIMIT));  // not checked here
+
+    REBYTE buf[60];
+
+    switch (VAL_TYPE(v)) {  // QUOTED! values don't match these
+      case REB_INTEGER:
+        if (IS_INTEGER_BIG(v))
+            break;
+        Append_Ascii_Len(
+            mo->series, s_cast(buf), Emit_Integer(buf, VAL_INT64(v))
+        );
+        return;
+
+      case REB_DECIMAL:  // must match MF_Decimal()
+        Append_Ascii_Len(
+            mo->series,
+            s_cast(buf),
+            Emit_Decimal(
+                buf,
+                VAL_DECIMAL(v),
+                0,
+                GET_MOLD_FLAG(mo, MOLD_FLAG_COMMA_PT) ? ',' : '.',
+                mo->digits
+            )
+        );
+        return;
+
+      case REB_TEXT:
+        Append_String(mo->series, v, VAL_LEN_AT(v));
+        return;
+
+      case REB_WORD:
+        Append_Spelling(mo->series, VAL_WORD_SPELLING(v));
+        return;
+
+      default:
+        break;
+    }
+
+    Form_Value(mo, v);
+}
+
+
 //
 //  Form_Reduce_Throws: C
 //
@@ -529,12 +598,12 @@ bool Form_Reduce_Throws(
             pending = false;
         }
         else if (IS_NULLED_OR_BLANK(delimiter))
-            Form_Value(mo, out);
+            Form_Value_Quick(mo, out);
         else {
             if (pending)
-                Form_Value(mo, delimiter);
+                Form_Value_Quick(mo, delimiter);
 
-            Form_Value(mo, out);
+            Form_Value_Quick(mo, out);
             pending = true;
         }
     } while (NOT_END(f->feed->value));
@@ -672,6 +741,42 @@ void Throttle_Mold(REB_MOLD *mo) {
 }
 
 
+//
+//  Flush_Mold_To_Sink: C
+//
+// Pass what has been molded so far to the mold's sink as a BINARY!, and drop
+// it from the buffer.  The last codepoint is kept, because New_Indented_Line()
+// looks at it to decide whether to turn a trailing space into a newline.
+//
+// The sink can run arbitrary code--including other molds, which push after
+// what is left here and balance before returning.
+//
+void Flush_Mold_To_Sink(REB_MOLD *mo)
+{
+    assert(mo->sink != nullptr);
+
+    REBSER *s = SER(mo->series);
+    REBYTE *head = BIN_AT(s, mo->offset);
+    REBYTE *tail = BIN_TAIL(s);
+    if (tail == head)
+        return;
+
+    REBYTE *last = tail - 1;
+    while (Is_Continuation_Byte_If_Utf8(*last))
+        --last;
+    if (last == head)
+        return;
+
+    REBVAL *chunk = rebSizedBinary(head, last - head);
+
+    REBSIZ keep = tail - last;
+    memmove(head, last, keep);
+    TERM_STR_LEN_SIZE(mo->series, mo->index + 1, mo->offset + keep);
+
+    rebElide(mo->sink, rebR(chunk), rebEND);
+}
+
+
 //
 //  Pop_Molded_String: C
 //
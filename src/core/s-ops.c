@@ -304,32 +304,30 @@ void Change_Case(
     // Everywhere is more mature to the point this is worth worrying about.
     //
     REBCHR(*) up = VAL_STRING_AT(val);
-    REBCHR(*) dp;
-    if (upper) {
-        REBLEN n;
-        for (n = 0; n < len; n++) {
-            dp = up;
-
-            REBUNI c;
-            up = NEXT_CHR(&c, up);
-            if (c < UNICODE_CASES) {
-                dp = WRITE_CHR(dp, UP_CASE(c));
-                assert(dp == up); // !!! not all case changes same byte size?
-            }
+    REBLEN n = 0;
+    while (n < len) {
+        //
+        // Runs of ASCII are changed a chunk of bytes at a time, without
+        // decoding them (each byte is a codepoint).  Short runs aren't worth
+        // the call.
+        //
+        REBYTE *bp = up;
+        if (*bp < 0x80 and len - n >= ASCII_RUN_MIN) {
+            REBSIZ done = Change_Ascii_Case(bp, len - n, upper);
+            up = cast(REBCHR(*), bp + done);
+            n += done;
+            continue;
         }
-    }
-    else {
-        REBLEN n;
-        for (n = 0; n < len; n++) {
-            dp = up;
-
-            REBUNI c;
-            up = NEXT_CHR(&c, up);
-            if (c < UNICODE_CASES) {
-                dp = WRITE_CHR(dp, LO_CASE(c));
-                assert(dp == up); // !!! not all case changes same byte size?
-            }
+
+        REBCHR(*) dp = up;
+
+        REBUNI c;
+        up = NEXT_CHR(&c, up);
+        if (c < UNICODE_CASES) {
+            dp = WRITE_CHR(dp, upper ? UP_CASE(c) : LO_CASE(c));
+            assert(dp == up); // !!! not all case changes same byte size?
         }
+        ++n;
     }
 }
 
@@ -280,7 +280,7 @@ static REBSER *MAKE_TO_Binary_Common(const REBVAL *arg)
     }
 
     case REB_BITSET:
-        return Copy_Bytes(VAL_BIN_HEAD(arg), VAL_LEN_HEAD(arg));
+        return Bitset_Bytes(VAL_BITSET(arg));
 
     case REB_MONEY: {
         REBSER *bin = Make_Binary(12);
@@ -908,6 +908,8 @@ REBTYPE(Binary)
 
         if (REF(all))
             fail (Error_Bad_Refine_Raw(ARG(all)));
+        if (REF(key))
+            fail (Error_Bad_Refine_Raw(ARG(key)));
 
         if (REF(case)) {
             // Ignored...all BINARY! sorts are case-sensitive.
@@ -25,6 +25,140 @@
 #include "sys-core.h"
 
 
+//
+//  Combine_Ranges: C
+//
+// Combine two sorted lists of inclusive [lo hi] ranges (see BITSET_RANGES)
+// with the set operation for SYM_UNION, SYM_INTERSECT, SYM_DIFFERENCE, or
+// SYM_EXCLUDE.  Each range is treated as the points where membership flips
+// on (lo) and off (hi + 1), and the two lists of points are walked together.
+// Returns a new managed list, or nullptr if the result is empty.
+//
+REBSER *Combine_Ranges(
+    const REBLEN *a, REBLEN a_len,  // lengths count REBLENs, two per range
+    const REBLEN *b, REBLEN b_len,
+    REBSYM sym
+){
+    if (a_len + b_len == 0)
+        return nullptr;
+
+    REBSER *out = Make_Series(a_len + b_len, sizeof(REBLEN));
+    REBLEN *op = SER_HEAD(REBLEN, out);
+    REBLEN n = 0;
+
+    REBLEN i = 0;
+    REBLEN j = 0;
+    bool in_a = false;
+    bool in_b = false;
+    bool in = false;
+
+    while (i < a_len or j < b_len) {
+        REBI64 xa = (i == a_len) ? INT64_MAX
+            : (i % 2 == 0) ? cast(REBI64, a[i]) : cast(REBI64, a[i]) + 1;
+        REBI64 xb = (j == b_len) ? INT64_MAX
+            : (j % 2 == 0) ? cast(REBI64, b[j]) : cast(REBI64, b[j]) + 1;
+        REBI64 x = MIN(xa, xb);
+
+        if (xa == x) {
+            in_a = not in_a;
+            ++i;
+        }
+        if (xb == x) {
+            in_b = not in_b;
+            ++j;
+        }
+
+        bool now;
+        switch (sym) {
+          case SYM_UNION: now = in_a or in_b; break;
+          case SYM_INTERSECT: now = in_a and in_b; break;
+          case SYM_DIFFERENCE: now = in_a != in_b; break;
+          case SYM_EXCLUDE: now = in_a and not in_b; break;
+          default: panic ("Bad set operation for bitset ranges");
+        }
+
+        if (now != in) {
+            op[n++] = now ? cast(REBLEN, x) : cast(REBLEN, x - 1);
+            in = now;
+        }
+    }
+    assert(not in and n % 2 == 0);
+
+    if (n == 0) {
+        Free_Unmanaged_Series(out);
+        return nullptr;
+    }
+
+    SET_SERIES_USED(out, n);
+    return Manage_Series(out);
+}
+
+
+//
+//  Combine_Bitset_Ranges: C
+//
+// The set operations combine the dense part of bitsets with Xandor_Binary().
+// This gives the result the combination of the operands' ranges too.  `b`
+// is nullptr if the other operand was a plain BINARY!, which has no ranges.
+//
+void Combine_Bitset_Ranges(REBSER *out, REBSER *a, REBSER *b, REBSYM sym)
+{
+    REBSER *ar = BITSET_RANGES(a);
+    REBSER *br = b ? BITSET_RANGES(b) : nullptr;
+    INIT_BITSET_RANGES(out, Combine_Ranges(
+        ar ? SER_HEAD(REBLEN, ar) : nullptr, ar ? SER_USED(ar) : 0,
+        br ? SER_HEAD(REBLEN, br) : nullptr, br ? SER_USED(br) : 0,
+        sym
+    ));
+}
+
+
+//
+//  Same_Ranges: C
+//
+bool Same_Ranges(REBSER *a, REBSER *b)
+{
+    REBSER *ar = BITSET_RANGES(a);
+    REBSER *br = BITSET_RANGES(b);
+    if (ar == br)
+        return true;
+    if (not ar or not br or SER_USED(ar) != SER_USED(br))
+        return false;
+    return 0 == memcmp(
+        SER_HEAD(REBLEN, ar),
+        SER_HEAD(REBLEN, br),
+        SER_USED(ar) * sizeof(REBLEN)
+    );
+}
+
+
+//
+//  In_Ranges: C
+//
+// Binary search of a bitset's ranges for a bit at or above the dense limit.
+//
+bool In_Ranges(REBSER *bset, REBLEN n)
+{
+    REBSER *ranges = BITSET_RANGES(bset);
+    if (not ranges)
+        return false;
+
+    const REBLEN *r = SER_HEAD(REBLEN, ranges);
+    REBLEN lo = 0;
+    REBLEN hi = SER_USED(ranges) / 2;  // search by range, not by REBLEN
+    while (lo < hi) {
+        REBLEN mid = (lo + hi) / 2;
+        if (n < r[2 * mid])
+            hi = mid;
+        else if (n > r[2 * mid + 1])
+            lo = mid + 1;
+        else
+            return true;
+    }
+    return false;
+}
+
+
 //
 //  CT_Bitset: C
 //
@@ -44,6 +178,7 @@ REBINT CT_Bitset(const REBCEL *a, const REBCEL *b, REBINT mode)
         return (
             BITS_NOT(VAL_BITSET(a)) == BITS_NOT(VAL_BITSET(b))
             && Compare_Binary_Vals(atemp, btemp) == 0
+            && Same_Ranges(VAL_BITSET(a), VAL_BITSET(b))
         );
     }
     return -1;
@@ -55,6 +190,9 @@ REBINT CT_Bitset(const REBCEL *a, const REBCEL *b, REBINT mode)
 //
 REBBIN *Make_Bitset(REBLEN num_bits)
 {
+    if (num_bits > BITSET_DENSE_LIMIT)
+        num_bits = BITSET_DENSE_LIMIT;  // higher bits are kept as ranges
+
     REBLEN num_bytes = (num_bits + 7) / 8;
     REBBIN *bin = Make_Binary(num_bytes);
     Clear_Series(bin);
@@ -74,15 +212,31 @@ void MF_Bitset(REB_MOLD *mo, const REBCEL *v, bool form)
     Pre_Mold(mo, v); // #[bitset! or make bitset!
 
     REBBIN *s = VAL_BITSET(v);
+    REBSER *ranges = BITSET_RANGES(s);
 
     if (BITS_NOT(s))
         Append_Ascii(mo->series, "[not bits ");
+    else if (ranges)
+        Append_Ascii(mo->series, "[bits ");
 
     DECLARE_LOCAL (binary);
     Init_Binary(binary, s);
     MF_Binary(mo, binary, false); // false = mold, don't form
 
-    if (BITS_NOT(s))
+    if (ranges) {  // as integers, which Set_Bits() takes for any size
+        const REBLEN *r = SER_HEAD(REBLEN, ranges);
+        REBLEN n;
+        for (n = 0; n < SER_USED(ranges); n += 2) {
+            Append_Codepoint(mo->series, ' ');
+            Append_Int(mo->series, cast(REBINT, r[n]));
+            if (r[n + 1] != r[n]) {
+                Append_Ascii(mo->series, " - ");
+                Append_Int(mo->series, cast(REBINT, r[n + 1]));
+            }
+        }
+    }
+
+    if (BITS_NOT(s) or ranges)
         Append_Codepoint(mo->series, ']');
 
     End_Mold(mo);
@@ -112,6 +266,12 @@ REB_R MAKE_Bitset(
     if (len < 0 || len > 0x0FFFFFFF)
         fail (arg);
 
+    // A spec reaching into the ranges would only preallocate zeros in the
+    // dense part, so let the bits that are set expand it instead.
+    //
+    if (len >= BITSET_DENSE_LIMIT and not IS_INTEGER(arg))
+        len = 0;
+
     REBBIN *bin = Make_Bitset(len);
     Init_Bitset(out, Manage_Series(bin));
 
@@ -119,7 +279,7 @@ REB_R MAKE_Bitset(
         return out; // allocated at a size, no contents.
 
     if (IS_BINARY(arg)) {
-        memcpy(BIN_HEAD(bin), VAL_BIN_AT(arg), len/8 + 1);
+        Set_Bits_From_Bytes(bin, VAL_BIN_AT(arg), VAL_LEN_AT(arg));
         return out;
     }
 
@@ -201,12 +361,14 @@ REBINT Find_Max_Bit(const RELVAL *val)
 
 
 //
-//  Check_Bit: C
+//  Check_Bit_Core: C
 //
 // Check bit indicated. Returns true if set.
 // If uncased is true, try to match either upper or lower case.
 //
-bool Check_Bit(REBSER *bset, REBLEN c, bool uncased)
+// (ASCII is handled by the inline Check_Bit() before getting here.)
+//
+bool Check_Bit_Core(REBSER *bset, REBLEN c, bool uncased)
 {
     REBLEN i, n = c;
     REBLEN tail = SER_LEN(bset);
@@ -224,6 +386,8 @@ retry:
     i = n >> 3;
     if (i < tail)
         flag = did (BIN_HEAD(bset)[i] & (1 << (7 - (n & 7))));
+    else if (n >= BITSET_DENSE_LIMIT)
+        flag = In_Ranges(bset, n);  // no case folding up here
 
     // Check uppercase if needed:
     if (uncased && !flag) {
@@ -246,6 +410,11 @@ retry:
 //
 void Set_Bit(REBSER *bset, REBLEN n, bool set)
 {
+    if (n >= BITSET_DENSE_LIMIT) {
+        Set_Bit_Range(bset, n, n, set);
+        return;
+    }
+
     REBLEN i = n >> 3;
     REBLEN tail = SER_LEN(bset);
     REBYTE bit;
@@ -265,6 +434,127 @@ void Set_Bit(REBSER *bset, REBLEN n, bool set)
 }
 
 
+//
+//  Set_Bit_Range: C
+//
+// Set/clear the bits from lo to hi inclusive.  The dense part is expanded
+// once and filled a byte at a time, and anything at or above the dense
+// limit is a single operation on the ranges.
+//
+void Set_Bit_Range(REBSER *bset, REBLEN lo, REBLEN hi, bool set)
+{
+    assert(lo <= hi);
+
+    if (lo < BITSET_DENSE_LIMIT) {
+        REBLEN end = MIN(hi, BITSET_DENSE_LIMIT - 1) + 1;  // exclusive
+        REBLEN tail = SER_LEN(bset);
+
+        if (((end - 1) >> 3) >= tail) {
+            if (set) {
+                Expand_Series(bset, tail, ((end - 1) >> 3) - tail + 1);
+                CLEAR(BIN_AT(bset, tail), ((end - 1) >> 3) - tail + 1);
+            }
+            else
+                end = tail * 8;  // nothing to clear past the tail
+        }
+
+        REBYTE *bp = BIN_HEAD(bset);
+        REBLEN n = lo;
+        for (; n < end and (n & 7) != 0; ++n) {
+            if (set)
+                bp[n >> 3] |= 1 << (7 - (n & 7));
+            else
+                bp[n >> 3] &= ~(1 << (7 - (n & 7)));
+        }
+        for (; n + 8 <= end; n += 8)
+            bp[n >> 3] = set ? 0xFF : 0;
+        for (; n < end; ++n) {
+            if (set)
+                bp[n >> 3] |= 1 << (7 - (n & 7));
+            else
+                bp[n >> 3] &= ~(1 << (7 - (n & 7)));
+        }
+    }
+
+    if (hi >= BITSET_DENSE_LIMIT) {
+        REBLEN range[2];
+        range[0] = MAX(lo, cast(REBLEN, BITSET_DENSE_LIMIT));
+        range[1] = hi;
+
+        REBSER *ranges = BITSET_RANGES(bset);
+        INIT_BITSET_RANGES(bset, Combine_Ranges(
+            ranges ? SER_HEAD(REBLEN, ranges) : nullptr,
+            ranges ? SER_USED(ranges) : 0,
+            range,
+            2,
+            set ? SYM_UNION : SYM_EXCLUDE
+        ));
+    }
+}
+
+
+//
+//  Set_Bits_From_Bytes: C
+//
+// Copy bits given as bytes over the start of the bitset.  Bytes beyond the
+// dense part are added as ranges.
+//
+void Set_Bits_From_Bytes(REBSER *bset, const REBYTE *bp, REBLEN size)
+{
+    REBLEN dense = MIN(size, cast(REBLEN, BITSET_DENSE_LIMIT / 8));
+    REBLEN tail = SER_LEN(bset);
+    if (dense > tail) {
+        Expand_Series(bset, tail, dense - tail);
+        CLEAR(BIN_AT(bset, tail), dense - tail);
+    }
+    memcpy(BIN_HEAD(bset), bp, dense);
+
+    REBLEN i;
+    for (i = dense; i < size; ++i) {
+        if (bp[i] == 0)
+            continue;
+        REBLEN b;
+        for (b = 0; b < 8; ++b) {
+            if (bp[i] & (1 << (7 - b)))
+                Set_Bit(bset, i * 8 + b, true);
+        }
+    }
+}
+
+
+//
+//  Bitset_Bytes: C
+//
+// The bits of a bitset as a new binary, with the ranges (if any) spelled out
+// as bits.  This is what TO BINARY! gives, as it did before there were ranges.
+//
+REBSER *Bitset_Bytes(REBSER *bset)
+{
+    REBSER *ranges = BITSET_RANGES(bset);
+    REBLEN len = SER_LEN(bset);
+    REBLEN size = ranges
+        ? SER_HEAD(REBLEN, ranges)[SER_USED(ranges) - 1] / 8 + 1
+        : len;
+
+    REBSER *bin = Make_Binary(size);
+    memcpy(BIN_HEAD(bin), BIN_HEAD(bset), len);
+    CLEAR(BIN_AT(bin, len), size - len);
+    TERM_SEQUENCE_LEN(bin, size);
+
+    if (ranges) {
+        const REBLEN *r = SER_HEAD(REBLEN, ranges);
+        REBYTE *bp = BIN_HEAD(bin);
+        REBLEN n;
+        for (n = 0; n < SER_USED(ranges); n += 2) {
+            REBLEN bit = r[n];
+            for (; bit <= r[n + 1]; ++bit)
+                bp[bit >> 3] |= 1 << (7 - (bit & 7));
+        }
+    }
+    return bin;
+}
+
+
 //
 //  Set_Bits: C
 //
@@ -338,9 +628,7 @@ bool Set_Bits(REBSER *bset, const REBVAL *val, bool set)
                     REBLEN n = VAL_CHAR(item);
                     if (n < c)
                         fail (Error_Past_End_Raw());
-                    do {
-                        Set_Bit(bset, c, set);
-                    } while (c++ < n); // post-increment: test before overflow
+                    Set_Bit_Range(bset, c, n, set);
                 }
                 else
                     fail (Error_Bad_Value_Core(item, VAL_SPECIFIER(val)));
@@ -362,10 +650,11 @@ bool Set_Bits(REBSER *bset, const REBVAL *val, bool set)
                 item += 2;
                 if (IS_INTEGER(item)) {
                     n = Int32s(KNOWN(item), 0);
+                    if (n > MAX_BITSET)
+                        return false;
                     if (n < c)
                         fail (Error_Past_End_Raw());
-                    for (; c <= n; c++)
-                        Set_Bit(bset, c, set);
+                    Set_Bit_Range(bset, c, n, set);
                 }
                 else
                     fail (Error_Bad_Value_Core(item, VAL_SPECIFIER(val)));
@@ -391,13 +680,7 @@ bool Set_Bits(REBSER *bset, const REBVAL *val, bool set)
             item++;
             if (not IS_BINARY(item))
                 return false;
-            REBLEN n = VAL_LEN_AT(item);
-            REBUNI c = SER_LEN(bset);
-            if (n >= c) {
-                Expand_Series(bset, c, (n - c));
-                CLEAR(BIN_AT(bset, c), (n - c));
-            }
-            memcpy(BIN_HEAD(bset), VAL_BIN_AT(item), n);
+            Set_Bits_From_Bytes(bset, VAL_BIN_AT(item), VAL_LEN_AT(item));
             break; }
 
         default:
@@ -581,12 +864,21 @@ REBTYPE(Bitset)
 
         REBSYM property = VAL_WORD_SYM(ARG(property));
         switch (property) {
-          case SYM_LENGTH:
-            return Init_Integer(v, BIN_LEN(VAL_BITSET(v)) * 8);
+          case SYM_LENGTH: {  // as if the ranges were bits in the binary
+            REBSER *ranges = BITSET_RANGES(VAL_BITSET(v));
+            if (ranges) {
+                REBLEN last = SER_HEAD(REBLEN, ranges)[SER_USED(ranges) - 1];
+                return Init_Integer(v, (cast(REBI64, last) / 8 + 1) * 8);
+            }
+            return Init_Integer(v, BIN_LEN(VAL_BITSET(v)) * 8); }
 
           case SYM_TAIL_Q:
             // Necessary to make EMPTY? work:
-            return Init_Logic(D_OUT, BIN_LEN(VAL_BITSET(v)) == 0);
+            return Init_Logic(
+                D_OUT,
+                BIN_LEN(VAL_BITSET(v)) == 0
+                    and not BITSET_RANGES(VAL_BITSET(v))
+            );
 
           default:
             break;
@@ -614,6 +906,7 @@ REBTYPE(Bitset)
       case SYM_NEGATE: {
         REBBIN *copy = Copy_Sequence_Core(VAL_BITSET(v), NODE_FLAG_MANAGED);
         INIT_BITS_NOT(copy, not BITS_NOT(VAL_BITSET(v)));
+        INIT_BITSET_RANGES(copy, BITSET_RANGES(VAL_BITSET(v)));  // shareable
         return Init_Bitset(D_OUT, copy); }
 
       case SYM_APPEND:  // Accepts: #"a" "abc" [1 - 10] [#"a" - #"z"] etc.
@@ -655,21 +948,25 @@ REBTYPE(Bitset)
 
         REBBIN *copy = Copy_Sequence_Core(VAL_BITSET(v), NODE_FLAG_MANAGED);
         INIT_BITS_NOT(copy, BITS_NOT(VAL_BITSET(v)));
+        INIT_BITSET_RANGES(copy, BITSET_RANGES(VAL_BITSET(v)));  // shareable
         return Init_Bitset(D_OUT, copy); }
 
       case SYM_CLEAR:
         FAIL_IF_READ_ONLY(v);
         Clear_Series(VAL_BITSET(v));
+        INIT_BITSET_RANGES(VAL_BITSET(v), nullptr);
         RETURN (v);
 
       case SYM_INTERSECT:
       case SYM_UNION:
       case SYM_DIFFERENCE: {
         REBVAL *arg = D_ARG(2);
+        REBSER *arg_bits = nullptr;
         if (IS_BITSET(arg)) {
             if (BITS_NOT(VAL_BITSET(arg)))  // !!! see #2365
                 fail ("Bitset negation not handled by set operations");
-            Init_Binary(arg, VAL_BITSET(arg));
+            arg_bits = VAL_BITSET(arg);
+            Init_Binary(arg, arg_bits);
         }
         else if (not IS_BINARY(arg))
             fail (Error_Math_Args(VAL_TYPE(arg), verb));
@@ -677,11 +974,13 @@ REBTYPE(Bitset)
         if (BITS_NOT(VAL_BITSET(v)))  // !!! see #2365
             fail ("Bitset negation not handled by set operations");
 
-        Init_Binary(v, VAL_BITSET(v));
+        REBSER *v_bits = VAL_BITSET(v);
+        Init_Binary(v, v_bits);
 
         REBBIN *bits = Xandor_Binary(verb, v, arg);
         INIT_BITS_NOT(bits, false);
         Trim_Tail_Zeros(bits);
+        Combine_Bitset_Ranges(bits, v_bits, arg_bits, VAL_WORD_SYM(verb));
         return Init_Bitset(D_OUT, Manage_Series(bits)); }
 
       default:
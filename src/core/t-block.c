@@ -40,6 +40,9 @@
 //
 REBINT CT_Array(const REBCEL *a, const REBCEL *b, REBINT mode)
 {
+    if (mode >= 0 and VAL_LEN_AT(a) != VAL_LEN_AT(b))
+        return 0;  // can't be equal, don't bother comparing the items
+
     REBINT num = Cmp_Array(a, b, mode == 1);
     if (mode >= 0)
         return (num == 0);
@@ -308,6 +311,161 @@ REB_R TO_Array(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg) {
 }
 
 
+// Which kinds of first value in a record go in an array's hash index (see
+// ARRAY_FLAG_HAS_HASH_INDEX).  Series are left out because they can be
+// changed without the array holding them being changed, which would leave
+// them under the wrong hash.  Other kinds are left out if their comparison
+// can see them as equal to values with a different hash (or that can't be
+// hashed at all).  A search for a value of any other kind is just linear.
+//
+inline static bool Is_Hash_Index_Kind(enum Reb_Kind kind) {
+    switch (kind) {
+      case REB_WORD:
+      case REB_SET_WORD:
+      case REB_GET_WORD:
+      case REB_SYM_WORD:
+      case REB_INTEGER:
+      case REB_CHAR:
+      case REB_LOGIC:
+      case REB_BLANK:
+        return true;
+
+      default:
+        return false;
+    }
+}
+
+
+//
+//  Sync_Array_Hash_Index: C
+//
+// Bring an array's hash index up to date with the array.  Records appended
+// since it was last used are added to it, and if the array was changed in
+// some other way the whole index is rebuilt.
+//
+static REBSER *Sync_Array_Hash_Index(REBARR *a)
+{
+    REBSER *hashlist = LINK_HASH_INDEX(a);
+    REBLEN skip = HASH_INDEX_SKIP(hashlist);
+    REBLEN records = (ARR_LEN(a) + skip - 1) / skip;  // the last may be short
+
+    intptr_t count = HASH_INDEX_COUNT(hashlist);
+    if (count == cast(intptr_t, records))
+        return hashlist;
+
+    if (records > SER_LEN(hashlist) / 2) {  // keep table at most half full
+        hashlist = Make_Hash_Sequence(records);
+        HASH_INDEX_SKIP(hashlist) = skip;
+        LINK_HASH_INDEX_NODE(a) = NOD(Manage_Series(hashlist));
+        count = 0;
+    }
+    else if (count < 0 or count > cast(intptr_t, records)) {
+        Clear_Series(hashlist);
+        SER(hashlist)->info.bits &= ~HASH_INDEX_INFO_INEXACT_NUMBERS;
+        count = 0;
+    }
+
+    for (; count < cast(intptr_t, records); ++count) {
+        const RELVAL *key = ARR_AT(a, count * skip);
+        enum Reb_Kind kind = CELL_KIND(VAL_UNESCAPED(key));
+        if (Is_Hash_Index_Kind(kind))
+            Insert_Hash_Slot(hashlist, Hash_Value(key), count + 1);
+        else if (ANY_NUMBER_KIND(kind))
+            SER(hashlist)->info.bits |= HASH_INDEX_INFO_INEXACT_NUMBERS;
+    }
+
+    HASH_INDEX_COUNT(hashlist) = count;
+    return hashlist;
+}
+
+
+//
+//  Try_Find_In_Hash_Index: C
+//
+// Answer a Find_In_Array() search from the array's hash index, if it has one
+// that is able to.  The index only knows where records begin, so the search
+// must use the same skip as the index and start at a record.  Candidates
+// with the same hash are checked the same way the linear search would, and
+// the lowest position among them wins.
+//
+static bool Try_Find_In_Hash_Index(
+    REBLEN *found,  // position, or NOT_FOUND
+    REBARR *array,
+    REBINT index,
+    REBINT end,
+    const RELVAL *target,
+    REBFLGS flags,
+    REBINT skip
+){
+    if (skip <= 0 or (flags & AM_FIND_MATCH))
+        return false;  // only one position is checked by /MATCH anyway
+
+    enum Reb_Kind kind = CELL_KIND(VAL_UNESCAPED(target));
+    if (not Is_Hash_Index_Kind(kind))
+        return false;
+
+    REBSER *hashlist = Sync_Array_Hash_Index(array);
+    if (cast(REBINT, HASH_INDEX_SKIP(hashlist)) != skip or index % skip != 0)
+        return false;
+
+    if (
+        kind == REB_INTEGER
+        and (SER(hashlist)->info.bits & HASH_INDEX_INFO_INEXACT_NUMBERS)
+    ){
+        return false;
+    }
+
+    bool cased = did (flags & AM_FIND_CASE);
+
+    REBLEN mask = SER_LEN(hashlist) - 1;
+    struct Reb_Hash_Slot *slots = SER_HEAD(struct Reb_Hash_Slot, hashlist);
+
+    uint32_t hash = Hash_Value(target);
+    REBLEN slot = hash & mask;
+    REBLEN dist = 0;
+
+    *found = NOT_FOUND;
+    for (; slots[slot].index != 0; slot = (slot + 1) & mask, ++dist) {
+        if (Hash_Slot_Distance(slots, slot, mask) < dist)
+            break;  // no more keys with this hash (see Find_Key_Hashed())
+
+        if (slots[slot].hash != hash)
+            continue;
+
+        REBLEN at = (slots[slot].index - 1) * skip;
+        if (
+            at < cast(REBLEN, index)
+            or at >= cast(REBLEN, end)
+            or (*found != NOT_FOUND and at > *found)
+        ){
+            continue;
+        }
+
+        const RELVAL *item = ARR_AT(array, at);
+        if (ANY_WORD(target)) {  // must match the linear search's word test
+            if (not ANY_WORD(item))
+                continue;
+            if (cased) {
+                if (
+                    VAL_WORD_SPELLING(item) != VAL_WORD_SPELLING(target)
+                    or VAL_TYPE(item) != VAL_TYPE(target)
+                ){
+                    continue;
+                }
+            }
+            else if (VAL_WORD_CANON(item) != VAL_WORD_CANON(target))
+                continue;
+        }
+        else if (0 != Cmp_Value(item, target, cased))
+            continue;
+
+        *found = at;
+    }
+
+    return true;
+}
+
+
 //
 //  Find_In_Array: C
 //
@@ -334,28 +492,72 @@ REBLEN Find_In_Array(
     else
         start = index;
 
-    // Optimized find word in block
+    if (GET_ARRAY_FLAG(array, HAS_HASH_INDEX)) {
+        REBLEN found;
+        if (Try_Find_In_Hash_Index(
+            &found, array, index, end, target, flags, skip
+        )){
+            return found;
+        }
+    }
+
+    // /MATCH only looks at the first position, so narrow the range to that
+    // here instead of checking the flag on each step of the loops below.
+    //
+    if (flags & AM_FIND_MATCH) {
+        if (skip < 0) {
+            if (index > start)
+                start = index;
+        }
+        else if (index + 1 < end)
+            end = index + 1;
+    }
+
+    // The common cases get a loop of their own, with anything depending only
+    // on the target worked out before it starts.  So searching a block for
+    // a WORD! is one pointer compare per word cell (and a type test for the
+    // others), and an INTEGER! is one 64-bit compare.
     //
     if (ANY_WORD(target)) {
+        if (flags & AM_FIND_CASE) {  // Must be same type and spelling
+            REBSTR *spelling = VAL_WORD_SPELLING(target);
+            enum Reb_Kind kind = VAL_TYPE(target);
+            for (; index >= start and index < end; index += skip) {
+                RELVAL *item = ARR_AT(array, index);
+                if (
+                    VAL_TYPE(item) == kind
+                    and VAL_WORD_SPELLING(item) == spelling
+                ){
+                    return index;
+                }
+            }
+        }
+        else {  // Can be different type or differently cased spelling
+            REBSTR *canon = VAL_WORD_CANON(target);
+            for (; index >= start and index < end; index += skip) {
+                RELVAL *item = ARR_AT(array, index);
+                if (ANY_WORD(item) and VAL_WORD_CANON(item) == canon)
+                    return index;
+            }
+        }
+        return NOT_FOUND;
+    }
+
+    if (IS_INTEGER(target) and not IS_INTEGER_BIG(target)) {
+        REBI64 i64 = VAL_INT64(target);
+        bool cased = did (flags & AM_FIND_CASE);
         for (; index >= start and index < end; index += skip) {
             RELVAL *item = ARR_AT(array, index);
-            REBSTR *target_canon = VAL_WORD_CANON(target); // canonize once
-            if (ANY_WORD(item)) {
-                if (flags & AM_FIND_CASE) { // Must be same type and spelling
-                    if (
-                        VAL_WORD_SPELLING(item) == VAL_WORD_SPELLING(target)
-                        and VAL_TYPE(item) == VAL_TYPE(target)
-                    ){
-                        return index;
-                    }
-                }
-                else { // Can be different type or differently cased spelling
-                    if (VAL_WORD_CANON(item) == target_canon)
-                        return index;
-                }
+            if (IS_INTEGER(item)) {
+                if (not IS_INTEGER_BIG(item) and VAL_INT64(item) == i64)
+                    return index;
+                continue;
             }
-            if (flags & AM_FIND_MATCH)
-                break;
+            if (not ANY_NUMBER_KIND(CELL_KIND(VAL_UNESCAPED(item))))
+                continue;  // Cmp_Value() only equates numbers with numbers
+
+            if (0 == Cmp_Value(item, target, cased))  // e.g. 1.0, or '1
+                return index;
         }
         return NOT_FOUND;
     }
@@ -378,8 +580,6 @@ REBLEN Find_In_Array(
                 if (++count >= len)
                     return index;
             }
-            if (flags & AM_FIND_MATCH)
-                break;
         }
         return NOT_FOUND;
     }
@@ -412,21 +612,17 @@ REBLEN Find_In_Array(
                 if (IS_TYPESET(item) and EQUAL_TYPESET(item, target))
                     return index;
             }
-            if (flags & AM_FIND_MATCH)
-                break;
         }
         return NOT_FOUND;
     }
 
     // All other cases
 
+    bool cased = did (flags & AM_FIND_CASE);
     for (; index >= start and index < end; index += skip) {
         RELVAL *item = ARR_AT(array, index);
-        if (0 == Cmp_Value(item, target, did (flags & AM_FIND_CASE)))
+        if (0 == Cmp_Value(item, target, cased))
             return index;
-
-        if (flags & AM_FIND_MATCH)
-            break;
     }
 
     return NOT_FOUND;
@@ -439,6 +635,10 @@ struct sort_flags {
     REBLEN offset;
     REBVAL *comparator;
     bool all; // !!! not used?
+
+    cmp_t *polled;  // comparator Compare_Val_Polled() calls, see Sort_Block()
+    REBLEN poll;  // countdown of comparisons until polling for signals
+    bool halted;
 };
 
 
@@ -466,6 +666,76 @@ static int Compare_Val(void *arg, const void *v1, const void *v2)
 }
 
 
+// When every key being sorted is the same simple type, and not quoted, the
+// quoting and type dispatch that Cmp_Value() does on each call can be
+// skipped.  These order the same way Cmp_Value() does--except INTEGER!s
+// are compared directly, vs. by the sign of their difference (which could
+// overflow for far-apart values and give the wrong order).
+
+static int Compare_Val_Integer(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+    REBI64 i1 = VAL_INT64(cast(const RELVAL*, v1) + flags->offset);
+    REBI64 i2 = VAL_INT64(cast(const RELVAL*, v2) + flags->offset);
+    int result = (i1 > i2) - (i1 < i2);
+    return flags->reverse ? -result : result;
+}
+
+static int Compare_Val_Decimal(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+    REBDEC d1 = VAL_DECIMAL(cast(const RELVAL*, v1) + flags->offset);
+    REBDEC d2 = VAL_DECIMAL(cast(const RELVAL*, v2) + flags->offset);
+    int result;
+    if (Eq_Decimal(d1, d2))
+        result = 0;
+    else
+        result = (d1 < d2) ? -1 : 1;
+    return flags->reverse ? -result : result;
+}
+
+static int Compare_Val_String(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+    const RELVAL *s = cast(const RELVAL*, v1) + flags->offset;
+    const RELVAL *t = cast(const RELVAL*, v2) + flags->offset;
+    if (flags->reverse)
+        return Compare_String_Vals(t, s, not flags->cased);
+    return Compare_String_Vals(s, t, not flags->cased);
+}
+
+static int Compare_Val_Word(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+    const RELVAL *s = cast(const RELVAL*, v1) + flags->offset;
+    const RELVAL *t = cast(const RELVAL*, v2) + flags->offset;
+    if (flags->reverse)
+        return Compare_Word(t, s, flags->cased);
+    return Compare_Word(s, t, flags->cased);
+}
+
+
+// Sorts of many items go through this, which polls for signals every so many
+// comparisons.  If a halt is pending, all items compare as equal from then
+// on, which qsort() gets through quickly (leaving the block part sorted).
+//
+static int Compare_Val_Polled(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+    if (flags->halted)
+        return 0;
+
+    if (--flags->poll == 0) {
+        flags->poll = POLL_CHUNK;
+        if (Poll_Signals(SIGS_POLL_ANYWHERE | SIG_RECYCLE)) {
+            flags->halted = true;
+            return 0;
+        }
+    }
+    return (*flags->polled)(arg, v1, v2);
+}
+
+
 //
 //  Compare_Val_Custom: C
 //
@@ -512,6 +782,169 @@ static int Compare_Val_Custom(void *arg, const void *v1, const void *v2)
 }
 
 
+struct key_sort_flags {
+    const RELVAL *keys;
+    bool cased;
+    bool reverse;
+};
+
+
+//
+//  Compare_Key_Index: C
+//
+// Orders indices into an array of SORT/KEY keys.  Equal keys are ordered by
+// index, which makes the sort stable.
+//
+static int Compare_Key_Index(void *arg, const void *p1, const void *p2)
+{
+    struct key_sort_flags *flags = cast(struct key_sort_flags*, arg);
+    REBLEN i1 = *cast(const REBLEN*, p1);
+    REBLEN i2 = *cast(const REBLEN*, p2);
+
+    int result = Cmp_Value(flags->keys + i1, flags->keys + i2, flags->cased);
+    if (flags->reverse)
+        result = -result;
+    if (result == 0)
+        result = (i1 > i2) - (i1 < i2);
+    return result;
+}
+
+
+//
+//  Radix_Sort_Key_Indices: C
+//
+// When all SORT/KEY keys are INTEGER!, order the indices with an LSD radix
+// sort one byte at a time, which is linear and stable.  Flipping the sign
+// bit makes two's complement order match unsigned order, and complementing
+// that gives the reverse order.
+//
+static void Radix_Sort_Key_Indices(
+    REBLEN *order,
+    const RELVAL *keys,
+    REBLEN num,
+    bool reverse
+){
+    REBSER *bits_ser = Make_Series(num, sizeof(REBU64));
+    REBSER *temp_ser = Make_Series(num, sizeof(REBLEN));
+    REBU64 *bits = SER_HEAD(REBU64, bits_ser);
+    REBLEN *temp = SER_HEAD(REBLEN, temp_ser);
+
+    REBLEN n;
+    for (n = 0; n < num; ++n) {
+        REBU64 u = cast(REBU64, VAL_INT64(keys + n)) ^ (cast(REBU64, 1) << 63);
+        bits[n] = reverse ? ~u : u;
+        order[n] = n;
+    }
+
+    REBLEN shift;
+    for (shift = 0; shift < 64; shift += 8) {
+        REBLEN counts[256];
+        memset(counts, 0, sizeof(counts));
+        for (n = 0; n < num; ++n)
+            ++counts[(bits[order[n]] >> shift) & 0xFF];
+
+        if (counts[(bits[order[0]] >> shift) & 0xFF] == num)
+            continue;  // every key has the same byte here, nothing moves
+
+        REBLEN total = 0;
+        REBLEN b;
+        for (b = 0; b < 256; ++b) {
+            REBLEN count = counts[b];
+            counts[b] = total;
+            total += count;
+        }
+
+        for (n = 0; n < num; ++n)
+            temp[counts[(bits[order[n]] >> shift) & 0xFF]++] = order[n];
+
+        memcpy(order, temp, num * sizeof(REBLEN));
+    }
+
+    Free_Unmanaged_Series(temp_ser);
+    Free_Unmanaged_Series(bits_ser);
+}
+
+
+//
+//  Sort_Block_By_Key: C
+//
+// SORT/KEY runs the key action once per record, vs. SORT/COMPARE running
+// its action once per comparison (n log n times).  The records are then put
+// in the order of their keys, and records with equal keys stay in order.
+//
+static void Sort_Block_By_Key(
+    REBVAL *block,
+    REBLEN len,
+    REBLEN skip,
+    REBVAL *key_action,
+    bool cased,
+    bool reverse
+){
+    REBLEN num = len / skip;
+
+    REBARR *keys = Make_Array_Core(num, NODE_FLAG_MANAGED);
+    PUSH_GC_GUARD(keys);
+
+    DECLARE_LOCAL (result);
+    bool all_integer = true;
+
+    REBLEN n;
+    for (n = 0; n < num; ++n) {
+        if (VAL_LEN_AT(block) < len)  // key action could have changed it
+            fail ("Series was modified during SORT/KEY");
+
+        const RELVAL *record = VAL_ARRAY_AT(block) + n * skip;
+
+        const bool fully = true; // error if not all arguments consumed
+        if (RunQ_Throws(result, fully, rebU1(key_action), record, rebEND))
+            fail (Error_No_Catch_For_Throw(result));
+
+        if (IS_NULLED(result))
+            fail (Error_Need_Non_Null_Raw(key_action));
+
+        if (not IS_INTEGER(result))
+            all_integer = false;
+
+        Note_Series_Mutation(SER(keys));
+        Move_Value(Alloc_Tail_Array(keys), result);
+    }
+
+    if (VAL_LEN_AT(block) < len)
+        fail ("Series was modified during SORT/KEY");
+
+    REBSER *order_ser = Make_Series(num, sizeof(REBLEN));
+    REBLEN *order = SER_HEAD(REBLEN, order_ser);
+
+    if (all_integer)
+        Radix_Sort_Key_Indices(order, ARR_HEAD(keys), num, reverse);
+    else {
+        for (n = 0; n < num; ++n)
+            order[n] = n;
+
+        struct key_sort_flags flags;
+        flags.keys = ARR_HEAD(keys);
+        flags.cased = cased;
+        flags.reverse = reverse;
+        reb_qsort_r(order, num, sizeof(REBLEN), &flags, &Compare_Key_Index);
+    }
+
+    // RELVAL bits can be copied within the same array, and no evaluation
+    // happens between copying the records out and back in.
+    //
+    REBSER *temp_ser = Make_Series(len, sizeof(RELVAL));
+    RELVAL *temp = SER_HEAD(RELVAL, temp_ser);
+    RELVAL *head = VAL_ARRAY_AT(block);
+    for (n = 0; n < num; ++n)
+        memcpy(temp + n * skip, head + order[n] * skip, skip * sizeof(RELVAL));
+    memcpy(head, temp, len * sizeof(RELVAL));
+
+    Free_Unmanaged_Series(temp_ser);
+    Free_Unmanaged_Series(order_ser);
+
+    DROP_GC_GUARD(keys);
+}
+
+
 //
 //  Sort_Block: C
 //
@@ -525,6 +958,7 @@ static int Compare_Val_Custom(void *arg, const void *v1, const void *v2)
 // limit [any-number! any-series!] {Length of series to sort}
 // /all {Compare all fields}
 // /reverse {Reverse sort order}
+// /key {Sort by result of action on each value}
 //
 static void Sort_Block(
     REBVAL *block,
@@ -533,7 +967,8 @@ static void Sort_Block(
     REBVAL *compv,
     REBVAL *part,
     bool all,
-    bool rev
+    bool rev,
+    REBVAL *keyv
 ) {
     struct sort_flags flags;
     flags.cased = ccase;
@@ -568,12 +1003,65 @@ static void Sort_Block(
     else
         skip = 1;
 
+    if (not IS_NULLED(keyv)) {
+        if (not IS_NULLED(compv))
+            fail (Error_Bad_Refines_Raw());
+        Sort_Block_By_Key(block, len, skip, keyv, ccase, rev);
+        return;
+    }
+
+    cmp_t *cmp;
+    if (flags.comparator != NULL)
+        cmp = &Compare_Val_Custom;
+    else if (flags.offset >= skip)
+        cmp = &Compare_Val;  // let Cmp_Value() see what's out of the record
+    else {
+        // See if all the keys have one type that has a direct comparator.
+        //
+        RELVAL *key = VAL_ARRAY_AT(block) + flags.offset;
+        REBYTE kind = KIND_BYTE(key);
+
+        REBLEN n;
+        for (n = skip; n < len; n += skip) {
+            if (KIND_BYTE(key + n) != kind)
+                break;
+        }
+
+        if (n < len)
+            cmp = &Compare_Val;
+        else if (kind == REB_INTEGER)
+            cmp = &Compare_Val_Integer;
+        else if (kind == REB_DECIMAL)
+            cmp = &Compare_Val_Decimal;
+        else if (
+            kind == REB_TEXT or kind == REB_FILE or kind == REB_EMAIL
+            or kind == REB_URL or kind == REB_TAG or kind == REB_ISSUE
+        ){
+            cmp = &Compare_Val_String;
+        }
+        else if (kind == REB_WORD)
+            cmp = &Compare_Val_Word;
+        else
+            cmp = &Compare_Val;
+    }
+
+    // Custom comparators run the evaluator, which already handles signals.
+    // Others could take long enough on big blocks to need polling.  (The
+    // block is an argument of SORT, so it's safe for the GC to run.)
+    //
+    flags.halted = false;
+    if (flags.comparator == NULL and len / skip > POLL_CHUNK) {
+        flags.polled = cmp;
+        flags.poll = POLL_CHUNK;
+        cmp = &Compare_Val_Polled;
+    }
+
     reb_qsort_r(
         VAL_ARRAY_AT(block),
         len / skip,
         sizeof(REBVAL) * skip,
         &flags,
-        flags.comparator != NULL ? &Compare_Val_Custom : &Compare_Val
+        cmp
     );
 }
 
@@ -956,6 +1444,16 @@ REBTYPE(Array)
                 VAL_INDEX(array) = 0;
             RETURN (array); // don't fail on read only if it would be a no-op
         }
+        // An APPEND only adds records after the ones an array's hash index
+        // has seen, so it needn't make the index be rebuilt.
+        //
+        REBSER *hash_index = nullptr;
+        intptr_t hash_count = 0;
+        if (sym == SYM_APPEND and GET_ARRAY_FLAG(arr, HAS_HASH_INDEX)) {
+            hash_index = LINK_HASH_INDEX(arr);
+            hash_count = HASH_INDEX_COUNT(hash_index);
+        }
+
         FAIL_IF_READ_ONLY(array);
 
         REBLEN index = VAL_INDEX(array);
@@ -982,6 +1480,10 @@ REBTYPE(Array)
             len,
             REF(dup) ? Int32(ARG(dup)) : 1
         );
+
+        if (hash_index)
+            HASH_INDEX_COUNT(hash_index) = hash_count;
+
         return D_OUT; }
 
       case SYM_CLEAR: {
@@ -1135,7 +1637,8 @@ REBTYPE(Array)
             ARG(compare),  // blank! if no /COMPARE
             ARG(part),  // blank! if no /PART
             did REF(all),
-            did REF(reverse)
+            did REF(reverse),
+            ARG(key)  // null if no /KEY
         );
         RETURN (array); }
 
@@ -1187,6 +1690,62 @@ REBTYPE(Array)
 }
 
 
+//
+//  make-index: native [
+//
+//  {Keep a hash index of a block's values, to speed up FIND and SELECT}
+//
+//      return: [any-array!]
+//      series [any-array!]
+//      /skip "Treat the series as records of a fixed size, indexing the first"
+//          [integer!]
+//  ]
+//
+REBNATIVE(make_index)
+//
+// The index is updated when items are appended, and rebuilt on the next
+// search after any other change.  Only words, integers, characters, logic
+// values and blanks are indexed; searching for anything else (or with a
+// different skip) scans as usual.  Copies of the array are not indexed.
+{
+    INCLUDE_PARAMS_OF_MAKE_INDEX;
+
+    REBVAL *series = ARG(series);
+    REBARR *a = VAL_ARRAY(series);
+
+    REBINT skip = REF(skip) ? VAL_INT32(ARG(skip)) : 1;
+    if (skip <= 0)
+        fail (PAR(skip));
+
+    if (
+        GET_ARRAY_FLAG(a, IS_VARLIST)
+        or GET_ARRAY_FLAG(a, IS_PARAMLIST)
+        or GET_ARRAY_FLAG(a, IS_PAIRLIST)
+    ){
+        fail (PAR(series));  // ->link is used for other things
+    }
+
+    if (
+        GET_ARRAY_FLAG(a, HAS_HASH_INDEX)
+        and HASH_INDEX_SKIP(LINK_HASH_INDEX(a)) == cast(REBLEN, skip)
+    ){
+        RETURN (series);  // index is already there
+    }
+
+    REBLEN records = (ARR_LEN(a) + skip - 1) / skip;
+    REBSER *hashlist = Make_Hash_Sequence(records);
+    HASH_INDEX_SKIP(hashlist) = skip;
+    HASH_INDEX_COUNT(hashlist) = 0;  // hashed on first search
+
+    CLEAR_ARRAY_FLAG(a, HAS_FILE_LINE_UNMASKED);
+    SER(a)->header.bits |= SERIES_FLAG_LINK_NODE_NEEDS_MARK;
+    LINK_HASH_INDEX_NODE(a) = NOD(Manage_Series(hashlist));
+    SET_ARRAY_FLAG(a, HAS_HASH_INDEX);
+
+    RETURN (series);
+}
+
+
 //
 //  blockify: native [
 //
@@ -65,6 +65,120 @@ const uint_fast8_t firstByteMark[7] = {
 };
 
 
+//=//// ASCII RUN SKIPPING ////////////////////////////////////////////////=//
+//
+// Most text that passes through the system is ASCII, and code that checks
+// UTF-8 one byte at a time pays for every one of those bytes.  These skip
+// ahead to the first byte that needs individual attention, testing a block
+// of bytes at a time.  SSE2 is used where the compiler says it's available
+// (it's part of the baseline for x86-64, so no runtime dispatch is needed),
+// otherwise a pointer-sized word is tested at once with plain arithmetic.
+//
+// "Plain" ASCII is what Append_Utf8() and AS TEXT! can copy or count without
+// further checking: it excludes `\0` (illegal in strings) and CR (which has
+// to be considered in light of the Reb_Strmode).
+//
+
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define SKIP_RUNS_SSE2
+#endif
+
+#define WORD_ONES \
+    (~cast(uintptr_t, 0) / 255)  // 0x0101...
+
+#define WORD_HIGHS \
+    (WORD_ONES * 0x80)  // 0x8080...
+
+#define Word_Has_Zero_Byte(w) \
+    (((w) - WORD_ONES) & ~(w) & WORD_HIGHS)
+
+
+//
+//  Skip_Ascii_Run: C
+//
+// Returns the position of the first byte at or after `bp` with its high bit
+// set, or `end` if there isn't one.
+//
+const REBYTE *Skip_Ascii_Run(const REBYTE *bp, const REBYTE *end)
+{
+  #if defined(SKIP_RUNS_SSE2)
+    for (; end - bp >= 16; bp += 16) {
+        __m128i chunk = _mm_loadu_si128(cast(const __m128i*, bp));
+        int mask = _mm_movemask_epi8(chunk);  // gathers the high bits
+        if (mask != 0) {
+            while (not (mask & 1)) {
+                mask >>= 1;
+                ++bp;
+            }
+            return bp;
+        }
+    }
+  #else
+    for (; end - bp >= cast(REBINT, sizeof(uintptr_t)); ) {
+        uintptr_t w;
+        memcpy(&w, bp, sizeof(uintptr_t));  // unaligned-safe, compiles to load
+        if (w & WORD_HIGHS)
+            break;  // let the byte loop find which one
+        bp += sizeof(uintptr_t);
+    }
+  #endif
+
+    for (; bp != end; ++bp)
+        if (*bp >= 0x80)
+            break;
+    return bp;
+}
+
+
+//
+//  Skip_Plain_Ascii_Run: C
+//
+// Like Skip_Ascii_Run(), but also stops at `\0` and CR bytes.
+//
+const REBYTE *Skip_Plain_Ascii_Run(const REBYTE *bp, const REBYTE *end)
+{
+  #if defined(SKIP_RUNS_SSE2)
+    const __m128i zeros = _mm_setzero_si128();
+    const __m128i crs = _mm_set1_epi8(CR);
+    for (; end - bp >= 16; bp += 16) {
+        __m128i chunk = _mm_loadu_si128(cast(const __m128i*, bp));
+        __m128i special = _mm_or_si128(
+            _mm_cmpeq_epi8(chunk, zeros),
+            _mm_cmpeq_epi8(chunk, crs)
+        );
+        int mask = _mm_movemask_epi8(_mm_or_si128(chunk, special));
+        if (mask != 0) {
+            while (not (mask & 1)) {
+                mask >>= 1;
+                ++bp;
+            }
+            return bp;
+        }
+    }
+  #else
+    for (; end - bp >= cast(REBINT, sizeof(uintptr_t)); ) {
+        uintptr_t w;
+        memcpy(&w, bp, sizeof(uintptr_t));
+        if (
+            (w & WORD_HIGHS)
+            or Word_Has_Zero_Byte(w)
+            or Word_Has_Zero_Byte(w ^ (WORD_ONES * CR))
+        ){
+            break;  // let the byte loop find which one
+        }
+        bp += sizeof(uintptr_t);
+    }
+  #endif
+
+    for (; bp != end; ++bp)
+        if (*bp >= 0x80 or *bp == '\0' or *bp == CR)
+            break;
+    return bp;
+}
+
+
 //
 //  CT_Char: C
 //
@@ -175,6 +175,10 @@ REBVAL *Datatype_From_Url(const REBVAL *url) {
             "http://datatypes.rebol.info/vector [2]",
             "http://datatypes.rebol.info/gob [3]",
             "http://datatypes.rebol.info/struct [4]",
+            "http://datatypes.rebol.info/table [5]",
+            "http://datatypes.rebol.info/pmap [6]",
+            "http://datatypes.rebol.info/pvector [7]",
+            "http://datatypes.rebol.info/cache [8]",
             "-1",
         "]",
     rebEND);
@@ -286,11 +290,11 @@ REBARR *Startup_Datatypes(REBARR *boot_types, REBARR *boot_typespecs)
     // in order to translate URL! references to those types.
     //
     // !!! For the purposes of just getting this mechanism off the ground,
-    // this establishes it for just the 4 extension types we currently have.
+    // this establishes it for just the extension types we currently have.
     //
-    REBARR *a = Make_Array(4);
+    REBARR *a = Make_Array(9);
     int i;
-    for (i = 0; i < 5; ++i) {
+    for (i = 0; i < 9; ++i) {
         REBTYP *type = Make_Binary(sizeof(CFUNC*) * IDX_HOOKS_MAX);
         CFUNC** hooks = cast(CFUNC**, BIN_HEAD(type));
 
@@ -305,7 +309,7 @@ REBARR *Startup_Datatypes(REBARR *boot_types, REBARR *boot_typespecs)
         Manage_Series(type);
         Init_Custom_Datatype(Alloc_Tail_Array(a), type);
     }
-    TERM_ARRAY_LEN(a, 5);
+    TERM_ARRAY_LEN(a, 9);
 
     PG_Extension_Types = a;
 
@@ -155,24 +155,46 @@ void MF_Date(REB_MOLD *mo, const REBCEL *v_orig, bool form)
 }
 
 
+// Count days from the proleptic Gregorian date (month 1 to 12) to an epoch
+// of 0000-03-01.  This is closed-form, instead of stepping through months
+// and years: counting years from March puts the leap day last, so each 400
+// year "era" has the same 146097 days and the days before a month in the
+// year come from a linear formula.
 //
-//  Month_Length: C
+// http://howardhinnant.github.io/date_algorithms.html#days_from_civil
 //
-// Given a year, determine the number of days in the month.
-// Handles all leap year calculations.
-//
-static REBLEN Month_Length(REBLEN month, REBLEN year)
+static REBI64 Days_From_Civil(REBINT year, REBINT month, REBINT day)
 {
-    if (month != 1)
-        return Month_Max_Days[month];
-
-    return (
-        ((year % 4) == 0) and  // divisible by four is a leap year
-        (
-            ((year % 100) != 0) or // except when divisible by 100
-            ((year % 400) == 0)  // but not when divisible by 400
-        )
-    ) ? 29 : 28;
+    if (month <= 2)
+        --year;  // January and February count as the end of the prior year
+    REBI64 era = (year >= 0 ? year : year - 399) / 400;
+    REBINT yoe = cast(REBINT, year - era * 400);  // [0, 399]
+    REBINT doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5
+        + day - 1;  // [0, 365]
+    REBINT doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;  // [0, 146096]
+    return era * 146097 + doe;
+}
+
+
+// Inverse of Days_From_Civil(), giving a month of 1 to 12 and day from 1.
+//
+// http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+//
+static void Civil_From_Days(
+    REBINT *year_out,
+    REBINT *month_out,
+    REBINT *day_out,
+    REBI64 days
+){
+    REBI64 era = (days >= 0 ? days : days - 146096) / 146097;
+    REBINT doe = cast(REBINT, days - era * 146097);  // [0, 146096]
+    REBINT yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    REBINT doy = doe - (365 * yoe + yoe / 4 - yoe / 100);  // [0, 365]
+    REBINT mp = (5 * doy + 2) / 153;  // [0, 11], March is 0
+
+    *day_out = doy - (153 * mp + 2) / 5 + 1;
+    *month_out = mp < 10 ? mp + 3 : mp - 9;
+    *year_out = cast(REBINT, yoe + era * 400) + (*month_out <= 2 ? 1 : 0);
 }
 
 
@@ -184,15 +206,10 @@ static REBLEN Month_Length(REBLEN month, REBLEN year)
 //
 REBLEN Julian_Date(REBYMD date)
 {
-    REBLEN days;
-    REBLEN i;
-
-    days = 0;
-
-    for (i = 0; i < cast(REBLEN, date.month - 1); i++)
-        days += Month_Length(i, date.year);
-
-    return date.day + days;
+    return cast(REBLEN,
+        Days_From_Civil(date.year, date.month, date.day)
+            - Days_From_Civil(date.year, 1, 1)
+    ) + 1;
 }
 
 
@@ -207,48 +224,10 @@ REBINT Diff_Date(REBYMD d1, REBYMD d2)
     // This just keeps R3-Alpha behavior going as flaky as it was,
     // and doesn't heed the time zones.
 
-    REBINT sign = 1;
-
-    if (d1.year < d2.year)
-        sign = -1;
-    else if (d1.year == d2.year) {
-        if (d1.month < d2.month)
-            sign = -1;
-        else if (d1.month == d2.month) {
-            if (d1.day < d2.day)
-                sign = -1;
-            else if (d1.day == d2.day)
-                return 0;
-        }
-    }
-
-    if (sign == -1) {
-        REBYMD tmp = d1;
-        d1 = d2;
-        d2 = tmp;
-    }
-
-    // if not same year, calculate days to end of month, year and
-    // days in between years plus days in end year
-    //
-    if (d1.year > d2.year) {
-        REBLEN days = Month_Length(d2.month-1, d2.year) - d2.day;
-
-        REBLEN m;
-        for (m = d2.month; m < 12; m++)
-            days += Month_Length(m, d2.year);
-
-        REBLEN y;
-        for (y = d2.year + 1; y < d1.year; y++) {
-            days += (((y % 4) == 0) and  // divisible by four is a leap year
-                (((y % 100) != 0) or  // except when divisible by 100
-                ((y % 400) == 0)))  // but not when divisible by 400
-                ? 366u : 365u;
-        }
-        return sign * (REBINT)(days + Julian_Date(d1));
-    }
-
-    return sign * (REBINT)(Julian_Date(d1) - Julian_Date(d2));
+    return cast(REBINT,
+        Days_From_Civil(d1.year, d1.month, d1.day)
+            - Days_From_Civil(d2.year, d2.month, d2.day)
+    );
 }
 
 
@@ -312,25 +291,15 @@ static REBYMD Normalize_Date(REBINT day, REBINT month, REBINT year, REBINT tz)
         month %= 12;
     }
 
-    // Now adjust the days by stepping through each month
+    // Now count the days from the first of that month, and convert back
 
     REBINT d;
-    while (day >= (d = cast(REBINT, Month_Length(month, year)))) {
-        day -= d;
-        if (++month >= 12) {
-            month = 0;
-            year++;
-        }
-    }
-    while (day < 0) {
-        if (month == 0) {
-            month = 11;
-            year--;
-        }
-        else
-            month--;
-        day += cast(REBINT, Month_Length(month, year));
-    }
+    REBINT m;
+    REBINT y;
+    Civil_From_Days(&y, &m, &d, Days_From_Civil(year, month + 1, 1) + day);
+    year = y;
+    month = m - 1;
+    day = d - 1;
 
     if (year < 0 or year > MAX_YEAR)
         fail (Error_Type_Limit_Raw(Datatype_From_Kind(REB_DATE)));
@@ -157,7 +157,7 @@ REB_R MAKE_Decimal(
         goto dont_divide_if_percent;
 
     case REB_INTEGER:
-        d = cast(REBDEC, VAL_INT64(arg));
+        d = Integer_To_Decimal(arg);
         goto dont_divide_if_percent;
 
     case REB_MONEY:
@@ -371,6 +371,7 @@ REBTYPE(Decimal)
             or type == REB_TUPLE
             or type == REB_MONEY
             or type == REB_TIME
+            or type == REB_CUSTOM  // e.g. VECTOR!
         ) and (
             sym == SYM_ADD ||
             sym == SYM_MULTIPLY
@@ -407,7 +408,7 @@ REBTYPE(Decimal)
                 type = REB_DECIMAL;
             }
             else {
-                d2 = cast(REBDEC, VAL_INT64(arg));
+                d2 = Integer_To_Decimal(arg);
                 type = REB_DECIMAL;
             }
 
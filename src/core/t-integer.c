@@ -33,6 +33,13 @@
 //
 REBINT CT_Integer(const REBCEL *a, const REBCEL *b, REBINT mode)
 {
+    if (IS_INTEGER_BIG(a) or IS_INTEGER_BIG(b)) {
+        REBINT diff = Big_Compare(a, b);
+        if (mode >= 0) return (diff == 0);
+        if (mode == -1) return (diff >= 0);
+        return (diff > 0);
+    }
+
     if (mode >= 0)  return (VAL_INT64(a) == VAL_INT64(b));
     if (mode == -1) return (VAL_INT64(a) >= VAL_INT64(b));
     return (VAL_INT64(a) > VAL_INT64(b));
@@ -232,7 +239,7 @@ void Value_To_Int64(REBVAL *out, const REBVAL *value, bool no_sign)
         fail (Error_Bad_Make(REB_INTEGER, value));
 
 check_sign:
-    if (no_sign && VAL_INT64(out) < 0)
+    if (no_sign && Big_Is_Negative(out))
         fail (Error_Positive_Raw());
 }
 
@@ -244,19 +251,109 @@ void MF_Integer(REB_MOLD *mo, const REBCEL *v, bool form)
 {
     UNUSED(form);
 
+    if (IS_INTEGER_BIG(v)) {
+        Mold_Big_Integer(mo, v);
+        return;
+    }
+
     REBYTE buf[60];
     REBINT len = Emit_Integer(buf, VAL_INT64(v));
     Append_Ascii_Len(mo->series, s_cast(buf), len);
 }
 
 
+//
+//  T_Big_Integer: C
+//
+// REBTYPE(Integer) when an argument doesn't fit in 64 bits.  Operations that
+// have no meaning for such numbers here (bitwise ones, ROUND, RANDOM...) are
+// overflow errors, as they were when the number couldn't be made at all.
+//
+static REB_R T_Big_Integer(REBFRM *frame_, const REBVAL *verb)
+{
+    REBVAL *val = D_ARG(1);
+    REBSYM sym = VAL_WORD_SYM(verb);
+
+    switch (sym) {
+      case SYM_COPY:
+        RETURN (val);
+
+      case SYM_NEGATE:
+        return Big_Negate(D_OUT, val);
+
+      case SYM_ABSOLUTE:
+        if (Big_Is_Negative(val))
+            return Big_Negate(D_OUT, val);
+        RETURN (val);
+
+      case SYM_EVEN_Q:
+        return Init_Logic(D_OUT, not Big_Is_Odd(val));
+
+      case SYM_ODD_Q:
+        return Init_Logic(D_OUT, Big_Is_Odd(val));
+
+      case SYM_ADD:
+      case SYM_SUBTRACT:
+      case SYM_MULTIPLY:
+      case SYM_DIVIDE:
+      case SYM_REMAINDER:
+      case SYM_POWER: {
+        REBVAL *val2 = D_ARG(2);
+        if (IS_CHAR(val2))
+            Init_Integer(val2, VAL_CHAR(val2));
+        else if (IS_DECIMAL(val2) or IS_PERCENT(val2)) {
+            Init_Decimal(val, Integer_To_Decimal(val));
+            return T_Decimal(frame_, verb);
+        }
+        else if (not IS_INTEGER(val2))
+            fail (Error_Math_Args(REB_INTEGER, verb));
+
+        switch (sym) {
+          case SYM_ADD:
+            return Big_Add(D_OUT, val, val2, false);
+
+          case SYM_SUBTRACT:
+            return Big_Add(D_OUT, val, val2, true);
+
+          case SYM_MULTIPLY:
+            return Big_Multiply(D_OUT, val, val2);
+
+          case SYM_REMAINDER:
+            Big_Divide(nullptr, D_OUT, val, val2);
+            return D_OUT;
+
+          case SYM_DIVIDE: {  // exact quotients stay integers, as usual
+            DECLARE_LOCAL (remainder);
+            Big_Divide(D_OUT, remainder, val, val2);
+            if (not IS_INTEGER_BIG(remainder) and VAL_INT64(remainder) == 0)
+                return D_OUT;
+            break; }
+
+          default:
+            break;
+        }
+
+        Init_Decimal(val, Integer_To_Decimal(val));  // DIVIDE, POWER
+        Init_Decimal(val2, Integer_To_Decimal(val2));
+        return T_Decimal(frame_, verb); }
+
+      default:
+        break;
+    }
+
+    fail (Error_Overflow_Raw());
+}
+
+
 //
 //  REBTYPE: C
 //
+// The arithmetic is done on 64-bit numbers, and only if that overflows (or
+// an argument is already too big for 64 bits) is %f-bigint.c used.
+//
 REBTYPE(Integer)
 {
     REBVAL *val = D_ARG(1);
-    REBI64 num = VAL_INT64(val);
 
     REBI64 arg;
 
@@ -265,7 +362,7 @@ REBTYPE(Integer)
     // !!! This used to rely on IS_BINARY_ACT, which is no longer available
     // in the symbol based dispatch.  Consider doing another way.
     //
-    if (
+    bool binary = (
         sym == SYM_ADD
         or sym == SYM_SUBTRACT
         or sym == SYM_MULTIPLY
@@ -275,13 +372,26 @@ REBTYPE(Integer)
         or sym == SYM_UNION
         or sym == SYM_DIFFERENCE
         or sym == SYM_REMAINDER
+    );
+
+    if (
+        IS_INTEGER_BIG(val)
+        or (binary and IS_INTEGER(D_ARG(2)) and IS_INTEGER_BIG(D_ARG(2)))
     ){
+        return T_Big_Integer(frame_, verb);
+    }
+
+    REBI64 num = VAL_INT64(val);
+
+    if (binary) {
         REBVAL *val2 = D_ARG(2);
 
         if (IS_INTEGER(val2))
             arg = VAL_INT64(val2);
-        else if (IS_CHAR(val2))
+        else if (IS_CHAR(val2)) {
             arg = VAL_CHAR(val2);
+            Init_Integer(val2, arg);  // in case overflow needs it as integer
+        }
         else {
             // Decimal or other numeric second argument:
             REBLEN n = 0; // use to flag special case
@@ -337,26 +447,26 @@ REBTYPE(Integer)
     case SYM_ADD: {
         REBI64 anum;
         if (REB_I64_ADD_OF(num, arg, &anum))
-            fail (Error_Overflow_Raw());
+            return Big_Add(D_OUT, val, D_ARG(2), false);
         return Init_Integer(D_OUT, anum); }
 
     case SYM_SUBTRACT: {
         REBI64 anum;
         if (REB_I64_SUB_OF(num, arg, &anum))
-            fail (Error_Overflow_Raw());
+            return Big_Add(D_OUT, val, D_ARG(2), true);
         return Init_Integer(D_OUT, anum); }
 
     case SYM_MULTIPLY: {
         REBI64 p;
         if (REB_I64_MUL_OF(num, arg, &p))
-            fail (Error_Overflow_Raw());
+            return Big_Multiply(D_OUT, val, D_ARG(2));
         return Init_Integer(D_OUT, p); }
 
     case SYM_DIVIDE:
         if (arg == 0)
             fail (Error_Zero_Divide_Raw());
         if (num == INT64_MIN && arg == -1)
-            fail (Error_Overflow_Raw());
+            return Big_Negate(D_OUT, val);
         if (num % arg == 0)
             return Init_Integer(D_OUT, num / arg);
         // Fall thru
@@ -381,7 +491,7 @@ REBTYPE(Integer)
 
     case SYM_NEGATE:
         if (num == INT64_MIN)
-            fail (Error_Overflow_Raw());
+            return Big_Negate(D_OUT, val);
         return Init_Integer(D_OUT, -num);
 
     case SYM_COMPLEMENT:
@@ -389,7 +499,7 @@ REBTYPE(Integer)
 
     case SYM_ABSOLUTE:
         if (num == INT64_MIN)
-            fail (Error_Overflow_Raw());
+            return Big_Negate(D_OUT, val);
         return Init_Integer(D_OUT, num < 0 ? -num : num);
 
     case SYM_EVEN_Q:
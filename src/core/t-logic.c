@@ -147,6 +147,7 @@ REBNATIVE(not_q)
 //
 //  "Returns the logic complement, considering voids to be false."
 //
+//      <pure>
 //      return: [logic!]
 //          "Only LOGIC!'s FALSE, BLANK!, and void for cell return TRUE"
 //      optional [<opt> any-value!]
@@ -65,18 +65,98 @@ static REBCTX *Error_Conflicting_Key(const RELVAL *key, REBSPC *specifier)
 }
 
 
+//
+//  Shift_In_Hash_Slot: C
+//
+// Put a key's hash and index at `slot`, moving the run of keys that starts
+// there (up to the next empty slot) one slot later.  Every moved key gets
+// one step farther from its home, so their relative order--and the Robin
+// Hood ordering of the table--is kept.  The table always has empty slots,
+// because it is grown before it gets more than half full.
+//
+static void Shift_In_Hash_Slot(
+    REBSER *hashlist,
+    REBLEN slot,
+    uint32_t hash,
+    uint32_t index
+){
+    REBLEN mask = SER_LEN(hashlist) - 1;
+    struct Reb_Hash_Slot *slots = SER_HEAD(struct Reb_Hash_Slot, hashlist);
+
+    REBLEN empty = slot;
+    while (slots[empty].index != 0)
+        empty = (empty + 1) & mask;
+
+    for (; empty != slot; empty = (empty - 1) & mask)
+        slots[empty] = slots[(empty - 1) & mask];
+
+    slots[slot].index = index;
+    slots[slot].hash = hash;
+}
+
+
+//
+//  Remove_Hash_Slot: C
+//
+// Empty a slot by moving the keys after it back one step, until reaching an
+// empty slot or a key that is already in its home slot.  This "backward
+// shift" leaves the table as if the key had never been inserted, so there
+// are no tombstones for lookups to skip over.
+//
+void Remove_Hash_Slot(REBSER *hashlist, REBLEN slot)
+{
+    REBLEN mask = SER_LEN(hashlist) - 1;
+    struct Reb_Hash_Slot *slots = SER_HEAD(struct Reb_Hash_Slot, hashlist);
+
+    REBLEN next = (slot + 1) & mask;
+    while (
+        slots[next].index != 0
+        and Hash_Slot_Distance(slots, next, mask) != 0
+    ){
+        slots[slot] = slots[next];
+        slot = next;
+        next = (next + 1) & mask;
+    }
+
+    slots[slot].index = 0;
+    slots[slot].hash = 0;
+}
+
+
+//
+//  Insert_Hash_Slot: C
+//
+// Add an index to a hashlist without checking for keys that are equal to
+// it (the caller knows there aren't any, or wants duplicates to be kept).
+//
+void Insert_Hash_Slot(REBSER *hashlist, uint32_t hash, REBLEN index)
+{
+    REBLEN mask = SER_LEN(hashlist) - 1;
+    struct Reb_Hash_Slot *slots = SER_HEAD(struct Reb_Hash_Slot, hashlist);
+
+    REBLEN slot = hash & mask;
+    REBLEN dist = 0;
+    for (; slots[slot].index != 0; slot = (slot + 1) & mask, ++dist) {
+        if (Hash_Slot_Distance(slots, slot, mask) < dist)
+            break;  // first slot the new key may take by Robin Hood rules
+    }
+    Shift_In_Hash_Slot(hashlist, slot, hash, index);
+}
+
+
 //
 //  Find_Key_Hashed: C
 //
-// Returns hash index (either the match or the new one).
-// A return of zero is valid (as a hash index);
+// Returns hash slot of the key, or -1 if it is not found (modes 1 and 2).
+// A return of zero is valid (as a hash slot).
 //
 // Wide: width of record (normally 2, a key and a value).
 //
 // Modes:
-//     0 - search, return hash if found or not
-//     1 - search, return hash, else return -1 if not
-//     2 - search, return hash, else append value and return -1
+//     0 - search, return slot if found, else make an empty slot for the key
+//         and return that (the caller must store the key's index into it)
+//     1 - search, return slot, else return -1 if not
+//     2 - search, return slot, else append value and return -1
 //
 REBINT Find_Key_Hashed(
     REBARR *array,
@@ -87,28 +167,23 @@ REBINT Find_Key_Hashed(
     bool cased,
     REBYTE mode
 ){
-    // Hashlists store a indexes into the actual data array, of where the
-    // first key corresponding to that hash is.  There may be more keys
-    // indicated by that hash, vying for the same slot.  So the collisions
-    // add a skip amount and keep trying:
+    // Hashlists store the indexes into the actual data array of the keys,
+    // probed linearly from the slot picked by the low bits of the hash:
     //
     // https://en.wikipedia.org/wiki/Linear_probing
     //
-    // Len and skip are co-primes, so is guaranteed that repeatedly
-    // adding skip (and subtracting len when needed) all positions are
-    // visited.  1 <= skip < len, and len is prime, so this is guaranteed.
+    // Each key is kept no farther from its home slot than any key it passed
+    // over when it was inserted ("Robin Hood" hashing).  So if the search
+    // gets to a key closer to home than the probe is, the key isn't here.
     //
     REBLEN len = SER_LEN(hashlist);
-    REBLEN *indexes = SER_HEAD(REBLEN, hashlist);
+    assert(len != 0 and (len & (len - 1)) == 0);  // power of 2
+    REBLEN mask = len - 1;
+    struct Reb_Hash_Slot *slots = SER_HEAD(struct Reb_Hash_Slot, hashlist);
 
     uint32_t hash = Hash_Value(key);
-    REBLEN slot = hash % len; // first slot to try for this hash
-    REBLEN skip = hash % (len - 1) + 1; // how much to skip by each collision
-
-    // Zombie slots are those which are left behind by removing items, with
-    // void values that are illegal in maps, and indicate they can be reused.
-    //
-    REBINT zombie_slot = -1; // no zombies seen yet...
+    REBLEN slot = hash & mask;  // first slot to try for this hash
+    REBLEN dist = 0;  // how far `slot` is from the first slot
 
     // You can store information case-insensitively in a MAP!, and it will
     // overwrite the value for at most one other key.  Reading information
@@ -117,9 +192,17 @@ REBINT Find_Key_Hashed(
     //
     REBINT synonym_slot = -1; // no synonyms seen yet...
 
-    REBLEN n;
-    while ((n = indexes[slot]) != 0) {
-        RELVAL *k = ARR_AT(array, (n - 1) * wide); // stored key
+    for (; slots[slot].index != 0; slot = (slot + 1) & mask, ++dist) {
+        if (Hash_Slot_Distance(slots, slot, mask) < dist)
+            break;  // key would have displaced this one if it were here
+
+        // Keys that compare equal even caselessly have the same hash, so
+        // a differing hash rules out any match.
+        //
+        if (slots[slot].hash != hash)
+            continue;
+
+        RELVAL *k = ARR_AT(array, (slots[slot].index - 1) * wide);
         if (0 == Cmp_Value(k, key, true)) { // exact match
             if (cased)
                 return slot; // don't need to check synonyms, stop looking
@@ -136,13 +219,6 @@ REBINT Find_Key_Hashed(
                 synonym_slot = slot; // save and continue checking
             }
         }
-
-        if (wide > 1 && IS_NULLED(k + 1) && zombie_slot == -1)
-            zombie_slot = slot;
-
-        slot += skip;
-        if (slot >= len)
-            slot -= len;
     }
 
     if (synonym_slot != -1) {
@@ -150,33 +226,32 @@ REBINT Find_Key_Hashed(
         return synonym_slot; // there weren't other spellings of the same key
     }
 
-    if (zombie_slot != -1) { // zombie encountered; overwrite with new key
-        assert(mode == 0);
-        slot = zombie_slot;
-        Derelativize(
-            ARR_AT(array, (indexes[slot] - 1) * wide),
-            key,
-            specifier
-        );
+    if (mode == 1)
+        return -1;
+
+    if (mode == 0) {  // leave an empty index for the caller to fill in
+        Shift_In_Hash_Slot(hashlist, slot, hash, 0);
+        return slot;
     }
 
-    if (mode > 1) { // append new value to the target series
-        const RELVAL *src = key;
-        indexes[slot] = (ARR_LEN(array) / wide) + 1;
+    // append new value to the target series
+    //
+    Shift_In_Hash_Slot(hashlist, slot, hash, (ARR_LEN(array) / wide) + 1);
 
-        REBLEN index;
-        for (index = 0; index < wide; ++src, ++index)
-            Append_Value_Core(array, src, specifier);
-    }
+    const RELVAL *src = key;
+    REBLEN index;
+    for (index = 0; index < wide; ++src, ++index)
+        Append_Value_Core(array, src, specifier);
 
-    return (mode > 0) ? -1 : cast(REBINT, slot);
+    return -1;
 }
 
 
 //
 //  Rehash_Map: C
 //
-// Recompute the entire hash table for a map. Table must be large enough.
+// Drop the zombie pairs from a map and recompute its entire hash table.
+// Table must be large enough.
 //
 static void Rehash_Map(REBMAP *map)
 {
@@ -184,61 +259,62 @@ static void Rehash_Map(REBMAP *map)
 
     if (!hashlist) return;
 
-    REBLEN *hashes = SER_HEAD(REBLEN, hashlist);
     REBARR *pairlist = MAP_PAIRLIST(map);
 
-    REBVAL *key = KNOWN(ARR_HEAD(pairlist));
-    REBLEN n;
-
-    for (n = 0; n < ARR_LEN(pairlist); n += 2, key += 2) {
-        const bool cased = true; // cased=true is always fine
-
-        if (IS_NULLED(key + 1)) {
-            //
-            // It's a "zombie", move last key to overwrite it
-            //
-            Move_Value(
-                key, KNOWN(ARR_AT(pairlist, ARR_LEN(pairlist) - 2))
-            );
-            Move_Value(
-                &key[1], KNOWN(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))
-            );
-            SET_ARRAY_LEN_NOTERM(pairlist, ARR_LEN(pairlist) - 2);
+    // Squeeze out the pairs whose values were removed, keeping the order of
+    // the rest (so MOLD and WORDS OF don't shuffle after a removal).
+    //
+    REBVAL *src = KNOWN(ARR_HEAD(pairlist));
+    REBVAL *dest = src;
+    for (; NOT_END(src); src += 2) {
+        if (IS_NULLED(src + 1))
+            continue;  // "zombie"
+
+        if (dest != src) {
+            Move_Value(dest, src);
+            Move_Value(dest + 1, src + 1);
         }
+        dest += 2;
+    }
+    TERM_ARRAY_LEN(pairlist, cast(RELVAL*, dest) - ARR_HEAD(pairlist));
 
-        REBLEN hash = Find_Key_Hashed(
-            pairlist, hashlist, key, SPECIFIED, 2, cased, 0
-        );
-        hashes[hash] = n / 2 + 1;
+    Clear_Series(hashlist);
 
-        // discard zombies at end of pairlist
-        //
-        while (IS_NULLED(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))) {
-            SET_ARRAY_LEN_NOTERM(pairlist, ARR_LEN(pairlist) - 2);
-        }
-    }
+    // Keys in a map are all distinct, so they can go in without comparing
+    // them to each other.
+    //
+    REBVAL *key = KNOWN(ARR_HEAD(pairlist));
+    REBLEN index = 1;
+    for (; NOT_END(key); key += 2, ++index)
+        Insert_Hash_Slot(hashlist, Hash_Value(key), index);
 }
 
 
 //
 //  Expand_Hash: C
 //
-// Expand hash series. Clear it but set its tail.
+// Expand hash series to twice its size. Clear it but set its tail.
 //
 void Expand_Hash(REBSER *ser)
 {
     assert(not IS_SER_ARRAY(ser));
 
-    REBINT prime = Get_Hash_Prime_May_Fail(SER_LEN(ser) + 1);
+    REBLEN len = SER_LEN(ser);
+    if (len > MAX_HASH_SLOTS / 2) {
+        DECLARE_LOCAL (temp);
+        Init_Integer(temp, len * 2);
+        fail (Error_Size_Limit_Raw(temp));
+    }
+
     Remake_Series(
         ser,
-        prime + 1,
+        len * 2 + 1,
         SER_WIDE(ser),
         SERIES_FLAG_POWER_OF_2  // not(NODE_FLAG_NODE) => don't keep data
     );
 
     Clear_Series(ser);
-    SET_SERIES_LEN(ser, prime);
+    SET_SERIES_LEN(ser, len * 2);
 }
 
 
@@ -246,7 +322,8 @@ void Expand_Hash(REBSER *ser)
 //  Find_Map_Entry: C
 //
 // Try to find the entry in the map. If not found and val isn't void, create
-// the entry and store the key and val.
+// the entry and store the key and val.  If val is void and the entry is
+// found, the entry is removed.
 //
 // RETURNS: the index to the VALUE or zero if there is none.
 //
@@ -265,25 +342,27 @@ REBLEN Find_Map_Entry(
 
     assert(hashlist);
 
-    // Get hash table, expand it if needed:
-    if (ARR_LEN(pairlist) > SER_LEN(hashlist) / 2) {
-        Expand_Hash(hashlist); // modifies size value
-        Rehash_Map(map);
-    }
-
     const REBLEN wide = 2;
-    const REBYTE mode = 0; // just search for key, don't add it
-    REBLEN slot = Find_Key_Hashed(
-        pairlist, hashlist, key, key_specifier, wide, cased, mode
-    );
 
-    REBLEN *indexes = SER_HEAD(REBLEN, hashlist);
-    REBLEN n = indexes[slot];
+    if (val == NULL or IS_NULLED(val)) {  // fetching, or removing
+        const REBYTE mode = 1;  // just search for key, don't add it
+        REBINT slot = Find_Key_Hashed(
+            pairlist, hashlist, key, key_specifier, wide, cased, mode
+        );
+        if (slot == -1)
+            return 0;
 
-    // n==0 or pairlist[(n-1)*]=~key
+        REBLEN n = SER_HEAD(struct Reb_Hash_Slot, hashlist)[slot].index;
+        if (val == NULL)
+            return n; // was just fetching the value
 
-    if (val == NULL)
-        return n; // was just fetching the value
+        // The pair is left in the pairlist as a "zombie" (until the next
+        // Rehash_Map()), but it's taken out of the hash table now.
+        //
+        Derelativize(ARR_AT(pairlist, ((n - 1) * 2) + 1), val, val_specifier);
+        Remove_Hash_Slot(hashlist, slot);
+        return n;
+    }
 
     // If not just a GET, it may try to set the value in the map.  Which means
     // the key may need to be stored.  Since copies of keys are never made,
@@ -293,7 +372,25 @@ REBLEN Find_Map_Entry(
     REBSER *locker = SER(MAP_PAIRLIST(map));
     Ensure_Value_Frozen(key, locker);
 
-    // Must set the value:
+    // Keep the table at most half full.  If that limit is reached but most
+    // of the pairs are zombies, squeezing them out makes enough room.
+    //
+    if (ARR_LEN(pairlist) / 2 + 1 > SER_LEN(hashlist) / 2) {
+        if (Length_Map(map) + 1 > SER_LEN(hashlist) / 4)
+            Expand_Hash(hashlist); // modifies size value
+        Rehash_Map(map);
+    }
+
+    const REBYTE mode = 0;  // make a slot for the key if not found
+    REBINT slot = Find_Key_Hashed(
+        pairlist, hashlist, key, key_specifier, wide, cased, mode
+    );
+
+    struct Reb_Hash_Slot *slots = SER_HEAD(struct Reb_Hash_Slot, hashlist);
+    REBLEN n = slots[slot].index;
+
+    // n==0 or pairlist[(n-1)*]=~key
+
     if (n) {  // re-set it:
         Derelativize(
             ARR_AT(pairlist, ((n - 1) * 2) + 1),
@@ -303,15 +400,13 @@ REBLEN Find_Map_Entry(
         return n;
     }
 
-    if (IS_NULLED(val)) return 0; // trying to remove non-existing key
-
     // Create new entry.  Note that it does not copy underlying series (e.g.
     // the data of a string), which is why the immutability test is necessary
     //
     Append_Value_Core(pairlist, key, key_specifier);
     Append_Value_Core(pairlist, val, val_specifier);
 
-    return (indexes[slot] = (ARR_LEN(pairlist) / 2));
+    return (slots[slot].index = (ARR_LEN(pairlist) / 2));
 }
 
 
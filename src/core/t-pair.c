@@ -141,17 +141,17 @@ REBINT Cmp_Pair(const REBCEL *t1, const REBCEL *t2)
 //
 void Min_Max_Pair(REBVAL *out, const REBVAL *a, const REBVAL *b, bool maxed)
 {
-    const REBVAL* x;
+    DECLARE_LOCAL (x);
     if (VAL_PAIR_X_DEC(a) > VAL_PAIR_X_DEC(b))
-        x = maxed ? VAL_PAIR_X(a) : VAL_PAIR_X(b);
+        Get_Pair_X(x, maxed ? a : b);
     else
-        x = maxed ? VAL_PAIR_X(b) : VAL_PAIR_X(a);
+        Get_Pair_X(x, maxed ? b : a);
 
-    const REBVAL* y;
+    DECLARE_LOCAL (y);
     if (VAL_PAIR_Y_DEC(a) > VAL_PAIR_Y_DEC(b))
-        y = maxed ? VAL_PAIR_Y(a) : VAL_PAIR_Y(b);
+        Get_Pair_Y(y, maxed ? a : b);
     else
-        y = maxed ? VAL_PAIR_Y(b) : VAL_PAIR_Y(a);
+        Get_Pair_Y(y, maxed ? b : a);
 
     Init_Pair(out, x, y);
 }
@@ -184,37 +184,33 @@ REB_R PD_Pair(
         return R_UNHANDLED;
 
     if (not opt_setval) {
+        DECLARE_LOCAL (temp);
         if (n == 1)
-            Move_Value(pvs->out, VAL_PAIR_X(pvs->out));
+            Get_Pair_X(temp, pvs->out);
         else
-            Move_Value(pvs->out, VAL_PAIR_Y(pvs->out));
-        return pvs->out;
+            Get_Pair_Y(temp, pvs->out);
+        return Move_Value(pvs->out, temp);
     }
 
-    // !!! PAIR! is now generic, so it could theoretically store any type.
-    // This was done to avoid creating new numeric representations in the
-    // core (e.g. 32-bit integers or lower precision floats) just so they
-    // could both fit in a cell.  But while it's technically possible, no
-    // rendering formats for other-valued pairs has been proposed.  So only
-    // integers and decimals are accepted for now.
+    // PAIR! holds full INTEGER!s and DECIMAL!s, vs. new numeric
+    // representations (e.g. 32-bit integers or lower precision floats) that
+    // would let two of them fit in a cell on 32-bit platforms.  But since
+    // the X and Y are stored as those numbers, nothing else can be put in.
     //
     if (not IS_INTEGER(opt_setval) and not IS_DECIMAL(opt_setval))
         return R_UNHANDLED;
 
-    if (n == 1)
-        Move_Value(VAL_PAIR_X(pvs->out), opt_setval);
-    else
-        Move_Value(VAL_PAIR_Y(pvs->out), opt_setval);
+    DECLARE_LOCAL (x);
+    DECLARE_LOCAL (y);
+    Get_Pair_X(x, pvs->out);
+    Get_Pair_Y(y, pvs->out);
+    Move_Value(n == 1 ? x : y, opt_setval);
+    Init_Pair(pvs->out, x, y);
 
     // Using R_IMMEDIATE means that although we've updated pvs->out, we'll
     // leave it to the path dispatch to figure out if that can be written back
     // to some variable from which this pair actually originated.
     //
-    // !!! Technically since pairs are pairings of values in Ren-C, there is
-    // a series node which can be used to update their values, but could not
-    // be used to update other things (like header bits) from an originating
-    // variable.
-    //
     return R_IMMEDIATE;
 }
 
@@ -224,11 +220,13 @@ REB_R PD_Pair(
 //
 void MF_Pair(REB_MOLD *mo, const REBCEL *v, bool form)
 {
-    Mold_Or_Form_Value(mo, VAL_PAIR_X(v), form);
+    DECLARE_LOCAL (temp);
+
+    Mold_Or_Form_Value(mo, Get_Pair_X(temp, v), form);
 
     Append_Codepoint(mo->series, 'x');
 
-    Mold_Or_Form_Value(mo, VAL_PAIR_Y(v), form);
+    Mold_Or_Form_Value(mo, Get_Pair_Y(temp, v), form);
 }
 
 
@@ -239,8 +237,8 @@ void MF_Pair(REB_MOLD *mo, const REBCEL *v, bool form)
 // they had floating point precision (otherwise you couldn't fit a full cell
 // for two values into a single cell).  This meant they were neither INTEGER!
 // nor DECIMAL!.  Ren-C stepped away from this idea of introducing a new
-// numeric type and instead created a more compact "pairing" that could fit
-// in a single series node and hold two arbitrary values.
+// numeric type, and a pair holds two full INTEGER!s or DECIMAL!s (in the
+// cell itself on 64-bit platforms, see %sys-pair.h).
 //
 // With the exception of operations that are specifically pair-aware (e.g.
 // REVERSE swapping X and Y), this chains to retrigger the action onto the
@@ -251,23 +249,27 @@ REBTYPE(Pair)
 {
     REBVAL *v = D_ARG(1);
 
-    REBVAL *x1 = VAL_PAIR_X(v);
-    REBVAL *y1 = VAL_PAIR_Y(v);
+    DECLARE_LOCAL (x1);
+    DECLARE_LOCAL (y1);
+    Get_Pair_X(x1, v);
+    Get_Pair_Y(y1, v);
 
+    DECLARE_LOCAL (x2_cell);
+    DECLARE_LOCAL (y2_cell);
     REBVAL *x2 = nullptr;
     REBVAL *y2 = nullptr;
 
     switch (VAL_WORD_SYM(verb)) {
       case SYM_REVERSE:
-        return Init_Pair(D_OUT, VAL_PAIR_Y(v), VAL_PAIR_X(v));
+        return Init_Pair(D_OUT, y1, x1);
 
       case SYM_ADD:
       case SYM_SUBTRACT:
       case SYM_DIVIDE:
       case SYM_MULTIPLY:
         if (IS_PAIR(D_ARG(2))) {
-            x2 = VAL_PAIR_X(D_ARG(2));
-            y2 = VAL_PAIR_Y(D_ARG(2));
+            x2 = Get_Pair_X(x2_cell, D_ARG(2));
+            y2 = Get_Pair_Y(y2_cell, D_ARG(2));
         }
         break;  // delegate to pairwise operation
 
@@ -83,7 +83,7 @@ static void swap_chars(REBVAL *val1, REBVAL *val2)
 
 static void reverse_binary(REBVAL *v, REBLEN len)
 {
-    REBYTE *bp = VAL_BIN_AT(v);
+    REBYTE *bp = VAL_RAW_DATA_AT(v);  // only called for all-ASCII strings
 
     REBLEN n = 0;
     REBLEN m = len - 1;
@@ -174,11 +174,7 @@ REBLEN find_string(
     assert(end >= index);
 
     if (ANY_STRING(pattern)) {
-        bool str_is_all_ascii = false;
-        bool pattern_is_all_ascii = false;
-        if (str_is_all_ascii and not pattern_is_all_ascii)
-            return NOT_FOUND; // can't possibly find non-ascii in ascii
-
+        //
         // !!! A TAG! does not have its delimiters in it.  The logic of the
         // find would have to be rewritten to accomodate this, and it's a
         // bit tricky as it is.  Let it settle down before trying that--and
@@ -199,42 +195,19 @@ REBLEN find_string(
             size2 = VAL_SIZE_LIMIT_AT(NULL, pattern, *len);
         }
 
-        REBLEN result;
+        bool uncase = not (flags & AM_FIND_CASE);
 
+        REBLEN result;
         if (
-            str_is_all_ascii
-            and skip == 1  // optimizations not written for skips
+            skip != 1  // byte search only goes forward one unit at a time
+            or *len == 0
+            or (uncase and not (  // LO_CASE() on bytes only good for ASCII
+                Is_Definitely_Ascii(str)
+                and Is_Definitely_Ascii(formed ? formed : VAL_STRING(pattern))
+            ))
         ){
-            if (*len > end - index)  // series not long enough for pattern
-                return NOT_FOUND;
-
-            assert(pattern_is_all_ascii);  // checked above
-
-            // If one knew that the series being searched in was all ASCII,
-            // then the same search code can be used as for binary...because
-            // the binary offset can be used as a character position.
-
-            if (flags & AM_FIND_CASE)
-                result = Find_Bin_In_Bin(
-                    SER(str),  // all_ascii can be treated same as binary
-                    index,
-                    bp2,
-                    size2,
-                    flags & AM_FIND_MATCH
-                );
-            else
-                return Find_Str_In_Bin(
-                    SER(str),  // all_ascii can be treated same as binary
-                    index,
-                    bp2,
-                    *len,
-                    size2,
-                    flags & AM_FIND_MATCH
-                );
-        }
-        else
             result = Find_Str_In_Str(
-                str,  // not all_ascii, has multibyte utf-8 sequences
+                str,
                 index,
                 end,
                 skip,
@@ -243,6 +216,40 @@ REBLEN find_string(
                 *len,
                 flags & (AM_FIND_MATCH | AM_FIND_CASE)
             );
+        }
+        else if (index == end)
+            result = NOT_FOUND;  // matches must start before the /PART limit
+        else {
+            // Valid UTF-8 can only match valid UTF-8 at codepoint boundaries,
+            // so a cased search (or a caseless one in ASCII) can be done on
+            // the bytes.  As with Find_Str_In_Str(), the match has to start
+            // before `end` but is allowed to run past it.
+            //
+            REBYTE *head = STR_HEAD(str);
+            REBYTE *start = cast(REBYTE*, STR_AT(str, index));
+            REBYTE *limit = cast(REBYTE*, STR_AT(str, end));
+            REBSIZ span = MIN(
+                cast(REBSIZ, head + STR_SIZE(str) - start),
+                cast(REBSIZ, limit - start) + (size2 - 1)
+            );
+
+            const REBYTE *found;
+            if (flags & AM_FIND_MATCH)
+                found = Find_Bytes(start, MIN(span, size2), bp2, size2, uncase);
+            else
+                found = Find_Bytes(start, span, bp2, size2, uncase);
+
+            if (not found)
+                result = NOT_FOUND;
+            else if (Is_Definitely_Ascii(str))
+                result = found - head;
+            else {
+                result = index;
+                for (; start != found; ++start)
+                    if (not Is_Continuation_Byte_If_Utf8(*start))
+                        ++result;
+            }
+        }
 
         if (formed)
             Free_Unmanaged_Series(SER(formed));
@@ -792,9 +799,21 @@ void Mold_Uni_Char(REB_MOLD *mo, REBUNI c, bool parened)
 }
 
 
+// Printable ASCII that molds as itself in both "..." and {...} forms.  A
+// quote only shows up in {...} (where it is literal), while ^ is always
+// escaped and braces may need escaping in {...}, so those take the slow path.
+//
+inline static bool Is_Mold_Plain_Byte(REBYTE b) {
+    return b >= 0x20 and b < 0x7F and b != '^' and b != '{' and b != '}';
+}
+
+
 //
 //  Mold_Text_Series_At: C
 //
+// Runs of plain bytes (see Is_Mold_Plain_Byte()) are appended in bulk, so
+// only the exceptional characters are decoded and molded one at a time.
+//
 void Mold_Text_Series_At(REB_MOLD *mo, REBSTR *s, REBLEN index) {
     REBSTR *buf = mo->series;
 
@@ -807,25 +826,22 @@ void Mold_Text_Series_At(REB_MOLD *mo, REBSTR *s, REBLEN index) {
 
     bool parened = GET_MOLD_FLAG(mo, MOLD_FLAG_NON_ANSI_PARENED);
 
-    // Scan to find out what special chars the string contains?
+    const REBYTE *head = cast(const REBYTE*, STR_AT(s, index));
+    const REBYTE *tail = cast(const REBYTE*, STR_TAIL(s));
+
+    // Scan to find out what special chars the string contains.  Only ASCII
+    // matters here, and UTF-8 continuation bytes can't be mistaken for it,
+    // so there's no need to decode.
 
-    REBLEN escape = 0;      // escaped chars
     REBLEN brace_in = 0;    // {
     REBLEN brace_out = 0;   // }
     REBLEN newline = 0;     // lf
     REBLEN quote = 0;       // "
-    REBLEN paren = 0;       // (1234)
-    REBLEN chr1e = 0;
     REBLEN malign = 0;
 
-    REBCHR(const*) up = STR_AT(s, index);
-
-    REBLEN x;
-    for (x = index; x < len; x++) {
-        REBUNI c;
-        up = NEXT_CHR(&c, up);
-
-        switch (c) {
+    const REBYTE *bp;
+    for (bp = head; bp != tail; ++bp) {
+        switch (*bp) {
           case '{':
             brace_in++;
             break;
@@ -845,53 +861,41 @@ void Mold_Text_Series_At(REB_MOLD *mo, REBSTR *s, REBLEN index) {
             break;
 
           default:
-            if (c == 0x1e)
-                chr1e += 4; // special case of ^(1e)
-            else if (IS_CHR_ESC(c))
-                escape++;
-            else if (c >= 0x1000)
-                paren += 6; // ^(1234)
-            else if (c >= 0x100)
-                paren += 5; // ^(123)
-            else if (c >= 0x80)
-                paren += 4; // ^(12)
+            break;
         }
     }
 
     if (brace_in != brace_out)
         malign++;
 
-    if (NOT_MOLD_FLAG(mo, MOLD_FLAG_NON_ANSI_PARENED))
-        paren = 0;
-
-    up = STR_AT(s, index);
-
-    // If it is a short quoted string, emit it as "string"
+    // A short string without quotes is emitted as "string", else {string}.
     //
-    if (len <= MAX_QUOTED_STR and quote == 0 and newline < 3) {
-        Append_Codepoint(buf, '"');
+    bool braced = not (len <= MAX_QUOTED_STR and quote == 0 and newline < 3);
 
-        REBLEN n;
-        for (n = index; n < STR_LEN(s); n++) {
-            REBUNI c;
-            up = NEXT_CHR(&c, up);
-            Mold_Uni_Char(mo, c, parened);
-        }
+    Append_Codepoint(buf, braced ? '{' : '"');
 
-        Append_Codepoint(buf, '"');
-        return;
-    }
-
-    // It is a braced string, emit it as {string}:
-    if (malign == 0)
-        brace_in = brace_out = 0;
+    bp = head;
+    while (true) {
+        const REBYTE *run = bp;
+        while (bp != tail and Is_Mold_Plain_Byte(*bp))
+            ++bp;
+        if (bp != run)
+            Append_Ascii_Len(buf, cs_cast(run), bp - run);
 
-    Append_Codepoint(buf, '{');
+        if (bp == tail)
+            break;
 
-    REBLEN n;
-    for (n = index; n < STR_LEN(s); n++) {
         REBUNI c;
-        up = NEXT_CHR(&c, up);
+        if (*bp < 0x80)
+            c = *bp;
+        else
+            bp = Back_Scan_UTF8_Char_Unchecked(&c, bp);
+        ++bp;
+
+        if (not braced) {
+            Mold_Uni_Char(mo, c, parened);
+            continue;
+        }
 
         switch (c) {
           case '{':
@@ -911,7 +915,7 @@ void Mold_Text_Series_At(REB_MOLD *mo, REBSTR *s, REBLEN index) {
         }
     }
 
-    Append_Codepoint(buf, '}');
+    Append_Codepoint(buf, braced ? '}' : '"');
 }
 
 
@@ -1071,8 +1075,8 @@ REBTYPE(String)
         REBSIZ size_old = STR_SIZE(s);
 
         Remove_Series_Units(SER(s), offset, size);  // should keep terminator
-        Free_Bookmarks_Maybe_Null(s);
         SET_STR_LEN_SIZE(s, tail - len, size_old - size);  // no term needed
+        Adjust_Bookmarks(s, index, offset, len, size, 0, 0);
 
         RETURN (v); }
 
@@ -1329,6 +1333,8 @@ REBTYPE(String)
 
         if (REF(all))
             fail (Error_Bad_Refine_Raw(ARG(all)));
+        if (REF(key))
+            fail (Error_Bad_Refine_Raw(ARG(key)));
 
         if (not Is_String_Definitely_ASCII(v))
             fail ("UTF-8 Everywhere: String sorting temporarily unavailable");
@@ -28,8 +28,9 @@
 //
 // Options are offered for using zlib envelope, gzip envelope, or raw deflate.
 //
-// !!! zlib is designed to do streaming compression.  While that code is
-// part of the linked in library, it's not exposed by this interface.
+// zlib is designed to do streaming compression.  MAKE-COMPRESSOR and
+// COMPRESS-STEP expose that, so data too large to hold in memory can be
+// pushed through in chunks (e.g. while reading one file and writing another).
 //
 // !!! Since the zlib code/API isn't actually modified, one could dynamically
 // link to a zlib on the platform instead of using the extracted version.
@@ -182,14 +183,34 @@ unsigned char *Compress_Alloc_Core(
     //
     REBLEN buf_size = deflateBound(&strm, size_in);
 
-    strm.avail_in = size_in;
     strm.next_in = cast(const z_Bytef*, input);
 
     REBYTE *output = rebAllocN(REBYTE, buf_size);
     strm.avail_out = buf_size;
     strm.next_out = output;
 
-    int ret_deflate = deflate(&strm, Z_FINISH);
+    // Feed the input a chunk at a time so a long compression can be halted.
+    // Halting finishes the stream with what was fed (the result won't be
+    // used, see Poll_Signals_Core()).  No GC, as callers via the API may
+    // be holding series that aren't guarded.
+    //
+    const size_t chunk = POLL_CHUNK * 16;
+    size_t left = size_in;
+    int ret_deflate;
+    while (true) {
+        strm.avail_in = left < chunk ? left : chunk;
+        left -= strm.avail_in;
+
+        bool halting = left != 0 and Poll_Signals(SIGS_POLL_ANYWHERE);
+        if (left == 0 or halting) {
+            ret_deflate = deflate(&strm, Z_FINISH);
+            break;
+        }
+
+        ret_deflate = deflate(&strm, Z_NO_FLUSH);  // output can't fill up
+        if (ret_deflate != Z_OK)
+            break;
+    }
     if (ret_deflate != Z_STREAM_END)
         fail (Error_Compression(&strm, ret_deflate));
 
@@ -206,7 +227,7 @@ unsigned char *Compress_Alloc_Core(
         uint32_t gzip_len = Bytes_To_U32_BE(
             output + strm.total_out - sizeof(uint32_t)
         );
-        assert(size_in == gzip_len); // !!! 64-bit REBLEN would need modulo
+        assert(strm.total_in == gzip_len); // !!! 64-bit would need modulo
     }
   #endif
 
@@ -385,6 +406,257 @@ unsigned char *Decompress_Alloc_Core(
 }
 
 
+// Streaming state lives across many native calls, so it can't use rebMalloc()
+// memory (which is freed if a fail() unwinds the frame that allocated it).
+// Plain malloc() is used instead, with the HANDLE!'s cleaner responsible for
+// releasing it when the compressor is garbage collected.
+
+static void *zalloc_stream(void *opaque, unsigned nr, unsigned size)
+{
+    UNUSED(opaque);
+    return malloc(nr * size);  // zlib checks for null, gives Z_MEM_ERROR
+}
+
+static void zfree_stream(void *opaque, void *addr)
+{
+    UNUSED(opaque);
+    free(addr);
+}
+
+struct Reb_Zstream {
+    z_stream strm;
+    bool inflating;  // uses inflate() vs. deflate()
+    bool finished;  // Z_STREAM_END was reached, no more input accepted
+};
+
+#define STREAM_CHUNK_SIZE (32 * 1024)
+
+static void cleanup_zstream(const REBVAL *v)
+{
+    struct Reb_Zstream *z = VAL_HANDLE_POINTER(struct Reb_Zstream, v);
+    if (z->inflating)
+        inflateEnd(&z->strm);
+    else
+        deflateEnd(&z->strm);
+    free(z);
+}
+
+
+//
+//  make-compressor: native [
+//
+//  {Create a stream state for DEFLATE or INFLATE of data given in chunks}
+//
+//      return: "Pass to COMPRESS-STEP, freed when no longer referenced"
+//          [handle!]
+//      /decompress "Make an INFLATE stream instead of a DEFLATE stream"
+//      /envelope "ZLIB, GZIP, or DETECT (decompress only), default is NONE"
+//          [word!]
+//      /level "Compression level from 0 (store only) to 9 (slowest)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(make_compressor)
+{
+    INCLUDE_PARAMS_OF_MAKE_COMPRESSOR;
+
+    int window_bits = window_bits_zlib_raw;
+    if (REF(envelope)) {
+        switch (VAL_WORD_SYM(ARG(envelope))) {
+          case SYM_NONE:
+            break;
+
+          case SYM_ZLIB:
+            window_bits = window_bits_zlib;
+            break;
+
+          case SYM_GZIP:
+            window_bits = window_bits_gzip;
+            break;
+
+          case SYM_DETECT:
+            if (not REF(decompress))
+                fail (PAR(envelope));
+            window_bits = window_bits_detect_zlib_gzip;
+            break;
+
+          default:
+            fail (PAR(envelope));
+        }
+    }
+
+    int level = Z_DEFAULT_COMPRESSION;
+    if (REF(level)) {
+        if (REF(decompress))
+            fail (Error_Bad_Refines_Raw());
+        level = VAL_INT32(ARG(level));
+        if (level < 0 or level > 9)
+            fail (PAR(level));
+    }
+
+    struct Reb_Zstream *z = cast(
+        struct Reb_Zstream*, malloc(sizeof(struct Reb_Zstream))
+    );
+    if (not z)
+        fail (Error_No_Memory(sizeof(struct Reb_Zstream)));
+
+    z->strm.zalloc = &zalloc_stream;
+    z->strm.zfree = &zfree_stream;
+    z->strm.opaque = nullptr;
+    z->strm.next_in = nullptr;
+    z->strm.avail_in = 0;
+    z->inflating = REF(decompress);
+    z->finished = false;
+
+    int ret_init;
+    if (z->inflating)
+        ret_init = inflateInit2(&z->strm, window_bits);
+    else
+        ret_init = deflateInit2(
+            &z->strm,
+            level,
+            Z_DEFLATED,
+            window_bits,
+            8,
+            Z_DEFAULT_STRATEGY
+        );
+
+    if (ret_init != Z_OK) {
+        REBCTX *error = (ret_init == Z_MEM_ERROR)
+            ? Error_No_Memory(sizeof(struct Reb_Zstream))
+            : Error_Compression(&z->strm, ret_init);
+        free(z);
+        fail (error);
+    }
+
+    return Init_Handle_Cdata_Managed(
+        D_OUT,
+        z,
+        sizeof(struct Reb_Zstream),
+        &cleanup_zstream
+    );
+}
+
+
+//
+//  compress-step: native [
+//
+//  {Push data through a MAKE-COMPRESSOR stream, return any output produced}
+//
+//      return: "Output so far (may be empty if zlib is still buffering)"
+//          [binary!]
+//      stream [handle!]
+//      data "Next chunk of input, if text it will be UTF-8 encoded"
+//          [<opt> binary! text!]
+//      /flush "Make all output for input so far available (costs ratio)"
+//      /finish "Signal end of input, output the remainder and any trailer"
+//      /into "Append output to this binary instead of making a new one"
+//          [binary!]
+//  ]
+//
+REBNATIVE(compress_step)
+//
+// Output is produced in STREAM_CHUNK_SIZE increments until zlib has nothing
+// more to give for the input provided.  So memory use is bounded by the size
+// of each chunk the caller passes in (times the compression ratio), not by
+// the size of the whole stream.
+{
+    INCLUDE_PARAMS_OF_COMPRESS_STEP;
+
+    if (VAL_HANDLE_CLEANER(ARG(stream)) != &cleanup_zstream)
+        fail (PAR(stream));
+
+    struct Reb_Zstream *z = VAL_HANDLE_POINTER(
+        struct Reb_Zstream, ARG(stream)
+    );
+    z_stream *strm = &z->strm;
+
+    const REBYTE *bp;
+    REBSIZ size;
+    if (IS_NULLED(ARG(data))) {
+        bp = nullptr;
+        size = 0;
+    }
+    else
+        bp = VAL_BYTES_AT(&size, ARG(data));
+
+    if (z->finished) {
+        if (size != 0)
+            fail ("COMPRESS-STEP given data after end of compressed stream");
+        return Init_Binary(D_OUT, Make_Binary(0));
+    }
+
+    REBBIN *bin;
+    if (REF(into)) {
+        FAIL_IF_READ_ONLY(ARG(into));
+        bin = VAL_BINARY(ARG(into));
+    }
+    else
+        bin = Make_Binary(STREAM_CHUNK_SIZE);
+
+    // inflate() doesn't need Z_FINISH to produce all of its output, and
+    // using it would make a too-small output buffer a Z_BUF_ERROR.  So for
+    // decompression /FINISH only means "check that the stream ended".
+    //
+    int flush = Z_NO_FLUSH;
+    if (REF(finish)) {
+        if (not z->inflating)
+            flush = Z_FINISH;
+    }
+    else if (REF(flush))
+        flush = Z_SYNC_FLUSH;
+
+    // The input pointer is into series data, but nothing is evaluated while
+    // zlib runs so it can't move.  zlib copies what it needs to keep into its
+    // own window, so it's not referenced after this call.
+    //
+    strm->next_in = cast(const z_Bytef*, bp);
+    strm->avail_in = size;
+
+    while (true) {
+        REBLEN tail = BIN_LEN(bin);
+        EXPAND_SERIES_TAIL(bin, STREAM_CHUNK_SIZE);  // may move data
+        strm->next_out = BIN_AT(bin, tail);
+        strm->avail_out = STREAM_CHUNK_SIZE;
+
+        int ret = z->inflating ? inflate(strm, flush) : deflate(strm, flush);
+
+        TERM_BIN_LEN(bin, tail + STREAM_CHUNK_SIZE - strm->avail_out);
+
+        if (ret == Z_STREAM_END) {
+            z->finished = true;
+            break;
+        }
+
+        // Z_BUF_ERROR just means no progress was possible (all input used up
+        // and nothing pending to output).  It's not fatal, more input may come.
+        //
+        if (ret == Z_BUF_ERROR)
+            break;
+
+        if (ret == Z_MEM_ERROR)  // malloc() is used, see zalloc_stream()
+            fail (Error_No_Memory(STREAM_CHUNK_SIZE));
+
+        if (ret != Z_OK)
+            fail (Error_Compression(strm, ret));
+
+        if (strm->avail_out != 0 and strm->avail_in == 0)
+            break;  // room was left over, so everything available was output
+    }
+
+    strm->next_in = nullptr;
+    strm->avail_in = 0;
+
+    if (REF(finish) and not z->finished)  // inflate hit end of input early
+        fail ("COMPRESS-STEP /FINISH reached before end of compressed data");
+
+    if (REF(into))
+        RETURN (ARG(into));
+
+    return Init_Binary(D_OUT, bin);
+}
+
+
 //
 //  checksum-core: native [
 //
@@ -55,6 +55,8 @@
 // under ongoing cleanup as time permits.
 //
 
+#include <time.h>  // clock(), used for timing rules in PARSE/PROFILE
+
 #include "sys-core.h"
 
 
@@ -102,7 +104,15 @@
 #define P_COLLECTION \
     (IS_BLANK(P_COLLECTION_VALUE) ? nullptr : VAL_ARRAY(P_COLLECTION_VALUE))
 
-#define P_NUM_QUOTES_VALUE  (f->rootvar + 4)
+#define P_MEMO_VALUE        (f->rootvar + 4)
+#define P_MEMO \
+    (IS_BLANK(P_MEMO_VALUE) ? nullptr : VAL_ARRAY(P_MEMO_VALUE))
+
+#define P_PROFILE_VALUE     (f->rootvar + 5)
+#define P_PROFILE \
+    (IS_BLANK(P_PROFILE_VALUE) ? nullptr : VAL_ARRAY(P_PROFILE_VALUE))
+
+#define P_NUM_QUOTES_VALUE  (f->rootvar + 6)
 #define P_NUM_QUOTES        VAL_INT32(P_NUM_QUOTES_VALUE)
 
 #define P_OUT (f->out)
@@ -181,6 +191,244 @@ inline static REBSYM VAL_CMD(const RELVAL *v) {
 }
 
 
+// PARSE/MEMO keeps a fixed-size table of BLOCK! subrule results, so that a
+// grammar which backtracks into the same rule at the same position doesn't
+// run it again.  The first cells count hits and misses, then each slot is
+// three cells: the rule block (derelativized, so its specifier is part of
+// the key), the input at the position the rule started, and the position
+// it ended at (BLANK! if it failed).  A slot is simply overwritten when
+// another rule hashes to it, which keeps the table's size bounded.
+//
+// Because the cells hold the arrays and specifiers they name, none of them
+// can be freed and have their address reused while the table is alive.
+//
+#define PARSE_MEMO_SLOTS 1024  // must be a power of 2
+#define PARSE_MEMO_HITS 0
+#define PARSE_MEMO_MISSES 1
+#define PARSE_MEMO_FIRST_SLOT 2
+
+static REBARR *Make_Parse_Memo(void)
+{
+    REBLEN len = PARSE_MEMO_FIRST_SLOT + 3 * PARSE_MEMO_SLOTS;
+    REBARR *memo = Make_Array_Core(len, NODE_FLAG_MANAGED);
+
+    Init_Integer(ARR_AT(memo, PARSE_MEMO_HITS), 0);
+    Init_Integer(ARR_AT(memo, PARSE_MEMO_MISSES), 0);
+
+    RELVAL *slot = ARR_AT(memo, PARSE_MEMO_FIRST_SLOT);
+    REBLEN n;
+    for (n = 0; n < 3 * PARSE_MEMO_SLOTS; ++n, ++slot)
+        Init_Blank(slot);
+
+    TERM_ARRAY_LEN(memo, len);
+    return memo;
+}
+
+
+// Finds the slot where the result of `key` (a derelativized BLOCK! rule)
+// run on `input` (at the position it starts from) is or would be stored.
+// The result is in `slot + 2` if `hit_out` comes back true.
+//
+static RELVAL *Find_Parse_Memo(
+    bool *hit_out,
+    REBARR *memo,
+    const REBVAL *key,
+    const REBVAL *input
+){
+    uintptr_t h = cast(uintptr_t, VAL_ARRAY(key)) >> 4;
+    h ^= cast(uintptr_t, VAL_SERIES(input)) >> 4;
+    h += VAL_INDEX(key) * 31;
+    h += VAL_INDEX(input) * 2654435761u;  // Knuth's multiplicative constant
+
+    REBLEN n = cast(REBLEN, h & (PARSE_MEMO_SLOTS - 1));
+    RELVAL *slot = ARR_AT(memo, PARSE_MEMO_FIRST_SLOT + 3 * n);
+
+    *hit_out = (
+        IS_BLOCK(slot)
+        and VAL_ARRAY(slot) == VAL_ARRAY(key)
+        and VAL_INDEX(slot) == VAL_INDEX(key)
+        and VAL_SPECIFIER(slot) == VAL_SPECIFIER(key)
+        and VAL_TYPE(slot + 1) == VAL_TYPE(input)
+        and VAL_SERIES(slot + 1) == VAL_SERIES(input)
+        and VAL_INDEX(slot + 1) == VAL_INDEX(input)
+    );
+
+    ++VAL_INT64(ARR_AT(memo, *hit_out ? PARSE_MEMO_HITS : PARSE_MEMO_MISSES));
+    return slot;
+}
+
+
+// PARSE/PROFILE counts, for each rule cell in the rule blocks, how often it
+// was attempted, how often it matched, and the clock() ticks spent in it
+// (including any rules it ran, so recursive rules count time more than
+// once).  Cell 0 of the table is a BINARY! of REBLEN hash slots, holding
+// 0 for an empty slot or else 1 + the number of an entry.  Entries follow,
+// in the order rules first finished, each a run of PARSE_PROFILE_FIELDS:
+//
+//     [rule-block-at-rule  rule  attempts  matches  ticks]
+//
+// The first cell keeps the rule's array alive, so that its address can't be
+// reused by another array while the table is in use.
+//
+#define PARSE_PROFILE_FIELDS 5
+#define PARSE_PROFILE_HASHES_MIN 64  // must be a power of 2
+
+static REBSER *Make_Parse_Profile_Hashes(REBLEN num_slots)
+{
+    REBSIZ size = num_slots * sizeof(REBLEN);
+    REBSER *hashes = Make_Binary(size);
+    memset(BIN_HEAD(hashes), 0, size);
+    TERM_BIN_LEN(hashes, size);
+    return hashes;
+}
+
+static REBARR *Make_Parse_Profile(void)
+{
+    REBARR *profile = Make_Array_Core(
+        1 + PARSE_PROFILE_FIELDS * 16,
+        NODE_FLAG_MANAGED
+    );
+    Init_Binary(
+        Alloc_Tail_Array(profile),
+        Make_Parse_Profile_Hashes(PARSE_PROFILE_HASHES_MIN)
+    );
+    return profile;
+}
+
+inline static REBLEN Hash_Parse_Rule(REBARR *array, REBLEN index) {
+    uintptr_t h = cast(uintptr_t, array) >> 4;
+    return cast(REBLEN, h ^ (index * 2654435761u));
+}
+
+// Puts entry number `n` in the first free slot its rule hashes to.
+//
+static void Hash_Parse_Profile_Entry(
+    REBLEN *slots,
+    REBLEN num_slots,
+    REBARR *array,
+    REBLEN index,
+    REBLEN n
+){
+    REBLEN h = Hash_Parse_Rule(array, index) & (num_slots - 1);
+    while (slots[h] != 0)
+        h = (h + 1) & (num_slots - 1);
+    slots[h] = n + 1;
+}
+
+static void Note_Parse_Profile(
+    REBARR *profile,
+    const RELVAL *rule,  // cell in `array` at `index`
+    REBARR *array,
+    REBLEN index,
+    REBSPC *specifier,
+    bool matched,
+    clock_t ticks
+){
+    REBSER *hashes = VAL_SERIES(ARR_HEAD(profile));
+    REBLEN num_slots = BIN_LEN(hashes) / sizeof(REBLEN);
+    REBLEN num_entries = (ARR_LEN(profile) - 1) / PARSE_PROFILE_FIELDS;
+
+    if (2 * (num_entries + 1) > num_slots) {  // keep it at most half full
+        num_slots *= 2;
+        hashes = Make_Parse_Profile_Hashes(num_slots);
+        REBLEN *slots = cast(REBLEN*, BIN_HEAD(hashes));
+
+        REBLEN n;
+        for (n = 0; n < num_entries; ++n) {
+            RELVAL *e = ARR_AT(profile, 1 + n * PARSE_PROFILE_FIELDS);
+            Hash_Parse_Profile_Entry(
+                slots, num_slots, VAL_ARRAY(e), VAL_INDEX(e), n
+            );
+        }
+
+        Note_Series_Mutation(SER(profile));
+        Init_Binary(ARR_HEAD(profile), hashes);
+    }
+
+    REBLEN *slots = cast(REBLEN*, BIN_HEAD(hashes));
+    REBLEN h = Hash_Parse_Rule(array, index) & (num_slots - 1);
+
+    RELVAL *entry;
+    while (true) {
+        if (slots[h] == 0) {  // first time this rule cell has been run
+            Note_Series_Mutation(SER(profile));
+            entry = Alloc_Tail_Array(profile);
+            Init_Any_Array_At(entry, REB_BLOCK, array, index);
+            Derelativize(Alloc_Tail_Array(profile), rule, specifier);
+            Init_Integer(Alloc_Tail_Array(profile), 0);
+            Init_Integer(Alloc_Tail_Array(profile), 0);
+            Init_Integer(Alloc_Tail_Array(profile), 0);
+            entry = ARR_AT(profile, 1 + num_entries * PARSE_PROFILE_FIELDS);
+            slots[h] = num_entries + 1;
+            break;
+        }
+
+        entry = ARR_AT(profile, 1 + (slots[h] - 1) * PARSE_PROFILE_FIELDS);
+        if (VAL_ARRAY(entry) == array and VAL_INDEX(entry) == index)
+            break;
+
+        h = (h + 1) & (num_slots - 1);
+    }
+
+    ++VAL_INT64(entry + 2);
+    if (matched)
+        ++VAL_INT64(entry + 3);
+    VAL_INT64(entry + 4) += ticks;
+}
+
+
+// Builds PARSE/PROFILE's report: a block with a block for each rule cell,
+// in the order the rules first finished running, of the form:
+//
+//     [file line rule attempts matches microseconds]
+//
+// The line is found from the line of the rule's array, plus the newlines
+// marked between the head of the array and the rule.  FILE and LINE are
+// BLANK! for rules in arrays with no such information (e.g. made by code).
+//
+static REBARR *Make_Parse_Profile_Report(REBARR *profile)
+{
+    REBLEN num_entries = (ARR_LEN(profile) - 1) / PARSE_PROFILE_FIELDS;
+    REBARR *report = Make_Array(num_entries);
+
+    REBLEN n;
+    for (n = 0; n < num_entries; ++n) {
+        RELVAL *entry = ARR_AT(profile, 1 + n * PARSE_PROFILE_FIELDS);
+        REBARR *array = VAL_ARRAY(entry);
+
+        REBARR *row = Make_Array(6);
+
+        if (GET_ARRAY_FLAG(array, HAS_FILE_LINE_UNMASKED)) {
+            REBLIN line = MISC(array).line;
+            RELVAL *item = ARR_HEAD(array);
+            REBLEN i;
+            for (i = 0; i <= VAL_INDEX(entry); ++i, ++item) {
+                if (GET_CELL_FLAG(item, NEWLINE_BEFORE))
+                    ++line;
+            }
+            Init_Word(Alloc_Tail_Array(row), LINK_FILE(array));
+            Init_Integer(Alloc_Tail_Array(row), line);
+        }
+        else {
+            Init_Blank(Alloc_Tail_Array(row));
+            Init_Blank(Alloc_Tail_Array(row));
+        }
+
+        Move_Value(Alloc_Tail_Array(row), KNOWN(entry + 1));
+        Move_Value(Alloc_Tail_Array(row), KNOWN(entry + 2));
+        Move_Value(Alloc_Tail_Array(row), KNOWN(entry + 3));
+        Init_Integer(
+            Alloc_Tail_Array(row),
+            VAL_INT64(entry + 4) * cast(REBI64, 1000000) / CLOCKS_PER_SEC
+        );
+
+        Init_Block(Alloc_Tail_Array(report), row);
+    }
+
+    return report;
+}
+
+
 // Subparse_Throws() is a helper that sets up a call frame and invokes the
 // SUBPARSE native--which represents one level of PARSE recursion.
 //
@@ -201,6 +449,8 @@ static bool Subparse_Throws(
     REBSPC *input_specifier,
     struct Reb_Feed *rules_feed,
     REBARR *opt_collection,
+    REBARR *opt_memo,
+    REBARR *opt_profile,
     REBFLGS flags
 ){
     assert(ANY_SERIES_KIND(CELL_KIND(VAL_UNESCAPED(input))));
@@ -236,12 +486,24 @@ static bool Subparse_Throws(
         collect_tail = 0;
     }
 
+    // The PARSE/MEMO table (if any) is shared by all levels of the parse.
+    //
+    if (opt_memo)
+        Init_Block(Prep_Stack_Cell(P_MEMO_VALUE), opt_memo);
+    else
+        Init_Blank(Prep_Stack_Cell(P_MEMO_VALUE));
+
+    if (opt_profile)  // likewise the PARSE/PROFILE table
+        Init_Block(Prep_Stack_Cell(P_PROFILE_VALUE), opt_profile);
+    else
+        Init_Blank(Prep_Stack_Cell(P_PROFILE_VALUE));
+
     // Need to track NUM-QUOTES somewhere that it can be read from the frame
     //
     Init_Nulled(Prep_Stack_Cell(P_NUM_QUOTES_VALUE));
 
-    assert(ACT_NUM_PARAMS(NAT_ACTION(subparse)) == 5); // checks RETURN:
-    Init_Nulled(Prep_Stack_Cell(f->rootvar + 5));
+    assert(ACT_NUM_PARAMS(NAT_ACTION(subparse)) == 7); // checks RETURN:
+    Init_Nulled(Prep_Stack_Cell(f->rootvar + 7));
 
     // !!! By calling the subparse native here directly from its C function
     // vs. going through the evaluator, we don't get the opportunity to do
@@ -533,6 +795,8 @@ static REB_R Parse_One_Rule(
             SPECIFIED,
             subfeed,
             P_COLLECTION,
+            P_MEMO,
+            P_PROFILE,
             P_FIND_FLAGS & ~PF_ONE_RULE
         )){
             Move_Value(P_OUT, subresult);
@@ -741,6 +1005,157 @@ static REB_R Parse_One_Rule(
 }
 
 
+//
+//  Alternate_Cannot_Match: C
+//
+// Keyword dispatch like `["GET" (...) | "POST" (...) | "PUT" (...)]` tries
+// each alternate in order.  When the input is a string, an alternate that
+// starts with a literal TEXT!, CHAR!, or BITSET! can be ruled out just by
+// looking at one input character, without setting up a match attempt.  This
+// only answers true when Parse_One_Rule() would definitely fail; anything
+// it can't judge (words, groups, other types) is left to the normal path.
+//
+static bool Alternate_Cannot_Match(
+    REBFRM *f,
+    REBLEN pos,
+    const RELVAL *rule
+){
+    if (IS_END(rule) or not ANY_STRING_KIND(P_TYPE))
+        return false;
+
+    enum Reb_Kind kind = VAL_TYPE(rule);
+    if (kind != REB_TEXT and kind != REB_CHAR and kind != REB_BITSET)
+        return false;
+
+    if (pos >= SER_LEN(P_INPUT))
+        return true;  // Parse_One_Rule() fails these at the end of input
+
+    REBUNI c = GET_CHAR_AT(STR(P_INPUT), pos);
+
+    switch (kind) {
+      case REB_CHAR:  // compare same as Parse_One_Rule()
+        if (P_HAS_CASE)
+            return VAL_CHAR(rule) != c;
+        return UP_CASE(VAL_CHAR(rule)) != UP_CASE(c);
+
+      case REB_TEXT: {  // compare same as Find_Str_In_Str()
+        if (VAL_LEN_AT(rule) == 0)
+            return false;  // empty text matches anywhere but the tail
+
+        REBUNI first;
+        NEXT_CHR(&first, VAL_STRING_AT(rule));
+        if (first == c)
+            return false;
+        if (P_HAS_CASE)
+            return true;
+        return LO_CASE(first) != LO_CASE(c); }
+
+      case REB_BITSET:
+        return not Check_Bit(VAL_BITSET(rule), c, not P_HAS_CASE);
+
+      default:
+        break;
+    }
+
+    return false;
+}
+
+
+//
+//  Get_To_Thru_Starts: C
+//
+// `thru ["</a>" | "</div>" | "</span>"]` tries every alternate at every
+// input position, which is slow when most positions can't match any of
+// them.  If each alternate in a TO or THRU block starts with a literal (a
+// CHAR!, non-empty string, or BITSET!, possibly fetched from a WORD!), this
+// fills in which ASCII characters could begin a match.  Positions starting
+// with any other character are then skipped without trying the alternates.
+// `starts_high` is set if a non-ASCII character might begin a match.
+//
+// Only string input is handled.  Returns false if the rule has anything
+// else in first position (GROUP!s, keywords other than END, etc.), leaving
+// the general code to process--or raise errors for--such rules.
+//
+static bool Get_To_Thru_Starts(
+    bool starts[128],
+    bool *starts_high,
+    REBFRM *f,
+    const RELVAL *rule_block
+){
+    if (not ANY_STRING_KIND(P_TYPE))
+        return false;
+
+    bool uncased = not P_HAS_CASE;
+
+    REBLEN n;
+    for (n = 0; n < 128; ++n)
+        starts[n] = false;
+    *starts_high = false;
+
+    DECLARE_LOCAL (cell);
+
+    const RELVAL *blk = VAL_ARRAY_HEAD(rule_block);
+    while (NOT_END(blk)) {
+        const RELVAL *rule = blk;
+
+        if (IS_WORD(rule)) {
+            REBSYM cmd = VAL_CMD(rule);
+            if (cmd == SYM_END)
+                goto next_alternate;  // only matters at the tail (not skipped)
+            if (cmd != SYM_0)
+                return false;
+
+            Move_Opt_Var_May_Fail(cell, rule, P_RULE_SPECIFIER);
+            rule = cell;
+        }
+
+        if (IS_CHAR(rule) or (IS_TEXT(rule) and VAL_LEN_AT(rule) != 0)) {
+            REBUNI c;
+            if (IS_CHAR(rule))
+                c = VAL_CHAR(rule);
+            else
+                NEXT_CHR(&c, VAL_STRING_AT(rule));
+
+            if (c >= 128)
+                *starts_high = true;
+            else {
+                starts[c] = true;
+                if (uncased) {
+                    starts[LO_CASE(c)] = true;
+                    starts[UP_CASE(c)] = true;
+                }
+            }
+        }
+        else if (IS_TAG(rule)) {
+            starts[cast(unsigned char, '<')] = true;
+        }
+        else if (IS_BITSET(rule)) {
+            for (n = 0; n < 128; ++n) {
+                if (Check_Bit(VAL_BITSET(rule), n, uncased))
+                    starts[n] = true;
+            }
+            *starts_high = true;  // don't try to summarize the high range
+        }
+        else
+            return false;
+
+      next_alternate:  // only the first rule of each alternate is matched
+
+        do {
+            ++blk;
+        } while (NOT_END(blk) and not IS_BAR(blk));
+
+        if (NOT_END(blk)) {
+            ++blk;
+            if (IS_END(blk) or IS_BAR(blk))
+                return false;  // let the general code handle `[... |]`
+        }
+    }
+
+    return true;
+}
+
+
 //
 //  To_Thru_Block_Rule: C
 //
@@ -759,8 +1174,37 @@ static REBIXO To_Thru_Block_Rule(
 ) {
     DECLARE_LOCAL (cell); // holds evaluated rules (use frame cell instead?)
 
+    bool starts[128];
+    bool starts_high;
+    bool filtered = Get_To_Thru_Starts(starts, &starts_high, f, rule_block);
+    bool uncased = not P_HAS_CASE;
+    REBCHR(const*) cp = filtered ? STR_AT(STR(P_INPUT), P_POS) : nullptr;
+
     REBLEN pos = P_POS;
     for (; pos <= SER_LEN(P_INPUT); ++pos) {
+        if (filtered and pos < SER_LEN(P_INPUT)) {
+            REBUNI c;
+            cp = NEXT_CHR(&c, cp);
+
+            bool possible;
+            if (c < 128)
+                possible = starts[c];
+            else if (starts_high)
+                possible = true;
+            else if (not uncased)
+                possible = false;
+            else {  // non-ASCII can still fold to ASCII (e.g. KELVIN SIGN)
+                REBUNI lo = LO_CASE(c);
+                REBUNI up = UP_CASE(c);
+                possible = (
+                    (lo < 128 and starts[lo]) or (up < 128 and starts[up])
+                );
+            }
+
+            if (not possible)
+                continue;
+        }
+
         const RELVAL *blk = VAL_ARRAY_HEAD(rule_block);
         for (; NOT_END(blk); blk++) {
             if (IS_BAR(blk))
@@ -1306,6 +1750,10 @@ static REB_R Handle_Seek_Rule_Dont_Update_Begin(
 //      find-flags [integer!]
 //      collection "Array into which any KEEP values are collected"
 //          [blank! any-series!]
+//      memo "Table of BLOCK! subrule results for PARSE/MEMO"
+//          [blank! block!]
+//      profile "Table of counts and times per rule for PARSE/PROFILE"
+//          [blank! block!]
 //      <local> num-quotes
 //  ]
 //
@@ -1376,6 +1824,8 @@ REBNATIVE(subparse)
     //
     REBLEN collection_tail = P_COLLECTION ? ARR_LEN(P_COLLECTION) : 0;
     UNUSED(ARG(collection)); // implicitly accessed as P_COLLECTION
+    UNUSED(ARG(memo));  // implicitly accessed as P_MEMO
+    UNUSED(ARG(profile));  // implicitly accessed as P_PROFILE
 
     assert(IS_END(P_OUT)); // invariant provided by evaluator
 
@@ -1417,6 +1867,9 @@ REBNATIVE(subparse)
     REBINT mincount = 1; // min pattern count
     REBINT maxcount = 1; // max pattern count
 
+    const RELVAL *profile_rule = nullptr;  // rule being timed for /PROFILE
+    clock_t profile_start = 0;
+
   #if defined(DEBUG_ENSURE_FRAME_EVALUATES)
     //
     // For the same reasons that the evaluator always wants to run through and
@@ -1600,6 +2053,8 @@ REBNATIVE(subparse)
                         SPECIFIED,
                         f->feed,
                         collection,
+                        P_MEMO,
+                        P_PROFILE,
                         P_FIND_FLAGS | PF_ONE_RULE
                     );
 
@@ -1703,6 +2158,8 @@ REBNATIVE(subparse)
                             SPECIFIED,
                             f->feed,
                             P_COLLECTION,
+                            P_MEMO,
+                            P_PROFILE,
                             P_FIND_FLAGS | PF_ONE_RULE
                         );
 
@@ -2034,12 +2491,74 @@ REBNATIVE(subparse)
         // The index is advanced and stored in a temp variable i until
         // the entire rule has been satisfied.
 
+        if (
+            P_PROFILE
+            and f->feed->array
+            and P_RULE >= ARR_HEAD(f->feed->array)
+            and P_RULE < ARR_TAIL(f->feed->array)
+        ){
+            profile_rule = P_RULE;
+            profile_start = clock();
+        }
+
         FETCH_NEXT_RULE(f);
 
         begin = P_POS;// input at beginning of match section
 
         REBINT count; // gotos would cross initialization
         count = 0;
+
+        // Iterating a BITSET! over string or binary input is the bread and
+        // butter of tokenizing rules (`some alpha`, `any whitespace`...).
+        // Going through Parse_One_Rule() for every character re-dispatches
+        // on the rule type and seeks the string position from scratch each
+        // time, so walk the input directly instead.  The result must be the
+        // same as the general loop below: stop at maxcount, at the tail, or
+        // at the first character not in the set.
+        //
+        if (
+            IS_BITSET(rule)
+            and not IS_SER_ARRAY(P_INPUT)
+            and not Trace_Level
+        ){
+            REBSER *bset = VAL_BITSET(rule);
+            bool uncased = not P_HAS_CASE;
+            REBLEN len = SER_LEN(P_INPUT);
+            REBLEN pos = P_POS;
+
+            if (P_TYPE == REB_BINARY) {
+                const REBYTE *bp = BIN_AT(P_INPUT, pos);
+                while (
+                    count < maxcount
+                    and pos < len
+                    and Check_Bit(bset, *bp, uncased)
+                ){
+                    ++bp;
+                    ++pos;
+                    ++count;
+                }
+            }
+            else {
+                REBCHR(const*) cp = STR_AT(STR(P_INPUT), pos);
+                while (count < maxcount and pos < len) {
+                    REBUNI c;
+                    REBCHR(const*) next = NEXT_CHR(&c, cp);
+                    if (not Check_Bit(bset, c, uncased))
+                        break;
+                    cp = next;
+                    ++pos;
+                    ++count;
+                }
+            }
+
+            if (count < maxcount and count < mincount)
+                P_POS = NOT_FOUND;  // stopped short of the minimum
+            else
+                P_POS = pos;
+
+            goto iterated_rule_done;
+        }
+
         while (count < maxcount) {
             assert(
                 not IS_BAR(rule)
@@ -2228,6 +2747,8 @@ REBNATIVE(subparse)
                         P_INPUT_SPECIFIER,  // harmless if specified API value
                         subrules_feed,
                         P_COLLECTION,
+                        P_MEMO,
+                        P_PROFILE,
                         P_FIND_FLAGS
                     )){
                         return R_THROWN;
@@ -2278,42 +2799,72 @@ REBNATIVE(subparse)
             }
             else if (IS_BLOCK(rule)) {  // word fetched block, or inline block
 
-                DECLARE_ARRAY_FEED (subrules_feed,
-                    VAL_ARRAY(rule),
-                    VAL_INDEX(rule),
-                    P_RULE_SPECIFIER
-                );
+                // With PARSE/MEMO a block already run at this position gives
+                // its old result, without running its GROUP!s or SETs again.
+                // Not done while COLLECT is active, as KEEPs can't be redone.
+                //
+                REBARR *memo = P_COLLECTION ? nullptr : P_MEMO;
+                RELVAL *slot = nullptr;
+                bool hit = false;
+                if (memo) {
+                    DECLARE_LOCAL (key);
+                    Derelativize(key, rule, P_RULE_SPECIFIER);
+                    slot = Find_Parse_Memo(&hit, memo, key, P_INPUT_VALUE);
+                }
 
-                bool interrupted;
-                if (Subparse_Throws(
-                    &interrupted,
-                    SET_END(P_CELL),
-                    P_INPUT_VALUE,
-                    SPECIFIED,
-                    subrules_feed,
-                    P_COLLECTION,
-                    P_FIND_FLAGS & ~(PF_ONE_RULE)
-                )) {
-                    Move_Value(P_OUT, P_CELL);
-                    return R_THROWN;
+                if (hit) {
+                    i = IS_BLANK(slot + 2) ? END_FLAG : VAL_UINT32(slot + 2);
                 }
+                else {
+                    DECLARE_ARRAY_FEED (subrules_feed,
+                        VAL_ARRAY(rule),
+                        VAL_INDEX(rule),
+                        P_RULE_SPECIFIER
+                    );
 
-                // Non-breaking out of loop instances of match or not.
+                    bool interrupted;
+                    if (Subparse_Throws(
+                        &interrupted,
+                        SET_END(P_CELL),
+                        P_INPUT_VALUE,
+                        SPECIFIED,
+                        subrules_feed,
+                        P_COLLECTION,
+                        P_MEMO,
+                        P_PROFILE,
+                        P_FIND_FLAGS & ~(PF_ONE_RULE)
+                    )) {
+                        Move_Value(P_OUT, P_CELL);
+                        return R_THROWN;
+                    }
 
-                if (IS_NULLED(P_CELL))
-                    i = END_FLAG;
-                else {
-                    assert(IS_INTEGER(P_CELL));
-                    i = VAL_INT32(P_CELL);
-                }
+                    // Non-breaking out of loop instances of match or not.
 
-                if (interrupted) { // ACCEPT or REJECT ran
-                    assert(i != THROWN_FLAG);
-                    if (i == END_FLAG)
-                        P_POS = NOT_FOUND;
-                    else
-                        P_POS = cast(REBLEN, i);
-                    break;
+                    if (IS_NULLED(P_CELL))
+                        i = END_FLAG;
+                    else {
+                        assert(IS_INTEGER(P_CELL));
+                        i = VAL_INT32(P_CELL);
+                    }
+
+                    if (interrupted) { // ACCEPT or REJECT ran
+                        assert(i != THROWN_FLAG);
+                        if (i == END_FLAG)
+                            P_POS = NOT_FOUND;
+                        else
+                            P_POS = cast(REBLEN, i);
+                        break;
+                    }
+
+                    if (slot) {  // nested rules may have reused the slot
+                        Note_Series_Mutation(SER(memo));
+                        Derelativize(slot, rule, P_RULE_SPECIFIER);
+                        Move_Value(slot + 1, P_INPUT_VALUE);
+                        if (i == END_FLAG)
+                            Init_Blank(slot + 2);
+                        else
+                            Init_Integer(slot + 2, i);
+                    }
                 }
             }
             else {
@@ -2371,9 +2922,24 @@ REBNATIVE(subparse)
             }
         }
 
+      iterated_rule_done:;
+
         if (P_POS > SER_LEN(P_INPUT))
             P_POS = NOT_FOUND;
 
+        if (profile_rule) {
+            Note_Parse_Profile(
+                P_PROFILE,
+                profile_rule,
+                f->feed->array,
+                cast(REBLEN, profile_rule - ARR_HEAD(f->feed->array)),
+                P_RULE_SPECIFIER,
+                P_POS != NOT_FOUND,
+                clock() - profile_start
+            );
+            profile_rule = nullptr;
+        }
+
     //==////////////////////////////////////////////////////////////////==//
     //
     // "POST-MATCH PROCESSING"
@@ -2667,6 +3233,19 @@ REBNATIVE(subparse)
             //
             FETCH_NEXT_RULE(f);
             P_POS = begin = start;
+
+            // Pass over alternates whose first rule can't match here, so a
+            // long keyword list doesn't re-enter the loop for every entry.
+            //
+            while (
+                not Trace_Level
+                and Alternate_Cannot_Match(f, P_POS, P_RULE)
+            ){
+                FETCH_TO_BAR_OR_END(f);
+                if (IS_END(P_RULE))
+                    return Init_Nulled(D_OUT);
+                FETCH_NEXT_RULE(f);
+            }
         }
 
         if (P_FIND_FLAGS & PF_ONE_RULE)  // don't loop
@@ -2692,6 +3271,11 @@ REBNATIVE(subparse)
 //      rules "Rules to parse by"
 //          [<blank> block!]
 //      /case "Uses case-sensitive comparison"
+//      /memo "Reuse BLOCK! rule results by position (skips their GROUP!s)"
+//      /stats "Set to a block of memo table [hits misses] (requires /MEMO)"
+//          [word!]
+//      /profile "Set to a block of [file line rule attempts matches usecs]"
+//          [word!]
 //  ]
 //
 REBNATIVE(parse)
@@ -2713,18 +3297,65 @@ REBNATIVE(parse)
         VAL_SPECIFIER(ARG(rules))
     );
 
+    if (REF(stats) and not REF(memo))
+        fail (Error_Bad_Refines_Raw());
+
+    // A packrat-style memo pays off for grammars that backtrack into the
+    // same rules at the same positions, which can otherwise take exponential
+    // time.  The table lives for this one PARSE (see Find_Parse_Memo()).
+    //
+    REBARR *memo = REF(memo) ? Make_Parse_Memo() : nullptr;
+    if (memo)
+        PUSH_GC_GUARD(memo);
+
+    // Profiling counts attempts and time per rule cell, so that a slow rule
+    // in a large grammar can be found (see Note_Parse_Profile()).
+    //
+    REBARR *profile_table = REF(profile) ? Make_Parse_Profile() : nullptr;
+    if (profile_table)
+        PUSH_GC_GUARD(profile_table);
+
     bool interrupted;
-    if (Subparse_Throws(
+    bool threw = Subparse_Throws(
         &interrupted,
         SET_END(D_OUT),
         ARG(input), SPECIFIED,
         rules_feed,
         nullptr,  // start out with no COLLECT in effect, so no P_COLLECTION
+        memo,
+        profile_table,
         REF(case) ? AM_FIND_CASE : 0
         //
         // We always want "case-sensitivity" on binary bytes, vs. treating
         // as case-insensitive bytes for ASCII characters.
-    )){
+    );
+
+    if (profile_table) {
+        if (not threw) {
+            Init_Block(
+                Sink_Var_May_Fail(ARG(profile), SPECIFIED),
+                Make_Parse_Profile_Report(profile_table)
+            );
+        }
+        DROP_GC_GUARD(profile_table);
+    }
+
+    if (memo) {
+        DROP_GC_GUARD(memo);
+
+        if (not threw and REF(stats)) {
+            REBARR *stats = Make_Array(2);
+            Move_Value(ARR_AT(stats, 0), KNOWN(ARR_AT(memo, PARSE_MEMO_HITS)));
+            Move_Value(
+                ARR_AT(stats, 1),
+                KNOWN(ARR_AT(memo, PARSE_MEMO_MISSES))
+            );
+            TERM_ARRAY_LEN(stats, 2);
+            Init_Block(Sink_Var_May_Fail(ARG(stats), SPECIFIED), stats);
+        }
+    }
+
+    if (threw) {
         // Any PARSE-specific THROWs (where a PARSE directive jumped the
         // stack) should be handled here.  However, RETURN was eliminated,
         // in favor of enforcing a more clear return value protocol for PARSE
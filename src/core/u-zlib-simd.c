@@ -0,0 +1,398 @@
+//
+//  File: %u-zlib-simd.c
+//  Summary: "Hardware accelerated CRC-32 and Adler-32 kernels for zlib"
+//  Section: utility
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// The zlib extracted into %u-zlib.c computes CRC-32 four bytes at a time
+// with lookup tables, and Adler-32 one byte at a time.  Those are used by
+// gzip and zlib envelopes as well as by CHECKSUM, so a big buffer spends a
+// lot of its time there.  %make-zlib.r patches `crc32_z()` and `adler32_z()`
+// to call into the kernels here when the buffer is long enough to benefit.
+//
+// * CRC-32 on x86 uses carry-less multiplication (PCLMULQDQ) to fold 64
+//   bytes per step, following Intel's paper "Fast CRC Computation for Generic
+//   Polynomials Using PCLMULQDQ Instruction".  (The SSE4.2 CRC32 instruction
+//   can't be used: it computes CRC-32C, which is a different polynomial.)
+//
+// * CRC-32 on ARM uses the ARMv8 CRC32 instructions, which *do* implement
+//   the zlib polynomial.  These are used when the compiler is targeting a
+//   CPU that has them (__ARM_FEATURE_CRC32), no runtime check is made.
+//
+// * Adler-32 on x86 uses SSSE3 to sum 32 bytes per step.
+//
+// x86 availability is checked once at runtime with CPUID, so a build can be
+// run on older machines.  Kernels are compiled with per-function target
+// attributes on GCC and Clang, so no special compiler switches are needed.
+//
+// Derived from the Chromium zlib work (crc32_simd.c and adler32_simd.c):
+//
+//   Copyright 2017 The Chromium Authors. All rights reserved.
+//   Use of this source code is governed by a BSD-style license.
+//
+
+#include <stdint.h>
+#include <string.h>
+
+#include "sys-zlib.h"
+
+#if !defined(REBOL_NO_ZLIB_SIMD)
+    #if defined(__x86_64__) || defined(_M_X64) \
+        || defined(__i386__) || defined(_M_IX86)
+        #define ZLIB_SIMD_X86
+    #elif defined(__ARM_FEATURE_CRC32)
+        #define ZLIB_SIMD_ARM_CRC32
+    #endif
+#endif
+
+#if defined(ZLIB_SIMD_X86)
+    #include <immintrin.h>
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define SIMD_TARGET(t)
+        #define SIMD_ALIGN(n) __declspec(align(n))
+    #else
+        #include <cpuid.h>
+        #define SIMD_TARGET(t) __attribute__((target(t)))
+        #define SIMD_ALIGN(n) __attribute__((aligned(n)))
+    #endif
+#elif defined(ZLIB_SIMD_ARM_CRC32)
+    #include <arm_acle.h>
+#endif
+
+
+#define ADLER_BASE 65521U  // largest prime smaller than 65536
+#define ADLER_NMAX 5552  // most bytes before 32-bit sums could overflow
+
+
+#if defined(ZLIB_SIMD_X86)
+
+static int Simd_Crc32_Ok = -1;  // -1 means CPUID hasn't been checked yet
+static int Simd_Adler32_Ok = -1;
+
+static void Detect_Simd(void)
+{
+    unsigned int ecx;
+
+  #if defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 1);
+    ecx = (unsigned int)regs[2];
+  #else
+    unsigned int eax, ebx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        ecx = 0;
+  #endif
+
+    // ECX bit 1 is PCLMULQDQ, bit 9 is SSSE3, bit 19 is SSE4.1 (the CRC
+    // kernel uses _mm_extract_epi32(), which is SSE4.1)
+    //
+    Simd_Crc32_Ok = ((ecx & (1u << 1)) && (ecx & (1u << 19))) ? 1 : 0;
+    Simd_Adler32_Ok = (ecx & (1u << 9)) ? 1 : 0;
+}
+
+
+//
+//  Crc32_Pclmul: C
+//
+// `crc` is in the inverted form used inside the CRC computation (not what
+// crc32_z() takes and returns).  `len` must be a multiple of 16, and >= 64.
+//
+SIMD_TARGET("sse4.1,pclmul")
+static uint32_t Crc32_Pclmul(
+    uint32_t crc,
+    const unsigned char *buf,
+    z_size_t len
+){
+    // Bit-reflected domain constants k1..k5 and the CRC-32 plus Barrett
+    // reduction polynomials, as given at the end of Intel's paper.
+    //
+    static const uint64_t SIMD_ALIGN(16) k1k2[] = {0x0154442bd4, 0x01c6e41596};
+    static const uint64_t SIMD_ALIGN(16) k3k4[] = {0x01751997d0, 0x00ccaa009e};
+    static const uint64_t SIMD_ALIGN(16) k5k0[] = {0x0163cd6124, 0x0000000000};
+    static const uint64_t SIMD_ALIGN(16) poly[] = {0x01db710641, 0x01f7011641};
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    x1 = _mm_loadu_si128((const __m128i*)(buf + 0x00));
+    x2 = _mm_loadu_si128((const __m128i*)(buf + 0x10));
+    x3 = _mm_loadu_si128((const __m128i*)(buf + 0x20));
+    x4 = _mm_loadu_si128((const __m128i*)(buf + 0x30));
+
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+
+    x0 = _mm_load_si128((const __m128i*)k1k2);
+
+    buf += 64;
+    len -= 64;
+
+    // Fold four 128-bit lanes in parallel, 64 bytes per step.
+    //
+    while (len >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        y5 = _mm_loadu_si128((const __m128i*)(buf + 0x00));
+        y6 = _mm_loadu_si128((const __m128i*)(buf + 0x10));
+        y7 = _mm_loadu_si128((const __m128i*)(buf + 0x20));
+        y8 = _mm_loadu_si128((const __m128i*)(buf + 0x30));
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+
+        buf += 64;
+        len -= 64;
+    }
+
+    // Fold the four lanes down into one.
+    //
+    x0 = _mm_load_si128((const __m128i*)k3k4);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Fold any remaining 16 byte blocks one at a time.
+    //
+    while (len >= 16) {
+        x2 = _mm_loadu_si128((const __m128i*)buf);
+
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+        buf += 16;
+        len -= 16;
+    }
+
+    // Fold 128 bits to 64 bits.
+    //
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+
+    x0 = _mm_loadl_epi64((const __m128i*)k5k0);
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduce to 32 bits.
+    //
+    x0 = _mm_load_si128((const __m128i*)poly);
+
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (uint32_t)_mm_extract_epi32(x1, 1);
+}
+
+
+//
+//  Adler32_Ssse3: C
+//
+// Sums 32 bytes per step: SAD against zero gives the byte sum for s1, and a
+// multiply-add with descending weights gives the contribution to s2.
+//
+SIMD_TARGET("ssse3")
+static unsigned long Adler32_Ssse3(
+    unsigned long adler,
+    const unsigned char *buf,
+    z_size_t len
+){
+    const unsigned block_size = 32;
+
+    uint32_t s1 = adler & 0xffff;
+    uint32_t s2 = (adler >> 16) & 0xffff;
+
+    z_size_t blocks = len / block_size;
+    len -= blocks * block_size;
+
+    const __m128i tap1 = _mm_setr_epi8(
+        32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17
+    );
+    const __m128i tap2 = _mm_setr_epi8(
+        16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1
+    );
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi16(1);
+
+    while (blocks) {
+        unsigned n = ADLER_NMAX / block_size;  // sums must be reduced after
+        if (n > blocks)
+            n = (unsigned)blocks;
+        blocks -= n;
+
+        // s1 gets added into s2 once per byte, so n blocks of 32 bytes adds
+        // s1 * n * 32.  v_ps accumulates the s1 of each prior block for that.
+        //
+        __m128i v_ps = _mm_set_epi32(0, 0, 0, (int)(s1 * n));
+        __m128i v_s2 = _mm_set_epi32(0, 0, 0, (int)s2);
+        __m128i v_s1 = _mm_setzero_si128();
+
+        do {
+            const __m128i bytes1 = _mm_loadu_si128((const __m128i*)buf);
+            const __m128i bytes2 = _mm_loadu_si128((const __m128i*)(buf + 16));
+
+            v_ps = _mm_add_epi32(v_ps, v_s1);
+
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes1, zero));
+            const __m128i mad1 = _mm_maddubs_epi16(bytes1, tap1);
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(mad1, ones));
+
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes2, zero));
+            const __m128i mad2 = _mm_maddubs_epi16(bytes2, tap2);
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(mad2, ones));
+
+            buf += block_size;
+        } while (--n);
+
+        v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_ps, 5));
+
+        // Horizontally add the four 32-bit lanes of each sum.
+        //
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(2,3,0,1)));
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(1,0,3,2)));
+        s1 += (uint32_t)_mm_cvtsi128_si32(v_s1);
+
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(2,3,0,1)));
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(1,0,3,2)));
+        s2 = (uint32_t)_mm_cvtsi128_si32(v_s2);
+
+        s1 %= ADLER_BASE;
+        s2 %= ADLER_BASE;
+    }
+
+    while (len--) {  // fewer than 32 bytes left
+        s1 += *buf++;
+        s2 += s1;
+    }
+    s1 %= ADLER_BASE;
+    s2 %= ADLER_BASE;
+
+    return s1 | (s2 << 16);
+}
+
+#endif  // ZLIB_SIMD_X86
+
+
+//
+//  Zlib_Crc32_Simd: C
+//
+// Called by crc32_z() for buffers of 64 bytes or more.  Returns the number of
+// bytes that were processed (0 if no accelerated kernel is available), with
+// *crc updated to cover them.  crc32_z() handles any remaining tail.
+//
+z_size_t Zlib_Crc32_Simd(
+    unsigned long *crc,
+    const unsigned char *buf,
+    z_size_t len
+){
+  #if defined(ZLIB_SIMD_X86)
+    if (Simd_Crc32_Ok < 0)
+        Detect_Simd();  // benign race if threads do this at the same time
+    if (!Simd_Crc32_Ok || len < 64)
+        return 0;
+
+    z_size_t chunk = len & ~(z_size_t)15;
+    *crc = ~Crc32_Pclmul(~(uint32_t)*crc, buf, chunk) & 0xffffffffUL;
+    return chunk;
+
+  #elif defined(ZLIB_SIMD_ARM_CRC32)
+    uint32_t c = ~(uint32_t)*crc;
+    z_size_t n = len;
+
+    while (n && ((uintptr_t)buf & 7)) {  // align for 8 byte loads
+        c = __crc32b(c, *buf++);
+        --n;
+    }
+    while (n >= 8) {
+        uint64_t w;
+        memcpy(&w, buf, 8);  // compilers turn this into a plain load
+        c = __crc32d(c, w);
+        buf += 8;
+        n -= 8;
+    }
+    while (n--)
+        c = __crc32b(c, *buf++);
+
+    *crc = ~c & 0xffffffffUL;
+    return len;
+
+  #else
+    (void)crc;
+    (void)buf;
+    (void)len;
+    return 0;
+  #endif
+}
+
+
+//
+//  Zlib_Adler32_Simd: C
+//
+// Called by adler32_z() for buffers of 64 bytes or more.  Returns nonzero and
+// writes *adler_out if an accelerated kernel handled the whole buffer.
+//
+int Zlib_Adler32_Simd(
+    unsigned long *adler_out,
+    unsigned long adler,
+    const unsigned char *buf,
+    z_size_t len
+){
+  #if defined(ZLIB_SIMD_X86)
+    if (Simd_Adler32_Ok < 0)
+        Detect_Simd();
+    if (!Simd_Adler32_Ok)
+        return 0;
+
+    *adler_out = Adler32_Ssse3(adler, buf, len);
+    return 1;
+
+  #else
+    (void)adler_out;
+    (void)adler;
+    (void)buf;
+    (void)len;
+    return 0;
+  #endif
+}
@@ -42,6 +42,10 @@
 #include "sys-zlib.h" /* REBOL: see make-zlib.r */
 #define local static
 
+/* REBOL: accelerated kernels in %u-zlib-simd.c, see make-zlib.r */
+z_size_t Zlib_Crc32_Simd(unsigned long *crc, const unsigned char *buf, z_size_t len);
+int Zlib_Adler32_Simd(unsigned long *adler_out, unsigned long adler, const unsigned char *buf, z_size_t len);
+
 /* crc32.c -- compute the CRC-32 of a data stream
  * Copyright (C) 1995-2006, 2010, 2011, 2012, 2016 Mark Adler
  * For conditions of distribution and use, see copyright notice in zlib.h
@@ -690,6 +694,14 @@ unsigned long ZEXPORT crc32_z(
 {
     if (buf == Z_NULL) return 0UL;
 
+    if (len >= 64) { /* REBOL: see make-zlib.r */
+        z_size_t done = Zlib_Crc32_Simd(&crc, buf, len);
+        buf += done;
+        len -= done;
+        if (len == 0)
+            return crc;
+    }
+
 #ifdef DYNAMIC_CRC_TABLE
     if (crc_table_empty)
         make_crc_table();
@@ -1015,6 +1027,10 @@ uLong ZEXPORT adler32_z(
     if (buf == Z_NULL)
         return 1L;
 
+    /* REBOL: see make-zlib.r */
+    if (len >= 64 && Zlib_Adler32_Simd(&adler, adler | (sum2 << 16), buf, len))
+        return adler;
+
     /* in case short lengths are provided, keep it somewhat fast */
     if (len < 16) {
         while (len--) {
@@ -336,6 +336,26 @@ inline static void Sync_Paramlist_Archetype(REBARR *paramlist)
 #define ACT_DISPATCHER(a) \
     (MISC(VAL_ACT_DETAILS(ACT_ARCHETYPE(a))).dispatcher)
 
+
+//=//// DETAILS_FLAG_IS_PURE //////////////////////////////////////////////=//
+//
+// The details array isn't a paramlist, so it is free to use the array
+// subclass bits for its own purposes.  This one says the action's result
+// depends only on its arguments and running it has no side effects--so a
+// call on literal arguments may be replaced by its result (see FOLD).
+//
+// It's on the details and not the paramlist because it's a claim about the
+// implementation.  HIJACK rewrites the details, and must update it.
+//
+#define DETAILS_FLAG_IS_PURE \
+    ARRAY_FLAG_23
+
+inline static bool Is_Action_Pure(REBACT *a) {
+    return did (
+        SER(ACT_DETAILS(a))->header.bits & DETAILS_FLAG_IS_PURE
+    );
+}
+
 // These are indices into the details array agreed upon by actions which have
 // the PARAMLIST_FLAG_IS_NATIVE set.
 //
@@ -343,6 +363,31 @@ inline static void Sync_Paramlist_Archetype(REBARR *paramlist)
 #define IDX_NATIVE_CONTEXT 1 // libRebol binds strings here (and lib)
 #define IDX_NATIVE_MAX (IDX_NATIVE_CONTEXT + 1)
 
+// Indices into the details array of a stub made by LAZY, which holds what is
+// needed to run the generator when the stub is first called.
+//
+#define IDX_LAZY_GENERATOR 0  // e.g. FUNC or FUNCTION
+#define IDX_LAZY_SPEC 1
+#define IDX_LAZY_BODY 2
+#define IDX_LAZY_MAX (IDX_LAZY_BODY + 1)
+
+// Indices into the details arrays of actions made by ADAPT, CHAIN and
+// SPECIALIZE.  The last slot of each is the BLOCK! the dispatcher really
+// follows, with the composed layers flattened (see Make_Composition_Plan()).
+//
+#define IDX_ADAPTER_PRELUDE 0  // relativized to the underlying action
+#define IDX_ADAPTER_ADAPTEE 1
+#define IDX_ADAPTER_PLAN 2
+#define IDX_ADAPTER_MAX (IDX_ADAPTER_PLAN + 1)
+
+#define IDX_CHAINER_PIPELINE 0  // BLOCK! of ACTION!s, as given to CHAIN
+#define IDX_CHAINER_PLAN 1
+#define IDX_CHAINER_MAX (IDX_CHAINER_PLAN + 1)
+
+#define IDX_SPECIALIZER_FRAME 0  // exemplar, phase is the specialized action
+#define IDX_SPECIALIZER_PLAN 1
+#define IDX_SPECIALIZER_MAX (IDX_SPECIALIZER_PLAN + 1)
+
 inline static REBVAL *ACT_PARAM(REBACT *a, REBLEN n) {
     assert(n != 0 and n < ARR_LEN(ACT_PARAMLIST(a)));
     return SER_AT(REBVAL, SER(ACT_PARAMLIST(a)), n);
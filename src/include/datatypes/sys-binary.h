@@ -85,6 +85,27 @@ inline static REBSER *Make_Binary_Core(REBLEN capacity, REBFLGS flags)
     Make_Binary_Core(capacity, SERIES_FLAGS_NONE)
 
 
+//=//// BINARY_INFO_MISC_EXTERNAL /////////////////////////////////////////=//
+//
+// A byte series made by Make_External_Binary() has its data pointer aimed
+// at memory the series did not allocate, such as a private mapping of a
+// file.  That memory is never freed by the series: when the data must be
+// reallocated to grow, it is copied into an ordinary allocation and this bit
+// is cleared, and if the series is GC'd the external memory is left alone.
+//
+// The bit stays with the series if it is aliased AS TEXT!.  It is only
+// meaningful for width 1 series (other series give SERIES_INFO_MISC_BIT
+// other meanings, see ARRAY_INFO_MISC_VOIDER).
+//
+#define BINARY_INFO_MISC_EXTERNAL SERIES_INFO_MISC_BIT
+
+inline static bool Is_Series_Data_External(REBSER *s) {
+    return SER_WIDE(s) == 1
+        and IS_SER_DYNAMIC(s)
+        and did (s->info.bits & BINARY_INFO_MISC_EXTERNAL);
+}
+
+
 //=//// BINARY! VALUES ////////////////////////////////////////////////////=//
 
 #define VAL_BIN_HEAD(v) \
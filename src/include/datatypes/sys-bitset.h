@@ -47,6 +47,58 @@ inline static void INIT_BITS_NOT(REBSER *s, bool negated)
   { MISC(s).negated = negated; }
 
 
+//=//// BITSET RANGES /////////////////////////////////////////////////////=//
+//
+// Only bits below BITSET_DENSE_LIMIT are kept in the binary, so it is never
+// more than 8K.  Bits at or above it (the supplementary Unicode planes, or
+// big integers) are kept as a sorted list of inclusive [lo hi] pairs, with
+// no two ranges overlapping or adjacent.  So `charset [#"^(10000)" -
+// #"^(10FFFF)"]` is one pair, instead of 136K of set bits.
+//
+// The list is a series of REBLEN held in the binary's LINK(), which is only
+// valid if SERIES_FLAG_LINK_NODE_NEEDS_MARK is set.  Lists are never changed
+// once made, so copies of a bitset can share one.
+//
+#define BITSET_DENSE_LIMIT 0x10000
+
+inline static REBSER *BITSET_RANGES(REBSER *s) {
+    if (NOT_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK))
+        return nullptr;
+    return SER(LINK(s).custom.node);
+}
+
+inline static void INIT_BITSET_RANGES(REBSER *s, REBSER *ranges) {
+    if (ranges == nullptr) {
+        CLEAR_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK);
+        return;
+    }
+    assert(SER_USED(ranges) % 2 == 0 and SER_USED(ranges) != 0);
+    LINK(s).custom.node = NOD(ranges);
+    SET_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK);
+}
+
+
+// Most membership tests are for ASCII, where a caseless test only needs
+// to try flipping the case bit of a letter.  Doing that inline keeps PARSE
+// and FIND on a bitset out of the general routine for most characters.
+//
+inline static bool Check_Bit(REBSER *bset, REBLEN c, bool uncased) {
+    if (c >= 0x80)
+        return Check_Bit_Core(bset, c, uncased);
+
+    REBLEN len = SER_USED(bset);
+    const REBYTE *bp = BIN_HEAD(bset);
+
+    bool flag = (c >> 3) < len and (bp[c >> 3] & (1 << (7 - (c & 7))));
+    if (not flag and uncased and (c | 0x20) >= 'a' and (c | 0x20) <= 'z') {
+        c ^= 0x20;  // other case
+        flag = (c >> 3) < len and (bp[c >> 3] & (1 << (7 - (c & 7))));
+    }
+
+    return BITS_NOT(bset) ? not flag : flag;
+}
+
+
 inline static REBBIN *VAL_BITSET(const REBCEL *v) {
     assert(CELL_KIND(v) == REB_BITSET);
     return SER(VAL_NODE(v));
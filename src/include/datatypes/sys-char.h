@@ -227,6 +227,8 @@ enum {
 
 #define UNICODE_CASES 0x2E00  // size of unicode folding table
 
+#define ASCII_RUN_MIN 16  // less isn't worth a Match_Ascii_Run() call
+
 inline static REBUNI UP_CASE(REBUNI c)
   { return c < UNICODE_CASES ? Upper_Cases[c] : c; }
 
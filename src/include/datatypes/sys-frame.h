@@ -847,6 +847,14 @@ inline static REBVAL *D_ARG_Core(REBFRM *f, REBLEN n) {  // 1 for first arg
 #define RETURN(v) \
     return Move_Value(D_OUT, (v));
 
+// A native whose errors are often TRAP'd as a matter of course (e.g. by code
+// that uses errors to signal malformed input) can return its error instead
+// of fail()ing it.  That gets it to the TRAP as a throw, without the longjmp
+// and the frame-by-frame cleanup of Fail_Core().  See Raise_Error_Core().
+//
+#define RAISE(error) \
+    return Raise_Error_Core(frame_, (error))
+
 
 // The native entry prelude makes sure that once native code starts running,
 // then the frame's stub is flagged to indicate access via a FRAME! should
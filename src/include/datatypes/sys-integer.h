@@ -34,18 +34,35 @@
 // for these cases.
 //
 
+// An INTEGER! whose value doesn't fit in 64 bits keeps its magnitude in a
+// series instead, see %f-bigint.c.  Asking for such a number's 64-bit value
+// is an overflow error (as the arithmetic that made it once was).
+//
+#define IS_INTEGER_BIG(v) \
+    GET_CELL_FLAG((v), FIRST_IS_NODE)
+
 #if defined(NDEBUG) || !defined(CPLUSPLUS_11) 
+    inline static REBI64 *VAL_INT64_Ptr(const REBCEL *v) {
+        if (IS_INTEGER_BIG(v))
+            fail (Error_Overflow_Raw());
+        return &PAYLOAD(Integer, m_cast(REBCEL*, v)).i64;
+    }
+
     #define VAL_INT64(v) \
-        PAYLOAD(Integer, (v)).i64
+        (*VAL_INT64_Ptr(v))
 #else
     // allows an assert, but also lvalue: `VAL_INT64(v) = xxx`
     //
     inline static REBI64 & VAL_INT64(REBCEL *v) { // C++ reference type
         assert(CELL_KIND(v) == REB_INTEGER);
+        if (IS_INTEGER_BIG(v))
+            fail (Error_Overflow_Raw());
         return PAYLOAD(Integer, v).i64;
     }
     inline static REBI64 VAL_INT64(const REBCEL *v) {
         assert(CELL_KIND(v) == REB_INTEGER);
+        if (IS_INTEGER_BIG(v))
+            fail (Error_Overflow_Raw());
         return PAYLOAD(Integer, v).i64;
     }
 #endif
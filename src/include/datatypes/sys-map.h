@@ -21,8 +21,23 @@
 //=////////////////////////////////////////////////////////////////////////=//
 //
 // Maps are implemented as a light hashing layer on top of an array.  The
-// hash indices are stored in the series node's "misc", while the values are
-// retained in pairs as `[key val key val key val ...]`.
+// values are retained in pairs as `[key val key val key val ...]`, and the
+// hashlist linked from the pairlist's node holds the table of slots.
+//
+// The table is a power of two in size, and uses linear probing ordered by
+// "Robin Hood" displacement: a key being inserted takes the slot of any key
+// that is closer to its home slot than the new key is to its own.  That
+// keeps probe sequences short and lets a failed lookup stop as soon as it
+// reaches a key that is "richer" than the one being sought.  Each slot also
+// keeps the full 32-bit hash, so most mismatched keys are rejected without
+// calling Cmp_Value(), and the distance of a key from its home slot can be
+// computed without rehashing the key.
+//
+// Removing a key sets its value to null, leaving a "zombie" pair in the
+// pairlist.  Its slot is removed from the table right away (shifting any
+// later keys in the run back), so lookups never walk over zombies.  When
+// the table fills up and half of the pairs are zombies, the pairlist is
+// compacted instead of the table being grown.
 //
 // When there are too few values to warrant hashing, no hash indices are
 // made and the array is searched linearly.  This is indicated by the hashlist
@@ -45,6 +60,29 @@ struct Reb_Map {
     struct Reb_Array pairlist;  // hashlist is held in ->link.hashlist
 };
 
+// A hashlist is a series of these.  An index of 0 means the slot is empty,
+// otherwise it is the 1-based record number of the key in the data array.
+//
+struct Reb_Hash_Slot {
+    uint32_t index;
+    uint32_t hash;  // full Hash_Value() of the key, lower bits pick home slot
+};
+
+// Slot indexes are 32-bit, and lookups need at least one empty slot.
+//
+#define MAX_HASH_SLOTS \
+    (cast(REBLEN, 1) << 31)
+
+// How far the key in a slot has been pushed from the slot its hash picks.
+//
+inline static REBLEN Hash_Slot_Distance(
+    const struct Reb_Hash_Slot *slots,
+    REBLEN slot,
+    REBLEN mask  // table size minus one (size is a power of 2)
+){
+    return (slot - (slots[slot].hash & mask)) & mask;
+}
+
 // The MAP! datatype uses this.
 //
 #define LINK_HASHLIST_NODE(s)       LINK(s).custom.node
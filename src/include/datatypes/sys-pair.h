@@ -27,9 +27,16 @@
 // series in the pool so that they abutted against END markers.  It would be
 // premature optimization to do it right now, but the design leaves it open.
 //
-// PAIR! values are implemented using the pairing in Ren-C, which is to say
-// that they are garbage collected and can hold any two values--not just
-// two numbers.
+// PAIR! values hold two numbers--INTEGER!, DECIMAL! or PERCENT!--so each
+// one is 8 bytes plus its kind.  On 64-bit platforms that fits in the cell:
+// the numbers are in the payload and their kinds are in the extra.  Since
+// PAIR!s are made in bulk by graphics and layout code, this saves a node
+// allocation (and a node for the GC to mark and sweep) for each one.
+//
+// 32-bit platforms don't have the room, so there a PAIR! points to a pairing
+// holding two cells.  Code shouldn't care which is in use; use Get_Pair_X()
+// and Get_Pair_Y() to get the numbers as cells, and Init_Pair() to make a
+// pair from cells.
 //
 
 inline static REBVAL *PAIRING_KEY(REBVAL *paired) {
@@ -37,8 +44,113 @@ inline static REBVAL *PAIRING_KEY(REBVAL *paired) {
 }
 
 
+#if PAIR_INLINE
+
+#define VAL_PAIR_X_KIND(v) \
+    cast(enum Reb_Kind, EXTRA(Any, (v)).u & 0xFF)
+
+#define VAL_PAIR_Y_KIND(v) \
+    cast(enum Reb_Kind, EXTRA(Any, (v)).u >> 8)
+
+inline static void Set_Pair_Number(
+    union Reb_Pair_Number *n,
+    enum Reb_Kind *kind,
+    const RELVAL *v
+){
+    *kind = VAL_TYPE(v);
+    if (*kind == REB_INTEGER)
+        n->i64 = VAL_INT64(v);
+    else {
+        assert(*kind == REB_DECIMAL or *kind == REB_PERCENT);
+        n->dec = VAL_DECIMAL(v);
+    }
+}
+
+inline static REBVAL *Get_Pair_Number(
+    RELVAL *out,
+    const union Reb_Pair_Number *n,
+    enum Reb_Kind kind
+){
+    if (kind == REB_INTEGER)
+        return Init_Integer(out, n->i64);
+    if (kind == REB_PERCENT)
+        return Init_Percent(out, n->dec);
+    assert(kind == REB_DECIMAL);
+    return Init_Decimal(out, n->dec);
+}
+
+inline static REBVAL *Get_Pair_X(RELVAL *out, const REBCEL *v) {
+    assert(CELL_KIND(v) == REB_PAIR);
+    return Get_Pair_Number(out, &PAYLOAD(Pair, v).x, VAL_PAIR_X_KIND(v));
+}
+
+inline static REBVAL *Get_Pair_Y(RELVAL *out, const REBCEL *v) {
+    assert(CELL_KIND(v) == REB_PAIR);
+    return Get_Pair_Number(out, &PAYLOAD(Pair, v).y, VAL_PAIR_Y_KIND(v));
+}
+
+inline static REBDEC VAL_PAIR_X_DEC(const REBCEL *v) {
+    if (VAL_PAIR_X_KIND(v) == REB_INTEGER)
+        return cast(REBDEC, PAYLOAD(Pair, v).x.i64);
+    return PAYLOAD(Pair, v).x.dec;
+}
+
+inline static REBDEC VAL_PAIR_Y_DEC(const REBCEL *v) {
+    if (VAL_PAIR_Y_KIND(v) == REB_INTEGER)
+        return cast(REBDEC, PAYLOAD(Pair, v).y.i64);
+    return PAYLOAD(Pair, v).y.dec;
+}
+
+inline static REBI64 VAL_PAIR_X_INT(const REBCEL *v) {
+    if (VAL_PAIR_X_KIND(v) == REB_INTEGER)
+        return PAYLOAD(Pair, v).x.i64;
+    return ROUND_TO_INT(PAYLOAD(Pair, v).x.dec);
+}
+
+inline static REBDEC VAL_PAIR_Y_INT(const REBCEL *v) {
+    if (VAL_PAIR_Y_KIND(v) == REB_INTEGER)
+        return PAYLOAD(Pair, v).y.i64;
+    return ROUND_TO_INT(PAYLOAD(Pair, v).y.dec);
+}
+
+inline static REBVAL *Init_Pair(
+    RELVAL *out,
+    const RELVAL *x,
+    const RELVAL *y
+){
+    assert(ANY_NUMBER(x));
+    assert(ANY_NUMBER(y));
+
+    RESET_CELL(out, REB_PAIR, CELL_MASK_NONE);
+
+    enum Reb_Kind x_kind;
+    enum Reb_Kind y_kind;
+    Set_Pair_Number(&PAYLOAD(Pair, out).x, &x_kind, x);
+    Set_Pair_Number(&PAYLOAD(Pair, out).y, &y_kind, y);
+    EXTRA(Any, out).u = x_kind | (y_kind << 8);
+    return KNOWN(out);
+}
+
+inline static REBVAL *Init_Pair_Int(RELVAL *out, REBI64 x, REBI64 y) {
+    RESET_CELL(out, REB_PAIR, CELL_MASK_NONE);
+    PAYLOAD(Pair, out).x.i64 = x;
+    PAYLOAD(Pair, out).y.i64 = y;
+    EXTRA(Any, out).u = REB_INTEGER | (REB_INTEGER << 8);
+    return KNOWN(out);
+}
+
+inline static REBVAL *Init_Pair_Dec(RELVAL *out, REBDEC x, REBDEC y) {
+    RESET_CELL(out, REB_PAIR, CELL_MASK_NONE);
+    PAYLOAD(Pair, out).x.dec = x;
+    PAYLOAD(Pair, out).y.dec = y;
+    EXTRA(Any, out).u = REB_DECIMAL | (REB_DECIMAL << 8);
+    return KNOWN(out);
+}
+
+#else  // !PAIR_INLINE, so the X and Y cells are in a pairing
+
 #define VAL_PAIR_NODE(v) \
-    PAYLOAD(Any, (v)).first.node 
+    PAYLOAD(Any, (v)).first.node
 
 inline static REBVAL *VAL_PAIRING(const REBCEL *v) {
     assert(CELL_KIND(v) == REB_PAIR);
@@ -51,6 +163,12 @@ inline static REBVAL *VAL_PAIRING(const REBCEL *v) {
 #define VAL_PAIR_Y(v) \
     VAL(VAL_PAIRING(v))
 
+inline static REBVAL *Get_Pair_X(RELVAL *out, const REBCEL *v)
+  { return Move_Value(out, VAL_PAIR_X(v)); }
+
+inline static REBVAL *Get_Pair_Y(RELVAL *out, const REBCEL *v)
+  { return Move_Value(out, VAL_PAIR_Y(v)); }
+
 inline static REBDEC VAL_PAIR_X_DEC(const REBCEL *v) {
     if (IS_INTEGER(VAL_PAIR_X(v)))
         return cast(REBDEC, VAL_INT64(VAL_PAIR_X(v)));
@@ -112,6 +230,8 @@ inline static REBVAL *Init_Pair_Dec(RELVAL *out, REBDEC x, REBDEC y) {
     return KNOWN(out);
 }
 
+#endif
+
 inline static REBVAL *Init_Zeroed_Hack(RELVAL *out, enum Reb_Kind kind) {
     //
     // !!! This captures of a dodgy behavior of R3-Alpha, which was to assume
@@ -286,13 +286,41 @@ inline static REBYTE *SER_LAST_RAW(size_t w, REBSER *s) {
     ((SER_USED(s) + (n) + 1) <= SER_REST(s))
 
 
+// Write barrier for the generational and incremental GC modes.  If an old
+// series gets a reference to a series allocated after the last collection, a
+// minor collection would not find it (old series are not traced).  Similarly
+// if a series that incremental marking has already scanned gets a reference
+// to one not yet marked, it would be missed.  So any code path that mutates
+// a series calls this first, adding it to the "remembered set".
+//
+// A couple of bit tests when neither mode is in use; no series are old then.
+//
+// Appends reach it through EXPAND_SERIES_TAIL() (so Alloc_Tail_Array() and
+// Append_Value() are covered), and other changes through FAIL_IF_READ_ONLY()
+// or Expand_Series().  Contexts, frames, and maps are written all over, so
+// Mark_Root_Series() treats any such old (or already marked) series as a
+// root instead.  Code that writes directly into ARR_AT() cells of an array
+// which may be old or marked must call this itself.
+//
+inline static void Note_Series_Mutation(REBSER *s) {
+    if (
+        GET_SERIES_INFO(s, GC_OLD)
+        or (GC_Marking and (s->header.bits & NODE_FLAG_MARKED))
+    ){
+        SET_SERIES_INFO(s, GC_REMEMBERED);
+    }
+}
+
+
 //
 // Optimized expand when at tail (but, does not reterminate)
 //
 
 inline static void EXPAND_SERIES_TAIL(REBSER *s, REBLEN delta) {
-    if (SER_FITS(s, delta))
+    if (SER_FITS(s, delta)) {
+        Note_Series_Mutation(s);  // caller will write the new tail cells
         SET_SERIES_USED(s, SER_USED(s) + delta);  // no termination implied
+    }
     else
         Expand_Series(s, SER_USED(s), delta);  // currently terminates
 
@@ -559,8 +587,26 @@ inline static bool Is_Series_Read_Only(REBSER *s) { // may be temporary...
 //
 
 inline static void FAIL_IF_READ_ONLY_SER(REBSER *s) {
-    if (not Is_Series_Read_Only(s))
+    if (not Is_Series_Read_Only(s)) {
+        Note_Series_Mutation(s);  // checked for mutability, assume it mutates
+
+        if (
+            IS_SER_ARRAY(s)
+            and (s->header.bits & (
+                ARRAY_FLAG_HAS_HASH_INDEX | ARRAY_FLAG_HAS_COMPOSE_CACHE
+            ))
+            and NOT_ARRAY_FLAG(s, IS_VARLIST)
+            and NOT_ARRAY_FLAG(s, IS_PARAMLIST)
+        ){
+            if (GET_ARRAY_FLAG(s, HAS_HASH_INDEX))
+                HASH_INDEX_COUNT(LINK_HASH_INDEX(s)) = -1;  // rebuild first
+            CLEAR_ARRAY_FLAG(s, HAS_COMPOSE_CACHE);  // rescan before use
+        }
         return;
+    }
+
+    // Read-only series don't get here unless the write is going to fail, so
+    // they never pay for the write barrier or cache invalidation.
 
     if (GET_SERIES_INFO(s, AUTO_LOCKED))
         fail (Error_Series_Auto_Locked_Raw());
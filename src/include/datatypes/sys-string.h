@@ -37,7 +37,8 @@
 //
 // * Maintaining caches (called "Bookmarks") that map from codepoint indexes
 //   to byte offsets for larger strings.  These caches must be updated
-//   whenever the string is modified.   !!! Only one bookmark per string ATM
+//   whenever the string is modified.  A few are kept per string, see
+//   STR_MAX_BOOKMARKS.
 //
 //=//// NOTES /////////////////////////////////////////////////////////////=//
 //
@@ -334,37 +335,35 @@ inline static bool IS_SER_STRING(REBSER *s) {
 }
 
 // While the content format is UTF-8 for both ANY-STRING! and ANY-WORD!, the
-// MISC() and LINK() fields are used differently.  A string caches its length
-// in codepoints so that doesn't have to be recalculated, and it also has
-// caches of "bookmarks" mapping codepoint indexes to byte offsets.  Words
-// store a pointer that is used in a circularly linked list to find their
-// canon spelling form...as well as hold binding information.
+// LINK() field is used differently.  Both cache their length in codepoints
+// in MISC() so that doesn't have to be recalculated.  A string also has
+// caches of "bookmarks" mapping codepoint indexes to byte offsets, while
+// words store a pointer that is used in a circularly linked list to find
+// their canon spelling form.
 //
 #define IS_STR_SYMBOL(s) \
     NOT_SERIES_FLAG((s), UTF8_NONWORD)
 
 
-//=//// STRING ALL-ASCII FLAG /////////////////////////////////////////////=//
+//=//// STRING ALL-ASCII CHECK ////////////////////////////////////////////=//
 //
 // One of the best optimizations that can be done on strings is to keep track
-// of if they contain only ASCII codepoints.  Such a flag would likely have
-// false negatives, unless all removals checked the removed portion for if
-// the ASCII flag is true.  It could be then refreshed by any routine that
-// walks an entire string for some other reason (like molding or printing).
+// of if they contain only ASCII codepoints, since then a codepoint index is
+// the same as a byte offset and no scanning or bookmarks are needed.
 //
-// For the moment, we punt on this optimization.  The main reason is that it
-// means the non-ASCII code is exercised on every code path, which is a good
-// substitute for finding high-codepoint data to pass through to places that
-// would not receive it otherwise.
+// A separate flag would have false negatives, unless all removals checked
+// the removed portion for non-ASCII codepoints.  But there's no need for
+// one: every codepoint takes at least one byte, so the cached codepoint
+// length of a string is equal to its byte size exactly when all
+// of its codepoints are ASCII.  That comes for free from every mutation that
+// keeps the length up to date (which they all must do anyway).
 //
-// But ultimately this optimization will be necessary, and decisions on how
-// up-to-date the flag should be kept would need to be made.
-
-#define Is_Definitely_Ascii(s) false
-
-inline static bool Is_String_Definitely_ASCII(const RELVAL *str) {
-    UNUSED(str);
-    return false;
+// Symbols count their codepoints when interned, so this works for them too.
+// (In DEBUG_UTF8_EVERYWHERE builds, a trashed length is always larger than
+// the size, so it won't give a false positive.)
+//
+inline static bool Is_Definitely_Ascii(REBSTR *s) {
+    return MISC(s).length == SER_USED(SER(s));
 }
 
 inline static const char *STR_UTF8(REBSTR *s) {
@@ -383,48 +382,43 @@ inline static size_t STR_SIZE(REBSTR *s) {
     cast(REBCHR(*), SER_TAIL(REBYTE, SER(s)))
 
 inline static REBLEN STR_LEN(REBSTR *s) {
-    if (Is_Definitely_Ascii(s))
-        return STR_SIZE(s);
+    // The length is cached for all strings, including symbols, and every
+    // mutation has to keep it up to date (see Verify_Str_Len_Debug()).
+    //
+  #if defined(DEBUG_UTF8_EVERYWHERE)
+    if (MISC(s).length > SER_USED(s)) // includes 0xDECAFBAD
+        panic(s);
+  #endif
+    return MISC(s).length;
+}
 
-    if (not IS_STR_SYMBOL(s)) {  // length is cached for non-ANY-WORD! strings
-      #if defined(DEBUG_UTF8_EVERYWHERE)
-        if (MISC(s).length > SER_USED(s)) // includes 0xDECAFBAD
-            panic(s);
-      #endif
-        return MISC(s).length;
-    }
 
-    // Have to do it the slow way if it's a symbol series...but hopefully
-    // they're not too long (since spaces and newlines are illegal.)
+#if defined(DEBUG_VERIFY_STR_LEN)
     //
-    REBLEN len = 0;
-    REBCHR(const*) ep = STR_TAIL(s);
-    REBCHR(const*) cp = STR_HEAD(s);
-    while (cp != ep) {
-        cp = NEXT_STR(cp);
-        ++len;
+    // Recount the codepoints and check them against the cached length.  This
+    // is a full scan, so it is only done at checkpoints (e.g. after each
+    // native returns a string) in builds that ask for it.
+    //
+    inline static void Verify_Str_Len_Debug(REBSTR *s) {
+        REBLEN len = 0;
+        const REBYTE *bp = BIN_HEAD(SER(s));
+        const REBYTE *ep = bp + SER_USED(SER(s));
+        for (; bp != ep; ++bp)
+            if ((*bp & 0xC0) != 0x80)
+                ++len;
+        if (len != MISC(s).length)
+            panic (s);
     }
-    return len;
-}
+#endif
 
 inline static REBLEN STR_INDEX_AT(REBSTR *s, REBSIZ offset) {
     if (Is_Definitely_Ascii(s))
         return offset;
 
-    assert(*BIN_AT(SER(s), offset) < 0x80);  // must be codepoint boundary
-
-    if (not IS_STR_SYMBOL(s)) {  // length is cached for non-ANY-WORD! strings
-      #if defined(DEBUG_UTF8_EVERYWHERE)
-        if (MISC(s).length > SER_USED(s)) // includes 0xDECAFBAD
-            panic(s);
-      #endif
-
-        // We have length and bookmarks.  We should build STR_AT() based on
-        // this routine.  For now, fall through and do it slowly.
-    }
+    assert(not Is_Continuation_Byte_If_Utf8(*BIN_AT(SER(s), offset)));
 
-    // Have to do it the slow way if it's a symbol series...but hopefully
-    // they're not too long (since spaces and newlines are illegal.)
+    // !!! Strings have bookmarks mapping index to offset, and we could build
+    // STR_AT() on this routine.  For now, do it the slow way.
     //
     REBLEN index = 0;
     REBCHR(const*) ep = cast(REBCHR(const*), BIN_AT(SER(s), offset));
@@ -465,6 +459,20 @@ inline static void TERM_STR_LEN_SIZE(REBSTR *s, REBLEN len, REBSIZ used) {
 // A "bookmark" in this terminology is simply a small REBSER-sized node which
 // holds a mapping from an index to an offset in a string.  It is pointed to
 // by the string's LINK() field in the series node.
+//
+// A string may have up to STR_MAX_BOOKMARKS of them, chained through the
+// LINK() of each bookmark and kept in most-recently-used order.  This way
+// code alternating between distant parts of a large string (e.g. the head
+// and tail of a log being parsed) doesn't keep dragging one bookmark back
+// and forth, rescanning everything in between.
+
+#define STR_MAX_BOOKMARKS 8
+
+// If an access is further than this from every bookmark, a bookmark is
+// added for it (or the least recently used one is moved) rather than the
+// closest one being dragged away from where it was useful.
+//
+#define STR_BOOKMARK_SPAN 4096
 
 #define BMK_INDEX(b) \
     PAYLOAD(Bookmark, ARR_SINGLE(b)).index
@@ -472,6 +480,9 @@ inline static void TERM_STR_LEN_SIZE(REBSTR *s, REBLEN len, REBSIZ used) {
 #define BMK_OFFSET(b) \
     PAYLOAD(Bookmark, ARR_SINGLE(b)).offset
 
+#define BMK_NEXT(b) \
+    LINK(b).bookmarks
+
 inline static REBBMK* Alloc_Bookmark(void) {
     REBARR *bookmark = Alloc_Singular(SERIES_FLAG_MANAGED);
     CLEAR_SERIES_FLAG(bookmark, MANAGED);  // so it's manual but untracked
@@ -489,29 +500,69 @@ inline static REBBMK* Alloc_Bookmark(void) {
 
 inline static void Free_Bookmarks_Maybe_Null(REBSTR *s) {
     assert(not IS_STR_SYMBOL(s));  // call on string
-    if (LINK(s).bookmarks)
-        GC_Kill_Series(SER(LINK(s).bookmarks));  // recursive free whole list
+    REBBMK *bookmark = LINK(s).bookmarks;
+    while (bookmark) {
+        REBBMK *next = BMK_NEXT(bookmark);
+        GC_Kill_Series(SER(bookmark));
+        bookmark = next;
+    }
     LINK(s).bookmarks = nullptr;
 }
 
+// Keep bookmarks in sync when `old_len` codepoints (`old_size` bytes) at
+// index `at` (byte `offset`) are replaced by `new_len` codepoints taking up
+// `new_size` bytes.  Use 0 for the old amounts on insertion, and 0 for the
+// new amounts on removal.  Bookmarks in the replaced span move to its start,
+// and those after it slide by the difference.
+//
+// Call this after the length of the string has been updated.
+//
+inline static void Adjust_Bookmarks(
+    REBSTR *s,
+    REBLEN at,
+    REBSIZ offset,
+    REBLEN old_len,
+    REBSIZ old_size,
+    REBLEN new_len,
+    REBSIZ new_size
+){
+    if (STR_LEN(s) < sizeof(REBVAL) or Is_Definitely_Ascii(s)) {  // unused
+        Free_Bookmarks_Maybe_Null(s);
+        return;
+    }
+
+    REBBMK *bookmark = LINK(s).bookmarks;
+    for (; bookmark; bookmark = BMK_NEXT(bookmark)) {
+        if (BMK_INDEX(bookmark) <= at)
+            continue;
+        if (BMK_INDEX(bookmark) < at + old_len) {
+            BMK_INDEX(bookmark) = at;
+            BMK_OFFSET(bookmark) = offset;
+            continue;
+        }
+        BMK_INDEX(bookmark) = BMK_INDEX(bookmark) - old_len + new_len;
+        BMK_OFFSET(bookmark) = BMK_OFFSET(bookmark) - old_size + new_size;
+    }
+}
+
 #if !defined(NDEBUG)
     inline static void Check_Bookmarks_Debug(REBSTR *s) {
         REBBMK *bookmark = LINK(s).bookmarks;
-        if (not bookmark)
-            return;
-
-        assert(not LINK(SER(bookmark)).bookmarks);
+        REBLEN count = 0;
+        for (; bookmark; bookmark = BMK_NEXT(bookmark)) {
+            assert(++count <= STR_MAX_BOOKMARKS);
 
-        REBLEN index = BMK_INDEX(bookmark);
-        REBSIZ offset = BMK_OFFSET(bookmark);
+            REBLEN index = BMK_INDEX(bookmark);
+            REBSIZ offset = BMK_OFFSET(bookmark);
 
-        REBCHR(*) cp = STR_HEAD(s);
-        REBLEN i;
-        for (i = 0; i != index; ++i)
-            cp = NEXT_STR(cp);
+            REBCHR(*) cp = STR_HEAD(s);
+            REBLEN i;
+            for (i = 0; i != index; ++i)
+                cp = NEXT_STR(cp);
 
-        REBSIZ actual = cast(REBYTE*, cp) - SER_DATA_RAW(SER(s));
-        assert(actual == offset);
+            REBSIZ actual = cast(REBYTE*, cp) - SER_DATA_RAW(SER(s));
+            assert(actual == offset);
+        }
     }
 #endif
 
@@ -536,10 +587,8 @@ inline static void Free_Bookmarks_Maybe_Null(REBSTR *s) {
 inline static REBCHR(*) STR_AT(REBSTR *s, REBLEN at) {
     assert(at <= STR_LEN(s));
 
-    if (Is_Definitely_Ascii(s)) {  // can't have any false positives
-        assert(not LINK(s).bookmarks);  // mutations must ensure this
+    if (Is_Definitely_Ascii(s))  // can't have any false positives
         return cast(REBCHR(*), cast(REBYTE*, STR_HEAD(s)) + at);
-    }
 
     REBCHR(*) cp;  // can be used to calculate offset (relative to STR_HEAD())
     REBLEN index;
@@ -562,66 +611,83 @@ inline static REBCHR(*) STR_AT(REBSTR *s, REBLEN at) {
     BOOKMARK_TRACE("%s", bookmark ? "bookmarked" : "no bookmark");
   #endif
 
-    if (at < len / 2) {
-        if (len < sizeof(REBVAL)) {
-            if (not IS_STR_SYMBOL(s))
-                assert(
-                    GET_SERIES_FLAG(s, ALWAYS_DYNAMIC)  // e.g. mold buffer
-                    or not bookmark  // mutations must ensure this
-                );
+    if (len < sizeof(REBVAL) or IS_STR_SYMBOL(s)) {
+        if (not IS_STR_SYMBOL(s))
+            assert(
+                GET_SERIES_FLAG(s, ALWAYS_DYNAMIC)  // e.g. mold buffer
+                or not bookmark  // mutations must ensure this
+            );
+        bookmark = nullptr;
+        if (at < len / 2)
             goto scan_from_head;  // good locality, avoid bookmark logic
-        }
-        if (not bookmark and not IS_STR_SYMBOL(s)) {
-            LINK(s).bookmarks = bookmark = Alloc_Bookmark();
-            goto scan_from_head;  // will fill in bookmark
-        }
-    }
-    else {
-        if (len < sizeof(REBVAL)) {
-            if (not IS_STR_SYMBOL(s))
-                assert(
-                    not bookmark  // mutations must ensure this usually but...
-                    or GET_SERIES_FLAG(s, ALWAYS_DYNAMIC)  // !!! mold buffer?
-                );
-            goto scan_from_tail;  // good locality, avoid bookmark logic
-        }
-        if (not bookmark and not IS_STR_SYMBOL(s)) {
-            LINK(s).bookmarks = bookmark = Alloc_Bookmark();
-            goto scan_from_tail;  // will fill in bookmark
-        }
+        goto scan_from_tail;
     }
 
-    // Theoretically, a large UTF-8 string could have multiple "bookmarks".
-    // That would complicate this logic by having to decide which one was
-    // closest to be using.  For simplicity we just use one right now to
-    // track the last access--which speeds up the most common case of an
-    // iteration.  Improve as time permits!
+  blockscope {
     //
-    assert(not bookmark or not LINK(bookmark).bookmarks);  // only one for now
+    // Find the closest bookmark.  Note the furthest back in the chain, as
+    // it is the least recently used (and the one to recycle if needed).
+    //
+    REBBMK *best = nullptr;
+    REBBMK *best_prior = nullptr;
+    REBLEN best_dist = len + 1;
+    REBBMK *last = nullptr;
+    REBBMK *last_prior = nullptr;
+    REBLEN count = 0;
+
+    REBBMK *prior = nullptr;
+    REBBMK *b = bookmark;
+    for (; b; prior = b, b = BMK_NEXT(b)) {
+        REBLEN booked = BMK_INDEX(b);
+        REBLEN dist = booked > at ? booked - at : at - booked;
+        if (dist < best_dist) {
+            best = b;
+            best_prior = prior;
+            best_dist = dist;
+        }
+        last = b;
+        last_prior = prior;
+        ++count;
+    }
 
-  blockscope {
-    REBLEN booked = BMK_INDEX(bookmark);
+    bool from_head = (at <= len - at);
+    REBLEN end_dist = from_head ? at : len - at;
+    bool from_best = (best and best_dist <= end_dist);
 
-    // `at` is always positive.  `booked - at` may be negative, but if it
-    // is positive and bigger than `at`, faster to seek from head.
+    // Decide which bookmark (if any) will cache this access.  Scanning a
+    // short way from the head or tail isn't worth caching.
     //
-    if (cast(REBINT, at) < cast(REBINT, booked) - cast(REBINT, at)) {
-        if (booked > sizeof(REBVAL))
-            bookmark = nullptr;  // don't throw away bookmark for low searches
-        goto scan_from_head;
+    if (not from_best and end_dist <= sizeof(REBVAL))
+        bookmark = nullptr;
+    else if (best and best_dist <= STR_BOOKMARK_SPAN) {
+        bookmark = best;
+        prior = best_prior;
+    }
+    else if (count < STR_MAX_BOOKMARKS) {
+        bookmark = Alloc_Bookmark();
+        BMK_NEXT(bookmark) = LINK(s).bookmarks;
+        LINK(s).bookmarks = bookmark;
+        prior = nullptr;  // already at the front
+    }
+    else {
+        bookmark = last;  // recycle least recently used
+        prior = last_prior;
     }
 
-    // `len - at` is always positive.  `at - booked` may be negative, but if
-    // it is positive and bigger than `len - at`, faster to seek from tail.
-    //
-    if (cast(REBINT, len - at) < cast(REBINT, at) - cast(REBINT, booked)) {
-        if (booked > sizeof(REBVAL))
-            bookmark = nullptr;  // don't throw away bookmark for low searches
+    if (bookmark and prior) {  // move to front, as most recently used
+        BMK_NEXT(prior) = BMK_NEXT(bookmark);
+        BMK_NEXT(bookmark) = LINK(s).bookmarks;
+        LINK(s).bookmarks = bookmark;
+    }
+
+    if (not from_best) {
+        if (from_head)
+            goto scan_from_head;
         goto scan_from_tail;
     }
 
-    index = booked;
-    cp = cast(REBCHR(*), SER_DATA_RAW(SER(s)) + BMK_OFFSET(bookmark)); }
+    index = BMK_INDEX(best);
+    cp = cast(REBCHR(*), SER_DATA_RAW(SER(s)) + BMK_OFFSET(best)); }
 
     if (index > at) {
       #ifdef DEBUG_TRACE_BOOKMARKS
@@ -700,6 +766,9 @@ inline static REBSTR *VAL_STRING(const REBCEL *v) {
     return STR(VAL_NODE(v));  // VAL_SERIES() would assert
 }
 
+inline static bool Is_String_Definitely_ASCII(const RELVAL *str)
+  { return Is_Definitely_Ascii(VAL_STRING(str)); }
+
 inline static REBLEN VAL_LEN_HEAD(const REBCEL *v) {
     if (REB_BINARY == CELL_KIND(v))
         return SER_USED(VAL_SERIES(v));  // binaries can alias strings...
@@ -749,6 +818,11 @@ inline static REBSIZ VAL_SIZE_LIMIT_AT(
             *length = len_at;
         tail = VAL_STRING_TAIL(v);  // byte count known (fast)
     }
+    else if (Is_Definitely_Ascii(VAL_STRING(v))) {
+        if (length != nullptr)
+            *length = limit;
+        tail = cast(REBCHR(const*), cast(const REBYTE*, at) + limit);
+    }
     else {
         if (length != nullptr)
             *length = limit;
@@ -851,8 +925,10 @@ inline static void SET_CHAR_AT(REBSTR *s, REBLEN n, REBUNI c) {
         // that character position...
         //
         REBBMK *book = LINK(s).bookmarks;
-        if (book and BMK_OFFSET(book) > cp_offset)
-            BMK_OFFSET(book) += delta;
+        for (; book; book = BMK_NEXT(book)) {
+            if (BMK_OFFSET(book) > cp_offset)
+                BMK_OFFSET(book) += delta;
+        }
     }
 
     Encode_UTF8_Char(cp, c, size);
@@ -906,18 +982,32 @@ inline static REBSTR *Make_Sized_String_UTF8(const char *utf8, size_t size) {
 
 //=//// REBSTR HASHING ////////////////////////////////////////////////////=//
 
-inline static REBINT Hash_String(REBSTR *str)
-    { return Hash_UTF8(STR_HEAD(str), STR_SIZE(str)); }
+// Symbols are immutable, and their hash doesn't depend on case, so it is
+// computed once by Intern_UTF8_Managed() and stored after the terminator.
+// (Synonyms thus have the same hash as their canon.)
+//
+inline static uint32_t STR_SYMBOL_HASH(REBSTR *str) {
+    assert(IS_STR_SYMBOL(str));
+    uint32_t hash;
+    memcpy(&hash, BIN_AT(SER(str), STR_SIZE(str) + 1), sizeof(uint32_t));
+    return hash;
+}
+
+inline static REBINT Hash_String(REBSTR *str) {
+    if (IS_STR_SYMBOL(str))
+        return cast(REBINT, STR_SYMBOL_HASH(str));
+    return Hash_UTF8(STR_HEAD(str), STR_SIZE(str));
+}
 
 inline static REBINT First_Hash_Candidate_Slot(
     REBLEN *skip_out,
     REBLEN hash,
     REBLEN num_slots
 ){
-    *skip_out = (hash & 0x0000FFFF) % num_slots;
+    *skip_out = (hash >> 16) % num_slots;  // table size is prime, any works
     if (*skip_out == 0)
         *skip_out = 1;
-    return (hash & 0x00FFFF00) % num_slots;
+    return hash % num_slots;
 }
 
 
@@ -76,8 +76,16 @@ inline static REBSYM VAL_TYPE_SYM(const REBCEL *v) {
         return SYM_VECTOR_X;
     if (t == VAL_TYPE_CUSTOM(ext + 3))
         return SYM_GOB_X;
-    assert(t == VAL_TYPE_CUSTOM(ext + 4));
-    return SYM_STRUCT_X;
+    if (t == VAL_TYPE_CUSTOM(ext + 4))
+        return SYM_STRUCT_X;
+    if (t == VAL_TYPE_CUSTOM(ext + 5))
+        return SYM_TABLE_X;
+    if (t == VAL_TYPE_CUSTOM(ext + 6))
+        return SYM_PMAP_X;
+    if (t == VAL_TYPE_CUSTOM(ext + 7))
+        return SYM_PVECTOR_X;
+    assert(t == VAL_TYPE_CUSTOM(ext + 8));
+    return SYM_CACHE_X;
 }
 
 
@@ -106,16 +114,27 @@ inline static bool TYPE_CHECK(const REBCEL *v, REBYTE n) {
     return did (VAL_TYPESET_HIGH_BITS(v) & FLAGIT_KIND(n - 32));
 }
 
-inline static bool TYPE_CHECK_BITS(const REBCEL *v, REBU64 bits) {
-    uint_fast32_t low = bits & cast(uint32_t, 0xFFFFFFFF);
-    if (low & VAL_TYPESET_LOW_BITS(v))
-        return true;
+// All 64 bits of the typeset as one mask, pseudotypes included.  The two
+// halves live in different parts of the cell, but reading both and testing
+// once is cheaper than branching on which half a bit is in.
+//
+inline static REBU64 VAL_TYPESET_BITS(const REBCEL *v) {
+    return VAL_TYPESET_LOW_BITS(v)
+        | (cast(REBU64, VAL_TYPESET_HIGH_BITS(v)) << 32);
+}
 
-    uint_fast32_t high = bits >> 32;
-    if (high & VAL_TYPESET_HIGH_BITS(v))
-        return true;
+inline static bool TYPE_CHECK_BITS(const REBCEL *v, REBU64 bits) {
+    return did (VAL_TYPESET_BITS(v) & bits);
+}
 
-    return false;
+// Check the type of a value given its KIND_BYTE(), so that a quoted value
+// (kind byte of REB_64 or more) is checked as QUOTED!.  This is the test
+// most argument typechecks come down to, see Typecheck_Including_Quoteds().
+//
+inline static bool TYPE_CHECK_KIND_BYTE(const REBCEL *v, REBYTE kind_byte) {
+    if (kind_byte >= REB_64)
+        kind_byte = REB_QUOTED;
+    return did (VAL_TYPESET_BITS(v) & FLAGIT_KIND(kind_byte));
 }
 
 inline static void TYPE_SET(REBCEL *v, REBYTE n) {
@@ -129,7 +148,7 @@ inline static void TYPE_SET(REBCEL *v, REBYTE n) {
 
 inline static void TYPE_CLEAR(REBCEL *v, REBYTE n) {
     if (n < 32) {
-        VAL_TYPESET_HIGH_BITS(v) &= ~FLAGIT_KIND(n);
+        VAL_TYPESET_LOW_BITS(v) &= ~FLAGIT_KIND(n);
         return;
     }
     assert(n < REB_MAX_PLUS_MAX);
@@ -379,23 +398,34 @@ inline static REBVAL *Init_Param(
 // !!! Extended to also support checking for "refinement-style" paths, which
 // we consider anything starting with a slash (/foo, /foo/bar, /1234, etc.)
 //
+#define TS_QUOTED_OR_REFINED \
+    (FLAGIT_KIND(REB_TS_QUOTED_WORD) | FLAGIT_KIND(REB_TS_QUOTED_PATH) \
+        | FLAGIT_KIND(REB_TS_REFINED_PATH))
+
 inline static bool Typecheck_Including_Quoteds(
     const RELVAL *param,
     const RELVAL *v
 ){
-    if (TYPE_CHECK(param, VAL_TYPE(v)))
-        return true;
+    REBU64 bits = VAL_TYPESET_BITS(param);
+    REBYTE kind_byte = KIND_BYTE(v);
+    assert(kind_byte % REB_64 < REB_MAX);  // no END or pseudotypes
+
+    if (bits & FLAGIT_KIND(kind_byte >= REB_64 ? REB_QUOTED : kind_byte))
+        return true;  // the usual case, one test against the mask
+
+    if (not (bits & TS_QUOTED_OR_REFINED))
+        return false;  // the usual failure, none of the special cases apply
 
-    if (KIND_BYTE(v) == REB_WORD + REB_64)  // what was a "lit word"
-        if (TYPE_CHECK(param, REB_TS_QUOTED_WORD))
+    if (kind_byte == REB_WORD + REB_64)  // what was a "lit word"
+        if (bits & FLAGIT_KIND(REB_TS_QUOTED_WORD))
             return true;
 
-    if (KIND_BYTE(v) == REB_PATH + REB_64) // what was a "lit path"
-        if (TYPE_CHECK(param, REB_TS_QUOTED_PATH))
+    if (kind_byte == REB_PATH + REB_64) // what was a "lit path"
+        if (bits & FLAGIT_KIND(REB_TS_QUOTED_PATH))
             return true;
 
-    if (KIND_BYTE(v) == REB_PATH and IS_BLANK(ARR_HEAD(VAL_ARRAY(v))))
-        if (TYPE_CHECK(param, REB_TS_REFINED_PATH))
+    if (kind_byte == REB_PATH and IS_BLANK(ARR_HEAD(VAL_ARRAY(v))))
+        if (bits & FLAGIT_KIND(REB_TS_REFINED_PATH))
             return true;
 
     return false;
@@ -58,8 +58,20 @@ struct rebol_mem_pool {
     REBLEN units; // units per segment allocation
     REBLEN free; // number of units remaining
     REBLEN  has; // total number of units
+    REBLEN fills; // number of segments Fill_Pool() has added
+    REBLEN fills_since_recycle; // grows `units` if the pool fills often
+    REBLEN allocs; // Make_Node() calls, wraps (see STATS/POOLS, METRICS)
 };
 
+// Segments don't all have the same number of units, since a pool's `units`
+// grows as Fill_Pool() is called more often (see MEM_SEG_MAX).  So anything
+// enumerating the nodes of a segment must ask how many it holds.
+//
+inline static REBLEN Seg_Units(const REBPOL *pool, REBSEG *seg)
+{
+    return (seg->size - sizeof(REBSEG)) / pool->wide;
+}
+
 #define DEF_POOL(size, count) {size, count}
 #define MOD_POOL(size, count) {size * MEM_MIN_SIZE, count}
 
@@ -68,6 +80,12 @@ struct rebol_mem_pool {
 
 #define MEM_BALLAST 3000000
 
+#define MEM_SEG_MAX (4 * 1024 * 1024)  // largest segment geometric growth makes
+#define MEM_BALLAST_MAX 0x40000000  // GC_Ballast is a REBINT, cap at 1GB
+
+#define GC_GROWTH_DEFAULT 100  // RECYCLE/POLICY 'PROPORTIONAL allows 2x live
+#define GC_TARGET_DEFAULT 5  // RECYCLE/POLICY 'PAUSE aims for 5% time in GC
+
 enum Mem_Pool_Specs {
     MEM_TINY_POOL = 0,
     MEM_SMALL_POOLS = MEM_TINY_POOL + 16,
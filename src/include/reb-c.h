@@ -299,6 +299,25 @@
 #endif
 
 
+//=//// PREFETCH HINT ///////////////////////////////////////////////////////=//
+//
+// PREFETCH(p) hints that the memory at `p` will be read soon, so the CPU can
+// start bringing it into the cache.  It's only a hint: it doesn't fault, so
+// `p` needn't be valid, and it degrades to a no-op on compilers without it.
+//
+#if __has_builtin(__builtin_prefetch) || GCC_VERSION_AT_LEAST(3, 1)
+    #define PREFETCH(p) \
+        __builtin_prefetch(p)
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    #include <xmmintrin.h>
+    #define PREFETCH(p) \
+        _mm_prefetch((const char*)(p), _MM_HINT_T0)
+#else
+    #define PREFETCH(p) \
+        NOOP
+#endif
+
+
 //=//// CONDITIONAL C++ NAME MANGLING MACROS //////////////////////////////=//
 //
 // When linking C++ code, different functions with the same name need to be
@@ -356,6 +356,7 @@ Special internal defines used by RT, not Host-Kit developers:
 //
 #ifdef DEBUG_UTF8_EVERYWHERE
     #define DEBUG_VERIFY_STR_AT  // check cache correctness on every STR_AT
+    #define DEBUG_VERIFY_STR_LEN  // recount cached lengths at checkpoints
     #define DEBUG_SPORADICALLY_DROP_BOOKMARKS  // test bookmark absence
     #define DEBUG_BOOKMARKS_ON_MODIFY  // main routine for preserving marks
 #endif
@@ -410,3 +411,61 @@ Special internal defines used by RT, not Host-Kit developers:
         #error "DEBUG_PRINTF_FAIL_LOCATIONS requires DEBUG_STDIO_OK"
     #endif
 #endif
+
+
+// Building with REBOL_FAIL_USES_EXCEPTIONS makes fail() a C++ `throw` and
+// rebRescue() a try/catch, instead of a longjmp() and setjmp().  Entering a
+// try block costs nothing in the common table-based implementations, where
+// every setjmp() saves registers (and sigsetjmp() may make a system call to
+// save the signal mask).  The fail is what pays instead, in the unwinder.
+//
+// Every frame between a fail() and the rebRescue() that catches it must be
+// able to be unwound.  So everything has to be built as C++ (or C with
+// -fexceptions), extensions included.  Natives compiled at runtime by TCC
+// can't be unwound through, so their fail()s would terminate the process.
+//
+#if defined(REBOL_FAIL_USES_EXCEPTIONS)
+    #if !defined(__cplusplus)
+        #error "REBOL_FAIL_USES_EXCEPTIONS requires building as C++"
+    #endif
+#endif
+
+
+// Building with REB_THREAD_INSTANCES makes each OS thread that calls
+// rebStartup() get an interpreter of its own: all of the PVAR and TVAR
+// globals (frame stack, mold buffer, memory pools, GC state, symbol table,
+// etc.) become thread-local, so every thread has a separate heap and GC.
+// Such a thread must do all of its API calls itself and rebShutdown() when
+// it is done.  Values and handles can't be passed between threads.
+//
+// !!! Only the core is covered.  Devices and extensions keep process-wide
+// state of their own.  Windows can't dllexport thread-local data, so this
+// will not work with RL_API exports there.
+//
+// !!! Each instance boots its own lib, natives, symbols and mezzanine.  They
+// can't be shared read-only between instances yet:
+//
+// - The GC marks by writing NODE_FLAG_MARKED into each node's header.
+// - Symbols are GC'd and link synonyms into their canon's node.
+// - Words and actions hold pointers into lib, which would have to be
+//   recognized as belonging to another heap and skipped by the mark.
+// - Locked series still take ordinary writes (e.g. hashes and caches).
+//
+// SERIES_FLAG_FROZEN_HEAP (see FREEZE) is a node flag the GC honors without
+// writing, but the frozen heap is still per instance.  Sharing one needs
+// boot to allocate from a separate pool that is frozen after Startup_Core(),
+// with symbols and lib frozen into it.
+//
+#if defined(REB_THREAD_INSTANCES)
+    #if defined(__cplusplus) && __cplusplus >= 201103L
+        #define REB_INSTANCE_VAR thread_local
+    #elif defined(_MSC_VER)
+        #define REB_INSTANCE_VAR __declspec(thread)
+    #elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+        #define REB_INSTANCE_VAR _Thread_local
+    #else
+        #define REB_INSTANCE_VAR __thread  // GCC/Clang/TCC extension
+    #endif
+#else
+    #define REB_INSTANCE_VAR  // one interpreter per process
+#endif
@@ -75,7 +75,8 @@ enum {
     RDF_INIT = 1 << 0, // Device is initialized
     RDF_OPEN = 1 << 1, // Global open (for devs that cannot multi-open)
     // Options:
-    RDO_MUST_INIT = 1 << 2 // Do not allow auto init (manual init required)
+    RDO_MUST_INIT = 1 << 2, // Do not allow auto init (manual init required)
+    RDF_SOCKETS = 1 << 3 // Pending requests wait on `requestee.socket`
 
     // !!! There used to be something here called "RDO_AUTO_POLL" which said
     // "Poll device, even if no requests (e.g. interrupts)".  There were no
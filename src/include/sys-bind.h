@@ -22,26 +22,16 @@
 //
 // R3-Alpha had a per-thread "bind table"; a large and sparsely populated hash
 // into which index numbers would be placed, for what index those words would
-// have as keys or parameters.  Ren-C's strategy is that binding information
-// is wedged into REBSER nodes that represent the canon words themselves.
-//
-// This would create problems if multiple threads were trying to bind at the
-// same time.  While threading was never realized in R3-Alpha, Ren-C doesn't
-// want to have any "less of a plan".  So the Reb_Binder is used by binding
-// clients as a placeholder for whatever actual state would be used to augment
-// the information in the canon word series about which client is making a
-// request.  This could be coupled with some kind of lockfree adjustment
-// strategy whereby a word that was contentious would cause a structure to
-// "pop out" and be pointed to by some atomic thing inside the word.
-//
-// For the moment, a binder has some influence by saying whether the high 16
-// bits or low 16 bits of the canon's misc.index are used.  If the index
-// were atomic this would--for instance--allow two clients to bind at once.
-// It's just a demonstration of where more general logic using atomics
-// that could work for N clients would be.
-//
-// The debug build also adds another feature, that makes sure the clear count
-// matches the set count.
+// have as keys or parameters.  Ren-C originally wedged that information into
+// the REBSER nodes of the canon words themselves, which meant only as many
+// binds could be in progress as there were bits set aside in the canon.
+//
+// Now each Reb_Binder owns a small open-addressed table keyed by the canon
+// REBSTR*, so any number of binders can be in effect at once (including
+// nested ones) with no shared state.  The table starts out inside the binder
+// itself, so binding against a typical function spec or object never
+// allocates.  Larger tables live in an unmanaged series, which is freed by
+// SHUTDOWN_BINDER() or by the trap machinery if a bind fails.
 //
 // The binding will be either a REBACT (relative to a function) or a
 // REBCTX (specific to a context), or simply a plain REBARR such as
@@ -163,6 +153,50 @@ inline static bool Is_Overriding_Context(REBCTX *stored, REBCTX *override)
 }
 
 
+// Keying the cache on keylists instead of varlists means every instance of
+// an object shares the entry, and a keylist's ancestor is fixed at creation.
+// Expanding a shared keylist makes a new one, so such lookups just miss.
+// But a freed keylist's node could be reused for a new one, so the cache is
+// cleared by each recycle (see Invalidate_Override_Cache()).
+//
+inline static bool Is_Overriding_Context_Cached(
+    REBCTX *stored,
+    REBCTX *override
+){
+    REBNOD *stored_source = LINK_KEYSOURCE(stored);
+    REBNOD *override_source = LINK_KEYSOURCE(override);
+
+    // Running frames keep a REBFRM* as the keysource, and those are stack
+    // addresses that are reused all the time.  FRAME!s never override, so
+    // don't let them into the cache.
+    //
+    if (stored_source->header.bits & ARRAY_FLAG_IS_PARAMLIST)
+        return false;
+    if (override_source->header.bits & ARRAY_FLAG_IS_PARAMLIST)
+        return false;
+
+    if (stored_source == override_source)
+        return true;
+
+    uintptr_t hash = (
+        cast(uintptr_t, stored_source) ^ (cast(uintptr_t, override_source) >> 3)
+    ) >> 4;
+    REB_OVERRIDE_ENTRY *entry
+        = &TG_Override_Cache[hash & (OVERRIDE_CACHE_SIZE - 1)];
+
+    if (entry->stored == stored_source and entry->override == override_source)
+        return entry->overrides;
+
+    entry->stored = stored_source;
+    entry->override = override_source;
+    entry->overrides = Is_Overriding_Context(stored, override);
+    return entry->overrides;
+}
+
+inline static void Invalidate_Override_Cache(void)
+  { CLEAR(TG_Override_Cache, sizeof(TG_Override_Cache)); }
+
+
 // Modes allowed by Bind related functions:
 enum {
     BIND_0 = 0, // Only bind the words found in the context.
@@ -170,17 +204,25 @@ enum {
 };
 
 
+#define BINDER_LOCAL_SLOTS 32  // power of 2
+
+struct Reb_Binder_Slot {
+    REBSTR *canon;  // nullptr if the slot is empty
+    REBINT index;
+};
+
 struct Reb_Binder {
-    bool high;
-  #if !defined(NDEBUG)
+    struct Reb_Binder_Slot *slots;  // `local`, or head of `table`
+    REBLEN mask;  // number of slots minus one
     REBLEN count;
-  #endif
+    REBSER *table;  // nullptr until more than half the local slots are used
+    struct Reb_Binder_Slot local[BINDER_LOCAL_SLOTS];
 
   #if defined(CPLUSPLUS_11)
     //
     // The C++ debug build can help us make sure that no binder ever fails to
     // get an INIT_BINDER() and SHUTDOWN_BINDER() pair called on it, which
-    // would leave lingering binding values on REBSER nodes.
+    // would leak the table series of a big binder.
     //
     bool initialized;
     Reb_Binder () { initialized = false; }
@@ -190,28 +232,79 @@ struct Reb_Binder {
 
 
 inline static void INIT_BINDER(struct Reb_Binder *binder) {
-    binder->high = true; // !!! what about `did (SPORADICALLY(2))` to test?
-
-  #if !defined(NDEBUG)
+    binder->slots = binder->local;
+    binder->mask = BINDER_LOCAL_SLOTS - 1;
     binder->count = 0;
+    binder->table = nullptr;
+    memset(binder->local, 0, sizeof(binder->local));
 
-    #ifdef CPLUSPLUS_11
-        binder->initialized = true;
-    #endif
+  #ifdef CPLUSPLUS_11
+    binder->initialized = true;
   #endif
 }
 
 
 inline static void SHUTDOWN_BINDER(struct Reb_Binder *binder) {
-  #if !defined(NDEBUG)
     assert(binder->count == 0);
 
-    #ifdef CPLUSPLUS_11
-        binder->initialized = false;
-    #endif
+    if (binder->table)
+        Free_Unmanaged_Series(binder->table);
+
+  #ifdef CPLUSPLUS_11
+    binder->initialized = false;
   #endif
+}
+
 
-    UNUSED(binder);
+inline static REBLEN Binder_Slot(struct Reb_Binder *binder, REBSTR *canon) {
+    uintptr_t h = cast(uintptr_t, canon) >> 4;  // nodes are aligned
+    h *= cast(uintptr_t, 0x9E3779B97F4A7C15ull);  // Fibonacci hashing
+    return (h >> (sizeof(uintptr_t) * 4)) & binder->mask;
+}
+
+
+// Returns the slot holding the canon, or the empty slot where it would go.
+//
+inline static REBLEN Find_Binder_Slot(
+    struct Reb_Binder *binder,
+    REBSTR *canon
+){
+    assert(GET_SERIES_INFO(canon, STRING_CANON));
+
+    REBLEN slot = Binder_Slot(binder, canon);
+    while (
+        binder->slots[slot].canon != nullptr
+        and binder->slots[slot].canon != canon
+    ){
+        slot = (slot + 1) & binder->mask;
+    }
+    return slot;
+}
+
+
+inline static void Expand_Binder(struct Reb_Binder *binder) {
+    struct Reb_Binder_Slot *old_slots = binder->slots;
+    REBLEN old_num = binder->mask + 1;
+    REBSER *old_table = binder->table;
+
+    REBLEN num = old_num * 2;
+    binder->table = Make_Series(num, sizeof(struct Reb_Binder_Slot));
+    binder->slots = SER_HEAD(struct Reb_Binder_Slot, binder->table);
+    binder->mask = num - 1;
+    memset(binder->slots, 0, num * sizeof(struct Reb_Binder_Slot));
+
+    REBLEN n;
+    for (n = 0; n < old_num; ++n) {
+        if (old_slots[n].canon == nullptr)
+            continue;
+        REBLEN slot = Binder_Slot(binder, old_slots[n].canon);
+        while (binder->slots[slot].canon != nullptr)
+            slot = (slot + 1) & binder->mask;
+        binder->slots[slot] = old_slots[n];
+    }
+
+    if (old_table)
+        Free_Unmanaged_Series(old_table);
 }
 
 
@@ -223,21 +316,19 @@ inline static bool Try_Add_Binder_Index(
     REBINT index
 ){
     assert(index != 0);
-    assert(GET_SERIES_INFO(canon, STRING_CANON));
-    if (binder->high) {
-        if (MISC(canon).bind_index.high != 0)
-            return false;
-        MISC(canon).bind_index.high = index;
-    }
-    else {
-        if (MISC(canon).bind_index.low != 0)
-            return false;
-        MISC(canon).bind_index.low = index;
+
+    REBLEN slot = Find_Binder_Slot(binder, canon);
+    if (binder->slots[slot].canon != nullptr)
+        return false;
+
+    if ((binder->count + 1) * 2 > binder->mask + 1) {  // keep half empty
+        Expand_Binder(binder);
+        slot = Find_Binder_Slot(binder, canon);
     }
 
-  #if !defined(NDEBUG)
+    binder->slots[slot].canon = canon;
+    binder->slots[slot].index = index;
     ++binder->count;
-  #endif
     return true;
 }
 
@@ -257,12 +348,10 @@ inline static REBINT Get_Binder_Index_Else_0( // 0 if not present
     struct Reb_Binder *binder,
     REBSTR *canon
 ){
-    assert(GET_SERIES_INFO(canon, STRING_CANON));
-
-    if (binder->high)
-        return MISC(canon).bind_index.high;
-    else
-        return MISC(canon).bind_index.low;
+    REBLEN slot = Find_Binder_Slot(binder, canon);
+    if (binder->slots[slot].canon == nullptr)
+        return 0;
+    return binder->slots[slot].index;
 }
 
 
@@ -270,26 +359,30 @@ inline static REBINT Remove_Binder_Index_Else_0( // return old value if there
     struct Reb_Binder *binder,
     REBSTR *canon
 ){
-    assert(GET_SERIES_INFO(canon, STRING_CANON));
+    REBLEN slot = Find_Binder_Slot(binder, canon);
+    if (binder->slots[slot].canon == nullptr)
+        return 0;
 
-    REBINT old_index;
-    if (binder->high) {
-        old_index = MISC(canon).bind_index.high;
-        if (old_index == 0)
-            return 0;
-        MISC(canon).bind_index.high = 0;
-    }
-    else {
-        old_index = MISC(canon).bind_index.low;
-        if (old_index == 0)
-            return 0;
-        MISC(canon).bind_index.low = 0;
+    REBINT old_index = binder->slots[slot].index;
+
+    // Linear probing can't just empty the slot, as that would end the search
+    // for entries which had probed past it.  Shift such entries back.
+    //
+    REBLEN mask = binder->mask;
+    REBLEN hole = slot;
+    REBLEN next = (slot + 1) & mask;
+    while (binder->slots[next].canon != nullptr) {
+        REBLEN home = Binder_Slot(binder, binder->slots[next].canon);
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            binder->slots[hole] = binder->slots[next];  // can move back
+            hole = next;
+        }
+        next = (next + 1) & mask;
     }
+    binder->slots[hole].canon = nullptr;
 
-  #if !defined(NDEBUG)
     assert(binder->count > 0);
     --binder->count;
-  #endif
     return old_index;
 }
 
@@ -488,7 +581,11 @@ inline static REBCTX *Get_Var_Context(
         }
         else {
             REBNOD *f_binding = SPC_BINDING(specifier); // can't fail()
-            if (f_binding and Is_Overriding_Context(c, CTX(f_binding))) {
+            if (
+                f_binding
+                and f_binding != NOD(c)
+                and Is_Overriding_Context_Cached(c, CTX(f_binding))
+            ){
                 //
                 // The specifier binding overrides--because what's happening 
                 // is that this cell came from a METHOD's body, where the
@@ -706,7 +803,7 @@ inline static REBVAL *Derelativize(
 
         if (
             f_binding
-            and Is_Overriding_Context(CTX(binding), CTX(f_binding))
+            and Is_Overriding_Context_Cached(CTX(binding), CTX(f_binding))
         ){
             // !!! Repeats code in Get_Var_Core, see explanation there
             //
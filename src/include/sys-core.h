@@ -148,6 +148,18 @@
 #define MAX_NUM_LEN 64          // As many numeric digits we will accept on input
 #define MAX_EXPAND_LIST 5       // number of series-1 in Prior_Expand list
 
+// Growth policy when Expand_Series() must reallocate: the new allocation
+// gets extra room proportional to the series length, so repeated appends
+// are amortized constant time.  Series in the Prior_Expand list (expanded
+// recently) grow by more.  Builds may override these with -D settings.
+//
+#if !defined(SERIES_GROWTH_PERCENT)
+    #define SERIES_GROWTH_PERCENT 50     // spare room on first reallocation
+#endif
+#if !defined(SERIES_REGROWTH_PERCENT)
+    #define SERIES_REGROWTH_PERCENT 100  // ...if it reallocated recently
+#endif
+
 
 // This does all the forward definitions that are necessary for the compiler
 // to be willing to build %tmp-internals.h.  Some structures are fully defined
@@ -219,6 +231,104 @@ typedef struct rebol_stats {
     REBLEN  Objects;
 } REB_STATS;
 
+// REB_GC_STATS - Unlike PG_Reb_Stats, these are gathered in release builds
+// too.  They are only touched once per collection, so the "tax" is minimal,
+// and they are needed to tune the GC policies of long-running processes.
+//
+#define GC_PAUSE_HISTORY 256  // recent pauses kept for percentiles in STATS/GC
+
+typedef struct rebol_gc_stats {
+    REBLEN Major_Count;  // full mark and sweep collections
+    REBLEN Minor_Count;  // nursery-only collections (generational mode)
+    REBI64 Major_Usecs;  // total microseconds spent in major collections
+    REBI64 Minor_Usecs;  // total microseconds spent in minor collections
+    REBI64 Max_Major_Usecs;  // longest single major pause
+    REBI64 Max_Minor_Usecs;  // longest single minor pause
+    REBI64 Promoted;  // series nodes moved into the old generation
+    REBLEN Slice_Count;  // incremental mark slices run (RECYCLE/INCREMENTAL)
+    REBI64 Max_Slice_Usecs;  // longest single incremental mark slice
+    REBI64 Live_Bytes;  // bytes in use after the last recycle
+    REBLEN Survival_Percent;  // of bytes in use before the last recycle
+    REBI64 Trigger;  // ballast the last recycle set (bytes until the next)
+    REBI64 Released_Bytes;  // pool segments given back to the system
+    REBI64 Compacted_Bytes;  // unused series capacity freed by compaction
+    REBI64 Mark_Usecs;  // total microseconds of recycles spent marking
+    REBI64 Sweep_Usecs;  // total microseconds of recycles spent sweeping
+    REBI64 Pauses[GC_PAUSE_HISTORY];  // ring of recent pause microseconds
+    REBLEN Pause_Count;  // total pauses recorded, next goes at this modulo
+    REBI64 Symbols_Freed;  // interned spellings of words no longer in use
+} REB_GC_STATS;
+
+// REB_OVERRIDE_ENTRY - Derived binding lookups in METHOD bodies must walk a
+// keylist's ancestry on every fetch of a word (see Is_Overriding_Context()).
+// The answer depends only on the identity of the two keylists, so a small
+// direct-mapped cache of recent answers lets hot loops skip the walk.
+//
+#define OVERRIDE_CACHE_SIZE 64  // must be a power of 2
+
+typedef struct rebol_override_entry {
+    REBNOD *stored;  // keysource of the context the word was bound to
+    REBNOD *override;  // keysource of the specifier's binding
+    bool overrides;  // result of Is_Overriding_Context() on the pair
+} REB_OVERRIDE_ENTRY;
+
+// REB_FIELD_ENTRY - Picking a field out of a context by word (`obj/field`,
+// SELECT, IN) looks the canon up in the keylist.  A direct-mapped cache of
+// recent (keylist, canon) => index answers turns repeat lookups into pointer
+// compares.  Hits are checked against the key at the index, so entries never
+// need to be invalidated.
+//
+#define FIELD_CACHE_SIZE 256  // must be a power of 2
+
+typedef struct rebol_field_entry {
+    REBARR *keylist;
+    REBSTR *canon;
+    REBLEN index;
+} REB_FIELD_ENTRY;
+
+// The sampling profiler keeps the most recent samples in a ring, and only
+// records the outermost frames of very deep stacks (see SAMPLER).
+//
+#define SAMPLE_RING_SIZE 4096
+#define SAMPLE_MAX_DEPTH 128
+
+// REB_HOTSPOT - While HOTSPOTS is on, each evaluator step is counted against
+// the array and index its expression starts at.  The table is open-addressed
+// on the pair, and the arrays are kept alive by Root_Hotspots (a BLOCK! in
+// the same slot).  It is grown by doubling when half full.
+//
+#define HOTSPOTS_MIN_SIZE 1024  // must be a power of 2
+
+typedef struct rebol_hotspot_entry {
+    REBARR *array;  // nullptr if the slot is unused
+    REBLEN index;
+    REBI64 count;
+} REB_HOTSPOT;
+
+// REB_SCAN_ENTRY - Hosts make the same API calls in loops, e.g. `rebValue(
+// "append", block, "[1 2]")`, handing the scanner identical string literals
+// each time.  The fragment a variadic feed starts with is remembered by its
+// pointer, with a copy of its text and the array it scanned to held by
+// Root_Scan_Cache (BINARY! at 2 * slot, BLOCK! at 2 * slot + 1).
+//
+#define SCAN_CACHE_SIZE 64  // must be a power of 2
+
+typedef struct rebol_scan_entry {
+    const REBYTE *utf8;  // the pointer the fragment was passed as
+    REBCTX *context;  // words in the array are bound into this
+    REBSIZ size;  // length of the text, checked against the saved copy
+    bool cached;  // false if the fragment didn't scan on its own
+    bool newline_pending;  // fragment ended in a newline
+} REB_SCAN_ENTRY;
+
+// TG_Compose_Arrays - The template arrays COMPOSE has remembered positions
+// for, direct-mapped by pointer.  The positions are a BINARY! of REBLENs in
+// the same slot of Root_Compose_Cache.  An entry is only used if the array
+// still has ARRAY_FLAG_HAS_COMPOSE_CACHE, so a freed array whose node gets
+// reused (or one that was changed) is never mistaken for a hit.
+//
+#define COMPOSE_CACHE_SIZE 256  // must be a power of 2
+
 //-- Options of various kinds:
 typedef struct rebol_opts {
     bool  watch_recycle;
@@ -266,7 +376,8 @@ enum {
     // These flags are also set during the spec analysis process.
     //
     MKF_IS_VOIDER = 1 << 6,
-    MKF_HAS_RETURN = 1 << 7
+    MKF_HAS_RETURN = 1 << 7,
+    MKF_IS_PURE = 1 << 8  // <pure> tag, caller sets DETAILS_FLAG_IS_PURE
 };
 
 #define MKF_MASK_NONE 0 // no special handling (e.g. MAKE ACTION!)
@@ -319,9 +430,11 @@ extern void reb_qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp);
 // threads wanted to work with the same data (at different times).  Such a
 // feature is better implemented as in the V8 JavaScript engine as "isolates"  
 
+// See REB_THREAD_INSTANCES in %reb-config.h for making them thread-local.
+//
 #ifdef __cplusplus
-    #define PVAR extern "C" RL_API
-    #define TVAR extern "C" RL_API
+    #define PVAR extern "C" RL_API REB_INSTANCE_VAR
+    #define TVAR extern "C" RL_API REB_INSTANCE_VAR
 #else
     // When being preprocessed by TCC and combined with the user - native
     // code, all global variables need to be declared
@@ -330,10 +443,10 @@ extern void reb_qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp);
     // PVAR and TVAR allow for overriding at the compiler command line.
     //
     #if !defined(PVAR)
-        #define PVAR extern RL_API
+        #define PVAR extern RL_API REB_INSTANCE_VAR
     #endif
     #if !defined(TVAR)
-        #define TVAR extern RL_API
+        #define TVAR extern RL_API REB_INSTANCE_VAR
     #endif
 #endif
 
@@ -388,7 +501,13 @@ enum rebol_signals {
 
     // SIG_EVENT_PORT is to-be-documented
     //
-    SIG_EVENT_PORT = 1 << 3
+    SIG_EVENT_PORT = 1 << 3,
+
+    // SIG_SAMPLE asks for the stack of running actions to be recorded by the
+    // sampling profiler (see SAMPLER).  It's set by rebSample(), which is
+    // safe to call from an OS timer signal handler.
+    //
+    SIG_SAMPLE = 1 << 4
 };
 
 inline static void SET_SIGNAL(REBFLGS f) { // used in %sys-series.h
@@ -402,6 +521,23 @@ inline static void SET_SIGNAL(REBFLGS f) { // used in %sys-series.h
 #define CLR_SIGNAL(f) \
     cast(void, Eval_Signals &= ~(f))
 
+// Natives that can run a long time in C without evaluating call this about
+// every POLL_CHUNK units of work (bytes, items, comparisons), passing the
+// signals they can service there.  Until a signal is raised it's one test.
+// True means a halt is pending and the work should be abandoned, see
+// Poll_Signals_Core().
+//
+#define POLL_CHUNK 0x10000
+
+#define SIGS_POLL_ANYWHERE \
+    (SIG_HALT | SIG_SAMPLE)  // add SIG_RECYCLE only if a GC is safe
+
+inline static bool Poll_Signals(REBFLGS sigs) {
+    if (not (Eval_Signals & Eval_Sigmask & sigs))
+        return false;
+    return Poll_Signals_Core(sigs);
+}
+
 #include "datatypes/sys-series.h"
 #include "datatypes/sys-array.h"  // REBARR used by UTF-8 string bookmarks
 
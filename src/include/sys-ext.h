@@ -74,5 +74,6 @@
 #define IDX_COLLATOR_SCRIPT 0
 #define IDX_COLLATOR_SPECS 1
 #define IDX_COLLATOR_DISPATCHERS 2
-#define IDX_COLLATOR_MAX 3
+#define IDX_COLLATOR_LAZY 3  // TEXT! of `name: [spec]...` to stub, or BLANK!
+#define IDX_COLLATOR_MAX 4
 
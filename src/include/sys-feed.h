@@ -244,30 +244,12 @@ inline static const RELVAL *Detect_Feed_Pointer_Maybe_Fetch(
         feed->context = Get_Context_From_Stack();
         feed->lib = (feed->context != Lib_Context) ? Lib_Context : nullptr;
 
-        struct Reb_Binder binder;
-        Init_Interning_Binder(&binder, feed->context);
-        feed->binder = &binder;
-
         feed->specifier = SPECIFIED;
 
-        SCAN_STATE ss;
-        const REBLIN start_line = 1;
-        Init_Va_Scan_State_Core(
-            &ss,
-            Intern("sys-do.h"),
-            start_line,
-            cast(const REBYTE*, p),
-            feed
-        );
-
-        REBVAL *error = rebRescue(cast(REBDNG*, &Scan_To_Stack), &ss);
-        Shutdown_Interning_Binder(&binder, feed->context);
-
-        if (error) {
-            REBCTX *error_ctx = VAL_CONTEXT(error);
-            rebRelease(error);
-            fail (error_ctx);
-        }
+        // Scans the rest of the feed too, see notes on Reb_Feed.  Repeated
+        // calls with the same string literal are served from a cache.
+        //
+        Scan_Feed_Utf8_To_Stack(feed, cast(const REBYTE*, p));
 
         if (DSP == dsp_orig) {
             //
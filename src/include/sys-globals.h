@@ -53,6 +53,8 @@ PVAR REBU64 PG_Mem_Limit;   // Memory limit set by SECURE
 PVAR REBSER *PG_Symbol_Canons; // Canon symbol pointers for words in %words.r
 PVAR REBSER *PG_Canons_By_Hash; // Canon REBSER pointers indexed by hash
 PVAR REBLEN PG_Num_Canon_Slots_In_Use; // Total canon hash slots (+ deleteds)
+PVAR REBSER *PG_Old_Canons_By_Hash;  // Table being resized from, or nullptr
+PVAR REBLEN PG_Canon_Migrate_Slot;  // Next slot of the old table to move
 #if !defined(NDEBUG)
     PVAR REBLEN PG_Num_Canon_Deleteds; // Deleted canon hash slots "in use"
 #endif
@@ -100,6 +102,11 @@ PVAR REBVAL PG_R_Redo_Checked;  // "pseudotype" REB_R_REDO + true extra
 PVAR REBVAL PG_R_Reference;  // "pseudotype" REB_R_REFERENCE
 PVAR REBVAL PG_R_Thrown;  // has "pseudotype" REB_R_THROWN
 
+// Bumped by each HIJACK.  ADAPT, CHAIN and SPECIALIZE actions keep a plan
+// of the layers they go through, which is remade if it's from an older epoch.
+//
+PVAR REBLEN PG_Hijack_Epoch;
+
 // These are root variables which used to be described in %root.r and kept
 // alive by keeping that array alive.  Now they are API handles, kept alive
 // by the same mechanism they use.  This means they can be initialized at
@@ -119,6 +126,7 @@ PVAR REBVAL *Root_Skip_Tag; // marks a hard quote as "skippable" if wrong type
 PVAR REBVAL *Root_Dequote_Tag; // remove quotes before typecheck
 PVAR REBVAL *Root_Requote_Tag; // add quotes that were dequoted back to return
 PVAR REBVAL *Root_Const_Tag; // pass a CONST version of the input argument
+PVAR REBVAL *Root_Pure_Tag; // action has no side effects, see FOLD
 PVAR REBVAL *Root_Modal_Tag;  // !!! needed for bootstrap, vs @arg modal
 
 PVAR REBVAL *Root_Empty_Text; // read-only ""
@@ -132,6 +140,11 @@ PVAR REBVAL *Root_Newline_Char; // '\n' as a CHAR!
 PVAR REBVAL *Root_Action_Meta;
 
 PVAR REBVAL *Root_Stats_Map;
+PVAR REBVAL *Root_Samples;  // ring buffer of folded stacks, see SAMPLER
+PVAR REBVAL *Root_Hotspots;  // arrays counted in TG_Hotspots, see HOTSPOTS
+PVAR REBVAL *Root_Breakpoints;  // positions of breakpoints, see Add_Breakpoint
+PVAR REBVAL *Root_Scan_Cache;  // texts and arrays for TG_Scan_Cache
+PVAR REBVAL *Root_Compose_Cache;  // positions for TG_Compose_Arrays
 
 PVAR REBVAL *Root_Stackoverflow_Error; // made in advance, avoids extra calls
 
@@ -154,6 +167,7 @@ PVAR REBACT *PG_Dummy_Action;
 //
 PVAR REBEVL *PG_Eval_Maybe_Stale_Throws;  // Evaluator (REBFRM* in, bool out)
 PVAR REBNAT PG_Dispatch;  // Dispatcher (REBFRM* in, returns REBVAL*)
+PVAR REBEVL *PG_Breakpoint_Hook_Throws;  // Run at breakpoints (or nullptr)
 
 PVAR REBDEV *PG_Device_List;  // Linked list of R3-Alpha-style "devices"
 
@@ -186,7 +200,24 @@ TVAR REBPOL *Mem_Pools;     // Memory pool array
 TVAR bool GC_Recycling;    // True when the GC is in a recycle
 TVAR REBINT GC_Ballast;     // Bytes allocated to force automatic GC
 TVAR bool GC_Disabled;      // true when RECYCLE/OFF is run
+TVAR bool GC_Generational;  // true when RECYCLE/GENERATIONAL is on
+TVAR bool GC_Minor;  // true while a minor (nursery-only) recycle is running
+TVAR REBLEN GC_Minors_Since_Major;  // forces a major after GC_MAX_MINORS
+TVAR REB_GC_STATS GC_Stats;  // pause and generation counters (see STATS/GC)
+TVAR REBLEN GC_Slice_Budget;  // arrays per incremental mark slice, 0 is off
+TVAR bool GC_Marking;  // true while an incremental mark is between slices
+TVAR REBLEN GC_Arena_Depth;  // Push_Arena() nesting, see WITH-ARENA
+TVAR REBSYM GC_Policy;  // SYM_FIXED, SYM_PROPORTIONAL, SYM_PAUSE
+TVAR REBLEN GC_Growth;  // percent of live bytes for SYM_PROPORTIONAL ballast
+TVAR REBLEN GC_Target;  // percent of run time in GC for SYM_PAUSE ballast
+TVAR REB_OVERRIDE_ENTRY TG_Override_Cache[OVERRIDE_CACHE_SIZE];  // see GC
+TVAR REB_FIELD_ENTRY TG_Field_Cache[FIELD_CACHE_SIZE];
+TVAR REB_SCAN_ENTRY TG_Scan_Cache[SCAN_CACHE_SIZE];  // see Root_Scan_Cache
+TVAR REBARR *TG_Compose_Arrays[COMPOSE_CACHE_SIZE];  // see Root_Compose_Cache
 TVAR REBSER *GC_Guarded; // A stack of GC protected series and values
+TVAR REBSER *GC_Frozen_Externals;  // Nodes the frozen heap references
+TVAR REBSER *TG_Api_Scoped;  // API handles made since a rebPushScope()
+TVAR REBLEN TG_Api_Scope_Depth;  // number of rebPushScope()s in effect
 PVAR REBSER *GC_Mark_Stack; // Series pending to mark their reachables as live
 TVAR REBSER **Prior_Expand; // Track prior series expansions (acceleration)
 
@@ -228,7 +259,8 @@ TVAR struct Reb_Feed TG_Frame_Feed_End;
 TVAR REBARR *TG_Reuse;
 
 //-- Evaluation stack:
-TVAR REBARR *DS_Array;
+TVAR REBVAL *DS_Head;  // address space reserved at startup, see %m-stacks.c
+TVAR REBLEN DS_Capacity;  // cells before the END marker, including DS_AT(0)
 TVAR REBDSP DS_Index;
 TVAR REBVAL *DS_Movable_Top;
 
@@ -244,6 +276,17 @@ TVAR REBI64 Eval_Limit;     // Evaluation limit (set by secure)
 TVAR int_fast32_t Eval_Count;     // Evaluation counter (downward)
 TVAR uint_fast32_t Eval_Dose;      // Evaluation counter reset value
 TVAR REBFLGS Eval_Sigmask;   // Masking out signal flags
+TVAR bool TG_Tail_Calls;    // Self-calls ending a FUNC body reuse its frame
+TVAR REBI64 TG_Folded_Calls;    // Pure calls replaced by their result in FOLD
+TVAR REBI64 TG_Shared_Keylists;  // Derived objects that use the parent's keys
+TVAR bool TG_Sampling;      // SAMPLER is recording stacks to Root_Samples
+TVAR uint_fast32_t TG_Sampling_Saved_Dose;  // Eval_Dose to restore on stop
+TVAR REBLEN TG_Sample_Next; // Slot in Root_Samples for the next sample
+TVAR bool TG_Counting_Steps;    // HOTSPOTS is counting steps in TG_Hotspots
+TVAR bool TG_Step_Hooks;    // HOTSPOTS or breakpoints, see Step_Hooks_Throws
+TVAR REB_HOTSPOT *TG_Hotspots;  // Step counts by array and index
+TVAR REBLEN TG_Hotspots_Size;   // Slots in TG_Hotspots (power of 2)
+TVAR REBLEN TG_Hotspots_Used;   // Slots in TG_Hotspots holding an array
 
 TVAR REBFLGS Trace_Flags;    // Trace flag
 TVAR REBINT Trace_Level;    // Trace depth desired
@@ -34,8 +34,15 @@ struct rebol_mold {
     REBYTE period;      // for decimal point
     REBYTE dash;        // for date fields
     REBYTE digits;      // decimal digits
+    const REBVAL *sink; // ACTION! taking BINARY! chunks as they're molded
+    REBLEN sink_depth;  // TG_Mold_Stack length when the sink mold started
 };
 
+// A mold with a sink gives the buffer to the sink whenever it has grown past
+// this many bytes, at a boundary between items of the outermost array.
+//
+#define MOLD_SINK_THRESHOLD (64 * 1024)
+
 #define Drop_Mold_If_Pushed(mo) \
     Drop_Mold_Core((mo), true)
 
@@ -89,6 +96,7 @@ enum REB_Mold_Opts {
     mold_struct.series = NULL; /* used to tell if pushed or not */ \
     mold_struct.opts = 0; \
     mold_struct.indent = 0; \
+    mold_struct.sink = nullptr; \
     REB_MOLD *name = &mold_struct; \
 
 #define SET_MOLD_FLAG(mo,f) \
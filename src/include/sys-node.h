@@ -83,6 +83,12 @@
 // is required for correct functioning of some types.  (See notes on
 // alignment in %sys-rebval.h.)
 //
+// Note: There is no per-instance "magazine" cache in front of the free list.
+// Mem_Pools is a TVAR, so pools are not shared between interpreter states to
+// contend over.  And the free list is already LIFO, so a freed node is the
+// next one handed out while it is likely still in the cache.  Refills are
+// batched by Fill_Pool(), one whole segment of `units` nodes at a time.
+//
 inline static void *Make_Node(REBLEN pool_id)
 {
     REBPOL *pool = &Mem_Pools[pool_id];
@@ -94,8 +100,17 @@ inline static void *Make_Node(REBLEN pool_id)
     REBNOD *node = pool->first;
 
     pool->first = node->next_if_free;
+    ++pool->allocs;  // cheaper than testing a flag to see if it's wanted
+
+  #if !defined(NDEBUG)
+    //
+    // Only the debug build's Free_Node() appends at the tail of the list.
+    // Release builds only consult `last` in Fill_Pool() when the list is
+    // non-empty, which is never the case when it is called from here.
+    //
     if (node == pool->last)
         pool->last = nullptr;
+  #endif
 
     pool->free--;
 
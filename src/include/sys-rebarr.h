@@ -190,6 +190,56 @@ STATIC_ASSERT(ARRAY_FLAG_CONST_SHALLOW == CELL_FLAG_CONST);
 #define LINK_FILE(s)            STR(LINK_FILE_NODE(s))
 
 
+//=//// ARRAY_FLAG_HAS_HASH_INDEX /////////////////////////////////////////=//
+//
+// MAKE-INDEX gives an ordinary source array a hashlist of its records' first
+// values, which Find_In_Array() uses instead of scanning.  The hashlist is
+// held in ->link, so the array gives up its file and line.  (Varlists and
+// paramlists use this bit for other purposes.)
+//
+// The hashlist's ->link holds the record size, and its ->misc the number of
+// records hashed so far...or -1 if the array changed in a way that means it
+// must be rebuilt.  FAIL_IF_READ_ONLY_SER() sets that, since every mutation
+// of a user-visible array checks for writability first.
+//
+#define ARRAY_FLAG_HAS_HASH_INDEX \
+    ARRAY_FLAG_25
+
+#define LINK_HASH_INDEX_NODE(s)     LINK(s).custom.node
+#define LINK_HASH_INDEX(s)          SER(LINK_HASH_INDEX_NODE(s))
+
+#define HASH_INDEX_SKIP(hashlist)   LINK(hashlist).custom.u32
+#define HASH_INDEX_COUNT(hashlist)  MISC(hashlist).custom.i
+
+// Records whose first value is a DECIMAL!, PERCENT! or MONEY! aren't put in
+// the table, as those compare equal to nearby numbers of other types.  This
+// bit notes that one was seen, so INTEGER! searches can't trust the table.
+//
+#define HASH_INDEX_INFO_INEXACT_NUMBERS SERIES_INFO_MISC_BIT
+
+
+//=//// ARRAY_FLAG_HAS_COMPOSE_CACHE //////////////////////////////////////=//
+//
+// COMPOSE remembers the positions in a template that it can't just copy, so
+// the next COMPOSE of that template can skip straight to them (see
+// TG_Compose_Arrays).  This bit says the remembered positions are good, and
+// is cleared by FAIL_IF_READ_ONLY_SER() on any mutation of the array.
+//
+#define ARRAY_FLAG_HAS_COMPOSE_CACHE \
+    ARRAY_FLAG_26
+
+
+//=//// ARRAY_FLAG_HAS_BREAKPOINTS ////////////////////////////////////////=//
+//
+// Set on a source array when the debugger has put a breakpoint at one of its
+// positions (see Add_Breakpoint()).  The evaluator only looks up whether an
+// expression start is a breakpoint in arrays with this bit, so code in other
+// arrays runs at full speed.
+//
+#define ARRAY_FLAG_HAS_BREAKPOINTS \
+    ARRAY_FLAG_27
+
+
 #if !defined(DEBUG_CHECK_CASTS)
 
     #define ARR(p) \
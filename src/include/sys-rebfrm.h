@@ -426,7 +426,8 @@ struct Reb_Feed {
     // !!! Note: At the moment a UTF-8 string is seen in the feed, it sets
     // these fields on-demand, and then runs a scan of the entire rest of the
     // feed, caching it.  It doesn't have a choice as only one binder can
-    // be in effect at a time, and so it can't run code as it goes.
+    // be in effect at a time, and so it can't run code as it goes.  (The
+    // first fragment is cached, see Scan_Feed_Utf8_To_Stack().)
     //
     // Hence these fields aren't in use at the same time as the lookback
     // at this time; since no evaluations are being done.  They could be put
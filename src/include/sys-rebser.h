@@ -95,6 +95,16 @@
 #define SERIES_FLAG_MARKED NODE_FLAG_MARKED
 
 
+// NODE_FLAG_TRANSIENT only has meaning for cells, so series take the bit to
+// say they were moved into the "frozen heap" by FREEZE.  Such series are
+// deeply frozen, and the GC neither marks nor frees them; what they point to
+// outside of the frozen heap is kept alive by GC_Frozen_Externals instead.
+// The sweep tests it from the first byte of the header, hence the bytemask.
+//
+#define SERIES_FLAG_FROZEN_HEAP NODE_FLAG_TRANSIENT
+#define NODE_BYTEMASK_0x08_FROZEN_HEAP NODE_BYTEMASK_0x08_TRANSIENT
+
+
 //=////////////////////////////////////////////////////////////////////////=//
 //
 // SERIES <<HEADER>> FLAGS
@@ -468,15 +478,31 @@ STATIC_ASSERT(SERIES_INFO_7_IS_FALSE == NODE_FLAG_CELL);
     FLAG_LEFT_BIT(28)
 
 
-//=//// SERIES_INFO_29 ////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_GC_OLD ////////////////////////////////////////////////=//
 //
-#define SERIES_INFO_29 \
+// When the garbage collector is in generational mode (RECYCLE/GENERATIONAL),
+// managed series which survive a collection are "promoted" by setting this
+// bit.  A minor collection does not trace into or sweep old series, it only
+// considers those allocated since the last collection (the "nursery").
+//
+// The bit is never set unless generational mode is on, and a major recycle
+// run with the mode off will clear it from all survivors.
+//
+#define SERIES_INFO_GC_OLD \
     FLAG_LEFT_BIT(29)
 
 
-//=//// SERIES_INFO_30 ////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_GC_REMEMBERED /////////////////////////////////////////=//
+//
+// This is the "remembered set" for minor collections.  Rather than keep a
+// separate list, old series which are written to get this bit via the write
+// barrier in Note_Series_Mutation().  Mark_Root_Series() already visits
+// every node in the pool, so it treats these as roots in a minor collection.
 //
-#define SERIES_INFO_30 \
+// Incremental marking (RECYCLE/INCREMENTAL) uses the same bit for series
+// which were written after being marked, so the final slice rescans them.
+//
+#define SERIES_INFO_GC_REMEMBERED \
     FLAG_LEFT_BIT(30)
 
 
@@ -703,35 +729,13 @@ union Reb_Series_Misc {
     //
     REBLEN length;
 
-    // When binding words into a context, it's necessary to keep a table
-    // mapping those words to indices in the context's keylist.  R3-Alpha
-    // had a global "binding table" for the spellings of words, where
-    // those spellings were not garbage collected.  Ren-C uses REBSERs
-    // to store word spellings, and then has a hash table indexing them.
-    //
-    // So the "binding table" is chosen to be indices reachable from the
-    // REBSER nodes of the words themselves.  If it were necessary for
-    // multiple clients to have bindings at the same time, this could be
-    // done through a pointer that would "pop out" into some kind of
-    // linked list.  For now, the binding API just demonstrates having
-    // up to 2 different indices in effect at once.
-    //
-    // Note that binding indices can be negative, so the sign can be used
-    // to encode a property of that particular binding.
-    //
-    struct {
-        int high:16;
-        int low:16;
-    } bind_index;
-
     // When copying arrays, it's necessary to keep a map from source series
     // to their corresponding new copied series.  This allows multiple
     // appearances of the same identities in the source to give corresponding
     // appearances of the same *copied* identity in the target, and also is
     // integral to avoiding problems with cyclic structures.
     //
-    // As with the `bind_index` above, the cheapest way to build such a map is
-    // to put the forward into the series node itself.  However, when copying
+    // The cheapest way to build such a map is to put the forward into the series node itself.  However, when copying
     // a generic series the bits are all used up.  So the ->misc field is
     // temporarily "co-opted"...its content taken out of the node and put into
     // the forwarding entry.  Then the index of the forwarding entry is put
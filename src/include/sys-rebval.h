@@ -443,6 +443,27 @@ struct Reb_Time_Payload {  // see %sys-time.h
     REBI64 nanoseconds;
 };
 
+// A PAIR! of two numbers fits in the payload of a cell on 64-bit platforms,
+// with no pairing node.  32-bit platforms have half the room, so they keep
+// the two values in a pairing.  See %sys-pair.h
+//
+#if !defined(PAIR_INLINE)
+  #if defined(__LP64__) || defined(_WIN64)
+    #define PAIR_INLINE 1
+  #else
+    #define PAIR_INLINE 0
+  #endif
+#endif
+
+#if PAIR_INLINE
+    union Reb_Pair_Number { REBI64 i64; REBDEC dec; };  // kinds in the extra
+
+    struct Reb_Pair_Payload {
+        union Reb_Pair_Number x;
+        union Reb_Pair_Number y;
+    };
+#endif
+
 struct Reb_Any_Payload  // generic, for adding payloads after-the-fact
 {
     union Reb_Any first;
@@ -509,6 +530,9 @@ union Reb_Value_Payload { //=/////////////// ACTUAL PAYLOAD DEFINITION ////=//
     struct Reb_Integer_Payload Integer;
     struct Reb_Decimal_Payload Decimal;
     struct Reb_Time_Payload Time;
+  #if PAIR_INLINE
+    struct Reb_Pair_Payload Pair;
+  #endif
 
     struct Reb_Bookmark_Payload Bookmark;  // internal (see REB_X_BOOKMARK)
 
@@ -132,6 +132,10 @@ inline static REBVAL *Alloc_Value(void)
         f = f->prior; // FS_BOTTOM is a dummy action, should always stop
 
     LINK(a).owner = NOD(Context_For_Frame_May_Manage(f));
+
+    if (TG_Api_Scope_Depth != 0)  // freed by rebPopScope(), see notes there
+        Note_Scoped_Api_Handle(a);
+
     return v;
 }
 
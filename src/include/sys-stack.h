@@ -80,7 +80,7 @@
 // may be used as the start of a copy which is ultimately of length 0.
 //
 inline static REBVAL *DS_AT(REBDSP d) {
-    REBVAL *at = KNOWN(ARR_HEAD(DS_Array) + d);
+    REBVAL *at = DS_Head + d;
     assert(
         ((at->header.bits & NODE_FLAG_CELL) and d <= (DSP + 1))
         or (not (SECOND_BYTE(at->header) != REB_0 and d == (DSP + 1)))
@@ -90,7 +90,7 @@ inline static REBVAL *DS_AT(REBDSP d) {
 
 #if !defined(NDEBUG)
     #define IN_DATA_STACK_DEBUG(v) \
-        IS_VALUE_IN_ARRAY_DEBUG(DS_Array, (v))
+        ((v) >= DS_Head and (v) <= DS_Head + DS_Capacity)
 #endif
 
 //
@@ -30,7 +30,9 @@ struct Reb_State {
     //
     // We put the jmp_buf first, since it has alignment specifiers on Windows
     //
-  #ifdef HAS_POSIX_SIGNAL
+  #if defined(REBOL_FAIL_USES_EXCEPTIONS)
+    // no jmp_buf; fail() throws a pointer to this state (see %sys-trap.h)
+  #elif defined(HAS_POSIX_SIGNAL)
     sigjmp_buf cpu_state;
   #else
     jmp_buf cpu_state;
@@ -45,6 +47,8 @@ struct Reb_State {
     REBCTX *error;
 
     REBLEN manuals_len; // Where GC_Manuals was when state started
+    REBLEN api_scoped_len;  // Where TG_Api_Scoped was when state started
+    REBLEN api_scope_depth;
     REBLEN mold_buf_len;
     REBSIZ mold_buf_size;
     REBLEN mold_loop_tail;
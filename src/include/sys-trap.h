@@ -67,9 +67,11 @@
 //
 //=//// NOTES /////////////////////////////////////////////////////////////=//
 //
-// * Mixing C++ and C code using longjmp is a recipe for disaster.  The plan
-//   is that API primitives like rebRescue() will be able to abstract the
-//   mechanism for fail, but for the moment only longjmp is implemented.
+// * Mixing C++ and C code using longjmp is a recipe for disaster.  API
+//   primitives like rebRescue() abstract the mechanism for fail, so C++
+//   builds can define REBOL_FAIL_USES_EXCEPTIONS to use `throw` instead (see
+//   %reb-config.h).  PUSH_TRAP() is then unavailable, as a setjmp() can't be
+//   turned into a `try`--only rebRescue() and rebRescueWith() can trap.
 //
 
 
@@ -98,7 +100,13 @@
 // a parameter as 'volatile', but that is implementation-defined.
 // It is best to use a new variable if you encounter such a warning.
 //
-#if defined(__MINGW64__) && (__GNUC__ < 5)
+#if defined(REBOL_FAIL_USES_EXCEPTIONS)
+    //
+    // No jumping.  Fail_Core() throws Saved_State, and PUSH_TRAP_SCOPE() just
+    // links the state in--the caller must put the protected code in a `try`
+    // and hand a caught state to Trapped_Helper().  See RL_rebRescue().
+
+#elif defined(__MINGW64__) && (__GNUC__ < 5)
     //
     // 64-bit builds made by MinGW in the 4.x range have an unfortunate bug in
     // the setjmp/longjmp mechanic, which causes hangs for reasons that are
@@ -179,19 +187,28 @@
 // The API model is still being worked out, and so this is tolerated while
 // the code settles--until the right answer can be seen more clearly.
 //
-#define PUSH_TRAP(e,s) \
-    do { \
-        /* assert(Saved_State or (DSP == 0 and FS_TOP == FS_BOTTOM)); */ \
-        Snap_State_Core(s); \
-        (s)->last_state = Saved_State; \
-        Saved_State = (s); \
-        if (!SET_JUMP((s)->cpu_state)) \
-            *(e) = NULL; /* this branch will always be run */ \
-        else { \
-            Trapped_Helper(s); \
-            *(e) = (s)->error; \
-        } \
-    } while (0)
+#if defined(REBOL_FAIL_USES_EXCEPTIONS)
+    #define PUSH_TRAP_SCOPE(s) \
+        do { \
+            Snap_State_Core(s); \
+            (s)->last_state = Saved_State; \
+            Saved_State = (s); \
+        } while (0)
+#else
+    #define PUSH_TRAP(e,s) \
+        do { \
+            /* assert(Saved_State or (DSP == 0 and FS_TOP == FS_BOTTOM)); */ \
+            Snap_State_Core(s); \
+            (s)->last_state = Saved_State; \
+            Saved_State = (s); \
+            if (!SET_JUMP((s)->cpu_state)) \
+                *(e) = NULL; /* this branch will always be run */ \
+            else { \
+                Trapped_Helper(s); \
+                *(e) = (s)->error; \
+            } \
+        } while (0)
+#endif
 
 
 // DROP_TRAP_SAME_STACKLEVEL_AS_PUSH has a long and informative name to
@@ -269,6 +269,8 @@ int main(int argc, char *argv_ansi[])
     if (rebNot("action?", rebQ1(main_startup), rebEND))
         rebJumps("PANIC-VALUE", rebQ1(main_startup), rebEND);  // terminates
 
+    rebElide("stats/phase 'host-code", rebEND);  // see `--startup-profile`
+
     // This runs the MAIN-STARTUP, which returns *requests* to execute
     // arbitrary code by way of its return results.  The ENTRAP is thus here
     // to intercept bugs *in MAIN-STARTUP itself*.
@@ -298,6 +300,20 @@ int main(int argc, char *argv_ansi[])
 
     int exit_status = rebUnboxInteger(rebR(result), rebEND);
 
+    // With `--hotspots` the evaluation steps were counted for the whole run,
+    // so print where they went.  (HOTSPOTS FALSE is null if not counting.)
+    //
+    rebElide(
+        "use [report] [",
+            "if report: hotspots false [",
+                "print {count file line near}",
+                "for-each [count file line near] report [",
+                    "print [count any [file {?}] any [line {?}] near]",
+                "]",
+            "]",
+        "]",
+    rebEND);
+
     const bool clean = false;  // process exiting, not necessary
     rebShutdown(clean);  // Note: debug build runs a clean shutdown anyway
 
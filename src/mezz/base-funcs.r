@@ -1039,7 +1039,7 @@ fail: func [
         set-location-of-error error where  ; !!! why is this native?
     ]
 
-    do ensure error! error  ; raise to nearest TRAP up the stack (if any)
+    raise ensure error! error  ; to nearest TRAP up the stack (if any)
 ]
 
 unreachable: specialize 'fail [reason: "Unreachable code"]
@@ -1136,3 +1136,57 @@ input-lines: redescribe [
 ](
     specialize :read-lines [src: _]
 )
+
+read-values: func [
+    {Makes a generator that yields top-level values scanned from a file or port.}
+    src [port! file! blank!]
+    /chunk "How many bytes to read from the port at a time (default 65536)"
+        [integer!]
+][
+    if blank? src [src: system/ports/input]
+    if file? src [src: open src]
+
+    ; Only the bytes of the value being scanned are kept, so memory use is
+    ; bounded by the largest top-level value (plus a chunk), not the input.
+    ;
+    ; A value that was scanned right up to the end of the buffered bytes may
+    ; be cut short (e.g. `12` of `1234`), and a scan error may just be an
+    ; unfinished value.  Either way, more is read and the value is scanned
+    ; again--until the end of input, when errors are raised as usual.
+    ;
+    let f: function compose [
+        <static> buffer (to group! [make binary! 4096])
+        <static> port (groupify src)
+        <static> size (to group! reduce [any [chunk 65536]])
+        <static> line (to group! [1])
+        <static> eof (to group! [false])
+    ] compose/deep [
+        cycle [
+            value: _
+            line-before: line
+            error: trap [pos: transcode/next/line 'value buffer 'line]
+            case [
+                error [
+                    if eof [fail error]
+                ]
+                null? :value [
+                    if eof [return null]  ; only whitespace and comments left
+                ]
+                any [eof, not tail? pos] [
+                    buffer: pos
+                    return :value
+                ]
+            ]
+            line: line-before
+            data: ((if same? src system/ports/input
+                '[read port]
+                else
+                '[read/part port size]
+            ))
+            either empty? data [eof: true] [
+                remove/part head buffer -1 + index of buffer
+                buffer: append head buffer data
+            ]
+        ]
+    ]
+]
@@ -36,14 +36,14 @@ REBOL [
     %mezz-types.r
     %mezz-func.r
     %mezz-debug.r
-    %mezz-dump.r
+    <lazy> %mezz-dump.r  ; <lazy> means functions are made on first call
     %mezz-control.r
     %mezz-save.r
     %mezz-series.r
     %mezz-files.r
     %mezz-shell.r
     %mezz-math.r
-    %mezz-help.r  ; depends on DUMP-OBJ in %mezz-dump.r
+    <lazy> %mezz-help.r  ; depends on DUMP-OBJ in %mezz-dump.r
     %mezz-colors.r
     %mezz-legacy.r
 ]
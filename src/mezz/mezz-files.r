@@ -377,6 +377,50 @@ to-relative-file: function [
 ]
 
 
+parse-port: function [
+    {PARSE a port's data one record at a time, reading more as it's needed}
+
+    return: "The port if all data was matched, null if RULE got stuck"
+        [<opt> port!]
+    port "Open port where READ/PART gives BINARY! (empty once at the end)"
+        [port!]
+    rule "Rule matching one record, used repeatedly at the start of a buffer"
+        [block!]
+    /part "Bytes to request per READ (default 64K)"
+        [integer!]
+][
+    ; PARSE wants its whole input in memory, but a large log only needs the
+    ; record being matched.  Matched records are removed from the buffer, so
+    ; memory is bounded by the largest record plus one read.  A match that
+    ; ends at the tail of the buffer may have gone further with more data,
+    ; so it is only taken once the port is exhausted.
+    ;
+    part: default [65536]
+    if part < 1 [cause-error 'script 'out-of-range part]
+
+    buffer: make binary! part
+    done: false
+    cycle [
+        while [all [
+            not tail? buffer
+            pos: parse buffer rule
+            any [
+                done
+                not tail? pos
+            ]
+        ]][
+            if head? pos [fail "PARSE-PORT rule must consume some input"]
+            remove/part buffer pos
+        ]
+        if done [
+            return if tail? buffer [port]
+        ]
+        data: read/part port part
+        either empty? data [done: true] [append buffer data]
+    ]
+]
+
+
 ; !!! Probably should not be in the "core" mezzanine.  But to make it easier
 ; for people who seem to be unable to let go of the tabbing/CR past, this
 ; helps them turn their files into sane ones :-/
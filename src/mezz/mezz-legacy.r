@@ -68,6 +68,14 @@ gob!: make datatype! http://datatypes.rebol.info/gob
 gob?: typechecker gob!
 struct!: make datatype! http://datatypes.rebol.info/struct
 struct?: typechecker struct!
+table!: make datatype! http://datatypes.rebol.info/table
+table?: typechecker table!
+pmap!: make datatype! http://datatypes.rebol.info/pmap
+pmap?: typechecker pmap!
+pvector!: make datatype! http://datatypes.rebol.info/pvector
+pvector?: typechecker pvector!
+cache!: make datatype! http://datatypes.rebol.info/cache
+cache?: typechecker cache!
 
 ; LIBRARY! is a bit different, because it may not be feasible to register it
 ; in an extension, because it's used to load extensions from DLLs.  But it
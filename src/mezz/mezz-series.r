@@ -164,6 +164,32 @@ replace: function [
         any-array? :pattern [length of :pattern]
     ]
 
+    ; Each CHANGE in the middle of a long string has to move all of the rest
+    ; of it, so replacing many occurrences one at a time is quadratic.  When
+    ; the replacement isn't an action (which sees the target as it is being
+    ; changed), build the new content in one pass and change the target once.
+    ;
+    if all [
+        all_REPLACE
+        not action? :replacement
+        any [any-string? target, binary? target]
+    ][
+        buffer: either binary? target [make binary! 0] [make text! 0]
+        start: target
+        while [pos: find/(case_REPLACE) start :pattern] [
+            append/part buffer start (index of pos) - (index of start)
+            append buffer :replacement
+            target: length of buffer  ; converted to a position below
+            start: skip pos len
+        ]
+        if not same? start save-target [  ; something was replaced
+            append buffer start
+            change/part save-target buffer tail of save-target
+            target: skip save-target target
+        ]
+        return either tail_REPLACE [target] [save-target]
+    ]
+
     while [pos: find/(case_REPLACE) target :pattern] [
         either action? :replacement [
             ;
@@ -244,6 +244,67 @@ load-header: function [
 ]
 
 
+scan-script: function [
+    {Transcode a script body, reusing an earlier scan from the module cache}
+
+    return: [block!]
+    body "Script body (after the header) as UTF-8"
+        [binary! text!]
+    file "File the body was read from, only FILE!s are cached"
+        [<opt> file! url!]
+    line "Line number the body starts at"
+        [<opt> integer!]
+][
+    ; If system/options/module-cache names a directory, the scan of a script
+    ; read from a file is saved there in REBIN format.  The cache file is
+    ; named by a CRC of the key, but the key is saved with the code and is
+    ; compared in full...so a collision (or a stale file) just means a rescan.
+    ;
+    ; The key includes the body's CRC as well as the file's date, and the
+    ; interpreter version and build, in case the scanner or REBIN changed.
+    ;
+    all [
+        file? file
+        dir: match file! system/options/module-cache
+        select system/codecs 'rebin
+        date: attempt [modified? file]
+    ] else [
+        end: transcode/file/line (lit code:) body file line
+        assert [empty? end]  ; should have gone to completion
+        return code
+    ]
+
+    key: mold reduce [
+        clean-path file  date  checksum-core body 'crc32  line
+        system/version  system/build
+    ]
+    cache-file: join dir unspaced [
+        enbase/base checksum-core key 'crc32 16  ".rebin"
+    ]
+
+    all [
+        saved: attempt [decode 'rebin read cache-file]
+        block? saved
+        key = first saved
+        block? code: second saved
+    ] then [
+        return code
+    ]
+
+    end: transcode/file/line (lit code:) body file line
+    assert [empty? end]
+
+    ; Failing to write the cache (e.g. a read-only directory) is not an error,
+    ; the script is just scanned again next time.
+    ;
+    attempt [
+        make-dir/deep dir
+        write cache-file encode 'rebin reduce [key code]
+    ]
+    return code
+]
+
+
 ; !!! This is an idiom that should be done with something like <unbound>
 ; (For bootstrap, don't use anything too tricky so older Ren-C can load this)
 ;
@@ -369,8 +430,7 @@ load: function [
 
     if not block? data [
         assert [match [binary! text!] data]  ; UTF-8
-        end: transcode/file/line (lit data:) data file 'line
-        assert [empty? end]  ; should have gone to completion
+        data: scan-script data file line
     ]
 
     if header [
@@ -508,6 +568,25 @@ do-needs: function [
 ]
 
 
+read-encapped: func [
+    {Source of a file or named module in the encapped archive, if any}
+
+    return: [<opt> binary!]
+    source [file! url! word!]
+][
+    ; An encapped executable may carry an indexed archive of its scripts (see
+    ; INDEXED-ARCHIVE in %encap.reb).  Only that form is consulted here, the
+    ; legacy zip form leaves a BLOCK! in system/options/encap.
+    ;
+    let archive: match object! system/options/encap else [return null]
+    if url? source [return null]
+    if word? source [
+        source: archive/find-module source else [return null]
+    ]
+    return archive/read-file source
+]
+
+
 load-module: func [
     {Loads a module and inserts it into the system module list.}
 
@@ -552,26 +631,30 @@ load-module: func [
     ; Process the source, based on its type
 
     let data
+    let code-file: null  ; set if the source is read from a file on disk
     switch type of source [
         word! [ ; loading the preloaded
             if name [
                 cause-error 'script 'bad-refine /as  ; no renaming
             ]
 
-            ; Return blank if no module of that name found
+            ; If no module of that name is loaded, it may still be in the
+            ; encapped archive.  Return blank if it isn't there either.
 
-            tmp: find/skip system/modules source 2 else [
-                return blank
-            ]
+            if tmp: find/skip system/modules source 2 [
+                set [mod:] next tmp
 
-            set [mod:] next tmp
+                ensure [module! block!] mod
 
-            ensure [module! block!] mod
+                ; If no further processing is needed, shortcut return
 
-            ; If no further processing is needed, shortcut return
-
-            if (not version) and [delay or [module? :mod]] [
-                return reduce [source (try match module! :mod)]
+                if (not version) and [delay or [module? :mod]] [
+                    return reduce [source (try match module! :mod)]
+                ]
+            ] else [
+                data: read-encapped source else [
+                    return blank
+                ]
             ]
         ]
 
@@ -590,7 +673,10 @@ load-module: func [
             let tmp: file-type? source
             case [
                 tmp = 'rebol [
-                    data: read source else [
+                    data: (read-encapped source) else [
+                        code-file: try match file! source
+                        read source
+                    ] else [
                         return blank
                     ]
                 ]
@@ -773,6 +859,7 @@ load-module: func [
 
             ver0 > modver [  ; and it's newer, use it instead
                 mod: _ set [hdr code] mod0
+                code-file: null  ; not the code from SOURCE
                 modver: ver0
                 ext: all [(object? code) code]  ; delayed extension
                 override?: not delay  ; stays delayed if /delay
@@ -812,7 +899,7 @@ load-module: func [
             ]
         ]
 
-        if binary? code [code: make block! code]
+        if binary? code [code: scan-script code code-file line]
 
         ensure object! hdr
         ensure block! code
@@ -995,4 +1082,53 @@ import: function [
 ]
 
 
+load-boot-extension: function [
+    {Load a built-in extension, or just stub its exports if it allows that}
+
+    return: [<opt> module!]
+    collation "Built-in extension details, from BUILTIN-EXTENSIONS"
+        [block!]
+][
+    ; An extension whose init script has `Options: [lazy]` ships its exported
+    ; native specs as TEXT! (see %prep-extension.r).  Scanning that is much
+    ; cheaper than decompressing, scanning, and binding the script and all
+    ; the specs--so boot just puts LAZY stubs into LIB, and the first call
+    ; to any one of them loads the whole extension.
+    ;
+    if blank? exports: fourth collation [
+        return load-extension collation
+    ]
+
+    state: make object! compose/only [
+        collation: (collation)
+        module: _
+    ]
+    for-each [name spec] load exports [
+        name: to word! name
+        append lib reduce [
+            name (lazy :force-lazy-export spec reduce [name state])
+        ]
+    ]
+    return null
+]
+
+force-lazy-export: func [
+    {Generator for the LAZY stubs of LOAD-BOOT-EXTENSION}
+
+    return: [action!]
+    spec [block!]
+    body "The export's name, and the state of the extension it comes from"
+        [block!]
+][
+    ; The first stub called loads the extension for all of them.  That puts
+    ; the real natives in LIB, so only calls through stubs that had already
+    ; been fetched (e.g. by something that was ADAPT-ed) come through here.
+    ;
+    if blank? body/2/module [
+        body/2/module: load-extension body/2/collation
+    ]
+    return ensure action! select body/2/module body/1
+]
+
+
 export [load import]
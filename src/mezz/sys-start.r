@@ -30,6 +30,45 @@ REBOL [
     }
 ]
 
+lazify-mezz: func [
+    {Splice <lazy> sections, making their FUNC and FUNCTION definitions LAZY}
+
+    return: [block!]
+    boot-mezz [block!]
+][
+    ; %make-boot.r wraps mezzanine files marked <lazy> in %boot-files.r as
+    ; `<lazy> [...]`.  Top-level `name: func spec body` in them is rewritten
+    ; as `name: lazy :func spec body`, so only the paramlist is made at boot.
+    ; Specs with GROUP! defaults or <in> and <static> need FUNC's usermode
+    ; processing to make a paramlist, so those definitions are left alone.
+    ;
+    let pos: boot-mezz
+    while [pos: find pos <lazy>] [
+        let section: ensure block! second pos
+        let def: section
+        while [not tail? def] [
+            either all [
+                set-word? first def
+                word? second def
+                find [func function] second def
+                block? third def
+                block? fourth def
+                not find third def group!
+                not find third def <in>
+                not find third def <static>
+            ][
+                change/part next def compose [lazy (to get-word! second def)] 1
+                def: skip def 5
+            ][
+                def: next def
+            ]
+        ]
+        pos: change/part pos section 2
+    ]
+    return boot-mezz
+]
+
+
 finish-init-core: func [
     "Completes the boot sequence for Ren-C core."
     return: <void>
@@ -64,7 +103,7 @@ finish-init-core: func [
     ; The mezzanine is currently considered part of what Startup_Core() will
     ; initialize for all clients.
     ;
-    do bind-lib boot-mezz
+    do bind-lib lazify-mezz boot-mezz
 
     finish-init-core: 'done
 ]
@@ -133,10 +133,13 @@
 %control/quit.test.reb
 %convert/as-binary.test.reb
 %convert/as-string.test.reb
+%convert/csv.test.reb
 %convert/enbin.test.reb
 %convert/encode.test.reb
+%convert/json.test.reb
 %convert/load.test.reb
 %convert/mold.test.reb
+%convert/rebin.test.reb
 %convert/to.test.reb
 
 %define/func.test.reb
@@ -147,6 +150,11 @@
 %file/existsq.test.reb
 %file/make-dir.test.reb
 %file/open.test.reb
+%file/parse-port.test.reb
+%file/read-mapped.test.reb
+%file/read-into.test.reb
+%file/read-line.test.reb
+%file/walk-dir.test.reb
 %file/split-path.test.reb
 %file/file-typeq.test.reb
 
@@ -156,12 +164,15 @@
 %functions/does.test.reb
 %functions/enclose.test.reb
 %functions/enfix.test.reb
+%functions/fold.test.reb
 %functions/frame.test.reb
 %functions/hijack.test.reb
 %functions/invisible.test.reb
+%functions/lazy.test.reb
 %functions/let.test.reb
 %functions/modal.test.reb
 %functions/oneshot.test.reb
+%functions/read-values.test.reb
 %functions/redescribe.test.reb
 %functions/redo.test.reb
 %functions/specialize.test.reb
@@ -231,12 +242,14 @@
 %series/intersect.test.reb
 %series/last.test.reb
 %series/lengthq.test.reb
+%series/make-index.test.reb
 %series/next.test.reb
 %series/ordinals.test.reb
 %series/pick.test.reb
 %series/poke.test.reb
 %series/rejoin.test.reb
 %series/remove.test.reb
+%series/reserve.test.reb
 %series/reverse.test.reb
 %series/replace.test.reb
 %series/reword.test.reb
@@ -266,8 +279,12 @@
 ; test is run or not should depend on whether the extension is present.  TBD.
 
 %../extensions/vector/tests/vector.test.reb
+%../extensions/table/tests/table.test.reb
+%../extensions/persistent/tests/persistent.test.reb
+%../extensions/cache/tests/cache.test.reb
 %../extensions/process/tests/call.test.reb
 %../extensions/dns/tests/dns.test.reb
+%../extensions/pgzip/tests/pgzip.test.reb
 
 
 ; SOURCE ANALYSIS: Check to make sure the Rebol files are "lint"-free, and
@@ -556,3 +556,285 @@
 )(
     <outlier> = countify ["a" "b" "c"] "aaabccbbcd"
 )]
+
+; Iterated BITSET! rules over string and binary input
+
+(
+    digit: charset "0123456789"
+    did parse "12345" [some digit end]
+)
+(
+    digit: charset "0123456789"
+    not parse "12a45" [some digit end]
+)
+(
+    digit: charset "0123456789"
+    did parse "abc" [any digit "abc" end]
+)
+(
+    digit: charset "0123456789"
+    not parse "abc" [some digit "abc"]
+)
+(
+    digit: charset "0123456789"
+    all [
+        did parse "1234x" [copy d 2 4 digit "x" end]
+        d = "1234"
+    ]
+)
+(
+    digit: charset "0123456789"
+    all [
+        did parse "12345" [copy d 3 digit copy r to end]
+        d = "123"
+        r = "45"
+    ]
+)
+(
+    digit: charset "0123456789"
+    not parse "12x" [3 digit]
+)
+(
+    alpha: charset [#"a" - #"z"]
+    did parse "aBcD" [4 alpha end]
+)
+(
+    alpha: charset [#"a" - #"z"]
+    not parse/case "aBcD" [4 alpha end]
+)
+(
+    greek: charset [#"α" - #"ω"]
+    all [
+        did parse "αβγ!" [copy g some greek "!" end]
+        g = "αβγ"
+    ]
+)
+(
+    hi: charset [128 - 255]
+    all [
+        did parse #{8081FF01} [copy b some hi #{01} end]
+        b = #{8081FF}
+    ]
+)
+(
+    digit: charset "0123456789"
+    all [
+        did parse "123" [some digit pos: end]
+        tail? pos
+    ]
+)
+(
+    digit: charset "0123456789"
+    did parse "123abc" [not some "x" while digit "abc" end]
+)
+
+; Alternates ruled out by their first character must give the same result
+; as trying each of them
+
+(
+    verbs: ["GET" | "POST" | "PUT" | "DELETE" | #"X" | "" ]
+    all [
+        did parse "PUT" [copy v verbs end]
+        v = "PUT"
+        did parse "delete" [copy v verbs end]
+        v = "delete"
+        not parse/case "delete" [verbs end]
+        did parse "Q" [copy v verbs "Q" end]
+        v = ""
+        did parse "x" [copy v verbs end]
+        v = "x"
+    ]
+)
+(
+    not parse "" compose ["a" | #"b" | (charset "c")]
+)
+(
+    did parse "" ["a" | #"b" | end]
+)
+(
+    did parse "c" compose ["a" | #"b" | (charset "c") | "d"]
+)
+(
+    did parse "zebra" ["z" "oo" | "zeb" "ra" end]
+)
+(
+    n: 0
+    did parse "b" ["a" (n: n + 1) | "b" (n: n + 10)] and (n = 10)
+)
+
+; PARSE/MEMO reuses the results of BLOCK! rules run at the same position
+
+(
+    n: 0
+    item: [(n: n + 1) "a" "b"]
+    all [
+        did parse/memo "abc" [item "x" | item "c" end]
+        n = 1
+    ]
+)
+(
+    n: 0
+    item: [(n: n + 1) "a" "b"]
+    all [
+        did parse "abc" [item "x" | item "c" end]
+        n = 2
+    ]
+)
+(
+    item: ["a" "b"]
+    all [
+        did parse/memo/stats "abc" [item "x" | item "c" end] 's
+        s = [1 1]
+    ]
+)
+(
+    item: ["a" "z"]
+    all [
+        not parse/memo/stats "abc" [item | item | "x"] 's
+        s = [1 1]
+    ]
+)
+(
+    rule: [["a" | "b"]]
+    all [
+        did parse/memo "abab" [some rule end]
+        did parse/memo "baba" [some rule end]
+        not parse/memo "abc" [some rule end]
+    ]
+)
+(
+    digits: charset "0123456789"
+    num: [some digits]
+    sum: [num "+" sum | num]
+    did parse/memo "1+22+333" [sum end]
+)
+(
+    e: trap [parse/stats "a" ["a"] 's]
+    e/id = 'bad-refines
+)
+(
+    ; Results can't be reused inside COLLECT, as KEEP doesn't run again
+    item: [keep "a"]
+    all [
+        did parse/memo "ab" [collect x [item "x" | item "b"] end]
+        x = ["a"]
+    ]
+)
+
+; COPY and KEEP of string spans, ASCII and not
+
+(
+    all [
+        did parse "key=value;" [copy k to "=" skip copy v to ";" skip end]
+        k = "key"
+        v = "value"
+    ]
+)
+(
+    all [
+        did parse "ключ=значение" [copy k to "=" skip copy v to end]
+        k = "ключ"
+        v = "значение"
+    ]
+)
+(
+    all [
+        did parse "a,bc,def" [collect x [
+            some [keep to [#"," | end] opt skip]
+        ] end]
+        x = ["a" "bc" "def"]
+    ]
+)
+(
+    "bcd" = copy/part skip "abcdef" 1 3
+)
+
+; TO/THRU with a block of literal alternates
+
+(
+    all [
+        did parse "<p>x</span>y</div>" [
+            thru ["</a>" | "</div>" | "</span>"] copy rest to end
+        ]
+        rest = "y</div>"
+    ]
+)
+(
+    all [
+        did parse "abc<b>def" [copy x to [<b> | "zz"] <b> "def" end]
+        x = "abc"
+    ]
+)
+(
+    not parse "abcdef" [thru ["xy" | #"z"] to end]
+)
+(
+    did parse "abc" [thru ["x" | end] end]
+)
+(
+    all [
+        did parse "abcDEF" [copy x to ["def" | #"q"] to end]
+        x = "abc"
+        not parse/case "abcDEF" [to ["def" | #"q"] to end]
+    ]
+)
+(
+    all [
+        did parse "жжжXжж" [copy x to [#"x" | "ю"] to end]
+        x = "жжж"
+    ]
+)
+(
+    all [
+        did parse "aaaюbb" [copy x to ["ю" | #"z"] to end]
+        x = "aaa"
+    ]
+)
+(
+    digit: charset "0123456789"
+    stop: ";"
+    all [
+        did parse "ab;7" [copy x to [digit | stop] to end]
+        x = "ab"
+    ]
+)
+
+; PARSE/PROFILE counts attempts and matches for each rule cell
+
+(
+    did all [
+        parse/profile "ac" [["a" "b" | "a" "c"] end] 'p
+        6 = length of p
+        (collect [for-each r p [keep/only reduce [r/3 r/4 r/5]]]) = [
+            ["a" 1 1] ["b" 1 0] ["a" 1 1] ["c" 1 1]
+            [["a" "b" | "a" "c"] 1 1] [end 1 1]
+        ]
+        (collect [for-each r p [keep integer? r/6]]) = [
+            #[true] #[true] #[true] #[true] #[true] #[true]
+        ]
+    ]
+)
+(
+    digit: charset "0123456789"
+    did all [
+        parse/profile "12,345,6" [some [some digit opt ","] end] 'p
+        r: last p
+        'end = r/3
+        1 = r/4
+    ]
+)
+(
+    rule: [
+        "x"
+        "y"
+    ]
+    did all [
+        not parse/profile "xz" rule 'p
+        2 = length of p
+        any [
+            blank? p/1/2  ; rules not loaded from source have no line
+            (p/2/2 - p/1/2) = 1  ; one line further down
+        ]
+        0 = p/2/5
+    ]
+)
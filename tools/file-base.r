@@ -61,6 +61,7 @@ core: [
     d-winstack.c
 
     ; (F)???
+    f-bigint.c
     f-blocks.c
     [
         f-deci.c
@@ -73,6 +74,11 @@ core: [
         ;
         <msc:/wd5045>  ; https://stackoverflow.com/q/50399940
     ]
+    [
+        u-zlib-simd.c
+
+        <no-make-header>
+    ]
     f-device.c
     [
         f-dtoa.c
@@ -103,6 +109,11 @@ core: [
         ;
         <msc:/wd5045>  ; https://stackoverflow.com/q/50399940
     ]
+    [
+        u-zlib-simd.c
+
+        <no-make-header>
+    ]
     f-extension.c
     f-int.c
     f-math.c
@@ -186,6 +197,11 @@ core: [
         ;
         <msc:/wd5045>  ; https://stackoverflow.com/q/50399940
     ]
+    [
+        u-zlib-simd.c
+
+        <no-make-header>
+    ]
 ]
 
 ; Files created by the make-boot process
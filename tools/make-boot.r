@@ -725,9 +725,21 @@ for-each section [:boot-base boot-sys :boot-mezz] [
     else [
         set section s: make text! 20000
         append/line s "["
+        lazy: false
         for-each file first mezz-files [
+            if tag? file [  ; only <lazy> so far, see FINISH-INIT-CORE
+                lazy: true
+                continue
+            ]
             text: stripload join %../mezz/ file  ; doesn't use LOAD to strip
-            append/line s text
+            either lazy [
+                append/line s "<lazy> ["
+                append/line s text
+                append/line s "]"
+                lazy: false
+            ][
+                append/line s text
+            ]
         ]
         append/line s "_"  ; !!! would <section-done> be better?
         append/line s "]"
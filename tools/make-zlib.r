@@ -390,11 +390,49 @@ for-each c-file [
 
 disable-user-includes/stdio/inline source-lines copy [%trees.h %inffixed.h %crc32.h]
 
+;
+; Hook crc32_z() and adler32_z() up to the hardware accelerated kernels in
+; %u-zlib-simd.c.  Those return 0 when the CPU lacks the instructions, and
+; the portable zlib code runs as usual (it also handles any leftover tail).
+;
+patch-after: function [
+    {Insert lines after the line of SOURCE-LINES that matches TARGET}
+    target [text!]
+    lines [block!]
+][
+    pos: find source-lines target else [
+        fail ["make-zlib.r couldn't find line to patch:" mold target]
+    ]
+    insert next pos lines
+]
+
+patch-after "    if (buf == Z_NULL) return 0UL;" [
+    ""
+    "    if (len >= 64) { /* REBOL: see make-zlib.r */"
+    "        z_size_t done = Zlib_Crc32_Simd(&crc, buf, len);"
+    "        buf += done;"
+    "        len -= done;"
+    "        if (len == 0)"
+    "            return crc;"
+    "    }"
+]
+
+patch-after "        return 1L;" [
+    ""
+    "    /* REBOL: see make-zlib.r */"
+    "    if (len >= 64 && Zlib_Adler32_Simd(&adler, adler | (sum2 << 16), buf, len))"
+    "        return adler;"
+]
+
 insert source-lines [
     {}
     {#include "sys-zlib.h" /* REBOL: see make-zlib.r */}
     {#define local static}
     {}
+    {/* REBOL: accelerated kernels in %u-zlib-simd.c, see make-zlib.r */}
+    {z_size_t Zlib_Crc32_Simd(unsigned long *crc, const unsigned char *buf, z_size_t len);}
+    {int Zlib_Adler32_Simd(unsigned long *adler_out, unsigned long adler, const unsigned char *buf, z_size_t len);}
+    {}
 ]
 
 insert source-lines make-warning-lines file-source {ZLIB aggregated source file}
@@ -309,6 +309,36 @@ e: make-emitter "Ext custom init code" dest
 ;
 script-compressed: gzip (script-uncompressed: read script-name)
 
+; An init script whose header says `Options: [lazy]` has nothing to run at
+; boot--no codecs, schemes, or exports of its own.  So boot only has to stub
+; the exported natives (see SYS/LOAD-BOOT-EXTENSION), and the script is not
+; decompressed or scanned unless one of them is called.  Their specs go in as
+; plain text, since that's all boot needs.
+;
+script-header: first load/header script-name
+lazy-exports: either all [
+    block? script-header/options
+    find script-header/options 'lazy
+][
+    collect [  ; only what made it into NATIVE-LIST for this platform
+        parse native-list [any [
+            'export set n-name set-word! [
+                'native | 'native/body
+            ] set n-spec block! opt block! (
+                keep n-name
+                keep/only n-spec
+            )
+                |
+            set-word! ['native | 'native/body] block! opt block!
+        ] end] else [
+            fail "Could not scan NATIVE-LIST for lazy exports"
+        ]
+    ]
+][
+    []
+]
+lazy-exports-bin: append (to-binary mold/only lazy-exports) #{00}
+
 e/emit {
     #include "sys-core.h" /* !!! Could this just use "rebol.h"? */
 
@@ -339,6 +369,13 @@ e/emit {
         nullptr /* just here to ensure > 0 length array (C++ requirement) */
     };
 
+    /*
+     * Exported native specs for LAZY stubs, if `Options: [lazy]` (else "")
+     */
+    static const REBYTE lazy_exports[$<length of lazy-exports-bin>] = {
+        $<Binary-To-C Lazy-Exports-Bin>
+    };
+
     /*
      * Hook called by the core to gather all the details of the extension up
      * so the system can process it.  This hook doesn't decompress any of the
@@ -357,7 +394,8 @@ e/emit {
         return rebCollateExtension_internal(
             script_compressed, sizeof(script_compressed),
             specs_compressed, sizeof(specs_compressed),
-            native_dispatchers, $<num-natives>
+            native_dispatchers, $<num-natives>,
+            lazy_exports
         );
     }
 }